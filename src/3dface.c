@@ -40,6 +40,7 @@
 
 
 #include "3dface.h"
+#include "entities.h"
 
 
 /*!
@@ -119,42 +120,17 @@ dxf_3dface_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        face->id_code = 0;
-        face->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        face->layer = strdup (DXF_DEFAULT_LAYER);
-        face->elevation = 0.0;
-        face->thickness = 0.0;
-        face->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        face->visibility = DXF_DEFAULT_VISIBILITY;
-        face->color = DXF_COLOR_BYLAYER;
-        face->paperspace = DXF_MODELSPACE;
-        face->graphics_data_size = 0;
-        face->shadow_mode = 0;
-        face->dictionary_owner_soft = strdup ("");
-        face->object_owner_soft = strdup ("");
-        face->material = strdup ("");
-        face->dictionary_owner_hard = strdup ("");
-        face->lineweight = 0;
-        face->plot_style_name = strdup ("");
-        face->color_value = 0;
-        face->color_name = strdup ("");
-        face->transparency = 0;
-        face->p0->x0 = 0.0;
-        face->p0->y0 = 0.0;
-        face->p0->z0 = 0.0;
-        face->p1->x0 = 0.0;
-        face->p1->y0 = 0.0;
-        face->p1->z0 = 0.0;
-        face->p2->x0 = 0.0;
-        face->p2->y0 = 0.0;
-        face->p2->z0 = 0.0;
-        face->p3->x0 = 0.0;
-        face->p3->y0 = 0.0;
-        face->p3->z0 = 0.0;
+        if (dxf_entity_common_init (&face->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         face->flag = 0;
+        face->offsets = NULL;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        face->binary_graphics_data = NULL;
         face->p0 = NULL;
         face->p1 = NULL;
         face->p2 = NULL;
@@ -167,6 +143,33 @@ dxf_3dface_init
 }
 
 
+/*!
+ * \brief Get the address of corner point \c corner (0 to 3) of a DXF
+ * \c 3DFACE entity.
+ */
+static DxfPoint **
+dxf_3dface_get_corner
+(
+        Dxf3dface *face,
+                /*!< a pointer to a DXF \c 3DFACE entity. */
+        int corner
+                /*!< number of the corner point. */
+)
+{
+        switch (corner)
+        {
+                case 0:
+                        return (&face->p0);
+                case 1:
+                        return (&face->p1);
+                case 2:
+                        return (&face->p2);
+                default:
+                        return (&face->p3);
+        }
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c 3DFACE entity.
  *
@@ -174,6 +177,9 @@ dxf_3dface_init
  * Now follows some data for the \c 3DFACE, to be terminated with a "  0"
  * string announcing the following entity, or the end of the \c ENTITY
  * section marker \c ENDSEC. \n
+ * When single precision was requested with
+ * dxf_read_set_single_precision () the corner points are stored as
+ * single precision offsets.
  *
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_3dface_read.png
@@ -193,9 +199,10 @@ dxf_3dface_read
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfPoint **corner;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -203,8 +210,6 @@ dxf_3dface_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (face == NULL)
@@ -212,392 +217,119 @@ dxf_3dface_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                face = dxf_3dface_init (face);
-        }
-        if (face->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                face->binary_graphics_data = dxf_binary_data_init (face->binary_graphics_data);
-                if (face->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (face->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p0 = dxf_point_init (face->p0);
-                if (face->p0 == NULL)
+                face = dxf_3dface_init (dxf_3dface_new ());
+                if (face == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
                         return (NULL);
                 }
         }
-        if (face->p1 == NULL)
+        for (;;)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p1 = dxf_point_init (face->p1);
-                if (face->p1 == NULL)
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-        }
-        if (face->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p2 = dxf_point_init (face->p2);
-                if (face->p2 == NULL)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (face->p3 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p3 = dxf_point_init (face->p3);
-                if (face->p3 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-        }
-        iter310 = (DxfBinaryData *) face->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &face->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the first point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the first point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of first the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the second point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the second point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the second point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the third point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the third point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the third point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the fourth point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the fourth point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the fourth point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->p3->z0);
-                }
-                else if ((strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &face->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * value of edge visibility flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->flag);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbFace") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &face->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &face->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        break;
                 }
-                else
+                (fp->line_number)++;
+                switch (group_code)
                 {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 10:
+                        case 11:
+                        case 12:
+                        case 13:
+                        case 20:
+                        case 21:
+                        case 22:
+                        case 23:
+                        case 30:
+                        case 31:
+                        case 32:
+                        case 33:
+                                /* A coordinate of one of the corner
+                                 * points, allocated when first used. */
+                                corner = dxf_3dface_get_corner (face, group_code % 10);
+                                if (*corner == NULL)
+                                {
+                                        *corner = dxf_point_init (dxf_point_new ());
+                                        if (*corner == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                }
+                                if (group_code < 20)
+                                {
+                                        (*corner)->x0 = atof (value);
+                                }
+                                else if (group_code < 30)
+                                {
+                                        (*corner)->y0 = atof (value);
+                                }
+                                else
+                                {
+                                        (*corner)->z0 = atof (value);
+                                }
+                                break;
+                        case 70:
+                                /* Flag value. */
+                                face->flag = (int16_t) atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbFace") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &face->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (face->linetype, "") == 0)
+        if ((face->common.linetype == NULL)
+          || (strcmp (face->common.linetype, "") == 0))
         {
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (face->common.linetype);
+                face->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (face->layer, "") == 0)
+        if ((face->common.layer == NULL)
+          || (strcmp (face->common.layer, "") == 0))
         {
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                free (face->common.layer);
+                face->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
+        if (fp->single_precision)
+        {
+                dxf_3dface_set_single_precision (face, fp->origin_x, fp->origin_y, fp->origin_z);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -624,6 +356,11 @@ dxf_3dface_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("3DFACE");
+        DxfPoint *corner;
+        double x;
+        double y;
+        double z;
+        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -644,31 +381,31 @@ dxf_3dface_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if ((strcmp (face->layer, "") == 0) || (face->layer == NULL))
+        if ((strcmp (face->common.layer, "") == 0) || (face->common.layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, face->id_code);
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, face->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                face->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (face->linetype == NULL)
+        if (face->common.linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, face->id_code);
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, face->common.id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                face->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (face->id_code != -1)
+        if (face->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", face->id_code);
+                dxf_handle_write (fp, 5, face->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -680,129 +417,121 @@ dxf_3dface_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (face->dictionary_owner_soft, "") != 0)
+        if ((face->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", face->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, face->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (face->dictionary_owner_hard, "") != 0)
+        if ((face->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", face->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, face->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (face->object_owner_soft, "") != 0)
+        if ((face->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", face->object_owner_soft);
+                dxf_handle_write (fp, 330, face->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (face->paperspace == DXF_PAPERSPACE)
+        if (face->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", face->layer);
-        if (strcmp (face->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", face->common.layer);
+        if (strcmp (face->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", face->linetype);
+                fprintf (fp->fp, "  6\n%s\n", face->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (face->material, "") != 0))
+          && (face->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", face->material);
+                dxf_handle_write (fp, 347, face->common.cold->material);
         }
-        if (face->color != DXF_COLOR_BYLAYER)
+        if (face->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", face->color);
+                fprintf (fp->fp, " 62\n%hd\n", face->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", face->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", face->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (face->elevation != 0.0))
+          && (face->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", face->elevation);
+                fprintf (fp->fp, " 38\n%f\n", face->common.elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
-          && (face->thickness != 0.0))
+          && (face->common.thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", face->thickness);
+                fprintf (fp->fp, " 39\n%f\n", face->common.thickness);
         }
-        if (face->linetype_scale != 1.0)
+        if (face->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", face->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", face->common.linetype_scale);
         }
-        if (face->visibility != 0)
+        if (face->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", face->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", face->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (face->binary_graphics_data != NULL))
+          && (face->common.cold->binary_graphics_data != NULL))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", face->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", face->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", face->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", face->common.cold->graphics_data_size);
 #endif
-                if (face->binary_graphics_data != NULL)
+                if (face->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) face->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, face->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", face->color_value);
-                fprintf (fp->fp, "430\n%s\n", face->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", face->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", face->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", face->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", face->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", face->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", face->shadow_mode);
+                dxf_handle_write (fp, 390, face->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", face->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbFace\n");
         }
-        if (face->p0 != NULL)
+        for (i = 0; i < 4; i++)
         {
-                fprintf (fp->fp, " 10\n%f\n", face->p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", face->p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", face->p0->z0);
-        }
-        if (face->p1 != NULL)
-        {
-                fprintf (fp->fp, " 11\n%f\n", face->p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", face->p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", face->p1->z0);
-        }
-        if (face->p2 != NULL)
-        {
-                fprintf (fp->fp, " 12\n%f\n", face->p2->x0);
-                fprintf (fp->fp, " 22\n%f\n", face->p2->y0);
-                fprintf (fp->fp, " 32\n%f\n", face->p2->z0);
-        }
-        if (face->p3)
-        {
-                fprintf (fp->fp, " 13\n%f\n", face->p3->x0);
-                fprintf (fp->fp, " 23\n%f\n", face->p3->y0);
-                fprintf (fp->fp, " 33\n%f\n", face->p3->z0);
+                corner = *dxf_3dface_get_corner (face, i);
+                if (face->offsets != NULL)
+                {
+                        dxf_point_offsets_get (face->offsets, i, &x, &y, &z);
+                }
+                else if (corner != NULL)
+                {
+                        x = corner->x0;
+                        y = corner->y0;
+                        z = corner->z0;
+                }
+                else
+                {
+                        continue;
+                }
+                fprintf (fp->fp, " 1%d\n%f\n", i, x);
+                fprintf (fp->fp, " 2%d\n%f\n", i, y);
+                fprintf (fp->fp, " 3%d\n%f\n", i, z);
         }
         fprintf (fp->fp, " 70\n%hd\n", face->flag);
+        dxf_entity_common_write_xdata (fp, &face->common);
         /* Clean up. */
         free (dxf_entity_name);
 #ifdef DEBUG
@@ -847,19 +576,27 @@ dxf_3dface_free
                 __FUNCTION__);
               return (face);
         }
-        free (face->linetype);
-        free (face->layer);
-        dxf_binary_data_free_list (face->binary_graphics_data);
-        free (face->dictionary_owner_soft);
-        free (face->object_owner_soft);
-        free (face->material);
-        free (face->dictionary_owner_hard);
-        free (face->plot_style_name);
-        free (face->color_name);
-        dxf_point_free_list (face->p0);
-        dxf_point_free_list (face->p1);
-        dxf_point_free_list (face->p2);
-        dxf_point_free_list (face->p3);
+        dxf_entity_common_free (&face->common);
+        if (face->p0 != NULL)
+        {
+                dxf_point_free (face->p0);
+        }
+        if (face->p1 != NULL)
+        {
+                dxf_point_free (face->p1);
+        }
+        if (face->p2 != NULL)
+        {
+                dxf_point_free (face->p2);
+        }
+        if (face->p3 != NULL)
+        {
+                dxf_point_free (face->p3);
+        }
+        if (face->offsets != NULL)
+        {
+                dxf_point_offsets_free (face->offsets);
+        }
         free (face);
         face = NULL;
 #ifdef DEBUG
@@ -896,6 +633,7 @@ dxf_3dface_free_list
         while (faces != NULL)
         {
                 Dxf3dface *iter = (Dxf3dface *) faces->next;
+                faces->next = NULL;
                 dxf_3dface_free (faces);
                 faces = (Dxf3dface *) iter;
         }
@@ -905,6 +643,110 @@ dxf_3dface_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c 3DFACE entity.
+ *
+ * The copy does not share any memory with \c face, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+Dxf3dface *
+dxf_3dface_copy
+(
+        Dxf3dface *face
+                /*!< a pointer to the DXF \c 3DFACE entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        Dxf3dface *copy;
+
+        /* Do some basic checks. */
+        if (face == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_3dface_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, face, sizeof (Dxf3dface));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->offsets = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &face->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_3dface_free (copy);
+                return (NULL);
+        }
+        if (face->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (face->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_3dface_free (copy);
+                        return (NULL);
+                }
+        }
+        if (face->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (face->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_3dface_free (copy);
+                        return (NULL);
+                }
+        }
+        if (face->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (face->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_3dface_free (copy);
+                        return (NULL);
+                }
+        }
+        if (face->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (face->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_3dface_free (copy);
+                        return (NULL);
+                }
+        }
+        if (face->offsets != NULL)
+        {
+                copy->offsets = dxf_point_offsets_copy (face->offsets);
+                if (copy->offsets == NULL)
+                {
+                        dxf_3dface_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c 3DFACE entity.
  *
@@ -913,7 +755,7 @@ dxf_3dface_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_3dface_get_id_code
 (
         Dxf3dface *face
@@ -931,16 +773,10 @@ dxf_3dface_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->id_code);
+        return (face->common.id_code);
 }
 
 
@@ -958,7 +794,7 @@ dxf_3dface_set_id_code
 (
         Dxf3dface *face,
                 /*!< a pointer to a DXF \c 3DFACE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -975,13 +811,7 @@ dxf_3dface_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        face->id_code = id_code;
+        face->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1016,7 +846,7 @@ dxf_3dface_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->linetype ==  NULL)
+        if (face->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1026,7 +856,7 @@ dxf_3dface_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->linetype));
+        return (strdup (face->common.linetype));
 }
 
 
@@ -1069,7 +899,7 @@ dxf_3dface_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        face->linetype = strdup (linetype);
+        face->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1104,7 +934,7 @@ dxf_3dface_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->layer ==  NULL)
+        if (face->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1114,7 +944,7 @@ dxf_3dface_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->layer));
+        return (strdup (face->common.layer));
 }
 
 
@@ -1156,7 +986,7 @@ dxf_3dface_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        face->layer = strdup (layer);
+        face->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1193,7 +1023,7 @@ dxf_3dface_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->elevation);
+        return (face->common.elevation);
 }
 
 
@@ -1226,7 +1056,7 @@ dxf_3dface_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        face->elevation = elevation;
+        face->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1260,7 +1090,7 @@ dxf_3dface_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->thickness < 0.0)
+        if (face->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1269,7 +1099,7 @@ dxf_3dface_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->thickness);
+        return (face->common.thickness);
 }
 
 
@@ -1308,7 +1138,7 @@ dxf_3dface_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        face->thickness = thickness;
+        face->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1342,7 +1172,7 @@ dxf_3dface_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->linetype_scale < 0.0)
+        if (face->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1351,7 +1181,7 @@ dxf_3dface_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->linetype_scale);
+        return (face->common.linetype_scale);
 }
 
 
@@ -1390,7 +1220,7 @@ dxf_3dface_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        face->linetype_scale = linetype_scale;
+        face->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1424,13 +1254,13 @@ dxf_3dface_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->visibility < 0)
+        if (face->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (face->visibility > 1)
+        if (face->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1439,7 +1269,7 @@ dxf_3dface_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->visibility);
+        return (face->common.visibility);
 }
 
 
@@ -1484,7 +1314,7 @@ dxf_3dface_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        face->visibility = visibility;
+        face->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1518,7 +1348,7 @@ dxf_3dface_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->color < 0)
+        if (face->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1527,7 +1357,7 @@ dxf_3dface_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->color);
+        return (face->common.color);
 }
 
 
@@ -1566,7 +1396,7 @@ dxf_3dface_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        face->color = color;
+        face->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1600,13 +1430,13 @@ dxf_3dface_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->paperspace < 0)
+        if (face->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (face->paperspace > 1)
+        if (face->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1615,7 +1445,7 @@ dxf_3dface_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->paperspace);
+        return (face->common.paperspace);
 }
 
 
@@ -1660,7 +1490,7 @@ dxf_3dface_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        face->paperspace = paperspace;
+        face->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1696,13 +1526,13 @@ dxf_3dface_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->graphics_data_size < 0)
+        if (face->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (face->graphics_data_size == 0)
+        if (face->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1711,7 +1541,7 @@ dxf_3dface_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->graphics_data_size);
+        return (face->common.cold->graphics_data_size);
 }
 
 
@@ -1758,7 +1588,7 @@ dxf_3dface_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        face->graphics_data_size = graphics_data_size;
+        face->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1793,13 +1623,13 @@ dxf_3dface_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (face->shadow_mode < 0)
+        if (face->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (face->shadow_mode > 3)
+        if (face->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1808,7 +1638,7 @@ dxf_3dface_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->shadow_mode);
+        return (face->common.cold->shadow_mode);
 }
 
 
@@ -1853,7 +1683,7 @@ dxf_3dface_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        face->shadow_mode = shadow_mode;
+        face->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1868,11 +1698,12 @@ dxf_3dface_set_shadow_mode
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_3dface_get_binary_graphics_data.png
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_3dface_get_binary_graphics_data
 (
         Dxf3dface *face
@@ -1890,17 +1721,10 @@ dxf_3dface_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) face->binary_graphics_data);
+        return (face->common.cold->binary_graphics_data);
 }
 
 
@@ -1908,17 +1732,23 @@ dxf_3dface_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c 3DFACE entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_3dface_set_binary_graphics_data.png
+ *
+ * \return a pointer to \c face when successful, or \c NULL when an
+ * error occurred.
  */
 Dxf3dface *
 dxf_3dface_set_binary_graphics_data
 (
         Dxf3dface *face,
                 /*!< a pointer to a DXF \c 3DFACE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1939,23 +1769,12 @@ dxf_3dface_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->binary_graphics_data == NULL)
+        if ((face->common.cold->binary_graphics_data != NULL)
+          && (face->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                face->binary_graphics_data = dxf_binary_data_init (face->binary_graphics_data);
-                if (face->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (face->common.cold->binary_graphics_data);
         }
-        face->binary_graphics_data = (DxfBinaryData *) data;
+        face->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1992,17 +1811,10 @@ dxf_3dface_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->dictionary_owner_soft));
+        return (dxf_handle_to_string (face->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2041,7 +1853,7 @@ dxf_3dface_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        face->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        face->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2078,17 +1890,10 @@ dxf_3dface_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->object_owner_soft));
+        return (dxf_handle_to_string (face->common.cold->object_owner_soft));
 }
 
 
@@ -2127,7 +1932,7 @@ dxf_3dface_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        face->object_owner_soft = strdup (object_owner_soft);
+        face->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2164,17 +1969,10 @@ dxf_3dface_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->material));
+        return (dxf_handle_to_string (face->common.cold->material));
 }
 
 
@@ -2215,7 +2013,7 @@ dxf_3dface_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        face->material = strdup (material);
+        face->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2248,21 +2046,14 @@ dxf_3dface_get_dictionary_owner_hard
         if (face == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (face->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->dictionary_owner_hard));
+        return (dxf_handle_to_string (face->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2304,7 +2095,7 @@ dxf_3dface_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        face->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        face->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2342,7 +2133,7 @@ dxf_3dface_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->lineweight);
+        return (face->common.lineweight);
 }
 
 
@@ -2375,7 +2166,7 @@ dxf_3dface_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        face->lineweight = lineweight;
+        face->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2410,17 +2201,10 @@ dxf_3dface_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->plot_style_name));
+        return (dxf_handle_to_string (face->common.cold->plot_style_name));
 }
 
 
@@ -2461,7 +2245,7 @@ dxf_3dface_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        face->plot_style_name = strdup (plot_style_name);
+        face->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2499,7 +2283,7 @@ dxf_3dface_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->color_value);
+        return (face->common.color_value);
 }
 
 
@@ -2532,7 +2316,7 @@ dxf_3dface_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        face->color_value = color_value;
+        face->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2567,7 +2351,7 @@ dxf_3dface_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (face->color_name ==  NULL)
+        if (face->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2577,7 +2361,7 @@ dxf_3dface_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->color_name));
+        return (strdup (face->common.cold->color_name));
 }
 
 
@@ -2618,7 +2402,7 @@ dxf_3dface_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        face->color_name = strdup (color_name);
+        face->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2656,7 +2440,7 @@ dxf_3dface_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (face->transparency);
+        return (face->common.cold->transparency);
 }
 
 
@@ -2689,7 +2473,7 @@ dxf_3dface_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        face->transparency = transparency;
+        face->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4445,7 +4229,7 @@ dxf_3dface_create_from_points
                 /*!< a pointer to a DXF \c POINT entity. */
         DxfPoint *p3,
                 /*!< a pointer to a DXF \c POINT entity. */
-        int id_code,
+        DxfHandle id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -4482,12 +4266,6 @@ dxf_3dface_create_from_points
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         if ((inheritance < 0) || (inheritance > 4))
         {
                 fprintf (stderr,
@@ -4555,7 +4333,7 @@ dxf_3dface_create_from_points
                                   __FUNCTION__);
                                 break;
                         }
-                        if (p0->linetype == NULL)
+                        if (p0->common.linetype == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4563,9 +4341,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p0->linetype);
+                                face->common.linetype = strdup (p0->common.linetype);
                         }
-                        if (p0->layer == NULL)
+                        if (p0->common.layer == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4573,70 +4351,25 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p0->layer);
+                                face->common.layer = strdup (p0->common.layer);
                         }
-                        face->elevation = p0->elevation;
-                        face->thickness = p0->thickness;
-                        face->linetype_scale = p0->linetype_scale;
-                        face->visibility = p0->visibility;
-                        face->color = p0->color;
-                        face->paperspace = p0->paperspace;
+                        face->common.elevation = p0->common.elevation;
+                        face->common.thickness = p0->common.thickness;
+                        face->common.linetype_scale = p0->common.linetype_scale;
+                        face->common.visibility = p0->common.visibility;
+                        face->common.color = p0->common.color;
+                        face->common.paperspace = p0->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        face->shadow_mode = p0->shadow_mode;
+                        face->common.cold->shadow_mode = p0->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p0->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
-                        }
-                        if (p0->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->object_owner_soft = strdup (p0->object_owner_soft);
-                        }
-                        if (p0->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->material = strdup (p0->material);
-                        }
-                        if (p0->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
-                        }
-                        face->lineweight = p0->lineweight;
-                        if (p0->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->plot_style_name = strdup (p0->plot_style_name);
-                        }
-                        face->color_value = p0->color_value;
-                        if (p0->color_name == NULL)
+                        face->common.cold->dictionary_owner_soft = p0->common.cold->dictionary_owner_soft;
+                        face->common.cold->object_owner_soft = p0->common.cold->object_owner_soft;
+                        face->common.cold->material = p0->common.cold->material;
+                        face->common.cold->dictionary_owner_hard = p0->common.cold->dictionary_owner_hard;
+                        face->common.lineweight = p0->common.lineweight;
+                        face->common.cold->plot_style_name = p0->common.cold->plot_style_name;
+                        face->common.color_value = p0->common.color_value;
+                        if (p0->common.cold->color_name == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4644,9 +4377,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p0->color_name);
+                                face->common.cold->color_name = strdup (p0->common.cold->color_name);
                         }
-                        face->transparency = p0->transparency;
+                        face->common.cold->transparency = p0->common.cold->transparency;
                         break;
                 case 2:
                         if (p1 == NULL)
@@ -4656,7 +4389,7 @@ dxf_3dface_create_from_points
                                   __FUNCTION__);
                                 break;
                         }
-                        if (p1->linetype == NULL)
+                        if (p1->common.linetype == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4664,9 +4397,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p1->linetype);
+                                face->common.linetype = strdup (p1->common.linetype);
                         }
-                        if (p1->layer == NULL)
+                        if (p1->common.layer == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4674,70 +4407,25 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p1->layer);
+                                face->common.layer = strdup (p1->common.layer);
                         }
-                        face->elevation = p1->elevation;
-                        face->thickness = p1->thickness;
-                        face->linetype_scale = p1->linetype_scale;
-                        face->visibility = p1->visibility;
-                        face->color = p1->color;
-                        face->paperspace = p1->paperspace;
+                        face->common.elevation = p1->common.elevation;
+                        face->common.thickness = p1->common.thickness;
+                        face->common.linetype_scale = p1->common.linetype_scale;
+                        face->common.visibility = p1->common.visibility;
+                        face->common.color = p1->common.color;
+                        face->common.paperspace = p1->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        face->shadow_mode = p1->shadow_mode;
+                        face->common.cold->shadow_mode = p1->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p1->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
-                        }
-                        if (p1->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->object_owner_soft = strdup (p1->object_owner_soft);
-                        }
-                        if (p1->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->material = strdup (p1->material);
-                        }
-                        if (p1->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
-                        }
-                        face->lineweight = p1->lineweight;
-                        if (p1->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->plot_style_name = strdup (p1->plot_style_name);
-                        }
-                        face->color_value = p1->color_value;
-                        if (p1->color_name == NULL)
+                        face->common.cold->dictionary_owner_soft = p1->common.cold->dictionary_owner_soft;
+                        face->common.cold->object_owner_soft = p1->common.cold->object_owner_soft;
+                        face->common.cold->material = p1->common.cold->material;
+                        face->common.cold->dictionary_owner_hard = p1->common.cold->dictionary_owner_hard;
+                        face->common.lineweight = p1->common.lineweight;
+                        face->common.cold->plot_style_name = p1->common.cold->plot_style_name;
+                        face->common.color_value = p1->common.color_value;
+                        if (p1->common.cold->color_name == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4745,9 +4433,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p1->color_name);
+                                face->common.cold->color_name = strdup (p1->common.cold->color_name);
                         }
-                        face->transparency = p1->transparency;
+                        face->common.cold->transparency = p1->common.cold->transparency;
                         break;
                 case 3:
                         if (p2 == NULL)
@@ -4757,7 +4445,7 @@ dxf_3dface_create_from_points
                                   __FUNCTION__);
                                 break;
                         }
-                        if (p2->linetype == NULL)
+                        if (p2->common.linetype == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4765,9 +4453,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p2->linetype);
+                                face->common.linetype = strdup (p2->common.linetype);
                         }
-                        if (p2->layer == NULL)
+                        if (p2->common.layer == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4775,70 +4463,25 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p2->layer);
+                                face->common.layer = strdup (p2->common.layer);
                         }
-                        face->elevation = p2->elevation;
-                        face->thickness = p2->thickness;
-                        face->linetype_scale = p2->linetype_scale;
-                        face->visibility = p2->visibility;
-                        face->color = p2->color;
-                        face->paperspace = p2->paperspace;
+                        face->common.elevation = p2->common.elevation;
+                        face->common.thickness = p2->common.thickness;
+                        face->common.linetype_scale = p2->common.linetype_scale;
+                        face->common.visibility = p2->common.visibility;
+                        face->common.color = p2->common.color;
+                        face->common.paperspace = p2->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        face->shadow_mode = p2->shadow_mode;
+                        face->common.cold->shadow_mode = p2->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p2->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
-                        }
-                        if (p2->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->object_owner_soft = strdup (p2->object_owner_soft);
-                        }
-                        if (p2->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->material = strdup (p2->material);
-                        }
-                        if (p2->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
-                        }
-                        face->lineweight = p2->lineweight;
-                        if (p2->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->plot_style_name = strdup (p2->plot_style_name);
-                        }
-                        face->color_value = p2->color_value;
-                        if (p2->color_name == NULL)
+                        face->common.cold->dictionary_owner_soft = p2->common.cold->dictionary_owner_soft;
+                        face->common.cold->object_owner_soft = p2->common.cold->object_owner_soft;
+                        face->common.cold->material = p2->common.cold->material;
+                        face->common.cold->dictionary_owner_hard = p2->common.cold->dictionary_owner_hard;
+                        face->common.lineweight = p2->common.lineweight;
+                        face->common.cold->plot_style_name = p2->common.cold->plot_style_name;
+                        face->common.color_value = p2->common.color_value;
+                        if (p2->common.cold->color_name == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4846,9 +4489,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p2->color_name);
+                                face->common.cold->color_name = strdup (p2->common.cold->color_name);
                         }
-                        face->transparency = p2->transparency;
+                        face->common.cold->transparency = p2->common.cold->transparency;
                         break;
                 case 4:
                         if (p3 == NULL)
@@ -4858,7 +4501,7 @@ dxf_3dface_create_from_points
                                   __FUNCTION__);
                                 break;
                         }
-                        if (p3->linetype == NULL)
+                        if (p3->common.linetype == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4866,9 +4509,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->linetype = strdup (p3->linetype);
+                                face->common.linetype = strdup (p3->common.linetype);
                         }
-                        if (p3->layer == NULL)
+                        if (p3->common.layer == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4876,70 +4519,25 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->layer = strdup (p3->layer);
+                                face->common.layer = strdup (p3->common.layer);
                         }
-                        face->elevation = p3->elevation;
-                        face->thickness = p3->thickness;
-                        face->linetype_scale = p3->linetype_scale;
-                        face->visibility = p3->visibility;
-                        face->color = p3->color;
-                        face->paperspace = p3->paperspace;
+                        face->common.elevation = p3->common.elevation;
+                        face->common.thickness = p3->common.thickness;
+                        face->common.linetype_scale = p3->common.linetype_scale;
+                        face->common.visibility = p3->common.visibility;
+                        face->common.color = p3->common.color;
+                        face->common.paperspace = p3->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        face->shadow_mode = p3->shadow_mode;
+                        face->common.cold->shadow_mode = p3->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p3->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_soft = strdup (p3->dictionary_owner_soft);
-                        }
-                        if (p3->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->object_owner_soft = strdup (p3->object_owner_soft);
-                        }
-                        if (p3->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->material = strdup (p3->material);
-                        }
-                        if (p3->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->dictionary_owner_hard = strdup (p3->dictionary_owner_hard);
-                        }
-                        face->lineweight = p3->lineweight;
-                        if (p3->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                face->plot_style_name = strdup (p3->plot_style_name);
-                        }
-                        face->color_value = p3->color_value;
-                        if (p3->color_name == NULL)
+                        face->common.cold->dictionary_owner_soft = p3->common.cold->dictionary_owner_soft;
+                        face->common.cold->object_owner_soft = p3->common.cold->object_owner_soft;
+                        face->common.cold->material = p3->common.cold->material;
+                        face->common.cold->dictionary_owner_hard = p3->common.cold->dictionary_owner_hard;
+                        face->common.lineweight = p3->common.lineweight;
+                        face->common.cold->plot_style_name = p3->common.cold->plot_style_name;
+                        face->common.color_value = p3->common.color_value;
+                        if (p3->common.cold->color_name == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4947,9 +4545,9 @@ dxf_3dface_create_from_points
                         }
                         else
                         {
-                                face->color_name = strdup (p3->color_name);
+                                face->common.cold->color_name = strdup (p3->common.cold->color_name);
                         }
-                        face->transparency = p3->transparency;
+                        face->common.cold->transparency = p3->common.cold->transparency;
                         break;
                 default:
                         fprintf (stderr,
@@ -5102,4 +4700,143 @@ dxf_3dface_get_last
 }
 
 
+/*!
+ * \brief Store the corner points of a DXF \c 3DFACE entity in single
+ * precision.
+ *
+ * The coordinates are kept as \c float offsets relative to
+ * (\c origin_x, \c origin_y, \c origin_z) in \c offsets, the
+ * \c DxfPoint members are freed and set to \c NULL.\n
+ * Choosing an origin close to the drawing (for instance the center of
+ * the \c $EXTMIN and \c $EXTMAX extents) keeps the offsets small, so
+ * little precision is lost.\n
+ * Functions using the \c DxfPoint members need
+ * dxf_3dface_set_double_precision () first.
+ *
+ * \return a pointer to \c face when successful, or \c NULL when
+ * an error occurred.
+ */
+Dxf3dface *
+dxf_3dface_set_single_precision
+(
+        Dxf3dface *face,
+                /*!< a pointer to a DXF \c 3DFACE entity. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *offsets = NULL;
+        DxfPoint *points[4];
+
+        /* Do some basic checks. */
+        if (face == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (face->offsets != NULL)
+        {
+                /* Convert to the new origin by way of double precision. */
+                if (dxf_3dface_set_double_precision (face) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        points[0] = face->p0;
+        points[1] = face->p1;
+        points[2] = face->p2;
+        points[3] = face->p3;
+        offsets = dxf_point_offsets_new_from_points (points, 4, origin_x, origin_y, origin_z);
+        if (offsets == NULL)
+        {
+                return (NULL);
+        }
+        if (face->p0 != NULL)
+        {
+                dxf_point_free (face->p0);
+        }
+        if (face->p1 != NULL)
+        {
+                dxf_point_free (face->p1);
+        }
+        if (face->p2 != NULL)
+        {
+                dxf_point_free (face->p2);
+        }
+        if (face->p3 != NULL)
+        {
+                dxf_point_free (face->p3);
+        }
+        face->p0 = NULL;
+        face->p1 = NULL;
+        face->p2 = NULL;
+        face->p3 = NULL;
+        face->offsets = offsets;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (face);
+}
+
+
+/*!
+ * \brief Store the corner points of a DXF \c 3DFACE entity in double
+ * precision (the default).
+ *
+ * New \c DxfPoint members are allocated from \c offsets, which is
+ * freed.
+ *
+ * \return a pointer to \c face when successful, or \c NULL when
+ * an error occurred.
+ */
+Dxf3dface *
+dxf_3dface_set_double_precision
+(
+        Dxf3dface *face
+                /*!< a pointer to a DXF \c 3DFACE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *points[4];
+
+        /* Do some basic checks. */
+        if (face == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (face->offsets == NULL)
+        {
+                return (face);
+        }
+        if (dxf_point_offsets_to_points (face->offsets, points) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        face->p0 = points[0];
+        face->p1 = points[1];
+        face->p2 = points[2];
+        face->p3 = points[3];
+        dxf_point_offsets_free (face->offsets);
+        face->offsets = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (face);
+}
+
+
 /* EOF */
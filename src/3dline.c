@@ -122,32 +122,18 @@ dxf_3dline_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
-        line->elevation = 0.0;
-        line->thickness = 0.0;
-        line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        line->visibility = DXF_DEFAULT_VISIBILITY;
-        line->color = DXF_COLOR_BYLAYER;
-        line->paperspace = DXF_MODELSPACE;
-        line->graphics_data_size = 0;
-        line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
-        line->lineweight = 0;
-        line->plot_style_name = strdup ("");
-        line->color_value = 0;
-        line->color_name = strdup ("");
-        line->transparency = 0;
+        if (dxf_entity_common_init (&line->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         line->extr_x0 = 0.0;
         line->extr_y0 = 0.0;
         line->extr_z0 = 0.0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        line->binary_graphics_data = NULL;
         line->p0 = NULL;
         line->p1 = NULL;
         line->next = NULL;
@@ -185,7 +171,6 @@ dxf_3dline_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
@@ -205,22 +190,6 @@ dxf_3dline_read
                   __FUNCTION__);
                 line = dxf_3dline_init (line);
         }
-        if (line->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                line->binary_graphics_data = dxf_binary_data_init (line->binary_graphics_data);
-                if (line->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
         if (line->p0 == NULL)
         {
                 fprintf (stderr,
@@ -253,7 +222,6 @@ dxf_3dline_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) line->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -273,21 +241,20 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &line->id_code);
+                        line->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->common.linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->common.layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -336,49 +303,49 @@ dxf_3dline_read
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->elevation);
+                        fscanf (fp->fp, "%lf\n", &line->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->thickness);
+                        fscanf (fp->fp, "%lf\n", &line->common.thickness);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &line->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->visibility);
+                        fscanf (fp->fp, "%hd\n", &line->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->color);
+                        fscanf (fp->fp, "%hd\n", &line->common.color);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->paperspace);
+                        fscanf (fp->fp, "%hd\n", &line->common.paperspace);
                 }
                 else if (strcmp (temp_string, "92") == 0)
                 {
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &line->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "100") == 0)
                 {
@@ -399,7 +366,7 @@ dxf_3dline_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &line->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "210") == 0)
                 {
@@ -427,16 +394,17 @@ dxf_3dline_read
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &line->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        if (line->common.cold->binary_graphics_data == NULL)
+                        {
+                                line->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, line->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -444,15 +412,13 @@ dxf_3dline_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
+                                line->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
+                                line->common.cold->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -460,49 +426,46 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
+                        line->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
+                        line->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->lineweight);
+                        fscanf (fp->fp, "%hd\n", &line->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
+                        line->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &line->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &line->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -519,13 +482,13 @@ dxf_3dline_read
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (line->linetype, "") == 0)
+        if (strcmp (line->common.linetype, "") == 0)
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (line->layer, "") == 0)
+        if (strcmp (line->common.layer, "") == 0)
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -584,32 +547,32 @@ dxf_3dline_write
                 && (line->p0->z0 == line->p1->z0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, line->id_code);
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, line->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if ((strcmp (line->layer, "") == 0) || (line->layer == NULL))
+        if ((strcmp (line->common.layer, "") == 0) || (line->common.layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, line->id_code);
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, line->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (line->linetype == NULL)
+        if (line->common.linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, line->id_code);
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, line->common.id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         if (fp->acad_version_number > AutoCAD_11)
         {
@@ -617,9 +580,9 @@ dxf_3dline_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (line->id_code != -1)
+        if (line->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", line->id_code);
+                dxf_handle_write (fp, 5, line->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -631,104 +594,98 @@ dxf_3dline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (line->dictionary_owner_soft, "") != 0)
+        if ((line->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", line->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, line->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (line->dictionary_owner_hard, "") != 0)
+        if ((line->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", line->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, line->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (line->object_owner_soft, "") != 0)
+        if ((line->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", line->object_owner_soft);
+                dxf_handle_write (fp, 330, line->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if ((line->paperspace == DXF_PAPERSPACE)
+        if ((line->common.paperspace == DXF_PAPERSPACE)
           && (fp->acad_version_number >= AutoCAD_13))
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
-        if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", line->common.layer);
+        if (strcmp (line->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", line->linetype);
+                fprintf (fp->fp, "  6\n%s\n", line->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (line->elevation != 0.0))
+          && (line->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", line->elevation);
+                fprintf (fp->fp, " 38\n%f\n", line->common.elevation);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (line->material, "") != 0))
+          && (line->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", line->material);
+                dxf_handle_write (fp, 347, line->common.cold->material);
         }
-        if (line->color != DXF_COLOR_BYLAYER)
+        if (line->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", line->color);
+                fprintf (fp->fp, " 62\n%hd\n", line->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", line->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", line->common.lineweight);
         }
-        if ((line->linetype_scale != 1.0)
+        if ((line->common.linetype_scale != 1.0)
           && (fp->acad_version_number >= AutoCAD_13))
         {
-                fprintf (fp->fp, " 48\n%f\n", line->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", line->common.linetype_scale);
         }
-        if ((line->visibility != 0)
+        if ((line->common.visibility != 0)
           && (fp->acad_version_number >= AutoCAD_13))
         {
-                fprintf (fp->fp, " 60\n%hd\n", line->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", line->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->common.cold->graphics_data_size);
 #endif
-                if (line->binary_graphics_data != NULL)
+                if (line->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter310;
-                        iter310 = (DxfBinaryData *) line->binary_graphics_data;
-                        while (iter310 != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                                iter310 = (DxfBinaryData *) iter310->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, line->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->color_value);
-                fprintf (fp->fp, "430\n%s\n", line->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", line->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", line->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", line->shadow_mode);
+                dxf_handle_write (fp, 390, line->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", line->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbLine\n");
         }
-        if (line->thickness != 0.0)
+        if (line->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", line->thickness);
+                fprintf (fp->fp, " 39\n%f\n", line->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", line->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", line->p0->y0);
@@ -745,6 +702,7 @@ dxf_3dline_write
                 fprintf (fp->fp, "220\n%f\n", dxf_3dline_get_extr_y0 (line));
                 fprintf (fp->fp, "230\n%f\n", dxf_3dline_get_extr_z0 (line));
         }
+        dxf_entity_common_write_xdata (fp, &line->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -789,15 +747,7 @@ dxf_3dline_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
-        dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
+        dxf_entity_common_free (&line->common);
         dxf_point_free_list (line->p0);
         dxf_point_free_list (line->p1);
         free (line);
@@ -836,6 +786,7 @@ dxf_3dline_free_list
         while (lines != NULL)
         {
                 Dxf3dline *iter = (Dxf3dline *) lines->next;
+                lines->next = NULL;
                 dxf_3dline_free (lines);
                 lines = (Dxf3dline *) iter;
         }
@@ -853,7 +804,7 @@ dxf_3dline_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_3dline_get_id_code
 (
         Dxf3dline *line
@@ -871,16 +822,10 @@ dxf_3dline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->id_code);
+        return (line->common.id_code);
 }
 
 
@@ -892,7 +837,7 @@ dxf_3dline_set_id_code
 (
         Dxf3dline *line,
                 /*!< a pointer to a DXF \c 3DLINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -909,13 +854,7 @@ dxf_3dline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        line->id_code = id_code;
+        line->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -949,7 +888,7 @@ dxf_3dline_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->linetype ==  NULL)
+        if (line->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -959,7 +898,7 @@ dxf_3dline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (strdup (line->common.linetype));
 }
 
 
@@ -993,7 +932,7 @@ dxf_3dline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1027,7 +966,7 @@ dxf_3dline_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->layer ==  NULL)
+        if (line->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1037,7 +976,7 @@ dxf_3dline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (strdup (line->common.layer));
 }
 
 
@@ -1071,7 +1010,7 @@ dxf_3dline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1108,7 +1047,7 @@ dxf_3dline_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->elevation);
+        return (line->common.elevation);
 }
 
 
@@ -1135,7 +1074,7 @@ dxf_3dline_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        line->elevation = elevation;
+        line->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1166,7 +1105,7 @@ dxf_3dline_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->thickness < 0.0)
+        if (line->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1175,7 +1114,7 @@ dxf_3dline_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->thickness);
+        return (line->common.thickness);
 }
 
 
@@ -1208,7 +1147,7 @@ dxf_3dline_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        line->thickness = thickness;
+        line->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1244,7 +1183,7 @@ dxf_3dline_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->linetype_scale < 0.0)
+        if (line->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1253,7 +1192,7 @@ dxf_3dline_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->linetype_scale);
+        return (line->common.linetype_scale);
 }
 
 
@@ -1288,7 +1227,7 @@ dxf_3dline_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        line->linetype_scale = linetype_scale;
+        line->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1322,13 +1261,13 @@ dxf_3dline_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->visibility < 0)
+        if (line->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->visibility > 1)
+        if (line->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1337,7 +1276,7 @@ dxf_3dline_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->visibility);
+        return (line->common.visibility);
 }
 
 
@@ -1379,7 +1318,7 @@ dxf_3dline_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        line->visibility = visibility;
+        line->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1413,7 +1352,7 @@ dxf_3dline_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->color < 0)
+        if (line->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1422,7 +1361,7 @@ dxf_3dline_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->color);
+        return (line->common.color);
 }
 
 
@@ -1455,7 +1394,7 @@ dxf_3dline_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        line->color = color;
+        line->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1486,13 +1425,13 @@ dxf_3dline_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->paperspace < 0)
+        if (line->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->paperspace > 1)
+        if (line->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1501,7 +1440,7 @@ dxf_3dline_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->paperspace);
+        return (line->common.paperspace);
 }
 
 
@@ -1543,7 +1482,7 @@ dxf_3dline_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        line->paperspace = paperspace;
+        line->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1579,13 +1518,13 @@ dxf_3dline_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->graphics_data_size < 0)
+        if (line->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->graphics_data_size == 0)
+        if (line->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1594,7 +1533,7 @@ dxf_3dline_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->graphics_data_size);
+        return (line->common.cold->graphics_data_size);
 }
 
 
@@ -1638,7 +1577,7 @@ dxf_3dline_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        line->graphics_data_size = graphics_data_size;
+        line->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1670,13 +1609,13 @@ dxf_3dline_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->shadow_mode < 0)
+        if (line->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->shadow_mode > 3)
+        if (line->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1685,7 +1624,7 @@ dxf_3dline_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->shadow_mode);
+        return (line->common.cold->shadow_mode);
 }
 
 
@@ -1727,7 +1666,7 @@ dxf_3dline_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        line->shadow_mode = shadow_mode;
+        line->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1736,17 +1675,18 @@ dxf_3dline_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c 3DLINE entity.
  *
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_3dline_get_binary_graphics_data.png
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_3dline_get_binary_graphics_data
 (
         Dxf3dline *line
@@ -1764,24 +1704,20 @@ dxf_3dline_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) line->binary_graphics_data);
+        return (line->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c 3DLINE entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c line when successful, or \c NULL when an
  * error occurred.
  */
@@ -1790,9 +1726,9 @@ dxf_3dline_set_binary_graphics_data
 (
         Dxf3dline *line,
                 /*!< a pointer to a DXF \c 3DLINE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1813,23 +1749,12 @@ dxf_3dline_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->binary_graphics_data == NULL)
+        if ((line->common.cold->binary_graphics_data != NULL)
+          && (line->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                line->binary_graphics_data = dxf_binary_data_init (line->binary_graphics_data);
-                if (line->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (line->common.cold->binary_graphics_data);
         }
-        line->binary_graphics_data = (DxfBinaryData *) data;
+        line->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1866,17 +1791,10 @@ dxf_3dline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (dxf_handle_to_string (line->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1912,7 +1830,7 @@ dxf_3dline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1949,17 +1867,10 @@ dxf_3dline_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->object_owner_soft));
+        return (dxf_handle_to_string (line->common.cold->object_owner_soft));
 }
 
 
@@ -1995,7 +1906,7 @@ dxf_3dline_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        line->object_owner_soft = strdup (object_owner_soft);
+        line->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2032,17 +1943,10 @@ dxf_3dline_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (dxf_handle_to_string (line->common.cold->material));
 }
 
 
@@ -2080,7 +1984,7 @@ dxf_3dline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        line->material = strdup (material);
+        line->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2117,17 +2021,10 @@ dxf_3dline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (dxf_handle_to_string (line->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2163,7 +2060,7 @@ dxf_3dline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2201,7 +2098,7 @@ dxf_3dline_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->lineweight);
+        return (line->common.lineweight);
 }
 
 
@@ -2231,7 +2128,7 @@ dxf_3dline_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        line->lineweight = lineweight;
+        line->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2263,17 +2160,10 @@ dxf_3dline_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (dxf_handle_to_string (line->common.cold->plot_style_name));
 }
 
 
@@ -2311,7 +2201,7 @@ dxf_3dline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->plot_style_name = strdup (plot_style_name);
+        line->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2349,7 +2239,7 @@ dxf_3dline_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->color_value);
+        return (line->common.color_value);
 }
 
 
@@ -2379,7 +2269,7 @@ dxf_3dline_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_value = color_value;
+        line->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2414,7 +2304,7 @@ dxf_3dline_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->color_name ==  NULL)
+        if (line->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2424,7 +2314,7 @@ dxf_3dline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (strdup (line->common.cold->color_name));
 }
 
 
@@ -2462,7 +2352,7 @@ dxf_3dline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2497,7 +2387,7 @@ dxf_3dline_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->transparency);
+        return (line->common.cold->transparency);
 }
 
 
@@ -2527,7 +2417,7 @@ dxf_3dline_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        line->transparency = transparency;
+        line->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3596,7 +3486,7 @@ dxf_3dline_get_mid_point
 (
         Dxf3dline *line,
                 /*!< a pointer to a DXF \c 3DLINE entity. */
-        int id_code,
+        DxfHandle id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3640,13 +3530,7 @@ dxf_3dline_get_mid_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        point->id_code = id_code;
+        point->common.id_code = id_code;
         point->x0 = (line->p0->x0 + line->p1->x0) / 2;
         point->y0 = (line->p0->y0 + line->p1->y0) / 2;
         point->z0 = (line->p0->z0 + line->p1->z0) / 2;
@@ -3656,50 +3540,35 @@ dxf_3dline_get_mid_point
                         /* Do nothing. */
                         break;
                 case 1:
-                        if (line->linetype != NULL)
+                        if (line->common.linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->common.linetype = strdup (line->common.linetype);
                         }
-                        if (line->layer != NULL)
+                        if (line->common.layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->common.layer = strdup (line->common.layer);
                         }
-                        point->elevation = line->elevation;
-                        point->thickness = line->thickness;
-                        point->linetype_scale = line->linetype_scale;
-                        point->visibility = line->visibility;
-                        point->color = line->color;
-                        point->paperspace = line->paperspace;
+                        point->common.elevation = line->common.elevation;
+                        point->common.thickness = line->common.thickness;
+                        point->common.linetype_scale = line->common.linetype_scale;
+                        point->common.visibility = line->common.visibility;
+                        point->common.color = line->common.color;
+                        point->common.paperspace = line->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        point->shadow_mode = line->shadow_mode;
+                        point->common.cold->shadow_mode = line->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (line->dictionary_owner_soft != NULL)
-                        {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
-                        }
-                        if (line->object_owner_soft != NULL)
+                        point->common.cold->dictionary_owner_soft = line->common.cold->dictionary_owner_soft;
+                        point->common.cold->object_owner_soft = line->common.cold->object_owner_soft;
+                        point->common.cold->material = line->common.cold->material;
+                        point->common.cold->dictionary_owner_hard = line->common.cold->dictionary_owner_hard;
+                        point->common.lineweight = line->common.lineweight;
+                        point->common.cold->plot_style_name = line->common.cold->plot_style_name;
+                        point->common.color_value = line->common.color_value;
+                        if (line->common.cold->color_name != NULL)
                         {
-                                point->object_owner_soft = strdup (line->object_owner_soft);
+                                point->common.cold->color_name = strdup (line->common.cold->color_name);
                         }
-                        if (line->material != NULL)
-                        {
-                                point->material = strdup (line->material);
-                        }
-                        if (line->dictionary_owner_hard != NULL)
-                        {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
-                        }
-                        point->lineweight = line->lineweight;
-                        if (line->plot_style_name != NULL)
-                        {
-                                point->plot_style_name = strdup (line->plot_style_name);
-                        }
-                        point->color_value = line->color_value;
-                        if (line->color_name != NULL)
-                        {
-                                point->color_name = strdup (line->color_name);
-                        }
-                        point->transparency = line->transparency;
+                        point->common.cold->transparency = line->common.cold->transparency;
                         break;
                 default:
                         fprintf (stderr,
@@ -3776,7 +3645,7 @@ dxf_3dline_create_from_points
                 /*!< a pointer to a DXF \c POINT entity. */
         DxfPoint *p1,
                 /*!< a pointer to a DXF \c POINT entity. */
-        int id_code,
+        DxfHandle id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3825,13 +3694,7 @@ dxf_3dline_create_from_points
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        line->id_code = id_code;
+        line->common.id_code = id_code;
         line->p0->x0 = p0->x0;
         line->p0->y0 = p0->y0;
         line->p0->z0 = p0->z0;
@@ -3844,7 +3707,7 @@ dxf_3dline_create_from_points
                         /* Do nothing. */
                         break;
                 case 1:
-                        if (p0->linetype == NULL)
+                        if (p0->common.linetype == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -3852,9 +3715,9 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->linetype = p0->linetype;
+                                line->common.linetype = p0->common.linetype;
                         }
-                        if (p0->layer == NULL)
+                        if (p0->common.layer == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -3862,28 +3725,25 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->layer = p0->layer;
+                                line->common.layer = p0->common.layer;
                         }
-                        line->elevation = p0->elevation;
-                        line->thickness = p0->thickness;
-                        line->linetype_scale = p0->linetype_scale;
-                        line->visibility = p0->visibility;
-                        line->color = p0->color;
-                        line->paperspace = p0->paperspace;
+                        line->common.elevation = p0->common.elevation;
+                        line->common.thickness = p0->common.thickness;
+                        line->common.linetype_scale = p0->common.linetype_scale;
+                        line->common.visibility = p0->common.visibility;
+                        line->common.color = p0->common.color;
+                        line->common.paperspace = p0->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        line->shadow_mode = p0->shadow_mode;
+                        line->common.cold->shadow_mode = p0->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p0->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
-                        }
-                        if (p0->object_owner_soft == NULL)
+                        line->common.cold->dictionary_owner_soft = p0->common.cold->dictionary_owner_soft;
+                        line->common.cold->object_owner_soft = p0->common.cold->object_owner_soft;
+                        line->common.cold->material = p0->common.cold->material;
+                        line->common.cold->dictionary_owner_hard = p0->common.cold->dictionary_owner_hard;
+                        line->common.lineweight = p0->common.lineweight;
+                        line->common.cold->plot_style_name = p0->common.cold->plot_style_name;
+                        line->common.color_value = p0->common.color_value;
+                        if (p0->common.cold->color_name == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -3891,54 +3751,12 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->object_owner_soft = strdup (p0->object_owner_soft);
+                                line->common.cold->color_name = strdup (p0->common.cold->color_name);
                         }
-                        if (p0->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->material = strdup (p0->material);
-                        }
-                        if (p0->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
-                        }
-                        line->lineweight = p0->lineweight;
-                        if (p0->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->plot_style_name = strdup (p0->plot_style_name);
-                        }
-                        line->color_value = p0->color_value;
-                        if (p0->color_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->color_name = strdup (p0->color_name);
-                        }
-                        line->transparency = p0->transparency;
+                        line->common.cold->transparency = p0->common.cold->transparency;
                         break;
                 case 2:
-                        if (p1->linetype == NULL)
+                        if (p1->common.linetype == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -3946,9 +3764,9 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->linetype = p1->linetype;
+                                line->common.linetype = p1->common.linetype;
                         }
-                        if (p1->layer == NULL)
+                        if (p1->common.layer == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -3956,70 +3774,25 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->layer = p1->layer;
+                                line->common.layer = p1->common.layer;
                         }
-                        line->elevation = p1->elevation;
-                        line->thickness = p1->thickness;
-                        line->linetype_scale = p1->linetype_scale;
-                        line->visibility = p1->visibility;
-                        line->color = p1->color;
-                        line->paperspace = p1->paperspace;
+                        line->common.elevation = p1->common.elevation;
+                        line->common.thickness = p1->common.thickness;
+                        line->common.linetype_scale = p1->common.linetype_scale;
+                        line->common.visibility = p1->common.visibility;
+                        line->common.color = p1->common.color;
+                        line->common.paperspace = p1->common.paperspace;
                         /*! \todo Add graphics_data_size. */
-                        line->shadow_mode = p1->shadow_mode;
+                        line->common.cold->shadow_mode = p1->common.cold->shadow_mode;
                         /*! \todo Add binary_graphics_data. */
-                        if (p1->dictionary_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
-                        }
-                        if (p1->object_owner_soft == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->object_owner_soft = strdup (p1->object_owner_soft);
-                        }
-                        if (p1->material == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->material = strdup (p1->material);
-                        }
-                        if (p1->dictionary_owner_hard == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
-                        }
-                        line->lineweight = p1->lineweight;
-                        if (p1->plot_style_name == NULL)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () a NULL pointer was found.\n")),
-                                  __FUNCTION__);
-                        }
-                        else
-                        {
-                                line->plot_style_name = strdup (p1->plot_style_name);
-                        }
-                        line->color_value = p1->color_value;
-                        if (p1->color_name == NULL)
+                        line->common.cold->dictionary_owner_soft = p1->common.cold->dictionary_owner_soft;
+                        line->common.cold->object_owner_soft = p1->common.cold->object_owner_soft;
+                        line->common.cold->material = p1->common.cold->material;
+                        line->common.cold->dictionary_owner_hard = p1->common.cold->dictionary_owner_hard;
+                        line->common.lineweight = p1->common.lineweight;
+                        line->common.cold->plot_style_name = p1->common.cold->plot_style_name;
+                        line->common.color_value = p1->common.color_value;
+                        if (p1->common.cold->color_name == NULL)
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () a NULL pointer was found.\n")),
@@ -4027,9 +3800,9 @@ dxf_3dline_create_from_points
                         }
                         else
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->common.cold->color_name = strdup (p1->common.cold->color_name);
                         }
-                        line->transparency = p1->transparency;
+                        line->common.cold->transparency = p1->common.cold->transparency;
                         break;
                 default:
                         fprintf (stderr,
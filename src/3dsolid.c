@@ -49,6 +49,7 @@
 
 
 #include "3dsolid.h"
+#include "entities.h"
 
 
 /*!
@@ -118,32 +119,26 @@ dxf_3dsolid_init
                   __FUNCTION__);
                 return (NULL);
         }
+        solid->proprietary_data_range = dxf_proprietary_data_range_init (dxf_proprietary_data_range_new ());
+        if (solid->proprietary_data_range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         /* Assign initial values to members. */
-        solid->id_code = 0;
-        solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        solid->layer = strdup (DXF_DEFAULT_LAYER);
-        solid->elevation = 0.0;
-        solid->thickness = 0.0;
-        solid->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        solid->visibility = DXF_DEFAULT_VISIBILITY;
-        solid->color = DXF_COLOR_BYLAYER;
-        solid->paperspace = DXF_MODELSPACE;
-        solid->graphics_data_size = 0;
-        solid->shadow_mode = 0;
-        solid->dictionary_owner_soft = strdup ("");
-        solid->object_owner_soft = strdup ("");
-        solid->material = strdup ("");
-        solid->dictionary_owner_hard = strdup ("");
-        solid->lineweight = 0;
-        solid->plot_style_name = strdup ("");
-        solid->color_value = 0;
-        solid->color_name = strdup ("");
-        solid->transparency = 0;
+        if (dxf_entity_common_init (&solid->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         solid->modeler_format_version_number = 1;
-        solid->history = strdup ("");
+        solid->history = DXF_HANDLE_NONE;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        solid->binary_graphics_data = NULL;
         solid->proprietary_data = NULL;
         solid->additional_proprietary_data = NULL;
         solid->next = NULL;
@@ -177,11 +172,9 @@ dxf_3dsolid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
-
-        int i;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -189,275 +182,98 @@ dxf_3dsolid_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
-        if (fp->acad_version_number < AutoCAD_13)
+        if (solid == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this entity.\n")),
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
+                solid = dxf_3dsolid_init (dxf_3dsolid_new ());
+                if (solid == NULL)
+                {
+                        return (NULL);
+                }
         }
-        if (solid == NULL)
+        if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
-                solid = dxf_3dsolid_init (solid);
         }
-        iter310 = (DxfBinaryData *) solid->binary_graphics_data;
-        i = 1;
-        solid->proprietary_data->order = 0;
-        solid->additional_proprietary_data->order = 0;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+        for (;;)
+        {
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
-                        return (NULL);
-                }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->proprietary_data->data_line);
-                        solid->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->proprietary_data->next);
-                        solid->proprietary_data = (DxfBinaryData *) solid->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->additional_proprietary_data->data_line);
-                        solid->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->additional_proprietary_data->next);
-                        solid->additional_proprietary_data = (DxfBinaryData *) solid->additional_proprietary_data->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &solid->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->layer);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->modeler_format_version_number);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                          || (strcmp (temp_string, "AcDb3dSolid") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->material);
-                }
-                else if (strcmp (temp_string, "350") == 0)
-                {
-                        /* Now follows a string containing a handle to a
-                         * history object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->history);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->color_name);
+                        break;
                 }
-                else if (strcmp (temp_string, "440") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &solid->transparency);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                if ((group_code == 1) || (group_code == 3))
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        /* Proprietary data, only record where it is. */
+                        dxf_proprietary_data_range_read (fp, solid->proprietary_data_range);
+                        continue;
                 }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 70:
+                                solid->modeler_format_version_number = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbModelerGeometry") != 0)
+                                  && (strcmp (value, "AcDb3dSolid") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 350:
+                                solid->history = dxf_handle_parse (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &solid->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (solid->linetype, "") == 0)
+        if ((solid->common.linetype == NULL)
+          || (strcmp (solid->common.linetype, "") == 0))
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (solid->common.linetype);
+                solid->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (solid->layer, "") == 0)
+        if ((solid->common.layer == NULL)
+          || (strcmp (solid->common.layer, "") == 0))
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                free (solid->common.layer);
+                solid->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -510,35 +326,35 @@ dxf_3dsolid_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, solid->id_code);
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, solid->common.id_code);
         }
-        if (strcmp (solid->linetype, "") == 0)
+        if (strcmp (solid->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, solid->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, solid->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (solid->layer, "") == 0)
+        if (strcmp (solid->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, solid->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, solid->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         i = 1;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (solid->id_code != -1)
+        if (solid->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", solid->id_code);
+                dxf_handle_write (fp, 5, solid->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -550,97 +366,91 @@ dxf_3dsolid_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (solid->dictionary_owner_soft, "") != 0)
+        if ((solid->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", solid->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, solid->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (solid->dictionary_owner_hard, "") != 0)
+        if ((solid->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", solid->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, solid->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (solid->object_owner_soft, "") != 0)
+        if ((solid->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", solid->object_owner_soft);
+                dxf_handle_write (fp, 330, solid->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (solid->paperspace == DXF_PAPERSPACE)
+        if (solid->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", solid->layer);
-        if (strcmp (solid->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", solid->common.layer);
+        if (strcmp (solid->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", solid->linetype);
+                fprintf (fp->fp, "  6\n%s\n", solid->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (solid->material, "") != 0))
+          && (solid->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", solid->material);
+                dxf_handle_write (fp, 347, solid->common.cold->material);
         }
-        if (solid->color != DXF_COLOR_BYLAYER)
+        if (solid->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", solid->color);
+                fprintf (fp->fp, " 62\n%hd\n", solid->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", solid->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", solid->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (solid->elevation != 0.0))
+          && (solid->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", solid->elevation);
+                fprintf (fp->fp, " 38\n%f\n", solid->common.elevation);
         }
-        if (solid->thickness != 0.0)
+        if (solid->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", solid->thickness);
+                fprintf (fp->fp, " 39\n%f\n", solid->common.thickness);
         }
-        if (solid->linetype_scale != 1.0)
+        if (solid->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", solid->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", solid->common.linetype_scale);
         }
-        if (solid->visibility != 0)
+        if (solid->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", solid->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", solid->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", solid->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", solid->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", solid->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", solid->common.cold->graphics_data_size);
 #endif
-                if (solid->binary_graphics_data != NULL)
+                if (solid->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) solid->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, solid->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", solid->color_value);
-                fprintf (fp->fp, "430\n%s\n", solid->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", solid->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", solid->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", solid->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", solid->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", solid->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", solid->shadow_mode);
+                dxf_handle_write (fp, 390, solid->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", solid->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -654,7 +464,14 @@ dxf_3dsolid_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", solid->modeler_format_version_number);
         }
-        if ((solid->proprietary_data != NULL) || (solid->additional_proprietary_data != NULL))
+        if ((solid->proprietary_data_range != NULL)
+          && (solid->proprietary_data_range->number_of_lines > 0))
+        {
+                /* Copy the proprietary data from the file it was read
+                 * from. */
+                dxf_proprietary_data_range_write (fp, solid->proprietary_data_range);
+        }
+        else if ((solid->proprietary_data != NULL) || (solid->additional_proprietary_data != NULL))
         {
                 iter = (DxfBinaryData *) solid->proprietary_data;
                 additional_iter = (DxfBinaryData *) solid->additional_proprietary_data;
@@ -677,13 +494,14 @@ dxf_3dsolid_write
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () no proprietary data found in the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, solid->id_code);
+                  (_("Warning in %s () no proprietary data found in the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, solid->common.id_code);
         }
         if (fp->acad_version_number >= AutoCAD_2008)
         {
-                fprintf (fp->fp, "350\n%s\n", solid->history);
+                dxf_handle_write (fp, 350, solid->history);
         }
+        dxf_entity_common_write_xdata (fp, &solid->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -726,18 +544,10 @@ dxf_3dsolid_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (solid->linetype);
-        free (solid->layer);
-        dxf_binary_data_free_list (solid->binary_graphics_data);
-        free (solid->dictionary_owner_soft);
-        free (solid->object_owner_soft);
-        free (solid->material);
-        free (solid->dictionary_owner_hard);
-        free (solid->plot_style_name);
-        free (solid->color_name);
+        dxf_entity_common_free (&solid->common);
+        dxf_proprietary_data_range_free (solid->proprietary_data_range);
         dxf_binary_data_free_list (solid->proprietary_data);
         dxf_binary_data_free_list (solid->additional_proprietary_data);
-        free (solid->history);
         free (solid);
         solid = NULL;
 #if DEBUG
@@ -771,6 +581,7 @@ dxf_3dsolid_free_list
         while (solids != NULL)
         {
                 Dxf3dsolid *iter = (Dxf3dsolid *) solids->next;
+                solids->next = NULL;
                 dxf_3dsolid_free (solids);
                 solids = (Dxf3dsolid *) iter;
         }
@@ -780,12 +591,96 @@ dxf_3dsolid_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c 3DSOLID entity.
+ *
+ * The copy does not share any memory with \c solid, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+Dxf3dsolid *
+dxf_3dsolid_copy
+(
+        Dxf3dsolid *solid
+                /*!< a pointer to the DXF \c 3DSOLID entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        Dxf3dsolid *copy;
+
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_3dsolid_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, solid, sizeof (Dxf3dsolid));
+        copy->proprietary_data = NULL;
+        copy->additional_proprietary_data = NULL;
+        copy->proprietary_data_range = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &solid->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_3dsolid_free (copy);
+                return (NULL);
+        }
+        if (solid->proprietary_data != NULL)
+        {
+                copy->proprietary_data = dxf_binary_data_copy_list (solid->proprietary_data);
+                if (copy->proprietary_data == NULL)
+                {
+                        dxf_3dsolid_free (copy);
+                        return (NULL);
+                }
+        }
+        if (solid->additional_proprietary_data != NULL)
+        {
+                copy->additional_proprietary_data = dxf_binary_data_copy_list (solid->additional_proprietary_data);
+                if (copy->additional_proprietary_data == NULL)
+                {
+                        dxf_3dsolid_free (copy);
+                        return (NULL);
+                }
+        }
+        if (solid->proprietary_data_range != NULL)
+        {
+                copy->proprietary_data_range = dxf_proprietary_data_range_copy (solid->proprietary_data_range);
+                if (copy->proprietary_data_range == NULL)
+                {
+                        dxf_3dsolid_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c 3DSOLID entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_3dsolid_get_id_code
 (
         Dxf3dsolid *solid
@@ -803,16 +698,10 @@ dxf_3dsolid_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->id_code);
+        return (solid->common.id_code);
 }
 
 
@@ -824,7 +713,7 @@ dxf_3dsolid_set_id_code
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -841,13 +730,7 @@ dxf_3dsolid_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        solid->id_code = id_code;
+        solid->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -878,7 +761,7 @@ dxf_3dsolid_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->linetype ==  NULL)
+        if (solid->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -888,7 +771,7 @@ dxf_3dsolid_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->linetype));
+        return (strdup (solid->common.linetype));
 }
 
 
@@ -922,7 +805,7 @@ dxf_3dsolid_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->linetype = strdup (linetype);
+        solid->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -953,7 +836,7 @@ dxf_3dsolid_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->layer ==  NULL)
+        if (solid->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -963,7 +846,7 @@ dxf_3dsolid_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->layer));
+        return (strdup (solid->common.layer));
 }
 
 
@@ -997,7 +880,7 @@ dxf_3dsolid_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->layer = strdup (layer);
+        solid->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1031,7 +914,7 @@ dxf_3dsolid_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->elevation);
+        return (solid->common.elevation);
 }
 
 
@@ -1058,7 +941,7 @@ dxf_3dsolid_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->elevation = elevation;
+        solid->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1089,7 +972,7 @@ dxf_3dsolid_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->thickness < 0.0)
+        if (solid->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1098,7 +981,7 @@ dxf_3dsolid_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->thickness);
+        return (solid->common.thickness);
 }
 
 
@@ -1131,7 +1014,7 @@ dxf_3dsolid_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->thickness = thickness;
+        solid->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1162,7 +1045,7 @@ dxf_3dsolid_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->linetype_scale < 0.0)
+        if (solid->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1171,7 +1054,7 @@ dxf_3dsolid_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->linetype_scale);
+        return (solid->common.linetype_scale);
 }
 
 
@@ -1204,7 +1087,7 @@ dxf_3dsolid_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->linetype_scale = linetype_scale;
+        solid->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1235,13 +1118,13 @@ dxf_3dsolid_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->visibility < 0)
+        if (solid->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->visibility > 1)
+        if (solid->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1250,7 +1133,7 @@ dxf_3dsolid_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->visibility);
+        return (solid->common.visibility);
 }
 
 
@@ -1289,7 +1172,7 @@ dxf_3dsolid_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->visibility = visibility;
+        solid->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1320,7 +1203,7 @@ dxf_3dsolid_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->color < 0)
+        if (solid->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1329,7 +1212,7 @@ dxf_3dsolid_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->color);
+        return (solid->common.color);
 }
 
 
@@ -1362,7 +1245,7 @@ dxf_3dsolid_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->color = color;
+        solid->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1393,13 +1276,13 @@ dxf_3dsolid_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->paperspace < 0)
+        if (solid->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->paperspace > 1)
+        if (solid->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1408,7 +1291,7 @@ dxf_3dsolid_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->paperspace);
+        return (solid->common.paperspace);
 }
 
 
@@ -1447,7 +1330,7 @@ dxf_3dsolid_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->paperspace = paperspace;
+        solid->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1479,13 +1362,13 @@ dxf_3dsolid_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->graphics_data_size < 0)
+        if (solid->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->graphics_data_size == 0)
+        if (solid->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1494,7 +1377,7 @@ dxf_3dsolid_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->graphics_data_size);
+        return (solid->common.cold->graphics_data_size);
 }
 
 
@@ -1537,7 +1420,7 @@ dxf_3dsolid_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->graphics_data_size = graphics_data_size;
+        solid->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1569,13 +1452,13 @@ dxf_3dsolid_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->shadow_mode < 0)
+        if (solid->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->shadow_mode > 3)
+        if (solid->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1584,7 +1467,7 @@ dxf_3dsolid_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->shadow_mode);
+        return (solid->common.cold->shadow_mode);
 }
 
 
@@ -1626,7 +1509,7 @@ dxf_3dsolid_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->shadow_mode = shadow_mode;
+        solid->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1635,14 +1518,15 @@ dxf_3dsolid_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c 3DSOLID entity.
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_3dsolid_get_binary_graphics_data
 (
         Dxf3dsolid *solid
@@ -1660,24 +1544,20 @@ dxf_3dsolid_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) solid->binary_graphics_data);
+        return (solid->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c 3DSOLID entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c solid when successful, or \c NULL when an
  * error occurred.
  */
@@ -1686,9 +1566,9 @@ dxf_3dsolid_set_binary_graphics_data
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1709,23 +1589,12 @@ dxf_3dsolid_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->binary_graphics_data == NULL)
+        if ((solid->common.cold->binary_graphics_data != NULL)
+          && (solid->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                solid->binary_graphics_data = dxf_binary_data_init (solid->binary_graphics_data);
-                if (solid->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (solid->common.cold->binary_graphics_data);
         }
-        solid->binary_graphics_data = (DxfBinaryData *) data;
+        solid->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1759,17 +1628,10 @@ dxf_3dsolid_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_soft));
+        return (dxf_handle_to_string (solid->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1805,7 +1667,7 @@ dxf_3dsolid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        solid->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1839,17 +1701,10 @@ dxf_3dsolid_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->object_owner_soft));
+        return (dxf_handle_to_string (solid->common.cold->object_owner_soft));
 }
 
 
@@ -1885,7 +1740,7 @@ dxf_3dsolid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->object_owner_soft = strdup (object_owner_soft);
+        solid->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1920,17 +1775,10 @@ dxf_3dsolid_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->material));
+        return (dxf_handle_to_string (solid->common.cold->material));
 }
 
 
@@ -1968,7 +1816,7 @@ dxf_3dsolid_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->material = strdup (material);
+        solid->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2002,17 +1850,10 @@ dxf_3dsolid_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_hard));
+        return (dxf_handle_to_string (solid->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2048,7 +1889,7 @@ dxf_3dsolid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        solid->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2083,7 +1924,7 @@ dxf_3dsolid_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->lineweight);
+        return (solid->common.lineweight);
 }
 
 
@@ -2113,7 +1954,7 @@ dxf_3dsolid_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->lineweight = lineweight;
+        solid->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2145,17 +1986,10 @@ dxf_3dsolid_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->plot_style_name));
+        return (dxf_handle_to_string (solid->common.cold->plot_style_name));
 }
 
 
@@ -2193,7 +2027,7 @@ dxf_3dsolid_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->plot_style_name = strdup (plot_style_name);
+        solid->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2228,7 +2062,7 @@ dxf_3dsolid_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->color_value);
+        return (solid->common.color_value);
 }
 
 
@@ -2258,7 +2092,7 @@ dxf_3dsolid_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_value = color_value;
+        solid->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2290,7 +2124,7 @@ dxf_3dsolid_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->color_name ==  NULL)
+        if (solid->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2300,7 +2134,7 @@ dxf_3dsolid_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->color_name));
+        return (strdup (solid->common.cold->color_name));
 }
 
 
@@ -2338,7 +2172,7 @@ dxf_3dsolid_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_name = strdup (color_name);
+        solid->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2373,7 +2207,7 @@ dxf_3dsolid_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->transparency);
+        return (solid->common.cold->transparency);
 }
 
 
@@ -2403,7 +2237,7 @@ dxf_3dsolid_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->transparency = transparency;
+        solid->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2713,17 +2547,10 @@ dxf_3dsolid_get_history
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->history ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->history));
+        return (dxf_handle_to_string (solid->history));
 }
 
 
@@ -2757,7 +2584,7 @@ dxf_3dsolid_set_history
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->history = strdup (history);
+        solid->history = dxf_handle_parse (history);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2765,6 +2592,80 @@ dxf_3dsolid_set_history
 }
 
 
+/*!
+ * \brief Get the \c proprietary_data_range from a DXF \c 3DSOLID entity.
+ *
+ * \warning No checks are performed on the returned pointer.
+ *
+ * \return \c proprietary_data_range when sucessful, or \c NULL when an
+ * error occurred.
+ */
+DxfProprietaryDataRange *
+dxf_3dsolid_get_proprietary_data_range
+(
+        Dxf3dsolid *solid
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (solid->proprietary_data_range);
+}
+
+
+/*!
+ * \brief Get the decoded proprietary (ACIS) data from a DXF \c 3DSOLID
+ * entity.
+ *
+ * The group 1 and group 3 lines are read from the DXF file and decoded
+ * into SAT text on each call.
+ *
+ * \return a '\\0' terminated buffer with the SAT text, to be freed by
+ * the caller, or \c NULL when an error occurred.
+ */
+char *
+dxf_3dsolid_get_sat_data
+(
+        Dxf3dsolid *solid,
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+        size_t *length
+                /*!< the number of characters in the returned buffer,
+                 * may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *sat_data = NULL;
+
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        sat_data = dxf_proprietary_data_range_decode (solid->proprietary_data_range, length);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (sat_data);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c 3DSOLID entity from a DXF 
  * \c 3DSOLID entity.
@@ -46,6 +46,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "proprietary_data.h"
 #include "binary_data.h"
 
 
@@ -61,134 +64,9 @@ typedef struct
 dxf_3dsolid_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF 3D solid. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfBinaryData *proprietary_data;
                 /*!< Proprietary data (multiple lines < 255 characters
                  * each).\n
@@ -198,10 +76,14 @@ dxf_3dsolid_struct
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfProprietaryDataRange *proprietary_data_range;
+                /*!< Byte range of the group 1 and group 3 lines in the
+                 * DXF file, the proprietary data is only decoded on
+                 * demand. */
         int16_t modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
-        char *history;
+        DxfHandle history;
                 /*!< Soft-owner ID / handle to history object.\n
                  * Group code = 350.\n
                  * \since Introduced in R2008. */
@@ -217,8 +99,9 @@ Dxf3dsolid *dxf_3dsolid_read (DxfFile *fp, Dxf3dsolid *solid);
 int dxf_3dsolid_write (DxfFile *fp, Dxf3dsolid *solid);
 int dxf_3dsolid_free (Dxf3dsolid *solid);
 void dxf_3dsolid_free_list (Dxf3dsolid *solids);
-int dxf_3dsolid_get_id_code (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_id_code (Dxf3dsolid *solid, int id_code);
+Dxf3dsolid *dxf_3dsolid_copy (Dxf3dsolid *solid);
+DxfHandle dxf_3dsolid_get_id_code (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_id_code (Dxf3dsolid *solid, DxfHandle id_code);
 char *dxf_3dsolid_get_linetype (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_linetype (Dxf3dsolid *solid, char *linetype);
 char *dxf_3dsolid_get_layer (Dxf3dsolid *solid);
@@ -239,8 +122,8 @@ int32_t dxf_3dsolid_get_graphics_data_size (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_graphics_data_size (Dxf3dsolid *solid, int32_t graphics_data_size);
 int16_t dxf_3dsolid_get_shadow_mode (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_shadow_mode (Dxf3dsolid *solid, int16_t shadow_mode);
-DxfBinaryData *dxf_3dsolid_get_binary_graphics_data (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_binary_graphics_data (Dxf3dsolid *solid, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_3dsolid_get_binary_graphics_data (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_binary_graphics_data (Dxf3dsolid *solid, DxfBinaryBuffer *data);
 char *dxf_3dsolid_get_dictionary_owner_soft (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_dictionary_owner_soft (Dxf3dsolid *solid, char *dictionary_owner_soft);
 char *dxf_3dsolid_get_object_owner_soft (Dxf3dsolid *solid);
@@ -263,6 +146,8 @@ DxfBinaryData *dxf_3dsolid_get_proprietary_data (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_proprietary_data (Dxf3dsolid *solid, DxfBinaryData *proprietary_data);
 DxfBinaryData *dxf_3dsolid_get_additional_proprietary_data (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_additional_proprietary_data (Dxf3dsolid *solid, DxfBinaryData *additional_proprietary_data);
+DxfProprietaryDataRange *dxf_3dsolid_get_proprietary_data_range (Dxf3dsolid *solid);
+char *dxf_3dsolid_get_sat_data (Dxf3dsolid *solid, size_t *length);
 int16_t dxf_3dsolid_get_modeler_format_version_number (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_modeler_format_version_number (Dxf3dsolid *solid, int16_t modeler_format_version_number);
 char *dxf_3dsolid_get_history (Dxf3dsolid *solid);
@@ -53,6 +53,7 @@
 
 
 #include "acad_proxy_entity.h"
+#include "entities.h"
 
 
 /*!
@@ -126,37 +127,20 @@ dxf_acad_proxy_entity_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        acad_proxy_entity->id_code = 0;
-        acad_proxy_entity->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        acad_proxy_entity->layer = strdup (DXF_DEFAULT_LAYER);
-        acad_proxy_entity->elevation = 0.0;
-        acad_proxy_entity->thickness = 0.0;
-        acad_proxy_entity->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        acad_proxy_entity->visibility = 0;
-        acad_proxy_entity->color = DXF_COLOR_BYLAYER;
-        acad_proxy_entity->paperspace = DXF_PAPERSPACE;
-        acad_proxy_entity->shadow_mode = 0;
-        acad_proxy_entity->dictionary_owner_soft = strdup ("");
-        acad_proxy_entity->object_owner_soft = strdup ("");
-        acad_proxy_entity->material = strdup ("");
-        acad_proxy_entity->dictionary_owner_hard = strdup ("");
-        acad_proxy_entity->lineweight = 0;
-        acad_proxy_entity->plot_style_name = strdup ("");
-        acad_proxy_entity->color_value = 0;
-        acad_proxy_entity->color_name = strdup ("");
-        acad_proxy_entity->transparency = 0;
+        if (dxf_entity_common_init (&acad_proxy_entity->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         acad_proxy_entity->original_custom_object_data_format = 1;
         acad_proxy_entity->proxy_entity_class_id = DXF_DEFAULT_PROXY_ENTITY_ID;
         acad_proxy_entity->application_entity_class_id = 0;
-        acad_proxy_entity->graphics_data_size = 0;
         acad_proxy_entity->entity_data_size = 0;
         acad_proxy_entity->object_drawing_format = 0;
-        acad_proxy_entity->object_id->group_code = 0;
-        acad_proxy_entity->object_id->data = strdup ("");
-        acad_proxy_entity->object_id->length = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        acad_proxy_entity->binary_graphics_data = NULL;
         acad_proxy_entity->binary_entity_data = NULL;
         acad_proxy_entity->object_id = NULL;
         acad_proxy_entity->next = NULL;
@@ -191,11 +175,14 @@ dxf_acad_proxy_entity_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
-        int i; /* flags whether group code 330, 340, 350 or 360 has been
-                * parsed for a first time. */
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfBinaryData *data = NULL;
+        DxfBinaryData *last_data = NULL;
+        DxfObjectId *object_id = NULL;
+        DxfObjectId *last_object_id = NULL;
+        int entity_data = FALSE;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -203,334 +190,189 @@ dxf_acad_proxy_entity_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
-        if (fp->acad_version_number < AutoCAD_13)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this entity.\n")),
-                  __FUNCTION__);
-        }
-        if (!acad_proxy_entity)
+        if (acad_proxy_entity == NULL)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                acad_proxy_entity = dxf_acad_proxy_entity_init (acad_proxy_entity);
-        }
-        if (acad_proxy_entity->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                acad_proxy_entity->binary_graphics_data = dxf_binary_data_init (acad_proxy_entity->binary_graphics_data);
-                if (acad_proxy_entity->binary_graphics_data == NULL)
+                acad_proxy_entity = dxf_acad_proxy_entity_init (dxf_acad_proxy_entity_new ());
+                if (acad_proxy_entity == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
                         return (NULL);
                 }
         }
-        if (acad_proxy_entity->binary_entity_data == NULL)
+        if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                acad_proxy_entity->binary_entity_data = dxf_binary_data_init (acad_proxy_entity->binary_entity_data);
-                if (acad_proxy_entity->binary_entity_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
         }
-        iter310 = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
-        iter330 = 0;
-        i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
-                        return (NULL);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &acad_proxy_entity->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing the layer
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0)
-                  && (acad_proxy_entity->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &acad_proxy_entity->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &acad_proxy_entity->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &acad_proxy_entity->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the object
-                         * visability value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->color);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_2000)
-                  && (strcmp (temp_string, "70") == 0))
-                {
-                        /* Now follows a string containing the original
-                         * custom object data format value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->original_custom_object_data_format);
-                        if (acad_proxy_entity->original_custom_object_data_format != 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () found a bad original custom object data format value in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
+                        break;
                 }
-                else if (strcmp (temp_string, "90") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the proxy
-                         * entity ID value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->proxy_entity_class_id);
-                        if (acad_proxy_entity->proxy_entity_class_id != DXF_DEFAULT_PROXY_ENTITY_ID)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad proxy entity class ID in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing the application
-                         * entity ID value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->application_entity_class_id);
-                        if (acad_proxy_entity->application_entity_class_id < 500)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad value in application entity class ID in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the graphics
-                         * data size value (bytes). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "93") == 0)
-                {
-                        /* Now follows a string containing the entity
-                         * data size value (bits). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->entity_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_2000)
-                  && (strcmp (temp_string, "95") == 0))
-                {
-                        /* Now follows a string containing the object
-                         * drawing format value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->object_drawing_format);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                  && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                          && ((strcmp (temp_string, "AcDbZombieEntity") != 0))
-                          && ((strcmp (temp_string, "AcDbProxyEntity") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if ((strcmp (temp_string, "330") == 0)
-                  || (strcmp (temp_string, "340") == 0)
-                  || (strcmp (temp_string, "350") == 0)
-                  || (strcmp (temp_string, "360") == 0))
-                {
-                        if (!i) /* For the very first object_id. */
-                        {
-                                dxf_object_id_set_group_code (acad_proxy_entity->object_id, atoi (temp_string));
-                                /* Now follows a string containing an object id line of data. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->object_id->data);
-                        }
-                        else /* For following object_id's. */
-                        {
-                                DxfObjectId *iter = dxf_object_id_get_last ((DxfObjectId *) acad_proxy_entity->object_id);
-                                iter = dxf_object_id_init ((DxfObjectId *) iter->next);
-                                dxf_object_id_set_group_code (iter, atoi (temp_string));
-                                /* Now follows a string containing an object id line of data. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->data);
-                        }
-                        i++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &acad_proxy_entity->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 70:
+                                /* Only present from R2000 on. */
+                                if (fp->acad_version_number < AutoCAD_2000)
+                                {
+                                        break;
+                                }
+                                acad_proxy_entity->original_custom_object_data_format = atoi (value);
+                                if (acad_proxy_entity->original_custom_object_data_format != 1)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () found a bad original custom object data format value in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 90:
+                                acad_proxy_entity->proxy_entity_class_id = atoi (value);
+                                if (acad_proxy_entity->proxy_entity_class_id != DXF_DEFAULT_PROXY_ENTITY_ID)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad proxy entity class ID in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 91:
+                                acad_proxy_entity->application_entity_class_id = atoi (value);
+                                if (acad_proxy_entity->application_entity_class_id < 500)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad value in application entity class ID in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 93:
+                                /* The entity data and the object ids
+                                 * follow, up to the group code 94. */
+                                acad_proxy_entity->entity_data_size = atoi (value);
+                                entity_data = TRUE;
+                                break;
+                        case 94:
+                                entity_data = FALSE;
+                                break;
+                        case 95:
+                                /* Only present from R2000 on. */
+                                if (fp->acad_version_number >= AutoCAD_2000)
+                                {
+                                        acad_proxy_entity->object_drawing_format = atoi (value);
+                                }
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbZombieEntity") != 0)
+                                  && (strcmp (value, "AcDbProxyEntity") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 310:
+                                if (entity_data == FALSE)
+                                {
+                                        dxf_entity_common_read_pair (fp, &acad_proxy_entity->common, group_code, value);
+                                        break;
+                                }
+                                data = dxf_binary_data_init (dxf_binary_data_new ());
+                                if (data == NULL)
+                                {
+                                        break;
+                                }
+                                free (data->data_line);
+                                data->data_line = strdup (value);
+                                data->length = strlen (value);
+                                if (last_data == NULL)
+                                {
+                                        acad_proxy_entity->binary_entity_data = data;
+                                }
+                                else
+                                {
+                                        last_data->next = (struct DxfBinaryData *) data;
+                                }
+                                last_data = data;
+                                break;
+                        case 330:
+                        case 340:
+                        case 350:
+                        case 360:
+                                if ((entity_data == FALSE)
+                                  && ((group_code == 330) || (group_code == 360)))
+                                {
+                                        dxf_entity_common_read_pair (fp, &acad_proxy_entity->common, group_code, value);
+                                        break;
+                                }
+                                object_id = dxf_object_id_init (dxf_object_id_new ());
+                                if (object_id == NULL)
+                                {
+                                        break;
+                                }
+                                dxf_object_id_set_group_code (object_id, group_code);
+                                free (object_id->data);
+                                object_id->data = strdup (value);
+                                object_id->length = strlen (value);
+                                if (last_object_id == NULL)
+                                {
+                                        acad_proxy_entity->object_id = object_id;
+                                }
+                                else
+                                {
+                                        last_object_id->next = (struct DxfObjectId *) object_id;
+                                }
+                                last_object_id = object_id;
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &acad_proxy_entity->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
+        /* Handle omitted members and/or illegal values. */
+        if ((acad_proxy_entity->common.linetype == NULL)
+          || (strcmp (acad_proxy_entity->common.linetype, "") == 0))
+        {
+                free (acad_proxy_entity->common.linetype);
+                acad_proxy_entity->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
+        }
+        if ((acad_proxy_entity->common.layer == NULL)
+          || (strcmp (acad_proxy_entity->common.layer, "") == 0))
+        {
+                free (acad_proxy_entity->common.layer);
+                acad_proxy_entity->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
 #if DEBUG
-        fprintf (stderr,
-          (_("Information from %s() read %d object_id's from %s.\n")),
-          __FUNCTION__, i, fp->filename);
         DXF_DEBUG_END
 #endif
         return (acad_proxy_entity);
@@ -584,8 +426,8 @@ dxf_acad_proxy_entity_write
                           (_("Error in %s () illegal DXF version for this entity.\n")),
                           __FUNCTION__);
                         fprintf (stderr,
-                          (_("\t entity %s with ID code %d is omitted from output.\n")),
-                          dxf_entity_name, acad_proxy_entity->id_code);
+                          (_("\t entity %s with ID code %" PRIx64 " is omitted from output.\n")),
+                          dxf_entity_name, acad_proxy_entity->common.id_code);
                         return (EXIT_FAILURE);
                 }
                 else
@@ -603,32 +445,32 @@ dxf_acad_proxy_entity_write
         {
                 dxf_entity_name = strdup ("ACAD_PROXY_ENTITY");
         }
-        if ((strcmp (acad_proxy_entity->layer, "") == 0)
-          || (acad_proxy_entity->layer == NULL))
+        if ((strcmp (acad_proxy_entity->common.layer, "") == 0)
+          || (acad_proxy_entity->common.layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, acad_proxy_entity->id_code);
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, acad_proxy_entity->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                acad_proxy_entity->layer = strdup (DXF_DEFAULT_LAYER);
+                acad_proxy_entity->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (acad_proxy_entity->linetype == NULL)
+        if (acad_proxy_entity->common.linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, acad_proxy_entity->id_code);
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, acad_proxy_entity->common.id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                acad_proxy_entity->linetype = strdup(DXF_DEFAULT_LINETYPE);
+                acad_proxy_entity->common.linetype = strdup(DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (acad_proxy_entity->id_code != -1)
+        if (acad_proxy_entity->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", acad_proxy_entity->id_code);
+                dxf_handle_write (fp, 5, acad_proxy_entity->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -640,74 +482,74 @@ dxf_acad_proxy_entity_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (acad_proxy_entity->dictionary_owner_soft, "") != 0)
+        if ((acad_proxy_entity->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", acad_proxy_entity->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, acad_proxy_entity->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (acad_proxy_entity->dictionary_owner_hard, "") != 0)
+        if ((acad_proxy_entity->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", acad_proxy_entity->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, acad_proxy_entity->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (acad_proxy_entity->object_owner_soft, "") != 0)
+        if ((acad_proxy_entity->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", acad_proxy_entity->object_owner_soft);
+                dxf_handle_write (fp, 330, acad_proxy_entity->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (acad_proxy_entity->paperspace == DXF_PAPERSPACE)
+        if (acad_proxy_entity->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", acad_proxy_entity->layer);
-        if (strcmp (acad_proxy_entity->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", acad_proxy_entity->common.layer);
+        if (strcmp (acad_proxy_entity->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", acad_proxy_entity->linetype);
+                fprintf (fp->fp, "  6\n%s\n", acad_proxy_entity->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (acad_proxy_entity->material, "") != 0))
+          && (acad_proxy_entity->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", acad_proxy_entity->material);
+                dxf_handle_write (fp, 347, acad_proxy_entity->common.cold->material);
         }
-        if (acad_proxy_entity->color != DXF_COLOR_BYLAYER)
+        if (acad_proxy_entity->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", acad_proxy_entity->color);
+                fprintf (fp->fp, " 62\n%hd\n", acad_proxy_entity->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", acad_proxy_entity->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", acad_proxy_entity->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (acad_proxy_entity->elevation != 0.0))
+          && (acad_proxy_entity->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", acad_proxy_entity->elevation);
+                fprintf (fp->fp, " 38\n%f\n", acad_proxy_entity->common.elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
-          && (acad_proxy_entity->thickness != 0.0))
+          && (acad_proxy_entity->common.thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", acad_proxy_entity->thickness);
+                fprintf (fp->fp, " 39\n%f\n", acad_proxy_entity->common.thickness);
         }
-        fprintf (fp->fp, " 48\n%f\n", acad_proxy_entity->linetype_scale);
-        fprintf (fp->fp, " 60\n%hd\n", acad_proxy_entity->visibility);
+        fprintf (fp->fp, " 48\n%f\n", acad_proxy_entity->common.linetype_scale);
+        fprintf (fp->fp, " 60\n%hd\n", acad_proxy_entity->common.visibility);
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", acad_proxy_entity->color_value);
-                fprintf (fp->fp, "430\n%s\n", acad_proxy_entity->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", acad_proxy_entity->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", acad_proxy_entity->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", acad_proxy_entity->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", acad_proxy_entity->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", acad_proxy_entity->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", acad_proxy_entity->shadow_mode);
+                dxf_handle_write (fp, 390, acad_proxy_entity->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", acad_proxy_entity->common.cold->shadow_mode);
         }
         if (fp->acad_version_number == AutoCAD_13)
         {
@@ -726,19 +568,13 @@ dxf_acad_proxy_entity_write
         if (fp->acad_version_number >= AutoCAD_14)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", acad_proxy_entity->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", acad_proxy_entity->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", acad_proxy_entity->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", acad_proxy_entity->common.cold->graphics_data_size);
 #endif
-                if (acad_proxy_entity->binary_graphics_data != NULL)
+                if (acad_proxy_entity->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter310a;
-                        iter310a = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
-                        while (iter310a != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310a->data_line);
-                                iter310a = (DxfBinaryData *) iter310a->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, acad_proxy_entity->common.cold->binary_graphics_data);
                 }
                 fprintf (fp->fp, " 93\n%" PRIi32 "\n", acad_proxy_entity->entity_data_size);
                 if (acad_proxy_entity->binary_entity_data != NULL)
@@ -768,6 +604,7 @@ dxf_acad_proxy_entity_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", acad_proxy_entity->original_custom_object_data_format);
         }
+        dxf_entity_common_write_xdata (fp, &acad_proxy_entity->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -809,17 +646,15 @@ dxf_acad_proxy_entity_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (acad_proxy_entity->linetype);
-        free (acad_proxy_entity->layer);
-        free (acad_proxy_entity->dictionary_owner_soft);
-        free (acad_proxy_entity->object_owner_soft);
-        free (acad_proxy_entity->material);
-        free (acad_proxy_entity->dictionary_owner_hard);
-        free (acad_proxy_entity->plot_style_name);
-        free (acad_proxy_entity->color_name);
-        dxf_binary_data_free_list (acad_proxy_entity->binary_graphics_data);
-        dxf_binary_data_free_list (acad_proxy_entity->binary_entity_data);
-        dxf_object_id_free_list (acad_proxy_entity->object_id);
+        dxf_entity_common_free (&acad_proxy_entity->common);
+        if (acad_proxy_entity->binary_entity_data != NULL)
+        {
+                dxf_binary_data_free_list (acad_proxy_entity->binary_entity_data);
+        }
+        if (acad_proxy_entity->object_id != NULL)
+        {
+                dxf_object_id_free_list (acad_proxy_entity->object_id);
+        }
         free (acad_proxy_entity);
         acad_proxy_entity = NULL;
 #if DEBUG
@@ -853,6 +688,7 @@ dxf_acad_proxy_entity_free_list
         while (acad_proxy_entities != NULL)
         {
                 DxfAcadProxyEntity *iter = (DxfAcadProxyEntity *) acad_proxy_entities->next;
+                acad_proxy_entities->next = NULL;
                 dxf_acad_proxy_entity_free (acad_proxy_entities);
                 acad_proxy_entities = (DxfAcadProxyEntity *) iter;
         }
@@ -862,12 +698,89 @@ dxf_acad_proxy_entity_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c ACAD_PROXY_ENTITY entity.
+ *
+ * The copy does not share any memory with \c acad_proxy_entity, its \c next
+ * member is \c NULL.\n
+ * The graphics data is kept in the common data, the unused
+ * \c binary_graphics_data member is not copied.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfAcadProxyEntity *
+dxf_acad_proxy_entity_copy
+(
+        DxfAcadProxyEntity *acad_proxy_entity
+                /*!< a pointer to the DXF \c ACAD_PROXY_ENTITY entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAcadProxyEntity *copy;
+
+        /* Do some basic checks. */
+        if (acad_proxy_entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_acad_proxy_entity_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, acad_proxy_entity, sizeof (DxfAcadProxyEntity));
+        copy->binary_entity_data = NULL;
+        copy->object_id = NULL;
+        copy->binary_graphics_data = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &acad_proxy_entity->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_acad_proxy_entity_free (copy);
+                return (NULL);
+        }
+        if (acad_proxy_entity->binary_entity_data != NULL)
+        {
+                copy->binary_entity_data = dxf_binary_data_copy_list (acad_proxy_entity->binary_entity_data);
+                if (copy->binary_entity_data == NULL)
+                {
+                        dxf_acad_proxy_entity_free (copy);
+                        return (NULL);
+                }
+        }
+        if (acad_proxy_entity->object_id != NULL)
+        {
+                copy->object_id = dxf_object_id_copy_list (acad_proxy_entity->object_id);
+                if (copy->object_id == NULL)
+                {
+                        dxf_acad_proxy_entity_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c ACAD_PROXY_ENTITY entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_acad_proxy_entity_get_id_code
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -885,16 +798,10 @@ dxf_acad_proxy_entity_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->id_code);
+        return (acad_proxy_entity->common.id_code);
 }
 
 
@@ -906,7 +813,7 @@ dxf_acad_proxy_entity_set_id_code
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -923,13 +830,7 @@ dxf_acad_proxy_entity_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        acad_proxy_entity->id_code = id_code;
+        acad_proxy_entity->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -960,7 +861,7 @@ dxf_acad_proxy_entity_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->linetype ==  NULL)
+        if (acad_proxy_entity->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
@@ -970,7 +871,7 @@ dxf_acad_proxy_entity_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->linetype));
+        return (strdup (acad_proxy_entity->common.linetype));
 }
 
 
@@ -1004,7 +905,7 @@ dxf_acad_proxy_entity_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->linetype = strdup (linetype);
+        acad_proxy_entity->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1035,7 +936,7 @@ dxf_acad_proxy_entity_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->layer ==  NULL)
+        if (acad_proxy_entity->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
@@ -1045,7 +946,7 @@ dxf_acad_proxy_entity_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->layer));
+        return (strdup (acad_proxy_entity->common.layer));
 }
 
 
@@ -1079,7 +980,7 @@ dxf_acad_proxy_entity_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->layer = strdup (layer);
+        acad_proxy_entity->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1113,7 +1014,7 @@ dxf_acad_proxy_entity_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->elevation);
+        return (acad_proxy_entity->common.elevation);
 }
 
 
@@ -1143,7 +1044,7 @@ dxf_acad_proxy_entity_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->elevation = elevation;
+        acad_proxy_entity->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1174,7 +1075,7 @@ dxf_acad_proxy_entity_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->thickness < 0.0)
+        if (acad_proxy_entity->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1183,7 +1084,7 @@ dxf_acad_proxy_entity_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->thickness);
+        return (acad_proxy_entity->common.thickness);
 }
 
 
@@ -1219,7 +1120,7 @@ dxf_acad_proxy_entity_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        acad_proxy_entity->thickness = thickness;
+        acad_proxy_entity->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1250,7 +1151,7 @@ dxf_acad_proxy_entity_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->linetype_scale < 0.0)
+        if (acad_proxy_entity->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1259,7 +1160,7 @@ dxf_acad_proxy_entity_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->linetype_scale);
+        return (acad_proxy_entity->common.linetype_scale);
 }
 
 
@@ -1292,7 +1193,7 @@ dxf_acad_proxy_entity_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        acad_proxy_entity->linetype_scale = linetype_scale;
+        acad_proxy_entity->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1323,13 +1224,13 @@ dxf_acad_proxy_entity_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->visibility < 0)
+        if (acad_proxy_entity->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (acad_proxy_entity->visibility > 1)
+        if (acad_proxy_entity->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1338,7 +1239,7 @@ dxf_acad_proxy_entity_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->visibility);
+        return (acad_proxy_entity->common.visibility);
 }
 
 
@@ -1377,7 +1278,7 @@ dxf_acad_proxy_entity_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        acad_proxy_entity->visibility = visibility;
+        acad_proxy_entity->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1408,7 +1309,7 @@ dxf_acad_proxy_entity_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->color < 0)
+        if (acad_proxy_entity->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1417,7 +1318,7 @@ dxf_acad_proxy_entity_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->color);
+        return (acad_proxy_entity->common.color);
 }
 
 
@@ -1452,7 +1353,7 @@ dxf_acad_proxy_entity_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        acad_proxy_entity->color = color;
+        acad_proxy_entity->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1484,13 +1385,13 @@ dxf_acad_proxy_entity_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->paperspace < 0)
+        if (acad_proxy_entity->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (acad_proxy_entity->paperspace > 1)
+        if (acad_proxy_entity->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1499,7 +1400,7 @@ dxf_acad_proxy_entity_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->paperspace);
+        return (acad_proxy_entity->common.paperspace);
 }
 
 
@@ -1538,7 +1439,7 @@ dxf_acad_proxy_entity_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        acad_proxy_entity->paperspace = paperspace;
+        acad_proxy_entity->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1570,13 +1471,13 @@ dxf_acad_proxy_entity_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->shadow_mode < 0)
+        if (acad_proxy_entity->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (acad_proxy_entity->shadow_mode > 3)
+        if (acad_proxy_entity->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1585,7 +1486,7 @@ dxf_acad_proxy_entity_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->shadow_mode);
+        return (acad_proxy_entity->common.cold->shadow_mode);
 }
 
 
@@ -1627,7 +1528,7 @@ dxf_acad_proxy_entity_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        acad_proxy_entity->shadow_mode = shadow_mode;
+        acad_proxy_entity->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1661,17 +1562,10 @@ dxf_acad_proxy_entity_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_soft));
+        return (dxf_handle_to_string (acad_proxy_entity->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1707,7 +1601,7 @@ dxf_acad_proxy_entity_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        acad_proxy_entity->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1741,17 +1635,10 @@ dxf_acad_proxy_entity_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->object_owner_soft));
+        return (dxf_handle_to_string (acad_proxy_entity->common.cold->object_owner_soft));
 }
 
 
@@ -1787,7 +1674,7 @@ dxf_acad_proxy_entity_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->object_owner_soft = strdup (object_owner_soft);
+        acad_proxy_entity->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1821,17 +1708,10 @@ dxf_acad_proxy_entity_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->material));
+        return (dxf_handle_to_string (acad_proxy_entity->common.cold->material));
 }
 
 
@@ -1870,7 +1750,7 @@ dxf_acad_proxy_entity_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->material = strdup (material);
+        acad_proxy_entity->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1904,17 +1784,10 @@ dxf_acad_proxy_entity_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_hard));
+        return (dxf_handle_to_string (acad_proxy_entity->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1950,7 +1823,7 @@ dxf_acad_proxy_entity_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        acad_proxy_entity->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1985,7 +1858,7 @@ dxf_acad_proxy_entity_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->lineweight);
+        return (acad_proxy_entity->common.lineweight);
 }
 
 
@@ -2015,7 +1888,7 @@ dxf_acad_proxy_entity_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->lineweight = lineweight;
+        acad_proxy_entity->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2048,17 +1921,10 @@ dxf_acad_proxy_entity_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->plot_style_name));
+        return (dxf_handle_to_string (acad_proxy_entity->common.cold->plot_style_name));
 }
 
 
@@ -2096,7 +1962,7 @@ dxf_acad_proxy_entity_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->plot_style_name = strdup (plot_style_name);
+        acad_proxy_entity->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2131,7 +1997,7 @@ dxf_acad_proxy_entity_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->color_value);
+        return (acad_proxy_entity->common.color_value);
 }
 
 
@@ -2161,7 +2027,7 @@ dxf_acad_proxy_entity_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->color_value = color_value;
+        acad_proxy_entity->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2193,7 +2059,7 @@ dxf_acad_proxy_entity_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->color_name ==  NULL)
+        if (acad_proxy_entity->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2203,7 +2069,7 @@ dxf_acad_proxy_entity_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->color_name));
+        return (strdup (acad_proxy_entity->common.cold->color_name));
 }
 
 
@@ -2241,7 +2107,7 @@ dxf_acad_proxy_entity_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->color_name = strdup (color_name);
+        acad_proxy_entity->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2276,7 +2142,7 @@ dxf_acad_proxy_entity_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->transparency);
+        return (acad_proxy_entity->common.cold->transparency);
 }
 
 
@@ -2306,7 +2172,7 @@ dxf_acad_proxy_entity_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->transparency = transparency;
+        acad_proxy_entity->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2577,7 +2443,7 @@ dxf_acad_proxy_entity_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (acad_proxy_entity->graphics_data_size < 0)
+        if (acad_proxy_entity->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an invalid value was passed.\n")),
@@ -2586,7 +2452,7 @@ dxf_acad_proxy_entity_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (acad_proxy_entity->graphics_data_size);
+        return (acad_proxy_entity->common.cold->graphics_data_size);
 }
 
 
@@ -2621,7 +2487,7 @@ dxf_acad_proxy_entity_set_graphics_data_size
                   (_("Warning in %s () an invalid value was passed.\n")),
                   __FUNCTION__);
         }
-        acad_proxy_entity->graphics_data_size = graphics_data_size;
+        acad_proxy_entity->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2770,14 +2636,15 @@ dxf_acad_proxy_entity_set_object_drawing_format
 
 
 /*!
- * \brief Get the pointer to the \c binary_graphics_data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c ACAD_PROXY_ENTITY entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_acad_proxy_entity_get_binary_graphics_data
 (
         DxfAcadProxyEntity *acad_proxy_entity
@@ -2795,32 +2662,31 @@ dxf_acad_proxy_entity_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) acad_proxy_entity->binary_graphics_data);
+        return (acad_proxy_entity->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c ACAD_PROXY_ENTITY entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c acad_proxy_entity when successful, or \c NULL when an
+ * error occurred.
  */
 DxfAcadProxyEntity *
 dxf_acad_proxy_entity_set_binary_graphics_data
 (
         DxfAcadProxyEntity *acad_proxy_entity,
                 /*!< a pointer to a DXF \c ACAD_PROXY_ENTITY entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -2841,23 +2707,12 @@ dxf_acad_proxy_entity_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (acad_proxy_entity->binary_graphics_data == NULL)
+        if ((acad_proxy_entity->common.cold->binary_graphics_data != NULL)
+          && (acad_proxy_entity->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                acad_proxy_entity->binary_graphics_data = dxf_binary_data_init (acad_proxy_entity->binary_graphics_data);
-                if (acad_proxy_entity->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (acad_proxy_entity->common.cold->binary_graphics_data);
         }
-        acad_proxy_entity->binary_graphics_data = (DxfBinaryData *) data;
+        acad_proxy_entity->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -51,6 +51,8 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "binary_data.h"
 #include "object_id.h"
 
@@ -68,119 +70,9 @@ typedef struct
 dxf_acad_proxy_entity_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF acad_proxy_entity. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         int16_t original_custom_object_data_format;
                 /*!< Original custom object data format:\n
                  * <ol>
@@ -242,8 +134,9 @@ DxfAcadProxyEntity *dxf_acad_proxy_entity_read (DxfFile *fp, DxfAcadProxyEntity
 int dxf_acad_proxy_entity_write (DxfFile *fp, DxfAcadProxyEntity *acad_proxy_entity);
 int dxf_acad_proxy_entity_free (DxfAcadProxyEntity *acad_proxy_entity);
 void dxf_acad_proxy_entity_free_list (DxfAcadProxyEntity *acad_proxy_entities);
-int dxf_acad_proxy_entity_get_id_code (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_id_code (DxfAcadProxyEntity *acad_proxy_entity, int id_code);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_copy (DxfAcadProxyEntity *acad_proxy_entity);
+DxfHandle dxf_acad_proxy_entity_get_id_code (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_id_code (DxfAcadProxyEntity *acad_proxy_entity, DxfHandle id_code);
 char *dxf_acad_proxy_entity_get_linetype (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_linetype (DxfAcadProxyEntity *acad_proxy_entity, char *linetype);
 char *dxf_acad_proxy_entity_get_layer (DxfAcadProxyEntity *acad_proxy_entity);
@@ -292,8 +185,8 @@ int32_t dxf_acad_proxy_entity_get_entity_data_size (DxfAcadProxyEntity *acad_pro
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_entity_data_size (DxfAcadProxyEntity *acad_proxy_entity, int32_t entity_data_size);
 uint32_t dxf_acad_proxy_entity_get_object_drawing_format (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_object_drawing_format (DxfAcadProxyEntity *acad_proxy_entity, uint32_t object_drawing_format);
-DxfBinaryData *dxf_acad_proxy_entity_get_binary_graphics_data (DxfAcadProxyEntity *acad_proxy_entity);
-DxfAcadProxyEntity *dxf_acad_proxy_entity_set_binary_graphics_data (DxfAcadProxyEntity *acad_proxy_entity, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_acad_proxy_entity_get_binary_graphics_data (DxfAcadProxyEntity *acad_proxy_entity);
+DxfAcadProxyEntity *dxf_acad_proxy_entity_set_binary_graphics_data (DxfAcadProxyEntity *acad_proxy_entity, DxfBinaryBuffer *data);
 DxfBinaryData *dxf_acad_proxy_entity_get_binary_entity_data (DxfAcadProxyEntity *acad_proxy_entity);
 DxfAcadProxyEntity *dxf_acad_proxy_entity_set_binary_entity_data (DxfAcadProxyEntity *acad_proxy_entity, DxfBinaryData *data);
 DxfObjectId *dxf_acad_proxy_entity_get_object_id (DxfAcadProxyEntity *acad_proxy_entity);
@@ -129,9 +129,9 @@ dxf_appid_init
         appid->id_code = 0;
         appid->application_name = strdup ("");
         appid->flag = 0;
-        appid->dictionary_owner_soft = strdup ("");
-        appid->object_owner_soft = strdup ("");
-        appid->dictionary_owner_hard = strdup ("");
+        appid->dictionary_owner_soft = DXF_HANDLE_NONE;
+        appid->object_owner_soft = DXF_HANDLE_NONE;
+        appid->dictionary_owner_hard = DXF_HANDLE_NONE;
         appid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -203,8 +203,7 @@ dxf_appid_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &appid->id_code);
+                        appid->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -226,15 +225,13 @@ dxf_appid_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->dictionary_owner_soft);
+                                appid->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->object_owner_soft);
+                                appid->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -242,8 +239,7 @@ dxf_appid_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->dictionary_owner_hard);
+                        appid->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -309,7 +305,7 @@ dxf_appid_write
           || (strcmp (appid->application_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s empty block name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, appid->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -326,9 +322,9 @@ dxf_appid_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (appid->id_code != -1)
+        if (appid->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", appid->id_code);
+                dxf_handle_write (fp, 5, appid->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -340,24 +336,24 @@ dxf_appid_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (appid->dictionary_owner_soft, "") != 0)
+        if ((appid->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", appid->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, appid->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (appid->dictionary_owner_hard, "") != 0)
+        if ((appid->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", appid->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, appid->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (appid->object_owner_soft, "") != 0)
+        if ((appid->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", appid->object_owner_soft);
+                dxf_handle_write (fp, 330, appid->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -407,9 +403,6 @@ dxf_appid_free
               return (EXIT_FAILURE);
         }
         free (appid->application_name);
-        free (appid->dictionary_owner_soft);
-        free (appid->object_owner_soft);
-        free (appid->dictionary_owner_hard);
         free (appid);
         appid = NULL;
 #if DEBUG
@@ -443,6 +436,7 @@ dxf_appid_free_list
         while (appids != NULL)
         {
                 DxfAppid *iter = (DxfAppid *) appids->next;
+                appids->next = NULL;
                 dxf_appid_free (appids);
                 appids = (DxfAppid *) iter;
         }
@@ -452,12 +446,71 @@ dxf_appid_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c APPID symbol table entry.
+ *
+ * The copy does not share any memory with \c appid, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfAppid *
+dxf_appid_copy
+(
+        DxfAppid *appid
+                /*!< a pointer to the DXF \c APPID symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAppid *copy;
+
+        /* Do some basic checks. */
+        if (appid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_appid_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, appid, sizeof (DxfAppid));
+        copy->application_name = NULL;
+        copy->next = NULL;
+        if (appid->application_name != NULL)
+        {
+                copy->application_name = strdup (appid->application_name);
+                if (copy->application_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_appid_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from this DXF \c APPID symbol table entry.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_appid_get_id_code
 (
         DxfAppid *appid
@@ -475,12 +528,6 @@ dxf_appid_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (appid->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -496,7 +543,7 @@ dxf_appid_set_id_code
 (
         DxfAppid *appid,
                 /*!< a pointer to a DXF \c APPID symbol table entry. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the symbol table entry.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -513,12 +560,6 @@ dxf_appid_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         appid->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -853,17 +894,10 @@ dxf_appid_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (appid->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_soft));
+        return (dxf_handle_to_string (appid->dictionary_owner_soft));
 }
 
 
@@ -899,7 +933,7 @@ dxf_appid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        appid->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -933,17 +967,10 @@ dxf_appid_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (appid->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->object_owner_soft));
+        return (dxf_handle_to_string (appid->object_owner_soft));
 }
 
 
@@ -979,7 +1006,7 @@ dxf_appid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->object_owner_soft = strdup (object_owner_soft);
+        appid->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1013,17 +1040,10 @@ dxf_appid_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (appid->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_hard));
+        return (dxf_handle_to_string (appid->dictionary_owner_hard));
 }
 
 
@@ -1059,7 +1079,7 @@ dxf_appid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        appid->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
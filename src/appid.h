@@ -53,6 +53,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -70,7 +71,7 @@ extern "C" {
 typedef struct
 dxf_appid_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entry.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -94,15 +95,15 @@ dxf_appid_struct
                  * last time the drawing was edited.</li>
                  * </ol>
                  * Group code = 70. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -118,8 +119,9 @@ DxfAppid *dxf_appid_read (DxfFile *fp, DxfAppid *appid);
 int dxf_appid_write (DxfFile *fp, DxfAppid* appid);
 int dxf_appid_free (DxfAppid *appid);
 void dxf_appid_free_list (DxfAppid *appids);
-int dxf_appid_get_id_code (DxfAppid *appid);
-DxfAppid *dxf_appid_set_id_code (DxfAppid *appid, int id_code);
+DxfAppid *dxf_appid_copy (DxfAppid *appid);
+DxfHandle dxf_appid_get_id_code (DxfAppid *appid);
+DxfAppid *dxf_appid_set_id_code (DxfAppid *appid, DxfHandle id_code);
 char *dxf_appid_get_application_name (DxfAppid *appid);
 DxfAppid *dxf_appid_set_application_name (DxfAppid *appid, char *name);
 int16_t dxf_appid_get_flag (DxfAppid *appid);
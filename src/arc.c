@@ -40,6 +40,7 @@
 
 
 #include "arc.h"
+#include "entities.h"
 
 
 /*!
@@ -118,40 +119,28 @@ dxf_arc_init
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_entity_common_init (&arc->common) == NULL)
+        {
+              fprintf (stderr,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
         /* Assign initial values to members. */
-        arc->id_code = 0;
-        arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        arc->layer = strdup (DXF_DEFAULT_LAYER);
-        arc->elevation = 0.0;
-        arc->thickness = 0.0;
-        arc->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        arc->visibility = DXF_DEFAULT_VISIBILITY;
-        arc->color = DXF_COLOR_BYLAYER;
-        arc->paperspace = DXF_MODELSPACE;
-        arc->graphics_data_size = 0;
-        arc->shadow_mode = 0;
-        arc->dictionary_owner_soft = strdup ("");
-        arc->object_owner_soft = strdup ("");
-        arc->material = strdup ("");
-        arc->dictionary_owner_hard = strdup ("");
-        arc->lineweight = 0;
-        arc->plot_style_name = strdup ("");
-        arc->color_value = 0;
-        arc->color_name = strdup ("");
-        arc->transparency = 0;
-        arc->p0->x0 = 0.0;
-        arc->p0->y0 = 0.0;
-        arc->p0->z0 = 0.0;
+        arc->p0 = dxf_point_init (dxf_point_new ());
+        if (arc->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         arc->radius = 0.0;
         arc->start_angle = 0.0;
         arc->end_angle = 0.0;
         arc->extr_x0 = 0.0;
         arc->extr_y0 = 0.0;
         arc->extr_z0 = 0.0;
-        /* Initialize new structs for the following members later,
-         * when they are required and when we have content. */
-        arc->binary_graphics_data = NULL;
-        arc->p0 = NULL;
         arc->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -186,9 +175,9 @@ dxf_arc_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -196,8 +185,6 @@ dxf_arc_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (arc == NULL)
@@ -205,318 +192,101 @@ dxf_arc_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                arc = dxf_arc_init (arc);
-        }
-        if (arc->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                arc->binary_graphics_data = dxf_binary_data_init (arc->binary_graphics_data);
-                if (arc->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (arc->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                arc->p0 = dxf_point_init (arc->p0);
-                if (arc->p0 == NULL)
+                arc = dxf_arc_init (dxf_arc_new ());
+                if (arc == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) arc->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &arc->id_code);
+                        break;
                 }
-                else if (strcmp (temp_string, "6") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->linetype);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->radius);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->start_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->end_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbCircle") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &arc->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &arc->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &arc->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                arc->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                arc->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                arc->p0->z0 = atof (value);
+                                break;
+                        case 40:
+                                arc->radius = atof (value);
+                                break;
+                        case 50:
+                                arc->start_angle = atof (value);
+                                break;
+                        case 51:
+                                arc->end_angle = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbCircle") != 0)
+                                  && (strcmp (value, "AcDbArc") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                arc->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                arc->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                arc->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &arc->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (arc->linetype, "") == 0)
+        if ((arc->common.linetype == NULL)
+          || (strcmp (arc->common.linetype, "") == 0))
         {
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (arc->common.linetype);
+                arc->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (arc->layer, "") == 0)
+        if ((arc->common.layer == NULL)
+          || (strcmp (arc->common.layer, "") == 0))
         {
-                arc->layer = strdup (DXF_DEFAULT_LAYER);
+                free (arc->common.layer);
+                arc->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -569,8 +339,8 @@ dxf_arc_write
         if (arc->start_angle == arc->end_angle)
         {
                 fprintf (stderr,
-                  (_("Error in %s () start angle and end angle are identical for the %s entity with id-code: %x.\n")),
-                    __FUNCTION__, dxf_entity_name, arc->id_code);
+                  (_("Error in %s () start angle and end angle are identical for the %s entity with id-code: %" PRIx64 ".\n")),
+                    __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr,
                   (_("\tskipping %s entity.\n")), dxf_entity_name);
                 /* Clean up. */
@@ -579,8 +349,8 @@ dxf_arc_write
         }
         if (arc->start_angle > 360.0)
         {
-                fprintf (stderr, "Error in %s () start angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
-                        __FUNCTION__, dxf_entity_name, arc->id_code);
+                fprintf (stderr, "Error in %s () start angle is greater than 360 degrees for the %s entity with id-code: %" PRIx64 ".\n",
+                        __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
@@ -589,8 +359,8 @@ dxf_arc_write
         }
         if (arc->start_angle < 0.0)
         {
-                fprintf (stderr, "Error in %s () start angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
-                        __FUNCTION__, dxf_entity_name, arc->id_code);
+                fprintf (stderr, "Error in %s () start angle is lesser than 0 degrees for the %s entity with id-code: %" PRIx64 ".\n",
+                        __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
@@ -599,8 +369,8 @@ dxf_arc_write
         }
         if (arc->end_angle > 360.0)
         {
-                fprintf (stderr, "Error in %s () end angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
-                        __FUNCTION__, dxf_entity_name, arc->id_code);
+                fprintf (stderr, "Error in %s () end angle is greater than 360 degrees for the %s entity with id-code: %" PRIx64 ".\n",
+                        __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
@@ -609,8 +379,8 @@ dxf_arc_write
         }
         if (arc->end_angle < 0.0)
         {
-                fprintf (stderr, "Error in %s () end angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
-                        __FUNCTION__, dxf_entity_name, arc->id_code);
+                fprintf (stderr, "Error in %s () end angle is lesser than 0 degrees for the %s entity with id-code: %" PRIx64 ".\n",
+                        __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
@@ -619,39 +389,39 @@ dxf_arc_write
         }
         if (arc->radius == 0.0)
         {
-                fprintf (stderr, "Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n",
-                        __FUNCTION__, dxf_entity_name, arc->id_code);
+                fprintf (stderr, "Error in %s () radius value equals 0.0 for the %s entity with id-code: %" PRIx64 ".\n",
+                        __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (arc->linetype, "") == 0)
+        if (strcmp (arc->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, arc->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                arc->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (arc->layer, "") == 0)
+        if (strcmp (arc->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, arc->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, arc->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                arc->layer = DXF_DEFAULT_LAYER;
+                arc->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (arc->id_code != -1)
+        if (arc->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", arc->id_code);
+                dxf_handle_write (fp, 5, arc->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -663,101 +433,95 @@ dxf_arc_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (arc->dictionary_owner_soft, "") != 0)
+        if ((arc->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", arc->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, arc->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (arc->dictionary_owner_hard, "") != 0)
+        if ((arc->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", arc->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, arc->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (arc->object_owner_soft, "") != 0)
+        if ((arc->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", arc->object_owner_soft);
+                dxf_handle_write (fp, 330, arc->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (arc->paperspace == DXF_PAPERSPACE)
+        if (arc->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", arc->layer);
-        if (strcmp (arc->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", arc->common.layer);
+        if (strcmp (arc->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", arc->linetype);
+                fprintf (fp->fp, "  6\n%s\n", arc->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (arc->material, "") != 0))
+          && (arc->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", arc->material);
+                dxf_handle_write (fp, 347, arc->common.cold->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (arc->elevation != 0.0))
+          && (arc->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", arc->elevation);
+                fprintf (fp->fp, " 38\n%f\n", arc->common.elevation);
         }
-        if (arc->color != DXF_COLOR_BYLAYER)
+        if (arc->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", arc->color);
+                fprintf (fp->fp, " 62\n%hd\n", arc->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", arc->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", arc->common.lineweight);
         }
-        if (arc->linetype_scale != 1.0)
+        if (arc->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", arc->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", arc->common.linetype_scale);
         }
-        if (arc->visibility != 0)
+        if (arc->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", arc->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", arc->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", arc->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", arc->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", arc->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", arc->common.cold->graphics_data_size);
 #endif
-                if (arc->binary_graphics_data != NULL)
+                if (arc->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) arc->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, arc->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", arc->color_value);
-                fprintf (fp->fp, "430\n%s\n", arc->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", arc->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", arc->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", arc->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", arc->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", arc->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", arc->shadow_mode);
+                dxf_handle_write (fp, 390, arc->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", arc->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbCircle\n");
         }
-        if (arc->thickness != 0.0)
+        if (arc->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", arc->thickness);
+                fprintf (fp->fp, " 39\n%f\n", arc->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", arc->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", arc->p0->y0);
@@ -778,6 +542,7 @@ dxf_arc_write
                 fprintf (fp->fp, "220\n%f\n", arc->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", arc->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &arc->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -823,15 +588,7 @@ dxf_arc_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc->linetype);
-        free (arc->layer);
-        dxf_binary_data_free (arc->binary_graphics_data);
-        free (arc->dictionary_owner_soft);
-        free (arc->object_owner_soft);
-        free (arc->material);
-        free (arc->dictionary_owner_hard);
-        free (arc->plot_style_name);
-        free (arc->color_name);
+        dxf_entity_common_free (&arc->common);
         dxf_point_free (arc->p0);
         free (arc);
         arc = NULL;
@@ -869,6 +626,7 @@ dxf_arc_free_list
         while (arcs != NULL)
         {
                 DxfArc *iter = (DxfArc *) arcs->next;
+                arcs->next = NULL;
                 dxf_arc_free (arcs);
                 arcs = (DxfArc *) iter;
         }
@@ -878,6 +636,77 @@ dxf_arc_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c ARC entity.
+ *
+ * The copy does not share any memory with \c arc, its \c next
+ * member is \c NULL.\n
+ * Of the points only the coordinates are copied.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfArc *
+dxf_arc_copy
+(
+        DxfArc *arc
+                /*!< a pointer to the DXF \c ARC entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfArc *copy;
+
+        /* Do some basic checks. */
+        if (arc == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_arc_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, arc, sizeof (DxfArc));
+        copy->p0 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &arc->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_arc_free (copy);
+                return (NULL);
+        }
+        if (arc->p0 != NULL)
+        {
+                copy->p0 = dxf_point_new ();
+                if (copy->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_arc_free (copy);
+                        return (NULL);
+                }
+                copy->p0->x0 = arc->p0->x0;
+                copy->p0->y0 = arc->p0->y0;
+                copy->p0->z0 = arc->p0->z0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c ARC entity.
  *
@@ -886,7 +715,7 @@ dxf_arc_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_arc_get_id_code
 (
         DxfArc *arc
@@ -904,16 +733,10 @@ dxf_arc_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->id_code);
+        return (arc->common.id_code);
 }
 
 
@@ -931,7 +754,7 @@ dxf_arc_set_id_code
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -948,13 +771,7 @@ dxf_arc_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        arc->id_code = id_code;
+        arc->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -988,7 +805,7 @@ dxf_arc_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->linetype ==  NULL)
+        if (arc->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -998,7 +815,7 @@ dxf_arc_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->linetype));
+        return (strdup (arc->common.linetype));
 }
 
 
@@ -1041,7 +858,7 @@ dxf_arc_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->linetype = strdup (linetype);
+        arc->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1075,7 +892,7 @@ dxf_arc_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->layer ==  NULL)
+        if (arc->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1085,7 +902,7 @@ dxf_arc_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->layer));
+        return (strdup (arc->common.layer));
 }
 
 
@@ -1126,7 +943,7 @@ dxf_arc_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->layer = strdup (layer);
+        arc->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1163,7 +980,7 @@ dxf_arc_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->elevation);
+        return (arc->common.elevation);
 }
 
 
@@ -1196,7 +1013,7 @@ dxf_arc_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->elevation = elevation;
+        arc->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1230,13 +1047,13 @@ dxf_arc_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->thickness < 0.0)
+        if (arc->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (arc->thickness == 0.0)
+        if (arc->common.thickness == 0.0)
         {
                 fprintf (stderr,
                   (_("warning in %s () a value of zero was found.\n")),
@@ -1245,7 +1062,7 @@ dxf_arc_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->thickness);
+        return (arc->common.thickness);
 }
 
 
@@ -1290,7 +1107,7 @@ dxf_arc_set_thickness
                   (_("Warning in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
         }
-        arc->thickness = thickness;
+        arc->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1324,13 +1141,13 @@ dxf_arc_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->linetype_scale < 0.0)
+        if (arc->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (arc->linetype_scale == 0.0)
+        if (arc->common.linetype_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a value of zero was found.\n")),
@@ -1339,7 +1156,7 @@ dxf_arc_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->linetype_scale);
+        return (arc->common.linetype_scale);
 }
 
 
@@ -1384,7 +1201,7 @@ dxf_arc_set_linetype_scale
                   (_("Warning in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
         }
-        arc->linetype_scale = linetype_scale;
+        arc->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1418,13 +1235,13 @@ dxf_arc_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->visibility < 0)
+        if (arc->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (arc->visibility > 1)
+        if (arc->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1433,7 +1250,7 @@ dxf_arc_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->visibility);
+        return (arc->common.visibility);
 }
 
 
@@ -1478,7 +1295,7 @@ dxf_arc_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        arc->visibility = visibility;
+        arc->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1512,7 +1329,7 @@ dxf_arc_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->color < 0)
+        if (arc->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1521,7 +1338,7 @@ dxf_arc_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->color);
+        return (arc->common.color);
 }
 
 
@@ -1560,7 +1377,7 @@ dxf_arc_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        arc->color = color;
+        arc->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1594,13 +1411,13 @@ dxf_arc_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->paperspace < 0)
+        if (arc->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (arc->paperspace > 1)
+        if (arc->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1609,7 +1426,7 @@ dxf_arc_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->paperspace);
+        return (arc->common.paperspace);
 }
 
 
@@ -1655,7 +1472,7 @@ dxf_arc_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        arc->paperspace = paperspace;
+        arc->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1690,13 +1507,13 @@ dxf_arc_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->graphics_data_size < 0)
+        if (arc->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (arc->graphics_data_size == 0)
+        if (arc->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1705,7 +1522,7 @@ dxf_arc_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->graphics_data_size);
+        return (arc->common.cold->graphics_data_size);
 }
 
 
@@ -1751,7 +1568,7 @@ dxf_arc_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        arc->graphics_data_size = graphics_data_size;
+        arc->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1786,13 +1603,13 @@ dxf_arc_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->shadow_mode < 0)
+        if (arc->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (arc->shadow_mode > 3)
+        if (arc->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1801,7 +1618,7 @@ dxf_arc_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->shadow_mode);
+        return (arc->common.cold->shadow_mode);
 }
 
 
@@ -1846,7 +1663,7 @@ dxf_arc_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        arc->shadow_mode = shadow_mode;
+        arc->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1861,11 +1678,12 @@ dxf_arc_set_shadow_mode
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_arc_get_binary_graphics_data.png
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_arc_get_binary_graphics_data
 (
         DxfArc *arc
@@ -1883,17 +1701,10 @@ dxf_arc_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) arc->binary_graphics_data);
+        return (arc->common.cold->binary_graphics_data);
 }
 
 
@@ -1901,20 +1712,23 @@ dxf_arc_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c ARC entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_arc_set_binary_graphics_data.png
  *
- * \return a pointer to \c arc when successful, or \c NULL when an error
- * occurred.
+ * \return a pointer to \c arc when successful, or \c NULL when an
+ * error occurred.
  */
 DxfArc *
 dxf_arc_set_binary_graphics_data
 (
         DxfArc *arc,
                 /*!< a pointer to a DXF \c ARC entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1935,23 +1749,12 @@ dxf_arc_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->binary_graphics_data == NULL)
+        if ((arc->common.cold->binary_graphics_data != NULL)
+          && (arc->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                arc->binary_graphics_data = dxf_binary_data_init (arc->binary_graphics_data);
-                if (arc->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (arc->common.cold->binary_graphics_data);
         }
-        arc->binary_graphics_data = (DxfBinaryData *) data;
+        arc->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1988,17 +1791,10 @@ dxf_arc_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_soft));
+        return (dxf_handle_to_string (arc->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2040,7 +1836,7 @@ dxf_arc_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        arc->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2077,17 +1873,10 @@ dxf_arc_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->object_owner_soft));
+        return (dxf_handle_to_string (arc->common.cold->object_owner_soft));
 }
 
 
@@ -2126,7 +1915,7 @@ dxf_arc_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->object_owner_soft = strdup (object_owner_soft);
+        arc->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2163,17 +1952,10 @@ dxf_arc_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->material));
+        return (dxf_handle_to_string (arc->common.cold->material));
 }
 
 
@@ -2214,7 +1996,7 @@ dxf_arc_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->material = strdup (material);
+        arc->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2251,17 +2033,10 @@ dxf_arc_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_hard));
+        return (dxf_handle_to_string (arc->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2303,7 +2078,7 @@ dxf_arc_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        arc->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2341,7 +2116,7 @@ dxf_arc_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->lineweight);
+        return (arc->common.lineweight);
 }
 
 
@@ -2374,7 +2149,7 @@ dxf_arc_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->lineweight = lineweight;
+        arc->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2409,17 +2184,10 @@ dxf_arc_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->plot_style_name));
+        return (dxf_handle_to_string (arc->common.cold->plot_style_name));
 }
 
 
@@ -2460,7 +2228,7 @@ dxf_arc_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->plot_style_name = strdup (plot_style_name);
+        arc->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2498,7 +2266,7 @@ dxf_arc_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->color_value);
+        return (arc->common.color_value);
 }
 
 
@@ -2531,7 +2299,7 @@ dxf_arc_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->color_value = color_value;
+        arc->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2566,7 +2334,7 @@ dxf_arc_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (arc->color_name ==  NULL)
+        if (arc->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2576,7 +2344,7 @@ dxf_arc_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->color_name));
+        return (strdup (arc->common.cold->color_name));
 }
 
 
@@ -2617,7 +2385,7 @@ dxf_arc_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->color_name = strdup (color_name);
+        arc->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2655,7 +2423,7 @@ dxf_arc_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (arc->transparency);
+        return (arc->common.cold->transparency);
 }
 
 
@@ -2688,7 +2456,7 @@ dxf_arc_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->transparency = transparency;
+        arc->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
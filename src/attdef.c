@@ -40,6 +40,7 @@
 
 
 #include "attdef.h"
+#include "entities.h"
 
 
 /*!
@@ -109,36 +110,27 @@ dxf_attdef_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        attdef->id_code = 0;
-        attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        attdef->layer = strdup (DXF_DEFAULT_LAYER);
-        attdef->elevation = 0.0;
-        attdef->thickness = 0.0;
-        attdef->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        attdef->visibility = DXF_DEFAULT_VISIBILITY;
-        attdef->color = DXF_COLOR_BYLAYER;
-        attdef->paperspace = DXF_MODELSPACE;
-        attdef->graphics_data_size = 0;
-        attdef->shadow_mode = 0;
-        attdef->dictionary_owner_soft = strdup ("");
-        attdef->object_owner_soft = strdup ("");
-        attdef->material = strdup ("");
-        attdef->dictionary_owner_hard = strdup ("");
-        attdef->lineweight = 0.0;
-        attdef->plot_style_name = strdup ("");
-        attdef->color_value = 0;
-        attdef->color_name = strdup ("");
-        attdef->transparency = 0;
+        if (dxf_entity_common_init (&attdef->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         attdef->default_value = strdup ("");
         attdef->tag_value = strdup ("");
         attdef->prompt_value = strdup ("");
         attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
-        attdef->p0->x0 = 0.0;
-        attdef->p0->y0 = 0.0;
-        attdef->p0->z0 = 0.0;
-        attdef->p1->x0 = 0.0;
-        attdef->p1->y0 = 0.0;
-        attdef->p1->z0 = 0.0;
+        attdef->p0 = dxf_point_init (dxf_point_new ());
+        attdef->p1 = dxf_point_init (dxf_point_new ());
+        if ((attdef->p0 == NULL)
+          || (attdef->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         attdef->height = 0.0;
         attdef->rel_x_scale = 0.0;
         attdef->rot_angle = 0.0;
@@ -151,11 +143,6 @@ dxf_attdef_init
         attdef->extr_x0 = 0.0;
         attdef->extr_y0 = 0.0;
         attdef->extr_z0 = 1.0;
-        /* Initialize new structs for the following members later,
-         * when they are required and when we have content. */
-        attdef->binary_graphics_data = NULL;
-        attdef->p0 = NULL;
-        attdef->p1 = NULL;
         attdef->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -187,9 +174,9 @@ dxf_attdef_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -197,8 +184,6 @@ dxf_attdef_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attdef == NULL)
@@ -206,438 +191,144 @@ dxf_attdef_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                attdef = dxf_attdef_init (attdef);
+                attdef = dxf_attdef_init (dxf_attdef_new ());
                 if (attdef == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
                         return (NULL);
                 }
         }
-        if (attdef->binary_graphics_data == NULL)
+        for (;;)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                attdef->binary_graphics_data = dxf_binary_data_init (attdef->binary_graphics_data);
-                if (attdef->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (attdef->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attdef->p0 = dxf_point_init (attdef->p0);
-                if (attdef->p0 == NULL)
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-        }
-        if (attdef->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attdef->p1 = dxf_point_init (attdef->p1);
-                if (attdef->p1 == NULL)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-        }
-        iter310 = (DxfBinaryData *) attdef->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing the attribute
-                         * default value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->default_value);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a tag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->tag_value);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a prompt
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->prompt_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &attdef->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (attdef->elevation = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attribute flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->attr_flags);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->text_flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->hor_align);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * field length value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->field_length);
+                        break;
                 }
-                else if (strcmp (temp_string, "74") == 0)
+                (fp->line_number)++;
+                switch (group_code)
                 {
-                        /* Now follows a string containing the
-                         * vertical alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->vert_align);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbText") != 0)
-                        && (strcmp (temp_string, "AcDbAttributeDefinition") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attdef->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attdef->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attdef->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 1:
+                                free (attdef->default_value);
+                                attdef->default_value = strdup (value);
+                                break;
+                        case 2:
+                                free (attdef->tag_value);
+                                attdef->tag_value = strdup (value);
+                                break;
+                        case 3:
+                                free (attdef->prompt_value);
+                                attdef->prompt_value = strdup (value);
+                                break;
+                        case 7:
+                                free (attdef->text_style);
+                                attdef->text_style = strdup (value);
+                                break;
+                        case 10:
+                                attdef->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                attdef->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                attdef->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                attdef->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                attdef->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                attdef->p1->z0 = atof (value);
+                                break;
+                        case 40:
+                                attdef->height = atof (value);
+                                break;
+                        case 41:
+                                attdef->rel_x_scale = atof (value);
+                                break;
+                        case 50:
+                                attdef->rot_angle = atof (value);
+                                break;
+                        case 51:
+                                attdef->obl_angle = atof (value);
+                                break;
+                        case 70:
+                                attdef->attr_flags = atoi (value);
+                                break;
+                        case 71:
+                                attdef->text_flags = atoi (value);
+                                break;
+                        case 72:
+                                attdef->hor_align = atoi (value);
+                                break;
+                        case 73:
+                                attdef->field_length = atoi (value);
+                                break;
+                        case 74:
+                                attdef->vert_align = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbText") != 0)
+                                  && (strcmp (value, "AcDbAttributeDefinition") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                attdef->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                attdef->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                attdef->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &attdef->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (attdef->linetype, "") == 0)
+        if ((attdef->common.linetype == NULL)
+          || (strcmp (attdef->common.linetype, "") == 0))
         {
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (attdef->common.linetype);
+                attdef->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (attdef->layer, "") == 0)
+        if ((attdef->common.layer == NULL)
+          || (strcmp (attdef->common.layer, "") == 0))
         {
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                free (attdef->common.layer);
+                attdef->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -684,8 +375,8 @@ dxf_attdef_write
         if (strcmp (attdef->tag_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () default tag value string is empty for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attdef->id_code);
+                  (_("Error in %s () default tag value string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
@@ -693,38 +384,38 @@ dxf_attdef_write
         if (strcmp (attdef->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attdef->id_code);
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
                 attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
         }
-        if (strcmp (attdef->linetype, "") == 0)
+        if (strcmp (attdef->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, attdef->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attdef->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (attdef->layer, "") == 0)
+        if (strcmp (attdef->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, attdef->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                attdef->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (attdef->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attdef->id_code);
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -733,8 +424,8 @@ dxf_attdef_write
         if (attdef->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attdef->id_code);
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -742,9 +433,9 @@ dxf_attdef_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (attdef->id_code != -1)
+        if (attdef->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", attdef->id_code);
+                dxf_handle_write (fp, 5, attdef->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -756,91 +447,85 @@ dxf_attdef_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (attdef->dictionary_owner_soft, "") != 0)
+        if ((attdef->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", attdef->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, attdef->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (attdef->dictionary_owner_hard, "") != 0)
+        if ((attdef->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", attdef->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, attdef->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (attdef->object_owner_soft, "") != 0)
+        if ((attdef->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", attdef->object_owner_soft);
+                dxf_handle_write (fp, 330, attdef->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (attdef->paperspace == DXF_PAPERSPACE)
+        if (attdef->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", attdef->layer);
-        if (strcmp (attdef->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", attdef->common.layer);
+        if (strcmp (attdef->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", attdef->linetype);
+                fprintf (fp->fp, "  6\n%s\n", attdef->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (attdef->material, "") != 0))
+          && (attdef->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", attdef->material);
+                dxf_handle_write (fp, 347, attdef->common.cold->material);
         }
-        if (attdef->color != DXF_COLOR_BYLAYER)
+        if (attdef->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", attdef->color);
+                fprintf (fp->fp, " 62\n%hd\n", attdef->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", attdef->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", attdef->common.lineweight);
         }
-        if (attdef->thickness != 0.0)
+        if (attdef->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", attdef->thickness);
+                fprintf (fp->fp, " 39\n%f\n", attdef->common.thickness);
         }
-        if (attdef->linetype_scale != 1.0)
+        if (attdef->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", attdef->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", attdef->common.linetype_scale);
         }
-        if (attdef->visibility != 0)
+        if (attdef->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", attdef->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", attdef->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", attdef->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", attdef->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", attdef->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", attdef->common.cold->graphics_data_size);
 #endif
-                if (attdef->binary_graphics_data != NULL)
+                if (attdef->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) attdef->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, attdef->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", attdef->color_value);
-                fprintf (fp->fp, "430\n%s\n", attdef->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", attdef->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", attdef->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", attdef->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", attdef->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", attdef->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", attdef->shadow_mode);
+                dxf_handle_write (fp, 390, attdef->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", attdef->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -897,8 +582,8 @@ dxf_attdef_write
                         && (attdef->p0->z0 == attdef->p1->z0))
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
-                          __FUNCTION__, dxf_entity_name, attdef->id_code);
+                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %" PRIx64 ".\n")),
+                          __FUNCTION__, dxf_entity_name, attdef->common.id_code);
                         fprintf (stderr,
                           (_("\tdefault justification applied to %s entity.\n")),
                           dxf_entity_name);
@@ -918,6 +603,7 @@ dxf_attdef_write
                 fprintf (fp->fp, "220\n%f\n", attdef->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", attdef->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &attdef->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -958,15 +644,7 @@ dxf_attdef_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (attdef->linetype);
-        free (attdef->layer);
-        dxf_binary_data_free_list (attdef->binary_graphics_data);
-        free (attdef->dictionary_owner_soft);
-        free (attdef->object_owner_soft);
-        free (attdef->material);
-        free (attdef->dictionary_owner_hard);
-        free (attdef->plot_style_name);
-        free (attdef->color_name);
+        dxf_entity_common_free (&attdef->common);
         free (attdef->default_value);
         free (attdef->tag_value);
         free (attdef->prompt_value);
@@ -1006,6 +684,7 @@ dxf_attdef_free_list
         while (attdefs != NULL)
         {
                 DxfAttdef *iter = (DxfAttdef *) attdefs->next;
+                attdefs->next = NULL;
                 dxf_attdef_free (attdefs);
                 attdefs = (DxfAttdef *) iter;
         }
@@ -1015,12 +694,138 @@ dxf_attdef_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c ATTDEF entity.
+ *
+ * The copy does not share any memory with \c attdef, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfAttdef *
+dxf_attdef_copy
+(
+        DxfAttdef *attdef
+                /*!< a pointer to the DXF \c ATTDEF entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAttdef *copy;
+
+        /* Do some basic checks. */
+        if (attdef == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_attdef_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, attdef, sizeof (DxfAttdef));
+        copy->default_value = NULL;
+        copy->tag_value = NULL;
+        copy->prompt_value = NULL;
+        copy->text_style = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &attdef->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_attdef_free (copy);
+                return (NULL);
+        }
+        if (attdef->default_value != NULL)
+        {
+                copy->default_value = strdup (attdef->default_value);
+                if (copy->default_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attdef_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attdef->tag_value != NULL)
+        {
+                copy->tag_value = strdup (attdef->tag_value);
+                if (copy->tag_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attdef_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attdef->prompt_value != NULL)
+        {
+                copy->prompt_value = strdup (attdef->prompt_value);
+                if (copy->prompt_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attdef_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attdef->text_style != NULL)
+        {
+                copy->text_style = strdup (attdef->text_style);
+                if (copy->text_style == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attdef_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attdef->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy_list (attdef->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_attdef_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attdef->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy_list (attdef->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_attdef_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c ATTDEF entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_attdef_get_id_code
 (
         DxfAttdef *attdef
@@ -1038,16 +843,10 @@ dxf_attdef_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->id_code);
+        return (attdef->common.id_code);
 }
 
 
@@ -1059,7 +858,7 @@ dxf_attdef_set_id_code
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1076,13 +875,7 @@ dxf_attdef_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        attdef->id_code = id_code;
+        attdef->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1113,7 +906,7 @@ dxf_attdef_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->linetype ==  NULL)
+        if (attdef->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1123,7 +916,7 @@ dxf_attdef_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->linetype));
+        return (strdup (attdef->common.linetype));
 }
 
 
@@ -1157,7 +950,7 @@ dxf_attdef_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->linetype = strdup (linetype);
+        attdef->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1188,7 +981,7 @@ dxf_attdef_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->layer ==  NULL)
+        if (attdef->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1198,7 +991,7 @@ dxf_attdef_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->layer));
+        return (strdup (attdef->common.layer));
 }
 
 
@@ -1232,7 +1025,7 @@ dxf_attdef_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->layer = strdup (layer);
+        attdef->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1266,7 +1059,7 @@ dxf_attdef_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->elevation);
+        return (attdef->common.elevation);
 }
 
 
@@ -1293,7 +1086,7 @@ dxf_attdef_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->elevation = elevation;
+        attdef->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1324,7 +1117,7 @@ dxf_attdef_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->thickness < 0.0)
+        if (attdef->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1333,7 +1126,7 @@ dxf_attdef_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->thickness);
+        return (attdef->common.thickness);
 }
 
 
@@ -1366,7 +1159,7 @@ dxf_attdef_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->thickness = thickness;
+        attdef->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1397,7 +1190,7 @@ dxf_attdef_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->linetype_scale < 0.0)
+        if (attdef->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1406,7 +1199,7 @@ dxf_attdef_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->linetype_scale);
+        return (attdef->common.linetype_scale);
 }
 
 
@@ -1439,7 +1232,7 @@ dxf_attdef_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->linetype_scale = linetype_scale;
+        attdef->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1470,13 +1263,13 @@ dxf_attdef_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->visibility < 0)
+        if (attdef->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attdef->visibility > 1)
+        if (attdef->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1485,7 +1278,7 @@ dxf_attdef_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->visibility);
+        return (attdef->common.visibility);
 }
 
 
@@ -1524,7 +1317,7 @@ dxf_attdef_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->visibility = visibility;
+        attdef->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1555,7 +1348,7 @@ dxf_attdef_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->color < 0)
+        if (attdef->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1564,7 +1357,7 @@ dxf_attdef_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->color);
+        return (attdef->common.color);
 }
 
 
@@ -1597,7 +1390,7 @@ dxf_attdef_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->color = color;
+        attdef->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1628,13 +1421,13 @@ dxf_attdef_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->paperspace < 0)
+        if (attdef->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attdef->paperspace > 1)
+        if (attdef->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1643,7 +1436,7 @@ dxf_attdef_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->paperspace);
+        return (attdef->common.paperspace);
 }
 
 
@@ -1682,7 +1475,7 @@ dxf_attdef_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->paperspace = paperspace;
+        attdef->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1715,13 +1508,13 @@ dxf_attdef_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->graphics_data_size < 0)
+        if (attdef->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attdef->graphics_data_size == 0)
+        if (attdef->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1730,7 +1523,7 @@ dxf_attdef_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->graphics_data_size);
+        return (attdef->common.cold->graphics_data_size);
 }
 
 
@@ -1774,7 +1567,7 @@ dxf_attdef_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->graphics_data_size = graphics_data_size;
+        attdef->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1806,13 +1599,13 @@ dxf_attdef_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attdef->shadow_mode < 0)
+        if (attdef->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attdef->shadow_mode > 3)
+        if (attdef->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1821,7 +1614,7 @@ dxf_attdef_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->shadow_mode);
+        return (attdef->common.cold->shadow_mode);
 }
 
 
@@ -1863,7 +1656,7 @@ dxf_attdef_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        attdef->shadow_mode = shadow_mode;
+        attdef->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1875,11 +1668,12 @@ dxf_attdef_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c ATTDEF entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_attdef_get_binary_graphics_data
 (
         DxfAttdef *attdef
@@ -1897,32 +1691,31 @@ dxf_attdef_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) attdef->binary_graphics_data);
+        return (attdef->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c ATTDEF entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c attdef when successful, or \c NULL when an
+ * error occurred.
  */
 DxfAttdef *
 dxf_attdef_set_binary_graphics_data
 (
         DxfAttdef *attdef,
                 /*!< a pointer to a DXF \c ATTDEF entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1943,23 +1736,12 @@ dxf_attdef_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->binary_graphics_data == NULL)
+        if ((attdef->common.cold->binary_graphics_data != NULL)
+          && (attdef->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                attdef->binary_graphics_data = dxf_binary_data_init (attdef->binary_graphics_data);
-                if (attdef->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (attdef->common.cold->binary_graphics_data);
         }
-        attdef->binary_graphics_data = (DxfBinaryData *) data;
+        attdef->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1993,17 +1775,10 @@ dxf_attdef_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_soft));
+        return (dxf_handle_to_string (attdef->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2039,7 +1814,7 @@ dxf_attdef_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attdef->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2073,17 +1848,10 @@ dxf_attdef_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->object_owner_soft));
+        return (dxf_handle_to_string (attdef->common.cold->object_owner_soft));
 }
 
 
@@ -2119,7 +1887,7 @@ dxf_attdef_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->object_owner_soft = strdup (object_owner_soft);
+        attdef->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2153,17 +1921,10 @@ dxf_attdef_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->material));
+        return (dxf_handle_to_string (attdef->common.cold->material));
 }
 
 
@@ -2201,7 +1962,7 @@ dxf_attdef_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->material = strdup (material);
+        attdef->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2235,17 +1996,10 @@ dxf_attdef_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_hard));
+        return (dxf_handle_to_string (attdef->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2281,7 +2035,7 @@ dxf_attdef_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attdef->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2316,7 +2070,7 @@ dxf_attdef_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->lineweight);
+        return (attdef->common.lineweight);
 }
 
 
@@ -2346,7 +2100,7 @@ dxf_attdef_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->lineweight = lineweight;
+        attdef->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2378,17 +2132,10 @@ dxf_attdef_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->plot_style_name));
+        return (dxf_handle_to_string (attdef->common.cold->plot_style_name));
 }
 
 
@@ -2426,7 +2173,7 @@ dxf_attdef_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->plot_style_name = strdup (plot_style_name);
+        attdef->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2461,7 +2208,7 @@ dxf_attdef_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->color_value);
+        return (attdef->common.color_value);
 }
 
 
@@ -2491,7 +2238,7 @@ dxf_attdef_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->color_value = color_value;
+        attdef->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2523,7 +2270,7 @@ dxf_attdef_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attdef->color_name ==  NULL)
+        if (attdef->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2533,7 +2280,7 @@ dxf_attdef_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->color_name));
+        return (strdup (attdef->common.cold->color_name));
 }
 
 
@@ -2571,7 +2318,7 @@ dxf_attdef_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->color_name = strdup (color_name);
+        attdef->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2606,7 +2353,7 @@ dxf_attdef_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attdef->transparency);
+        return (attdef->common.cold->transparency);
 }
 
 
@@ -2636,7 +2383,7 @@ dxf_attdef_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->transparency = transparency;
+        attdef->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -40,6 +40,8 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "point.h"
 #include "binary_data.h"
 
@@ -61,132 +63,9 @@ typedef struct
 dxf_attdef_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF attdef. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         char *default_value;
                 /*!< Default value for the attribute.\n
                  * Group code = 1. */
@@ -299,8 +178,9 @@ DxfAttdef *dxf_attdef_read (DxfFile *fp, DxfAttdef *attdef);
 int dxf_attdef_write (DxfFile *fp, DxfAttdef *attdef);
 int dxf_attdef_free (DxfAttdef *attdef);
 void dxf_attdef_free_list (DxfAttdef *attdefs);
-int dxf_attdef_get_id_code (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_id_code (DxfAttdef *attdef, int id_code);
+DxfAttdef *dxf_attdef_copy (DxfAttdef *attdef);
+DxfHandle dxf_attdef_get_id_code (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_id_code (DxfAttdef *attdef, DxfHandle id_code);
 char *dxf_attdef_get_linetype (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_linetype (DxfAttdef *attdef, char *linetype);
 char *dxf_attdef_get_layer (DxfAttdef *attdef);
@@ -321,8 +201,8 @@ int32_t dxf_attdef_get_graphics_data_size (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_graphics_data_size (DxfAttdef *attdef, int32_t graphics_data_size);
 int16_t dxf_attdef_get_shadow_mode (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_shadow_mode (DxfAttdef *attdef, int16_t shadow_mode);
-DxfBinaryData *dxf_attdef_get_binary_graphics_data (DxfAttdef *attdef);
-DxfAttdef *dxf_attdef_set_binary_graphics_data (DxfAttdef *attdef, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_attdef_get_binary_graphics_data (DxfAttdef *attdef);
+DxfAttdef *dxf_attdef_set_binary_graphics_data (DxfAttdef *attdef, DxfBinaryBuffer *data);
 char *dxf_attdef_get_dictionary_owner_soft (DxfAttdef *attdef);
 DxfAttdef *dxf_attdef_set_dictionary_owner_soft (DxfAttdef *attdef, char *dictionary_owner_soft);
 char *dxf_attdef_get_object_owner_soft (DxfAttdef *attdef);
@@ -40,6 +40,7 @@
 
 
 #include "attrib.h"
+#include "entities.h"
 
 
 /*!
@@ -110,35 +111,26 @@ dxf_attrib_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        attrib->id_code = 0;
-        attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+        if (dxf_entity_common_init (&attrib->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
-        attrib->layer = strdup (DXF_DEFAULT_LAYER);
-        attrib->elevation = 0.0;
-        attrib->thickness = 0.0;
-        attrib->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        attrib->visibility = DXF_DEFAULT_VISIBILITY;
-        attrib->color = DXF_COLOR_BYLAYER;
-        attrib->paperspace = DXF_MODELSPACE;
-        attrib->graphics_data_size = 0;
-        attrib->shadow_mode = 0;
-        attrib->dictionary_owner_soft = strdup("");
-        attrib->object_owner_soft = strdup("");
-        attrib->material = strdup("");
-        attrib->dictionary_owner_hard = strdup("");
-        attrib->lineweight = 0;
-        attrib->plot_style_name = strdup ("");
-        attrib->color_value = 0;
-        attrib->color_name = strdup ("");
-        attrib->transparency = 0;
         attrib->default_value = strdup ("");
         attrib->tag_value = strdup ("");
-        attrib->p0->x0 = 0.0;
-        attrib->p0->y0 = 0.0;
-        attrib->p0->z0 = 0.0;
-        attrib->p1->x0 = 0.0;
-        attrib->p1->y0 = 0.0;
-        attrib->p1->z0 = 0.0;
+        attrib->p0 = dxf_point_init (dxf_point_new ());
+        attrib->p1 = dxf_point_init (dxf_point_new ());
+        if ((attrib->p0 == NULL)
+          || (attrib->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         attrib->height = 0.0;
         attrib->rel_x_scale = 0.0;
         attrib->rot_angle = 0.0;
@@ -151,11 +143,6 @@ dxf_attrib_init
         attrib->extr_x0 = 0.0;
         attrib->extr_y0 = 0.0;
         attrib->extr_z0 = 0.0;
-        /* Initialize new structs for the following members later,
-         * when they are required and when we have content. */
-        attrib->binary_graphics_data = NULL;
-        attrib->p0 = NULL;
-        attrib->p1 = NULL;
         attrib->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -187,9 +174,9 @@ dxf_attrib_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -197,8 +184,6 @@ dxf_attrib_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attrib == NULL)
@@ -206,435 +191,144 @@ dxf_attrib_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                attrib = dxf_attrib_init (attrib);
+                attrib = dxf_attrib_init (dxf_attrib_new ());
                 if (attrib == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (attrib->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                attrib->binary_graphics_data = dxf_binary_data_init (attrib->binary_graphics_data);
-                if (attrib->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
                         return (NULL);
                 }
         }
-        if (attrib->p0 == NULL)
+        for (;;)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attrib->p0 = dxf_point_init (attrib->p0);
-                if (attrib->p0 == NULL)
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-        }
-        if (attrib->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attrib->p1 = dxf_point_init (attrib->p1);
-                if (attrib->p1 == NULL)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-        }
-        iter310 = (DxfBinaryData *) attrib->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing the attribute
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->default_value);
-                }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a tag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->tag_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &attrib->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->linetype);
+                        break;
                 }
-                else if (strcmp (temp_string, "7") == 0)
+                (fp->line_number)++;
+                switch (group_code)
                 {
-                        /* Now follows a string containing a text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the align point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (attrib->elevation = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attribute flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->attr_flags);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->text_flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->hor_align);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * field length value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->field_length);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertical alignment value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->vert_align);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbText") != 0)
-                        && (strcmp (temp_string, "AcDbAttribute") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &attrib->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &attrib->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &attrib->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                        case 1:
+                                free (attrib->default_value);
+                                attrib->default_value = strdup (value);
+                                break;
+                        case 2:
+                                free (attrib->tag_value);
+                                attrib->tag_value = strdup (value);
+                                break;
+                        case 7:
+                                free (attrib->text_style);
+                                attrib->text_style = strdup (value);
+                                break;
+                        case 10:
+                                attrib->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                attrib->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                attrib->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                attrib->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                attrib->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                attrib->p1->z0 = atof (value);
+                                break;
+                        case 40:
+                                attrib->height = atof (value);
+                                break;
+                        case 41:
+                                attrib->rel_x_scale = atof (value);
+                                break;
+                        case 50:
+                                attrib->rot_angle = atof (value);
+                                break;
+                        case 51:
+                                attrib->obl_angle = atof (value);
+                                break;
+                        case 70:
+                                attrib->attr_flags = atoi (value);
+                                break;
+                        case 71:
+                                attrib->text_flags = atoi (value);
+                                break;
+                        case 72:
+                                attrib->hor_align = atoi (value);
+                                break;
+                        case 73:
+                                attrib->field_length = atoi (value);
+                                break;
+                        case 74:
+                                attrib->vert_align = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_12)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbText") != 0)
+                                  && (strcmp (value, "AcDbAttribute") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                attrib->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                attrib->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                attrib->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &attrib->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (attrib->linetype, "") == 0)
+        if ((attrib->common.linetype == NULL)
+          || (strcmp (attrib->common.linetype, "") == 0))
         {
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (attrib->common.linetype);
+                attrib->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (attrib->layer, "") == 0)
+        if ((attrib->common.layer == NULL)
+          || (strcmp (attrib->common.layer, "") == 0))
         {
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                free (attrib->common.layer);
+                attrib->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (attrib);
 }
 
 
@@ -677,8 +371,8 @@ dxf_attrib_write
         if (strcmp (attrib->default_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () default value string is empty for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Error in %s () default value string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
@@ -686,8 +380,8 @@ dxf_attrib_write
         if (strcmp (attrib->tag_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () tag value string is empty for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Error in %s () tag value string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
@@ -695,38 +389,38 @@ dxf_attrib_write
         if (strcmp (attrib->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
                 attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
         }
-        if (strcmp (attrib->linetype, "") == 0)
+        if (strcmp (attrib->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                attrib->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (attrib->layer, "") == 0)
+        if (strcmp (attrib->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to the default layer.\n")),
                   dxf_entity_name);
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                attrib->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (attrib->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -735,8 +429,8 @@ dxf_attrib_write
         if (attrib->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, attrib->id_code);
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -744,9 +438,9 @@ dxf_attrib_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (attrib->id_code != -1)
+        if (attrib->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", attrib->id_code);
+                dxf_handle_write (fp, 5, attrib->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -758,97 +452,91 @@ dxf_attrib_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (attrib->dictionary_owner_soft, "") != 0)
+        if ((attrib->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", attrib->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, attrib->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (attrib->dictionary_owner_hard, "") != 0)
+        if ((attrib->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", attrib->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, attrib->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (attrib->object_owner_soft, "") != 0)
+        if ((attrib->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", attrib->object_owner_soft);
+                dxf_handle_write (fp, 330, attrib->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (attrib->paperspace == DXF_PAPERSPACE)
+        if (attrib->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", attrib->layer);
-        if (strcmp (attrib->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", attrib->common.layer);
+        if (strcmp (attrib->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", attrib->linetype);
+                fprintf (fp->fp, "  6\n%s\n", attrib->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (attrib->material, "") != 0))
+          && (attrib->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", attrib->material);
+                dxf_handle_write (fp, 347, attrib->common.cold->material);
         }
-        if (attrib->color != DXF_COLOR_BYLAYER)
+        if (attrib->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", attrib->color);
+                fprintf (fp->fp, " 62\n%hd\n", attrib->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", attrib->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", attrib->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (attrib->elevation != 0.0))
+          && (attrib->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", attrib->elevation);
+                fprintf (fp->fp, " 38\n%f\n", attrib->common.elevation);
         }
-        if (attrib->thickness != 0.0)
+        if (attrib->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", attrib->thickness);
+                fprintf (fp->fp, " 39\n%f\n", attrib->common.thickness);
         }
-        if (attrib->linetype_scale != 1.0)
+        if (attrib->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", attrib->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", attrib->common.linetype_scale);
         }
-        if (attrib->visibility != 0)
+        if (attrib->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", attrib->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", attrib->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", attrib->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", attrib->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", attrib->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", attrib->common.cold->graphics_data_size);
 #endif
-                if (attrib->binary_graphics_data != NULL)
+                if (attrib->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) attrib->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, attrib->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", attrib->color_value);
-                fprintf (fp->fp, "430\n%s\n", attrib->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", attrib->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", attrib->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", attrib->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", attrib->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", attrib->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", attrib->shadow_mode);
+                dxf_handle_write (fp, 390, attrib->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", attrib->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -904,8 +592,8 @@ dxf_attrib_write
                         && (attrib->p0->z0 == attrib->p1->z0))
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
-                          __FUNCTION__, dxf_entity_name, attrib->id_code);
+                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %" PRIx64 ".\n")),
+                          __FUNCTION__, dxf_entity_name, attrib->common.id_code);
                         fprintf (stderr,
                           (_("    default justification applied to %s entity\n")),
                           dxf_entity_name);
@@ -928,6 +616,7 @@ dxf_attrib_write
                 fprintf (fp->fp, "220\n%f\n", attrib->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", attrib->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &attrib->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -968,15 +657,7 @@ dxf_attrib_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (attrib->linetype);
-        free (attrib->layer);
-        dxf_binary_data_free_list (attrib->binary_graphics_data);
-        free (attrib->dictionary_owner_soft);
-        free (attrib->object_owner_soft);
-        free (attrib->material);
-        free (attrib->dictionary_owner_hard);
-        free (attrib->plot_style_name);
-        free (attrib->color_name);
+        dxf_entity_common_free (&attrib->common);
         free (attrib->default_value);
         free (attrib->tag_value);
         free (attrib->text_style);
@@ -1015,6 +696,7 @@ dxf_attrib_free_list
         while (attribs != NULL)
         {
                 DxfAttrib *iter = (DxfAttrib *) attribs->next;
+                attribs->next = NULL;
                 dxf_attrib_free (attribs);
                 attribs = (DxfAttrib *) iter;
         }
@@ -1024,12 +706,125 @@ dxf_attrib_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c ATTRIB entity.
+ *
+ * The copy does not share any memory with \c attrib, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfAttrib *
+dxf_attrib_copy
+(
+        DxfAttrib *attrib
+                /*!< a pointer to the DXF \c ATTRIB entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAttrib *copy;
+
+        /* Do some basic checks. */
+        if (attrib == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_attrib_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, attrib, sizeof (DxfAttrib));
+        copy->default_value = NULL;
+        copy->tag_value = NULL;
+        copy->text_style = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &attrib->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_attrib_free (copy);
+                return (NULL);
+        }
+        if (attrib->default_value != NULL)
+        {
+                copy->default_value = strdup (attrib->default_value);
+                if (copy->default_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attrib_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attrib->tag_value != NULL)
+        {
+                copy->tag_value = strdup (attrib->tag_value);
+                if (copy->tag_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attrib_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attrib->text_style != NULL)
+        {
+                copy->text_style = strdup (attrib->text_style);
+                if (copy->text_style == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_attrib_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attrib->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (attrib->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_attrib_free (copy);
+                        return (NULL);
+                }
+        }
+        if (attrib->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (attrib->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_attrib_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c ATTRIB entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_attrib_get_id_code
 (
         DxfAttrib *attrib
@@ -1047,16 +842,10 @@ dxf_attrib_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->id_code);
+        return (attrib->common.id_code);
 }
 
 
@@ -1068,7 +857,7 @@ dxf_attrib_set_id_code
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1085,13 +874,7 @@ dxf_attrib_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        attrib->id_code = id_code;
+        attrib->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1122,7 +905,7 @@ dxf_attrib_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->linetype ==  NULL)
+        if (attrib->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1132,7 +915,7 @@ dxf_attrib_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->linetype));
+        return (strdup (attrib->common.linetype));
 }
 
 
@@ -1166,7 +949,7 @@ dxf_attrib_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->linetype = strdup (linetype);
+        attrib->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1197,7 +980,7 @@ dxf_attrib_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->layer ==  NULL)
+        if (attrib->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1207,7 +990,7 @@ dxf_attrib_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->layer));
+        return (strdup (attrib->common.layer));
 }
 
 
@@ -1241,7 +1024,7 @@ dxf_attrib_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->layer = strdup (layer);
+        attrib->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1275,7 +1058,7 @@ dxf_attrib_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->elevation);
+        return (attrib->common.elevation);
 }
 
 
@@ -1302,7 +1085,7 @@ dxf_attrib_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->elevation = elevation;
+        attrib->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1333,7 +1116,7 @@ dxf_attrib_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->thickness < 0.0)
+        if (attrib->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1342,7 +1125,7 @@ dxf_attrib_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->thickness);
+        return (attrib->common.thickness);
 }
 
 
@@ -1375,7 +1158,7 @@ dxf_attrib_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        attrib->thickness = thickness;
+        attrib->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1406,7 +1189,7 @@ dxf_attrib_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->linetype_scale < 0.0)
+        if (attrib->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1415,7 +1198,7 @@ dxf_attrib_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->linetype_scale);
+        return (attrib->common.linetype_scale);
 }
 
 
@@ -1448,7 +1231,7 @@ dxf_attrib_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        attrib->linetype_scale = linetype_scale;
+        attrib->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1479,13 +1262,13 @@ dxf_attrib_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->visibility < 0)
+        if (attrib->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attrib->visibility > 1)
+        if (attrib->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1494,7 +1277,7 @@ dxf_attrib_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->visibility);
+        return (attrib->common.visibility);
 }
 
 
@@ -1533,7 +1316,7 @@ dxf_attrib_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        attrib->visibility = visibility;
+        attrib->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1564,7 +1347,7 @@ dxf_attrib_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->color < 0)
+        if (attrib->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1573,7 +1356,7 @@ dxf_attrib_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->color);
+        return (attrib->common.color);
 }
 
 
@@ -1608,7 +1391,7 @@ dxf_attrib_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        attrib->color = color;
+        attrib->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1639,13 +1422,13 @@ dxf_attrib_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->paperspace < 0)
+        if (attrib->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attrib->paperspace > 1)
+        if (attrib->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1654,7 +1437,7 @@ dxf_attrib_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->paperspace);
+        return (attrib->common.paperspace);
 }
 
 
@@ -1693,7 +1476,7 @@ dxf_attrib_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        attrib->paperspace = paperspace;
+        attrib->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1726,13 +1509,13 @@ dxf_attrib_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->graphics_data_size < 0)
+        if (attrib->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attrib->graphics_data_size == 0)
+        if (attrib->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1741,7 +1524,7 @@ dxf_attrib_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->graphics_data_size);
+        return (attrib->common.cold->graphics_data_size);
 }
 
 
@@ -1785,7 +1568,7 @@ dxf_attrib_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        attrib->graphics_data_size = graphics_data_size;
+        attrib->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1817,13 +1600,13 @@ dxf_attrib_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (attrib->shadow_mode < 0)
+        if (attrib->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (attrib->shadow_mode > 3)
+        if (attrib->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1832,7 +1615,7 @@ dxf_attrib_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->shadow_mode);
+        return (attrib->common.cold->shadow_mode);
 }
 
 
@@ -1874,7 +1657,7 @@ dxf_attrib_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        attrib->shadow_mode = shadow_mode;
+        attrib->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1886,11 +1669,12 @@ dxf_attrib_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c ATTRIB entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_attrib_get_binary_graphics_data
 (
         DxfAttrib *attrib
@@ -1908,32 +1692,31 @@ dxf_attrib_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) attrib->binary_graphics_data);
+        return (attrib->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c ATTRIB entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c attrib when successful, or \c NULL when an
+ * error occurred.
  */
 DxfAttrib *
 dxf_attrib_set_binary_graphics_data
 (
         DxfAttrib *attrib,
                 /*!< a pointer to a DXF \c ATTRIB entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1954,23 +1737,12 @@ dxf_attrib_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->binary_graphics_data == NULL)
+        if ((attrib->common.cold->binary_graphics_data != NULL)
+          && (attrib->common.cold->binary_graphics_data != data))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                attrib->binary_graphics_data = dxf_binary_data_init (attrib->binary_graphics_data);
-                if (attrib->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                dxf_binary_buffer_free (attrib->common.cold->binary_graphics_data);
         }
-        attrib->binary_graphics_data = (DxfBinaryData *) data;
+        attrib->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2004,17 +1776,10 @@ dxf_attrib_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_soft));
+        return (dxf_handle_to_string (attrib->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2050,7 +1815,7 @@ dxf_attrib_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attrib->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2084,17 +1849,10 @@ dxf_attrib_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->object_owner_soft));
+        return (dxf_handle_to_string (attrib->common.cold->object_owner_soft));
 }
 
 
@@ -2130,7 +1888,7 @@ dxf_attrib_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->object_owner_soft = strdup (object_owner_soft);
+        attrib->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2164,17 +1922,10 @@ dxf_attrib_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->material));
+        return (dxf_handle_to_string (attrib->common.cold->material));
 }
 
 
@@ -2212,7 +1963,7 @@ dxf_attrib_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->material = strdup (material);
+        attrib->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2246,17 +1997,10 @@ dxf_attrib_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_hard));
+        return (dxf_handle_to_string (attrib->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2292,7 +2036,7 @@ dxf_attrib_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attrib->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2327,7 +2071,7 @@ dxf_attrib_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->lineweight);
+        return (attrib->common.lineweight);
 }
 
 
@@ -2357,7 +2101,7 @@ dxf_attrib_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->lineweight = lineweight;
+        attrib->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2389,17 +2133,10 @@ dxf_attrib_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->plot_style_name));
+        return (dxf_handle_to_string (attrib->common.cold->plot_style_name));
 }
 
 
@@ -2437,7 +2174,7 @@ dxf_attrib_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->plot_style_name = strdup (plot_style_name);
+        attrib->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2472,7 +2209,7 @@ dxf_attrib_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->color_value);
+        return (attrib->common.color_value);
 }
 
 
@@ -2502,7 +2239,7 @@ dxf_attrib_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->color_value = color_value;
+        attrib->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2534,7 +2271,7 @@ dxf_attrib_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (attrib->color_name ==  NULL)
+        if (attrib->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2544,7 +2281,7 @@ dxf_attrib_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->color_name));
+        return (strdup (attrib->common.cold->color_name));
 }
 
 
@@ -2582,7 +2319,7 @@ dxf_attrib_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->color_name = strdup (color_name);
+        attrib->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2617,7 +2354,7 @@ dxf_attrib_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (attrib->transparency);
+        return (attrib->common.cold->transparency);
 }
 
 
@@ -2647,7 +2384,7 @@ dxf_attrib_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->transparency = transparency;
+        attrib->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -34,6 +34,37 @@
 
 
 #include "binary_data.h"
+#include "entities.h"
+
+
+/*!
+ * \brief Lookup table for decoding hexadecimal characters.
+ *
+ * Maps a character to its value (0 - 15), all other characters map to
+ * 0xff, so a pair of characters is decoded with two lookups and a single
+ * validity test.
+ */
+static const unsigned char dxf_binary_buffer_hex_values[256] =
+{
+#define X 0xff
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, X, X, X, X, X, X,
+        X, 10, 11, 12, 13, 14, 15, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, 10, 11, 12, 13, 14, 15, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+        X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X
+#undef X
+};
 
 
 /*!
@@ -217,6 +248,7 @@ dxf_binary_data_free_list
         while (data != NULL)
         {
                 DxfBinaryData *iter = (DxfBinaryData *) data->next;
+                data->next = NULL;
                 dxf_binary_data_free (data);
                 data = (DxfBinaryData *) iter;
         }
@@ -226,6 +258,77 @@ dxf_binary_data_free_list
 }
 
 
+/*!
+ * \brief Copy a single linked list of DxfBinaryData objects.
+ *
+ * The copy does not share any memory with \c data.
+ *
+ * \return a pointer to the first item of the copy, or \c NULL when an
+ * error occurred.
+ */
+DxfBinaryData *
+dxf_binary_data_copy_list
+(
+        DxfBinaryData *data
+                /*!< a pointer to the single linked list of DxfBinaryData
+                 * objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryData *first = NULL;
+        DxfBinaryData *last = NULL;
+        DxfBinaryData *copy;
+
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (; data != NULL; data = (DxfBinaryData *) data->next)
+        {
+                copy = dxf_binary_data_new ();
+                if (copy != NULL)
+                {
+                        memcpy (copy, data, sizeof (DxfBinaryData));
+                        copy->data_line = NULL;
+                        copy->next = NULL;
+                }
+                if ((copy == NULL)
+                  || ((data->data_line != NULL)
+                  && ((copy->data_line = strdup (data->data_line)) == NULL)))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (copy);
+                        if (first != NULL)
+                        {
+                                dxf_binary_data_free_list (first);
+                        }
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        first = copy;
+                }
+                else
+                {
+                        last->next = (struct DxfBinaryData *) copy;
+                }
+                last = copy;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
 /*!
  * \brief Get the \c order from a binary data object.
  *
@@ -579,4 +682,617 @@ dxf_binary_data_get_last
 }
 
 
+/*!
+ * \brief Append a \c DxfBinaryData object (or a chain of
+ * \c DxfBinaryData objects) to a single linked list of binary data
+ * lines in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_binary_data_get_last ().\n
+ * The \c order member of the appended objects is set to follow the
+ * \c order of \c last.
+ *
+ * \return a pointer to the new last \c DxfBinaryData object of the
+ * list, or \c NULL when an error occurred.
+ */
+DxfBinaryData *
+dxf_binary_data_append
+(
+        DxfBinaryData *last,
+                /*!< a pointer to the last \c DxfBinaryData object of
+                 * the list, or \c NULL for an empty list. */
+        DxfBinaryData *data
+                /*!< a pointer to the \c DxfBinaryData object to
+                 * append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int order;
+
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        order = 0;
+        if (last != NULL)
+        {
+                last->next = (struct DxfBinaryData *) data;
+                order = last->order + 1;
+        }
+        data->order = order;
+        while (data->next != NULL)
+        {
+                data = (DxfBinaryData *) data->next;
+                data->order = ++order;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data);
+}
+
+
+/*!
+ * \brief Allocate memory for a decoded binary data buffer.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfBinaryBuffer *
+dxf_binary_buffer_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryBuffer *buffer = NULL;
+        size_t size;
+
+        size = sizeof (DxfBinaryBuffer);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((buffer = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                buffer = NULL;
+        }
+        else
+        {
+                memset (buffer, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a decoded binary
+ * data buffer.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfBinaryBuffer *
+dxf_binary_buffer_init
+(
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                buffer = dxf_binary_buffer_new ();
+        }
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        buffer->data = NULL;
+        buffer->length = 0;
+        buffer->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Make sure a decoded binary data buffer can hold at least
+ * \c capacity bytes without reallocating.
+ *
+ * Use this when the number of bytes is known in advance (e.g. from
+ * group code 90 or 92).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_buffer_reserve
+(
+        DxfBinaryBuffer *buffer,
+                /*!< a pointer to the decoded binary data buffer. */
+        size_t capacity
+                /*!< the number of bytes to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        unsigned char *data = NULL;
+
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (capacity > buffer->capacity)
+        {
+                data = realloc (buffer->data, capacity);
+                if (data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                buffer->data = data;
+                buffer->capacity = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Decode a string of hexadecimal characters and append the
+ * resulting bytes to a decoded binary data buffer.
+ *
+ * Trailing white space (e.g. a carriage return) is ignored.\n
+ * A character which is not a hexadecimal digit, or an odd number of
+ * hexadecimal digits, is an error and leaves the buffer unchanged, so
+ * corrupt data is never silently truncated.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_buffer_append_hex
+(
+        DxfBinaryBuffer *buffer,
+                /*!< a pointer to the decoded binary data buffer. */
+        const char *hex,
+                /*!< the hexadecimal characters to decode. */
+        size_t length
+                /*!< the number of characters in \c hex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const unsigned char *src;
+        unsigned char *dst;
+        unsigned char high;
+        unsigned char low;
+        size_t capacity;
+        size_t i;
+
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (hex == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        src = (const unsigned char *) hex;
+        while ((length > 0) && isspace (src[length - 1]))
+        {
+                length--;
+        }
+        if (length % 2 != 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an odd number of hexadecimal digits was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (buffer->length + (length / 2) > buffer->capacity)
+        {
+                capacity = (buffer->capacity > 0) ? buffer->capacity : 256;
+                while (capacity < buffer->length + (length / 2))
+                {
+                        capacity *= 2;
+                }
+                if (dxf_binary_buffer_reserve (buffer, capacity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        dst = buffer->data + buffer->length;
+        for (i = 0; i < length; i += 2)
+        {
+                high = dxf_binary_buffer_hex_values[src[i]];
+                low = dxf_binary_buffer_hex_values[src[i + 1]];
+                if ((high | low) & 0xf0)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () an invalid hexadecimal digit was found at position %lu.\n")),
+                          __FUNCTION__, (unsigned long) (((high & 0xf0) ? i : i + 1) + 1));
+                        return (EXIT_FAILURE);
+                }
+                *dst++ = (unsigned char) ((high << 4) | low);
+        }
+        buffer->length = dst - buffer->data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Decode all binary data lines of a single linked list of binary
+ * data objects into a decoded binary data buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_buffer_append_list
+(
+        DxfBinaryBuffer *buffer,
+                /*!< a pointer to the decoded binary data buffer. */
+        DxfBinaryData *data
+                /*!< a pointer to the first binary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryData *iter = NULL;
+
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = data; iter != NULL; iter = (DxfBinaryData *) iter->next)
+        {
+                if (iter->data_line == NULL)
+                {
+                        continue;
+                }
+                if (dxf_binary_buffer_append_hex (buffer, iter->data_line,
+                  strlen (iter->data_line)) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a binary chunk record value from a DXF file and append the
+ * decoded bytes to a decoded binary data buffer.
+ *
+ * The last line read from file contained the group code (310 or 1004),
+ * the next line contains the hexadecimal data.\n
+ * The whole line is consumed, also when it contains invalid data, so
+ * the caller stays in sync with the group code / value pairs.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_buffer_read_line
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char hex[DXF_MAX_STRING_LENGTH];
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        (fp->line_number)++;
+        if (dxf_entities_get_line (fp->fp, hex, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_binary_buffer_append_hex (buffer, hex, strlen (hex)) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () invalid binary data in: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a decoded binary data buffer.
+ *
+ * The bytes are encoded as hexadecimal binary chunk records of
+ * \c DXF_BINARY_BUFFER_BYTES_PER_LINE bytes maximum.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_buffer_write
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        int group_code,
+                /*!< group code of the binary chunk records, 310 or
+                 * 1004. */
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const char digits[] = "0123456789ABCDEF";
+        char hex[(2 * DXF_BINARY_BUFFER_BYTES_PER_LINE) + 1];
+        size_t i;
+        size_t j;
+        size_t n;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < buffer->length; i += n)
+        {
+                n = buffer->length - i;
+                if (n > DXF_BINARY_BUFFER_BYTES_PER_LINE)
+                {
+                        n = DXF_BINARY_BUFFER_BYTES_PER_LINE;
+                }
+                for (j = 0; j < n; j++)
+                {
+                        hex[2 * j] = digits[buffer->data[i + j] >> 4];
+                        hex[(2 * j) + 1] = digits[buffer->data[i + j] & 0x0f];
+                }
+                hex[2 * n] = '\0';
+                fprintf (fp->fp, "%d\n%s\n", group_code, hex);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the decoded bytes from a decoded binary data buffer.
+ *
+ * \warning No copy is made, the returned pointer is invalidated when
+ * more data is appended to the buffer.
+ *
+ * \return a pointer to the bytes, or \c NULL when the buffer is empty
+ * or an error occurred.
+ */
+unsigned char *
+dxf_binary_buffer_get_data
+(
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer->data);
+}
+
+
+/*!
+ * \brief Get the number of decoded bytes in a decoded binary data
+ * buffer.
+ *
+ * \return the number of bytes, or 0 when an error occurred.
+ */
+size_t
+dxf_binary_buffer_get_length
+(
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer->length);
+}
+
+
+/*!
+ * \brief Copy a decoded binary data buffer.
+ *
+ * The copy does not share any memory with \c buffer.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfBinaryBuffer *
+dxf_binary_buffer_copy
+(
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryBuffer *copy = NULL;
+
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (buffer->length > 0)
+        {
+                if (dxf_binary_buffer_reserve (copy, buffer->length) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_binary_buffer_free (copy);
+                        return (NULL);
+                }
+                memcpy (copy->data, buffer->data, buffer->length);
+        }
+        copy->length = buffer->length;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a decoded binary data buffer and
+ * its data.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_buffer_free
+(
+        DxfBinaryBuffer *buffer
+                /*!< a pointer to the decoded binary data buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (buffer->data);
+        free (buffer);
+        buffer = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
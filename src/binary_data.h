@@ -45,6 +45,11 @@ extern "C" {
 #endif
 
 
+#define DXF_BINARY_BUFFER_BYTES_PER_LINE 127
+        /*!< \brief Maximum number of bytes written per binary chunk
+         * record (254 hexadecimal characters). */
+
+
 /*!
  * \brief DXF definition of an AutoCAD binary data object.
  */
@@ -67,11 +72,31 @@ dxf_binary_data_struct
 } DxfBinaryData;
 
 
+/*!
+ * \brief DXF definition of a decoded binary data buffer.
+ *
+ * The hexadecimal strings of a run of binary chunk records (group code
+ * 310 or 1004) are decoded into one contiguous buffer of bytes, which
+ * takes half the memory of the hexadecimal representation.
+ */
+typedef struct
+dxf_binary_buffer_struct
+{
+        unsigned char *data;
+                /*!< Contiguous decoded binary data. */
+        size_t length;
+                /*!< Number of bytes in use in \c data. */
+        size_t capacity;
+                /*!< Number of bytes allocated for \c data. */
+} DxfBinaryBuffer;
+
+
 DxfBinaryData *dxf_binary_data_new ();
 DxfBinaryData *dxf_binary_data_init (DxfBinaryData *data);
 int dxf_binary_data_write (DxfFile *fp, DxfBinaryData *data);
 int dxf_binary_data_free (DxfBinaryData *data);
 void dxf_binary_data_free_list (DxfBinaryData *data);
+DxfBinaryData *dxf_binary_data_copy_list (DxfBinaryData *data);
 int dxf_binary_data_get_order (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_order (DxfBinaryData *data, int order);
 char *dxf_binary_data_get_data_line (DxfBinaryData *data);
@@ -81,6 +106,18 @@ DxfBinaryData *dxf_binary_data_set_length (DxfBinaryData *data, int length);
 DxfBinaryData *dxf_binary_data_get_next (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_next (DxfBinaryData *data, DxfBinaryData *next);
 DxfBinaryData *dxf_binary_data_get_last (DxfBinaryData *data);
+DxfBinaryData *dxf_binary_data_append (DxfBinaryData *last, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_binary_buffer_new ();
+DxfBinaryBuffer *dxf_binary_buffer_init (DxfBinaryBuffer *buffer);
+int dxf_binary_buffer_reserve (DxfBinaryBuffer *buffer, size_t capacity);
+int dxf_binary_buffer_append_hex (DxfBinaryBuffer *buffer, const char *hex, size_t length);
+int dxf_binary_buffer_append_list (DxfBinaryBuffer *buffer, DxfBinaryData *data);
+int dxf_binary_buffer_read_line (DxfFile *fp, DxfBinaryBuffer *buffer);
+int dxf_binary_buffer_write (DxfFile *fp, int group_code, DxfBinaryBuffer *buffer);
+unsigned char *dxf_binary_buffer_get_data (DxfBinaryBuffer *buffer);
+size_t dxf_binary_buffer_get_length (DxfBinaryBuffer *buffer);
+DxfBinaryBuffer *dxf_binary_buffer_copy (DxfBinaryBuffer *buffer);
+int dxf_binary_buffer_free (DxfBinaryBuffer *buffer);
 
 
 #ifdef __cplusplus
@@ -216,6 +216,7 @@ dxf_binary_entity_data_free_list
         while (data != NULL)
         {
                 DxfBinaryEntityData *iter = (DxfBinaryEntityData *) data->next;
+                data->next = NULL;
                 dxf_binary_entity_data_free (data);
                 data = (DxfBinaryEntityData *) iter;
         }
@@ -216,6 +216,7 @@ dxf_binary_graphics_data_free_list
         while (data != NULL)
         {
                 DxfBinaryGraphicsData *iter = (DxfBinaryGraphicsData *) data->next;
+                data->next = NULL;
                 dxf_binary_graphics_data_free (data);
                 data = (DxfBinaryGraphicsData *) iter;
         }
@@ -42,6 +42,7 @@
 
 
 #include "block.h"
+#include "entities.h"
 
 
 /*!
@@ -135,8 +136,9 @@ dxf_block_init
         block->extr_x0 = 0.0;
         block->extr_y0 = 0.0;
         block->extr_z0 = 0.0;
-        block->object_owner_soft = strdup ("");
+        block->object_owner_soft = DXF_HANDLE_NONE;
         block->endblk = (struct DxfEndblk *) dxf_endblk_new ();
+        block->entities = NULL;
         block->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -231,7 +233,7 @@ dxf_block_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        fscanf (fp->fp, "%x\n", &block->id_code);
+                        block->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
@@ -309,7 +311,7 @@ dxf_block_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->object_owner_soft);
+                        block->object_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -331,7 +333,7 @@ dxf_block_read
          */
         if (strcmp (block->block_name, "") == 0)
         {
-                sprintf (block->block_name, "%i", block->id_code);
+                sprintf (block->block_name, "%" PRIu64, block->id_code);
         }
         if (strcmp (block->layer, "") == 0)
         {
@@ -398,7 +400,7 @@ dxf_block_write
         if (block->block_name == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty block name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty block name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -410,7 +412,7 @@ dxf_block_write
         if (block->endblk == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () NULL pointer to endblk was passed or the %s entity with id-code: %x\n")),
+                  (_("Error in %s () NULL pointer to endblk was passed or the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -425,7 +427,7 @@ dxf_block_write
           || (block->block_type != 32)))
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty xref path name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty xref path name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -437,33 +439,33 @@ dxf_block_write
         if (block->description == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 block->description = strdup ("");
         }
         if (strcmp (block->layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
                 block->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (block->object_owner_soft == NULL)
+        if (block->object_owner_soft == DXF_HANDLE_NONE)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () NULL pointer to soft owner object string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () NULL pointer to soft owner object string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
-                block->object_owner_soft = strdup ("");
+                block->object_owner_soft = DXF_HANDLE_NONE;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         if ((fp->acad_version_number >= AutoCAD_13)
-          && (block->id_code != -1))
+          && (block->id_code != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "  5\n%x\n", block->id_code);
+                dxf_handle_write (fp, 5, block->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -475,10 +477,10 @@ dxf_block_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (block->object_owner_soft, "") != 0)
+        if ((block->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "330\n%s\n", block->object_owner_soft);
+                dxf_handle_write (fp, 330, block->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -520,6 +522,197 @@ dxf_block_write
 }
 
 
+/*!
+ * \brief Read a DXF \c BLOCKS section into a list of block definitions.
+ *
+ * The file is expected to be positioned just after the
+ * "  2\nBLOCKS" lines.\n
+ * The group codes of each \c BLOCK are stored in a new \c DxfBlock, the
+ * entities of the block are scanned with dxf_entities_scan () into
+ * \c entities (type, handle, layer, referenced block name and byte
+ * range), and the group codes of the \c ENDBLK marker are stored in
+ * \c endblk, up to and including the \c ENDSEC marker.\n
+ * The \c source of the scanned entities is left \c NULL, all blocks
+ * share \c fp and it is not closed by dxf_block_free ().
+ *
+ * \return a pointer to the first block definition in the list, or
+ * \c NULL when the section is empty or an error occurred.
+ */
+DxfBlock *
+dxf_block_read_table
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *blocks = NULL;
+        DxfBlock *block = NULL;
+        DxfBlock *last = NULL;
+        DxfEndblk *endblk = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char **string;
+        long offset;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (;;)
+        {
+                offset = ftell (fp->fp);
+                if ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                  || (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                fp->line_number += 2;
+                if (atoi (code) == 0)
+                {
+                        if ((block != NULL) && (block->entities == NULL))
+                        {
+                                /* The header of the block ends here,
+                                 * scan the entities of the block. */
+                                fseek (fp->fp, offset, SEEK_SET);
+                                fp->line_number -= 2;
+                                block->entities = (struct dxf_entities_struct *) dxf_entities_new ();
+                                if ((block->entities == NULL)
+                                  || (dxf_entities_scan (fp, (DxfEntities *) block->entities) == EXIT_FAILURE))
+                                {
+                                        break;
+                                }
+                                endblk = (DxfEndblk *) block->endblk;
+                                continue;
+                        }
+                        endblk = NULL;
+                        if (strcmp (value, "ENDSEC") == 0)
+                        {
+                                break;
+                        }
+                        if (strcmp (value, "BLOCK") != 0)
+                        {
+                                fprintf (stderr,
+                                  (_("Warning in %s () unexpected string encountered while reading line %d from: %s.\n")),
+                                  __FUNCTION__, fp->line_number, fp->filename);
+                                block = NULL;
+                                continue;
+                        }
+                        block = dxf_block_init (dxf_block_new ());
+                        if (block == NULL)
+                        {
+                                break;
+                        }
+                        if (last == NULL)
+                        {
+                                blocks = block;
+                        }
+                        else
+                        {
+                                last->next = (struct DxfBlock *) block;
+                        }
+                        last = block;
+                        continue;
+                }
+                if (endblk != NULL)
+                {
+                        /* Group codes of the ENDBLK marker. */
+                        string = NULL;
+                        switch (atoi (code))
+                        {
+                                case 5:
+                                        endblk->id_code = dxf_handle_parse (value);
+                                        break;
+                                case 8:
+                                        string = &endblk->layer;
+                                        break;
+                                case 330:
+                                        endblk->object_owner_soft = dxf_handle_parse (value);
+                                        break;
+                                default:
+                                        break;
+                        }
+                        if (string != NULL)
+                        {
+                                free (*string);
+                                *string = strdup (value);
+                        }
+                        continue;
+                }
+                if (block == NULL)
+                {
+                        continue;
+                }
+                string = NULL;
+                switch (atoi (code))
+                {
+                        case 1:
+                                string = &block->xref_name;
+                                break;
+                        case 2:
+                                string = &block->block_name;
+                                break;
+                        case 3:
+                                string = &block->block_name_additional;
+                                break;
+                        case 4:
+                                string = &block->description;
+                                break;
+                        case 5:
+                                block->id_code = dxf_handle_parse (value);
+                                break;
+                        case 8:
+                                string = &block->layer;
+                                break;
+                        case 10:
+                                block->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                block->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                block->p0->z0 = atof (value);
+                                break;
+                        case 70:
+                                block->block_type = atoi (value);
+                                break;
+                        case 210:
+                                block->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                block->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                block->extr_z0 = atof (value);
+                                break;
+                        case 330:
+                                block->object_owner_soft = dxf_handle_parse (value);
+                                break;
+                        default:
+                                break;
+                }
+                if (string != NULL)
+                {
+                        free (*string);
+                        *string = strdup (value);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (blocks);
+}
+
+
 /*!
  * \brief Write DXF output to a file for a list of block definitions.
  *
@@ -591,7 +784,18 @@ dxf_block_free
         free (block->block_name_additional);
         free (block->description);
         free (block->layer);
-        free (block->object_owner_soft);
+        if (block->p0 != NULL)
+        {
+                dxf_point_free (block->p0);
+        }
+        if (block->endblk != NULL)
+        {
+                dxf_endblk_free ((DxfEndblk *) block->endblk);
+        }
+        if (block->entities != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) block->entities);
+        }
         free (block);
         block = NULL;
 #if DEBUG
@@ -625,6 +829,7 @@ dxf_block_free_list
         while (blocks != NULL)
         {
                 DxfBlock *iter = (DxfBlock *) blocks->next;
+                blocks->next = NULL;
                 dxf_block_free (blocks);
                 blocks = (DxfBlock *) iter;
         }
@@ -951,7 +1156,7 @@ dxf_block_set_description
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_block_get_id_code
 (
         DxfBlock *block
@@ -969,12 +1174,6 @@ dxf_block_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (block->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -990,7 +1189,7 @@ dxf_block_set_id_code
 (
         DxfBlock *block,
                 /*!< a pointer to a DXF \c BLOCK entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1007,12 +1206,6 @@ dxf_block_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         block->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1992,17 +2185,10 @@ dxf_block_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (block->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->object_owner_soft));
+        return (dxf_handle_to_string (block->object_owner_soft));
 }
 
 
@@ -2038,7 +2224,7 @@ dxf_block_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        block->object_owner_soft = strdup (object_owner_soft);
+        block->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "util.h"
 #include "endblk.h"
 #include "point.h"
@@ -91,7 +92,7 @@ dxf_block_struct
         char *description;
                 /*!< Block description (optional).\n
                  * Group code = 4. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -130,11 +131,15 @@ dxf_block_struct
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if omitted in the DXF file.\n
                  * Group code = 230. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object.\n
                  * Group code = 330. */
         struct DxfEndblk *endblk;
                 /*!< pointer to the end of block marker. */
+        struct dxf_entities_struct *entities;
+                /*!< Entities of the block definition, as scanned by
+                 * dxf_entities_scan ().\n
+                 * \c NULL when the block was not read from a file. */
         struct DxfBlock *next;
                 /*!< pointer to the next DxfBlock.\n
                  * \c NULL in the last DxfBlock. */
@@ -142,11 +147,19 @@ dxf_block_struct
 } DxfBlock;
 
 
+/*!
+ * \brief Block definitions read from the \c BLOCKS section by
+ * dxf_section_read (), owned by the caller.
+ */
+extern DxfBlock *dxf_blocks_list;
+
+
 DxfBlock *dxf_block_new ();
 DxfBlock *dxf_block_init (DxfBlock *block);
 DxfBlock *dxf_block_read (DxfFile *fp, DxfBlock *block);
 int dxf_block_write (DxfFile *fp, DxfBlock *block);
 int dxf_block_write_endblk (DxfFile *fp);
+DxfBlock *dxf_block_read_table (DxfFile *fp);
 int dxf_block_write_table (DxfFile *fp, DxfBlock *blocks_list);
 int dxf_block_free (DxfBlock *block);
 void dxf_block_free_list (DxfBlock *blocks);
@@ -158,8 +171,8 @@ char *dxf_block_get_block_name_additional (DxfBlock *block);
 DxfBlock *dxf_block_set_block_name_additional (DxfBlock *block, char *block_name_additional);
 char *dxf_block_get_description (DxfBlock *block);
 DxfBlock *dxf_block_set_description (DxfBlock *block, char *description);
-int dxf_block_get_id_code (DxfBlock *block);
-DxfBlock *dxf_block_set_id_code (DxfBlock *block, int id_code);
+DxfHandle dxf_block_get_id_code (DxfBlock *block);
+DxfBlock *dxf_block_set_id_code (DxfBlock *block, DxfHandle id_code);
 char *dxf_block_get_layer (DxfBlock *block);
 DxfBlock *dxf_block_set_layer (DxfBlock *block, char *layer);
 DxfPoint *dxf_block_get_p0 (DxfBlock *block);
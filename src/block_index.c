@@ -0,0 +1,1109 @@
+/*!
+ * \file block_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a block name index with reference counts.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "block_index.h"
+
+
+/*!
+ * \brief Hash a block name.
+ *
+ * Block names are not case sensitive, so the name is folded to upper
+ * case first.
+ */
+static unsigned int
+dxf_block_index_hash
+(
+        const char *block_name
+                /*!< a block name. */
+)
+{
+        unsigned int hash = 2166136261u;
+
+        while (*block_name != '\0')
+        {
+                hash ^= (unsigned char) toupper ((unsigned char) *block_name);
+                hash *= 16777619u;
+                block_name++;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Compare two block names, not case sensitive.
+ *
+ * \return \c TRUE when the names are equal, \c FALSE otherwise.
+ */
+static int
+dxf_block_index_equal
+(
+        const char *name_1,
+                /*!< a block name. */
+        const char *name_2
+                /*!< another block name. */
+)
+{
+        while ((*name_1 != '\0')
+          && (toupper ((unsigned char) *name_1) == toupper ((unsigned char) *name_2)))
+        {
+                name_1++;
+                name_2++;
+        }
+        return (*name_1 == *name_2);
+}
+
+
+/*!
+ * \brief Test if a block name is the name of a layout block
+ * (\c *Model_Space or \c *Paper_Space with an optional number).
+ *
+ * \return \c TRUE when it is, \c FALSE otherwise.
+ */
+static int
+dxf_block_index_is_layout
+(
+        const char *block_name
+                /*!< a block name. */
+)
+{
+        return ((strncasecmp (block_name, "*Model_Space", 12) == 0)
+          || (strncasecmp (block_name, "*Paper_Space", 12) == 0)
+          || (strncasecmp (block_name, "$Model_Space", 12) == 0)
+          || (strncasecmp (block_name, "$Paper_Space", 12) == 0));
+}
+
+
+/*!
+ * \brief Find the hash slot of a block name.
+ *
+ * \return the slot holding \c block_name, or the empty slot where it
+ * is to be stored.
+ */
+static int
+dxf_block_index_find_slot
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+        int mask;
+        int i;
+
+        mask = (2 * index->blocks_size) - 1;
+        i = (int) (dxf_block_index_hash (block_name) & (unsigned int) mask);
+        while ((index->slots[i] != 0)
+          && (!dxf_block_index_equal (index->entries[index->slots[i] - 1].block_name, block_name)))
+        {
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of block ids in a \c DxfBlockIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_block_index_grow
+(
+        DxfBlockIndex *index
+                /*!< a pointer to a block index. */
+)
+{
+        DxfBlockIndexEntry *entries;
+        int size;
+        int i;
+
+        size = (index->blocks_size == 0) ? 64 : 2 * index->blocks_size;
+        entries = realloc (index->entries, size * sizeof (DxfBlockIndexEntry));
+        if (entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        index->entries = entries;
+        memset (&index->entries[index->blocks_size], 0,
+          (size - index->blocks_size) * sizeof (DxfBlockIndexEntry));
+        /* Rehash the block names. */
+        free (index->slots);
+        index->slots = calloc (2 * size, sizeof (int));
+        if (index->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        index->blocks_size = size;
+        for (i = 0; i < index->number_of_blocks; i++)
+        {
+                index->slots[dxf_block_index_find_slot (index, index->entries[i].block_name)] = i + 1;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if block \c to can be reached from block \c from through
+ * the references in nested blocks.
+ *
+ * \return \c TRUE when it can, \c FALSE otherwise.
+ */
+static int
+dxf_block_index_reaches
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        int from,
+                /*!< id of the block to start from. */
+        int to
+                /*!< id of the block to look for. */
+)
+{
+        DxfBlockIndexEntry *entry;
+        int i;
+
+        if (from == to)
+        {
+                return (TRUE);
+        }
+        entry = &index->entries[from];
+        if (entry->visited == index->generation)
+        {
+                return (FALSE);
+        }
+        entry->visited = index->generation;
+        for (i = 0; i < entry->number_of_children; i++)
+        {
+                if (dxf_block_index_reaches (index, entry->children[i].block, to))
+                {
+                        return (TRUE);
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Add \c delta to the number of instances of a block and of the
+ * blocks nested in it.
+ *
+ * The references between blocks are kept free of cycles by
+ * dxf_block_index_add_reference (), so this ends.
+ */
+static void
+dxf_block_index_propagate
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        int block,
+                /*!< id of the block. */
+        int delta
+                /*!< number of instances added, negative for removed
+                 * instances. */
+)
+{
+        DxfBlockIndexEntry *entry;
+        int i;
+
+        if (delta == 0)
+        {
+                return;
+        }
+        entry = &index->entries[block];
+        entry->instances += delta;
+        for (i = 0; i < entry->number_of_children; i++)
+        {
+                dxf_block_index_propagate (index, entry->children[i].block,
+                  delta * entry->children[i].references);
+        }
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfBlockIndex.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfBlockIndex *
+dxf_block_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockIndex *index = NULL;
+        size_t size;
+
+        size = sizeof (DxfBlockIndex);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((index = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfBlockIndex struct.\n")),
+                  __FUNCTION__);
+                index = NULL;
+        }
+        else
+        {
+                memset (index, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfBlockIndex.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfBlockIndex *
+dxf_block_index_init
+(
+        DxfBlockIndex *index
+                /*!< a pointer to a block index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                index = dxf_block_index_new ();
+        }
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (index, 0, sizeof (DxfBlockIndex));
+        if (dxf_block_index_grow (index) == EXIT_FAILURE)
+        {
+                dxf_block_index_free (index);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfBlockIndex.
+ *
+ * The blocks and block records are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_index_free
+(
+        DxfBlockIndex *index
+                /*!< a pointer to a block index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < index->number_of_blocks; i++)
+        {
+                free (index->entries[i].block_name);
+                free (index->entries[i].children);
+        }
+        free (index->entries);
+        free (index->slots);
+        free (index);
+        index = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Intern a block name in a \c DxfBlockIndex.
+ *
+ * A layout block starts with one instance.
+ *
+ * \return the block id of \c block_name, or -1 when an error occurred.
+ */
+int
+dxf_block_index_intern
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int slot;
+        int block;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        slot = dxf_block_index_find_slot (index, block_name);
+        if (index->slots[slot] != 0)
+        {
+                return (index->slots[slot] - 1);
+        }
+        if (index->number_of_blocks == index->blocks_size)
+        {
+                if (dxf_block_index_grow (index) == EXIT_FAILURE)
+                {
+                        return (-1);
+                }
+                slot = dxf_block_index_find_slot (index, block_name);
+        }
+        block = index->number_of_blocks;
+        index->entries[block].block_name = strdup (block_name);
+        index->entries[block].instances = dxf_block_index_is_layout (block_name) ? 1 : 0;
+        index->slots[slot] = block + 1;
+        index->number_of_blocks++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block);
+}
+
+
+/*!
+ * \brief Find a block name in a \c DxfBlockIndex.
+ *
+ * \return the block id of \c block_name, or -1 when the block name is
+ * not in the index or an error occurred.
+ */
+int
+dxf_block_index_find
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int slot;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (index->blocks_size == 0)
+        {
+                return (-1);
+        }
+        slot = dxf_block_index_find_slot (index, block_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->slots[slot] - 1);
+}
+
+
+/*!
+ * \brief Get the block name of a block id.
+ *
+ * \return the interned block name, owned by \c index, or \c NULL when
+ * an error occurred.
+ */
+const char *
+dxf_block_index_get_block_name
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        int block
+                /*!< a block id. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((block < 0)
+          || (block >= index->number_of_blocks))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->entries[block].block_name);
+}
+
+
+/*!
+ * \brief Get the number of block names in a \c DxfBlockIndex.
+ *
+ * \return the number of block names, or -1 when an error occurred.
+ */
+int
+dxf_block_index_get_number_of_blocks
+(
+        DxfBlockIndex *index
+                /*!< a pointer to a block index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->number_of_blocks);
+}
+
+
+/*!
+ * \brief Get the block definition of a block name.
+ *
+ * \return a pointer to the block definition, or \c NULL when it is not
+ * known or an error occurred.
+ */
+DxfBlock *
+dxf_block_index_get_block
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int block;
+
+        block = dxf_block_index_find (index, block_name);
+        if (block < 0)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->entries[block].block);
+}
+
+
+/*!
+ * \brief Get the block record of a block name.
+ *
+ * \return a pointer to the block record, or \c NULL when it is not
+ * known or an error occurred.
+ */
+DxfBlockRecord *
+dxf_block_index_get_block_record
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int block;
+
+        block = dxf_block_index_find (index, block_name);
+        if (block < 0)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->entries[block].block_record);
+}
+
+
+/*!
+ * \brief Add a reference to a block.
+ *
+ * The number of instances of the block and of the blocks nested in it
+ * are updated.\n
+ * A reference which would make a block contain itself is refused.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_index_add_reference
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name,
+                /*!< name of the referenced block. */
+        const char *owner_name
+                /*!< name of the block containing the reference, or
+                 * \c NULL for a reference in the \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockIndexEntry *owner;
+        DxfBlockIndexChild *children;
+        int block;
+        int owner_block;
+        int size;
+        int i;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        block = dxf_block_index_intern (index, block_name);
+        if (block < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (owner_name == NULL)
+        {
+                index->entries[block].references++;
+                dxf_block_index_propagate (index, block, 1);
+                return (EXIT_SUCCESS);
+        }
+        owner_block = dxf_block_index_intern (index, owner_name);
+        if (owner_block < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        owner = &index->entries[owner_block];
+        for (i = 0; i < owner->number_of_children; i++)
+        {
+                if (owner->children[i].block == block)
+                {
+                        break;
+                }
+        }
+        if (i == owner->number_of_children)
+        {
+                index->generation++;
+                if (dxf_block_index_reaches (index, block, owner_block))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () block %s references itself through block %s.\n")),
+                          __FUNCTION__, owner_name, block_name);
+                        return (EXIT_FAILURE);
+                }
+                if (owner->number_of_children == owner->children_size)
+                {
+                        size = (owner->children_size == 0) ? 4 : 2 * owner->children_size;
+                        children = realloc (owner->children, size * sizeof (DxfBlockIndexChild));
+                        if (children == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (EXIT_FAILURE);
+                        }
+                        owner->children = children;
+                        owner->children_size = size;
+                }
+                owner->children[i].block = block;
+                owner->children[i].references = 0;
+                owner->number_of_children++;
+        }
+        owner->children[i].references++;
+        index->entries[block].references++;
+        dxf_block_index_propagate (index, block, owner->instances);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove a reference to a block.
+ *
+ * The number of instances of the block and of the blocks nested in it
+ * are updated.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when there is
+ * no such reference or an error occurred.
+ */
+int
+dxf_block_index_remove_reference
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name,
+                /*!< name of the referenced block. */
+        const char *owner_name
+                /*!< name of the block containing the reference, or
+                 * \c NULL for a reference in the \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockIndexEntry *owner;
+        int block;
+        int owner_block;
+        int i;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        block = dxf_block_index_find (index, block_name);
+        if ((block < 0)
+          || (index->entries[block].references == 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () block %s is not referenced.\n")),
+                  __FUNCTION__, block_name);
+                return (EXIT_FAILURE);
+        }
+        if (owner_name == NULL)
+        {
+                index->entries[block].references--;
+                dxf_block_index_propagate (index, block, -1);
+                return (EXIT_SUCCESS);
+        }
+        owner_block = dxf_block_index_find (index, owner_name);
+        if (owner_block < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () block %s is not referenced by block %s.\n")),
+                  __FUNCTION__, block_name, owner_name);
+                return (EXIT_FAILURE);
+        }
+        owner = &index->entries[owner_block];
+        for (i = 0; i < owner->number_of_children; i++)
+        {
+                if (owner->children[i].block == block)
+                {
+                        break;
+                }
+        }
+        if (i == owner->number_of_children)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () block %s is not referenced by block %s.\n")),
+                  __FUNCTION__, block_name, owner_name);
+                return (EXIT_FAILURE);
+        }
+        dxf_block_index_propagate (index, block, -owner->instances);
+        owner->children[i].references--;
+        if (owner->children[i].references == 0)
+        {
+                owner->number_of_children--;
+                owner->children[i] = owner->children[owner->number_of_children];
+        }
+        index->entries[block].references--;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the references of the \c INSERT and \c DIMENSION entities
+ * in \c entities to a \c DxfBlockIndex.
+ *
+ * Both the entities and the lazily loaded entities are counted, the
+ * references are added to the references counted before.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_index_add_entities
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        DxfEntities *entities,
+                /*!< DXF entities section, or the entities of a block. */
+        const char *owner_name
+                /*!< name of the block containing \c entities, or
+                 * \c NULL for the \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntityType type;
+        void *entity;
+        const char *block_name;
+        int number_of_entities;
+        int i;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i, &type);
+                if ((entity == NULL)
+                  || ((type != INSERT) && (type != DIMENSION)))
+                {
+                        continue;
+                }
+                block_name = (type == INSERT)
+                  ? ((DxfInsert *) entity)->block_name
+                  : ((DxfDimension *) entity)->dimblock_name;
+                if ((block_name == NULL)
+                  || (block_name[0] == '\0'))
+                {
+                        continue;
+                }
+                if (dxf_block_index_add_reference (index, block_name, owner_name) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (i = 0; i < entities->number_of_lazy_items; i++)
+        {
+                block_name = entities->lazy_items[i].block_name;
+                if (block_name == NULL)
+                {
+                        continue;
+                }
+                if (dxf_block_index_add_reference (index, block_name, owner_name) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a list of block definitions to a \c DxfBlockIndex.
+ *
+ * The references of the entities of each block to other blocks are
+ * added as nested references.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_index_add_blocks
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        DxfBlock *blocks
+                /*!< a list of block definitions, as read by
+                 * dxf_block_read_table (). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlock *iter;
+        int block;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                if (iter->block_name == NULL)
+                {
+                        continue;
+                }
+                block = dxf_block_index_intern (index, iter->block_name);
+                if (block < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                index->entries[block].block = iter;
+        }
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                if ((iter->block_name == NULL)
+                  || (iter->entities == NULL))
+                {
+                        continue;
+                }
+                if (dxf_block_index_add_entities (index, (DxfEntities *) iter->entities, iter->block_name) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the block records of the \c BLOCK_RECORD table to a
+ * \c DxfBlockIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_index_add_tables
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        DxfTables *tables
+                /*!< DXF tables section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockRecord *iter;
+        int block;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (tables == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = tables->block_records; iter != NULL; iter = (DxfBlockRecord *) iter->next)
+        {
+                if (iter->block_name == NULL)
+                {
+                        continue;
+                }
+                block = dxf_block_index_intern (index, iter->block_name);
+                if (block < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                index->entries[block].block_record = iter;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of \c INSERT and \c DIMENSION entities
+ * referencing a block.
+ *
+ * \return the number of references, or -1 when an error occurred.
+ */
+int
+dxf_block_index_get_references
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int block;
+
+        block = dxf_block_index_find (index, block_name);
+        if (block < 0)
+        {
+                return ((index == NULL) || (block_name == NULL) ? -1 : 0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->entries[block].references);
+}
+
+
+/*!
+ * \brief Get the number of times a block is drawn, including the
+ * instances in nested blocks.
+ *
+ * \return the number of instances, or -1 when an error occurred.
+ */
+int
+dxf_block_index_get_instances
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int block;
+
+        block = dxf_block_index_find (index, block_name);
+        if (block < 0)
+        {
+                return ((index == NULL) || (block_name == NULL) ? -1 : 0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->entries[block].instances);
+}
+
+
+/*!
+ * \brief Test if a block definition can be purged.
+ *
+ * A block can be purged when it is not drawn, directly or nested in
+ * another block which is drawn, and it is not a layout block.
+ *
+ * \return \c TRUE when the block can be purged, \c FALSE when it can
+ * not, or -1 when the block is not known or an error occurred.
+ */
+int
+dxf_block_index_is_purgeable
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to a block index. */
+        const char *block_name
+                /*!< a block name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int block;
+
+        block = dxf_block_index_find (index, block_name);
+        if (block < 0)
+        {
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((index->entries[block].instances == 0)
+          && (!dxf_block_index_is_layout (index->entries[block].block_name)));
+}
+
+
+/* EOF */
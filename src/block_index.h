@@ -0,0 +1,155 @@
+/*!
+ * \file block_index.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a block name index with reference counts.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_BLOCK_INDEX_H
+#define LIBDXF_SRC_BLOCK_INDEX_H
+
+
+#include "global.h"
+#include "block.h"
+#include "block_record.h"
+#include "entities.h"
+#include "tables.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Block referenced by the entities of another block.
+ */
+typedef struct
+dxf_block_index_child_struct
+{
+        int block;
+                /*!< Id of the referenced block. */
+        int references;
+                /*!< Number of \c INSERT and \c DIMENSION entities
+                 * referencing the block. */
+} DxfBlockIndexChild;
+
+
+/*!
+ * \brief Entry of a block name in a \c DxfBlockIndex.
+ */
+typedef struct
+dxf_block_index_entry_struct
+{
+        char *block_name;
+                /*!< Interned block name. */
+        DxfBlock *block;
+                /*!< Block definition, \c NULL when not known (yet). */
+        DxfBlockRecord *block_record;
+                /*!< Block record in the \c BLOCK_RECORD table,
+                 * \c NULL when not known (yet). */
+        int references;
+                /*!< Number of \c INSERT and \c DIMENSION entities
+                 * referencing the block, in the \c ENTITIES section and
+                 * in other blocks. */
+        int instances;
+                /*!< Number of times the block is drawn, with the
+                 * references in nested blocks multiplied by the number
+                 * of instances of the block they are in. */
+        DxfBlockIndexChild *children;
+                /*!< Blocks referenced by the entities of this block. */
+        int number_of_children;
+                /*!< Number of items in use in \c children. */
+        int children_size;
+                /*!< Number of items allocated for \c children. */
+        int visited;
+                /*!< Generation of the last search that visited the
+                 * block, used for detecting circular references. */
+} DxfBlockIndexEntry;
+
+
+/*!
+ * \brief Index of block definitions by block name.
+ *
+ * Every block name is interned once and referred to by a small id, the
+ * position in \c entries.\n
+ * The reference counts are kept up to date on every added or removed
+ * reference, so resolving a block by name and testing if it can be
+ * purged are O(1).\n
+ * The \c *Model_Space and \c *Paper_Space blocks are the roots of the
+ * drawing, they count as one instance each and are never purgeable.
+ */
+typedef struct
+dxf_block_index_struct
+{
+        DxfBlockIndexEntry *entries;
+                /*!< Blocks, indexed by block id. */
+        int number_of_blocks;
+                /*!< Number of interned block names. */
+        int blocks_size;
+                /*!< Number of allocated block ids. */
+        int *slots;
+                /*!< Open addressing hash of block names, holds the
+                 * block id + 1, 0 for an empty slot. */
+        int generation;
+                /*!< Generation of the last search for circular
+                 * references. */
+} DxfBlockIndex;
+
+
+DxfBlockIndex *dxf_block_index_new ();
+DxfBlockIndex *dxf_block_index_init (DxfBlockIndex *index);
+int dxf_block_index_free (DxfBlockIndex *index);
+int dxf_block_index_intern (DxfBlockIndex *index, const char *block_name);
+int dxf_block_index_find (DxfBlockIndex *index, const char *block_name);
+const char *dxf_block_index_get_block_name (DxfBlockIndex *index, int block);
+int dxf_block_index_get_number_of_blocks (DxfBlockIndex *index);
+DxfBlock *dxf_block_index_get_block (DxfBlockIndex *index, const char *block_name);
+DxfBlockRecord *dxf_block_index_get_block_record (DxfBlockIndex *index, const char *block_name);
+int dxf_block_index_add_reference (DxfBlockIndex *index, const char *block_name, const char *owner_name);
+int dxf_block_index_remove_reference (DxfBlockIndex *index, const char *block_name, const char *owner_name);
+int dxf_block_index_add_entities (DxfBlockIndex *index, DxfEntities *entities, const char *owner_name);
+int dxf_block_index_add_blocks (DxfBlockIndex *index, DxfBlock *blocks);
+int dxf_block_index_add_tables (DxfBlockIndex *index, DxfTables *tables);
+int dxf_block_index_get_references (DxfBlockIndex *index, const char *block_name);
+int dxf_block_index_get_instances (DxfBlockIndex *index, const char *block_name);
+int dxf_block_index_is_purgeable (DxfBlockIndex *index, const char *block_name);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_BLOCK_INDEX_H */
+
+
+/* EOF */
@@ -112,15 +112,6 @@ dxf_block_record_init
                   __FUNCTION__);
                 return (NULL);
         }
-        /* Initialize new structs for members. */
-        block_record->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (block_record->binary_graphics_data);
-        if (block_record->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () could not allocate memory.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         /* Assign initial values to members. */
         block_record->id_code = 0;
         block_record->block_name = strdup ("");
@@ -128,13 +119,14 @@ dxf_block_record_init
         block_record->insert_units = 0;
         block_record->explodability = 0;
         block_record->scalability = 0;
-        block_record->dictionary_owner_soft = strdup ("");
-        block_record->object_owner_soft = strdup ("");
-        block_record->dictionary_owner_hard = strdup ("");
+        block_record->dictionary_owner_soft = DXF_HANDLE_NONE;
+        block_record->object_owner_soft = DXF_HANDLE_NONE;
+        block_record->dictionary_owner_hard = DXF_HANDLE_NONE;
         block_record->xdata_string_data = strdup ("DesignCenter Data");
         block_record->xdata_application_name = strdup ("ACAD");
         block_record->design_center_version_number = 0;
         block_record->insert_units = 0;
+        block_record->binary_graphics_data = NULL;
         block_record->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -168,7 +160,6 @@ dxf_block_record_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
@@ -188,7 +179,6 @@ dxf_block_record_read
                   __FUNCTION__);
                 block_record = dxf_block_record_init (block_record);
         }
-        iter310 = (DxfBinaryData *) block_record->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -208,8 +198,7 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &block_record->id_code);
+                        block_record->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -244,10 +233,11 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        if (block_record->binary_graphics_data == NULL)
+                        {
+                                block_record->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, block_record->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -255,15 +245,13 @@ dxf_block_record_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->dictionary_owner_soft);
+                                block_record->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->object_owner_soft);
+                                block_record->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -271,15 +259,13 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing Hard-pointer
                          * ID/handle to associated LAYOUT object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->associated_layout_hard);
+                        block_record->associated_layout_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->dictionary_owner_hard);
+                        block_record->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -381,7 +367,7 @@ dxf_block_record_write
           || (strcmp (block_record->block_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s empty block name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, block_record->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -392,9 +378,9 @@ dxf_block_record_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (block_record->id_code != -1)
+        if (block_record->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", block_record->id_code);
+                dxf_handle_write (fp, 5, block_record->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -406,24 +392,24 @@ dxf_block_record_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (block_record->dictionary_owner_soft, "") != 0)
+        if ((block_record->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", block_record->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, block_record->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (block_record->dictionary_owner_hard, "") != 0)
+        if ((block_record->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", block_record->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, block_record->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (block_record->object_owner_soft, "") != 0)
+        if ((block_record->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "330\n%s\n", block_record->object_owner_soft);
+                dxf_handle_write (fp, 330, block_record->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -434,7 +420,7 @@ dxf_block_record_write
         fprintf (fp->fp, " 70\n%hd\n", block_record->flag);
         if (fp->acad_version_number >= AutoCAD_2000)
         {
-                fprintf (fp->fp, "340\n%s\n", block_record->associated_layout_hard);
+                dxf_handle_write (fp, 340, block_record->associated_layout_hard);
         }
         if (fp->acad_version_number >= AutoCAD_2007)
         {
@@ -445,13 +431,7 @@ dxf_block_record_write
         {
                 if (block_record->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) block_record->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, block_record->binary_graphics_data);
                 }
                 if (block_record->xdata_application_name != NULL)
                 {
@@ -507,9 +487,12 @@ dxf_block_record_free
                 return (EXIT_FAILURE);
         }
         free (block_record->block_name);
-        dxf_binary_data_free_list (block_record->binary_graphics_data);
-        free (block_record->dictionary_owner_soft);
-        free (block_record->dictionary_owner_hard);
+        free (block_record->xdata_string_data);
+        free (block_record->xdata_application_name);
+        if (block_record->binary_graphics_data != NULL)
+        {
+                dxf_binary_buffer_free (block_record->binary_graphics_data);
+        }
         free (block_record);
         block_record = NULL;
 #if DEBUG
@@ -543,6 +526,7 @@ dxf_block_record_free_list
         while (block_records != NULL)
         {
                 DxfBlockRecord *iter= (DxfBlockRecord *) block_records->next;
+                block_records->next = NULL;
                 dxf_block_record_free (block_records);
                 block_records = (DxfBlockRecord *) iter;
         }
@@ -552,12 +536,107 @@ dxf_block_record_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c BLOCK_RECORD symbol table entry.
+ *
+ * The copy does not share any memory with \c block_record, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfBlockRecord *
+dxf_block_record_copy
+(
+        DxfBlockRecord *block_record
+                /*!< a pointer to the DXF \c BLOCK_RECORD symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockRecord *copy;
+
+        /* Do some basic checks. */
+        if (block_record == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_block_record_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, block_record, sizeof (DxfBlockRecord));
+        copy->block_name = NULL;
+        copy->xdata_string_data = NULL;
+        copy->xdata_application_name = NULL;
+        copy->binary_graphics_data = NULL;
+        copy->next = NULL;
+        if (block_record->block_name != NULL)
+        {
+                copy->block_name = strdup (block_record->block_name);
+                if (copy->block_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_block_record_free (copy);
+                        return (NULL);
+                }
+        }
+        if (block_record->xdata_string_data != NULL)
+        {
+                copy->xdata_string_data = strdup (block_record->xdata_string_data);
+                if (copy->xdata_string_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_block_record_free (copy);
+                        return (NULL);
+                }
+        }
+        if (block_record->xdata_application_name != NULL)
+        {
+                copy->xdata_application_name = strdup (block_record->xdata_application_name);
+                if (copy->xdata_application_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_block_record_free (copy);
+                        return (NULL);
+                }
+        }
+        if (block_record->binary_graphics_data != NULL)
+        {
+                copy->binary_graphics_data = dxf_binary_buffer_copy (block_record->binary_graphics_data);
+                if (copy->binary_graphics_data == NULL)
+                {
+                        dxf_block_record_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c BLOCK_RECORD symbol table entry.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_block_record_get_id_code
 (
         DxfBlockRecord *block_record
@@ -576,12 +655,6 @@ dxf_block_record_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (block_record->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -598,7 +671,7 @@ dxf_block_record_set_id_code
         DxfBlockRecord *block_record,
                 /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
                  * entry. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -615,12 +688,6 @@ dxf_block_record_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         block_record->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1174,18 +1241,18 @@ dxf_block_record_set_scalability
 
 /*!
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
- * \c BLOCK_RECORD symbol table entry.
+ * \c BLOCK_RECORD entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_block_record_get_binary_graphics_data
 (
         DxfBlockRecord *block_record
-                /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
-                 * entry. */
+                /*!< a pointer to a DXF \c BLOCK_RECORD entity. */
 )
 {
 #if DEBUG
@@ -1199,33 +1266,31 @@ dxf_block_record_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (block_record->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) block_record->binary_graphics_data);
+        return (block_record->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
- * \c BLOCK_RECORD symbol table entry.
+ * \c BLOCK_RECORD entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c block_record when successful, or \c NULL when an
+ * error occurred.
  */
 DxfBlockRecord *
 dxf_block_record_set_binary_graphics_data
 (
         DxfBlockRecord *block_record,
-                /*!< a pointer to a DXF \c BLOCK_RECORD symbol table
-                 * entry. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+                /*!< a pointer to a DXF \c BLOCK_RECORD entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1246,7 +1311,12 @@ dxf_block_record_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->binary_graphics_data = (DxfBinaryData *) data;
+        if ((block_record->binary_graphics_data != NULL)
+          && (block_record->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (block_record->binary_graphics_data);
+        }
+        block_record->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1281,17 +1351,10 @@ dxf_block_record_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (block_record->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_soft));
+        return (dxf_handle_to_string (block_record->dictionary_owner_soft));
 }
 
 
@@ -1328,7 +1391,7 @@ dxf_block_record_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        block_record->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1363,17 +1426,10 @@ dxf_block_record_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (block_record->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->object_owner_soft));
+        return (dxf_handle_to_string (block_record->object_owner_soft));
 }
 
 
@@ -1410,7 +1466,7 @@ dxf_block_record_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->object_owner_soft = strdup (object_owner_soft);
+        block_record->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1445,17 +1501,10 @@ dxf_block_record_get_associated_layout_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (block_record->associated_layout_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->associated_layout_hard));
+        return (dxf_handle_to_string (block_record->associated_layout_hard));
 }
 
 
@@ -1486,17 +1535,10 @@ dxf_block_record_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (block_record->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_hard));
+        return (dxf_handle_to_string (block_record->dictionary_owner_hard));
 }
 
 
@@ -1533,7 +1575,7 @@ dxf_block_record_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        block_record->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
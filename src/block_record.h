@@ -47,6 +47,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "binary_data.h"
 
 
@@ -65,7 +66,7 @@ extern "C" {
 typedef struct
 dxf_block_record_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -98,23 +99,23 @@ dxf_block_record_struct
         int16_t scalability;
                  /*!< Block scalability.\n
                   * Group code = 281. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Binary data for bitmap preview (optional).\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
+        DxfBinaryBuffer *binary_graphics_data;
+                /*!< Binary data for bitmap preview, the binary chunk
+                 * records decoded into one buffer, \c NULL when there
+                 * is no preview (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object (optional).\n
                  * Group code = 330. */
-        char *associated_layout_hard;
+        DxfHandle associated_layout_hard;
                 /*!< Hard-pointer ID/handle to associated LAYOUT object.\n
                  * Group code = 340. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -165,8 +166,9 @@ DxfBlockRecord *dxf_block_record_read (DxfFile *fp, DxfBlockRecord *block_record
 int dxf_block_record_write (DxfFile *fp, DxfBlockRecord *block_record);
 int dxf_block_record_free (DxfBlockRecord *block_record);
 void dxf_block_record_free_list (DxfBlockRecord *block_records);
-int dxf_block_record_get_id_code (DxfBlockRecord *block_record);
-DxfBlockRecord *dxf_block_record_set_id_code (DxfBlockRecord *block_record, int id_code);
+DxfBlockRecord *dxf_block_record_copy (DxfBlockRecord *block_record);
+DxfHandle dxf_block_record_get_id_code (DxfBlockRecord *block_record);
+DxfBlockRecord *dxf_block_record_set_id_code (DxfBlockRecord *block_record, DxfHandle id_code);
 char *dxf_block_record_get_block_name (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_block_name (DxfBlockRecord *block_record, char *block_name);
 int16_t dxf_block_record_get_flag (DxfBlockRecord *block_record);
@@ -180,8 +182,8 @@ int16_t dxf_block_record_get_explodability (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_explodability (DxfBlockRecord *block_record, int16_t explodability);
 int16_t dxf_block_record_get_scalability (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_scalability (DxfBlockRecord *block_record, int16_t scalability);
-DxfBinaryData *dxf_block_record_get_binary_graphics_data (DxfBlockRecord *block_record);
-DxfBlockRecord *dxf_block_record_set_binary_graphics_data (DxfBlockRecord *block_record, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_block_record_get_binary_graphics_data (DxfBlockRecord *block_record);
+DxfBlockRecord *dxf_block_record_set_binary_graphics_data (DxfBlockRecord *block_record, DxfBinaryBuffer *data);
 char *dxf_block_record_get_dictionary_owner_soft (DxfBlockRecord *block_record);
 DxfBlockRecord *dxf_block_record_set_dictionary_owner_soft (DxfBlockRecord *block_record, char *dictionary_owner_soft);
 char *dxf_block_record_get_object_owner_soft (DxfBlockRecord *block_record);
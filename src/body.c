@@ -42,6 +42,7 @@
 
 
 #include "body.h"
+#include "entities.h"
 
 
 /*!
@@ -112,15 +113,14 @@ dxf_body_init
                 return (NULL);
         }
         /* Initialize new structs for members. */
-        body->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (body->binary_graphics_data);
-        if (body->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&body->common) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->proprietary_data = (DxfBinaryData *) dxf_binary_data_init (body->proprietary_data);
+        body->proprietary_data = (DxfBinaryData *) dxf_binary_data_init (dxf_binary_data_new ());
         if (body->proprietary_data == NULL)
         {
                 fprintf (stderr,
@@ -128,7 +128,7 @@ dxf_body_init
                   __FUNCTION__);
                 return (NULL);
         }
-        body->additional_proprietary_data = (DxfBinaryData *) dxf_binary_data_init (body->additional_proprietary_data);
+        body->additional_proprietary_data = (DxfBinaryData *) dxf_binary_data_init (dxf_binary_data_new ());
         if (body->additional_proprietary_data == NULL)
         {
                 fprintf (stderr,
@@ -136,26 +136,15 @@ dxf_body_init
                   __FUNCTION__);
                 return (NULL);
         }
+        body->proprietary_data_range = dxf_proprietary_data_range_init (dxf_proprietary_data_range_new ());
+        if (body->proprietary_data_range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         /* Assign initial values to members. */
-        body->id_code = 0;
-        body->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        body->layer = strdup (DXF_DEFAULT_LAYER);
-        body->elevation = 0.0;
-        body->thickness = 0.0;
-        body->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        body->visibility = DXF_DEFAULT_VISIBILITY;
-        body->color = DXF_COLOR_BYLAYER;
-        body->paperspace = DXF_MODELSPACE;
-        body->graphics_data_size = 0;
-        body->shadow_mode = 0;
-        body->dictionary_owner_soft = strdup ("");
-        body->object_owner_soft = strdup ("");
-        body->material = strdup ("");
-        body->dictionary_owner_hard = strdup ("");
-        body->plot_style_name = strdup ("");
-        body->color_value = 0;
-        body->color_name = strdup ("");
-        body->transparency = 0;
         body->modeler_format_version_number = 1;
         body->next = NULL;
 #if DEBUG
@@ -188,10 +177,9 @@ dxf_body_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -199,8 +187,6 @@ dxf_body_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (body == NULL)
@@ -208,7 +194,11 @@ dxf_body_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                body = dxf_body_init (body);
+                body = dxf_body_init (dxf_body_new ());
+                if (body == NULL)
+                {
+                        return (NULL);
+                }
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
@@ -216,241 +206,78 @@ dxf_body_read
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        i = 0;
-        iter310 = (DxfBinaryData *) body->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->proprietary_data->data_line);
-                        body->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->proprietary_data->next);
-                        body->proprietary_data = (DxfBinaryData *) body->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->additional_proprietary_data->data_line);
-                        body->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->additional_proprietary_data->next);
-                        body->additional_proprietary_data = (DxfBinaryData *) body->additional_proprietary_data->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &body->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &body->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &body->thickness);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->paperspace);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "70") == 0))
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->modeler_format_version_number);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &body->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                        {
-                                fprintf (stderr, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
-                                        fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &body->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &body->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &body->color_value);
+                        break;
                 }
-                else if (strcmp (temp_string, "430") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->color_name);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "440") == 0)
+                if ((group_code == 1) || (group_code == 3))
                 {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &body->transparency);
+                        /* Proprietary data, only record where it is. */
+                        dxf_proprietary_data_range_read (fp, body->proprietary_data_range);
+                        continue;
                 }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 70:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        body->modeler_format_version_number = atoi (value);
+                                }
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbModelerGeometry") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &body->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (body->linetype, "") == 0)
+        if ((body->common.linetype == NULL)
+          || (strcmp (body->common.linetype, "") == 0))
         {
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (body->common.linetype);
+                body->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (body->layer, "") == 0)
+        if ((body->common.layer == NULL)
+          || (strcmp (body->common.layer, "") == 0))
         {
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                free (body->common.layer);
+                body->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (body->modeler_format_version_number == 0)
         {
@@ -461,8 +288,6 @@ dxf_body_read
                   (_("\tmodeler format version number is reset to 1.\n")));
                 body->modeler_format_version_number = 1;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -515,35 +340,35 @@ dxf_body_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, body->id_code);
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, body->common.id_code);
         }
-        if (strcmp (body->linetype, "") == 0)
+        if (strcmp (body->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, body->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, body->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                body->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (body->layer, "") == 0)
+        if (strcmp (body->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, body->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, body->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                body->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         i = 1;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (body->id_code != -1)
+        if (body->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", body->id_code);
+                dxf_handle_write (fp, 5, body->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -555,93 +380,87 @@ dxf_body_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (body->dictionary_owner_soft, "") != 0)
+        if ((body->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", body->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, body->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (body->dictionary_owner_hard, "") != 0)
+        if ((body->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", body->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, body->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (body->object_owner_soft, "") != 0)
+        if ((body->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", body->object_owner_soft);
+                dxf_handle_write (fp, 330, body->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (body->paperspace == DXF_PAPERSPACE)
+        if (body->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", body->layer);
-        if (strcmp (body->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", body->common.layer);
+        if (strcmp (body->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", body->linetype);
+                fprintf (fp->fp, "  6\n%s\n", body->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (body->material, "") != 0))
+          && (body->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", body->material);
+                dxf_handle_write (fp, 347, body->common.cold->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (body->elevation != 0.0))
+          && (body->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", body->elevation);
+                fprintf (fp->fp, " 38\n%f\n", body->common.elevation);
         }
-        if (body->thickness != 0.0)
+        if (body->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", body->thickness);
+                fprintf (fp->fp, " 39\n%f\n", body->common.thickness);
         }
-        if (body->linetype_scale != 1.0)
+        if (body->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", body->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", body->common.linetype_scale);
         }
-        if (body->visibility != 0)
+        if (body->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", body->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", body->common.visibility);
         }
-        if (body->color != DXF_COLOR_BYLAYER)
+        if (body->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", body->color);
+                fprintf (fp->fp, " 62\n%hd\n", body->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", body->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", body->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", body->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", body->common.cold->graphics_data_size);
 #endif
-                if (body->binary_graphics_data != NULL)
+                if (body->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) body->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, body->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", body->color_value);
-                fprintf (fp->fp, "430\n%s\n", body->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", body->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", body->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", body->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", body->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", body->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", body->shadow_mode);
+                dxf_handle_write (fp, 390, body->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", body->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -651,23 +470,34 @@ dxf_body_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", body->modeler_format_version_number);
         }
-        iter = (DxfProprietaryData *) body->proprietary_data;
-        additional_iter = (DxfProprietaryData *) body->additional_proprietary_data;
-        while ((iter != NULL) || (additional_iter != NULL))
+        if ((body->proprietary_data_range != NULL)
+          && (body->proprietary_data_range->number_of_lines > 0))
         {
-                if (iter->order == i)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter->line);
-                        iter = (DxfProprietaryData *) iter->next;
-                        i++;
-                }
-                if (additional_iter->order == i)
+                /* Copy the proprietary data from the file it was read
+                 * from. */
+                dxf_proprietary_data_range_write (fp, body->proprietary_data_range);
+        }
+        else
+        {
+                iter = (DxfProprietaryData *) body->proprietary_data;
+                additional_iter = (DxfProprietaryData *) body->additional_proprietary_data;
+                while ((iter != NULL) || (additional_iter != NULL))
                 {
-                        fprintf (fp->fp, "  3\n%s\n", additional_iter->line);
-                        additional_iter = (DxfProprietaryData *) additional_iter->next;
-                        i++;
+                        if (iter->order == i)
+                        {
+                                fprintf (fp->fp, "  1\n%s\n", iter->line);
+                                iter = (DxfProprietaryData *) iter->next;
+                                i++;
+                        }
+                        if (additional_iter->order == i)
+                        {
+                                fprintf (fp->fp, "  3\n%s\n", additional_iter->line);
+                                additional_iter = (DxfProprietaryData *) additional_iter->next;
+                                i++;
+                        }
                 }
         }
+        dxf_entity_common_write_xdata (fp, &body->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -710,15 +540,8 @@ dxf_body_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (body->linetype);
-        free (body->layer);
-        dxf_binary_data_free_list (body->binary_graphics_data);
-        free (body->dictionary_owner_soft);
-        free (body->object_owner_soft);
-        free (body->material);
-        free (body->dictionary_owner_hard);
-        free (body->plot_style_name);
-        free (body->color_name);
+        dxf_entity_common_free (&body->common);
+        dxf_proprietary_data_range_free (body->proprietary_data_range);
         dxf_binary_data_free_list (body->proprietary_data);
         dxf_binary_data_free_list (body->additional_proprietary_data);
         free (body);
@@ -754,6 +577,7 @@ dxf_body_free_list
         while (bodies != NULL)
         {
                 DxfBody *iter = (DxfBody *) bodies->next;
+                bodies->next = NULL;
                 dxf_body_free (bodies);
                 bodies = (DxfBody *) iter;
         }
@@ -764,39 +588,116 @@ dxf_body_free_list
 
 
 /*!
- * \brief Get the ID code from a DXF \c BODY entity.
+ * \brief Copy a DXF \c BODY entity.
  *
- * \return ID code.
+ * The copy does not share any memory with \c body, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
  */
-int
-dxf_body_get_id_code
+DxfBody *
+dxf_body_copy
 (
         DxfBody *body
-                /*!< a pointer to a DXF \c BODY entity. */
+                /*!< a pointer to the DXF \c BODY entity to copy. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfBody *copy;
+
         /* Do some basic checks. */
         if (body == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
-        if (body->id_code < 0)
+        copy = dxf_body_new ();
+        if (copy == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, body, sizeof (DxfBody));
+        copy->proprietary_data = NULL;
+        copy->additional_proprietary_data = NULL;
+        copy->proprietary_data_range = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &body->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_body_free (copy);
+                return (NULL);
+        }
+        if (body->proprietary_data != NULL)
+        {
+                copy->proprietary_data = dxf_binary_data_copy_list (body->proprietary_data);
+                if (copy->proprietary_data == NULL)
+                {
+                        dxf_body_free (copy);
+                        return (NULL);
+                }
+        }
+        if (body->additional_proprietary_data != NULL)
+        {
+                copy->additional_proprietary_data = dxf_binary_data_copy_list (body->additional_proprietary_data);
+                if (copy->additional_proprietary_data == NULL)
+                {
+                        dxf_body_free (copy);
+                        return (NULL);
+                }
+        }
+        if (body->proprietary_data_range != NULL)
+        {
+                copy->proprietary_data_range = dxf_proprietary_data_range_copy (body->proprietary_data_range);
+                if (copy->proprietary_data_range == NULL)
+                {
+                        dxf_body_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Get the ID code from a DXF \c BODY entity.
+ *
+ * \return ID code.
+ */
+DxfHandle
+dxf_body_get_id_code
+(
+        DxfBody *body
+                /*!< a pointer to a DXF \c BODY entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (body == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->id_code);
+        return (body->common.id_code);
 }
 
 
@@ -808,7 +709,7 @@ dxf_body_set_id_code
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -825,14 +726,7 @@ dxf_body_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        body->id_code = id_code;
+        body->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -863,7 +757,7 @@ dxf_body_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->linetype ==  NULL)
+        if (body->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -873,7 +767,7 @@ dxf_body_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->linetype));
+        return (strdup (body->common.linetype));
 }
 
 
@@ -907,7 +801,7 @@ dxf_body_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        body->linetype = strdup (linetype);
+        body->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -938,7 +832,7 @@ dxf_body_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->layer ==  NULL)
+        if (body->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -948,7 +842,7 @@ dxf_body_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->layer));
+        return (strdup (body->common.layer));
 }
 
 
@@ -982,7 +876,7 @@ dxf_body_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        body->layer = strdup (layer);
+        body->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1016,7 +910,7 @@ dxf_body_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->elevation);
+        return (body->common.elevation);
 }
 
 
@@ -1043,7 +937,7 @@ dxf_body_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        body->elevation = elevation;
+        body->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1074,7 +968,7 @@ dxf_body_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->thickness < 0.0)
+        if (body->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1084,7 +978,7 @@ dxf_body_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->thickness);
+        return (body->common.thickness);
 }
 
 
@@ -1118,7 +1012,7 @@ dxf_body_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        body->thickness = thickness;
+        body->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1149,7 +1043,7 @@ dxf_body_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->linetype_scale < 0.0)
+        if (body->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1159,7 +1053,7 @@ dxf_body_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->linetype_scale);
+        return (body->common.linetype_scale);
 }
 
 
@@ -1193,7 +1087,7 @@ dxf_body_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        body->linetype_scale = linetype_scale;
+        body->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1224,14 +1118,14 @@ dxf_body_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->visibility < 0)
+        if (body->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->visibility > 1)
+        if (body->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1241,7 +1135,7 @@ dxf_body_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->visibility);
+        return (body->common.visibility);
 }
 
 
@@ -1282,7 +1176,7 @@ dxf_body_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        body->visibility = visibility;
+        body->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1313,7 +1207,7 @@ dxf_body_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->color < 0)
+        if (body->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1322,7 +1216,7 @@ dxf_body_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->color);
+        return (body->common.color);
 }
 
 
@@ -1357,7 +1251,7 @@ dxf_body_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        body->color = color;
+        body->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1388,13 +1282,13 @@ dxf_body_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->paperspace < 0)
+        if (body->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (body->paperspace > 1)
+        if (body->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1403,7 +1297,7 @@ dxf_body_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->paperspace);
+        return (body->common.paperspace);
 }
 
 
@@ -1444,7 +1338,7 @@ dxf_body_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        body->paperspace = paperspace;
+        body->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1476,13 +1370,13 @@ dxf_body_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->graphics_data_size < 0)
+        if (body->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (body->graphics_data_size == 0)
+        if (body->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1491,7 +1385,7 @@ dxf_body_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->graphics_data_size);
+        return (body->common.cold->graphics_data_size);
 }
 
 
@@ -1536,7 +1430,7 @@ dxf_body_set_graphics_data_size
                   __FUNCTION__);
                 return (NULL);
         }
-        body->graphics_data_size = graphics_data_size;
+        body->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1568,14 +1462,14 @@ dxf_body_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->shadow_mode < 0)
+        if (body->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (body->shadow_mode > 3)
+        if (body->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1585,7 +1479,7 @@ dxf_body_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->shadow_mode);
+        return (body->common.cold->shadow_mode);
 }
 
 
@@ -1629,7 +1523,7 @@ dxf_body_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        body->shadow_mode = shadow_mode;
+        body->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1638,14 +1532,15 @@ dxf_body_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c BODY entity.
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_body_get_binary_graphics_data
 (
         DxfBody *body
@@ -1663,24 +1558,20 @@ dxf_body_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) body->binary_graphics_data);
+        return (body->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c BODY entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c body when successful, or \c NULL when an
  * error occurred.
  */
@@ -1689,9 +1580,9 @@ dxf_body_set_binary_graphics_data
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1712,7 +1603,12 @@ dxf_body_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        body->binary_graphics_data = (DxfBinaryData *) data;
+        if ((body->common.cold->binary_graphics_data != NULL)
+          && (body->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (body->common.cold->binary_graphics_data);
+        }
+        body->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1746,17 +1642,10 @@ dxf_body_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_soft));
+        return (dxf_handle_to_string (body->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1792,7 +1681,7 @@ dxf_body_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        body->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        body->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1826,17 +1715,10 @@ dxf_body_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->object_owner_soft));
+        return (dxf_handle_to_string (body->common.cold->object_owner_soft));
 }
 
 
@@ -1872,7 +1754,7 @@ dxf_body_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        body->object_owner_soft = strdup (object_owner_soft);
+        body->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1907,17 +1789,10 @@ dxf_body_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->material));
+        return (dxf_handle_to_string (body->common.cold->material));
 }
 
 
@@ -1955,7 +1830,7 @@ dxf_body_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        body->material = strdup (material);
+        body->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1989,17 +1864,10 @@ dxf_body_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_hard));
+        return (dxf_handle_to_string (body->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2035,7 +1903,7 @@ dxf_body_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        body->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        body->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2070,7 +1938,7 @@ dxf_body_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->lineweight);
+        return (body->common.lineweight);
 }
 
 
@@ -2100,7 +1968,7 @@ dxf_body_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        body->lineweight = lineweight;
+        body->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2132,17 +2000,10 @@ dxf_body_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->plot_style_name));
+        return (dxf_handle_to_string (body->common.cold->plot_style_name));
 }
 
 
@@ -2180,7 +2041,7 @@ dxf_body_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        body->plot_style_name = strdup (plot_style_name);
+        body->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2215,7 +2076,7 @@ dxf_body_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->color_value);
+        return (body->common.color_value);
 }
 
 
@@ -2245,7 +2106,7 @@ dxf_body_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        body->color_value = color_value;
+        body->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2277,7 +2138,7 @@ dxf_body_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->color_name ==  NULL)
+        if (body->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2287,7 +2148,7 @@ dxf_body_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->color_name));
+        return (strdup (body->common.cold->color_name));
 }
 
 
@@ -2325,7 +2186,7 @@ dxf_body_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        body->color_name = strdup (color_name);
+        body->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2360,7 +2221,7 @@ dxf_body_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (body->transparency);
+        return (body->common.cold->transparency);
 }
 
 
@@ -2390,7 +2251,7 @@ dxf_body_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        body->transparency = transparency;
+        body->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2631,6 +2492,80 @@ dxf_body_set_modeler_format_version_number
 }
 
 
+/*!
+ * \brief Get the \c proprietary_data_range from a DXF \c BODY entity.
+ *
+ * \warning No checks are performed on the returned pointer.
+ *
+ * \return \c proprietary_data_range when sucessful, or \c NULL when an
+ * error occurred.
+ */
+DxfProprietaryDataRange *
+dxf_body_get_proprietary_data_range
+(
+        DxfBody *body
+                /*!< a pointer to a DXF \c BODY entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (body == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (body->proprietary_data_range);
+}
+
+
+/*!
+ * \brief Get the decoded proprietary (ACIS) data from a DXF \c BODY
+ * entity.
+ *
+ * The group 1 and group 3 lines are read from the DXF file and decoded
+ * into SAT text on each call.
+ *
+ * \return a '\\0' terminated buffer with the SAT text, to be freed by
+ * the caller, or \c NULL when an error occurred.
+ */
+char *
+dxf_body_get_sat_data
+(
+        DxfBody *body,
+                /*!< a pointer to a DXF \c BODY entity. */
+        size_t *length
+                /*!< the number of characters in the returned buffer,
+                 * may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *sat_data = NULL;
+
+        /* Do some basic checks. */
+        if (body == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        sat_data = dxf_proprietary_data_range_decode (body->proprietary_data_range, length);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (sat_data);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c BODY entity from a DXF 
  * \c BODY entity.
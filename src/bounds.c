@@ -0,0 +1,1345 @@
+/*!
+ * \file bounds.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for bounding boxes of entities and drawing
+ * extents.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "bounds.h"
+
+
+#define DXF_BOUNDS_TWO_PI (2.0 * M_PI)
+        /*!< \brief A full turn in radians. */
+
+
+/*!
+ * \brief Add the points of a single linked list of points to a box.
+ */
+static void
+dxf_bounds_add_point_list
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        DxfPoint *points
+                /*!< the first point of the list, may be \c NULL. */
+)
+{
+        DxfPoint *iter;
+
+        for (iter = points; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                dxf_bounds_add_point (box, iter->x0, iter->y0, iter->z0);
+        }
+}
+
+
+/*!
+ * \brief Add contiguous arrays of coordinates to a box.
+ *
+ * Written as plain min/max loops over the arrays, so the compiler can
+ * vectorize them.
+ */
+static void
+dxf_bounds_add_coordinates
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        const double *x,
+                /*!< array of X-values. */
+        const double *y,
+                /*!< array of Y-values. */
+        int number_of_points,
+                /*!< number of values in \c x and \c y. */
+        double z
+                /*!< Z-value of all points. */
+)
+{
+        double min_x = box->min_x;
+        double min_y = box->min_y;
+        double max_x = box->max_x;
+        double max_y = box->max_y;
+        int i;
+
+        for (i = 0; i < number_of_points; i++)
+        {
+                min_x = (x[i] < min_x) ? x[i] : min_x;
+                max_x = (x[i] > max_x) ? x[i] : max_x;
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                min_y = (y[i] < min_y) ? y[i] : min_y;
+                max_y = (y[i] > max_y) ? y[i] : max_y;
+        }
+        box->min_x = min_x;
+        box->min_y = min_y;
+        box->max_x = max_x;
+        box->max_y = max_y;
+        if (number_of_points > 0)
+        {
+                box->min_z = (z < box->min_z) ? z : box->min_z;
+                box->max_z = (z > box->max_z) ? z : box->max_z;
+        }
+}
+
+
+/*!
+ * \brief Add contiguous arrays of single precision offsets to a box.
+ */
+static void
+dxf_bounds_add_offsets
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        const float *x_offset,
+                /*!< array of X-offsets. */
+        const float *y_offset,
+                /*!< array of Y-offsets. */
+        int number_of_points,
+                /*!< number of values in \c x_offset and \c y_offset. */
+        double origin_x,
+                /*!< X-value the offsets are relative to. */
+        double origin_y,
+                /*!< Y-value the offsets are relative to. */
+        double z
+                /*!< Z-value of all points. */
+)
+{
+        float min_x = HUGE_VALF;
+        float min_y = HUGE_VALF;
+        float max_x = -HUGE_VALF;
+        float max_y = -HUGE_VALF;
+        int i;
+
+        if (number_of_points == 0)
+        {
+                return;
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                min_x = (x_offset[i] < min_x) ? x_offset[i] : min_x;
+                max_x = (x_offset[i] > max_x) ? x_offset[i] : max_x;
+                min_y = (y_offset[i] < min_y) ? y_offset[i] : min_y;
+                max_y = (y_offset[i] > max_y) ? y_offset[i] : max_y;
+        }
+        dxf_bounds_add_point (box, origin_x + min_x, origin_y + min_y, z);
+        dxf_bounds_add_point (box, origin_x + max_x, origin_y + max_y, z);
+}
+
+
+/*!
+ * \brief Add the points of single precision storage to a box.
+ */
+static void
+dxf_bounds_add_point_offsets
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        DxfPointOffsets *offsets
+                /*!< single precision storage of the points. */
+)
+{
+        double x;
+        double y;
+        double z;
+        int i;
+
+        for (i = 0; i < offsets->number_of_points; i++)
+        {
+                dxf_point_offsets_get (offsets, i, &x, &y, &z);
+                dxf_bounds_add_point (box, x, y, z);
+        }
+}
+
+
+/*!
+ * \brief Add a circular arc to a box.
+ *
+ * The arc runs counterclockwise from \c start to \c end, equal angles
+ * give a full circle.\n
+ * Besides the end points, the points at 0, 90, 180 and 270 degrees are
+ * added when the arc passes them.
+ */
+static void
+dxf_bounds_add_arc
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        double x,
+                /*!< X-value of the center point. */
+        double y,
+                /*!< Y-value of the center point. */
+        double z,
+                /*!< Z-value of the center point. */
+        double radius,
+                /*!< radius of the arc. */
+        double start,
+                /*!< start angle in radians. */
+        double end
+                /*!< end angle in radians. */
+)
+{
+        static const double quadrant_x[4] = {1.0, 0.0, -1.0, 0.0};
+        static const double quadrant_y[4] = {0.0, 1.0, 0.0, -1.0};
+        double sweep;
+        double delta;
+        int k;
+
+        radius = fabs (radius);
+        sweep = fmod (end - start, DXF_BOUNDS_TWO_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += DXF_BOUNDS_TWO_PI;
+        }
+        dxf_bounds_add_point (box, x + radius * cos (start), y + radius * sin (start), z);
+        dxf_bounds_add_point (box, x + radius * cos (end), y + radius * sin (end), z);
+        for (k = 0; k < 4; k++)
+        {
+                delta = fmod ((k * M_PI / 2.0) - start, DXF_BOUNDS_TWO_PI);
+                if (delta < 0.0)
+                {
+                        delta += DXF_BOUNDS_TWO_PI;
+                }
+                if (delta <= sweep)
+                {
+                        dxf_bounds_add_point (box,
+                          x + radius * quadrant_x[k],
+                          y + radius * quadrant_y[k], z);
+                }
+        }
+}
+
+
+/*!
+ * \brief Add a polyline segment with a bulge to a box.
+ *
+ * The bulge is the tangent of a quarter of the included angle,
+ * positive for a counterclockwise arc.
+ */
+static void
+dxf_bounds_add_bulge
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double z,
+                /*!< Z-value of the segment. */
+        double bulge
+                /*!< bulge of the segment. */
+)
+{
+        double dx;
+        double dy;
+        double chord;
+        double height;
+        double x;
+        double y;
+        double start;
+        double end;
+
+        dxf_bounds_add_point (box, x0, y0, z);
+        dxf_bounds_add_point (box, x1, y1, z);
+        dx = x1 - x0;
+        dy = y1 - y0;
+        chord = sqrt ((dx * dx) + (dy * dy));
+        if ((bulge == 0.0)
+          || (chord == 0.0))
+        {
+                return;
+        }
+        /* Distance of the center to the middle of the chord, on the
+         * left hand side for a positive value. */
+        height = chord * (1.0 - (bulge * bulge)) / (4.0 * bulge);
+        x = 0.5 * (x0 + x1) - (dy / chord) * height;
+        y = 0.5 * (y0 + y1) + (dx / chord) * height;
+        start = atan2 (y0 - y, x0 - x);
+        end = atan2 (y1 - y, x1 - x);
+        if (bulge > 0.0)
+        {
+                dxf_bounds_add_arc (box, x, y, z,
+                  chord * (1.0 + (bulge * bulge)) / (4.0 * fabs (bulge)),
+                  start, end);
+        }
+        else
+        {
+                dxf_bounds_add_arc (box, x, y, z,
+                  chord * (1.0 + (bulge * bulge)) / (4.0 * fabs (bulge)),
+                  end, start);
+        }
+}
+
+
+/*!
+ * \brief Add an elliptical arc to a box.
+ *
+ * The points of the ellipse are center + major cos (t) + minor sin (t),
+ * for every axis the extremes are at t = atan2 (minor, major) and half
+ * a turn further.
+ */
+static void
+dxf_bounds_add_ellipse
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        const double center[3],
+                /*!< the center point. */
+        const double major[3],
+                /*!< the major axis. */
+        const double minor[3],
+                /*!< the minor axis. */
+        double start,
+                /*!< start parameter in radians. */
+        double end
+                /*!< end parameter in radians, equal to \c start for a
+                 * full ellipse. */
+)
+{
+        double parameter[8];
+        double sweep;
+        double delta;
+        double t;
+        int n = 0;
+        int i;
+
+        sweep = fmod (end - start, DXF_BOUNDS_TWO_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += DXF_BOUNDS_TWO_PI;
+        }
+        parameter[n++] = start;
+        parameter[n++] = end;
+        for (i = 0; i < 3; i++)
+        {
+                t = atan2 (minor[i], major[i]);
+                parameter[n++] = t;
+                parameter[n++] = t + M_PI;
+        }
+        for (i = 0; i < n; i++)
+        {
+                delta = fmod (parameter[i] - start, DXF_BOUNDS_TWO_PI);
+                if (delta < 0.0)
+                {
+                        delta += DXF_BOUNDS_TWO_PI;
+                }
+                if ((i < 2) || (delta <= sweep))
+                {
+                        dxf_bounds_add_point (box,
+                          center[0] + major[0] * cos (parameter[i]) + minor[0] * sin (parameter[i]),
+                          center[1] + major[1] * cos (parameter[i]) + minor[1] * sin (parameter[i]),
+                          center[2] + major[2] * cos (parameter[i]) + minor[2] * sin (parameter[i]));
+                }
+        }
+}
+
+
+/*!
+ * \brief Transform a box in an Object Coordinate System to the World
+ * Coordinate System.
+ *
+ * The axes of the OCS follow from the extrusion direction with the
+ * arbitrary axis algorithm, the result is the box of the 8 transformed
+ * corners.
+ */
+static void
+dxf_bounds_ocs_to_wcs
+(
+        DxfBoundingBox *box,
+                /*!< the box to transform. */
+        double extr_x0,
+                /*!< X-value of the extrusion direction. */
+        double extr_y0,
+                /*!< Y-value of the extrusion direction. */
+        double extr_z0
+                /*!< Z-value of the extrusion direction. */
+)
+{
+        DxfBoundingBox ocs;
+        double n[3];
+        double ax[3];
+        double ay[3];
+        double length;
+        double x;
+        double y;
+        double z;
+        int i;
+
+        length = sqrt ((extr_x0 * extr_x0) + (extr_y0 * extr_y0) + (extr_z0 * extr_z0));
+        if ((length == 0.0)
+          || dxf_bounds_is_empty (box)
+          || ((extr_x0 == 0.0) && (extr_y0 == 0.0) && (extr_z0 > 0.0)))
+        {
+                return;
+        }
+        n[0] = extr_x0 / length;
+        n[1] = extr_y0 / length;
+        n[2] = extr_z0 / length;
+        if ((fabs (n[0]) < (1.0 / 64.0))
+          && (fabs (n[1]) < (1.0 / 64.0)))
+        {
+                /* World Y-axis cross N. */
+                ax[0] = n[2];
+                ax[1] = 0.0;
+                ax[2] = -n[0];
+        }
+        else
+        {
+                /* World Z-axis cross N. */
+                ax[0] = -n[1];
+                ax[1] = n[0];
+                ax[2] = 0.0;
+        }
+        length = sqrt ((ax[0] * ax[0]) + (ax[1] * ax[1]) + (ax[2] * ax[2]));
+        ax[0] /= length;
+        ax[1] /= length;
+        ax[2] /= length;
+        ay[0] = (n[1] * ax[2]) - (n[2] * ax[1]);
+        ay[1] = (n[2] * ax[0]) - (n[0] * ax[2]);
+        ay[2] = (n[0] * ax[1]) - (n[1] * ax[0]);
+        ocs = *box;
+        dxf_bounds_init (box);
+        for (i = 0; i < 8; i++)
+        {
+                x = (i & 1) ? ocs.max_x : ocs.min_x;
+                y = (i & 2) ? ocs.max_y : ocs.min_y;
+                z = (i & 4) ? ocs.max_z : ocs.min_z;
+                dxf_bounds_add_point (box,
+                  (x * ax[0]) + (y * ay[0]) + (z * n[0]),
+                  (x * ax[1]) + (y * ay[1]) + (z * n[1]),
+                  (x * ax[2]) + (y * ay[2]) + (z * n[2]));
+        }
+}
+
+
+/*!
+ * \brief Add the boundary paths of a hatch to a box.
+ *
+ * Clockwise arc and ellipse edges are added as a full circle or
+ * ellipse.
+ */
+static void
+dxf_bounds_add_hatch_paths
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        DxfHatchBoundaryPath *paths,
+                /*!< the first boundary path. */
+        double z
+                /*!< elevation of the hatch. */
+)
+{
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+        double center[3];
+        double major[3];
+        double minor[3];
+        double x0;
+        double y0;
+        double x1;
+        double y1;
+        double z1;
+        double bulge;
+        int n;
+        int i;
+
+        for (path = paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        if (polyline->offsets != NULL)
+                        {
+                                /* Single precision mode, the Z-value of
+                                 * an offset is the bulge. */
+                                n = polyline->offsets->number_of_points;
+                                for (i = 0; i < n; i++)
+                                {
+                                        dxf_point_offsets_get (polyline->offsets, i, &x0, &y0, &bulge);
+                                        if ((i == (n - 1))
+                                          && !polyline->is_closed)
+                                        {
+                                                dxf_bounds_add_point (box, x0, y0, z);
+                                                break;
+                                        }
+                                        dxf_point_offsets_get (polyline->offsets, (i + 1) % n, &x1, &y1, &z1);
+                                        dxf_bounds_add_bulge (box, x0, y0, x1, y1, z, bulge);
+                                }
+                                continue;
+                        }
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                          vertex != NULL;
+                          vertex = next)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if ((next == NULL)
+                                  && polyline->is_closed)
+                                {
+                                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                        dxf_bounds_add_bulge (box, vertex->x0, vertex->y0,
+                                          next->x0, next->y0, z, vertex->bulge);
+                                        break;
+                                }
+                                if (next == NULL)
+                                {
+                                        dxf_bounds_add_point (box, vertex->x0, vertex->y0, z);
+                                        break;
+                                }
+                                dxf_bounds_add_bulge (box, vertex->x0, vertex->y0,
+                                  next->x0, next->y0, z, vertex->bulge);
+                        }
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                  edge != NULL;
+                  edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                          line != NULL;
+                          line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_bounds_add_point (box, line->x0, line->y0, z);
+                                dxf_bounds_add_point (box, line->x1, line->y1, z);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                          arc != NULL;
+                          arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                dxf_bounds_add_arc (box, arc->x0, arc->y0, z, arc->radius,
+                                  arc->is_ccw ? (arc->start_angle * M_PI / 180.0) : 0.0,
+                                  arc->is_ccw ? (arc->end_angle * M_PI / 180.0) : 0.0);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                          ellipse != NULL;
+                          ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                center[0] = ellipse->x0;
+                                center[1] = ellipse->y0;
+                                center[2] = z;
+                                major[0] = ellipse->x1;
+                                major[1] = ellipse->y1;
+                                major[2] = 0.0;
+                                minor[0] = -ellipse->ratio * ellipse->y1;
+                                minor[1] = ellipse->ratio * ellipse->x1;
+                                minor[2] = 0.0;
+                                dxf_bounds_add_ellipse (box, center, major, minor,
+                                  ellipse->is_ccw ? (ellipse->start_angle * M_PI / 180.0) : 0.0,
+                                  ellipse->is_ccw ? (ellipse->end_angle * M_PI / 180.0) : 0.0);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                          spline != NULL;
+                          spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                                  control_point != NULL;
+                                  control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next)
+                                {
+                                        dxf_bounds_add_point (box, control_point->x0, control_point->y0, z);
+                                }
+                        }
+                }
+        }
+}
+
+
+/*!
+ * \brief Add a rotated rectangle to a box.
+ */
+static void
+dxf_bounds_add_rectangle
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        double x,
+                /*!< X-value of the lower left corner. */
+        double y,
+                /*!< Y-value of the lower left corner. */
+        double z,
+                /*!< Z-value of the rectangle. */
+        double width,
+                /*!< width of the rectangle. */
+        double height,
+                /*!< height of the rectangle. */
+        double rotation
+                /*!< rotation about the lower left corner in degrees. */
+)
+{
+        double c;
+        double s;
+
+        c = cos (rotation * M_PI / 180.0);
+        s = sin (rotation * M_PI / 180.0);
+        dxf_bounds_add_point (box, x, y, z);
+        dxf_bounds_add_point (box, x + (width * c), y + (width * s), z);
+        dxf_bounds_add_point (box, x - (height * s), y + (height * c), z);
+        dxf_bounds_add_point (box, x + (width * c) - (height * s), y + (width * s) + (height * c), z);
+}
+
+
+/*!
+ * \brief Make a bounding box empty.
+ *
+ * An empty box has its minimum above its maximum, so it grows to the
+ * first point added and never overlaps a query region.
+ */
+void
+dxf_bounds_init
+(
+        DxfBoundingBox *box
+                /*!< the box. */
+)
+{
+        box->min_x = HUGE_VAL;
+        box->min_y = HUGE_VAL;
+        box->min_z = HUGE_VAL;
+        box->max_x = -HUGE_VAL;
+        box->max_y = -HUGE_VAL;
+        box->max_z = -HUGE_VAL;
+}
+
+
+/*!
+ * \brief Test if a bounding box is empty.
+ *
+ * \return \c TRUE when empty, \c FALSE otherwise.
+ */
+int
+dxf_bounds_is_empty
+(
+        const DxfBoundingBox *box
+                /*!< the box. */
+)
+{
+        return (box->min_x > box->max_x);
+}
+
+
+/*!
+ * \brief Grow a bounding box to include a point.
+ */
+void
+dxf_bounds_add_point
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z
+                /*!< Z-value of the point. */
+)
+{
+        box->min_x = (x < box->min_x) ? x : box->min_x;
+        box->min_y = (y < box->min_y) ? y : box->min_y;
+        box->min_z = (z < box->min_z) ? z : box->min_z;
+        box->max_x = (x > box->max_x) ? x : box->max_x;
+        box->max_y = (y > box->max_y) ? y : box->max_y;
+        box->max_z = (z > box->max_z) ? z : box->max_z;
+}
+
+
+/*!
+ * \brief Grow a bounding box to include another bounding box.
+ */
+void
+dxf_bounds_merge
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        const DxfBoundingBox *other
+                /*!< the box to include, nothing is done when it is
+                 * empty. */
+)
+{
+        if (dxf_bounds_is_empty (other))
+        {
+                return;
+        }
+        dxf_bounds_add_point (box, other->min_x, other->min_y, other->min_z);
+        dxf_bounds_add_point (box, other->max_x, other->max_y, other->max_z);
+}
+
+
+/*!
+ * \brief Compute the bounding box of an entity.
+ *
+ * Boxes are in WCS, entities in an OCS are transformed with their
+ * extrusion direction. Curves are boxed exactly, for a \c SPLINE the
+ * box of the control and fit points is used (a spline lies in the
+ * convex hull of its control points), for \c TEXT and \c MTEXT the
+ * size is estimated from the text height and the number of
+ * characters.\n
+ * An \c INSERT only gets its insertion point, use
+ * dxf_bounds_get_insert () with the box of the block for more.\n
+ * The thickness of entities is not taken into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * is not supported, the entity has no coordinates or an error
+ * occurred, \c box is empty then.
+ */
+int
+dxf_bounds_get_entity
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity,
+                /*!< pointer to an entity of type \c type. */
+        DxfBoundingBox *box
+                /*!< receives the bounding box. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double center[3];
+        double major[3];
+        double minor[3];
+        double width;
+        double height;
+        double x;
+        int i;
+
+        /* Do some basic checks. */
+        if ((entity == NULL)
+          || (box == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bounds_init (box);
+        switch (type)
+        {
+                case DFACE:
+                {
+                        Dxf3dface *face = (Dxf3dface *) entity;
+                        if (face->offsets != NULL)
+                        {
+                                dxf_bounds_add_point_offsets (box, face->offsets);
+                                break;
+                        }
+                        if (face->p0 != NULL) dxf_bounds_add_point (box, face->p0->x0, face->p0->y0, face->p0->z0);
+                        if (face->p1 != NULL) dxf_bounds_add_point (box, face->p1->x0, face->p1->y0, face->p1->z0);
+                        if (face->p2 != NULL) dxf_bounds_add_point (box, face->p2->x0, face->p2->y0, face->p2->z0);
+                        if (face->p3 != NULL) dxf_bounds_add_point (box, face->p3->x0, face->p3->y0, face->p3->z0);
+                        break;
+                }
+                case ARC:
+                {
+                        DxfArc *arc = (DxfArc *) entity;
+                        if (arc->p0 == NULL) break;
+                        dxf_bounds_add_arc (box, arc->p0->x0, arc->p0->y0, arc->p0->z0,
+                          arc->radius,
+                          arc->start_angle * M_PI / 180.0,
+                          arc->end_angle * M_PI / 180.0);
+                        dxf_bounds_ocs_to_wcs (box, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+                        break;
+                }
+                case CIRCLE:
+                {
+                        DxfCircle *circle = (DxfCircle *) entity;
+                        if (circle->p0 == NULL) break;
+                        dxf_bounds_add_point (box,
+                          circle->p0->x0 - fabs (circle->radius),
+                          circle->p0->y0 - fabs (circle->radius),
+                          circle->p0->z0);
+                        dxf_bounds_add_point (box,
+                          circle->p0->x0 + fabs (circle->radius),
+                          circle->p0->y0 + fabs (circle->radius),
+                          circle->p0->z0);
+                        dxf_bounds_ocs_to_wcs (box, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+                        break;
+                }
+                case ELLIPSE:
+                {
+                        DxfEllipse *ellipse = (DxfEllipse *) entity;
+                        double n[3];
+                        double length;
+                        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL)) break;
+                        center[0] = ellipse->p0->x0;
+                        center[1] = ellipse->p0->y0;
+                        center[2] = ellipse->p0->z0;
+                        major[0] = ellipse->p1->x0;
+                        major[1] = ellipse->p1->y0;
+                        major[2] = ellipse->p1->z0;
+                        length = sqrt ((ellipse->extr_x0 * ellipse->extr_x0)
+                          + (ellipse->extr_y0 * ellipse->extr_y0)
+                          + (ellipse->extr_z0 * ellipse->extr_z0));
+                        n[0] = (length > 0.0) ? (ellipse->extr_x0 / length) : 0.0;
+                        n[1] = (length > 0.0) ? (ellipse->extr_y0 / length) : 0.0;
+                        n[2] = (length > 0.0) ? (ellipse->extr_z0 / length) : 1.0;
+                        /* The minor axis is N cross the major axis. */
+                        minor[0] = ellipse->ratio * ((n[1] * major[2]) - (n[2] * major[1]));
+                        minor[1] = ellipse->ratio * ((n[2] * major[0]) - (n[0] * major[2]));
+                        minor[2] = ellipse->ratio * ((n[0] * major[1]) - (n[1] * major[0]));
+                        dxf_bounds_add_ellipse (box, center, major, minor,
+                          ellipse->start_angle, ellipse->end_angle);
+                        break;
+                }
+                case HATCH:
+                {
+                        DxfHatch *hatch = (DxfHatch *) entity;
+                        dxf_bounds_add_hatch_paths (box, (DxfHatchBoundaryPath *) hatch->paths,
+                          (hatch->p0 != NULL) ? hatch->p0->z0 : 0.0);
+                        dxf_bounds_ocs_to_wcs (box, hatch->extr_x0, hatch->extr_y0, hatch->extr_z0);
+                        break;
+                }
+                case INSERT:
+                {
+                        dxf_bounds_get_insert ((DxfInsert *) entity, NULL, box);
+                        break;
+                }
+                case LINE:
+                {
+                        DxfLine *line = (DxfLine *) entity;
+                        if (line->offsets != NULL)
+                        {
+                                dxf_bounds_add_point_offsets (box, line->offsets);
+                                break;
+                        }
+                        if (line->p0 != NULL) dxf_bounds_add_point (box, line->p0->x0, line->p0->y0, line->p0->z0);
+                        if (line->p1 != NULL) dxf_bounds_add_point (box, line->p1->x0, line->p1->y0, line->p1->z0);
+                        break;
+                }
+                case LWPOLYLINE:
+                {
+                        DxfLWPolyline *lwpolyline = (DxfLWPolyline *) entity;
+                        int n = lwpolyline->number_vertices;
+                        int j;
+                        if (lwpolyline->single_precision)
+                        {
+                                if ((lwpolyline->x_offset == NULL) || (lwpolyline->y_offset == NULL)) break;
+                                dxf_bounds_add_offsets (box, lwpolyline->x_offset, lwpolyline->y_offset, n,
+                                  lwpolyline->origin_x, lwpolyline->origin_y, lwpolyline->common.elevation);
+                        }
+                        else
+                        {
+                                if ((lwpolyline->x == NULL) || (lwpolyline->y == NULL)) break;
+                                dxf_bounds_add_coordinates (box, lwpolyline->x, lwpolyline->y, n,
+                                  lwpolyline->common.elevation);
+                        }
+                        /* Bulged segments can reach beyond their vertices. */
+                        for (i = 0; (lwpolyline->bulge != NULL) && (i < n); i++)
+                        {
+                                if (lwpolyline->bulge[i] == 0.0) continue;
+                                j = i + 1;
+                                if (j == n)
+                                {
+                                        if (!(lwpolyline->flag & 1)) break;
+                                        j = 0;
+                                }
+                                dxf_bounds_add_bulge (box,
+                                  dxf_lwpolyline_get_vertex_x (lwpolyline, i),
+                                  dxf_lwpolyline_get_vertex_y (lwpolyline, i),
+                                  dxf_lwpolyline_get_vertex_x (lwpolyline, j),
+                                  dxf_lwpolyline_get_vertex_y (lwpolyline, j),
+                                  lwpolyline->common.elevation, lwpolyline->bulge[i]);
+                        }
+                        dxf_bounds_ocs_to_wcs (box, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+                        break;
+                }
+                case MTEXT:
+                {
+                        DxfMtext *mtext = (DxfMtext *) entity;
+                        if (mtext->p0 == NULL) break;
+                        width = (mtext->rectangle_width > 0.0)
+                          ? mtext->rectangle_width
+                          : (mtext->height * ((mtext->text_value != NULL) ? strlen (mtext->text_value) : 0));
+                        height = (mtext->rectangle_height > 0.0) ? mtext->rectangle_height : mtext->height;
+                        /* The attachment point and rotation are not
+                         * looked at, take the box that holds the text
+                         * in any of them. */
+                        x = sqrt ((width * width) + (height * height));
+                        dxf_bounds_add_point (box, mtext->p0->x0 - x, mtext->p0->y0 - x, mtext->p0->z0);
+                        dxf_bounds_add_point (box, mtext->p0->x0 + x, mtext->p0->y0 + x, mtext->p0->z0);
+                        break;
+                }
+                case POINT:
+                {
+                        DxfPoint *point = (DxfPoint *) entity;
+                        dxf_bounds_add_point (box, point->x0, point->y0, point->z0);
+                        break;
+                }
+                case POLYLINE:
+                {
+                        DxfPolyline *polyline = (DxfPolyline *) entity;
+                        DxfVertex *vertex;
+                        DxfVertex *next;
+                        /* 3D polylines and meshes are in WCS, without
+                         * bulges. */
+                        int flat = !(polyline->flag & (8 | 16 | 64));
+                        for (vertex = polyline->vertices; vertex != NULL; vertex = next)
+                        {
+                                next = (DxfVertex *) vertex->next;
+                                if (vertex->p0 == NULL) continue;
+                                if (flat && (vertex->bulge != 0.0))
+                                {
+                                        if ((next == NULL) && (polyline->flag & 1))
+                                        {
+                                                next = polyline->vertices;
+                                        }
+                                        if ((next != NULL) && (next->p0 != NULL))
+                                        {
+                                                dxf_bounds_add_bulge (box, vertex->p0->x0, vertex->p0->y0,
+                                                  next->p0->x0, next->p0->y0, vertex->p0->z0, vertex->bulge);
+                                        }
+                                        if (next == polyline->vertices) break;
+                                }
+                                dxf_bounds_add_point (box, vertex->p0->x0, vertex->p0->y0, vertex->p0->z0);
+                        }
+                        if (flat)
+                        {
+                                dxf_bounds_ocs_to_wcs (box, polyline->extr_x0, polyline->extr_y0, polyline->extr_z0);
+                        }
+                        break;
+                }
+                case SOLID:
+                {
+                        DxfSolid *solid = (DxfSolid *) entity;
+                        if (solid->p0 != NULL) dxf_bounds_add_point (box, solid->p0->x0, solid->p0->y0, solid->p0->z0);
+                        if (solid->p1 != NULL) dxf_bounds_add_point (box, solid->p1->x0, solid->p1->y0, solid->p1->z0);
+                        if (solid->p2 != NULL) dxf_bounds_add_point (box, solid->p2->x0, solid->p2->y0, solid->p2->z0);
+                        if (solid->p3 != NULL) dxf_bounds_add_point (box, solid->p3->x0, solid->p3->y0, solid->p3->z0);
+                        dxf_bounds_ocs_to_wcs (box, solid->extr_x0, solid->extr_y0, solid->extr_z0);
+                        break;
+                }
+                case SPLINE:
+                {
+                        DxfSpline *spline = (DxfSpline *) entity;
+                        dxf_bounds_add_point_list (box, spline->p0);
+                        dxf_bounds_add_point_list (box, spline->p1);
+                        break;
+                }
+                case TEXT:
+                {
+                        DxfText *text = (DxfText *) entity;
+                        if (text->p0 == NULL) break;
+                        width = text->height
+                          * ((text->rel_x_scale > 0.0) ? text->rel_x_scale : 1.0)
+                          * ((text->text_value != NULL) ? strlen (text->text_value) : 0);
+                        dxf_bounds_add_rectangle (box, text->p0->x0, text->p0->y0, text->p0->z0,
+                          width, text->height, text->rot_angle);
+                        if (((text->hor_align != 0) || (text->vert_align != 0))
+                          && (text->p1 != NULL))
+                        {
+                                dxf_bounds_add_point (box, text->p1->x0, text->p1->y0, text->p1->z0);
+                        }
+                        dxf_bounds_ocs_to_wcs (box, text->extr_x0, text->extr_y0, text->extr_z0);
+                        break;
+                }
+                case TRACE:
+                {
+                        DxfTrace *trace = (DxfTrace *) entity;
+                        if (trace->p0 != NULL) dxf_bounds_add_point (box, trace->p0->x0, trace->p0->y0, trace->p0->z0);
+                        if (trace->p1 != NULL) dxf_bounds_add_point (box, trace->p1->x0, trace->p1->y0, trace->p1->z0);
+                        if (trace->p2 != NULL) dxf_bounds_add_point (box, trace->p2->x0, trace->p2->y0, trace->p2->z0);
+                        if (trace->p3 != NULL) dxf_bounds_add_point (box, trace->p3->x0, trace->p3->y0, trace->p3->z0);
+                        dxf_bounds_ocs_to_wcs (box, trace->extr_x0, trace->extr_y0, trace->extr_z0);
+                        break;
+                }
+                case VERTEX:
+                {
+                        DxfVertex *vertex = (DxfVertex *) entity;
+                        if (vertex->p0 != NULL) dxf_bounds_add_point (box, vertex->p0->x0, vertex->p0->y0, vertex->p0->z0);
+                        break;
+                }
+                default:
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_bounds_is_empty (box) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the bounding box of an \c INSERT entity.
+ *
+ * The box of the block is scaled, rotated and moved to the insertion
+ * point, and repeated for the columns and rows of the insert.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_get_insert
+(
+        DxfInsert *insert,
+                /*!< DXF \c INSERT entity. */
+        const DxfBoundingBox *block_box,
+                /*!< bounding box of the block in block coordinates,
+                 * \c NULL when not known. */
+        DxfBoundingBox *box
+                /*!< receives the bounding box. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundingBox one;
+        double sx;
+        double sy;
+        double sz;
+        double c;
+        double s;
+        double x;
+        double y;
+        double z;
+        double dx;
+        double dy;
+        int i;
+
+        /* Do some basic checks. */
+        if ((insert == NULL)
+          || (box == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bounds_init (box);
+        if (insert->p0 == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        sx = (insert->rel_x_scale != 0.0) ? insert->rel_x_scale : 1.0;
+        sy = (insert->rel_y_scale != 0.0) ? insert->rel_y_scale : 1.0;
+        sz = (insert->rel_z_scale != 0.0) ? insert->rel_z_scale : 1.0;
+        c = cos (insert->rot_angle * M_PI / 180.0);
+        s = sin (insert->rot_angle * M_PI / 180.0);
+        dxf_bounds_init (&one);
+        if ((block_box == NULL)
+          || dxf_bounds_is_empty (block_box))
+        {
+                dxf_bounds_add_point (&one, insert->p0->x0, insert->p0->y0, insert->p0->z0);
+        }
+        else
+        {
+                for (i = 0; i < 8; i++)
+                {
+                        x = sx * ((i & 1) ? block_box->max_x : block_box->min_x);
+                        y = sy * ((i & 2) ? block_box->max_y : block_box->min_y);
+                        z = sz * ((i & 4) ? block_box->max_z : block_box->min_z);
+                        dxf_bounds_add_point (&one,
+                          insert->p0->x0 + (x * c) - (y * s),
+                          insert->p0->y0 + (x * s) + (y * c),
+                          insert->p0->z0 + z);
+                }
+        }
+        /* The corners of the array of columns and rows. */
+        for (i = 0; i < 4; i++)
+        {
+                x = ((i & 1) && (insert->columns > 1)) ? ((insert->columns - 1) * insert->column_spacing) : 0.0;
+                y = ((i & 2) && (insert->rows > 1)) ? ((insert->rows - 1) * insert->row_spacing) : 0.0;
+                dx = (x * c) - (y * s);
+                dy = (x * s) + (y * c);
+                dxf_bounds_add_point (box, one.min_x + dx, one.min_y + dy, one.min_z);
+                dxf_bounds_add_point (box, one.max_x + dx, one.max_y + dy, one.max_z);
+        }
+        dxf_bounds_ocs_to_wcs (box, insert->extr_x0, insert->extr_y0, insert->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the bounding boxes of a range of entities.
+ *
+ * \c boxes[position] receives the box of the entity at \c position for
+ * every position in [\c first, \c last), the box is empty for entities
+ * without one.\n
+ * The entities are only read, so callers may split the positions over
+ * several threads that share \c boxes.
+ *
+ * \return the number of non empty boxes, or -1 when an error occurred.
+ */
+int
+dxf_bounds_get_entities
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int first,
+                /*!< position of the first entity. */
+        int last,
+                /*!< position after the last entity. */
+        DxfBoundingBox *boxes
+                /*!< array indexed by position. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntityType type;
+        void *entity;
+        int count = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((entities == NULL)
+          || (boxes == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((first < 0)
+          || (last > dxf_entities_get_number_of_entities (entities))
+          || (first > last))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        for (i = first; i < last; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i, &type);
+                if ((entity != NULL)
+                  && (dxf_bounds_get_entity (type, entity, &boxes[i]) == EXIT_SUCCESS))
+                {
+                        count++;
+                }
+                else
+                {
+                        dxf_bounds_init (&boxes[i]);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (count);
+}
+
+
+/*!
+ * \brief Compute the extents of all entities of an \c ENTITIES
+ * section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no
+ * entity has a bounding box or an error occurred.
+ */
+int
+dxf_bounds_get_extents
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfBoundingBox *extents
+                /*!< receives the extents. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundingBox box;
+        DxfEntityType type;
+        void *entity;
+        int number_of_entities;
+        int i;
+
+        /* Do some basic checks. */
+        if ((entities == NULL)
+          || (extents == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bounds_init (extents);
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i, &type);
+                if ((entity != NULL)
+                  && (dxf_bounds_get_entity (type, entity, &box) == EXIT_SUCCESS))
+                {
+                        dxf_bounds_merge (extents, &box);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_bounds_is_empty (extents) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set \c $EXTMIN and \c $EXTMAX of a header to the extents of
+ * the entities.
+ *
+ * Call this before dxf_header_write (). The header is left alone when
+ * no entity has a bounding box.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no
+ * extents were found or an error occurred.
+ */
+int
+dxf_bounds_update_header
+(
+        DxfHeader *header,
+                /*!< DXF header. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundingBox extents;
+
+        /* Do some basic checks. */
+        if ((header == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_bounds_get_extents (entities, &extents) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        header->ExtMin.x0 = extents.min_x;
+        header->ExtMin.y0 = extents.min_y;
+        header->ExtMin.z0 = extents.min_z;
+        header->ExtMax.x0 = extents.max_x;
+        header->ExtMax.y0 = extents.max_y;
+        header->ExtMax.z0 = extents.max_z;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build a \c DxfRtree over the bounding boxes of the entities
+ * of an \c ENTITIES section.
+ *
+ * The items of the tree are the positions of the entities, entities
+ * without a bounding box are left out.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_build_rtree
+(
+        DxfRtree *rtree,
+                /*!< a pointer to an R-tree. */
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int dimensions
+                /*!< 2 to ignore the Z-values in queries, or 3. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundingBox *boxes;
+        int *positions;
+        int number_of_entities;
+        int count = 0;
+        int status;
+        int i;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        boxes = malloc ((number_of_entities + 1) * sizeof (DxfBoundingBox));
+        positions = malloc ((number_of_entities + 1) * sizeof (int));
+        if ((boxes == NULL)
+          || (positions == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (boxes);
+                free (positions);
+                return (EXIT_FAILURE);
+        }
+        dxf_bounds_get_entities (entities, 0, number_of_entities, boxes);
+        /* Pack the non empty boxes to the front. */
+        for (i = 0; i < number_of_entities; i++)
+        {
+                if (!dxf_bounds_is_empty (&boxes[i]))
+                {
+                        boxes[count] = boxes[i];
+                        positions[count] = i;
+                        count++;
+                }
+        }
+        status = dxf_rtree_build (rtree, boxes, count, dimensions);
+        if (status == EXIT_SUCCESS)
+        {
+                for (i = 0; i < rtree->number_of_items; i++)
+                {
+                        rtree->items[i] = positions[rtree->items[i]];
+                }
+        }
+        free (boxes);
+        free (positions);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,73 @@
+/*!
+ * \file bounds.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for bounding boxes of entities and drawing
+ * extents.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_BOUNDS_H
+#define LIBDXF_SRC_BOUNDS_H
+
+
+#include "global.h"
+#include "entities.h"
+#include "header.h"
+#include "rtree.h"
+#include "spline.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+void dxf_bounds_init (DxfBoundingBox *box);
+int dxf_bounds_is_empty (const DxfBoundingBox *box);
+void dxf_bounds_add_point (DxfBoundingBox *box, double x, double y, double z);
+void dxf_bounds_merge (DxfBoundingBox *box, const DxfBoundingBox *other);
+int dxf_bounds_get_entity (DxfEntityType type, void *entity, DxfBoundingBox *box);
+int dxf_bounds_get_insert (DxfInsert *insert, const DxfBoundingBox *block_box, DxfBoundingBox *box);
+int dxf_bounds_get_entities (DxfEntities *entities, int first, int last, DxfBoundingBox *boxes);
+int dxf_bounds_get_extents (DxfEntities *entities, DxfBoundingBox *extents);
+int dxf_bounds_update_header (DxfHeader *header, DxfEntities *entities);
+int dxf_bounds_build_rtree (DxfRtree *rtree, DxfEntities *entities, int dimensions);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_BOUNDS_H */
+
+
+/* EOF */
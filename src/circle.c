@@ -42,6 +42,7 @@
 
 
 #include "circle.h"
+#include "entities.h"
 
 
 /*!
@@ -118,15 +119,14 @@ dxf_circle_init
               return (NULL);
         }
         /* Initialize new structs for members. */
-        circle->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (circle->binary_graphics_data);
-        if (circle->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&circle->common) == NULL)
         {
               fprintf (stderr,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        circle->p0 = dxf_point_init (circle->p0);
+        circle->p0 = dxf_point_init (dxf_point_new ());
         if (circle->p0 == NULL)
         {
               fprintf (stderr,
@@ -135,26 +135,6 @@ dxf_circle_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        circle->id_code = 0;
-        circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        circle->layer = strdup (DXF_DEFAULT_LAYER);
-        circle->elevation = 0.0;
-        circle->thickness = 0.0;
-        circle->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        circle->visibility = DXF_DEFAULT_VISIBILITY;
-        circle->color = DXF_COLOR_BYLAYER;
-        circle->paperspace = DXF_MODELSPACE;
-        circle->graphics_data_size = 0;
-        circle->shadow_mode = 0;
-        circle->dictionary_owner_soft = strdup ("");
-        circle->object_owner_soft = strdup ("");
-        circle->material = strdup ("");
-        circle->dictionary_owner_hard = strdup ("");
-        circle->lineweight = 0;
-        circle->plot_style_name = strdup ("");
-        circle->color_value = 0;
-        circle->color_name = strdup ("");
-        circle->transparency = 0;
         circle->p0->x0 = 0.0;
         circle->p0->y0 = 0.0;
         circle->p0->z0 = 0.0;
@@ -196,9 +176,9 @@ dxf_circle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -206,8 +186,6 @@ dxf_circle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (circle == NULL)
@@ -215,273 +193,94 @@ dxf_circle_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                circle = dxf_circle_init (circle);
+                circle = dxf_circle_init (dxf_circle_new ());
+                if (circle == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter310 = (DxfBinaryData *) circle->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &circle->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (circle->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->radius);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbCircle") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->shadow_mode);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->extr_x0);
+                        break;
                 }
-                else if (strcmp (temp_string, "220") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->extr_y0);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &circle->extr_z0);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &circle->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &circle->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                circle->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                circle->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                circle->p0->z0 = atof (value);
+                                break;
+                        case 40:
+                                circle->radius = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbCircle") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                circle->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                circle->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                circle->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &circle->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (circle->linetype, "") == 0)
+        if ((circle->common.linetype == NULL)
+          || (strcmp (circle->common.linetype, "") == 0))
         {
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (circle->common.linetype);
+                circle->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (circle->layer, "") == 0)
+        if ((circle->common.layer == NULL)
+          || (strcmp (circle->common.layer, "") == 0))
         {
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                free (circle->common.layer);
+                circle->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -528,37 +327,37 @@ dxf_circle_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (circle->linetype, "") == 0)
+        if (strcmp (circle->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, circle->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, circle->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                circle->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (circle->layer, "") == 0)
+        if (strcmp (circle->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, circle->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, circle->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name );
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                circle->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (circle->radius == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () radius value equals 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, circle->id_code);
+                  (_("Warning in %s () radius value equals 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, circle->common.id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (circle->id_code != -1)
+        if (circle->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", circle->id_code);
+                dxf_handle_write (fp, 5, circle->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -570,87 +369,81 @@ dxf_circle_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (circle->dictionary_owner_soft, "") != 0)
+        if ((circle->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", circle->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, circle->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (circle->dictionary_owner_hard, "") != 0)
+        if ((circle->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", circle->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, circle->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (circle->object_owner_soft, "") != 0)
+        if ((circle->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", circle->object_owner_soft);
+                dxf_handle_write (fp, 330, circle->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (circle->paperspace == DXF_PAPERSPACE)
+        if (circle->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", circle->layer);
-        if (strcmp (circle->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", circle->common.layer);
+        if (strcmp (circle->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", circle->linetype);
+                fprintf (fp->fp, "  6\n%s\n", circle->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (circle->material, "") != 0))
+          && (circle->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", circle->material);
+                dxf_handle_write (fp, 347, circle->common.cold->material);
         }
-        if (circle->color != DXF_COLOR_BYLAYER)
+        if (circle->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", circle->color);
+                fprintf (fp->fp, " 62\n%hd\n", circle->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", circle->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", circle->common.lineweight);
         }
-        if (circle->linetype_scale != 1.0)
+        if (circle->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", circle->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", circle->common.linetype_scale);
         }
-        if (circle->visibility != 0)
+        if (circle->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", circle->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", circle->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", circle->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", circle->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", circle->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", circle->common.cold->graphics_data_size);
 #endif
-                if (circle->binary_graphics_data != NULL)
+                if (circle->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) circle->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, circle->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", circle->color_value);
-                fprintf (fp->fp, "430\n%s\n", circle->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", circle->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", circle->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", circle->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", circle->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", circle->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", circle->shadow_mode);
+                dxf_handle_write (fp, 390, circle->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", circle->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -658,13 +451,13 @@ dxf_circle_write
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (circle->elevation != 0.0))
+          && (circle->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", circle->elevation);
+                fprintf (fp->fp, " 38\n%f\n", circle->common.elevation);
         }
-        if (circle->thickness != 0.0)
+        if (circle->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", circle->thickness);
+                fprintf (fp->fp, " 39\n%f\n", circle->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", circle->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", circle->p0->y0);
@@ -679,6 +472,7 @@ dxf_circle_write
                 fprintf (fp->fp, "220\n%f\n", circle->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", circle->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &circle->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -723,11 +517,8 @@ dxf_circle_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (circle->linetype);
-        free (circle->layer);
-        dxf_binary_data_free (circle->binary_graphics_data);
-        free (circle->dictionary_owner_soft);
-        free (circle->dictionary_owner_hard);
+        dxf_entity_common_free (&circle->common);
+        dxf_point_free (circle->p0);
         free (circle);
         circle = NULL;
 #if DEBUG
@@ -764,6 +555,7 @@ dxf_circle_free_list
         while (circles != NULL)
         {
                 DxfCircle *iter = (DxfCircle *) circles->next;
+                circles->next = NULL;
                 dxf_circle_free (circles);
                 circles = (DxfCircle *) iter;
         }
@@ -773,6 +565,77 @@ dxf_circle_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c CIRCLE entity.
+ *
+ * The copy does not share any memory with \c circle, its \c next
+ * member is \c NULL.\n
+ * Of the points only the coordinates are copied.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfCircle *
+dxf_circle_copy
+(
+        DxfCircle *circle
+                /*!< a pointer to the DXF \c CIRCLE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfCircle *copy;
+
+        /* Do some basic checks. */
+        if (circle == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_circle_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, circle, sizeof (DxfCircle));
+        copy->p0 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &circle->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_circle_free (copy);
+                return (NULL);
+        }
+        if (circle->p0 != NULL)
+        {
+                copy->p0 = dxf_point_new ();
+                if (copy->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_circle_free (copy);
+                        return (NULL);
+                }
+                copy->p0->x0 = circle->p0->x0;
+                copy->p0->y0 = circle->p0->y0;
+                copy->p0->z0 = circle->p0->z0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c CIRCLE entity.
  *
@@ -781,7 +644,7 @@ dxf_circle_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_circle_get_id_code
 (
         DxfCircle *circle
@@ -799,16 +662,10 @@ dxf_circle_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->id_code);
+        return (circle->common.id_code);
 }
 
 
@@ -823,7 +680,7 @@ dxf_circle_set_id_code
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -840,13 +697,7 @@ dxf_circle_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        circle->id_code = id_code;
+        circle->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -880,7 +731,7 @@ dxf_circle_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->linetype ==  NULL)
+        if (circle->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -890,7 +741,7 @@ dxf_circle_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->linetype));
+        return (strdup (circle->common.linetype));
 }
 
 
@@ -927,7 +778,7 @@ dxf_circle_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->linetype = strdup (linetype);
+        circle->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -961,7 +812,7 @@ dxf_circle_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->layer ==  NULL)
+        if (circle->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -971,7 +822,7 @@ dxf_circle_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->layer));
+        return (strdup (circle->common.layer));
 }
 
 
@@ -1008,7 +859,7 @@ dxf_circle_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->layer = strdup (layer);
+        circle->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1045,7 +896,7 @@ dxf_circle_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->elevation);
+        return (circle->common.elevation);
 }
 
 
@@ -1075,7 +926,7 @@ dxf_circle_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->elevation = elevation;
+        circle->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1109,7 +960,7 @@ dxf_circle_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->thickness < 0.0)
+        if (circle->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1118,7 +969,7 @@ dxf_circle_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->thickness);
+        return (circle->common.thickness);
 }
 
 
@@ -1154,7 +1005,7 @@ dxf_circle_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        circle->thickness = thickness;
+        circle->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1188,7 +1039,7 @@ dxf_circle_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->linetype_scale < 0.0)
+        if (circle->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1197,7 +1048,7 @@ dxf_circle_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->linetype_scale);
+        return (circle->common.linetype_scale);
 }
 
 
@@ -1233,7 +1084,7 @@ dxf_circle_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        circle->linetype_scale = linetype_scale;
+        circle->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1267,13 +1118,13 @@ dxf_circle_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->visibility < 0)
+        if (circle->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (circle->visibility > 1)
+        if (circle->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1282,7 +1133,7 @@ dxf_circle_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->visibility);
+        return (circle->common.visibility);
 }
 
 
@@ -1324,7 +1175,7 @@ dxf_circle_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        circle->visibility = visibility;
+        circle->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1358,7 +1209,7 @@ dxf_circle_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->color < 0)
+        if (circle->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1367,7 +1218,7 @@ dxf_circle_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->color);
+        return (circle->common.color);
 }
 
 
@@ -1405,7 +1256,7 @@ dxf_circle_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        circle->color = color;
+        circle->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1439,13 +1290,13 @@ dxf_circle_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->paperspace < 0)
+        if (circle->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (circle->paperspace > 1)
+        if (circle->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1454,7 +1305,7 @@ dxf_circle_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->paperspace);
+        return (circle->common.paperspace);
 }
 
 
@@ -1496,7 +1347,7 @@ dxf_circle_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        circle->paperspace = paperspace;
+        circle->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1532,13 +1383,13 @@ dxf_circle_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->graphics_data_size < 0)
+        if (circle->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (circle->graphics_data_size == 0)
+        if (circle->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1547,7 +1398,7 @@ dxf_circle_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->graphics_data_size);
+        return (circle->common.cold->graphics_data_size);
 }
 
 
@@ -1593,7 +1444,7 @@ dxf_circle_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        circle->graphics_data_size = graphics_data_size;
+        circle->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1628,13 +1479,13 @@ dxf_circle_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (circle->shadow_mode < 0)
+        if (circle->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (circle->shadow_mode > 3)
+        if (circle->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1643,7 +1494,7 @@ dxf_circle_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->shadow_mode);
+        return (circle->common.cold->shadow_mode);
 }
 
 
@@ -1688,7 +1539,7 @@ dxf_circle_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        circle->shadow_mode = shadow_mode;
+        circle->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1697,17 +1548,18 @@ dxf_circle_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c CIRCLE entity.
  *
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_circle_get_binary_graphics_data.png
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_circle_get_binary_graphics_data
 (
         DxfCircle *circle
@@ -1725,40 +1577,34 @@ dxf_circle_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) circle->binary_graphics_data);
+        return (circle->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c CIRCLE entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * <b>Flow diagram:</b>
  * \image html drakon/dxf_circle_set_binary_graphics_data.png
  *
  * \return a pointer to \c circle when successful, or \c NULL when an
  * error occurred.
- *
- * \warning no copy is made of the contents of \c data.
  */
 DxfCircle *
 dxf_circle_set_binary_graphics_data
 (
         DxfCircle *circle,
                 /*!< a pointer to a DXF \c CIRCLE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1779,7 +1625,12 @@ dxf_circle_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->binary_graphics_data = (DxfBinaryData *) data;
+        if ((circle->common.cold->binary_graphics_data != NULL)
+          && (circle->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (circle->common.cold->binary_graphics_data);
+        }
+        circle->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1816,17 +1667,10 @@ dxf_circle_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_soft));
+        return (dxf_handle_to_string (circle->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1865,7 +1709,7 @@ dxf_circle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        circle->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1902,17 +1746,10 @@ dxf_circle_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->object_owner_soft));
+        return (dxf_handle_to_string (circle->common.cold->object_owner_soft));
 }
 
 
@@ -1951,7 +1788,7 @@ dxf_circle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->object_owner_soft = strdup (object_owner_soft);
+        circle->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1989,17 +1826,10 @@ dxf_circle_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->material));
+        return (dxf_handle_to_string (circle->common.cold->material));
 }
 
 
@@ -2040,7 +1870,7 @@ dxf_circle_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->material = strdup (material);
+        circle->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2077,17 +1907,10 @@ dxf_circle_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_hard));
+        return (dxf_handle_to_string (circle->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2126,7 +1949,7 @@ dxf_circle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        circle->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2164,7 +1987,7 @@ dxf_circle_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->lineweight);
+        return (circle->common.lineweight);
 }
 
 
@@ -2197,7 +2020,7 @@ dxf_circle_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->lineweight = lineweight;
+        circle->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2232,17 +2055,10 @@ dxf_circle_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->plot_style_name));
+        return (dxf_handle_to_string (circle->common.cold->plot_style_name));
 }
 
 
@@ -2283,7 +2099,7 @@ dxf_circle_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->plot_style_name = strdup (plot_style_name);
+        circle->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2321,7 +2137,7 @@ dxf_circle_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->color_value);
+        return (circle->common.color_value);
 }
 
 
@@ -2354,7 +2170,7 @@ dxf_circle_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->color_value = color_value;
+        circle->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2389,7 +2205,7 @@ dxf_circle_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (circle->color_name ==  NULL)
+        if (circle->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2399,7 +2215,7 @@ dxf_circle_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->color_name));
+        return (strdup (circle->common.cold->color_name));
 }
 
 
@@ -2440,7 +2256,7 @@ dxf_circle_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->color_name = strdup (color_name);
+        circle->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2478,7 +2294,7 @@ dxf_circle_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (circle->transparency);
+        return (circle->common.cold->transparency);
 }
 
 
@@ -2511,7 +2327,7 @@ dxf_circle_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->transparency = transparency;
+        circle->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -485,6 +485,7 @@ dxf_class_free_list
         while (classes != NULL)
         {
                 DxfClass *iter = (DxfClass *) classes->next;
+                classes->next = NULL;
                 dxf_class_free (classes);
                 classes = (DxfClass *) iter;
         }
@@ -2281,6 +2281,7 @@ dxf_RGB_color_free_list
         while (colors != NULL)
         {
                 DxfRGBColor *iter = (DxfRGBColor *) colors->next;
+                colors->next = NULL;
                 dxf_RGB_color_free (colors);
                 colors = (DxfRGBColor *) iter;
         }
@@ -235,6 +235,7 @@ dxf_comment_free_list
         while (comments != NULL)
         {
                 DxfComment *iter = (DxfComment *) comments->next;
+                comments->next = NULL;
                 dxf_comment_free (comments);
                 comments = (DxfComment *) iter;
         }
@@ -249,7 +250,7 @@ dxf_comment_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_comment_get_id_code
 (
         DxfComment *comment
@@ -267,13 +268,6 @@ dxf_comment_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (comment->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found in the id-code member.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -289,7 +283,7 @@ dxf_comment_set_id_code
 (
         DxfComment *comment,
                 /*!< a pointer to a DXF \c COMMENT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -306,13 +300,6 @@ dxf_comment_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         comment->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
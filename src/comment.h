@@ -57,7 +57,7 @@ extern "C" {
 typedef struct
 dxf_comment_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< group code = 5\n
                  * Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
@@ -76,8 +76,8 @@ DxfComment *dxf_comment_init (DxfComment *comment);
 int dxf_comment_write (DxfFile *fp, DxfComment *comment);
 int dxf_comment_free (DxfComment *comment);
 void dxf_comment_free_list (DxfComment *comments);
-int dxf_comment_get_id_code (DxfComment *comment);
-DxfComment *dxf_comment_set_id_code (DxfComment *comment, int id_code);
+DxfHandle dxf_comment_get_id_code (DxfComment *comment);
+DxfComment *dxf_comment_set_id_code (DxfComment *comment, DxfHandle id_code);
 char *dxf_comment_get_value (DxfComment *comment);
 DxfComment *dxf_comment_set_value (DxfComment *comment, char *value);
 DxfComment *dxf_comment_get_next (DxfComment *comment);
@@ -112,10 +112,10 @@ dxf_dictionary_init
                 return (NULL);
         }
         dictionary->id_code = 0;
-        dictionary->dictionary_owner_soft = strdup ("");
-        dictionary->dictionary_owner_hard = strdup ("");
+        dictionary->dictionary_owner_soft = DXF_HANDLE_NONE;
+        dictionary->dictionary_owner_hard = DXF_HANDLE_NONE;
         dictionary->entry_name = strdup ("");
-        dictionary->entry_object_handle = strdup ("");
+        dictionary->entry_object_handle = DXF_HANDLE_NONE;
         dictionary->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -196,8 +196,7 @@ dxf_dictionary_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dictionary->id_code);
+                        dictionary->id_code = dxf_handle_read (fp);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
@@ -217,22 +216,19 @@ dxf_dictionary_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->dictionary_owner_soft);
+                        dictionary->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "350") == 0)
                 {
                         /* Now follows a string containing a handle to ae
                          * entry object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->entry_object_handle);
+                        dictionary->entry_object_handle = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionary->dictionary_owner_hard);
+                        dictionary->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -299,7 +295,7 @@ dxf_dictionary_write
         if (strcmp (dictionary->entry_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty entry name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty entry name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dictionary->id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -308,14 +304,14 @@ dxf_dictionary_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dictionary->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dictionary->id_code != -1)
+        if (dictionary->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dictionary->id_code);
+                dxf_handle_write (fp, 5, dictionary->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -327,18 +323,18 @@ dxf_dictionary_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dictionary->dictionary_owner_soft, "") != 0)
+        if ((dictionary->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dictionary->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, dictionary->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dictionary->dictionary_owner_hard, "") != 0)
+        if ((dictionary->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dictionary->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, dictionary->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -346,7 +342,7 @@ dxf_dictionary_write
                 fprintf (fp->fp, "100\nAcDbDictionary\n");
         }
         fprintf (fp->fp, "  3\n%s\n", dictionary->entry_name);
-        fprintf (fp->fp, "350\n%s\n", dictionary->entry_object_handle);
+        dxf_handle_write (fp, 350, dictionary->entry_object_handle);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -389,10 +385,7 @@ dxf_dictionary_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dictionary->dictionary_owner_soft);
-        free (dictionary->dictionary_owner_hard);
         free (dictionary->entry_name);
-        free (dictionary->entry_object_handle);
         free (dictionary);
         dictionary = NULL;
 #if DEBUG
@@ -426,6 +419,7 @@ dxf_dictionary_free_list
         while (dictionaries != NULL)
         {
                 DxfDictionary *iter = (DxfDictionary *) dictionaries->next;
+                dictionaries->next = NULL;
                 dxf_dictionary_free (dictionaries);
                 dictionaries = (DxfDictionary *) iter;
         }
@@ -440,7 +434,7 @@ dxf_dictionary_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_dictionary_get_id_code
 (
         DxfDictionary *dictionary
@@ -458,12 +452,6 @@ dxf_dictionary_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionary->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -479,7 +467,7 @@ dxf_dictionary_set_id_code
 (
         DxfDictionary *dictionary,
                 /*!< a pointer to a DXF \c DICTIONARY object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -496,12 +484,6 @@ dxf_dictionary_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         dictionary->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -536,17 +518,10 @@ dxf_dictionary_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_soft));
+        return (dxf_handle_to_string (dictionary->dictionary_owner_soft));
 }
 
 
@@ -582,7 +557,7 @@ dxf_dictionary_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionary->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -616,17 +591,10 @@ dxf_dictionary_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_hard));
+        return (dxf_handle_to_string (dictionary->dictionary_owner_hard));
 }
 
 
@@ -662,7 +630,7 @@ dxf_dictionary_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionary->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -768,17 +736,10 @@ dxf_dictionary_get_entry_object_handle
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionary->entry_object_handle ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_object_handle));
+        return (dxf_handle_to_string (dictionary->entry_object_handle));
 }
 
 
@@ -813,7 +774,7 @@ dxf_dictionary_set_entry_object_handle
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->entry_object_handle = strdup (entry_object_handle);
+        dictionary->entry_object_handle = dxf_handle_parse (entry_object_handle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
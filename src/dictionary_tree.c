@@ -0,0 +1,1173 @@
+/*!
+ * \file dictionary_tree.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a tree of the named object dictionaries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "dictionary_tree.h"
+#include "entities.h"
+
+
+/*!
+ * \brief Hash a parent node id and an entry name.
+ *
+ * Entry names are not case sensitive, so the name is folded to upper
+ * case first.
+ */
+static unsigned int
+dxf_dictionary_tree_hash
+(
+        int parent,
+                /*!< node id of the parent dictionary. */
+        const char *name,
+                /*!< an entry name, not necessarily terminated. */
+        size_t length
+                /*!< length of \c name. */
+)
+{
+        unsigned int hash = 2166136261u;
+        size_t i;
+
+        hash = (hash ^ (unsigned int) (parent + 1)) * 16777619u;
+        for (i = 0; i < length; i++)
+        {
+                hash ^= (unsigned char) toupper ((unsigned char) name[i]);
+                hash *= 16777619u;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Compare an entry name with the first \c length characters of
+ * \c name, not case sensitive.
+ *
+ * \return \c TRUE when the names are equal, \c FALSE otherwise.
+ */
+static int
+dxf_dictionary_tree_equal
+(
+        const char *entry_name,
+                /*!< an entry name. */
+        const char *name,
+                /*!< another entry name, not necessarily terminated. */
+        size_t length
+                /*!< length of \c name. */
+)
+{
+        size_t i;
+
+        for (i = 0; i < length; i++)
+        {
+                if ((entry_name[i] == '\0')
+                  || (toupper ((unsigned char) entry_name[i]) != toupper ((unsigned char) name[i])))
+                {
+                        return (FALSE);
+                }
+        }
+        return (entry_name[length] == '\0');
+}
+
+
+/*!
+ * \brief Find the hash slot of an entry name in a parent dictionary.
+ *
+ * \return the slot holding the entry, or the empty slot where it is
+ * to be stored.
+ */
+static int
+dxf_dictionary_tree_find_slot
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        int parent,
+                /*!< node id of the parent dictionary. */
+        const char *name,
+                /*!< an entry name, not necessarily terminated. */
+        size_t length
+                /*!< length of \c name. */
+)
+{
+        DxfDictionaryTreeNode *node;
+        int mask;
+        int i;
+
+        mask = (2 * tree->nodes_size) - 1;
+        i = (int) (dxf_dictionary_tree_hash (parent, name, length) & (unsigned int) mask);
+        while (tree->slots[i] != 0)
+        {
+                node = &tree->nodes[tree->slots[i] - 1];
+                if ((node->parent == parent)
+                  && (dxf_dictionary_tree_equal (node->name, name, length)))
+                {
+                        break;
+                }
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Enter a node in the hash, unless its parent already has an
+ * entry with the same name.
+ */
+static void
+dxf_dictionary_tree_hash_node
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        int node
+                /*!< a node id. */
+)
+{
+        int slot;
+
+        slot = dxf_dictionary_tree_find_slot (tree, tree->nodes[node].parent,
+          tree->nodes[node].name, strlen (tree->nodes[node].name));
+        if (tree->slots[slot] == 0)
+        {
+                tree->slots[slot] = node + 1;
+        }
+}
+
+
+/*!
+ * \brief Double the number of nodes in a \c DxfDictionaryTree.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_dictionary_tree_grow
+(
+        DxfDictionaryTree *tree
+                /*!< a pointer to a dictionary tree. */
+)
+{
+        DxfDictionaryTreeNode *nodes;
+        int size;
+        int i;
+
+        size = (tree->nodes_size == 0) ? 64 : 2 * tree->nodes_size;
+        nodes = realloc (tree->nodes, size * sizeof (DxfDictionaryTreeNode));
+        if (nodes == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tree->nodes = nodes;
+        /* Rehash the nodes. */
+        free (tree->slots);
+        tree->slots = calloc (2 * size, sizeof (int));
+        if (tree->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tree->nodes_size = size;
+        for (i = 0; i < tree->number_of_nodes; i++)
+        {
+                dxf_dictionary_tree_hash_node (tree, i);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a node as the last entry of a parent dictionary.
+ *
+ * \return the node id, or -1 when an error occurred.
+ */
+static int
+dxf_dictionary_tree_add_node
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        int parent,
+                /*!< node id of the parent dictionary, -1 for the
+                 * root. */
+        const char *name,
+                /*!< the entry name. */
+        DxfHandle handle
+                /*!< the handle of the entry object. */
+)
+{
+        DxfDictionaryTreeNode *node;
+        int id;
+
+        if (tree->number_of_nodes == tree->nodes_size)
+        {
+                if (dxf_dictionary_tree_grow (tree) == EXIT_FAILURE)
+                {
+                        return (-1);
+                }
+        }
+        id = tree->number_of_nodes;
+        node = &tree->nodes[id];
+        node->name = strdup ((name != NULL) ? name : "");
+        if (node->name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        node->handle = handle;
+        node->type = -1;
+        node->object = NULL;
+        node->parent = parent;
+        node->first_child = -1;
+        node->last_child = -1;
+        node->next_sibling = -1;
+        tree->number_of_nodes++;
+        if (parent >= 0)
+        {
+                if (tree->nodes[parent].last_child < 0)
+                {
+                        tree->nodes[parent].first_child = id;
+                }
+                else
+                {
+                        tree->nodes[tree->nodes[parent].last_child].next_sibling = id;
+                }
+                tree->nodes[parent].last_child = id;
+        }
+        dxf_dictionary_tree_hash_node (tree, id);
+        return (id);
+}
+
+
+/*!
+ * \brief Get the \c DxfHandleIndexType of an object name.
+ */
+static int
+dxf_dictionary_tree_get_type
+(
+        const char *object_name
+                /*!< the object name following the "  0" group code. */
+)
+{
+        if ((strcmp (object_name, "DICTIONARY") == 0)
+          || (strcmp (object_name, "ACDBDICTIONARYWDFLT") == 0))
+        {
+                return (DXF_HANDLE_INDEX_DICTIONARY);
+        }
+        else if (strcmp (object_name, "GROUP") == 0)
+        {
+                return (DXF_HANDLE_INDEX_GROUP);
+        }
+        else if (strcmp (object_name, "IDBUFFER") == 0)
+        {
+                return (DXF_HANDLE_INDEX_IDBUFFER);
+        }
+        else if (strcmp (object_name, "IMAGEDEF") == 0)
+        {
+                return (DXF_HANDLE_INDEX_IMAGEDEF);
+        }
+        else if (strcmp (object_name, "MLINESTYLE") == 0)
+        {
+                return (DXF_HANDLE_INDEX_MLINESTYLE);
+        }
+        else if (strcmp (object_name, "XRECORD") == 0)
+        {
+                return (DXF_HANDLE_INDEX_XRECORD);
+        }
+        return (DXF_HANDLE_INDEX_OBJECT);
+}
+
+
+/*!
+ * \brief Look up the entry object of a handle, first in \c index, then
+ * in the scanned objects of \c tree.
+ *
+ * \return \c TRUE when the handle was found, \c FALSE otherwise.
+ */
+static int
+dxf_dictionary_tree_lookup
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        DxfHandleIndex *index,
+                /*!< a handle index with materialized objects, may be
+                 * \c NULL. */
+        DxfHandle handle,
+                /*!< the handle of the entry object. */
+        int *type,
+                /*!< receives the type of the entry object. */
+        void **object,
+                /*!< receives the entry object, may be \c NULL. */
+        DxfDictionary **dictionary
+                /*!< receives the entries of a dictionary, else
+                 * \c NULL. */
+)
+{
+        DxfDictionaryTreeObject *scanned;
+        void *pointer;
+
+        *object = NULL;
+        *dictionary = NULL;
+        if (handle == DXF_HANDLE_NONE)
+        {
+                return (FALSE);
+        }
+        if (index != NULL)
+        {
+                pointer = dxf_handle_index_find (index, handle, type);
+                if (pointer != NULL)
+                {
+                        *object = pointer;
+                        if (*type == DXF_HANDLE_INDEX_DICTIONARY)
+                        {
+                                *dictionary = (DxfDictionary *) pointer;
+                        }
+                        return (TRUE);
+                }
+        }
+        if (tree->handles != NULL)
+        {
+                scanned = dxf_handle_index_find (tree->handles, handle, NULL);
+                if (scanned != NULL)
+                {
+                        *type = scanned->type;
+                        *dictionary = scanned->dictionary;
+                        *object = scanned->dictionary;
+                        return (TRUE);
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Add the entries of the dictionary of a node as its children,
+ * and so on for the dictionaries among them.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_dictionary_tree_expand
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        DxfHandleIndex *index,
+                /*!< a handle index with materialized objects, may be
+                 * \c NULL. */
+        int node,
+                /*!< node id of a dictionary. */
+        DxfDictionary *dictionary
+                /*!< entries of the dictionary. */
+)
+{
+        DxfDictionary *iter;
+        DxfDictionary *entries;
+        void *object;
+        int child;
+        int ancestor;
+        int type;
+
+        for (iter = dictionary; iter != NULL; iter = (DxfDictionary *) iter->next)
+        {
+                if (iter->entry_object_handle == DXF_HANDLE_NONE)
+                {
+                        continue;
+                }
+                child = dxf_dictionary_tree_add_node (tree, node, iter->entry_name, iter->entry_object_handle);
+                if (child < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (!dxf_dictionary_tree_lookup (tree, index, iter->entry_object_handle, &type, &object, &entries))
+                {
+                        continue;
+                }
+                tree->nodes[child].type = type;
+                tree->nodes[child].object = object;
+                if (entries == NULL)
+                {
+                        continue;
+                }
+                /* Do not expand a dictionary twice on the same path. */
+                for (ancestor = node; ancestor >= 0; ancestor = tree->nodes[ancestor].parent)
+                {
+                        if (tree->nodes[ancestor].handle == iter->entry_object_handle)
+                        {
+                                break;
+                        }
+                }
+                if (ancestor >= 0)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () dictionary %s contains itself.\n")),
+                          __FUNCTION__, iter->entry_name);
+                        continue;
+                }
+                if (dxf_dictionary_tree_expand (tree, index, child, entries) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the scanned objects of a \c DxfDictionaryTree.
+ */
+static void
+dxf_dictionary_tree_free_objects
+(
+        DxfDictionaryTree *tree
+                /*!< a pointer to a dictionary tree. */
+)
+{
+        DxfDictionary *iter;
+        DxfDictionary *next;
+        int i;
+
+        for (i = 0; i < tree->number_of_objects; i++)
+        {
+                for (iter = tree->objects[i].dictionary; iter != NULL; iter = next)
+                {
+                        next = (DxfDictionary *) iter->next;
+                        iter->next = NULL;
+                        dxf_dictionary_free (iter);
+                }
+        }
+        free (tree->objects);
+        tree->objects = NULL;
+        tree->number_of_objects = 0;
+        tree->objects_size = 0;
+        if (tree->handles != NULL)
+        {
+                dxf_handle_index_free (tree->handles);
+                tree->handles = NULL;
+        }
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfDictionaryTree.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfDictionaryTree *
+dxf_dictionary_tree_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDictionaryTree *tree = NULL;
+        size_t size;
+
+        size = sizeof (DxfDictionaryTree);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((tree = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfDictionaryTree struct.\n")),
+                  __FUNCTION__);
+                tree = NULL;
+        }
+        else
+        {
+                memset (tree, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfDictionaryTree.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfDictionaryTree *
+dxf_dictionary_tree_init
+(
+        DxfDictionaryTree *tree
+                /*!< a pointer to a dictionary tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                tree = dxf_dictionary_tree_new ();
+        }
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (tree, 0, sizeof (DxfDictionaryTree));
+        if (dxf_dictionary_tree_grow (tree) == EXIT_FAILURE)
+        {
+                dxf_dictionary_tree_free (tree);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfDictionaryTree.
+ *
+ * The scanned objects are freed, the objects resolved from a handle
+ * index are not.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_dictionary_tree_free
+(
+        DxfDictionaryTree *tree
+                /*!< a pointer to a dictionary tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < tree->number_of_nodes; i++)
+        {
+                free (tree->nodes[i].name);
+        }
+        free (tree->nodes);
+        free (tree->slots);
+        dxf_dictionary_tree_free_objects (tree);
+        free (tree);
+        tree = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Scan a DXF \c OBJECTS section and build the dictionary tree.
+ *
+ * The file is expected to be positioned just after the
+ * "  2\nOBJECTS" lines.\n
+ * For each object the type, handle (group code 5) and byte range are
+ * recorded, the entries (group codes 3 and 350 or 360) of the
+ * dictionaries are read into \c DxfDictionary lists, up to and
+ * including the \c ENDSEC marker.\n
+ * The tree is then built with the first object of the section, the
+ * named object dictionary, as the root.\n
+ * Objects other than dictionaries are not materialized, see
+ * dxf_dictionary_tree_resolve ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_dictionary_tree_scan
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfDictionaryTree *tree
+                /*!< a pointer to a dictionary tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDictionaryTreeObject *objects;
+        DxfDictionaryTreeObject *object = NULL;
+        DxfDictionary *entry;
+        DxfDictionary *last = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char *entry_name = NULL;
+        DxfHandle owner = DXF_HANDLE_NONE;
+        int in_group = FALSE;
+        long offset;
+        int size;
+        int i;
+
+        /* Do some basic checks. */
+        if ((fp == NULL)
+          || (tree == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_dictionary_tree_free_objects (tree);
+        for (;;)
+        {
+                offset = ftell (fp->fp);
+                if ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                  || (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        free (entry_name);
+                        return (EXIT_FAILURE);
+                }
+                fp->line_number += 2;
+                if (atoi (code) == 0)
+                {
+                        if (object != NULL)
+                        {
+                                object->end = offset;
+                        }
+                        free (entry_name);
+                        entry_name = NULL;
+                        owner = DXF_HANDLE_NONE;
+                        in_group = FALSE;
+                        last = NULL;
+                        if (strcmp (value, "ENDSEC") == 0)
+                        {
+                                break;
+                        }
+                        if (tree->number_of_objects == tree->objects_size)
+                        {
+                                size = (tree->objects_size > 0)
+                                  ? 2 * tree->objects_size
+                                  : 64;
+                                objects = realloc (tree->objects, size * sizeof (DxfDictionaryTreeObject));
+                                if (objects == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (EXIT_FAILURE);
+                                }
+                                tree->objects = objects;
+                                tree->objects_size = size;
+                        }
+                        object = &tree->objects[tree->number_of_objects];
+                        tree->number_of_objects++;
+                        object->handle = DXF_HANDLE_NONE;
+                        object->type = dxf_dictionary_tree_get_type (value);
+                        object->begin = ftell (fp->fp);
+                        object->end = -1;
+                        object->dictionary = NULL;
+                        continue;
+                }
+                if (object == NULL)
+                {
+                        continue;
+                }
+                switch (atoi (code))
+                {
+                        case 3:
+                                if ((object->type == DXF_HANDLE_INDEX_DICTIONARY)
+                                  && (!in_group))
+                                {
+                                        free (entry_name);
+                                        entry_name = strdup (value);
+                                }
+                                break;
+                        case 5:
+                                object->handle = dxf_handle_parse (value);
+                                break;
+                        case 102:
+                                in_group = (value[0] == '{');
+                                break;
+                        case 330:
+                                if (!in_group)
+                                {
+                                        owner = dxf_handle_parse (value);
+                                }
+                                break;
+                        case 350:
+                        case 360:
+                                if ((object->type != DXF_HANDLE_INDEX_DICTIONARY)
+                                  || (in_group)
+                                  || (entry_name == NULL))
+                                {
+                                        break;
+                                }
+                                entry = dxf_dictionary_init (dxf_dictionary_new ());
+                                if (entry == NULL)
+                                {
+                                        free (entry_name);
+                                        return (EXIT_FAILURE);
+                                }
+                                free (entry->entry_name);
+                                entry->entry_name = entry_name;
+                                entry_name = NULL;
+                                entry->id_code = (int) object->handle;
+                                entry->dictionary_owner_soft = owner;
+                                entry->entry_object_handle = dxf_handle_parse (value);
+                                if (last == NULL)
+                                {
+                                        object->dictionary = entry;
+                                }
+                                else
+                                {
+                                        last->next = (struct DxfDictionary *) entry;
+                                }
+                                last = entry;
+                                break;
+                        default:
+                                break;
+                }
+        }
+        /* Index the scanned objects by handle. */
+        tree->handles = dxf_handle_index_init (dxf_handle_index_new ());
+        if ((tree->handles == NULL)
+          || (dxf_handle_index_reserve (tree->handles, tree->number_of_objects) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < tree->number_of_objects; i++)
+        {
+                if (tree->objects[i].handle != DXF_HANDLE_NONE)
+                {
+                        dxf_handle_index_add (tree->handles, tree->objects[i].handle,
+                          tree->objects[i].type, &tree->objects[i]);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_dictionary_tree_build (tree, NULL, DXF_HANDLE_NONE));
+}
+
+
+/*!
+ * \brief Build a dictionary tree from the named object dictionary.
+ *
+ * Replaces the nodes built before.\n
+ * The dictionaries are looked up in \c index first, as lists of
+ * \c DxfDictionary entries of type \c DXF_HANDLE_INDEX_DICTIONARY, and
+ * then in the objects scanned by dxf_dictionary_tree_scan ().\n
+ * The other entry objects found in \c index are resolved at once.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_dictionary_tree_build
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        DxfHandleIndex *index,
+                /*!< a handle index with materialized objects, may be
+                 * \c NULL. */
+        DxfHandle root
+                /*!< handle of the named object dictionary, or
+                 * \c DXF_HANDLE_NONE for the first scanned object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDictionary *dictionary;
+        void *object;
+        int type;
+        int i;
+
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < tree->number_of_nodes; i++)
+        {
+                free (tree->nodes[i].name);
+        }
+        tree->number_of_nodes = 0;
+        memset (tree->slots, 0, 2 * tree->nodes_size * sizeof (int));
+        if ((root == DXF_HANDLE_NONE)
+          && (tree->number_of_objects > 0))
+        {
+                root = tree->objects[0].handle;
+        }
+        if (!dxf_dictionary_tree_lookup (tree, index, root, &type, &object, &dictionary)
+          || (type != DXF_HANDLE_INDEX_DICTIONARY))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the named object dictionary was not found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_dictionary_tree_add_node (tree, -1, "", root) < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        tree->nodes[0].type = type;
+        tree->nodes[0].object = object;
+        if (dxf_dictionary_tree_expand (tree, index, 0, dictionary) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Resolve the entry objects of a dictionary tree to the
+ * materialized objects in a handle index.
+ *
+ * Nodes of which the handle is not in \c index are left as they are.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_dictionary_tree_resolve
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        DxfHandleIndex *index
+                /*!< a handle index with materialized objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void *object;
+        int type;
+        int i;
+
+        /* Do some basic checks. */
+        if ((tree == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < tree->number_of_nodes; i++)
+        {
+                object = dxf_handle_index_find (index, tree->nodes[i].handle, &type);
+                if (object != NULL)
+                {
+                        tree->nodes[i].type = type;
+                        tree->nodes[i].object = object;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of nodes in a \c DxfDictionaryTree.
+ *
+ * \return the number of nodes, or -1 when an error occurred.
+ */
+int
+dxf_dictionary_tree_get_number_of_nodes
+(
+        DxfDictionaryTree *tree
+                /*!< a pointer to a dictionary tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree->number_of_nodes);
+}
+
+
+/*!
+ * \brief Get a node of a \c DxfDictionaryTree.
+ *
+ * \return a pointer to the node, owned by \c tree, or \c NULL when an
+ * error occurred.
+ */
+const DxfDictionaryTreeNode *
+dxf_dictionary_tree_get_node
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        int node
+                /*!< a node id. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((node < 0)
+          || (node >= tree->number_of_nodes))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&tree->nodes[node]);
+}
+
+
+/*!
+ * \brief Find an entry of a dictionary by name.
+ *
+ * \return the node id of the entry, or -1 when there is no such entry
+ * or an error occurred.
+ */
+int
+dxf_dictionary_tree_find_child
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        int parent,
+                /*!< node id of the dictionary. */
+        const char *name
+                /*!< the entry name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int slot;
+
+        /* Do some basic checks. */
+        if ((tree == NULL)
+          || (name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((parent < 0)
+          || (parent >= tree->number_of_nodes))
+        {
+                return (-1);
+        }
+        slot = dxf_dictionary_tree_find_slot (tree, parent, name, strlen (name));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree->slots[slot] - 1);
+}
+
+
+/*!
+ * \brief Find a node by path, like "ACAD_GROUP/MyGroup".
+ *
+ * The path components are entry names separated by
+ * \c DXF_DICTIONARY_TREE_SEPARATOR, starting at the named object
+ * dictionary; an empty path is the root itself.
+ *
+ * \return the node id, or -1 when there is no such node or an error
+ * occurred.
+ */
+int
+dxf_dictionary_tree_find
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        const char *path
+                /*!< the path of the entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *end;
+        int node = 0;
+        int slot;
+
+        /* Do some basic checks. */
+        if ((tree == NULL)
+          || (path == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (tree->number_of_nodes == 0)
+        {
+                return (-1);
+        }
+        while (*path != '\0')
+        {
+                end = strchr (path, DXF_DICTIONARY_TREE_SEPARATOR);
+                if (end == NULL)
+                {
+                        end = path + strlen (path);
+                }
+                if (end > path)
+                {
+                        slot = dxf_dictionary_tree_find_slot (tree, node, path, (size_t) (end - path));
+                        node = tree->slots[slot] - 1;
+                        if (node < 0)
+                        {
+                                return (-1);
+                        }
+                }
+                path = (*end == '\0') ? end : end + 1;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (node);
+}
+
+
+/*!
+ * \brief Get the entry object at a path, like "ACAD_GROUP/MyGroup".
+ *
+ * \return a pointer to the entry object (\c DxfDictionary, \c DxfGroup,
+ * \c DxfXrecord, \c DxfMlinestyle, ...), or \c NULL when there is no
+ * such entry, it is not materialized or an error occurred.
+ */
+void *
+dxf_dictionary_tree_get_object
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        const char *path,
+                /*!< the path of the entry. */
+        int *type
+                /*!< receives the type of the entry object, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int node;
+
+        node = dxf_dictionary_tree_find (tree, path);
+        if (node < 0)
+        {
+                return (NULL);
+        }
+        if (type != NULL)
+        {
+                *type = tree->nodes[node].type;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree->nodes[node].object);
+}
+
+
+/*!
+ * \brief Get the handle of the entry object at a path.
+ *
+ * \return the handle, or \c DXF_HANDLE_NONE when there is no such
+ * entry or an error occurred.
+ */
+DxfHandle
+dxf_dictionary_tree_get_handle
+(
+        DxfDictionaryTree *tree,
+                /*!< a pointer to a dictionary tree. */
+        const char *path
+                /*!< the path of the entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int node;
+
+        node = dxf_dictionary_tree_find (tree, path);
+        if (node < 0)
+        {
+                return (DXF_HANDLE_NONE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree->nodes[node].handle);
+}
+
+
+/* EOF */
@@ -0,0 +1,170 @@
+/*!
+ * \file dictionary_tree.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a tree of the named object dictionaries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DICTIONARY_TREE_H
+#define LIBDXF_SRC_DICTIONARY_TREE_H
+
+
+#include "global.h"
+#include "dictionary.h"
+#include "handle_index.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_DICTIONARY_TREE_SEPARATOR '/'
+        /*!< \brief Separator of the entry names in a path. */
+
+
+/*!
+ * \brief Object in a scanned DXF \c OBJECTS section.
+ *
+ * Only the type, handle and byte range of the object are recorded,
+ * except for dictionaries, of which the entries are read.
+ */
+typedef struct
+dxf_dictionary_tree_object_struct
+{
+        DxfHandle handle;
+                /*!< Handle of the object.\n
+                 * Group code = 5. */
+        int type;
+                /*!< A \c DxfHandleIndexType. */
+        long begin;
+                /*!< Byte offset of the first group code following the
+                 * object name. */
+        long end;
+                /*!< Byte offset of the "  0" group code following the
+                 * object. */
+        DxfDictionary *dictionary;
+                /*!< Entries of a \c DICTIONARY object, one list node
+                 * per entry, else \c NULL. */
+} DxfDictionaryTreeObject;
+
+
+/*!
+ * \brief Node of a \c DxfDictionaryTree, one per dictionary entry.
+ */
+typedef struct
+dxf_dictionary_tree_node_struct
+{
+        char *name;
+                /*!< Entry name in the parent dictionary, an empty
+                 * string for the root.\n
+                 * Group code = 3. */
+        DxfHandle handle;
+                /*!< Handle of the entry object.\n
+                 * Group code = 350 or 360. */
+        int type;
+                /*!< A \c DxfHandleIndexType or a \c DxfEntityType of
+                 * the entry object, -1 when not known. */
+        void *object;
+                /*!< Pointer to the entry object (\c DxfDictionary,
+                 * \c DxfGroup, \c DxfXrecord, \c DxfMlinestyle, ...),
+                 * \c NULL when not materialized. */
+        int parent;
+                /*!< Node id of the parent dictionary, -1 for the root. */
+        int first_child;
+                /*!< Node id of the first entry of a dictionary, -1 when
+                 * there are none. */
+        int last_child;
+                /*!< Node id of the last entry of a dictionary, -1 when
+                 * there are none. */
+        int next_sibling;
+                /*!< Node id of the next entry in the parent dictionary,
+                 * -1 for the last entry. */
+} DxfDictionaryTreeNode;
+
+
+/*!
+ * \brief Tree of the named object dictionary and the dictionaries it
+ * owns.
+ *
+ * The children of all nodes are kept in one open addressing hash on
+ * parent node id and entry name, so a path lookup like
+ * "ACAD_GROUP/MyGroup" costs one hash probe per path component.\n
+ * Entry names are not case sensitive.\n
+ * Node 0 is the root, the named object dictionary.
+ */
+typedef struct
+dxf_dictionary_tree_struct
+{
+        DxfDictionaryTreeNode *nodes;
+                /*!< Nodes, indexed by node id. */
+        int number_of_nodes;
+                /*!< Number of nodes in use. */
+        int nodes_size;
+                /*!< Number of allocated nodes. */
+        int *slots;
+                /*!< Open addressing hash of the nodes on parent and
+                 * name, holds the node id + 1, 0 for an empty slot. */
+        DxfDictionaryTreeObject *objects;
+                /*!< Objects of a scanned \c OBJECTS section, in file
+                 * order. */
+        int number_of_objects;
+                /*!< Number of items in use in \c objects. */
+        int objects_size;
+                /*!< Number of items allocated for \c objects. */
+        DxfHandleIndex *handles;
+                /*!< Index of \c objects by handle. */
+} DxfDictionaryTree;
+
+
+DxfDictionaryTree *dxf_dictionary_tree_new ();
+DxfDictionaryTree *dxf_dictionary_tree_init (DxfDictionaryTree *tree);
+int dxf_dictionary_tree_free (DxfDictionaryTree *tree);
+int dxf_dictionary_tree_scan (DxfFile *fp, DxfDictionaryTree *tree);
+int dxf_dictionary_tree_build (DxfDictionaryTree *tree, DxfHandleIndex *index, DxfHandle root);
+int dxf_dictionary_tree_resolve (DxfDictionaryTree *tree, DxfHandleIndex *index);
+int dxf_dictionary_tree_get_number_of_nodes (DxfDictionaryTree *tree);
+const DxfDictionaryTreeNode *dxf_dictionary_tree_get_node (DxfDictionaryTree *tree, int node);
+int dxf_dictionary_tree_find_child (DxfDictionaryTree *tree, int parent, const char *name);
+int dxf_dictionary_tree_find (DxfDictionaryTree *tree, const char *path);
+void *dxf_dictionary_tree_get_object (DxfDictionaryTree *tree, const char *path, int *type);
+DxfHandle dxf_dictionary_tree_get_handle (DxfDictionaryTree *tree, const char *path);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DICTIONARY_TREE_H */
+
+
+/* EOF */
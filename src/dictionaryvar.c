@@ -196,8 +196,7 @@ dxf_dictionaryvar_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dictionaryvar->id_code);
+                        dictionaryvar->id_code = dxf_handle_read (fp);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
@@ -224,15 +223,13 @@ dxf_dictionaryvar_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionaryvar->dictionary_owner_soft);
+                        dictionaryvar->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dictionaryvar->dictionary_owner_hard);
+                        dictionaryvar->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -299,26 +296,26 @@ dxf_dictionaryvar_write
         if (strcmp (dxf_dictionaryvar_get_value (dictionaryvar), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty value string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty value string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (strcmp (dxf_dictionaryvar_get_object_schema_number (dictionaryvar), "0") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty object schema number string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty object schema number string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_dictionaryvar_get_id_code (dictionaryvar) != -1)
+        if (dxf_dictionaryvar_get_id_code (dictionaryvar) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_dictionaryvar_get_id_code (dictionaryvar));
+                dxf_handle_write (fp, 5, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         /*!
          * \todo for version R14.\n
@@ -330,18 +327,18 @@ dxf_dictionaryvar_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar), "") != 0)
+        if ((dictionaryvar->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
+                dxf_handle_write (fp, 330, dictionaryvar->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar), "") != 0)
+        if ((dictionaryvar->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
+                dxf_handle_write (fp, 360, dictionaryvar->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -392,8 +389,6 @@ dxf_dictionaryvar_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
-        free (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
         free (dxf_dictionaryvar_get_value (dictionaryvar));
         free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
         free (dictionaryvar);
@@ -429,6 +424,7 @@ dxf_dictionaryvar_free_list
         while (dictionaryvars != NULL)
         {
                 DxfDictionaryVar *iter = (DxfDictionaryVar *) dictionaryvars->next;
+                dictionaryvars->next = NULL;
                 dxf_dictionaryvar_free (dictionaryvars);
                 dictionaryvars = (DxfDictionaryVar *) iter;
         }
@@ -443,7 +439,7 @@ dxf_dictionaryvar_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_dictionaryvar_get_id_code
 (
         DxfDictionaryVar *dictionaryvar
@@ -461,12 +457,6 @@ dxf_dictionaryvar_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dictionaryvar->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -482,7 +472,7 @@ dxf_dictionaryvar_set_id_code
 (
         DxfDictionaryVar *dictionaryvar,
                 /*!< a pointer to a DXF \c DICTIONARYVAR object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -499,12 +489,6 @@ dxf_dictionaryvar_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         dictionaryvar->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -539,17 +523,10 @@ dxf_dictionaryvar_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionaryvar->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_soft));
+        return (dxf_handle_to_string (dictionaryvar->dictionary_owner_soft));
 }
 
 
@@ -585,7 +562,7 @@ dxf_dictionaryvar_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionaryvar->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -619,17 +596,10 @@ dxf_dictionaryvar_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dictionaryvar->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_hard));
+        return (dxf_handle_to_string (dictionaryvar->dictionary_owner_hard));
 }
 
 
@@ -665,7 +635,7 @@ dxf_dictionaryvar_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionaryvar->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
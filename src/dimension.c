@@ -41,6 +41,7 @@
 
 
 #include "dimension.h"
+#include "entities.h"
 
 
 /*!
@@ -115,15 +116,14 @@ dxf_dimension_init
               return (NULL);
         }
         /* Initialize new structs for members. */
-        dimension->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (dimension->binary_graphics_data);
-        if (dimension->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&dimension->common) == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
-        dimension->p0 = dxf_point_init (dimension->p0);
+        dimension->p0 = dxf_point_init (dxf_point_new ());
         if (dimension->p0 == NULL)
         {
               fprintf (stderr,
@@ -131,7 +131,7 @@ dxf_dimension_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimension->p1 = dxf_point_init (dimension->p1);
+        dimension->p1 = dxf_point_init (dxf_point_new ());
         if (dimension->p1 == NULL)
         {
               fprintf (stderr,
@@ -139,7 +139,7 @@ dxf_dimension_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimension->p2 = dxf_point_init (dimension->p2);
+        dimension->p2 = dxf_point_init (dxf_point_new ());
         if (dimension->p2 == NULL)
         {
               fprintf (stderr,
@@ -147,7 +147,7 @@ dxf_dimension_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimension->p3 = dxf_point_init (dimension->p3);
+        dimension->p3 = dxf_point_init (dxf_point_new ());
         if (dimension->p3 == NULL)
         {
               fprintf (stderr,
@@ -155,7 +155,7 @@ dxf_dimension_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimension->p4 = dxf_point_init (dimension->p4);
+        dimension->p4 = dxf_point_init (dxf_point_new ());
         if (dimension->p4 == NULL)
         {
               fprintf (stderr,
@@ -163,7 +163,7 @@ dxf_dimension_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimension->p5 = dxf_point_init (dimension->p5);
+        dimension->p5 = dxf_point_init (dxf_point_new ());
         if (dimension->p5 == NULL)
         {
               fprintf (stderr,
@@ -171,7 +171,7 @@ dxf_dimension_init
                 __FUNCTION__);
               return (NULL);
         }
-        dimension->p6 = dxf_point_init (dimension->p6);
+        dimension->p6 = dxf_point_init (dxf_point_new ());
         if (dimension->p6 == NULL)
         {
               fprintf (stderr,
@@ -180,26 +180,6 @@ dxf_dimension_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        dimension->id_code = 0;
-        dimension->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        dimension->layer = strdup (DXF_DEFAULT_LAYER);
-        dimension->elevation = 0.0;
-        dimension->thickness = 0.0;
-        dimension->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        dimension->visibility = DXF_DEFAULT_VISIBILITY;
-        dimension->color = DXF_COLOR_BYLAYER;
-        dimension->paperspace = DXF_PAPERSPACE;
-        dimension->graphics_data_size = 0;
-        dimension->shadow_mode = 0;
-        dimension->dictionary_owner_soft = strdup ("");
-        dimension->object_owner_soft = strdup ("");
-        dimension->material = strdup ("");
-        dimension->dictionary_owner_hard = strdup ("");
-        dimension->lineweight = 0;
-        dimension->plot_style_name = strdup ("");
-        dimension->color_value = 0;
-        dimension->color_name = strdup ("");
-        dimension->transparency = 0;
         dimension->dim_text = strdup ("");
         dimension->dimblock_name = strdup ("");
         dimension->dimstyle_name = strdup ("");
@@ -269,9 +249,9 @@ dxf_dimension_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -279,8 +259,6 @@ dxf_dimension_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimension == NULL)
@@ -288,513 +266,197 @@ dxf_dimension_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                dimension = dxf_dimension_init (dimension);
+                dimension = dxf_dimension_init (dxf_dimension_new ());
+                if (dimension == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter310 = (DxfBinaryData *) dimension->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * text string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dim_text);
-                }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * block name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dimblock_name);
-                }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a dimension
-                         * style name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dimstyle_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dimension->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for all
-                         * dimension types. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for all
-                         * dimension types. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for all
-                         * dimension types. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the middle point of dimension text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the middle point of dimension text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the middle point of dimension text. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the dimension block translation
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the dimension block translation
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the dimension block translation
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p3->z0);
-                }
-                else if (strcmp (temp_string, "14") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p4->x0);
-                }
-                else if (strcmp (temp_string, "24") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p4->y0);
-                }
-                else if (strcmp (temp_string, "34") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for linear and
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p4->z0);
-                }
-                else if (strcmp (temp_string, "15") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the definition point for diameter,
-                         * radius, and angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p5->x0);
-                }
-                else if (strcmp (temp_string, "25") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the definition point for diameter,
-                         * radius, and angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p5->y0);
-                }
-                else if (strcmp (temp_string, "35") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the definition point for diameter,
-                         * radius, and angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p5->z0);
-                }
-                else if (strcmp (temp_string, "16") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the point defining dimension arc for
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p6->x0);
-                }
-                else if (strcmp (temp_string, "26") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the point defining dimension arc for
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p6->y0);
-                }
-                else if (strcmp (temp_string, "36") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the point defining dimension arc for
-                         * angular dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->p6->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->thickness);
+                        break;
                 }
-                else if (strcmp (temp_string, "40") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the leader
-                         * length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->leader_length);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the text line
-                         * spacing factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->text_line_spacing_factor);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the actual
-                         * measurement. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->actual_measurement);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the angle of
-                         * rotated, horizontal, or vertical linear
-                         * dimensions. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the horizontal
-                         * direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->hor_dir);
-                }
-                else if (strcmp (temp_string, "52") == 0)
-                {
-                        /* Now follows a string containing the oblique
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->obl_angle);
-                }
-                else if (strcmp (temp_string, "53") == 0)
-                {
-                        /* Now follows a string containing the text
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->text_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a flag
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the attachment
-                         * point value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->attachment_point);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the text line
-                         * spacing value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->text_line_spacing);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                          && (strcmp (temp_string, "AcDbDimension") != 0)
-                          && (strcmp (temp_string, "AcDbAlignedDimension") != 0)
-                          && (strcmp (temp_string, "AcDbRotatedDimension") != 0)
-                          && (strcmp (temp_string, "AcDb3PointAngularDimension") != 0)
-                          && (strcmp (temp_string, "AcDbDiametricDimension") != 0)
-                          && (strcmp (temp_string, "AcDbRadialDimension") != 0)
-                          && (strcmp (temp_string, "AcDbOrdinateDimension") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &dimension->extr_z0);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the version
-                         * number value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->version_number);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &dimension->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &dimension->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 1:
+                                free (dimension->dim_text);
+                                dimension->dim_text = strdup (value);
+                                break;
+                        case 2:
+                                free (dimension->dimblock_name);
+                                dimension->dimblock_name = strdup (value);
+                                break;
+                        case 3:
+                                free (dimension->dimstyle_name);
+                                dimension->dimstyle_name = strdup (value);
+                                break;
+                        case 10:
+                                dimension->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                dimension->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                dimension->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                dimension->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                dimension->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                dimension->p1->z0 = atof (value);
+                                break;
+                        case 12:
+                                dimension->p2->x0 = atof (value);
+                                break;
+                        case 22:
+                                dimension->p2->y0 = atof (value);
+                                break;
+                        case 32:
+                                dimension->p2->z0 = atof (value);
+                                break;
+                        case 13:
+                                dimension->p3->x0 = atof (value);
+                                break;
+                        case 23:
+                                dimension->p3->y0 = atof (value);
+                                break;
+                        case 33:
+                                dimension->p3->z0 = atof (value);
+                                break;
+                        case 14:
+                                dimension->p4->x0 = atof (value);
+                                break;
+                        case 24:
+                                dimension->p4->y0 = atof (value);
+                                break;
+                        case 34:
+                                dimension->p4->z0 = atof (value);
+                                break;
+                        case 15:
+                                dimension->p5->x0 = atof (value);
+                                break;
+                        case 25:
+                                dimension->p5->y0 = atof (value);
+                                break;
+                        case 35:
+                                dimension->p5->z0 = atof (value);
+                                break;
+                        case 16:
+                                dimension->p6->x0 = atof (value);
+                                break;
+                        case 26:
+                                dimension->p6->y0 = atof (value);
+                                break;
+                        case 36:
+                                dimension->p6->z0 = atof (value);
+                                break;
+                        case 40:
+                                dimension->leader_length = atof (value);
+                                break;
+                        case 41:
+                                dimension->text_line_spacing_factor = atof (value);
+                                break;
+                        case 42:
+                                dimension->actual_measurement = atof (value);
+                                break;
+                        case 50:
+                                dimension->angle = atof (value);
+                                break;
+                        case 51:
+                                dimension->hor_dir = atof (value);
+                                break;
+                        case 52:
+                                dimension->obl_angle = atof (value);
+                                break;
+                        case 53:
+                                dimension->text_angle = atof (value);
+                                break;
+                        case 70:
+                                dimension->flag = atoi (value);
+                                break;
+                        case 71:
+                                dimension->attachment_point = atoi (value);
+                                break;
+                        case 72:
+                                dimension->text_line_spacing = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbDimension") != 0)
+                                  && (strcmp (value, "AcDbAlignedDimension") != 0)
+                                  && (strcmp (value, "AcDbRotatedDimension") != 0)
+                                  && (strcmp (value, "AcDb3PointAngularDimension") != 0)
+                                  && (strcmp (value, "AcDbDiametricDimension") != 0)
+                                  && (strcmp (value, "AcDbRadialDimension") != 0)
+                                  && (strcmp (value, "AcDbOrdinateDimension") != 0)
+                                  && (strcmp (value, "AcDb2LineAngularDimension") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                dimension->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                dimension->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                dimension->extr_z0 = atof (value);
+                                break;
+                        case 280:
+                                dimension->version_number = atoi (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &dimension->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (dxf_dimension_get_linetype (dimension), "") == 0)
+        if ((dimension->common.linetype == NULL)
+          || (strcmp (dimension->common.linetype, "") == 0))
         {
-                dxf_dimension_set_linetype (dimension, strdup (DXF_DEFAULT_LINETYPE));
+                free (dimension->common.linetype);
+                dimension->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (dxf_dimension_get_layer (dimension), "") == 0)
+        if ((dimension->common.layer == NULL)
+          || (strcmp (dimension->common.layer, "") == 0))
         {
-                dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
+                free (dimension->common.layer);
+                dimension->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -851,21 +513,21 @@ dxf_dimension_write
                 /* Clean up. */
                 free (dxf_entity_name);
         }
-        if (strcmp (dimension->layer, "") == 0)
+        if (strcmp (dimension->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, dimension->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, dimension->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dimension->layer = strdup (DXF_DEFAULT_LAYER);
+                dimension->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dimension->id_code != -1)
+        if (dimension->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dimension->id_code);
+                dxf_handle_write (fp, 5, dimension->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -877,87 +539,81 @@ dxf_dimension_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dimension->dictionary_owner_soft, "") != 0)
+        if ((dimension->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dimension->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, dimension->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dimension->dictionary_owner_hard, "") != 0)
+        if ((dimension->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dimension->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, dimension->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dimension->object_owner_soft, "") != 0)
+        if ((dimension->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", dimension->object_owner_soft);
+                dxf_handle_write (fp, 330, dimension->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (dimension->paperspace == DXF_PAPERSPACE)
+        if (dimension->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", dimension->layer);
-        if (strcmp (dimension->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", dimension->common.layer);
+        if (strcmp (dimension->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", dimension->linetype);
+                fprintf (fp->fp, "  6\n%s\n", dimension->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (dimension->material, "") != 0))
+          && (dimension->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", dimension->material);
+                dxf_handle_write (fp, 347, dimension->common.cold->material);
         }
-        if (dimension->color != DXF_COLOR_BYLAYER)
+        if (dimension->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", dimension->color);
+                fprintf (fp->fp, " 62\n%hd\n", dimension->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", dimension->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", dimension->common.lineweight);
         }
-        if (dimension->linetype_scale != 1.0)
+        if (dimension->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dimension->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", dimension->common.linetype_scale);
         }
-        if (dimension->visibility != 0)
+        if (dimension->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", dimension->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", dimension->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", dimension->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", dimension->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", dimension->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", dimension->common.cold->graphics_data_size);
 #endif
-                if (dimension->binary_graphics_data != NULL)
+                if (dimension->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) dimension->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, dimension->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", dimension->color_value);
-                fprintf (fp->fp, "430\n%s\n", dimension->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", dimension->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", dimension->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", dimension->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", dimension->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", dimension->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", dimension->shadow_mode);
+                dxf_handle_write (fp, 390, dimension->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", dimension->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -1108,10 +764,11 @@ dxf_dimension_write
                 fprintf (fp->fp, " 24\n%f\n", dimension->p4->y0);
                 fprintf (fp->fp, " 34\n%f\n", dimension->p4->z0);
         }
-        if (dimension->thickness != 0.0)
+        if (dimension->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dimension->thickness);
+                fprintf (fp->fp, " 39\n%f\n", dimension->common.thickness);
         }
+        dxf_entity_common_write_xdata (fp, &dimension->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -1154,18 +811,17 @@ dxf_dimension_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dimension->linetype);
-        free (dimension->layer);
-        dxf_binary_data_free_list (dimension->binary_graphics_data);
+        dxf_entity_common_free (&dimension->common);
+        dxf_point_free (dimension->p0);
+        dxf_point_free (dimension->p1);
+        dxf_point_free (dimension->p2);
+        dxf_point_free (dimension->p3);
+        dxf_point_free (dimension->p4);
+        dxf_point_free (dimension->p5);
+        dxf_point_free (dimension->p6);
         free (dimension->dim_text);
         free (dimension->dimblock_name);
         free (dimension->dimstyle_name);
-        free (dimension->dictionary_owner_soft);
-        free (dimension->object_owner_soft);
-        free (dimension->material);
-        free (dimension->dictionary_owner_hard);
-        free (dimension->plot_style_name);
-        free (dimension->color_name);
         free (dimension);
         dimension = NULL;
 #if DEBUG
@@ -1199,7 +855,8 @@ dxf_dimension_free_list
         }
         while (dimensions != NULL)
         {
-                DxfDimension *iter = (DxfDimension *) dxf_dimension_get_next (dimensions);
+                DxfDimension *iter = (DxfDimension *) dimensions->next;
+                dimensions->next = NULL;
                 dxf_dimension_free (dimensions);
                 dimensions = (DxfDimension *) iter;
         }
@@ -1209,12 +866,175 @@ dxf_dimension_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c DIMENSION entity.
+ *
+ * The copy does not share any memory with \c dimension, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfDimension *
+dxf_dimension_copy
+(
+        DxfDimension *dimension
+                /*!< a pointer to the DXF \c DIMENSION entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDimension *copy;
+
+        /* Do some basic checks. */
+        if (dimension == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_dimension_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, dimension, sizeof (DxfDimension));
+        copy->dim_text = NULL;
+        copy->dimblock_name = NULL;
+        copy->dimstyle_name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->p4 = NULL;
+        copy->p5 = NULL;
+        copy->p6 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &dimension->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_dimension_free (copy);
+                return (NULL);
+        }
+        if (dimension->dim_text != NULL)
+        {
+                copy->dim_text = strdup (dimension->dim_text);
+                if (copy->dim_text == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->dimblock_name != NULL)
+        {
+                copy->dimblock_name = strdup (dimension->dimblock_name);
+                if (copy->dimblock_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->dimstyle_name != NULL)
+        {
+                copy->dimstyle_name = strdup (dimension->dimstyle_name);
+                if (copy->dimstyle_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (dimension->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (dimension->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (dimension->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (dimension->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p4 != NULL)
+        {
+                copy->p4 = dxf_point_copy (dimension->p4);
+                if (copy->p4 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p5 != NULL)
+        {
+                copy->p5 = dxf_point_copy (dimension->p5);
+                if (copy->p5 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimension->p6 != NULL)
+        {
+                copy->p6 = dxf_point_copy (dimension->p6);
+                if (copy->p6 == NULL)
+                {
+                        dxf_dimension_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c DIMENSION entity.
  *
  * \return \c id_code, or \c DXF_ERROR when an error occurred.
  */
-int
+DxfHandle
 dxf_dimension_get_id_code
 (
         DxfDimension *dimension
@@ -1232,16 +1052,10 @@ dxf_dimension_get_id_code
                   __FUNCTION__);
                 return (DXF_ERROR);
         }
-        if (dimension->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->id_code);
+        return (dimension->common.id_code);
 }
 
 
@@ -1256,7 +1070,7 @@ dxf_dimension_set_id_code
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1273,13 +1087,7 @@ dxf_dimension_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        dimension->id_code = id_code;
+        dimension->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1310,7 +1118,7 @@ dxf_dimension_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->linetype ==  NULL)
+        if (dimension->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1320,7 +1128,7 @@ dxf_dimension_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->linetype));
+        return (strdup (dimension->common.linetype));
 }
 
 
@@ -1357,7 +1165,7 @@ dxf_dimension_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->linetype = strdup (linetype);
+        dimension->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1388,7 +1196,7 @@ dxf_dimension_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->layer ==  NULL)
+        if (dimension->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1398,7 +1206,7 @@ dxf_dimension_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->layer));
+        return (strdup (dimension->common.layer));
 }
 
 
@@ -1435,7 +1243,7 @@ dxf_dimension_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->layer = strdup (layer);
+        dimension->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1469,7 +1277,7 @@ dxf_dimension_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->elevation);
+        return (dimension->common.elevation);
 }
 
 
@@ -1499,7 +1307,7 @@ dxf_dimension_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->elevation = elevation;
+        dimension->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1530,7 +1338,7 @@ dxf_dimension_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->thickness < 0.0)
+        if (dimension->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1539,7 +1347,7 @@ dxf_dimension_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->thickness);
+        return (dimension->common.thickness);
 }
 
 
@@ -1575,7 +1383,7 @@ dxf_dimension_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        dimension->thickness = thickness;
+        dimension->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1606,7 +1414,7 @@ dxf_dimension_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->linetype_scale < 0.0)
+        if (dimension->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1615,7 +1423,7 @@ dxf_dimension_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->linetype_scale);
+        return (dimension->common.linetype_scale);
 }
 
 
@@ -1651,7 +1459,7 @@ dxf_dimension_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        dimension->linetype_scale = linetype_scale;
+        dimension->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1682,13 +1490,13 @@ dxf_dimension_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->visibility < 0)
+        if (dimension->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (dimension->visibility > 1)
+        if (dimension->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1697,7 +1505,7 @@ dxf_dimension_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->visibility);
+        return (dimension->common.visibility);
 }
 
 
@@ -1739,7 +1547,7 @@ dxf_dimension_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        dimension->visibility = visibility;
+        dimension->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1770,7 +1578,7 @@ dxf_dimension_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->color < 0)
+        if (dimension->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1779,7 +1587,7 @@ dxf_dimension_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->color);
+        return (dimension->common.color);
 }
 
 
@@ -1817,7 +1625,7 @@ dxf_dimension_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        dimension->color = color;
+        dimension->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1849,13 +1657,13 @@ dxf_dimension_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->paperspace < 0)
+        if (dimension->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (dimension->paperspace > 1)
+        if (dimension->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1864,7 +1672,7 @@ dxf_dimension_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->paperspace);
+        return (dimension->common.paperspace);
 }
 
 
@@ -1906,7 +1714,7 @@ dxf_dimension_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        dimension->paperspace = paperspace;
+        dimension->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1939,13 +1747,13 @@ dxf_dimension_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->graphics_data_size < 0)
+        if (dimension->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (dimension->graphics_data_size == 0)
+        if (dimension->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1954,7 +1762,7 @@ dxf_dimension_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->graphics_data_size);
+        return (dimension->common.cold->graphics_data_size);
 }
 
 
@@ -1997,7 +1805,7 @@ dxf_dimension_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        dimension->graphics_data_size = graphics_data_size;
+        dimension->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2029,13 +1837,13 @@ dxf_dimension_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (dimension->shadow_mode < 0)
+        if (dimension->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (dimension->shadow_mode > 3)
+        if (dimension->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -2044,7 +1852,7 @@ dxf_dimension_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->shadow_mode);
+        return (dimension->common.cold->shadow_mode);
 }
 
 
@@ -2086,7 +1894,7 @@ dxf_dimension_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        dimension->shadow_mode = shadow_mode;
+        dimension->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2095,15 +1903,15 @@ dxf_dimension_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the \c binary_graphics_data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c DIMENSION entity.
  *
- * \return pointer to the \c binary_graphics_data, or \c NULL when an
- * error occurred.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_dimension_get_binary_graphics_data
 (
         DxfDimension *dimension
@@ -2121,17 +1929,10 @@ dxf_dimension_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) dimension->binary_graphics_data);
+        return (dimension->common.cold->binary_graphics_data);
 }
 
 
@@ -2139,6 +1940,9 @@ dxf_dimension_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c DIMENSION entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c dimension when successful, or \c NULL when an
  * error occurred.
  */
@@ -2147,9 +1951,9 @@ dxf_dimension_set_binary_graphics_data
 (
         DxfDimension *dimension,
                 /*!< a pointer to a DXF \c DIMENSION entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -2170,7 +1974,12 @@ dxf_dimension_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->binary_graphics_data = (DxfBinaryData *) data;
+        if ((dimension->common.cold->binary_graphics_data != NULL)
+          && (dimension->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (dimension->common.cold->binary_graphics_data);
+        }
+        dimension->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2205,17 +2014,10 @@ dxf_dimension_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_soft));
+        return (dxf_handle_to_string (dimension->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2254,7 +2056,7 @@ dxf_dimension_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimension->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2288,17 +2090,10 @@ dxf_dimension_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->object_owner_soft));
+        return (dxf_handle_to_string (dimension->common.cold->object_owner_soft));
 }
 
 
@@ -2334,7 +2129,7 @@ dxf_dimension_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->object_owner_soft = strdup (object_owner_soft);
+        dimension->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2368,17 +2163,10 @@ dxf_dimension_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->material));
+        return (dxf_handle_to_string (dimension->common.cold->material));
 }
 
 
@@ -2417,7 +2205,7 @@ dxf_dimension_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->material = strdup (material);
+        dimension->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2452,17 +2240,10 @@ dxf_dimension_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_hard));
+        return (dxf_handle_to_string (dimension->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2501,7 +2282,7 @@ dxf_dimension_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimension->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2536,7 +2317,7 @@ dxf_dimension_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->lineweight);
+        return (dimension->common.lineweight);
 }
 
 
@@ -2566,7 +2347,7 @@ dxf_dimension_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->lineweight = lineweight;
+        dimension->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2598,17 +2379,10 @@ dxf_dimension_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->plot_style_name));
+        return (dxf_handle_to_string (dimension->common.cold->plot_style_name));
 }
 
 
@@ -2646,7 +2420,7 @@ dxf_dimension_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->plot_style_name = strdup (plot_style_name);
+        dimension->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2681,7 +2455,7 @@ dxf_dimension_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->color_value);
+        return (dimension->common.color_value);
 }
 
 
@@ -2711,7 +2485,7 @@ dxf_dimension_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->color_value = color_value;
+        dimension->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2743,7 +2517,7 @@ dxf_dimension_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimension->color_name ==  NULL)
+        if (dimension->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2753,7 +2527,7 @@ dxf_dimension_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->color_name));
+        return (strdup (dimension->common.cold->color_name));
 }
 
 
@@ -2791,7 +2565,7 @@ dxf_dimension_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->color_name = strdup (color_name);
+        dimension->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2826,7 +2600,7 @@ dxf_dimension_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (dimension->transparency);
+        return (dimension->common.cold->transparency);
 }
 
 
@@ -2856,7 +2630,7 @@ dxf_dimension_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->transparency = transparency;
+        dimension->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
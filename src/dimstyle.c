@@ -154,9 +154,9 @@ dxf_dimstyle_init
         dimstyle->dimclrd = DXF_COLOR_BYLAYER;
         dimstyle->dimclre = DXF_COLOR_BYLAYER;
         dimstyle->dimclrt = DXF_COLOR_BYLAYER;
-        dimstyle->dictionary_owner_soft = strdup ("");
-        dimstyle->object_owner_soft = strdup ("");
-        dimstyle->dictionary_owner_hard = strdup ("");
+        dimstyle->dictionary_owner_soft = DXF_HANDLE_NONE;
+        dimstyle->object_owner_soft = DXF_HANDLE_NONE;
+        dimstyle->dictionary_owner_hard = DXF_HANDLE_NONE;
         dimstyle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -270,8 +270,7 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dimstyle->id_code);
+                        dimstyle->id_code = dxf_handle_read (fp);
                 }
 #endif
                 else if ((fp->acad_version_number < AutoCAD_2000)
@@ -292,8 +291,7 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dimstyle->id_code);
+                        dimstyle->id_code = dxf_handle_read (fp);
                 }
 #endif
                 else if (strcmp (temp_string, "40") == 0)
@@ -441,8 +439,7 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &dimstyle->id_code);
+                        dimstyle->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "140") == 0)
                 {
@@ -681,15 +678,13 @@ dxf_dimstyle_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dictionary_owner_soft);
+                                dimstyle->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->object_owner_soft);
+                                dimstyle->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -697,15 +692,13 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing dimension
                          * text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimtxsty);
+                        dimstyle->dimtxsty = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dictionary_owner_hard);
+                        dimstyle->dictionary_owner_hard = dxf_handle_read (fp);
                 }
         }
         /* Handle omitted members and/or illegal values. */
@@ -794,7 +787,7 @@ dxf_dimstyle_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dimstyle->id_code);
         }
         if (!dimstyle->dimpost)
@@ -819,9 +812,9 @@ dxf_dimstyle_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dimstyle->id_code != -1)
+        if (dimstyle->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "105\n%x\n", dimstyle->id_code);
+                dxf_handle_write (fp, 105, dimstyle->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -833,24 +826,24 @@ dxf_dimstyle_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dimstyle->dictionary_owner_soft, "") != 0)
+        if ((dimstyle->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dimstyle->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, dimstyle->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dimstyle->dictionary_owner_hard, "") != 0)
+        if ((dimstyle->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dimstyle->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, dimstyle->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dimstyle->object_owner_soft, "") != 0)
+        if ((dimstyle->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", dimstyle->object_owner_soft);
+                dxf_handle_write (fp, 330, dimstyle->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -918,7 +911,7 @@ dxf_dimstyle_write
                 fprintf (fp->fp, "272\n%hd\n", dimstyle->dimtdec);
                 fprintf (fp->fp, "273\n%hd\n", dimstyle->dimaltu);
                 fprintf (fp->fp, "274\n%hd\n", dimstyle->dimalttd);
-                fprintf (fp->fp, "340\n%s\n", dimstyle->dimtxsty);
+                dxf_handle_write (fp, 340, dimstyle->dimtxsty);
                 fprintf (fp->fp, "275\n%hd\n", dimstyle->dimaunit);
                 fprintf (fp->fp, "280\n%hd\n", dimstyle->dimjust);
                 fprintf (fp->fp, "281\n%hd\n", dimstyle->dimsd1);
@@ -979,9 +972,6 @@ dxf_dimstyle_free
         free (dimstyle->dimblk);
         free (dimstyle->dimblk1);
         free (dimstyle->dimblk2);
-        free (dimstyle->dictionary_owner_soft);
-        free (dimstyle->object_owner_soft);
-        free (dimstyle->dictionary_owner_hard);
         free (dimstyle);
         dimstyle = NULL;
 #if DEBUG
@@ -1015,6 +1005,7 @@ dxf_dimstyle_free_list
         while (dimstyles != NULL)
         {
                 DxfDimStyle *iter = (DxfDimStyle *) dimstyles->next;
+                dimstyles->next = NULL;
                 dxf_dimstyle_free (dimstyles);
                 dimstyles = (DxfDimStyle *) iter;
         }
@@ -1024,6 +1015,130 @@ dxf_dimstyle_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c DIMSTYLE symbol table entry.
+ *
+ * The copy does not share any memory with \c dimstyle, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfDimStyle *
+dxf_dimstyle_copy
+(
+        DxfDimStyle *dimstyle
+                /*!< a pointer to the DXF \c DIMSTYLE symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDimStyle *copy;
+
+        /* Do some basic checks. */
+        if (dimstyle == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_dimstyle_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, dimstyle, sizeof (DxfDimStyle));
+        copy->dimstyle_name = NULL;
+        copy->dimpost = NULL;
+        copy->dimapost = NULL;
+        copy->dimblk = NULL;
+        copy->dimblk1 = NULL;
+        copy->dimblk2 = NULL;
+        copy->next = NULL;
+        if (dimstyle->dimstyle_name != NULL)
+        {
+                copy->dimstyle_name = strdup (dimstyle->dimstyle_name);
+                if (copy->dimstyle_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimstyle_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimstyle->dimpost != NULL)
+        {
+                copy->dimpost = strdup (dimstyle->dimpost);
+                if (copy->dimpost == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimstyle_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimstyle->dimapost != NULL)
+        {
+                copy->dimapost = strdup (dimstyle->dimapost);
+                if (copy->dimapost == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimstyle_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimstyle->dimblk != NULL)
+        {
+                copy->dimblk = strdup (dimstyle->dimblk);
+                if (copy->dimblk == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimstyle_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimstyle->dimblk1 != NULL)
+        {
+                copy->dimblk1 = strdup (dimstyle->dimblk1);
+                if (copy->dimblk1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimstyle_free (copy);
+                        return (NULL);
+                }
+        }
+        if (dimstyle->dimblk2 != NULL)
+        {
+                copy->dimblk2 = strdup (dimstyle->dimblk2);
+                if (copy->dimblk2 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_dimstyle_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the dimension style name string value (\c dimstyle_name)
  * from this DXF dimension style symbol table (\c DIMSTYLE).
@@ -2837,7 +2952,7 @@ dxf_dimstyle_set_dimzin
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_dimstyle_get_id_code
 (
         DxfDimStyle *dimstyle
@@ -2875,7 +2990,7 @@ dxf_dimstyle_set_id_code
         DxfDimStyle *dimstyle,
                 /*!< a pointer to a DXF dimenstion style symbol table
                  * (\c DIMSTYLE). */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -5423,17 +5538,10 @@ dxf_dimstyle_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimstyle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dictionary_owner_soft));
+        return (dxf_handle_to_string (dimstyle->dictionary_owner_soft));
 }
 
 
@@ -5472,7 +5580,7 @@ dxf_dimstyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimstyle->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5506,17 +5614,10 @@ dxf_dimstyle_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimstyle->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->object_owner_soft));
+        return (dxf_handle_to_string (dimstyle->object_owner_soft));
 }
 
 
@@ -5555,7 +5656,7 @@ dxf_dimstyle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->object_owner_soft = strdup (object_owner_soft);
+        dimstyle->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5589,17 +5690,10 @@ dxf_dimstyle_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimstyle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dictionary_owner_hard));
+        return (dxf_handle_to_string (dimstyle->dictionary_owner_hard));
 }
 
 
@@ -5638,7 +5732,7 @@ dxf_dimstyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimstyle->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5671,17 +5765,10 @@ dxf_dimstyle_get_dimtxsty
                   __FUNCTION__);
                 return (NULL);
         }
-        if (dimstyle->dimtxsty == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimtxsty));
+        return (dxf_handle_to_string (dimstyle->dimtxsty));
 }
 
 
@@ -5721,7 +5808,7 @@ dxf_dimstyle_set_dimtxsty
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimtxsty = strdup (dimtxsty);
+        dimstyle->dimtxsty = dxf_handle_parse (dimtxsty);
 #if DEBUG
         DXF_DEBUG_END
 #endif
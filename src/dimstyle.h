@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -142,7 +143,7 @@ dxf_dimstyle_struct
         int16_t dimzin;
                 /*!< Zero suppression for "feet & inch" dimensions.\n
                  * Group code = 78. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -315,18 +316,18 @@ dxf_dimstyle_struct
                  * the dimension line location.</li>
                  * </ol>
                  * Group code = 288. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dimtxsty;
+        DxfHandle dimtxsty;
                 /*!< Dimension text style.\n
                  * Group code = 340. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -342,6 +343,7 @@ DxfDimStyle *dxf_dimstyle_read (DxfFile *fp, DxfDimStyle *dimstyle);
 int dxf_dimstyle_write (DxfFile *fp, DxfDimStyle *dimstyle);
 int dxf_dimstyle_free (DxfDimStyle *dimstyle);
 void dxf_dimstyle_free_list (DxfDimStyle *dimstyles);
+DxfDimStyle *dxf_dimstyle_copy (DxfDimStyle *dimstyle);
 char *dxf_dimstyle_get_dimstyle_name (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimstyle_name (DxfDimStyle *dimstyle, char *dimstyle_name);
 char *dxf_dimstyle_get_dimpost (DxfDimStyle *dimstyle);
@@ -390,8 +392,8 @@ int16_t dxf_dimstyle_get_dimtad (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimtad (DxfDimStyle *dimstyle, int16_t dimtad);
 int16_t dxf_dimstyle_get_dimzin (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimzin (DxfDimStyle *dimstyle, int16_t dimzin);
-int dxf_dimstyle_get_id_code (DxfDimStyle *dimstyle);
-DxfDimStyle *dxf_dimstyle_set_id_code (DxfDimStyle *dimstyle, int id_code);
+DxfHandle dxf_dimstyle_get_id_code (DxfDimStyle *dimstyle);
+DxfDimStyle *dxf_dimstyle_set_id_code (DxfDimStyle *dimstyle, DxfHandle id_code);
 double dxf_dimstyle_get_dimtxt (DxfDimStyle *dimstyle);
 DxfDimStyle *dxf_dimstyle_set_dimtxt (DxfDimStyle *dimstyle, double dimtxt);
 double dxf_dimstyle_get_dimcen (DxfDimStyle *dimstyle);
@@ -119,8 +119,7 @@ dxf_donut_init
                 return (NULL);
         }
         /* Initialize new structs for members. */
-        donut->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (donut->binary_graphics_data);
-        if (donut->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&donut->common) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -129,29 +128,15 @@ dxf_donut_init
         }
         /* Assign initial values to members. */
         /* Members common for all DXF drawable entities. */
-        donut->id_code = 0;
-        donut->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        donut->layer = strdup (DXF_DEFAULT_LAYER);
-        donut->elevation = 0.0;
-        donut->thickness = 0.0;
-        donut->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        donut->visibility = DXF_DEFAULT_VISIBILITY;
-        donut->color = DXF_COLOR_BYLAYER;
-        donut->paperspace = DXF_MODELSPACE;
-        donut->graphics_data_size = 0;
-        donut->shadow_mode = 0;
-        donut->dictionary_owner_soft = strdup ("");
-        donut->material = strdup ("");
-        donut->dictionary_owner_hard = strdup ("");
-        donut->lineweight = 0;
-        donut->plot_style_name = strdup ("");
-        donut->color_value = 0;
-        donut->color_name = strdup ("");
-        donut->transparency = 0;
         /* Specific members for a libDXF donut. */
-        donut->p0->x0 = 0.0;
-        donut->p0->y0 = 0.0;
-        donut->p0->z0 = 0.0;
+        donut->p0 = dxf_point_init (dxf_point_new ());
+        if (donut->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         donut->outside_diameter = 0.0;
         donut->inside_diameter = 0.0;
         donut->next = NULL;
@@ -190,7 +175,7 @@ dxf_donut_write
         char *dxf_entity_name = strdup ("POLYLINE");
         double start_width;
         double end_width;
-        int id_code = -1;
+        DxfHandle id_code = DXF_HANDLE_NONE;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -214,7 +199,7 @@ dxf_donut_write
         if (dxf_donut_get_outside_diameter (donut) > dxf_donut_get_inside_diameter (donut))
         {
                 fprintf (stderr,
-                  (_("Error in %s () outside diameter is smaller than the inside diameter for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () outside diameter is smaller than the inside diameter for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -225,7 +210,7 @@ dxf_donut_write
         if (strcmp (dxf_donut_get_linetype (donut), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_donut_get_id_code (donut));
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
@@ -235,7 +220,7 @@ dxf_donut_write
         if (strcmp (dxf_donut_get_layer (donut), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
@@ -247,18 +232,18 @@ dxf_donut_write
         polyline = dxf_polyline_init (polyline);
         id_code = fp->last_id_code;
         id_code++;
-        polyline->id_code = id_code;
-        polyline->linetype = dxf_donut_get_linetype (donut);
-        polyline->layer = dxf_donut_get_layer (donut);
+        polyline->common.id_code = id_code;
+        polyline->common.linetype = dxf_donut_get_linetype (donut);
+        polyline->common.layer = dxf_donut_get_layer (donut);
         polyline->p0->x0 = dxf_donut_get_x0 (donut);
         polyline->p0->y0 = dxf_donut_get_y0 (donut);
         polyline->p0->z0 = dxf_donut_get_z0 (donut);
-        polyline->thickness = dxf_donut_get_thickness (donut);
+        polyline->common.thickness = dxf_donut_get_thickness (donut);
         polyline->start_width = 0.5 * start_width;
         polyline->end_width = 0.5 * end_width;
-        polyline->color = dxf_donut_get_color (donut);
+        polyline->common.color = dxf_donut_get_color (donut);
         polyline->vertices_follow = 1;
-        polyline->paperspace = dxf_donut_get_paperspace (donut);
+        polyline->common.paperspace = dxf_donut_get_paperspace (donut);
         polyline->flag = 1;
         polyline->polygon_mesh_M_vertex_count = 0;
         polyline->polygon_mesh_N_vertex_count = 0;
@@ -272,19 +257,19 @@ dxf_donut_write
         vertex_1 = dxf_vertex_init (vertex_1);
         id_code = fp->last_id_code;
         id_code++;
-        vertex_1->id_code = id_code;
-        vertex_1->layer = dxf_donut_get_layer (donut);
-        vertex_1->linetype = dxf_donut_get_linetype (donut);
+        vertex_1->common.id_code = id_code;
+        vertex_1->common.layer = dxf_donut_get_layer (donut);
+        vertex_1->common.linetype = dxf_donut_get_linetype (donut);
         vertex_1->p0->x0 = dxf_donut_get_x0 (donut) - (0.25 * (dxf_donut_get_outside_diameter (donut) + dxf_donut_get_inside_diameter (donut)));
         vertex_1->p0->y0 = dxf_donut_get_y0 (donut);
         vertex_1->p0->z0 = dxf_donut_get_z0 (donut);
-        vertex_1->thickness = dxf_donut_get_thickness (donut);
+        vertex_1->common.thickness = dxf_donut_get_thickness (donut);
         vertex_1->start_width = 0.5 * start_width;
         vertex_1->end_width = 0.5 * end_width;
         vertex_1->bulge = 1;
         vertex_1->curve_fit_tangent_direction = 0.0;
-        vertex_1->color = dxf_donut_get_color (donut);
-        vertex_1->paperspace = dxf_donut_get_paperspace (donut);
+        vertex_1->common.color = dxf_donut_get_color (donut);
+        vertex_1->common.paperspace = dxf_donut_get_paperspace (donut);
         vertex_1->flag = 0;
         dxf_vertex_write (fp, vertex_1);
         /*! \todo Hook up this vertex to the list of vertices. */
@@ -293,19 +278,19 @@ dxf_donut_write
         vertex_2 = dxf_vertex_init (vertex_2);
         id_code = fp->last_id_code;
         id_code++;
-        vertex_2->id_code = id_code;
-        vertex_2->layer = dxf_donut_get_layer (donut);
-        vertex_2->linetype = dxf_donut_get_linetype (donut);
+        vertex_2->common.id_code = id_code;
+        vertex_2->common.layer = dxf_donut_get_layer (donut);
+        vertex_2->common.linetype = dxf_donut_get_linetype (donut);
         vertex_2->p0->x0 = dxf_donut_get_x0 (donut) + (0.25 * (dxf_donut_get_outside_diameter (donut) + dxf_donut_get_inside_diameter (donut)));
         vertex_2->p0->y0 = dxf_donut_get_y0 (donut);
         vertex_2->p0->z0 = dxf_donut_get_z0 (donut);
-        vertex_2->thickness = dxf_donut_get_thickness (donut);
+        vertex_2->common.thickness = dxf_donut_get_thickness (donut);
         vertex_2->start_width = 0.5 * start_width;
         vertex_2->end_width = 0.5 * end_width;
         vertex_2->bulge = 1;
         vertex_2->curve_fit_tangent_direction = 0.0;
-        vertex_2->color = dxf_donut_get_color (donut);
-        vertex_2->paperspace = dxf_donut_get_paperspace (donut);
+        vertex_2->common.color = dxf_donut_get_color (donut);
+        vertex_2->common.paperspace = dxf_donut_get_paperspace (donut);
         vertex_2->flag = 0;
         dxf_vertex_write (fp, vertex_2);
         /*! \todo Hook up this vertex to the list of vertices. */
@@ -314,11 +299,12 @@ dxf_donut_write
         seqend = dxf_seqend_init (seqend);
         id_code = fp->last_id_code;
         id_code++;
-        seqend->id_code = id_code;
-        seqend->layer = dxf_donut_get_layer (donut);
-        seqend->linetype = dxf_donut_get_linetype (donut);
+        seqend->common.id_code = id_code;
+        seqend->common.layer = dxf_donut_get_layer (donut);
+        seqend->common.linetype = dxf_donut_get_linetype (donut);
         dxf_seqend_write (fp, seqend);
         /*! \todo Hook up this seqend to the list of seqends. */
+        dxf_entity_common_write_xdata (fp, &donut->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -361,10 +347,7 @@ dxf_donut_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (donut->linetype);
-        free (donut->layer);
-        free (donut->dictionary_owner_soft);
-        free (donut->dictionary_owner_hard);
+        dxf_entity_common_free (&donut->common);
         free (donut);
         donut = NULL;
 #if DEBUG
@@ -398,6 +381,7 @@ dxf_donut_free_list
         while (donuts != NULL)
         {
                 DxfDonut *iter = (DxfDonut *) donuts->next;
+                donuts->next = NULL;
                 dxf_donut_free (donuts);
                 donuts = (DxfDonut *) iter;
         }
@@ -412,7 +396,7 @@ dxf_donut_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_donut_get_id_code
 (
         DxfDonut *donut
@@ -430,16 +414,10 @@ dxf_donut_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->id_code);
+        return (donut->common.id_code);
 }
 
 
@@ -454,7 +432,7 @@ dxf_donut_set_id_code
 (
         DxfDonut *donut,
                 /*!< a pointer to a libDXF \c donut entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -471,13 +449,7 @@ dxf_donut_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        donut->id_code = id_code;
+        donut->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -509,7 +481,7 @@ dxf_donut_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->linetype ==  NULL)
+        if (donut->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -519,7 +491,7 @@ dxf_donut_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->linetype));
+        return (strdup (donut->common.linetype));
 }
 
 
@@ -559,7 +531,7 @@ dxf_donut_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->linetype = strdup (linetype);
+        donut->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -591,7 +563,7 @@ dxf_donut_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->layer ==  NULL)
+        if (donut->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -601,7 +573,7 @@ dxf_donut_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->layer));
+        return (strdup (donut->common.layer));
 }
 
 
@@ -640,7 +612,7 @@ dxf_donut_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->layer = strdup (layer);
+        donut->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -674,7 +646,7 @@ dxf_donut_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->elevation);
+        return (donut->common.elevation);
 }
 
 
@@ -704,7 +676,7 @@ dxf_donut_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->elevation = elevation;
+        donut->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -735,7 +707,7 @@ dxf_donut_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->thickness < 0.0)
+        if (donut->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -744,7 +716,7 @@ dxf_donut_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->thickness);
+        return (donut->common.thickness);
 }
 
 
@@ -780,7 +752,7 @@ dxf_donut_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        donut->thickness = thickness;
+        donut->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -811,7 +783,7 @@ dxf_donut_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->linetype_scale < 0.0)
+        if (donut->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -820,7 +792,7 @@ dxf_donut_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->linetype_scale);
+        return (donut->common.linetype_scale);
 }
 
 
@@ -856,7 +828,7 @@ dxf_donut_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        donut->linetype_scale = linetype_scale;
+        donut->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -887,13 +859,13 @@ dxf_donut_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->visibility < 0)
+        if (donut->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (donut->visibility > 1)
+        if (donut->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -902,7 +874,7 @@ dxf_donut_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->visibility);
+        return (donut->common.visibility);
 }
 
 
@@ -944,7 +916,7 @@ dxf_donut_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        donut->visibility = visibility;
+        donut->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -975,7 +947,7 @@ dxf_donut_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->color < 0)
+        if (donut->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -984,7 +956,7 @@ dxf_donut_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->color);
+        return (donut->common.color);
 }
 
 
@@ -1022,7 +994,7 @@ dxf_donut_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        donut->color = color;
+        donut->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1054,13 +1026,13 @@ dxf_donut_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->paperspace < 0)
+        if (donut->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (donut->paperspace > 1)
+        if (donut->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1069,7 +1041,7 @@ dxf_donut_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->paperspace);
+        return (donut->common.paperspace);
 }
 
 
@@ -1111,7 +1083,7 @@ dxf_donut_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        donut->paperspace = paperspace;
+        donut->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1144,13 +1116,13 @@ dxf_donut_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->graphics_data_size < 0)
+        if (donut->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (donut->graphics_data_size == 0)
+        if (donut->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a value of zero was found.\n")),
@@ -1159,7 +1131,7 @@ dxf_donut_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->graphics_data_size);
+        return (donut->common.cold->graphics_data_size);
 }
 
 
@@ -1202,7 +1174,7 @@ dxf_donut_set_graphics_data_size
                   (_("Warning in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
         }
-        donut->graphics_data_size = graphics_data_size;
+        donut->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1234,13 +1206,13 @@ dxf_donut_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (donut->shadow_mode < 0)
+        if (donut->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (donut->shadow_mode > 3)
+        if (donut->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1249,7 +1221,7 @@ dxf_donut_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->shadow_mode);
+        return (donut->common.cold->shadow_mode);
 }
 
 
@@ -1291,7 +1263,7 @@ dxf_donut_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        donut->shadow_mode = shadow_mode;
+        donut->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1300,18 +1272,19 @@ dxf_donut_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the \c binary_graphics_data from a libDXF
- * \c donut entity.
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
+ * \c DONUT entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_donut_get_binary_graphics_data
 (
         DxfDonut *donut
-                /*!< a pointer to a libDXF \c donut entity. */
+                /*!< a pointer to a DXF \c DONUT entity. */
 )
 {
 #if DEBUG
@@ -1325,32 +1298,31 @@ dxf_donut_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) donut->binary_graphics_data);
+        return (donut->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the \c binary_graphics_data for a libDXF
- * \c donut entity.
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
+ * \c DONUT entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c donut when successful, or \c NULL when an
+ * error occurred.
  */
 DxfDonut *
 dxf_donut_set_binary_graphics_data
 (
         DxfDonut *donut,
-                /*!< a pointer to a libDXF \c donut entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+                /*!< a pointer to a DXF \c DONUT entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1371,7 +1343,12 @@ dxf_donut_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->binary_graphics_data = (DxfBinaryData *) data;
+        if ((donut->common.cold->binary_graphics_data != NULL)
+          && (donut->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (donut->common.cold->binary_graphics_data);
+        }
+        donut->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1405,17 +1382,10 @@ dxf_donut_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->dictionary_owner_soft));
+        return (dxf_handle_to_string (donut->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1451,7 +1421,7 @@ dxf_donut_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        donut->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1486,17 +1456,10 @@ dxf_donut_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->material));
+        return (dxf_handle_to_string (donut->common.cold->material));
 }
 
 
@@ -1535,7 +1498,7 @@ dxf_donut_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->material = strdup (material);
+        donut->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1569,17 +1532,10 @@ dxf_donut_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->dictionary_owner_hard));
+        return (dxf_handle_to_string (donut->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1618,7 +1574,7 @@ dxf_donut_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        donut->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1653,7 +1609,7 @@ dxf_donut_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->lineweight);
+        return (donut->common.lineweight);
 }
 
 
@@ -1683,7 +1639,7 @@ dxf_donut_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->lineweight = lineweight;
+        donut->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1715,17 +1671,10 @@ dxf_donut_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->plot_style_name));
+        return (dxf_handle_to_string (donut->common.cold->plot_style_name));
 }
 
 
@@ -1763,7 +1712,7 @@ dxf_donut_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->plot_style_name = strdup (plot_style_name);
+        donut->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1798,7 +1747,7 @@ dxf_donut_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->color_value);
+        return (donut->common.color_value);
 }
 
 
@@ -1828,7 +1777,7 @@ dxf_donut_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->color_value = color_value;
+        donut->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1860,7 +1809,7 @@ dxf_donut_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (donut->color_name ==  NULL)
+        if (donut->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1870,7 +1819,7 @@ dxf_donut_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (donut->color_name));
+        return (strdup (donut->common.cold->color_name));
 }
 
 
@@ -1908,7 +1857,7 @@ dxf_donut_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->color_name = strdup (color_name);
+        donut->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1943,7 +1892,7 @@ dxf_donut_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (donut->transparency);
+        return (donut->common.cold->transparency);
 }
 
 
@@ -1973,7 +1922,7 @@ dxf_donut_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        donut->transparency = transparency;
+        donut->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
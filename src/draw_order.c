@@ -0,0 +1,1014 @@
+/*!
+ * \file draw_order.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the draw order of entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "draw_order.h"
+
+
+/*!
+ * \brief Sort key of an entity.
+ */
+typedef struct
+dxf_draw_order_key_struct
+{
+        DxfHandle sort_handle;
+                /*!< Sort handle of the entity. */
+        int position;
+                /*!< Position of the entity. */
+} DxfDrawOrderKey;
+
+
+/*!
+ * \brief Compare two sort keys, on sort handle and then on position.
+ */
+static int
+dxf_draw_order_compare
+(
+        const void *a,
+                /*!< a sort key. */
+        const void *b
+                /*!< another sort key. */
+)
+{
+        const DxfDrawOrderKey *key_a = (const DxfDrawOrderKey *) a;
+        const DxfDrawOrderKey *key_b = (const DxfDrawOrderKey *) b;
+
+        if (key_a->sort_handle != key_b->sort_handle)
+        {
+                return ((key_a->sort_handle < key_b->sort_handle) ? -1 : 1);
+        }
+        return (key_a->position - key_b->position);
+}
+
+
+/*!
+ * \brief Free the arrays of a \c DxfDrawOrder.
+ */
+static void
+dxf_draw_order_clear
+(
+        DxfDrawOrder *order
+                /*!< a pointer to a draw order. */
+)
+{
+        free (order->handles);
+        free (order->sort_handles);
+        free (order->order);
+        free (order->rank);
+        order->handles = NULL;
+        order->sort_handles = NULL;
+        order->order = NULL;
+        order->rank = NULL;
+        order->number_of_entities = 0;
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfDrawOrder.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfDrawOrder *
+dxf_draw_order_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawOrder *order = NULL;
+        size_t size;
+
+        size = sizeof (DxfDrawOrder);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((order = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfDrawOrder struct.\n")),
+                  __FUNCTION__);
+                order = NULL;
+        }
+        else
+        {
+                memset (order, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfDrawOrder.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfDrawOrder *
+dxf_draw_order_init
+(
+        DxfDrawOrder *order
+                /*!< a pointer to a draw order. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                order = dxf_draw_order_new ();
+        }
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        order->block_record = DXF_HANDLE_NONE;
+        order->number_of_entities = 0;
+        order->handles = NULL;
+        order->sort_handles = NULL;
+        order->order = NULL;
+        order->rank = NULL;
+        order->next = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfDrawOrder.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_free
+(
+        DxfDrawOrder *order
+                /*!< a pointer to a draw order. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (order->next != NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () pointer to next was not NULL.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_draw_order_clear (order);
+        free (order);
+        order = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a single linked list of
+ * \c DxfDrawOrder.
+ */
+void
+dxf_draw_order_free_list
+(
+        DxfDrawOrder *orders
+                /*!< a pointer to a single linked list of draw
+                 * orders. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawOrder *iter;
+
+        if (orders == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+        }
+        while (orders != NULL)
+        {
+                iter = (DxfDrawOrder *) orders->next;
+                orders->next = NULL;
+                dxf_draw_order_free (orders);
+                orders = iter;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Build the draw order of a number of entities.
+ *
+ * Replaces the draw order built before.\n
+ * The entity handle / sort handle pairs of \c sortentstable (group
+ * codes 331 and 5) are looked up in a hash on entity handle once, the
+ * entities are then sorted on sort handle and position.\n
+ * The block record of the draw order is taken from the block owner
+ * (group code 330) of \c sortentstable.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_build
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        const DxfHandle *handles,
+                /*!< entity handles, indexed by position. */
+        int number_of_entities,
+                /*!< number of entities. */
+        DxfSortentsTable *sortentstable
+                /*!< the \c SORTENTSTABLE of the block, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawOrderKey *keys;
+        DxfDrawOrderKey *key;
+        DxfHandleIndex *index = NULL;
+        DxfChar *entity_owner;
+        DxfInt *sort_handle;
+        int i;
+
+        /* Do some basic checks. */
+        if ((order == NULL)
+          || ((handles == NULL) && (number_of_entities > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_entities < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_draw_order_clear (order);
+        keys = malloc ((number_of_entities + 1) * sizeof (DxfDrawOrderKey));
+        order->handles = malloc ((number_of_entities + 1) * sizeof (DxfHandle));
+        order->sort_handles = malloc ((number_of_entities + 1) * sizeof (DxfHandle));
+        order->order = malloc ((number_of_entities + 1) * sizeof (int));
+        order->rank = malloc ((number_of_entities + 1) * sizeof (int));
+        if ((keys == NULL)
+          || (order->handles == NULL)
+          || (order->sort_handles == NULL)
+          || (order->order == NULL)
+          || (order->rank == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (keys);
+                dxf_draw_order_clear (order);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_entities; i++)
+        {
+                order->handles[i] = handles[i];
+                keys[i].sort_handle = handles[i];
+                keys[i].position = i;
+        }
+        if ((sortentstable != NULL)
+          && (sortentstable->entity_owner != NULL)
+          && (sortentstable->sort_handle != NULL))
+        {
+                /* Map entity handles to their sort keys. */
+                index = dxf_handle_index_init (dxf_handle_index_new ());
+                if ((index == NULL)
+                  || (dxf_handle_index_reserve (index, number_of_entities) == EXIT_FAILURE))
+                {
+                        free (keys);
+                        dxf_draw_order_clear (order);
+                        if (index != NULL)
+                        {
+                                dxf_handle_index_free (index);
+                        }
+                        return (EXIT_FAILURE);
+                }
+                for (i = 0; i < number_of_entities; i++)
+                {
+                        if (handles[i] != DXF_HANDLE_NONE)
+                        {
+                                dxf_handle_index_add (index, handles[i], DXF_HANDLE_INDEX_OBJECT, &keys[i]);
+                        }
+                }
+                entity_owner = sortentstable->entity_owner;
+                sort_handle = sortentstable->sort_handle;
+                while ((entity_owner != NULL)
+                  && (sort_handle != NULL)
+                  && (entity_owner->value != NULL)
+                  && (entity_owner->value[0] != '\0'))
+                {
+                        key = dxf_handle_index_find (index, dxf_handle_parse (entity_owner->value), NULL);
+                        if (key != NULL)
+                        {
+                                key->sort_handle = sort_handle->value;
+                        }
+                        entity_owner = (DxfChar *) entity_owner->next;
+                        sort_handle = (DxfInt *) sort_handle->next;
+                }
+                dxf_handle_index_free (index);
+        }
+        if (sortentstable != NULL)
+        {
+                order->block_record = sortentstable->block_owner;
+        }
+        qsort (keys, number_of_entities, sizeof (DxfDrawOrderKey), dxf_draw_order_compare);
+        for (i = 0; i < number_of_entities; i++)
+        {
+                order->sort_handles[i] = keys[i].sort_handle;
+                order->order[i] = keys[i].position;
+                order->rank[keys[i].position] = i;
+        }
+        order->number_of_entities = number_of_entities;
+        free (keys);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the draw order of the entities of an \c ENTITIES
+ * section or a block.
+ *
+ * The entities are referred to by their position, see
+ * dxf_entities_get_entity (), or by the position of the lazily loaded
+ * entities when there are no other entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_build_entities
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        DxfEntities *entities,
+                /*!< DXF entities section, or the entities of a block. */
+        DxfSortentsTable *sortentstable
+                /*!< the \c SORTENTSTABLE of the block, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandle *handles;
+        DxfEntityType type;
+        void *entity;
+        int number_of_entities;
+        int status;
+        int i;
+
+        /* Do some basic checks. */
+        if ((order == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        if (number_of_entities == 0)
+        {
+                number_of_entities = entities->number_of_lazy_items;
+        }
+        handles = malloc ((number_of_entities + 1) * sizeof (DxfHandle));
+        if (handles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_entities; i++)
+        {
+                if (entities->number_of_entities > 0)
+                {
+                        entity = dxf_entities_get_entity (entities, i, &type);
+                        handles[i] = dxf_entities_get_id_code (type, entity);
+                }
+                else
+                {
+                        handles[i] = entities->lazy_items[i].id_code;
+                }
+        }
+        status = dxf_draw_order_build (order, handles, number_of_entities, sortentstable);
+        free (handles);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/*!
+ * \brief Get the number of entities in a \c DxfDrawOrder.
+ *
+ * \return the number of entities, or -1 when an error occurred.
+ */
+int
+dxf_draw_order_get_number_of_entities
+(
+        DxfDrawOrder *order
+                /*!< a pointer to a draw order. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order->number_of_entities);
+}
+
+
+/*!
+ * \brief Get the positions of the entities in draw order.
+ *
+ * \return a pointer to the positions, indexed by rank and owned by
+ * \c order, or \c NULL when an error occurred.
+ */
+const int *
+dxf_draw_order_get_order
+(
+        DxfDrawOrder *order
+                /*!< a pointer to a draw order. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order->order);
+}
+
+
+/*!
+ * \brief Get the position of the entity at a rank.
+ *
+ * \return the position, or -1 when an error occurred.
+ */
+int
+dxf_draw_order_get_position
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int rank
+                /*!< rank of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((rank < 0)
+          || (rank >= order->number_of_entities))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order->order[rank]);
+}
+
+
+/*!
+ * \brief Get the rank of the entity at a position.
+ *
+ * \return the rank, or -1 when an error occurred.
+ */
+int
+dxf_draw_order_get_rank
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position
+                /*!< position of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((position < 0)
+          || (position >= order->number_of_entities))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order->rank[position]);
+}
+
+
+/*!
+ * \brief Get the sort handle of the entity at a position.
+ *
+ * \return the sort handle, or \c DXF_HANDLE_NONE when an error
+ * occurred.
+ */
+DxfHandle
+dxf_draw_order_get_sort_handle
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position
+                /*!< position of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int rank;
+
+        rank = dxf_draw_order_get_rank (order, position);
+        if (rank < 0)
+        {
+                return (DXF_HANDLE_NONE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order->sort_handles[rank]);
+}
+
+
+/*!
+ * \brief Move an entity to another rank in the draw order.
+ *
+ * The entities in between shift one rank towards the old rank of the
+ * entity, the other entities keep their rank.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_move
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position,
+                /*!< position of the entity. */
+        int rank
+                /*!< new rank of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int from;
+        int i;
+
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((position < 0)
+          || (position >= order->number_of_entities)
+          || (rank < 0)
+          || (rank >= order->number_of_entities))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        from = order->rank[position];
+        if (from < rank)
+        {
+                memmove (&order->order[from], &order->order[from + 1], (rank - from) * sizeof (int));
+                for (i = from; i < rank; i++)
+                {
+                        order->rank[order->order[i]] = i;
+                }
+        }
+        else if (from > rank)
+        {
+                memmove (&order->order[rank + 1], &order->order[rank], (from - rank) * sizeof (int));
+                for (i = rank + 1; i <= from; i++)
+                {
+                        order->rank[order->order[i]] = i;
+                }
+        }
+        order->order[rank] = position;
+        order->rank[position] = rank;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Move an entity to the top of the draw order, it is drawn
+ * last.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_move_to_top
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position
+                /*!< position of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_draw_order_move (order, position, order->number_of_entities - 1));
+}
+
+
+/*!
+ * \brief Move an entity to the bottom of the draw order, it is drawn
+ * first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_move_to_bottom
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position
+                /*!< position of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (order == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_draw_order_move (order, position, 0));
+}
+
+
+/*!
+ * \brief Move an entity just above another entity in the draw order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_move_above
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position,
+                /*!< position of the entity. */
+        int other
+                /*!< position of the other entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int rank;
+        int other_rank;
+
+        rank = dxf_draw_order_get_rank (order, position);
+        other_rank = dxf_draw_order_get_rank (order, other);
+        if ((rank < 0)
+          || (other_rank < 0))
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_draw_order_move (order, position,
+          (rank < other_rank) ? other_rank : other_rank + 1));
+}
+
+
+/*!
+ * \brief Move an entity just below another entity in the draw order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_move_below
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        int position,
+                /*!< position of the entity. */
+        int other
+                /*!< position of the other entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int rank;
+        int other_rank;
+
+        rank = dxf_draw_order_get_rank (order, position);
+        other_rank = dxf_draw_order_get_rank (order, other);
+        if ((rank < 0)
+          || (other_rank < 0))
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_draw_order_move (order, position,
+          (rank > other_rank) ? other_rank : other_rank - 1));
+}
+
+
+/*!
+ * \brief Store a draw order in a \c SORTENTSTABLE.
+ *
+ * The entity handle / sort handle pairs of \c sortentstable are
+ * replaced by those of the entities of which the sort handle differs
+ * from the entity handle, in draw order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_fill_sortentstable
+(
+        DxfDrawOrder *order,
+                /*!< a pointer to a draw order. */
+        DxfSortentsTable *sortentstable
+                /*!< the \c SORTENTSTABLE to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChar *entity_owner;
+        DxfChar *last_entity_owner = NULL;
+        DxfInt *sort_handle;
+        DxfInt *last_sort_handle = NULL;
+        int position;
+        int i;
+
+        /* Do some basic checks. */
+        if ((order == NULL)
+          || (sortentstable == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        while (sortentstable->entity_owner != NULL)
+        {
+                entity_owner = sortentstable->entity_owner;
+                sortentstable->entity_owner = (DxfChar *) entity_owner->next;
+                entity_owner->next = NULL;
+                dxf_char_free (entity_owner);
+        }
+        while (sortentstable->sort_handle != NULL)
+        {
+                sort_handle = sortentstable->sort_handle;
+                sortentstable->sort_handle = (DxfInt *) sort_handle->next;
+                free (sort_handle);
+        }
+        sortentstable->block_owner = order->block_record;
+        for (i = 0; i < order->number_of_entities; i++)
+        {
+                position = order->order[i];
+                if (order->sort_handles[i] == order->handles[position])
+                {
+                        continue;
+                }
+                entity_owner = dxf_char_new ();
+                sort_handle = dxf_int_new ();
+                if ((entity_owner == NULL)
+                  || (sort_handle == NULL))
+                {
+                        free (entity_owner);
+                        free (sort_handle);
+                        return (EXIT_FAILURE);
+                }
+                entity_owner->value = dxf_handle_to_string (order->handles[position]);
+                entity_owner->length = strlen (entity_owner->value);
+                sort_handle->value = (int) order->sort_handles[i];
+                if (last_entity_owner == NULL)
+                {
+                        sortentstable->entity_owner = entity_owner;
+                        sortentstable->sort_handle = sort_handle;
+                }
+                else
+                {
+                        last_entity_owner->next = (struct DxfChar *) entity_owner;
+                        last_sort_handle->next = (struct DxfInt *) sort_handle;
+                }
+                last_entity_owner = entity_owner;
+                last_sort_handle = sort_handle;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a draw order to a cache of draw orders, a handle index on
+ * block record handle.
+ *
+ * A draw order cached before for the same block record is replaced,
+ * the cache does not own the draw orders.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_draw_order_cache_add
+(
+        DxfHandleIndex *cache,
+                /*!< a handle index used as cache. */
+        DxfDrawOrder *order
+                /*!< a pointer to a draw order. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((cache == NULL)
+          || (order == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_handle_index_add (cache, order->block_record, DXF_HANDLE_INDEX_BLOCK_RECORD, order));
+}
+
+
+/*!
+ * \brief Find the cached draw order of a block record.
+ *
+ * \return a pointer to the draw order, or \c NULL when it is not cached
+ * or an error occurred.
+ */
+DxfDrawOrder *
+dxf_draw_order_cache_find
+(
+        DxfHandleIndex *cache,
+                /*!< a handle index used as cache. */
+        DxfHandle block_record
+                /*!< handle of the \c BLOCK_RECORD. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawOrder *order;
+
+        order = (DxfDrawOrder *) dxf_handle_index_find (cache, block_record, NULL);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (order);
+}
+
+
+/* EOF */
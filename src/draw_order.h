@@ -0,0 +1,116 @@
+/*!
+ * \file draw_order.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the draw order of entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DRAW_ORDER_H
+#define LIBDXF_SRC_DRAW_ORDER_H
+
+
+#include "global.h"
+#include "entities.h"
+#include "handle.h"
+#include "handle_index.h"
+#include "sortentstable.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Draw order of the entities of a block (model space, a paper
+ * space layout or any other block).
+ *
+ * Entities are drawn in the order of their sort handle, which is the
+ * entity handle unless a \c SORTENTSTABLE gives another one.\n
+ * The rank of an entity is its place in the draw order, rank 0 is
+ * drawn first (at the bottom), entities are referred to by their
+ * position in the \c ENTITIES section or block.\n
+ * The sort handles are kept in ascending order by rank, so moving an
+ * entity to another rank only shifts the entities in between, and the
+ * sort handle of an entity is the one at its rank.
+ */
+typedef struct
+dxf_draw_order_struct
+{
+        DxfHandle block_record;
+                /*!< Handle of the \c BLOCK_RECORD owning the entities,
+                 * \c DXF_HANDLE_NONE when not known. */
+        int number_of_entities;
+                /*!< Number of entities. */
+        DxfHandle *handles;
+                /*!< Entity handles, indexed by position. */
+        DxfHandle *sort_handles;
+                /*!< Sort handles in ascending order, indexed by rank. */
+        int *order;
+                /*!< Positions of the entities, indexed by rank. */
+        int *rank;
+                /*!< Ranks of the entities, indexed by position. */
+        struct DxfDrawOrder *next;
+                /*!< Pointer to the next DxfDrawOrder.\n
+                 * \c NULL in the last DxfDrawOrder. */
+} DxfDrawOrder;
+
+
+DxfDrawOrder *dxf_draw_order_new ();
+DxfDrawOrder *dxf_draw_order_init (DxfDrawOrder *order);
+int dxf_draw_order_free (DxfDrawOrder *order);
+void dxf_draw_order_free_list (DxfDrawOrder *orders);
+int dxf_draw_order_build (DxfDrawOrder *order, const DxfHandle *handles, int number_of_entities, DxfSortentsTable *sortentstable);
+int dxf_draw_order_build_entities (DxfDrawOrder *order, DxfEntities *entities, DxfSortentsTable *sortentstable);
+int dxf_draw_order_get_number_of_entities (DxfDrawOrder *order);
+const int *dxf_draw_order_get_order (DxfDrawOrder *order);
+int dxf_draw_order_get_position (DxfDrawOrder *order, int rank);
+int dxf_draw_order_get_rank (DxfDrawOrder *order, int position);
+DxfHandle dxf_draw_order_get_sort_handle (DxfDrawOrder *order, int position);
+int dxf_draw_order_move (DxfDrawOrder *order, int position, int rank);
+int dxf_draw_order_move_to_top (DxfDrawOrder *order, int position);
+int dxf_draw_order_move_to_bottom (DxfDrawOrder *order, int position);
+int dxf_draw_order_move_above (DxfDrawOrder *order, int position, int other);
+int dxf_draw_order_move_below (DxfDrawOrder *order, int position, int other);
+int dxf_draw_order_fill_sortentstable (DxfDrawOrder *order, DxfSortentsTable *sortentstable);
+int dxf_draw_order_cache_add (DxfHandleIndex *cache, DxfDrawOrder *order);
+DxfDrawOrder *dxf_draw_order_cache_find (DxfHandleIndex *cache, DxfHandle block_record);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DRAW_ORDER_H */
+
+
+/* EOF */
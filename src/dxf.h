@@ -48,18 +48,22 @@
 #include "binary_entity_data.h"
 #include "binary_graphics_data.h"
 #include "block.h"
+#include "block_index.h"
 #include "block_record.h"
 #include "body.h"
+#include "bounds.h"
 #include "circle.h"
 #include "class.h"
 #include "color.h"
 #include "comment.h"
 #include "dbg.h"
 #include "dictionary.h"
+#include "dictionary_tree.h"
 #include "dictionaryvar.h"
 #include "dimension.h"
 #include "dimstyle.h"
 #include "donut.h"
+#include "draw_order.h"
 #include "drawing.h"
 #include "ellipse.h"
 #include "endblk.h"
@@ -70,6 +74,8 @@
 #include "file.h"
 #include "global.h"
 #include "group.h"
+#include "handle.h"
+#include "handle_index.h"
 #include "hatch.h"
 #include "header.h"
 #include "helix.h"
@@ -81,17 +87,20 @@
 #include "layer.h"
 #include "layer_index.h"
 #include "layer_name.h"
+#include "layer_partition.h"
 #include "leader.h"
 #include "light.h"
 #include "line.h"
 #include "ltype.h"
 #include "lwpolyline.h"
+#include "memory_usage.h"
 #include "mesh.h"
 #include "mleader.h"
 #include "mleaderstyle.h"
 #include "mline.h"
 #include "mlinestyle.h"
 #include "mtext.h"
+#include "nearest.h"
 #include "object.h"
 #include "object_id.h"
 #include "object_ptr.h"
@@ -103,11 +112,14 @@
 #include "proprietary_data.h"
 #include "rastervariables.h"
 #include "ray.h"
+#include "reference_index.h"
 #include "region.h"
 #include "rtext.h"
+#include "rtree.h"
 #include "section.h"
 #include "seqend.h"
 #include "shape.h"
+#include "snapshot.h"
 #include "solid.h"
 #include "sortentstable.h"
 #include "spatial_filter.h"
@@ -118,6 +130,7 @@
 #include "table.h"
 #include "tables.h"
 #include "text.h"
+#include "text_index.h"
 #include "thumbnail.h"
 #include "tolerance.h"
 #include "trace.h"
@@ -42,6 +42,7 @@
 
 
 #include "ellipse.h"
+#include "entities.h"
 
 
 /*!
@@ -115,15 +116,14 @@ dxf_ellipse_init
               return (NULL);
         }
         /* Initialize new structs for members. */
-        ellipse->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (ellipse->binary_graphics_data);
-        if (ellipse->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&ellipse->common) == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
-        ellipse->p0 = dxf_point_init (ellipse->p0);
+        ellipse->p0 = dxf_point_init (dxf_point_new ());
         if (ellipse->p0 == NULL)
         {
               fprintf (stderr,
@@ -131,7 +131,7 @@ dxf_ellipse_init
                 __FUNCTION__);
               return (NULL);
         }
-        ellipse->p1 = dxf_point_init (ellipse->p1);
+        ellipse->p1 = dxf_point_init (dxf_point_new ());
         if (ellipse->p1 == NULL)
         {
               fprintf (stderr,
@@ -140,26 +140,6 @@ dxf_ellipse_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        ellipse->id_code = 0;
-        ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ellipse->layer = strdup (DXF_DEFAULT_LAYER);
-        ellipse->elevation = 0.0;
-        ellipse->thickness = 0.0;
-        ellipse->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        ellipse->visibility = DXF_DEFAULT_VISIBILITY;
-        ellipse->color = DXF_COLOR_BYLAYER;
-        ellipse->paperspace = DXF_MODELSPACE;
-        ellipse->graphics_data_size = 0;
-        ellipse->shadow_mode = 0;
-        ellipse->dictionary_owner_soft = strdup ("");
-        ellipse->object_owner_soft = strdup ("");
-        ellipse->material = strdup ("");
-        ellipse->dictionary_owner_hard = strdup ("");
-        ellipse->lineweight = 0;
-        ellipse->plot_style_name = strdup ("");
-        ellipse->color_value = 0;
-        ellipse->color_name = strdup ("");
-        ellipse->transparency = 0;
         ellipse->p0->x0 = 0.0;
         ellipse->p0->y0 = 0.0;
         ellipse->p0->z0 = 0.0;
@@ -203,9 +183,9 @@ dxf_ellipse_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -213,8 +193,6 @@ dxf_ellipse_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ellipse == NULL)
@@ -222,314 +200,109 @@ dxf_ellipse_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                ellipse = dxf_ellipse_init (ellipse);
+                ellipse = dxf_ellipse_init (dxf_ellipse_new ());
+                if (ellipse == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter310 = (DxfBinaryData *) ellipse->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &ellipse->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (ellipse->elevation = 0.0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->ratio);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->start_angle);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->end_angle);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->color);
+                        break;
                 }
-                else if (strcmp (temp_string, "67") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->paperspace);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbEllipse") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ellipse->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ellipse->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &ellipse->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                ellipse->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                ellipse->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                ellipse->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                ellipse->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                ellipse->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                ellipse->p1->z0 = atof (value);
+                                break;
+                        case 40:
+                                ellipse->ratio = atof (value);
+                                break;
+                        case 41:
+                                ellipse->start_angle = atof (value);
+                                break;
+                        case 42:
+                                ellipse->end_angle = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_12)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbEllipse") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                ellipse->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                ellipse->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                ellipse->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &ellipse->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (ellipse->linetype, "") == 0)
+        if ((ellipse->common.linetype == NULL)
+          || (strcmp (ellipse->common.linetype, "") == 0))
         {
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (ellipse->common.linetype);
+                ellipse->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ellipse->layer, "") == 0)
+        if ((ellipse->common.layer == NULL)
+          || (strcmp (ellipse->common.layer, "") == 0))
         {
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                free (ellipse->common.layer);
+                ellipse->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -606,37 +379,37 @@ dxf_ellipse_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (ellipse->linetype, "") == 0)
+        if (strcmp (ellipse->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ellipse->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ellipse->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ellipse->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ellipse->layer, "") == 0)
+        if (strcmp (ellipse->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ellipse->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ellipse->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                ellipse->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (ellipse->ratio == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () ratio value equals 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ellipse->id_code);
+                  (_("Warning in %s () ratio value equals 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ellipse->common.id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ellipse->id_code != -1)
+        if (ellipse->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ellipse->id_code);
+                dxf_handle_write (fp, 5, ellipse->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -648,89 +421,83 @@ dxf_ellipse_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ellipse->dictionary_owner_soft, "") != 0)
+        if ((ellipse->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ellipse->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, ellipse->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (ellipse->dictionary_owner_hard, "") != 0)
+        if ((ellipse->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ellipse->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, ellipse->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (ellipse->object_owner_soft, "") != 0)
+        if ((ellipse->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", ellipse->object_owner_soft);
+                dxf_handle_write (fp, 330, ellipse->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (ellipse->paperspace == DXF_PAPERSPACE)
+        if (ellipse->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ellipse->layer);
-        if (strcmp (ellipse->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", ellipse->common.layer);
+        if (strcmp (ellipse->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", ellipse->linetype);
+                fprintf (fp->fp, "  6\n%s\n", ellipse->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (ellipse->elevation != 0.0))
+          && (ellipse->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ellipse->elevation);
+                fprintf (fp->fp, " 38\n%f\n", ellipse->common.elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
-          && (ellipse->thickness != 0.0))
+          && (ellipse->common.thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", ellipse->thickness);
+                fprintf (fp->fp, " 39\n%f\n", ellipse->common.thickness);
         }
-        if (ellipse->color != DXF_COLOR_BYLAYER)
+        if (ellipse->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", ellipse->color);
+                fprintf (fp->fp, " 62\n%hd\n", ellipse->common.color);
         }
-        if (ellipse->linetype_scale != 1.0)
+        if (ellipse->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ellipse->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", ellipse->common.linetype_scale);
         }
-        if (ellipse->visibility != 0)
+        if (ellipse->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", ellipse->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", ellipse->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", ellipse->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", ellipse->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", ellipse->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", ellipse->common.cold->graphics_data_size);
 #endif
-                if (ellipse->binary_graphics_data != NULL)
+                if (ellipse->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) ellipse->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, ellipse->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", ellipse->color_value);
-                fprintf (fp->fp, "430\n%s\n", ellipse->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", ellipse->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", ellipse->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", ellipse->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", ellipse->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", ellipse->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", ellipse->shadow_mode);
+                dxf_handle_write (fp, 390, ellipse->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", ellipse->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -748,6 +515,7 @@ dxf_ellipse_write
         fprintf (fp->fp, " 40\n%f\n", ellipse->ratio);
         fprintf (fp->fp, " 41\n%f\n", ellipse->start_angle);
         fprintf (fp->fp, " 42\n%f\n", ellipse->end_angle);
+        dxf_entity_common_write_xdata (fp, &ellipse->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -790,15 +558,7 @@ dxf_ellipse_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ellipse->linetype);
-        free (ellipse->layer);
-        dxf_binary_data_free_list (ellipse->binary_graphics_data);
-        free (ellipse->dictionary_owner_soft);
-        free (ellipse->object_owner_soft);
-        free (ellipse->material);
-        free (ellipse->dictionary_owner_hard);
-        free (ellipse->plot_style_name);
-        free (ellipse->color_name);
+        dxf_entity_common_free (&ellipse->common);
         dxf_point_free_list (ellipse->p0);
         dxf_point_free_list (ellipse->p1);
         free (ellipse);
@@ -834,6 +594,7 @@ dxf_ellipse_free_list
         while (ellipses != NULL)
         {
                 DxfEllipse *iter = (DxfEllipse *) ellipses->next;
+                ellipses->next = NULL;
                 dxf_ellipse_free (ellipses);
                 ellipses = (DxfEllipse *) iter;
         }
@@ -843,12 +604,86 @@ dxf_ellipse_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c ELLIPSE entity.
+ *
+ * The copy does not share any memory with \c ellipse, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfEllipse *
+dxf_ellipse_copy
+(
+        DxfEllipse *ellipse
+                /*!< a pointer to the DXF \c ELLIPSE entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEllipse *copy;
+
+        /* Do some basic checks. */
+        if (ellipse == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_ellipse_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, ellipse, sizeof (DxfEllipse));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &ellipse->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_ellipse_free (copy);
+                return (NULL);
+        }
+        if (ellipse->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (ellipse->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_ellipse_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ellipse->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (ellipse->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_ellipse_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c ELLIPSE entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_ellipse_get_id_code
 (
         DxfEllipse *ellipse
@@ -866,16 +701,10 @@ dxf_ellipse_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->id_code);
+        return (ellipse->common.id_code);
 }
 
 
@@ -887,7 +716,7 @@ dxf_ellipse_set_id_code
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -904,13 +733,7 @@ dxf_ellipse_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        ellipse->id_code = id_code;
+        ellipse->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -941,7 +764,7 @@ dxf_ellipse_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->linetype ==  NULL)
+        if (ellipse->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -951,7 +774,7 @@ dxf_ellipse_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->linetype));
+        return (strdup (ellipse->common.linetype));
 }
 
 
@@ -985,7 +808,7 @@ dxf_ellipse_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->linetype = strdup (linetype);
+        ellipse->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1016,7 +839,7 @@ dxf_ellipse_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->layer ==  NULL)
+        if (ellipse->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1026,7 +849,7 @@ dxf_ellipse_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->layer));
+        return (strdup (ellipse->common.layer));
 }
 
 
@@ -1060,7 +883,7 @@ dxf_ellipse_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->layer = strdup (layer);
+        ellipse->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1094,7 +917,7 @@ dxf_ellipse_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->elevation);
+        return (ellipse->common.elevation);
 }
 
 
@@ -1121,7 +944,7 @@ dxf_ellipse_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->elevation = elevation;
+        ellipse->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1152,7 +975,7 @@ dxf_ellipse_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->thickness < 0.0)
+        if (ellipse->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1161,7 +984,7 @@ dxf_ellipse_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->thickness);
+        return (ellipse->common.thickness);
 }
 
 
@@ -1194,7 +1017,7 @@ dxf_ellipse_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        ellipse->thickness = thickness;
+        ellipse->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1226,7 +1049,7 @@ dxf_ellipse_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->linetype_scale < 0.0)
+        if (ellipse->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1235,7 +1058,7 @@ dxf_ellipse_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->linetype_scale);
+        return (ellipse->common.linetype_scale);
 }
 
 
@@ -1268,7 +1091,7 @@ dxf_ellipse_set_linetype_scale
                   (_("Warning in %s () a negative was passed.\n")),
                   __FUNCTION__);
         }
-        ellipse->linetype_scale = linetype_scale;
+        ellipse->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1299,13 +1122,13 @@ dxf_ellipse_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->visibility < 0)
+        if (ellipse->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ellipse->visibility > 1)
+        if (ellipse->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1314,7 +1137,7 @@ dxf_ellipse_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->visibility);
+        return (ellipse->common.visibility);
 }
 
 
@@ -1353,7 +1176,7 @@ dxf_ellipse_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        ellipse->visibility = visibility;
+        ellipse->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1384,7 +1207,7 @@ dxf_ellipse_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->color < 0)
+        if (ellipse->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1393,7 +1216,7 @@ dxf_ellipse_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->color);
+        return (ellipse->common.color);
 }
 
 
@@ -1428,7 +1251,7 @@ dxf_ellipse_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        ellipse->color = color;
+        ellipse->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1459,13 +1282,13 @@ dxf_ellipse_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->paperspace < 0)
+        if (ellipse->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ellipse->paperspace > 1)
+        if (ellipse->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1474,7 +1297,7 @@ dxf_ellipse_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->paperspace);
+        return (ellipse->common.paperspace);
 }
 
 
@@ -1513,7 +1336,7 @@ dxf_ellipse_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        ellipse->paperspace = paperspace;
+        ellipse->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1546,13 +1369,13 @@ dxf_ellipse_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->graphics_data_size < 0)
+        if (ellipse->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ellipse->graphics_data_size == 0)
+        if (ellipse->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1561,7 +1384,7 @@ dxf_ellipse_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->graphics_data_size);
+        return (ellipse->common.cold->graphics_data_size);
 }
 
 
@@ -1605,7 +1428,7 @@ dxf_ellipse_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        ellipse->graphics_data_size = graphics_data_size;
+        ellipse->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1637,13 +1460,13 @@ dxf_ellipse_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->shadow_mode < 0)
+        if (ellipse->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ellipse->shadow_mode > 3)
+        if (ellipse->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1652,7 +1475,7 @@ dxf_ellipse_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->shadow_mode);
+        return (ellipse->common.cold->shadow_mode);
 }
 
 
@@ -1694,7 +1517,7 @@ dxf_ellipse_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        ellipse->shadow_mode = shadow_mode;
+        ellipse->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1706,11 +1529,12 @@ dxf_ellipse_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c ELLIPSE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_ellipse_get_binary_graphics_data
 (
         DxfEllipse *ellipse
@@ -1728,32 +1552,31 @@ dxf_ellipse_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) ellipse->binary_graphics_data);
+        return (ellipse->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c ELLIPSE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c ellipse when successful, or \c NULL when an
+ * error occurred.
  */
 DxfEllipse *
 dxf_ellipse_set_binary_graphics_data
 (
         DxfEllipse *ellipse,
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1774,7 +1597,12 @@ dxf_ellipse_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->binary_graphics_data = (DxfBinaryData *) data;
+        if ((ellipse->common.cold->binary_graphics_data != NULL)
+          && (ellipse->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (ellipse->common.cold->binary_graphics_data);
+        }
+        ellipse->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1808,17 +1636,10 @@ dxf_ellipse_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_soft));
+        return (dxf_handle_to_string (ellipse->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1854,7 +1675,7 @@ dxf_ellipse_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ellipse->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1888,17 +1709,10 @@ dxf_ellipse_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->object_owner_soft));
+        return (dxf_handle_to_string (ellipse->common.cold->object_owner_soft));
 }
 
 
@@ -1934,7 +1748,7 @@ dxf_ellipse_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->object_owner_soft = strdup (object_owner_soft);
+        ellipse->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1968,17 +1782,10 @@ dxf_ellipse_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->material));
+        return (dxf_handle_to_string (ellipse->common.cold->material));
 }
 
 
@@ -2016,7 +1823,7 @@ dxf_ellipse_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->material = strdup (material);
+        ellipse->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2050,17 +1857,10 @@ dxf_ellipse_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_hard));
+        return (dxf_handle_to_string (ellipse->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2096,7 +1896,7 @@ dxf_ellipse_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ellipse->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2131,7 +1931,7 @@ dxf_ellipse_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->lineweight);
+        return (ellipse->common.lineweight);
 }
 
 
@@ -2161,7 +1961,7 @@ dxf_ellipse_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->lineweight = lineweight;
+        ellipse->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2193,17 +1993,10 @@ dxf_ellipse_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->plot_style_name));
+        return (dxf_handle_to_string (ellipse->common.cold->plot_style_name));
 }
 
 
@@ -2241,7 +2034,7 @@ dxf_ellipse_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->plot_style_name = strdup (plot_style_name);
+        ellipse->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2276,7 +2069,7 @@ dxf_ellipse_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->color_value);
+        return (ellipse->common.color_value);
 }
 
 
@@ -2306,7 +2099,7 @@ dxf_ellipse_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->color_value = color_value;
+        ellipse->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2338,7 +2131,7 @@ dxf_ellipse_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ellipse->color_name ==  NULL)
+        if (ellipse->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2348,7 +2141,7 @@ dxf_ellipse_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->color_name));
+        return (strdup (ellipse->common.cold->color_name));
 }
 
 
@@ -2386,7 +2179,7 @@ dxf_ellipse_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->color_name = strdup (color_name);
+        ellipse->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2421,7 +2214,7 @@ dxf_ellipse_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ellipse->transparency);
+        return (ellipse->common.cold->transparency);
 }
 
 
@@ -2451,7 +2244,7 @@ dxf_ellipse_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->transparency = transparency;
+        ellipse->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
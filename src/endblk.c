@@ -113,7 +113,7 @@ dxf_endblk_init
         }
         endblk->id_code = 0;
         endblk->layer = strdup (DXF_DEFAULT_LAYER);
-        endblk->object_owner_soft = strdup ("");
+        endblk->object_owner_soft = DXF_HANDLE_NONE;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -185,7 +185,7 @@ dxf_endblk_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        fscanf (fp->fp, "%x\n", &endblk->id_code);
+                        endblk->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
@@ -196,7 +196,7 @@ dxf_endblk_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, endblk->object_owner_soft);
+                        endblk->object_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -262,7 +262,7 @@ dxf_endblk_write
         fprintf (fp->fp, "  0\nENDBLK\n");
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "  5\n%x\n", endblk->id_code);
+                dxf_handle_write (fp, 5, endblk->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -274,10 +274,10 @@ dxf_endblk_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (endblk->object_owner_soft, "") != 0)
+        if ((endblk->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", endblk->object_owner_soft);
+                dxf_handle_write (fp, 330, endblk->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -318,7 +318,6 @@ dxf_endblk_free
                 return (EXIT_FAILURE);
         }
         free (endblk->layer);
-        free (endblk->object_owner_soft);
         free (endblk);
         endblk = NULL;
 #if DEBUG
@@ -333,7 +332,7 @@ dxf_endblk_free
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_endblk_get_id_code
 (
         DxfEndblk *endblk
@@ -353,12 +352,6 @@ dxf_endblk_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (endblk->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
         result = endblk->id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -375,7 +368,7 @@ dxf_endblk_set_id_code
 (
         DxfEndblk *endblk,
                 /*!< a pointer to a DxfEndblk (a DXF \c ENDBLK entity). */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -392,12 +385,6 @@ dxf_endblk_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         endblk->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -512,14 +499,7 @@ dxf_endblk_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (endblk->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        result = strdup (endblk->object_owner_soft);
+        result = dxf_handle_to_string (endblk->object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -559,7 +539,7 @@ dxf_endblk_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->object_owner_soft = strdup (object_owner_soft);
+        endblk->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "util.h"
 
 
@@ -75,7 +76,7 @@ extern "C" {
 typedef struct
 dxf_endblk_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -84,7 +85,7 @@ dxf_endblk_struct
                 /*!< Layer on which the entity is drawn.\n
                  * Defaults to layer "0" if no valid layername is given.\n
                  * Group code = 8. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object
                  * (optional).\n
                  * Group code = 330. */
@@ -96,8 +97,8 @@ DxfEndblk *dxf_endblk_init (DxfEndblk *endblk);
 DxfEndblk *dxf_endblk_read (DxfFile *fp, DxfEndblk *endblk);
 int dxf_endblk_write (DxfFile *fp, DxfEndblk *endblk);
 int dxf_endblk_free (DxfEndblk *endblk);
-int dxf_endblk_get_id_code (DxfEndblk *endblk);
-DxfEndblk *dxf_endblk_set_id_code (DxfEndblk *endblk, int id_code);
+DxfHandle dxf_endblk_get_id_code (DxfEndblk *endblk);
+DxfEndblk *dxf_endblk_set_id_code (DxfEndblk *endblk, DxfHandle id_code);
 char *dxf_endblk_get_layer (DxfEndblk *endblk);
 DxfEndblk *dxf_endblk_set_layer (DxfEndblk *endblk, char *layer);
 char *dxf_endblk_get_object_owner_soft (DxfEndblk *endblk);
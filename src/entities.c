@@ -53,6 +53,427 @@
 
 
 #include "entities.h"
+#include "spline.h"
+#include "helix.h"
+#include "endsec.h"
+#include "util.h"
+
+
+/*!
+ * \brief Get the address of the member of a DXF \c ENTITIES section
+ * holding the first entity of the single linked list of entities of
+ * type \c type.
+ *
+ * \return the address of the list member, or \c NULL when the type of
+ * entity is not stored in a \c DxfEntities.
+ */
+static void **
+dxf_entities_get_list_member
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type
+                /*!< type of entity. */
+)
+{
+        switch (type)
+        {
+                case DFACE:
+                        return ((void **) &entities->dface_list);
+                case DSOLID:
+                        return ((void **) &entities->dsolid_list);
+                case ACADPROXYENTITY:
+                        return ((void **) &entities->acad_proxy_entity_list);
+                case ARC:
+                        return ((void **) &entities->arc_list);
+                case ATTDEF:
+                        return ((void **) &entities->attdef_list);
+                case ATTRIB:
+                        return ((void **) &entities->attrib_list);
+                case BODY:
+                        return ((void **) &entities->body_list);
+                case CIRCLE:
+                        return ((void **) &entities->circle_list);
+                case DIMENSION:
+                        return ((void **) &entities->dimension_list);
+                case ELLIPSE:
+                        return ((void **) &entities->ellipse_list);
+                case HATCH:
+                        return ((void **) &entities->hatch_list);
+                case HELIX:
+                        return ((void **) &entities->helix_list);
+                case IMAGE:
+                        return ((void **) &entities->image_list);
+                case INSERT:
+                        return ((void **) &entities->insert_list);
+                case LEADER:
+                        return ((void **) &entities->leader_list);
+                case LIGHT:
+                        return ((void **) &entities->light_list);
+                case LINE:
+                        return ((void **) &entities->line_list);
+                case LWPOLYLINE:
+                        return ((void **) &entities->lw_polyline_list);
+                case MESH:
+                        return ((void **) &entities->mesh_list);
+                case MLINE:
+                        return ((void **) &entities->mline_list);
+                case MTEXT:
+                        return ((void **) &entities->mtext_list);
+                case OLEFRAME:
+                        return ((void **) &entities->oleframe_list);
+                case OLE2FRAME:
+                        return ((void **) &entities->ole2frame_list);
+                case POINT:
+                        return ((void **) &entities->point_list);
+                case POLYLINE:
+                        return ((void **) &entities->polyline_list);
+                case RAY:
+                        return ((void **) &entities->ray_list);
+                case REGION:
+                        return ((void **) &entities->region_list);
+                case SHAPE:
+                        return ((void **) &entities->shape_list);
+                case SOLID:
+                        return ((void **) &entities->solid_list);
+                case SPLINE:
+                        return ((void **) &entities->spline_list);
+                case TABLE:
+                        return ((void **) &entities->table_list);
+                case TEXT:
+                        return ((void **) &entities->text_list);
+                case TOLERANCE:
+                        return ((void **) &entities->tolerance_list);
+                case TRACE:
+                        return ((void **) &entities->trace_list);
+                case VERTEX:
+                        return ((void **) &entities->vertex_list);
+                case VIEWPORT:
+                        return ((void **) &entities->viewport_list);
+                default:
+                        return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Get the address of the \c next member of an \c entity of type
+ * \c type.
+ *
+ * \return the address of the \c next member, or \c NULL when the type
+ * of entity is not stored in a \c DxfEntities.
+ */
+static void **
+dxf_entities_get_next_member
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+        switch (type)
+        {
+                case DFACE:
+                        return ((void **) &((Dxf3dface *) entity)->next);
+                case DSOLID:
+                        return ((void **) &((Dxf3dsolid *) entity)->next);
+                case ACADPROXYENTITY:
+                        return ((void **) &((DxfAcadProxyEntity *) entity)->next);
+                case ARC:
+                        return ((void **) &((DxfArc *) entity)->next);
+                case ATTDEF:
+                        return ((void **) &((DxfAttdef *) entity)->next);
+                case ATTRIB:
+                        return ((void **) &((DxfAttrib *) entity)->next);
+                case BODY:
+                        return ((void **) &((DxfBody *) entity)->next);
+                case CIRCLE:
+                        return ((void **) &((DxfCircle *) entity)->next);
+                case DIMENSION:
+                        return ((void **) &((DxfDimension *) entity)->next);
+                case ELLIPSE:
+                        return ((void **) &((DxfEllipse *) entity)->next);
+                case HATCH:
+                        return ((void **) &((DxfHatch *) entity)->next);
+                case HELIX:
+                        return ((void **) &((DxfHelix *) entity)->next);
+                case IMAGE:
+                        return ((void **) &((DxfImage *) entity)->next);
+                case INSERT:
+                        return ((void **) &((DxfInsert *) entity)->next);
+                case LEADER:
+                        return ((void **) &((DxfLeader *) entity)->next);
+                case LIGHT:
+                        return ((void **) &((DxfLight *) entity)->next);
+                case LINE:
+                        return ((void **) &((DxfLine *) entity)->next);
+                case LWPOLYLINE:
+                        return ((void **) &((DxfLWPolyline *) entity)->next);
+                case MESH:
+                        return ((void **) &((DxfMesh *) entity)->next);
+                case MLINE:
+                        return ((void **) &((DxfMline *) entity)->next);
+                case MTEXT:
+                        return ((void **) &((DxfMtext *) entity)->next);
+                case OLEFRAME:
+                        return ((void **) &((DxfOleFrame *) entity)->next);
+                case OLE2FRAME:
+                        return ((void **) &((DxfOle2Frame *) entity)->next);
+                case POINT:
+                        return ((void **) &((DxfPoint *) entity)->next);
+                case POLYLINE:
+                        return ((void **) &((DxfPolyline *) entity)->next);
+                case RAY:
+                        return ((void **) &((DxfRay *) entity)->next);
+                case REGION:
+                        return ((void **) &((DxfRegion *) entity)->next);
+                case SHAPE:
+                        return ((void **) &((DxfShape *) entity)->next);
+                case SOLID:
+                        return ((void **) &((DxfSolid *) entity)->next);
+                case SPLINE:
+                        return ((void **) &((DxfSpline *) entity)->next);
+                case TABLE:
+                        return ((void **) &((DxfTable *) entity)->next);
+                case TEXT:
+                        return ((void **) &((DxfText *) entity)->next);
+                case TOLERANCE:
+                        return ((void **) &((DxfTolerance *) entity)->next);
+                case TRACE:
+                        return ((void **) &((DxfTrace *) entity)->next);
+                case VERTEX:
+                        return ((void **) &((DxfVertex *) entity)->next);
+                case VIEWPORT:
+                        return ((void **) &((DxfViewport *) entity)->next);
+                default:
+                        return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Make room for \c count more entities of type \c type in the
+ * entity sequence and in the pool of entities of type \c type of a DXF
+ * \c ENTITIES section.
+ *
+ * The arrays grow by doubling their size, so appending entities costs
+ * amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_reserve
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type,
+                /*!< type of entity. */
+        int count
+                /*!< number of entities to make room for. */
+)
+{
+        DxfEntitiesItem *sequence;
+        void **pool;
+        int size;
+
+        if (entities->number_of_entities + count > entities->sequence_size)
+        {
+                size = (entities->sequence_size > 0)
+                  ? entities->sequence_size
+                  : DXF_ENTITIES_INITIAL_SIZE;
+                while (size < entities->number_of_entities + count)
+                {
+                        size *= 2;
+                }
+                sequence = realloc (entities->sequence, size * sizeof (DxfEntitiesItem));
+                if (sequence == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                entities->sequence = sequence;
+                entities->sequence_size = size;
+        }
+        if (entities->pool_count[type] + count > entities->pool_size[type])
+        {
+                size = (entities->pool_size[type] > 0)
+                  ? entities->pool_size[type]
+                  : DXF_ENTITIES_INITIAL_SIZE;
+                while (size < entities->pool_count[type] + count)
+                {
+                        size *= 2;
+                }
+                pool = realloc (entities->pool[type], size * sizeof (void *));
+                if (pool == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                entities->pool[type] = pool;
+                entities->pool_size[type] = size;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if \c address lies within a block of entities created
+ * in a batch.
+ *
+ * \return \c TRUE when \c address lies within \c batch, else
+ * \c FALSE.
+ */
+static int
+dxf_entities_batch_contains
+(
+        const DxfEntitiesBatch *batch,
+                /*!< block of entities. */
+        const void *address
+                /*!< address to test. */
+)
+{
+        return (((const char *) address >= batch->data)
+          && ((const char *) address < batch->data + batch->size));
+}
+
+
+/*!
+ * \brief Find the block of entities created in a batch which holds
+ * \c entity.
+ *
+ * \return a pointer to the block, or \c NULL when \c entity was
+ * allocated on its own.
+ */
+static DxfEntitiesBatch *
+dxf_entities_find_batch
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        const void *entity
+                /*!< entity to find. */
+)
+{
+        int i;
+
+        for (i = 0; i < entities->number_of_batches; i++)
+        {
+                if (dxf_entities_batch_contains (&entities->batches[i], entity))
+                {
+                        return (&entities->batches[i]);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Allocate a block of \c size bytes for entities of type
+ * \c type created in a batch and register it with the \c ENTITIES
+ * section.
+ *
+ * \return a pointer to the block, or \c NULL when an error occurred.
+ */
+static DxfEntitiesBatch *
+dxf_entities_add_batch
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type,
+                /*!< type of the entities in the block. */
+        size_t size
+                /*!< size of the block in bytes. */
+)
+{
+        DxfEntitiesBatch *batches;
+        char *data;
+
+        data = malloc (size);
+        if (data == NULL)
+        {
+                return (NULL);
+        }
+        batches = realloc (entities->batches,
+          (entities->number_of_batches + 1) * sizeof (DxfEntitiesBatch));
+        if (batches == NULL)
+        {
+                free (data);
+                return (NULL);
+        }
+        entities->batches = batches;
+        batches[entities->number_of_batches].type = type;
+        batches[entities->number_of_batches].data = data;
+        batches[entities->number_of_batches].size = size;
+        entities->number_of_batches++;
+        return (&batches[entities->number_of_batches - 1]);
+}
+
+
+/*!
+ * \brief Remove the last block of entities created in a batch from the
+ * \c ENTITIES section and free it.
+ *
+ * The data of the entities in the block must have been freed.
+ */
+static void
+dxf_entities_remove_last_batch
+(
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+        entities->number_of_batches--;
+        free (entities->batches[entities->number_of_batches].data);
+}
+
+
+/*!
+ * \brief Free the data of an entity in a block of entities created in
+ * a batch.
+ *
+ * The entity itself is freed with its block.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_free_batch_entity
+(
+        const DxfEntitiesBatch *batch,
+                /*!< block holding the entity. */
+        void *entity
+                /*!< entity to free the data of. */
+)
+{
+        DxfLine *line;
+
+        switch (batch->type)
+        {
+                case LINE:
+                        line = (DxfLine *) entity;
+                        dxf_entity_common_free (&line->common);
+                        /* The start and end point live in the block
+                         * too, unless they were replaced. */
+                        if ((line->p0 != NULL)
+                          && (!dxf_entities_batch_contains (batch, line->p0)))
+                        {
+                                dxf_point_free (line->p0);
+                        }
+                        if ((line->p1 != NULL)
+                          && (!dxf_entities_batch_contains (batch, line->p1)))
+                        {
+                                dxf_point_free (line->p1);
+                        }
+                        if (line->offsets != NULL)
+                        {
+                                dxf_point_offsets_free (line->offsets);
+                        }
+                        return (EXIT_SUCCESS);
+                case POINT:
+                        return (dxf_entity_common_free (&((DxfPoint *) entity)->common));
+                default:
+                        return (EXIT_FAILURE);
+        }
+}
 
 
 /*!
@@ -107,6 +528,8 @@ dxf_entities_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
         if (entities == NULL)
         {
@@ -122,430 +545,2210 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        /* Initialize new structs for members. */
-        entities->dface_list = dxf_3dface_init (entities->dface_list);
-        if (entities->dface_list == NULL)
+        entities->sequence = NULL;
+        entities->number_of_entities = 0;
+        entities->sequence_size = 0;
+        entities->source = NULL;
+        entities->lazy_items = NULL;
+        entities->number_of_lazy_items = 0;
+        entities->lazy_items_size = 0;
+        entities->batches = NULL;
+        entities->number_of_batches = 0;
+        for (i = 0; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                entities->last[i] = NULL;
+                entities->pool[i] = NULL;
+                entities->pool_count[i] = 0;
+                entities->pool_size[i] = 0;
         }
-        entities->dsolid_list = dxf_3dsolid_init (entities->dsolid_list);
-        if (entities->dsolid_list == NULL)
+        /* The lists of entities start empty, dxf_entities_append ()
+         * adds the entities to the lists, the sequence and the pools. */
+        entities->dface_list = NULL;
+        entities->dsolid_list = NULL;
+        entities->acad_proxy_entity_list = NULL;
+        entities->arc_list = NULL;
+        entities->attdef_list = NULL;
+        entities->attrib_list = NULL;
+        entities->body_list = NULL;
+        entities->circle_list = NULL;
+        entities->dimension_list = NULL;
+        entities->ellipse_list = NULL;
+        entities->hatch_list = NULL;
+        entities->helix_list = NULL;
+        entities->image_list = NULL;
+        entities->insert_list = NULL;
+        entities->leader_list = NULL;
+        entities->light_list = NULL;
+        entities->line_list = NULL;
+        entities->lw_polyline_list = NULL;
+        entities->mesh_list = NULL;
+        entities->mline_list = NULL;
+        //entities->mleader_list = NULL;
+        //entities->mleaderstyle_list = NULL;
+        entities->mtext_list = NULL;
+        entities->oleframe_list = NULL;
+        entities->ole2frame_list = NULL;
+        entities->point_list = NULL;
+        entities->polyline_list = NULL;
+        entities->ray_list = NULL;
+        entities->region_list = NULL;
+        //entities->section_list = NULL;
+        entities->shape_list = NULL;
+        entities->solid_list = NULL;
+        entities->spline_list = NULL;
+        //entities->sun_list = NULL;
+        //entities->surface_list = NULL;
+        entities->table_list = NULL;
+        entities->text_list = NULL;
+        entities->tolerance_list = NULL;
+        entities->trace_list = NULL;
+        //entities->underlay_list = NULL;
+        entities->vertex_list = NULL;
+        entities->viewport_list = NULL;
+        //entities->wipeout_list = NULL;
+        //entities->xline_list = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities);
+}
+
+
+/*!
+ * \brief Read and parse the \c ENTITIES table from a DXF file.
+ */
+int
+dxf_entities_read_table
+(
+        char *filename,
+                /*!< filename of input file (or device). */
+        FILE *fp,
+                /*!< filepointer to the input file (or device). */
+        int line_number,
+                /*!< current line number in the input file (or device). */
+        char *dxf_entities_list,
+                /*!< pointer to a list of entities. */
+        int acad_version_number
+                /*!< AutoCAD DXF version number. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /*! \todo Add code here. */
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a DXF \c ENTITIES table.
+ */
+int
+dxf_entities_write_table
+(
+        char *dxf_entities_list,
+                /*!< pointer to a list of entities. */
+        int acad_version_number
+                /*!< AutoCAD DXF version number. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /*! \todo Add code here. */
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF \c ENTITIES section and
+ * all it's data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_free
+(
+        DxfEntities *entities
+                /*!< Pointer to the memory occupied by the DXF
+                 * \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesBatch *batch;
+        void **list;
+        void **next;
+        void *entity;
+        void *iter;
+        int i;
+
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->acad_proxy_entity_list = dxf_acad_proxy_entity_init (entities->acad_proxy_entity_list);
-        if (entities->acad_proxy_entity_list == NULL)
+        /* Free the entities in the lists of each type, the pools only
+         * index them. */
+        for (i = 0; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                list = dxf_entities_get_list_member (entities, (DxfEntityType) i);
+                if (list == NULL)
+                {
+                        continue;
+                }
+                entity = *list;
+                while (entity != NULL)
+                {
+                        next = dxf_entities_get_next_member ((DxfEntityType) i, entity);
+                        iter = *next;
+                        *next = NULL;
+                        batch = dxf_entities_find_batch (entities, entity);
+                        if (batch != NULL)
+                        {
+                                dxf_entities_free_batch_entity (batch, entity);
+                        }
+                        else
+                        {
+                                dxf_entities_free_entity ((DxfEntityType) i, entity);
+                        }
+                        entity = iter;
+                }
+                *list = NULL;
         }
-        entities->arc_list = dxf_arc_init (entities->arc_list);
-        if (entities->arc_list == NULL)
+        /* The entities created in batches are freed with their
+         * blocks. */
+        for (i = 0; i < entities->number_of_batches; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                free (entities->batches[i].data);
         }
-        entities->attdef_list = dxf_attdef_init (entities->attdef_list);
-        if (entities->attdef_list == NULL)
+        free (entities->batches);
+        for (i = 0; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                free (entities->pool[i]);
         }
-        entities->attrib_list = dxf_attrib_init (entities->attrib_list);
-        if (entities->attrib_list == NULL)
+        free (entities->sequence);
+        for (i = 0; i < entities->number_of_lazy_items; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                dxf_entities_release (entities, i);
+                free (entities->lazy_items[i].layer);
+                free (entities->lazy_items[i].block_name);
         }
-        entities->body_list = dxf_body_init (entities->body_list);
-        if (entities->body_list == NULL)
+        free (entities->lazy_items);
+        if (entities->source != NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                dxf_read_close (entities->source);
         }
-        entities->circle_list = dxf_circle_init (entities->circle_list);
-        if (entities->circle_list == NULL)
+        free (entities);
+        entities = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append an entity to a DXF \c ENTITIES section.
+ *
+ * The entity is appended to the single linked list of entities of its
+ * type, to the pool of entities of its type and to the file order
+ * sequence of all entities.\n
+ * The last entity of every list is remembered in the \c last member of
+ * \c entities, so appending costs O(1) instead of walking the whole
+ * list with dxf_<entity>_get_last ().\n
+ * When \c entity is the first entity of a chain of entities, the whole
+ * chain is appended.
+ *
+ * \warning Lists should only be extended by means of this function,
+ * otherwise the remembered last entity becomes stale and the entity is
+ * missing from the sequence.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_append
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type,
+                /*!< type of \c entity. */
+        void *entity
+                /*!< pointer to the entity to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void **list;
+        void *iter;
+        void *last;
+        int count;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->dimension_list = dxf_dimension_init (entities->dimension_list);
-        if (entities->dimension_list == NULL)
+        if (entity == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->ellipse_list = dxf_ellipse_init (entities->ellipse_list);
-        if (entities->ellipse_list == NULL)
+        list = dxf_entities_get_list_member (entities, type);
+        if (list == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () an unsupported entity type was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->hatch_list = dxf_hatch_init (entities->hatch_list);
-        if (entities->hatch_list == NULL)
+        /* Find the last entity of the appended chain and make room
+         * for all entities in the chain before anything is linked. */
+        last = entity;
+        count = 1;
+        while (*dxf_entities_get_next_member (type, last) != NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                last = *dxf_entities_get_next_member (type, last);
+                count++;
         }
-        entities->helix_list = dxf_helix_init (entities->helix_list);
-        if (entities->helix_list == NULL)
+        if (dxf_entities_reserve (entities, type, count) == EXIT_FAILURE)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->image_list = dxf_image_init (entities->image_list);
-        if (entities->image_list == NULL)
+        if (*list == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                *list = entity;
         }
-        entities->insert_list = dxf_insert_init (entities->insert_list);
-        if (entities->insert_list == NULL)
+        else
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                iter = entities->last[type];
+                if (iter == NULL)
+                {
+                        /* The list was not built by this function,
+                         * search the last entity once. */
+                        iter = *list;
+                        while (*dxf_entities_get_next_member (type, iter) != NULL)
+                        {
+                                iter = *dxf_entities_get_next_member (type, iter);
+                        }
+                }
+                *dxf_entities_get_next_member (type, iter) = entity;
         }
-        entities->leader_list = dxf_leader_init (entities->leader_list);
-        if (entities->leader_list == NULL)
+        entities->last[type] = last;
+        /* Record the entities in their pool and in file order. */
+        for (iter = entity; iter != NULL; iter = *dxf_entities_get_next_member (type, iter))
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                entities->sequence[entities->number_of_entities].type = type;
+                entities->sequence[entities->number_of_entities].index = entities->pool_count[type];
+                entities->number_of_entities++;
+                entities->pool[type][entities->pool_count[type]] = iter;
+                entities->pool_count[type]++;
         }
-        entities->light_list = dxf_light_init (entities->light_list);
-        if (entities->light_list == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create \c number DXF \c LINE entities from the default
+ * prototype and append them to the \c ENTITIES section.
+ *
+ * Entity \c i gets the i-th element of each array, a \c NULL array
+ * leaves the default value of that member.\n
+ * The entities and their start and end points are carved from one
+ * contiguous block of memory, only the strings and the cold data of
+ * the common data are allocated per entity.\n
+ * The entities are linked first and appended in one call, so the pools
+ * of \c entities grow only once.
+ *
+ * \warning The entities are freed with their block by
+ * dxf_entities_free (), they must not be passed to dxf_line_free (),
+ * and their start and end points must not be passed to
+ * dxf_point_free () or converted by dxf_line_set_single_precision ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, in which case no entity was appended.
+ */
+int
+dxf_entities_create_lines
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int number,
+                /*!< number of entities to create. */
+        char **layer,
+                /*!< array of layer names, or \c NULL. */
+        const int16_t *color,
+                /*!< array of colors, or \c NULL. */
+        const double *x0,
+                /*!< array of X-coordinates of the start points, or
+                 * \c NULL. */
+        const double *y0,
+                /*!< array of Y-coordinates of the start points, or
+                 * \c NULL. */
+        const double *z0,
+                /*!< array of Z-coordinates of the start points, or
+                 * \c NULL. */
+        const double *x1,
+                /*!< array of X-coordinates of the end points, or
+                 * \c NULL. */
+        const double *y1,
+                /*!< array of Y-coordinates of the end points, or
+                 * \c NULL. */
+        const double *z1
+                /*!< array of Z-coordinates of the end points, or
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesBatch *batch;
+        DxfLine *lines;
+        DxfPoint *points;
+        DxfLine *line;
+        int i;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->line_list = dxf_line_init (entities->line_list);
-        if (entities->line_list == NULL)
+        if (number <= 0)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                return (EXIT_SUCCESS);
         }
-        entities->lw_polyline_list = dxf_lwpolyline_init (entities->lw_polyline_list);
-        if (entities->lw_polyline_list == NULL)
+        /* One block with the lines followed by their start and end
+         * points. */
+        batch = dxf_entities_add_batch (entities, LINE,
+          number * (sizeof (DxfLine) + 2 * sizeof (DxfPoint)));
+        if (batch == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        //entities->mesh_list = NULL;
-        entities->mline_list = dxf_mline_init (entities->mline_list);
-        if (entities->mline_list == NULL)
+        lines = (DxfLine *) batch->data;
+        points = (DxfPoint *) (lines + number);
+        for (i = 0; i < number; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                line = &lines[i];
+                if (dxf_line_init_from_prototype (line, &points[2 * i],
+                  &points[2 * i + 1], (layer != NULL) ? layer[i] : NULL) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        for (; i >= 0; i--)
+                        {
+                                dxf_entity_common_free (&lines[i].common);
+                        }
+                        dxf_entities_remove_last_batch (entities);
+                        return (EXIT_FAILURE);
+                }
+                if (color != NULL) line->common.color = color[i];
+                if (x0 != NULL) line->p0->x0 = x0[i];
+                if (y0 != NULL) line->p0->y0 = y0[i];
+                if (z0 != NULL) line->p0->z0 = z0[i];
+                if (x1 != NULL) line->p1->x0 = x1[i];
+                if (y1 != NULL) line->p1->y0 = y1[i];
+                if (z1 != NULL) line->p1->z0 = z1[i];
+                if (i > 0)
+                {
+                        lines[i - 1].next = (struct DxfLine *) line;
+                }
         }
-        //entities->mleader_list = NULL;
-        //entities->mleaderstyle_list = NULL;
-        entities->mtext_list = dxf_mtext_init (entities->mtext_list);
-        if (entities->mtext_list == NULL)
+        if (dxf_entities_append (entities, LINE, lines) == EXIT_FAILURE)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                for (i = 0; i < number; i++)
+                {
+                        dxf_entity_common_free (&lines[i].common);
+                }
+                dxf_entities_remove_last_batch (entities);
+                return (EXIT_FAILURE);
         }
-        entities->oleframe_list = dxf_oleframe_init (entities->oleframe_list);
-        if (entities->oleframe_list == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create \c number DXF \c POINT entities from the default
+ * prototype and append them to the \c ENTITIES section.
+ *
+ * Entity \c i gets the i-th element of each array, a \c NULL array
+ * leaves the default value of that member.\n
+ * The entities are carved from one contiguous block of memory, see
+ * dxf_entities_create_lines ().
+ *
+ * \warning The entities are freed with their block by
+ * dxf_entities_free (), they must not be passed to dxf_point_free ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, in which case no entity was appended.
+ */
+int
+dxf_entities_create_points
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int number,
+                /*!< number of entities to create. */
+        char **layer,
+                /*!< array of layer names, or \c NULL. */
+        const int16_t *color,
+                /*!< array of colors, or \c NULL. */
+        const double *x0,
+                /*!< array of X-coordinates, or \c NULL. */
+        const double *y0,
+                /*!< array of Y-coordinates, or \c NULL. */
+        const double *z0
+                /*!< array of Z-coordinates, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesBatch *batch;
+        DxfPoint *points;
+        DxfPoint *point;
+        int i;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->ole2frame_list = dxf_ole2frame_init (entities->ole2frame_list);
-        if (entities->ole2frame_list == NULL)
+        if (number <= 0)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                return (EXIT_SUCCESS);
         }
-        entities->point_list = dxf_point_init (entities->point_list);
-        if (entities->point_list == NULL)
+        batch = dxf_entities_add_batch (entities, POINT, number * sizeof (DxfPoint));
+        if (batch == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->polyline_list = dxf_polyline_init (entities->polyline_list);
-        if (entities->polyline_list == NULL)
+        points = (DxfPoint *) batch->data;
+        for (i = 0; i < number; i++)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                point = &points[i];
+                if (dxf_point_init_from_prototype (point, (layer != NULL) ? layer[i] : NULL) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        for (; i >= 0; i--)
+                        {
+                                dxf_entity_common_free (&points[i].common);
+                        }
+                        dxf_entities_remove_last_batch (entities);
+                        return (EXIT_FAILURE);
+                }
+                if (color != NULL) point->common.color = color[i];
+                if (x0 != NULL) point->x0 = x0[i];
+                if (y0 != NULL) point->y0 = y0[i];
+                if (z0 != NULL) point->z0 = z0[i];
+                if (i > 0)
+                {
+                        points[i - 1].next = (struct DxfPoint *) point;
+                }
         }
-        entities->ray_list = dxf_ray_init (entities->ray_list);
-        if (entities->ray_list == NULL)
+        if (dxf_entities_append (entities, POINT, points) == EXIT_FAILURE)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                for (i = 0; i < number; i++)
+                {
+                        dxf_entity_common_free (&points[i].common);
+                }
+                dxf_entities_remove_last_batch (entities);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create \c number DXF \c LWPOLYLINE entities from the default
+ * prototype and append them to the \c ENTITIES section.
+ *
+ * Entity \c i gets the i-th element of \c layer, \c color and
+ * \c number_vertices, a \c NULL array leaves the default value.\n
+ * The vertices of all entities are concatenated in \c x and \c y,
+ * entity \c i takes the next \c number_vertices[i] of them.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, in which case no entity was appended.
+ */
+int
+dxf_entities_create_lwpolylines
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int number,
+                /*!< number of entities to create. */
+        char **layer,
+                /*!< array of layer names, or \c NULL. */
+        const int16_t *color,
+                /*!< array of colors, or \c NULL. */
+        const int *number_vertices,
+                /*!< array with the number of vertices of each entity,
+                 * or \c NULL for entities without vertices. */
+        const double *x,
+                /*!< concatenated X-coordinates of the vertices. */
+        const double *y
+                /*!< concatenated Y-coordinates of the vertices. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolyline *first = NULL;
+        DxfLWPolyline *last = NULL;
+        DxfLWPolyline *lwpolyline;
+        int offset = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->region_list = dxf_region_init (entities->region_list);
-        if (entities->region_list == NULL)
+        if ((number_vertices != NULL)
+          && ((x == NULL) || (y == NULL)))
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        //entities->section_list = NULL;
-        entities->shape_list = dxf_shape_init (entities->shape_list);
-        if (entities->shape_list == NULL)
+        if (number <= 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        for (i = 0; i < number; i++)
+        {
+                lwpolyline = dxf_lwpolyline_new_from_prototype ((layer != NULL) ? layer[i] : NULL);
+                if ((lwpolyline != NULL)
+                  && (number_vertices != NULL)
+                  && (number_vertices[i] > 0))
+                {
+                        if (dxf_lwpolyline_set_vertices (lwpolyline,
+                          number_vertices[i], &x[offset], &y[offset],
+                          NULL, NULL, NULL) == NULL)
+                        {
+                                dxf_lwpolyline_free (lwpolyline);
+                                lwpolyline = NULL;
+                        }
+                        offset += number_vertices[i];
+                }
+                if (lwpolyline == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_lwpolyline_free_list (first);
+                        return (EXIT_FAILURE);
+                }
+                if (color != NULL) lwpolyline->common.color = color[i];
+                if (last == NULL)
+                {
+                        first = lwpolyline;
+                }
+                else
+                {
+                        last->next = (struct DxfLWPolyline *) lwpolyline;
+                }
+                last = lwpolyline;
+        }
+        if (dxf_entities_append (entities, LWPOLYLINE, first) == EXIT_FAILURE)
+        {
+                dxf_lwpolyline_free_list (first);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the first entity of type \c type from a DXF \c ENTITIES
+ * section.
+ *
+ * Walks the single linked list of entities of type \c type, so entities
+ * which were linked without dxf_entities_append () are found too.
+ *
+ * \return a pointer to the first entity, or \c NULL when there are no
+ * entities of type \c type or an error occurred.
+ */
+void *
+dxf_entities_get_first
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type
+                /*!< type of entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void **list;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        list = dxf_entities_get_list_member (entities, type);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((list == NULL) ? NULL : *list);
+}
+
+
+/*!
+ * \brief Get the entity following \c entity of type \c type.
+ *
+ * \return a pointer to the next entity, or \c NULL when \c entity is
+ * the last entity or an error occurred.
+ */
+void *
+dxf_entities_get_next
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void **next;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        next = dxf_entities_get_next_member (type, entity);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((next == NULL) ? NULL : *next);
+}
+
+
+/*!
+ * \brief Get the number of entities in the file order sequence of a DXF
+ * \c ENTITIES section.
+ *
+ * \return the number of entities, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_get_number_of_entities
+(
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities->number_of_entities);
+}
+
+
+/*!
+ * \brief Get the entity at \c position in the file order sequence of a
+ * DXF \c ENTITIES section.
+ *
+ * The type of the entity is stored in \c type when \c type is not
+ * \c NULL.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_entities_get_entity
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int position,
+                /*!< position of the entity in file order, starting at
+                 * 0. */
+        DxfEntityType *type
+                /*!< type of the returned entity, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesItem *item;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((position < 0)
+          || (position >= entities->number_of_entities))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        item = &entities->sequence[position];
+        if (type != NULL)
+        {
+                *type = item->type;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities->pool[item->type][item->index]);
+}
+
+
+/*!
+ * \brief Get the number of entities of type \c type in a DXF
+ * \c ENTITIES section.
+ *
+ * \return the number of entities, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_get_number_of_entities_of_type
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type
+                /*!< type of entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities->pool_count[type]);
+}
+
+
+/*!
+ * \brief Get the entity at \c index in the pool of entities of type
+ * \c type of a DXF \c ENTITIES section.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_entities_get_entity_of_type
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type,
+                /*!< type of entity. */
+        int index
+                /*!< index of the entity in the pool, starting at 0. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES)
+          || (index < 0) || (index >= entities->pool_count[type]))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities->pool[type][index]);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for an entity of type \c type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_write_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntityType type,
+                /*!< type of \c entity. */
+        void *entity
+                /*!< pointer to the entity to write. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_3dface_write (fp, (Dxf3dface *) entity));
+                case DSOLID:
+                        return (dxf_3dsolid_write (fp, (Dxf3dsolid *) entity));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_write (fp, (DxfAcadProxyEntity *) entity));
+                case ARC:
+                        return (dxf_arc_write (fp, (DxfArc *) entity));
+                case ATTDEF:
+                        return (dxf_attdef_write (fp, (DxfAttdef *) entity));
+                case ATTRIB:
+                        return (dxf_attrib_write (fp, (DxfAttrib *) entity));
+                case BODY:
+                        return (dxf_body_write (fp, (DxfBody *) entity));
+                case CIRCLE:
+                        return (dxf_circle_write (fp, (DxfCircle *) entity));
+                case DIMENSION:
+                        return (dxf_dimension_write (fp, (DxfDimension *) entity));
+                case ELLIPSE:
+                        return (dxf_ellipse_write (fp, (DxfEllipse *) entity));
+                case HATCH:
+                        return (dxf_hatch_write (fp, (DxfHatch *) entity));
+                case HELIX:
+                        return (dxf_helix_write (fp, (DxfHelix *) entity));
+                case IMAGE:
+                        return (dxf_image_write (fp, (DxfImage *) entity));
+                case INSERT:
+                        return (dxf_insert_write (fp, (DxfInsert *) entity));
+                case LEADER:
+                        return (dxf_leader_write (fp, (DxfLeader *) entity));
+                case LIGHT:
+                        return (dxf_light_write (fp, (DxfLight *) entity));
+                case LINE:
+                        return (dxf_line_write (fp, (DxfLine *) entity));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_write (fp, (DxfLWPolyline *) entity));
+                case MESH:
+                        return (dxf_mesh_write (fp, (DxfMesh *) entity));
+                case MLINE:
+                        return (dxf_mline_write (fp, (DxfMline *) entity));
+                case MTEXT:
+                        return (dxf_mtext_write (fp, (DxfMtext *) entity));
+                case OLEFRAME:
+                        return (dxf_oleframe_write (fp, (DxfOleFrame *) entity));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_write (fp, (DxfOle2Frame *) entity));
+                case POINT:
+                        return (dxf_point_write (fp, (DxfPoint *) entity));
+                case POLYLINE:
+                        return (dxf_polyline_write (fp, (DxfPolyline *) entity));
+                case RAY:
+                        return (dxf_ray_write (fp, (DxfRay *) entity));
+                case REGION:
+                        return (dxf_region_write (fp, (DxfRegion *) entity));
+                case SHAPE:
+                        return (dxf_shape_write (fp, (DxfShape *) entity));
+                case SOLID:
+                        return (dxf_solid_write (fp, (DxfSolid *) entity));
+                case SPLINE:
+                        return (dxf_spline_write (fp, (DxfSpline *) entity));
+                case TABLE:
+                        return (dxf_table_write (fp, (DxfTable *) entity));
+                case TEXT:
+                        return (dxf_text_write (fp, (DxfText *) entity));
+                case TOLERANCE:
+                        return (dxf_tolerance_write (fp, (DxfTolerance *) entity));
+                case TRACE:
+                        return (dxf_trace_write (fp, (DxfTrace *) entity));
+                case VERTEX:
+                        return (dxf_vertex_write (fp, (DxfVertex *) entity));
+                case VIEWPORT:
+                        return (dxf_viewport_write (fp, (DxfViewport *) entity));
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () an unsupported entity type was passed.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a DXF \c ENTITIES section.
+ *
+ * The entities are written in the order they were appended to the
+ * section (file order), not grouped by type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesItem *item;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (fp, "ENTITIES");
+        for (i = 0; i < entities->number_of_entities; i++)
+        {
+                item = &entities->sequence[i];
+                /* Entities which can not be written are skipped by
+                 * their write function, keep writing the others. */
+                if (dxf_entities_write_entity (fp, item->type,
+                  entities->pool[item->type][item->index]) == EXIT_FAILURE)
+                {
+                        status = EXIT_FAILURE;
+                }
+        }
+        dxf_endsec_write (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+/*!
+ * \brief Read a line from \c file into \c line.
+ *
+ * The end of line characters are removed, characters which do not fit
+ * in \c line are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file or when an error occurred.
+ */
+int
+dxf_entities_get_line
+(
+        FILE *file,
+                /*!< file to read from. */
+        char *line,
+                /*!< buffer for the line. */
+        int size
+                /*!< size of \c line. */
+)
+{
+        size_t length;
+        int c;
+
+        if (fgets (line, size, file) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        length = strlen (line);
+        if ((length > 0) && (line[length - 1] != '\n'))
+        {
+                /* Skip the rest of a long line. */
+                while (((c = fgetc (file)) != EOF) && (c != '\n'))
+                {
+                        ;
+                }
+        }
+        while ((length > 0)
+          && ((line[length - 1] == '\n') || (line[length - 1] == '\r')))
+        {
+                line[--length] = '\0';
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the \c VERTEX or \c ATTRIB entities following the
+ * \c POLYLINE or \c INSERT of a lazy item.
+ *
+ * The file is expected to be positioned at the name of the first child,
+ * as left by the reader of \c item->entity.\n
+ * The children are linked to the \c vertices of the \c POLYLINE, or
+ * to the \c attributes of the \c INSERT, in file order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_read_children
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntitiesLazyItem *item
+                /*!< lazy item with a materialized entity. */
+)
+{
+        DxfPolyline *polyline;
+        DxfInsert *insert;
+        DxfVertex *vertex;
+        DxfVertex *last_vertex = NULL;
+        DxfAttrib *attrib;
+        DxfAttrib *last_attrib = NULL;
+        char name[DXF_MAX_STRING_LENGTH];
+        int i;
+
+        if (item->type == POLYLINE)
+        {
+                polyline = (DxfPolyline *) item->entity;
+                /* Replace the default vertex of the initialized
+                 * polyline. */
+                if (polyline->vertices != NULL)
+                {
+                        dxf_vertex_free_list (polyline->vertices);
+                        polyline->vertices = NULL;
+                }
+                for (i = 0; i < item->number_of_children; i++)
+                {
+                        if ((dxf_entities_get_line (fp->fp, name, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                          || (strcmp (name, "VERTEX") != 0))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        (fp->line_number)++;
+                        vertex = dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ()));
+                        if (vertex == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        if (last_vertex == NULL)
+                        {
+                                polyline->vertices = vertex;
+                        }
+                        else
+                        {
+                                last_vertex->next = (struct DxfVertex *) vertex;
+                        }
+                        last_vertex = vertex;
+                }
+        }
+        else if (item->type == INSERT)
+        {
+                insert = (DxfInsert *) item->entity;
+                for (i = 0; i < item->number_of_children; i++)
+                {
+                        if ((dxf_entities_get_line (fp->fp, name, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                          || (strcmp (name, "ATTRIB") != 0))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        (fp->line_number)++;
+                        attrib = dxf_attrib_read (fp, dxf_attrib_init (dxf_attrib_new ()));
+                        if (attrib == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        if (last_attrib == NULL)
+                        {
+                                insert->attributes = attrib;
+                        }
+                        else
+                        {
+                                last_attrib->next = (struct DxfAttrib *) attrib;
+                        }
+                        last_attrib = attrib;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Scan a DXF \c ENTITIES section for lazy loading.
+ *
+ * The file is expected to be positioned just after the
+ * "  2\nENTITIES" lines.\n
+ * For each entity only the type, handle (group code 5), layer (group
+ * code 8), referenced block name (group code 2 of an \c INSERT or
+ * \c DIMENSION) and byte range are recorded in \c entities, up to and
+ * including the \c ENDSEC marker.\n
+ * The entities of a \c BLOCK are scanned the same way, up to and
+ * including the \c ENDBLK marker.\n
+ * The \c VERTEX entities following a \c POLYLINE and the \c ATTRIB
+ * entities following an \c INSERT with a set attributes follow flag
+ * (group code 66) are counted as children of that entity, its byte
+ * range ends after the \c SEQEND marker.\n
+ * The entities themselves are read on first access with
+ * dxf_entities_materialize ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_scan
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesLazyItem *items;
+        DxfEntitiesLazyItem *item = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        long offset;
+        int size;
+        int sequence = FALSE;
+        int child = FALSE;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (;;)
+        {
+                offset = ftell (fp->fp);
+                if ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                  || (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+                }
+                fp->line_number += 2;
+                switch (atoi (code))
+                {
+                        case 0:
+                                if (sequence)
+                                {
+                                        if ((strcmp (value, "VERTEX") == 0)
+                                          || (strcmp (value, "ATTRIB") == 0))
+                                        {
+                                                item->number_of_children++;
+                                                child = TRUE;
+                                                break;
+                                        }
+                                        sequence = FALSE;
+                                        if (strcmp (value, "SEQEND") == 0)
+                                        {
+                                                child = TRUE;
+                                                break;
+                                        }
+                                }
+                                child = FALSE;
+                                if (item != NULL)
+                                {
+                                        item->end = offset;
+                                }
+                                if ((strcmp (value, "ENDSEC") == 0)
+                                  || (strcmp (value, "ENDBLK") == 0))
+                                {
+#if DEBUG
+                                        DXF_DEBUG_END
+#endif
+                                        return (EXIT_SUCCESS);
+                                }
+                                if (entities->number_of_lazy_items == entities->lazy_items_size)
+                                {
+                                        size = (entities->lazy_items_size > 0)
+                                          ? 2 * entities->lazy_items_size
+                                          : DXF_ENTITIES_INITIAL_SIZE;
+                                        items = realloc (entities->lazy_items, size * sizeof (DxfEntitiesLazyItem));
+                                        if (items == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (EXIT_FAILURE);
+                                        }
+                                        entities->lazy_items = items;
+                                        entities->lazy_items_size = size;
+                                }
+                                item = &entities->lazy_items[entities->number_of_lazy_items];
+                                entities->number_of_lazy_items++;
+                                item->type = dxf_entity_get_type (value);
+                                item->id_code = DXF_HANDLE_NONE;
+                                item->layer = NULL;
+                                item->block_name = NULL;
+                                item->begin = ftell (fp->fp);
+                                item->end = -1;
+                                item->number_of_children = 0;
+                                item->entity = NULL;
+                                sequence = (item->type == POLYLINE);
+                                break;
+                        case 2:
+                                if ((item != NULL)
+                                  && (!child)
+                                  && ((item->type == INSERT) || (item->type == DIMENSION))
+                                  && (item->block_name == NULL))
+                                {
+                                        item->block_name = strdup (value);
+                                }
+                                break;
+                        case 5:
+                                if ((item != NULL) && (!child))
+                                {
+                                        item->id_code = dxf_handle_parse (value);
+                                }
+                                break;
+                        case 8:
+                                if ((item != NULL)
+                                  && (!child)
+                                  && (item->layer == NULL))
+                                {
+                                        item->layer = strdup (value);
+                                }
+                                break;
+                        case 66:
+                                /* Attributes follow an INSERT. */
+                                if ((item != NULL)
+                                  && (!child)
+                                  && (item->type == INSERT)
+                                  && (atoi (value) != 0))
+                                {
+                                        sequence = TRUE;
+                                }
+                                break;
+                        default:
+                                break;
+                }
+        }
+}
+
+
+/*!
+ * \brief Open a DXF file and scan its \c ENTITIES section for lazy
+ * loading.
+ *
+ * Only the group code and value lines are compared while looking for
+ * the \c ENTITIES section, the \c $ACADVER header variable is picked up
+ * on the way.\n
+ * The file is kept open in \c entities to read entities on first access,
+ * it is closed by dxf_entities_free ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_scan_file
+(
+        const char *filename,
+                /*!< filename of the DXF file. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *fp = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char previous[DXF_MAX_STRING_LENGTH];
+
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->solid_list = dxf_solid_init (entities->solid_list);
-        if (entities->solid_list == NULL)
+        if (entities->source != NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () entities were already scanned from: %s.\n")),
+                  __FUNCTION__, entities->source->filename);
+                return (EXIT_FAILURE);
         }
-        entities->spline_list = dxf_spline_init (entities->spline_list);
-        if (entities->spline_list == NULL)
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                return (EXIT_FAILURE);
         }
-        //entities->sun_list = NULL;
-        //entities->surface_list = NULL;
-        entities->table_list = dxf_table_init (entities->table_list);
-        if (entities->table_list == NULL)
+        fp->acad_version_number = AutoCAD_13;
+        previous[0] = '\0';
+        while ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS)
+          && (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS))
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fp->line_number += 2;
+                if ((atoi (code) == 1)
+                  && (strcmp (previous, "$ACADVER") == 0)
+                  && (strncmp (value, "AC", 2) == 0))
+                {
+                        fp->acad_version_number = atoi (value + 2);
+                }
+                if ((atoi (code) == 2)
+                  && (strcmp (value, "ENTITIES") == 0)
+                  && (strcmp (previous, "SECTION") == 0))
+                {
+                        entities->source = fp;
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (dxf_entities_scan (fp, entities));
+                }
+                strcpy (previous, value);
         }
-        entities->text_list = dxf_text_init (entities->text_list);
-        if (entities->text_list == NULL)
+        fprintf (stderr,
+          (_("Warning in %s () no ENTITIES section found in: %s.\n")),
+          __FUNCTION__, filename);
+        dxf_read_close (fp);
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Read the geometry of lazily loaded entities as single
+ * precision offsets from an origin.
+ *
+ * Call after dxf_entities_scan_file (), entities read on first access
+ * from then on store their geometry in single precision, see
+ * dxf_read_set_single_precision () for the entities which support
+ * it.\n
+ * Entities read before are not converted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_set_single_precision
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->tolerance_list = dxf_tolerance_init (entities->tolerance_list);
-        if (entities->tolerance_list == NULL)
+        if (entities->source == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () entities were not scanned from a file.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        entities->trace_list = dxf_trace_init (entities->trace_list);
-        if (entities->trace_list == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_read_set_single_precision (entities->source, origin_x, origin_y, origin_z));
+}
+
+
+/*!
+ * \brief Get the number of lazily loaded entities in a DXF \c ENTITIES
+ * section.
+ *
+ * \return the number of lazy items, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_get_number_of_lazy_items
+(
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        //entities->underlay_list = NULL;
-        entities->vertex_list = dxf_vertex_init (entities->vertex_list);
-        if (entities->vertex_list == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities->number_of_lazy_items);
+}
+
+
+/*!
+ * \brief Get the lazy item at \c position in a DXF \c ENTITIES section.
+ *
+ * The type, handle and layer of the entity can be inspected without
+ * reading the entity.
+ *
+ * \return a pointer to the lazy item, or \c NULL when an error
+ * occurred.
+ */
+DxfEntitiesLazyItem *
+dxf_entities_get_lazy_item
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int position
+                /*!< position of the entity in file order, starting at
+                 * 0. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
-        entities->viewport_list = dxf_viewport_init (entities->viewport_list);
-        if (entities->viewport_list == NULL)
+        if ((position < 0) || (position >= entities->number_of_lazy_items))
         {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
+                fprintf (stderr,
+                  (_("Error in %s () position %d is out of range.\n")),
+                  __FUNCTION__, position);
+                return (NULL);
         }
-        //entities->wipeout_list = NULL;
-        //entities->xline_list = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (entities);
+        return (&entities->lazy_items[position]);
 }
 
 
 /*!
- * \brief Read and parse the \c ENTITIES table from a DXF file.
+ * \brief Read an entity of type \c type from a DXF file.
+ *
+ * The file is expected to be positioned just after the entity name.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred or
+ * the type of entity can not be read.
  */
-int
-dxf_entities_read_table
+void *
+dxf_entities_read_entity
 (
-        char *filename,
-                /*!< filename of input file (or device). */
-        FILE *fp,
-                /*!< filepointer to the input file (or device). */
-        int line_number,
-                /*!< current line number in the input file (or device). */
-        char *dxf_entities_list,
-                /*!< pointer to a list of entities. */
-        int acad_version_number
-                /*!< AutoCAD DXF version number. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityType type
+                /*!< type of entity. */
+)
+{
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_3dface_read (fp, dxf_3dface_init (dxf_3dface_new ())));
+                case DSOLID:
+                        return (dxf_3dsolid_read (fp, dxf_3dsolid_init (dxf_3dsolid_new ())));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_read (fp, dxf_acad_proxy_entity_init (dxf_acad_proxy_entity_new ())));
+                case ARC:
+                        return (dxf_arc_read (fp, dxf_arc_init (dxf_arc_new ())));
+                case ATTDEF:
+                        return (dxf_attdef_read (fp, dxf_attdef_init (dxf_attdef_new ())));
+                case ATTRIB:
+                        return (dxf_attrib_read (fp, dxf_attrib_init (dxf_attrib_new ())));
+                case BODY:
+                        return (dxf_body_read (fp, dxf_body_init (dxf_body_new ())));
+                case CIRCLE:
+                        return (dxf_circle_read (fp, dxf_circle_init (dxf_circle_new ())));
+                case DIMENSION:
+                        return (dxf_dimension_read (fp, dxf_dimension_init (dxf_dimension_new ())));
+                case ELLIPSE:
+                        return (dxf_ellipse_read (fp, dxf_ellipse_init (dxf_ellipse_new ())));
+                case HATCH:
+                        return (dxf_hatch_read (fp, dxf_hatch_init (dxf_hatch_new ())));
+                case HELIX:
+                        return (dxf_helix_read (fp, dxf_helix_init (dxf_helix_new ())));
+                case IMAGE:
+                        return (dxf_image_read (fp, dxf_image_init (dxf_image_new ())));
+                case INSERT:
+                        return (dxf_insert_read (fp, dxf_insert_init (dxf_insert_new ())));
+                case LEADER:
+                        return (dxf_leader_read (fp, dxf_leader_init (dxf_leader_new ())));
+                case LIGHT:
+                        return (dxf_light_read (fp, dxf_light_init (dxf_light_new ())));
+                case LINE:
+                        return (dxf_line_read (fp, dxf_line_init (dxf_line_new ())));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_read (fp, dxf_lwpolyline_init (dxf_lwpolyline_new ())));
+                case MESH:
+                        return (dxf_mesh_read (fp, dxf_mesh_init (dxf_mesh_new ())));
+                case MLINE:
+                        return (dxf_mline_read (fp, dxf_mline_init (dxf_mline_new ())));
+                case MTEXT:
+                        return (dxf_mtext_read (fp, dxf_mtext_init (dxf_mtext_new ())));
+                case OLEFRAME:
+                        return (dxf_oleframe_read (fp, dxf_oleframe_init (dxf_oleframe_new ())));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_read (fp, dxf_ole2frame_init (dxf_ole2frame_new ())));
+                case POINT:
+                        return (dxf_point_read (fp, dxf_point_init (dxf_point_new ())));
+                case POLYLINE:
+                        return (dxf_polyline_read (fp, dxf_polyline_init (dxf_polyline_new ())));
+                case RAY:
+                        return (dxf_ray_read (fp, dxf_ray_init (dxf_ray_new ())));
+                case REGION:
+                        return (dxf_region_read (fp, dxf_region_init (dxf_region_new ())));
+                case SHAPE:
+                        return (dxf_shape_read (fp, dxf_shape_init (dxf_shape_new ())));
+                case SOLID:
+                        return (dxf_solid_read (fp, dxf_solid_init (dxf_solid_new ())));
+                case SPLINE:
+                        return (dxf_spline_read (fp, dxf_spline_init (dxf_spline_new ())));
+                case TABLE:
+                        return (dxf_table_read (fp, dxf_table_init (dxf_table_new ())));
+                case TEXT:
+                        return (dxf_text_read (fp, dxf_text_init (dxf_text_new ())));
+                case TOLERANCE:
+                        return (dxf_tolerance_read (fp, dxf_tolerance_init (dxf_tolerance_new ())));
+                case TRACE:
+                        return (dxf_trace_read (fp, dxf_trace_init (dxf_trace_new ())));
+                case VERTEX:
+                        return (dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ())));
+                case VIEWPORT:
+                        return (dxf_viewport_read (fp, dxf_viewport_init (dxf_viewport_new ())));
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () reading an entity of type %s is not supported.\n")),
+                          __FUNCTION__, dxf_entity_get_name (type));
+                        return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Get the entity at \c position of a lazily loaded DXF
+ * \c ENTITIES section, reading it on first access.
+ *
+ * The type of the entity is stored in \c type when \c type is not
+ * \c NULL.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred
+ * or the type of entity can not be read by dxf_entities_read_entity ().
+ */
+void *
+dxf_entities_materialize
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int position,
+                /*!< position of the entity in file order, starting at
+                 * 0. */
+        DxfEntityType *type
+                /*!< type of the returned entity, may be \c NULL. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        DxfEntitiesLazyItem *item;
+
+        item = dxf_entities_get_lazy_item (entities, position);
+        if (item == NULL)
+        {
+                return (NULL);
+        }
+        if (type != NULL)
+        {
+                *type = item->type;
+        }
+        if ((item->entity == NULL)
+          && (item->type != UNKNOWN_ENTITY))
+        {
+                if ((entities->source == NULL)
+                  || (fseek (entities->source->fp, item->begin, SEEK_SET) != 0))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not seek to entity %d.\n")),
+                          __FUNCTION__, position);
+                        return (NULL);
+                }
+                item->entity = dxf_entities_read_entity (entities->source, item->type);
+                if ((item->entity != NULL)
+                  && (item->number_of_children > 0)
+                  && (dxf_entities_read_children (entities->source, item) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not read the sequence of entity %d.\n")),
+                          __FUNCTION__, position);
+                }
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (item->entity);
 }
 
 
 /*!
- * \brief Write DXF output to a file for a DXF \c ENTITIES table.
+ * \brief Free an entity of type \c type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
-dxf_entities_write_table
+dxf_entities_free_entity
 (
-        char *dxf_entities_list,
-                /*!< pointer to a list of entities. */
-        int acad_version_number
-                /*!< AutoCAD DXF version number. */
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        /* dxf_3dface_free () returns NULL when done. */
+                        return ((dxf_3dface_free ((Dxf3dface *) entity) == NULL)
+                          ? EXIT_SUCCESS
+                          : EXIT_FAILURE);
+                case DSOLID:
+                        return (dxf_3dsolid_free ((Dxf3dsolid *) entity));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_free ((DxfAcadProxyEntity *) entity));
+                case ARC:
+                        return (dxf_arc_free ((DxfArc *) entity));
+                case ATTDEF:
+                        return (dxf_attdef_free ((DxfAttdef *) entity));
+                case ATTRIB:
+                        return (dxf_attrib_free ((DxfAttrib *) entity));
+                case BODY:
+                        return (dxf_body_free ((DxfBody *) entity));
+                case CIRCLE:
+                        return (dxf_circle_free ((DxfCircle *) entity));
+                case DIMENSION:
+                        return (dxf_dimension_free ((DxfDimension *) entity));
+                case ELLIPSE:
+                        return (dxf_ellipse_free ((DxfEllipse *) entity));
+                case HATCH:
+                        return (dxf_hatch_free ((DxfHatch *) entity));
+                case HELIX:
+                        return (dxf_helix_free ((DxfHelix *) entity));
+                case IMAGE:
+                        return (dxf_image_free ((DxfImage *) entity));
+                case INSERT:
+                        return (dxf_insert_free ((DxfInsert *) entity));
+                case LEADER:
+                        return (dxf_leader_free ((DxfLeader *) entity));
+                case LIGHT:
+                        return (dxf_light_free ((DxfLight *) entity));
+                case LINE:
+                        return (dxf_line_free ((DxfLine *) entity));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_free ((DxfLWPolyline *) entity));
+                case MESH:
+                        return (dxf_mesh_free ((DxfMesh *) entity));
+                case MLINE:
+                        return (dxf_mline_free ((DxfMline *) entity));
+                case MTEXT:
+                        return (dxf_mtext_free ((DxfMtext *) entity));
+                case OLEFRAME:
+                        return (dxf_oleframe_free ((DxfOleFrame *) entity));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_free ((DxfOle2Frame *) entity));
+                case POINT:
+                        return (dxf_point_free ((DxfPoint *) entity));
+                case POLYLINE:
+                        return (dxf_polyline_free ((DxfPolyline *) entity));
+                case RAY:
+                        return (dxf_ray_free ((DxfRay *) entity));
+                case REGION:
+                        return (dxf_region_free ((DxfRegion *) entity));
+                case SHAPE:
+                        return (dxf_shape_free ((DxfShape *) entity));
+                case SOLID:
+                        return (dxf_solid_free ((DxfSolid *) entity));
+                case SPLINE:
+                        return (dxf_spline_free ((DxfSpline *) entity));
+                case TABLE:
+                        return (dxf_table_free ((DxfTable *) entity));
+                case TEXT:
+                        return (dxf_text_free ((DxfText *) entity));
+                case TOLERANCE:
+                        return (dxf_tolerance_free ((DxfTolerance *) entity));
+                case TRACE:
+                        return (dxf_trace_free ((DxfTrace *) entity));
+                case VERTEX:
+                        return (dxf_vertex_free ((DxfVertex *) entity));
+                case VIEWPORT:
+                        return (dxf_viewport_free ((DxfViewport *) entity));
+                default:
+                        return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief Get the identification number (handle) of an entity of type
+ * \c type.
+ *
+ * \return the id-code of the entity, or \c DXF_HANDLE_NONE when the
+ * type is not supported or an error occurred.
+ */
+DxfHandle
+dxf_entities_get_id_code
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+        DxfEntityCommon *common;
+
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (DXF_HANDLE_NONE);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_3dface_get_id_code ((Dxf3dface *) entity));
+                case DSOLID:
+                        return (dxf_3dsolid_get_id_code ((Dxf3dsolid *) entity));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_get_id_code ((DxfAcadProxyEntity *) entity));
+                case ARC:
+                        return (dxf_arc_get_id_code ((DxfArc *) entity));
+                case ATTDEF:
+                        return (dxf_attdef_get_id_code ((DxfAttdef *) entity));
+                case ATTRIB:
+                        return (dxf_attrib_get_id_code ((DxfAttrib *) entity));
+                case BODY:
+                        return (dxf_body_get_id_code ((DxfBody *) entity));
+                case CIRCLE:
+                        return (dxf_circle_get_id_code ((DxfCircle *) entity));
+                case DIMENSION:
+                        return (dxf_dimension_get_id_code ((DxfDimension *) entity));
+                case ELLIPSE:
+                        return (dxf_ellipse_get_id_code ((DxfEllipse *) entity));
+                case HATCH:
+                        return (dxf_hatch_get_id_code ((DxfHatch *) entity));
+                case HELIX:
+                        return (dxf_helix_get_id_code ((DxfHelix *) entity));
+                case IMAGE:
+                        return (dxf_image_get_id_code ((DxfImage *) entity));
+                case INSERT:
+                        return (dxf_insert_get_id_code ((DxfInsert *) entity));
+                case LEADER:
+                        return (dxf_leader_get_id_code ((DxfLeader *) entity));
+                case LIGHT:
+                        return (dxf_light_get_id_code ((DxfLight *) entity));
+                case LINE:
+                        return (dxf_line_get_id_code ((DxfLine *) entity));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_get_id_code ((DxfLWPolyline *) entity));
+                case MLINE:
+                        return (dxf_mline_get_id_code ((DxfMline *) entity));
+                case MTEXT:
+                        return (dxf_mtext_get_id_code ((DxfMtext *) entity));
+                case OLEFRAME:
+                        return (dxf_oleframe_get_id_code ((DxfOleFrame *) entity));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_get_id_code ((DxfOle2Frame *) entity));
+                case POINT:
+                        return (dxf_point_get_id_code ((DxfPoint *) entity));
+                case POLYLINE:
+                        return (dxf_polyline_get_id_code ((DxfPolyline *) entity));
+                case RAY:
+                        return (dxf_ray_get_id_code ((DxfRay *) entity));
+                case REGION:
+                        return (dxf_region_get_id_code ((DxfRegion *) entity));
+                case SHAPE:
+                        return (dxf_shape_get_id_code ((DxfShape *) entity));
+                case SOLID:
+                        return (dxf_solid_get_id_code ((DxfSolid *) entity));
+                case SPLINE:
+                        return (dxf_spline_get_id_code ((DxfSpline *) entity));
+                case TEXT:
+                        return (dxf_text_get_id_code ((DxfText *) entity));
+                case TOLERANCE:
+                        return (dxf_tolerance_get_id_code ((DxfTolerance *) entity));
+                case TRACE:
+                        return (dxf_trace_get_id_code ((DxfTrace *) entity));
+                case VERTEX:
+                        return (dxf_vertex_get_id_code ((DxfVertex *) entity));
+                case VIEWPORT:
+                        return (dxf_viewport_get_id_code ((DxfViewport *) entity));
+                default:
+                        /* Entities without an accessor of their own. */
+                        common = dxf_entity_get_common (type, entity);
+                        return ((common != NULL) ? common->id_code : DXF_HANDLE_NONE);
+        }
+}
+
+/*!
+ * \brief Get the layer name of an entity of any type.
+ *
+ * Unlike the dxf_*_get_layer () functions the name is not copied.
+ *
+ * \return a pointer to the layer name owned by \c entity, or \c NULL
+ * when an error occurred or the type is not supported.
+ */
+const char *
+dxf_entities_get_layer
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+        DxfEntityCommon *common = NULL;
+
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        common = dxf_entity_get_common (type, entity);
+        return ((common != NULL) ? common->layer : NULL);
+}
+
+
+
+/*!
+ * \brief Copy an entity of type \c type.
+ *
+ * Supported are the entities the library creates and edits most,
+ * \c 3DFACE, \c ARC, \c CIRCLE, \c ELLIPSE, \c INSERT, \c LINE,
+ * \c LWPOLYLINE, \c MESH, \c MTEXT, \c POINT, \c RAY, \c SOLID,
+ * \c TEXT and \c TRACE.\n
+ * For any other type \c NULL is returned and an error is reported,
+ * the entity itself is left untouched.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when the
+ * type is not supported or an error occurred.
+ */
+void *
+dxf_entities_copy_entity
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        void *copy = NULL;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        copy = dxf_3dface_copy ((Dxf3dface *) entity);
+                        break;
+                case DSOLID:
+                        copy = dxf_3dsolid_copy ((Dxf3dsolid *) entity);
+                        break;
+                case ACADPROXYENTITY:
+                        copy = dxf_acad_proxy_entity_copy ((DxfAcadProxyEntity *) entity);
+                        break;
+                case ARC:
+                        copy = dxf_arc_copy ((DxfArc *) entity);
+                        break;
+                case ATTDEF:
+                        copy = dxf_attdef_copy ((DxfAttdef *) entity);
+                        break;
+                case ATTRIB:
+                        copy = dxf_attrib_copy ((DxfAttrib *) entity);
+                        break;
+                case BODY:
+                        copy = dxf_body_copy ((DxfBody *) entity);
+                        break;
+                case CIRCLE:
+                        copy = dxf_circle_copy ((DxfCircle *) entity);
+                        break;
+                case DIMENSION:
+                        copy = dxf_dimension_copy ((DxfDimension *) entity);
+                        break;
+                case ELLIPSE:
+                        copy = dxf_ellipse_copy ((DxfEllipse *) entity);
+                        break;
+                case HATCH:
+                        copy = dxf_hatch_copy ((DxfHatch *) entity);
+                        break;
+                case HELIX:
+                        copy = dxf_helix_copy ((DxfHelix *) entity);
+                        break;
+                case IMAGE:
+                        copy = dxf_image_copy ((DxfImage *) entity);
+                        break;
+                case INSERT:
+                        copy = dxf_insert_copy ((DxfInsert *) entity);
+                        break;
+                case LEADER:
+                        copy = dxf_leader_copy ((DxfLeader *) entity);
+                        break;
+                case LIGHT:
+                        copy = dxf_light_copy ((DxfLight *) entity);
+                        break;
+                case LINE:
+                        copy = dxf_line_copy ((DxfLine *) entity);
+                        break;
+                case LWPOLYLINE:
+                        copy = dxf_lwpolyline_copy ((DxfLWPolyline *) entity);
+                        break;
+                case MESH:
+                        copy = dxf_mesh_copy ((DxfMesh *) entity);
+                        break;
+                case MLINE:
+                        copy = dxf_mline_copy ((DxfMline *) entity);
+                        break;
+                case MTEXT:
+                        copy = dxf_mtext_copy ((DxfMtext *) entity);
+                        break;
+                case OLEFRAME:
+                        copy = dxf_oleframe_copy ((DxfOleFrame *) entity);
+                        break;
+                case OLE2FRAME:
+                        copy = dxf_ole2frame_copy ((DxfOle2Frame *) entity);
+                        break;
+                case POINT:
+                        copy = dxf_point_copy ((DxfPoint *) entity);
+                        break;
+                case POLYLINE:
+                        copy = dxf_polyline_copy ((DxfPolyline *) entity);
+                        break;
+                case RAY:
+                        copy = dxf_ray_copy ((DxfRay *) entity);
+                        break;
+                case REGION:
+                        copy = dxf_region_copy ((DxfRegion *) entity);
+                        break;
+                case SHAPE:
+                        copy = dxf_shape_copy ((DxfShape *) entity);
+                        break;
+                case SOLID:
+                        copy = dxf_solid_copy ((DxfSolid *) entity);
+                        break;
+                case SPLINE:
+                        copy = dxf_spline_copy ((DxfSpline *) entity);
+                        break;
+                case TABLE:
+                        copy = dxf_table_copy ((DxfTable *) entity);
+                        break;
+                case TEXT:
+                        copy = dxf_text_copy ((DxfText *) entity);
+                        break;
+                case TOLERANCE:
+                        copy = dxf_tolerance_copy ((DxfTolerance *) entity);
+                        break;
+                case TRACE:
+                        copy = dxf_trace_copy ((DxfTrace *) entity);
+                        break;
+                case VERTEX:
+                        copy = dxf_vertex_copy ((DxfVertex *) entity);
+                        break;
+                case VIEWPORT:
+                        copy = dxf_viewport_copy ((DxfViewport *) entity);
+                        break;
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () copying an entity of type %s is not supported.\n")),
+                          __FUNCTION__, dxf_entity_get_name (type));
+                        break;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (copy);
 }
 
 
 /*!
- * \brief Free the allocated memory for a DXF \c ENTITIES section and
- * all it's data fields.
+ * \brief Release the entity at \c position of a lazily loaded DXF
+ * \c ENTITIES section.
+ *
+ * Only the entity is freed, the type, handle, layer and byte range are
+ * kept so the entity is read again on the next access.
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
 int
-dxf_entities_free
+dxf_entities_release
 (
-        DxfEntities *entities
-                /*!< Pointer to the memory occupied by the DXF
-                 * \c ENTITIES section. */
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        int position
+                /*!< position of the entity in file order, starting at
+                 * 0. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        if (entities == NULL)
+        DxfEntitiesLazyItem *item;
+        int status = EXIT_SUCCESS;
+
+        item = dxf_entities_get_lazy_item (entities, position);
+        if (item == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        dxf_3dface_free_list ((Dxf3dface *) entities->dface_list);
-        dxf_3dsolid_free_list ((Dxf3dsolid *) entities->dsolid_list);
-        dxf_acad_proxy_entity_free_list ((DxfAcadProxyEntity *) entities->acad_proxy_entity_list);
-        dxf_arc_free_list ((DxfArc *) entities->arc_list);
-        dxf_attdef_free_list ((DxfAttdef *) entities->attdef_list);
-        dxf_attrib_free_list ((DxfAttrib *) entities->attrib_list);
-        dxf_body_free_list ((DxfBody *) entities->body_list);
-        dxf_circle_free_list ((DxfCircle *) entities->circle_list);
-        dxf_dimension_free_list ((DxfDimension *) entities->dimension_list);
-        dxf_ellipse_free_list ((DxfEllipse *) entities->ellipse_list);
-        dxf_hatch_free_list ((DxfHatch *) entities->hatch_list);
-        //dxf_helix_free_list ((DxfHelix *) entities->helix_list);
-        dxf_image_free_list ((DxfImage *) entities->image_list);
-        dxf_insert_free_list ((DxfInsert *) entities->insert_list);
-        dxf_leader_free_list ((DxfLeader *) entities->leader_list);
-        dxf_light_free_list ((DxfLight *) entities->light_list);
-        dxf_line_free_list ((DxfLine *) entities->line_list);
-        dxf_lwpolyline_free_list ((DxfLWPolyline *) entities->lw_polyline_list);
-        //dxf_light_free_list ((DxfLight *) entities->light_list);
-        dxf_mline_free_list ((DxfMline *) entities->mline_list);
-        //dxf_mleader_free_list ((DxfMLeader *) entities->mleader_list);
-        //dxf_mleaderstyle_free_list ((DxfMLeaderStyle *) entities->mleaderstyle_list);
-        dxf_mtext_free_list ((DxfMtext *) entities->mtext_list);
-        dxf_oleframe_free_list ((DxfOleFrame *) entities->oleframe_list);
-        dxf_ole2frame_free_list ((DxfOle2Frame *) entities->ole2frame_list);
-        dxf_point_free_list ((DxfPoint *) entities->point_list);
-        dxf_polyline_free_list ((DxfPolyline *) entities->polyline_list);
-        dxf_ray_free_list ((DxfRay *) entities->ray_list);
-        dxf_region_free_list ((DxfRegion *) entities->region_list);
-        //dxf_section_free_list ((DxfSection *) entities->section_list);
-        dxf_shape_free_list ((DxfShape *) entities->shape_list);
-        dxf_solid_free_list ((DxfSolid *) entities->solid_list);
-        //dxf_spline_free_list (DxfSpline *) entities->spline_list);
-        //dxf_sun_free_list (DxfSun *) entities->sun_list);
-        //dxf_surface_free_list (DxfSurface *) entities->surface_list);
-        dxf_table_free_list ((DxfTable *) entities->table_list);
-        dxf_text_free_list ((DxfText *) entities->text_list);
-        dxf_tolerance_free_list ((DxfTolerance *) entities->tolerance_list);
-        dxf_trace_free_list ((DxfTrace *) entities->trace_list);
-        //dxf_underlay_free_list (DxfUnderlay *) entities->underlay_list);
-        dxf_vertex_free_list ((DxfVertex *) entities->vertex_list);
-        dxf_viewport_free_list ((DxfViewport *) entities->viewport_list);
-        //dxf_wipeout_free_list (DxfWipeout *) entities->wipeout_list);
-        //dxf_xline_free_list (DxfXLine *) entities->xline_list);
-        free (entities);
-        entities = NULL;
+        if (item->entity != NULL)
+        {
+                status = dxf_entities_free_entity (item->type, item->entity);
+                item->entity = NULL;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (status);
 }
 
 
@@ -76,7 +76,7 @@
 #include "light.h"
 #include "line.h"
 #include "lwpolyline.h"
-//#include "mesh.h"
+#include "mesh.h"
 #include "mline.h"
 //#include "mleader.h"
 #include "mtext.h"
@@ -107,6 +107,87 @@ extern "C" {
 #endif
 
 
+#define DXF_ENTITIES_INITIAL_SIZE 16
+        /*!< \brief Initial number of slots allocated for the entity
+         * sequence and for each of the per type entity pools. */
+
+
+/*!
+ * \brief Reference to an entity in the file order sequence of a DXF
+ * \c ENTITIES section.
+ */
+typedef struct
+dxf_entities_item_struct
+{
+        DxfEntityType type;
+                /*!< Type of the entity. */
+        int index;
+                /*!< Index of the entity in the pool of entities of
+                 * type \c type. */
+} DxfEntitiesItem;
+
+
+/*!
+ * \brief DXF definition of an entity in a lazily loaded DXF \c ENTITIES
+ * section.
+ *
+ * Only the type, handle, layer and byte range of the entity are
+ * recorded while scanning the file, the entity itself is read on first
+ * access.\n
+ * The \c VERTEX entities following a \c POLYLINE and the \c ATTRIB
+ * entities following an \c INSERT, up to and including the \c SEQEND,
+ * are part of the byte range of the \c POLYLINE or \c INSERT.
+ */
+typedef struct
+dxf_entities_lazy_item_struct
+{
+        DxfEntityType type;
+                /*!< Type of the entity, \c UNKNOWN_ENTITY for entities
+                 * which can not be read (yet). */
+        DxfHandle id_code;
+                /*!< Identification number (handle) of the entity.\n
+                 * Group code = 5. */
+        char *layer;
+                /*!< Layer on which the entity is drawn.\n
+                 * Group code = 8. */
+        char *block_name;
+                /*!< Name of the block referenced by an \c INSERT or
+                 * \c DIMENSION entity, else \c NULL.\n
+                 * Group code = 2. */
+        long begin;
+                /*!< Byte offset of the first group code following the
+                 * entity name. */
+        long end;
+                /*!< Byte offset of the "  0" group code following the
+                 * entity, or following the \c SEQEND of a sequence. */
+        int number_of_children;
+                /*!< Number of \c VERTEX or \c ATTRIB entities in the
+                 * sequence following a \c POLYLINE or \c INSERT. */
+        void *entity;
+                /*!< The entity once it has been read, \c NULL until
+                 * then or after it has been released. */
+} DxfEntitiesLazyItem;
+
+
+/*!
+ * \brief Contiguous block of memory holding the entities created by one
+ * call of dxf_entities_create_lines () or dxf_entities_create_points ().
+ *
+ * The entities in a block are not allocated individually, they are
+ * freed with their block by dxf_entities_free ().
+ */
+typedef struct
+dxf_entities_batch_struct
+{
+        DxfEntityType type;
+                /*!< Type of the entities in the block. */
+        char *data;
+                /*!< Start of the block. */
+        size_t size;
+                /*!< Size of the block in bytes. */
+} DxfEntitiesBatch;
+
+
 /*!
  * \brief Definition of a DXF entity container.
  */
@@ -131,7 +212,7 @@ dxf_entities_struct
     struct DxfLight *light_list;
     struct DxfLine *line_list;
     struct DxfLWPolyline *lw_polyline_list;
-    //struct DxfMesh *mesh_list;
+    struct DxfMesh *mesh_list;
     struct DxfMline *mline_list;
     //struct DxfMleader *mleader_list;
     //struct DxfMLeaderStyle *mleaderstyle_list;
@@ -157,6 +238,43 @@ dxf_entities_struct
     struct DxfViewport *viewport_list;
     //struct DxfWipeout *wipeout_list;
     //struct DxfXLine *xline_list;
+    void *last[DXF_NUMBER_OF_ENTITY_TYPES];
+        /*!< Pointers to the last entity in each of the single linked
+         * lists above, indexed by \c DxfEntityType.\n
+         * Maintained by dxf_entities_append () so that appending an
+         * entity costs O(1), \c NULL if not known yet. */
+    DxfEntitiesItem *sequence;
+        /*!< Contiguous array with all entities in the order they
+         * were appended (file order). */
+    int number_of_entities;
+        /*!< Number of items in use in \c sequence. */
+    int sequence_size;
+        /*!< Number of items allocated for \c sequence. */
+    void **pool[DXF_NUMBER_OF_ENTITY_TYPES];
+        /*!< Contiguous arrays with pointers to the entities of each
+         * type, indexed by \c DxfEntityType.\n
+         * A pool is an index into the entities for access by type and
+         * position in O(1), the entities themselves are owned by the
+         * lists above. */
+    int pool_count[DXF_NUMBER_OF_ENTITY_TYPES];
+        /*!< Number of entities in use in each pool. */
+    int pool_size[DXF_NUMBER_OF_ENTITY_TYPES];
+        /*!< Number of entities allocated for each pool. */
+    DxfFile *source;
+        /*!< DXF file the lazy items were scanned from, kept open to
+         * read entities on first access. */
+    DxfEntitiesLazyItem *lazy_items;
+        /*!< Contiguous array with the lazily loaded entities in file
+         * order. */
+    int number_of_lazy_items;
+        /*!< Number of items in use in \c lazy_items. */
+    int lazy_items_size;
+        /*!< Number of items allocated for \c lazy_items. */
+    DxfEntitiesBatch *batches;
+        /*!< Contiguous array with the blocks of entities created in
+         * batches, \c NULL if there are none. */
+    int number_of_batches;
+        /*!< Number of items in \c batches. */
 } DxfEntities;
 
 
@@ -165,6 +283,31 @@ DxfEntities *dxf_entities_init (DxfEntities *entities);
 int dxf_entities_read_table (char *filename, FILE *fp, int line_number, char *dxf_entities_list, int acad_version_number);
 int dxf_entities_write_table (char *dxf_entities_list, int acad_version_number);
 int dxf_entities_free (DxfEntities *entities);
+int dxf_entities_append (DxfEntities *entities, DxfEntityType type, void *entity);
+int dxf_entities_create_lines (DxfEntities *entities, int number, char **layer, const int16_t *color, const double *x0, const double *y0, const double *z0, const double *x1, const double *y1, const double *z1);
+int dxf_entities_create_points (DxfEntities *entities, int number, char **layer, const int16_t *color, const double *x0, const double *y0, const double *z0);
+int dxf_entities_create_lwpolylines (DxfEntities *entities, int number, char **layer, const int16_t *color, const int *number_vertices, const double *x, const double *y);
+void *dxf_entities_get_first (DxfEntities *entities, DxfEntityType type);
+void *dxf_entities_get_next (DxfEntityType type, void *entity);
+int dxf_entities_get_number_of_entities (DxfEntities *entities);
+void *dxf_entities_get_entity (DxfEntities *entities, int position, DxfEntityType *type);
+int dxf_entities_get_number_of_entities_of_type (DxfEntities *entities, DxfEntityType type);
+void *dxf_entities_get_entity_of_type (DxfEntities *entities, DxfEntityType type, int index);
+int dxf_entities_write_entity (DxfFile *fp, DxfEntityType type, void *entity);
+int dxf_entities_write (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_get_line (FILE *file, char *line, int size);
+int dxf_entities_scan (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_scan_file (const char *filename, DxfEntities *entities);
+int dxf_entities_set_single_precision (DxfEntities *entities, double origin_x, double origin_y, double origin_z);
+int dxf_entities_get_number_of_lazy_items (DxfEntities *entities);
+DxfEntitiesLazyItem *dxf_entities_get_lazy_item (DxfEntities *entities, int position);
+void *dxf_entities_read_entity (DxfFile *fp, DxfEntityType type);
+void *dxf_entities_materialize (DxfEntities *entities, int position, DxfEntityType *type);
+int dxf_entities_free_entity (DxfEntityType type, void *entity);
+DxfHandle dxf_entities_get_id_code (DxfEntityType type, void *entity);
+const char *dxf_entities_get_layer (DxfEntityType type, void *entity);
+void *dxf_entities_copy_entity (DxfEntityType type, void *entity);
+int dxf_entities_release (DxfEntities *entities, int position);
 
 
 #ifdef __cplusplus
@@ -36,6 +36,101 @@
 
 
 #include "global.h"
+#include "binary_data.h"
+#include "3dface.h"
+#include "3dsolid.h"
+#include "acad_proxy_entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "body.h"
+#include "circle.h"
+#include "dimension.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "light.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mesh.h"
+#include "mleader.h"
+#include "mline.h"
+#include "mtext.h"
+#include "ole2frame.h"
+#include "oleframe.h"
+#include "point.h"
+#include "polyline.h"
+#include "ray.h"
+#include "region.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "sun.h"
+#include "surface.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "vertex.h"
+#include "viewport.h"
+#include "xline.h"
+
+
+/*!
+ * \brief Names of the entity types as used in a DXF file, indexed by
+ * \c DxfEntityType.
+ */
+static const char *dxf_entity_names[DXF_NUMBER_OF_ENTITY_TYPES] =
+{
+        "",
+        "3DFACE",
+        "3DSOLID",
+        "ACAD_PROXY_ENTITY",
+        "ARC",
+        "ATTDEF",
+        "ATTRIB",
+        "BODY",
+        "CIRCLE",
+        "DIMENSION",
+        "ELLIPSE",
+        "HATCH",
+        "HELIX",
+        "IMAGE",
+        "INSERT",
+        "LEADER",
+        "LIGHT",
+        "LINE",
+        "LWPOLYLINE",
+        "MESH",
+        "MULTILEADER",
+        "MLEADERSTYLE",
+        "MTEXT",
+        "OLEFRAME",
+        "OLE2FRAME",
+        "POINT",
+        "POLYLINE",
+        "RAY",
+        "REGION",
+        "SECTION",
+        "SHAPE",
+        "SOLID",
+        "SPLINE",
+        "SUN",
+        "SURFACE",
+        "TABLE",
+        "TEXT",
+        "TOLERANCE",
+        "TRACE",
+        "UNDERLAY",
+        "VERTEX",
+        "VIEWPORT",
+        "WIPEOUT",
+        "XLINE",
+        "MLINE"
+};
 
 
 /*!
@@ -78,4 +173,756 @@ dxf_entity_skip
 }
 
 
+/*!
+ * \brief Initialize the data common to all DXF entities.
+ *
+ * The rarely used data is allocated and initialized as well, the binary
+ * data buffers are left \c NULL until there is content.
+ *
+ * \return a pointer to \c common, or \c NULL when an error occurred.
+ */
+DxfEntityCommon *
+dxf_entity_common_init
+(
+        DxfEntityCommon *common
+                /*!< Pointer to the common data of an entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (common == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        common->cold = calloc (1, sizeof (DxfEntityCommonCold));
+        if (common->cold == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        /* Assign initial values to members. */
+        common->id_code = 0;
+        common->color = DXF_COLOR_BYLAYER;
+        common->visibility = DXF_DEFAULT_VISIBILITY;
+        common->paperspace = DXF_MODELSPACE;
+        common->lineweight = 0;
+        common->color_value = 0;
+        common->layer = strdup (DXF_DEFAULT_LAYER);
+        common->linetype = strdup (DXF_DEFAULT_LINETYPE);
+        common->elevation = 0.0;
+        common->thickness = 0.0;
+        common->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        common->cold->graphics_data_size = 0;
+        common->cold->shadow_mode = 0;
+        common->cold->dictionary_owner_soft = DXF_HANDLE_NONE;
+        common->cold->object_owner_soft = DXF_HANDLE_NONE;
+        common->cold->material = DXF_HANDLE_NONE;
+        common->cold->dictionary_owner_hard = DXF_HANDLE_NONE;
+        common->cold->plot_style_name = DXF_HANDLE_NONE;
+        common->cold->color_name = strdup ("");
+        common->cold->transparency = 0;
+        common->cold->xdata_application_name = NULL;
+        common->cold->xdata_binary_data = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (common);
+}
+
+
+/*!
+ * \brief Initialize the allocated members of data common to all DXF
+ * entities, after the other members were copied from a prototype.
+ *
+ * Only the layer, the linetype and the \c cold data are allocated,
+ * the binary data buffers are left \c NULL until there is content.
+ *
+ * \return a pointer to \c common when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfEntityCommon *
+dxf_entity_common_init_from_prototype
+(
+        DxfEntityCommon *common,
+                /*!< Pointer to the common data of an entity. */
+        const char *layer
+                /*!< Layer of the entity, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (common == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        common->layer = strdup ((layer != NULL) ? layer : DXF_DEFAULT_LAYER);
+        common->linetype = strdup (DXF_DEFAULT_LINETYPE);
+        /* All default values of the cold members are zero. */
+        common->cold = calloc (1, sizeof (DxfEntityCommonCold));
+        if ((common->layer == NULL)
+          || (common->linetype == NULL)
+          || (common->cold == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        common->cold->color_name = strdup ("");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (common);
+}
+
+
+/*!
+ * \brief Free the allocated memory for the data common to all DXF
+ * entities.
+ *
+ * The memory occupied by \c common itself is part of the entity and is
+ * not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entity_common_free
+(
+        DxfEntityCommon *common
+                /*!< Pointer to the common data of an entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (common == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (common->layer);
+        free (common->linetype);
+        common->layer = NULL;
+        common->linetype = NULL;
+        if (common->cold != NULL)
+        {
+                if (common->cold->binary_graphics_data != NULL)
+                {
+                        dxf_binary_buffer_free (common->cold->binary_graphics_data);
+                }
+                if (common->cold->xdata_binary_data != NULL)
+                {
+                        dxf_binary_buffer_free (common->cold->xdata_binary_data);
+                }
+                free (common->cold->xdata_application_name);
+                free (common->cold->color_name);
+                free (common->cold);
+                common->cold = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy the data common to all DXF entities.
+ *
+ * All strings and the \c cold data, including the binary data
+ * buffers, are duplicated, so \c common and \c source can be freed
+ * independently.\n
+ * Any data already in \c common is not freed.
+ *
+ * \return a pointer to \c common when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfEntityCommon *
+dxf_entity_common_copy
+(
+        DxfEntityCommon *common,
+                /*!< Pointer to the common data to copy to. */
+        DxfEntityCommon *source
+                /*!< Pointer to the common data to copy from. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((common == NULL) || (source == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (common, source, sizeof (DxfEntityCommon));
+        common->layer = (source->layer != NULL) ? strdup (source->layer) : NULL;
+        common->linetype = (source->linetype != NULL) ? strdup (source->linetype) : NULL;
+        common->cold = NULL;
+        if (source->cold == NULL)
+        {
+                return (common);
+        }
+        common->cold = malloc (sizeof (DxfEntityCommonCold));
+        if (common->cold == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (common->cold, source->cold, sizeof (DxfEntityCommonCold));
+        common->cold->color_name = (source->cold->color_name != NULL)
+          ? strdup (source->cold->color_name) : NULL;
+        common->cold->xdata_application_name = (source->cold->xdata_application_name != NULL)
+          ? strdup (source->cold->xdata_application_name) : NULL;
+        common->cold->binary_graphics_data = (source->cold->binary_graphics_data != NULL)
+          ? dxf_binary_buffer_copy (source->cold->binary_graphics_data) : NULL;
+        common->cold->xdata_binary_data = (source->cold->xdata_binary_data != NULL)
+          ? dxf_binary_buffer_copy (source->cold->xdata_binary_data) : NULL;
+        if (((source->cold->binary_graphics_data != NULL)
+          && (common->cold->binary_graphics_data == NULL))
+          || ((source->cold->xdata_binary_data != NULL)
+          && (common->cold->xdata_binary_data == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (common);
+}
+
+
+/*!
+ * \brief Store the value of a binary chunk record, or of the
+ * registered application name of the extended data, read from a DXF
+ * file in the data common to all DXF entities.
+ *
+ * The hexadecimal data of group code 310 is appended to the proxy
+ * entity graphics data, the data of group code 1004 is appended to the
+ * binary data of the extended data.\n
+ * Invalid hexadecimal data is reported with the line in the file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entity_common_read_binary
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityCommon *common,
+                /*!< Pointer to the common data of an entity. */
+        int group_code,
+                /*!< Group code of the value, 310, 1001 or 1004. */
+        const char *value
+                /*!< The value as read from the file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryBuffer **buffer = NULL;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (common == NULL) || (value == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (common->cold == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (group_code)
+        {
+                case 310:
+                        buffer = &common->cold->binary_graphics_data;
+                        break;
+                case 1004:
+                        buffer = &common->cold->xdata_binary_data;
+                        break;
+                case 1001:
+                        free (common->cold->xdata_application_name);
+                        common->cold->xdata_application_name = strdup (value);
+                        return (EXIT_SUCCESS);
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected group code %d in: %s in line: %d.\n")),
+                          __FUNCTION__, group_code, fp->filename, fp->line_number);
+                        return (EXIT_FAILURE);
+        }
+        if (*buffer == NULL)
+        {
+                *buffer = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                if (*buffer == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (dxf_binary_buffer_append_hex (*buffer, value, strlen (value)) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () invalid binary data in: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Store a group code and value pair read from a DXF file in the
+ * data common to all DXF entities.
+ *
+ * Used by the readers of the entities for all group codes which are not
+ * specific to the entity.\n
+ * The first soft-pointer (group code 330) is stored as the owner
+ * dictionary, a following one as the owner object.\n
+ * Application-defined groups (group code 102) are skipped, comments
+ * (group code 999) are printed.\n
+ * The elevation (group code 38) is only stored for files up to R11.
+ *
+ * \return \c TRUE when \c group_code belongs to the common data, or
+ * \c FALSE when the entity has to handle the pair itself.
+ */
+int
+dxf_entity_common_read_pair
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityCommon *common,
+                /*!< Pointer to the common data of an entity. */
+        int group_code,
+                /*!< Group code of the value. */
+        const char *value
+                /*!< The value as read from the file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char **string = NULL;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (common == NULL) || (value == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (FALSE);
+        }
+        if (common->cold == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (FALSE);
+        }
+        switch (group_code)
+        {
+                case 5:
+                        common->id_code = dxf_handle_parse (value);
+                        break;
+                case 6:
+                        string = &common->linetype;
+                        break;
+                case 8:
+                        string = &common->layer;
+                        break;
+                case 38:
+                        /* Elevation only exists in output from
+                         * versions up to R11. */
+                        if (fp->acad_version_number <= AutoCAD_11)
+                        {
+                                common->elevation = atof (value);
+                        }
+                        break;
+                case 39:
+                        common->thickness = atof (value);
+                        break;
+                case 48:
+                        common->linetype_scale = atof (value);
+                        break;
+                case 60:
+                        common->visibility = (int16_t) atoi (value);
+                        break;
+                case 62:
+                        common->color = (int16_t) atoi (value);
+                        break;
+                case 67:
+                        common->paperspace = (int16_t) atoi (value);
+                        break;
+                case 92:
+                case 160:
+                        common->cold->graphics_data_size = (int32_t) atol (value);
+                        break;
+                case 102:
+                        /* Application-defined groups are skipped. */
+                        break;
+                case 284:
+                        common->cold->shadow_mode = (int16_t) atoi (value);
+                        break;
+                case 310:
+                case 1001:
+                case 1004:
+                        dxf_entity_common_read_binary (fp, common, group_code, value);
+                        break;
+                case 330:
+                        if (common->cold->dictionary_owner_soft == DXF_HANDLE_NONE)
+                        {
+                                common->cold->dictionary_owner_soft = dxf_handle_parse (value);
+                        }
+                        else
+                        {
+                                common->cold->object_owner_soft = dxf_handle_parse (value);
+                        }
+                        break;
+                case 347:
+                        common->cold->material = dxf_handle_parse (value);
+                        break;
+                case 360:
+                        common->cold->dictionary_owner_hard = dxf_handle_parse (value);
+                        break;
+                case 370:
+                        common->lineweight = (int16_t) atoi (value);
+                        break;
+                case 390:
+                        common->cold->plot_style_name = dxf_handle_parse (value);
+                        break;
+                case 420:
+                        common->color_value = (int32_t) atol (value);
+                        break;
+                case 430:
+                        string = &common->cold->color_name;
+                        break;
+                case 440:
+                        common->cold->transparency = (int32_t) atol (value);
+                        break;
+                case 999:
+                        fprintf (stdout, "DXF comment: %s\n", value);
+                        break;
+                default:
+                        return (FALSE);
+        }
+        if (string != NULL)
+        {
+                free (*string);
+                *string = strdup (value);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for the binary extended data of the
+ * data common to all DXF entities.
+ *
+ * The extended data follows all other groups of an entity, nothing is
+ * written when there is no binary data or no registered application
+ * name.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entity_common_write_xdata
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntityCommon *common
+                /*!< Pointer to the common data of an entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((fp == NULL) || (common == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((common->cold == NULL)
+          || (common->cold->xdata_binary_data == NULL)
+          || (common->cold->xdata_binary_data->length == 0)
+          || (fp->acad_version_number < AutoCAD_13))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (common->cold->xdata_application_name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () binary extended data without a registered application name is not written.\n")),
+                  __FUNCTION__);
+                return (EXIT_SUCCESS);
+        }
+        fprintf (fp->fp, "1001\n%s\n", common->cold->xdata_application_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_binary_buffer_write (fp, 1004, common->cold->xdata_binary_data));
+}
+
+
+/*!
+ * \brief Get the data common to all DXF entities from an \c entity of
+ * type \c type.
+ *
+ * This allows for generic code working on entities of any type.
+ *
+ * \return a pointer to the common data, or \c NULL when \c type is
+ * not a drawable entity type (\c MLEADERSTYLE, \c SECTION,
+ * \c UNDERLAY, \c WIPEOUT and \c UNKNOWN_ENTITY).
+ */
+DxfEntityCommon *
+dxf_entity_get_common
+(
+        DxfEntityType type,
+                /*!< type of \c entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntityCommon *common = NULL;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        common = &((Dxf3dface *) entity)->common;
+                        break;
+                case DSOLID:
+                        common = &((Dxf3dsolid *) entity)->common;
+                        break;
+                case ACADPROXYENTITY:
+                        common = &((DxfAcadProxyEntity *) entity)->common;
+                        break;
+                case ARC:
+                        common = &((DxfArc *) entity)->common;
+                        break;
+                case ATTDEF:
+                        common = &((DxfAttdef *) entity)->common;
+                        break;
+                case ATTRIB:
+                        common = &((DxfAttrib *) entity)->common;
+                        break;
+                case BODY:
+                        common = &((DxfBody *) entity)->common;
+                        break;
+                case CIRCLE:
+                        common = &((DxfCircle *) entity)->common;
+                        break;
+                case DIMENSION:
+                        common = &((DxfDimension *) entity)->common;
+                        break;
+                case ELLIPSE:
+                        common = &((DxfEllipse *) entity)->common;
+                        break;
+                case HATCH:
+                        common = &((DxfHatch *) entity)->common;
+                        break;
+                case HELIX:
+                        common = &((DxfHelix *) entity)->common;
+                        break;
+                case IMAGE:
+                        common = &((DxfImage *) entity)->common;
+                        break;
+                case INSERT:
+                        common = &((DxfInsert *) entity)->common;
+                        break;
+                case LEADER:
+                        common = &((DxfLeader *) entity)->common;
+                        break;
+                case LIGHT:
+                        common = &((DxfLight *) entity)->common;
+                        break;
+                case LINE:
+                        common = &((DxfLine *) entity)->common;
+                        break;
+                case LWPOLYLINE:
+                        common = &((DxfLWPolyline *) entity)->common;
+                        break;
+                case MESH:
+                        common = &((DxfMesh *) entity)->common;
+                        break;
+                case MLEADER:
+                        common = &((DxfMLeader *) entity)->common;
+                        break;
+                case MTEXT:
+                        common = &((DxfMtext *) entity)->common;
+                        break;
+                case OLEFRAME:
+                        common = &((DxfOleFrame *) entity)->common;
+                        break;
+                case OLE2FRAME:
+                        common = &((DxfOle2Frame *) entity)->common;
+                        break;
+                case POINT:
+                        common = &((DxfPoint *) entity)->common;
+                        break;
+                case POLYLINE:
+                        common = &((DxfPolyline *) entity)->common;
+                        break;
+                case RAY:
+                        common = &((DxfRay *) entity)->common;
+                        break;
+                case REGION:
+                        common = &((DxfRegion *) entity)->common;
+                        break;
+                case SHAPE:
+                        common = &((DxfShape *) entity)->common;
+                        break;
+                case SOLID:
+                        common = &((DxfSolid *) entity)->common;
+                        break;
+                case SPLINE:
+                        common = &((DxfSpline *) entity)->common;
+                        break;
+                case SUN:
+                        common = &((DxfSun *) entity)->common;
+                        break;
+                case SURFACE:
+                        common = &((DxfSurface *) entity)->common;
+                        break;
+                case TABLE:
+                        common = &((DxfTable *) entity)->common;
+                        break;
+                case TEXT:
+                        common = &((DxfText *) entity)->common;
+                        break;
+                case TOLERANCE:
+                        common = &((DxfTolerance *) entity)->common;
+                        break;
+                case TRACE:
+                        common = &((DxfTrace *) entity)->common;
+                        break;
+                case VERTEX:
+                        common = &((DxfVertex *) entity)->common;
+                        break;
+                case VIEWPORT:
+                        common = &((DxfViewport *) entity)->common;
+                        break;
+                case XLINE:
+                        common = &((DxfXLine *) entity)->common;
+                        break;
+                case MLINE:
+                        common = &((DxfMline *) entity)->common;
+                        break;
+                default:
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (common);
+}
+
+
+/*!
+ * \brief Get the name of an entity type as used in a DXF file.
+ *
+ * \return the name, or an empty string for \c UNKNOWN_ENTITY and out of
+ * range values.
+ */
+const char *
+dxf_entity_get_name
+(
+        DxfEntityType type
+                /*!< type of entity. */
+)
+{
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                return (dxf_entity_names[UNKNOWN_ENTITY]);
+        }
+        return (dxf_entity_names[type]);
+}
+
+
+/*!
+ * \brief Get the entity type from a name as used in a DXF file.
+ *
+ * A \c TABLE entity is named \c ACAD_TABLE in a DXF file.
+ *
+ * \return the type of entity, or \c UNKNOWN_ENTITY when \c name is
+ * not the name of a known entity type.
+ */
+DxfEntityType
+dxf_entity_get_type
+(
+        const char *name
+                /*!< name of the entity, e.g. "LINE". */
+)
+{
+        int i;
+
+        if (name == NULL)
+        {
+                return (UNKNOWN_ENTITY);
+        }
+        if (strcmp (name, "ACAD_TABLE") == 0)
+        {
+                return (TABLE);
+        }
+        for (i = UNKNOWN_ENTITY + 1; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (strcmp (name, dxf_entity_names[i]) == 0)
+                {
+                        return ((DxfEntityType) i);
+                }
+        }
+        return (UNKNOWN_ENTITY);
+}
+
+
 /* EOF */
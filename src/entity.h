@@ -93,11 +93,199 @@ dxf_entity_type
         VERTEX,
         VIEWPORT,
         WIPEOUT,
-        XLINE
+        XLINE,
+        MLINE
+                /*!< Appended after \c XLINE to keep the values of the
+                 * other entity types unchanged. */
 } DxfEntityType;
 
 
+#define DXF_NUMBER_OF_ENTITY_TYPES (MLINE + 1)
+        /*!< \brief Number of entity types in \c DxfEntityType. */
+
+
+/*!
+ * \brief Numeric DXF handle.
+ *
+ * Handles are written as hexadecimal strings in a DXF file, they are
+ * stored as a number so that references can be compared and hashed
+ * without string operations.
+ */
+typedef uint64_t DxfHandle;
+
+
+#define DXF_HANDLE_NONE 0
+        /*!< \brief Value of a handle that is not set. */
+
+
+/*!
+ * \brief Rarely used data common to all DXF entities.
+ *
+ * Kept out of DxfEntityCommon so that the frequently used members of
+ * an entity share a single cache line.
+ */
+typedef struct
+dxf_entity_common_cold_struct
+{
+        int32_t graphics_data_size;
+                /*!< Number of bytes in the proxy entity graphics
+                 * represented in the sub-sequent 310 groups, which are
+                 * binary chunk records (optional).\n
+                 * Group code = 92. */
+        int16_t shadow_mode;
+                /*!< Shadow mode:\n
+                 * <ol>
+                 * <li value = "0"> Casts and receives shadows.</li>
+                 * <li value = "1"> Casts shadows.</li>
+                 * <li value = "2"> Receives shadows.</li>
+                 * <li value = "3"> Ignores shadows.</li>
+                 * </ol>\n
+                 * Group code = 284. */
+        struct dxf_binary_buffer_struct *binary_graphics_data;
+                /*!< Proxy entity graphics data, the binary chunk
+                 * records decoded into one buffer, \c NULL when there
+                 * is no data (optional).\n
+                 * Group code = 310. */
+        DxfHandle dictionary_owner_soft;
+                /*!< Soft-pointer ID/handle to owner dictionary
+                 * (optional).\n
+                 * Group code = 330. */
+        DxfHandle object_owner_soft;
+                /*!< Soft-pointer ID/handle to owner BLOCK_RECORD
+                 * object.\n
+                 * Group code = 330. */
+        DxfHandle material;
+                /*!< Hard-pointer ID/handle to material object (present
+                 * if not BYLAYER).\n
+                 * Group code = 347. */
+        DxfHandle dictionary_owner_hard;
+                /*!< Hard owner ID/handle to owner dictionary
+                 * (optional).\n
+                 * Group code = 360. */
+        DxfHandle plot_style_name;
+                /*!< Hard pointer ID / handle of PlotStyleName object.\n
+                 * Group code = 390. */
+        char *color_name;
+                /*!< Color name.\n
+                 * Group code = 430. */
+        int32_t transparency;
+                /*!< Transparency value.\n
+                 * Group code = 440. */
+        char *xdata_application_name;
+                /*!< Registered application name of the extended data
+                 * with binary data, \c NULL when there is none.\n
+                 * Group code = 1001. */
+        struct dxf_binary_buffer_struct *xdata_binary_data;
+                /*!< Binary data of the extended data, the binary chunk
+                 * records decoded into one buffer, \c NULL when there
+                 * is no data (optional).\n
+                 * Group code = 1004. */
+} DxfEntityCommonCold;
+
+
+/*!
+ * \brief Data common to all DXF entities.
+ *
+ * Embedded as the first member of an entity, so a pointer to an entity
+ * can be used as a pointer to its DxfEntityCommon.\n
+ * The frequently used members are packed in the first 64 bytes,
+ * rarely used members live in \c cold.
+ */
+typedef struct
+dxf_entity_common_struct
+{
+        DxfHandle id_code;
+                /*!< Identification number for the entity.\n
+                 * This is to be an unique (sequential) number in the DXF
+                 * file.\n
+                 * Group code = 5. */
+        int16_t color;
+                /*!< Color of the entity.\n
+                 * Defaults to \c BYLAYER if omitted in the DXF file.\n
+                 * Group code = 62. */
+        int16_t visibility;
+                /*!< Visibility value:\n
+                 * <ol>
+                 * <li value = "0"> Visible</li>
+                 * <li value = "1"> Invisible</li>
+                 * </ol>\n
+                 * Group code = 60. */
+        int16_t paperspace;
+                /*!< Entities are to be drawn on either \c PAPERSPACE or
+                 * \c MODELSPACE.\n
+                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
+                 * Group code = 67. */
+        int16_t lineweight;
+                /*!< Lineweight enum value.\n
+                 * Stored and moved around as a 16-bit integer.\n
+                 * Group code = 370. */
+        int32_t color_value;
+                /*!< A 24-bit color value that should be dealt with in
+                 * terms of bytes with values of 0 to 255.\n
+                 * Group code = 420. */
+        char *layer;
+                /*!< Layer on which the entity is drawn.\n
+                 * Defaults to layer "0" if no valid layername is given.\n
+                 * Group code = 8. */
+        char *linetype;
+                /*!< The linetype of the entity.\n
+                 * Defaults to \c BYLAYER if omitted in the DXF file.\n
+                 * Group code = 6. */
+        double elevation;
+                /*!< Elevation of the entity in the local Z-direction.\n
+                 * Defaults to 0.0 if omitted in the DXF file, or prior
+                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
+                 * Group code = 38. */
+        double thickness;
+                /*!< Thickness of the entity in the local Z-direction.\n
+                 * Defaults to 0.0 if ommitted in the DXF file.\n
+                 * Group code = 39. */
+        double linetype_scale;
+                /*!< Linetype scale (optional).\n
+                 * Group code = 48. */
+        DxfEntityCommonCold *cold;
+                /*!< Rarely used data of the entity. */
+} DxfEntityCommon;
+
+
+/*!
+ * \brief Initializer with the default values of the members of a
+ * \c DxfEntityCommon that are not allocated.
+ *
+ * Used for the prototypes of entities, see
+ * dxf_entity_common_init_from_prototype ().
+ */
+#define DXF_ENTITY_COMMON_DEFAULTS \
+        { \
+                .id_code = 0, \
+                .color = DXF_COLOR_BYLAYER, \
+                .visibility = DXF_DEFAULT_VISIBILITY, \
+                .paperspace = DXF_MODELSPACE, \
+                .lineweight = 0, \
+                .color_value = 0, \
+                .layer = NULL, \
+                .linetype = NULL, \
+                .elevation = 0.0, \
+                .thickness = 0.0, \
+                .linetype_scale = DXF_DEFAULT_LINETYPE_SCALE, \
+                .cold = NULL \
+        }
+
+
+struct dxf_file_struct;
+
+
 int dxf_entity_skip (char *dxf_entity_name);
+DxfEntityCommon *dxf_entity_common_init (DxfEntityCommon *common);
+DxfEntityCommon *dxf_entity_common_init_from_prototype (DxfEntityCommon *common, const char *layer);
+int dxf_entity_common_free (DxfEntityCommon *common);
+DxfEntityCommon *dxf_entity_common_copy (DxfEntityCommon *common, DxfEntityCommon *source);
+int dxf_entity_common_read_binary (struct dxf_file_struct *fp, DxfEntityCommon *common, int group_code, const char *value);
+int dxf_entity_common_read_pair (struct dxf_file_struct *fp, DxfEntityCommon *common, int group_code, const char *value);
+int dxf_entity_common_write_xdata (struct dxf_file_struct *fp, DxfEntityCommon *common);
+DxfEntityCommon *dxf_entity_get_common (DxfEntityType type, void *entity);
+const char *dxf_entity_get_name (DxfEntityType type);
+DxfEntityType dxf_entity_get_type (const char *name);
 
 
 #ifdef __cplusplus
@@ -42,7 +42,7 @@
 
 char *dxf_entities_list;
 char *dxf_objects_list;
-char *dxf_blocks_list;
+DxfBlock *dxf_blocks_list = NULL;
 DxfThumbnail *dxf_thumbnail;
 
 
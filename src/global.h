@@ -206,6 +206,16 @@ dxf_file_struct
         /*!< AutoCAD version number. */
     int follow_strict_version_rules;
         /*!< follow strict rules when writing to file. */
+    int single_precision;
+        /*!< Store geometry of entities read from file as single
+         * precision offsets from the origin below, see
+         * dxf_read_set_single_precision (). */
+    double origin_x;
+        /*!< X-coordinate of the origin for single precision geometry. */
+    double origin_y;
+        /*!< Y-coordinate of the origin for single precision geometry. */
+    double origin_z;
+        /*!< Z-coordinate of the origin for single precision geometry. */
 } DxfFile;
 
 
@@ -295,6 +305,81 @@ dxf_int64_struct
 } DxfInt64;
 
 
+/*!
+ * \brief DXF definition of a growable contiguous array of double.
+ */
+typedef struct
+dxf_double_array_struct
+{
+    double *values;
+        /*!< Contiguous storage for the double values. */
+    size_t length;
+        /*!< Number of values in use. */
+    size_t capacity;
+        /*!< Number of values allocated in \c values. */
+} DxfDoubleArray;
+
+
+/*!
+ * \brief DXF definition of a growable contiguous array of int.
+ */
+typedef struct
+dxf_int_array_struct
+{
+    int *values;
+        /*!< Contiguous storage for the int values. */
+    size_t length;
+        /*!< Number of values in use. */
+    size_t capacity;
+        /*!< Number of values allocated in \c values. */
+} DxfIntArray;
+
+
+/*!
+ * \brief DXF definition of a growable contiguous array of int16_t.
+ */
+typedef struct
+dxf_int16_array_struct
+{
+    int16_t *values;
+        /*!< Contiguous storage for the int16_t values. */
+    size_t length;
+        /*!< Number of values in use. */
+    size_t capacity;
+        /*!< Number of values allocated in \c values. */
+} DxfInt16Array;
+
+
+/*!
+ * \brief DXF definition of a growable contiguous array of int32_t.
+ */
+typedef struct
+dxf_int32_array_struct
+{
+    int32_t *values;
+        /*!< Contiguous storage for the int32_t values. */
+    size_t length;
+        /*!< Number of values in use. */
+    size_t capacity;
+        /*!< Number of values allocated in \c values. */
+} DxfInt32Array;
+
+
+/*!
+ * \brief DXF definition of a growable contiguous array of int64_t.
+ */
+typedef struct
+dxf_int64_array_struct
+{
+    int64_t *values;
+        /*!< Contiguous storage for the int64_t values. */
+    size_t length;
+        /*!< Number of values in use. */
+    size_t capacity;
+        /*!< Number of values allocated in \c values. */
+} DxfInt64Array;
+
+
 /* AutoCAD(TM) versions by name */
 #define AutoCAD_1_0 0
         /*!< \brief AutoCAD Version 1.0. */
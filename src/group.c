@@ -113,11 +113,11 @@ dxf_group_init
         }
         group->id_code = 0;
         group->description = strdup ("");
-        group->handle_entity_in_group = strdup ("");
+        group->handle_entity_in_group = DXF_HANDLE_NONE;
         group->unnamed_flag = 0;
         group->selectability_flag = 0;
-        group->dictionary_owner_soft = strdup ("");
-        group->dictionary_owner_hard = strdup ("");
+        group->dictionary_owner_soft = DXF_HANDLE_NONE;
+        group->dictionary_owner_hard = DXF_HANDLE_NONE;
         group->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -191,8 +191,7 @@ dxf_group_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &group->id_code);
+                        group->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -232,22 +231,19 @@ dxf_group_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->dictionary_owner_soft);
+                        group->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a handle to an
                          * entry in group object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->handle_entity_in_group);
+                        group->handle_entity_in_group = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, group->dictionary_owner_hard);
+                        group->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -314,16 +310,16 @@ dxf_group_write
         if (strcmp (group->description, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty description string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty description string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (group->handle_entity_in_group, "") == 0)
+        if (group->handle_entity_in_group == DXF_HANDLE_NONE)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty string for handle entity in group for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty string for handle entity in group for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -332,14 +328,14 @@ dxf_group_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (group->id_code != -1)
+        if (group->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", group->id_code);
+                dxf_handle_write (fp, 5, group->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -351,18 +347,18 @@ dxf_group_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (group->dictionary_owner_soft, "") != 0)
+        if ((group->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", group->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, group->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (group->dictionary_owner_hard, "") != 0)
+        if ((group->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", group->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, group->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -372,7 +368,7 @@ dxf_group_write
         fprintf (fp->fp, "300\n%s\n", group->description);
         fprintf (fp->fp, " 70\n%d\n", group->unnamed_flag);
         fprintf (fp->fp, " 71\n%d\n", group->selectability_flag);
-        fprintf (fp->fp, "340\n%s\n", group->handle_entity_in_group);
+        dxf_handle_write (fp, 340, group->handle_entity_in_group);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -415,10 +411,7 @@ dxf_group_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (group->dictionary_owner_soft);
-        free (group->dictionary_owner_hard);
         free (group->description);
-        free (group->handle_entity_in_group);
         free (group);
         group = NULL;
 #if DEBUG
@@ -452,6 +445,7 @@ dxf_group_free_list
         while (groups != NULL)
         {
                 DxfGroup *iter = (DxfGroup *) groups->next;
+                groups->next = NULL;
                 dxf_group_free (groups);
                 groups = (DxfGroup *) iter;
         }
@@ -466,7 +460,7 @@ dxf_group_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_group_get_id_code
 (
         DxfGroup *group
@@ -484,12 +478,6 @@ dxf_group_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (group->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -505,7 +493,7 @@ dxf_group_set_id_code
 (
         DxfGroup *group,
                 /*!< a pointer to a DXF \c GROUP object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -522,12 +510,6 @@ dxf_group_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         group->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -562,17 +544,10 @@ dxf_group_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (group->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->dictionary_owner_soft));
+        return (dxf_handle_to_string (group->dictionary_owner_soft));
 }
 
 
@@ -608,7 +583,7 @@ dxf_group_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        group->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        group->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -642,17 +617,10 @@ dxf_group_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (group->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->object_owner_soft));
+        return (dxf_handle_to_string (group->object_owner_soft));
 }
 
 
@@ -688,7 +656,7 @@ dxf_group_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        group->object_owner_soft = strdup (object_owner_soft);
+        group->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -722,17 +690,10 @@ dxf_group_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (group->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->dictionary_owner_hard));
+        return (dxf_handle_to_string (group->dictionary_owner_hard));
 }
 
 
@@ -768,7 +729,7 @@ dxf_group_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        group->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        group->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1039,17 +1000,10 @@ dxf_group_get_handle_entity_in_group
                   __FUNCTION__);
                 return (NULL);
         }
-        if (group->handle_entity_in_group ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (group->handle_entity_in_group));
+        return (dxf_handle_to_string (group->handle_entity_in_group));
 }
 
 
@@ -1084,7 +1038,7 @@ dxf_group_set_handle_entity_in_group
                   __FUNCTION__);
                 return (NULL);
         }
-        group->handle_entity_in_group = strdup (handle_entity_in_group);
+        group->handle_entity_in_group = dxf_handle_parse (handle_entity_in_group);
 #if DEBUG
         DXF_DEBUG_END
 #endif
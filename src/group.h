@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -60,20 +61,20 @@ typedef struct
 dxf_group_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -96,7 +97,7 @@ dxf_group_struct
         char *description;
                 /*!< Group description.\n
                  * Group code = 300. */
-        char *handle_entity_in_group;
+        DxfHandle handle_entity_in_group;
                 /*!< Handle of entity in group (one entry per object).\n
                  * Group code = 340. */
         struct DxfGroup *next;
@@ -111,8 +112,8 @@ DxfGroup *dxf_group_read (DxfFile *fp, DxfGroup *group);
 int dxf_group_write (DxfFile *fp, DxfGroup *group);
 int dxf_group_free (DxfGroup *group);
 void dxf_group_free_list (DxfGroup *groups);
-int dxf_group_get_id_code (DxfGroup *group);
-DxfGroup *dxf_group_set_id_code (DxfGroup *group, int id_code);
+DxfHandle dxf_group_get_id_code (DxfGroup *group);
+DxfGroup *dxf_group_set_id_code (DxfGroup *group, DxfHandle id_code);
 char *dxf_group_get_dictionary_owner_soft (DxfGroup *group);
 DxfGroup *dxf_group_set_dictionary_owner_soft (DxfGroup *group, char *dictionary_owner_soft);
 char *dxf_group_get_object_owner_soft (DxfGroup *group);
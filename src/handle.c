@@ -0,0 +1,263 @@
+/*!
+ * \file handle.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for numeric DXF handles.
+ *
+ * Handles are hexadecimal strings in a DXF file, they are parsed once
+ * into a \c DxfHandle when read and formatted again only when written.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "handle.h"
+
+
+/*!
+ * \brief Parse a hexadecimal handle string.
+ *
+ * Parsing stops at the first character that is not a hexadecimal
+ * digit, at most 16 digits are used.
+ *
+ * \return the handle, or \c DXF_HANDLE_NONE for an empty string or a
+ * \c NULL pointer.
+ */
+DxfHandle
+dxf_handle_parse
+(
+        const char *string
+                /*!< a string containing a hexadecimal handle. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandle handle = DXF_HANDLE_NONE;
+        unsigned int c;
+        int i;
+
+        /* Do some basic checks. */
+        if (string == NULL)
+        {
+                return (DXF_HANDLE_NONE);
+        }
+        for (i = 0; i < 16; i++)
+        {
+                c = (unsigned char) string[i];
+                if ((c - '0') < 10)
+                {
+                        c -= '0';
+                }
+                else if (((c | 0x20) - 'a') < 6)
+                {
+                        c = (c | 0x20) - 'a' + 10;
+                }
+                else
+                {
+                        break;
+                }
+                handle = (handle << 4) | c;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (handle);
+}
+
+
+/*!
+ * \brief Format a handle as an upper case hexadecimal string without
+ * leading zeros.
+ *
+ * \return \c buffer, which should hold at least
+ * \c DXF_HANDLE_STRING_LENGTH characters, or \c NULL when an error
+ * occurred.
+ */
+char *
+dxf_handle_format
+(
+        DxfHandle handle,
+                /*!< the handle. */
+        char *buffer
+                /*!< a buffer receiving the formatted handle. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static const char digits[] = "0123456789ABCDEF";
+        char reversed[DXF_HANDLE_STRING_LENGTH];
+        int i = 0;
+        int j = 0;
+
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        do
+        {
+                reversed[i++] = digits[handle & 0x0f];
+                handle >>= 4;
+        }
+        while (handle != 0);
+        while (i > 0)
+        {
+                buffer[j++] = reversed[--i];
+        }
+        buffer[j] = '\0';
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Format a handle into a newly allocated string.
+ *
+ * \c DXF_HANDLE_NONE gives an empty string, the same as an unset
+ * handle string.
+ *
+ * \return a pointer to the string, to be freed by the caller, or
+ * \c NULL when an error occurred.
+ */
+char *
+dxf_handle_to_string
+(
+        DxfHandle handle
+                /*!< the handle. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char buffer[DXF_HANDLE_STRING_LENGTH];
+
+        if (handle == DXF_HANDLE_NONE)
+        {
+                return (strdup (""));
+        }
+        dxf_handle_format (handle, buffer);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (strdup (buffer));
+}
+
+
+/*!
+ * \brief Read a handle from a DXF file.
+ *
+ * Reads the value line following a group code of a handle.
+ *
+ * \return the handle, or \c DXF_HANDLE_NONE when an error occurred.
+ */
+DxfHandle
+dxf_handle_read
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char string[DXF_MAX_STRING_LENGTH];
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (DXF_HANDLE_NONE);
+        }
+        (fp->line_number)++;
+        if (fscanf (fp->fp, DXF_MAX_STRING_FORMAT, string) != 1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (DXF_HANDLE_NONE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_handle_parse (string));
+}
+
+
+/*!
+ * \brief Write a handle with its group code to a DXF file.
+ *
+ * The group code is right aligned in three characters, like the other
+ * group codes written by the library (e.g. "  5" for the handle of an
+ * entity).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< group code of the handle. */
+        DxfHandle handle
+                /*!< the handle. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char buffer[DXF_HANDLE_STRING_LENGTH];
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp->fp, "%3d\n%s\n", group_code,
+          dxf_handle_format (handle, buffer));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,68 @@
+/*!
+ * \file handle.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for numeric DXF handles.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HANDLE_H
+#define LIBDXF_SRC_HANDLE_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_HANDLE_STRING_LENGTH 17
+        /*!< \brief Size of a buffer large enough to hold a formatted
+         * handle (16 hexadecimal digits and the terminating \c NUL). */
+
+
+DxfHandle dxf_handle_parse (const char *string);
+char *dxf_handle_format (DxfHandle handle, char *buffer);
+char *dxf_handle_to_string (DxfHandle handle);
+DxfHandle dxf_handle_read (DxfFile *fp);
+int dxf_handle_write (DxfFile *fp, int group_code, DxfHandle handle);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HANDLE_H */
+
+
+/* EOF */
@@ -0,0 +1,669 @@
+/*!
+ * \file handle_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a handle index of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "handle_index.h"
+
+
+/*!
+ * \brief Slot where the search for \c handle starts.
+ *
+ * Fibonacci hashing, handles are mostly sequential numbers and the
+ * multiplication spreads them over the whole table.
+ */
+static size_t
+dxf_handle_index_slot
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfHandle handle
+                /*!< the handle. */
+)
+{
+        return ((size_t) ((handle * UINT64_C (0x9E3779B97F4A7C15)) >> 32) & (index->size - 1));
+}
+
+
+/*!
+ * \brief Store an entry in a table known to have room for it.
+ */
+static void
+dxf_handle_index_store
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfHandle handle,
+                /*!< the handle. */
+        int type,
+                /*!< type of the item. */
+        void *pointer
+                /*!< pointer to the item. */
+)
+{
+        size_t i;
+
+        i = dxf_handle_index_slot (index, handle);
+        while ((index->entries[i].handle != DXF_HANDLE_NONE)
+          && (index->entries[i].handle != handle))
+        {
+                i = (i + 1) & (index->size - 1);
+        }
+        if (index->entries[i].handle == DXF_HANDLE_NONE)
+        {
+                index->number_of_handles++;
+        }
+        index->entries[i].handle = handle;
+        index->entries[i].type = type;
+        index->entries[i].pointer = pointer;
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfHandleIndex.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfHandleIndex *
+dxf_handle_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleIndex *index = NULL;
+        size_t size;
+
+        size = sizeof (DxfHandleIndex);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((index = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHandleIndex struct.\n")),
+                  __FUNCTION__);
+                index = NULL;
+        }
+        else
+        {
+                memset (index, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfHandleIndex.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfHandleIndex *
+dxf_handle_index_init
+(
+        DxfHandleIndex *index
+                /*!< a pointer to a handle index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                index = dxf_handle_index_new ();
+        }
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        index->entries = NULL;
+        index->size = 0;
+        index->number_of_handles = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfHandleIndex.
+ *
+ * The indexed items are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_free
+(
+        DxfHandleIndex *index
+                /*!< a pointer to a handle index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (index->entries);
+        free (index);
+        index = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make sure a \c DxfHandleIndex can hold at least
+ * \c number_of_handles handles without growing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_reserve
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        size_t number_of_handles
+                /*!< the number of handles to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleIndexEntry *entries;
+        DxfHandleIndexEntry *old_entries;
+        size_t old_size;
+        size_t size;
+        size_t i;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Keep the table at most half full. */
+        size = 16;
+        while (size < (2 * number_of_handles))
+        {
+                size *= 2;
+        }
+        if (size <= index->size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        entries = calloc (size, sizeof (DxfHandleIndexEntry));
+        if (entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Rehash the existing entries into the new table. */
+        old_size = index->size;
+        old_entries = index->entries;
+        index->entries = entries;
+        index->size = size;
+        index->number_of_handles = 0;
+        for (i = 0; i < old_size; i++)
+        {
+                if (old_entries[i].handle != DXF_HANDLE_NONE)
+                {
+                        dxf_handle_index_store (index, old_entries[i].handle,
+                          old_entries[i].type, old_entries[i].pointer);
+                }
+        }
+        free (old_entries);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an item to a \c DxfHandleIndex.
+ *
+ * When \c handle is already in the index its entry is replaced.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfHandle handle,
+                /*!< the handle of the item. */
+        int type,
+                /*!< a \c DxfEntityType or a \c DxfHandleIndexType. */
+        void *pointer
+                /*!< pointer to the item. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (pointer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (handle == DXF_HANDLE_NONE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_handle_index_reserve (index, index->number_of_handles + 1) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_handle_index_store (index, handle, type, pointer);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove an item from a \c DxfHandleIndex.
+ *
+ * The entries following the removed one in its probe sequence are
+ * shifted back, so the table never holds deleted markers.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * handle was not found or an error occurred.
+ */
+int
+dxf_handle_index_remove
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfHandle handle
+                /*!< the handle of the item. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t mask;
+        size_t i;
+        size_t j;
+        size_t k;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((index->size == 0)
+          || (handle == DXF_HANDLE_NONE))
+        {
+                return (EXIT_FAILURE);
+        }
+        mask = index->size - 1;
+        i = dxf_handle_index_slot (index, handle);
+        while (index->entries[i].handle != handle)
+        {
+                if (index->entries[i].handle == DXF_HANDLE_NONE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                i = (i + 1) & mask;
+        }
+        /* Backward shift deletion. */
+        j = i;
+        for (;;)
+        {
+                j = (j + 1) & mask;
+                if (index->entries[j].handle == DXF_HANDLE_NONE)
+                {
+                        break;
+                }
+                k = dxf_handle_index_slot (index, index->entries[j].handle);
+                /* Move entry j into the hole at i unless its home
+                 * slot k lies cyclically in (i, j]. */
+                if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j)))
+                {
+                        continue;
+                }
+                index->entries[i] = index->entries[j];
+                i = j;
+        }
+        index->entries[i].handle = DXF_HANDLE_NONE;
+        index->entries[i].type = 0;
+        index->entries[i].pointer = NULL;
+        index->number_of_handles--;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find an item in a \c DxfHandleIndex.
+ *
+ * \return a pointer to the item, or \c NULL when the handle was not
+ * found or an error occurred.
+ */
+void *
+dxf_handle_index_find
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfHandle handle,
+                /*!< the handle of the item. */
+        int *type
+                /*!< receives the type of the item, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index->size == 0)
+          || (handle == DXF_HANDLE_NONE))
+        {
+                return (NULL);
+        }
+        i = dxf_handle_index_slot (index, handle);
+        while (index->entries[i].handle != DXF_HANDLE_NONE)
+        {
+                if (index->entries[i].handle == handle)
+                {
+                        if (type != NULL)
+                        {
+                                *type = index->entries[i].type;
+                        }
+                        return (index->entries[i].pointer);
+                }
+                i = (i + 1) & (index->size - 1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (NULL);
+}
+
+
+/*!
+ * \brief Get the number of handles in a \c DxfHandleIndex.
+ *
+ * \return the number of handles, 0 when an error occurred.
+ */
+size_t
+dxf_handle_index_get_number_of_handles
+(
+        DxfHandleIndex *index
+                /*!< a pointer to a handle index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->number_of_handles);
+}
+
+
+/*!
+ * \brief Add all entities of an \c ENTITIES section to a
+ * \c DxfHandleIndex.
+ *
+ * Entities without an id-code are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add_entities
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntityType type;
+        void *entity;
+        int number_of_entities;
+        DxfHandle id_code;
+        int i;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        if (dxf_handle_index_reserve (index, index->number_of_handles + (size_t) number_of_entities) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i, &type);
+                id_code = dxf_entities_get_id_code (type, entity);
+                if (id_code != DXF_HANDLE_NONE)
+                {
+                        dxf_handle_index_store (index, id_code, type, entity);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add one list of table entries to a \c DxfHandleIndex.
+ */
+#define DXF_HANDLE_INDEX_ADD_LIST(index, list, entry_type, index_type) \
+        { \
+                entry_type *iter; \
+                for (iter = (list); iter != NULL; iter = (entry_type *) iter->next) \
+                { \
+                        if (iter->id_code != DXF_HANDLE_NONE) \
+                        { \
+                                dxf_handle_index_add (index, iter->id_code, index_type, iter); \
+                        } \
+                } \
+        }
+
+
+/*!
+ * \brief Add all table entries of a \c TABLES section to a
+ * \c DxfHandleIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add_tables
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfTables *tables
+                /*!< DXF tables section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (tables == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->appids, DxfAppid, DXF_HANDLE_INDEX_APPID);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->block_records, DxfBlockRecord, DXF_HANDLE_INDEX_BLOCK_RECORD);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->dimstyles, DxfDimStyle, DXF_HANDLE_INDEX_DIMSTYLE);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->layers, DxfLayer, DXF_HANDLE_INDEX_LAYER);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->ltypes, DxfLType, DXF_HANDLE_INDEX_LTYPE);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->styles, DxfStyle, DXF_HANDLE_INDEX_STYLE);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->ucss, DxfUcs, DXF_HANDLE_INDEX_UCS);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->views, DxfView, DXF_HANDLE_INDEX_VIEW);
+        DXF_HANDLE_INDEX_ADD_LIST (index, tables->vports, DxfVPort, DXF_HANDLE_INDEX_VPORT);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the tables, blocks and entities of a DXF drawing to a
+ * \c DxfHandleIndex.
+ *
+ * Build the index once after loading the drawing, then keep it up to
+ * date with dxf_handle_index_add () and dxf_handle_index_remove ()
+ * while items are added to or removed from the drawing.\n
+ * Objects are not kept in typed lists in a \c DxfDrawing, add them
+ * with dxf_handle_index_add () when they are read.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_index_add_drawing
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to a handle index. */
+        DxfDrawing *drawing
+                /*!< a pointer to a DXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (drawing == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->tables_list != NULL)
+        {
+                if (dxf_handle_index_add_tables (index, (DxfTables *) drawing->tables_list) == EXIT_FAILURE)
+                {
+                        status = EXIT_FAILURE;
+                }
+        }
+        DXF_HANDLE_INDEX_ADD_LIST (index, (DxfBlock *) drawing->block_list, DxfBlock, DXF_HANDLE_INDEX_BLOCK);
+        if (drawing->entities_list != NULL)
+        {
+                if (dxf_handle_index_add_entities (index, (DxfEntities *) drawing->entities_list) == EXIT_FAILURE)
+                {
+                        status = EXIT_FAILURE;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,137 @@
+/*!
+ * \file handle_index.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a handle index of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HANDLE_INDEX_H
+#define LIBDXF_SRC_HANDLE_INDEX_H
+
+
+#include "global.h"
+#include "handle.h"
+#include "drawing.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Types of the non-entity items in a handle index.
+ *
+ * Entities are indexed with their \c DxfEntityType, the values below
+ * follow the entity types so a single \c int tells them apart.
+ */
+typedef enum
+dxf_handle_index_type
+{
+        DXF_HANDLE_INDEX_APPID = DXF_NUMBER_OF_ENTITY_TYPES,
+        DXF_HANDLE_INDEX_BLOCK_RECORD,
+        DXF_HANDLE_INDEX_DIMSTYLE,
+        DXF_HANDLE_INDEX_LAYER,
+        DXF_HANDLE_INDEX_LTYPE,
+        DXF_HANDLE_INDEX_STYLE,
+        DXF_HANDLE_INDEX_UCS,
+        DXF_HANDLE_INDEX_VIEW,
+        DXF_HANDLE_INDEX_VPORT,
+        DXF_HANDLE_INDEX_BLOCK,
+        DXF_HANDLE_INDEX_DICTIONARY,
+        DXF_HANDLE_INDEX_GROUP,
+        DXF_HANDLE_INDEX_IDBUFFER,
+        DXF_HANDLE_INDEX_IMAGEDEF,
+        DXF_HANDLE_INDEX_MLINESTYLE,
+        DXF_HANDLE_INDEX_XRECORD,
+        DXF_HANDLE_INDEX_OBJECT
+                /*!< Any other object. */
+} DxfHandleIndexType;
+
+
+/*!
+ * \brief Slot of a handle index.
+ */
+typedef struct
+dxf_handle_index_entry_struct
+{
+        DxfHandle handle;
+                /*!< Handle of the item, \c DXF_HANDLE_NONE for an
+                 * empty slot. */
+        int type;
+                /*!< A \c DxfEntityType or a \c DxfHandleIndexType. */
+        void *pointer;
+                /*!< Pointer to the item. */
+} DxfHandleIndexEntry;
+
+
+/*!
+ * \brief Hash index from handle to item of a DXF drawing.
+ *
+ * Open addressing with linear probing in a power of two sized table,
+ * kept at most half full, so a lookup touches one or two slots on
+ * average.\n
+ * The index does not own the items it points to.
+ */
+typedef struct
+dxf_handle_index_struct
+{
+        DxfHandleIndexEntry *entries;
+                /*!< Contiguous array of \c size slots. */
+        size_t size;
+                /*!< Number of slots, a power of two or 0. */
+        size_t number_of_handles;
+                /*!< Number of slots in use. */
+} DxfHandleIndex;
+
+
+DxfHandleIndex *dxf_handle_index_new ();
+DxfHandleIndex *dxf_handle_index_init (DxfHandleIndex *index);
+int dxf_handle_index_free (DxfHandleIndex *index);
+int dxf_handle_index_reserve (DxfHandleIndex *index, size_t number_of_handles);
+int dxf_handle_index_add (DxfHandleIndex *index, DxfHandle handle, int type, void *pointer);
+int dxf_handle_index_remove (DxfHandleIndex *index, DxfHandle handle);
+void *dxf_handle_index_find (DxfHandleIndex *index, DxfHandle handle, int *type);
+size_t dxf_handle_index_get_number_of_handles (DxfHandleIndex *index);
+int dxf_handle_index_add_entities (DxfHandleIndex *index, DxfEntities *entities);
+int dxf_handle_index_add_tables (DxfHandleIndex *index, DxfTables *tables);
+int dxf_handle_index_add_drawing (DxfHandleIndex *index, DxfDrawing *drawing);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HANDLE_INDEX_H */
+
+
+/* EOF */
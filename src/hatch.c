@@ -40,6 +40,7 @@
 
 
 #include "hatch.h"
+#include "entities.h"
 
 
 /* dxf_hatch functions. */
@@ -112,26 +113,13 @@ dxf_hatch_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        hatch->id_code = 0;
-        hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        hatch->layer = strdup (DXF_DEFAULT_LAYER);
-        hatch->elevation = 0.0;
-        hatch->thickness = 0.0;
-        hatch->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        hatch->visibility = DXF_DEFAULT_VISIBILITY;
-        hatch->color = DXF_COLOR_BYLAYER;
-        hatch->paperspace = DXF_MODELSPACE;
-        hatch->graphics_data_size = 0;
-        hatch->shadow_mode = 0;
-        hatch->dictionary_owner_soft = strdup ("");
-        hatch->object_owner_soft = strdup ("");
-        hatch->material = strdup ("");
-        hatch->dictionary_owner_hard = strdup ("");
-        hatch->lineweight = 0;
-        hatch->plot_style_name = strdup ("");
-        hatch->color_value = 0;
-        hatch->color_name = strdup ("");
-        hatch->transparency = 0;
+        if (dxf_entity_common_init (&hatch->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         hatch->pattern_name = strdup ("");
         hatch->p0 = dxf_point_new ();
         hatch->p0 = dxf_point_init (hatch->p0);
@@ -154,8 +142,8 @@ dxf_hatch_init
         hatch->extr_z0 = 0.0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        hatch->binary_graphics_data = NULL;
         hatch->paths = NULL;
+        hatch->last_path = NULL;
         hatch->patterns = NULL;
         hatch->def_lines = NULL;
         hatch->seed_points = NULL;
@@ -168,23 +156,65 @@ dxf_hatch_init
 
 
 /*!
- * \brief Write DXF output to a file for a hatch entity (\c HATCH).
+ * \brief Read data from a DXF file into a DXF \c HATCH entity.
+ *
+ * The last line read from file contained the string "HATCH". \n
+ * Now follows some data for the \c HATCH, to be terminated with a "  0"
+ * string announcing the following entity, or the end of the \c ENTITY
+ * section marker \c ENDSEC. \n
+ * While parsing the DXF file store data in \c hatch. \n
+ * Boundary paths, pattern definition lines and seed points are read
+ * into their linked lists, gradient fill data and the handles of
+ * source boundary objects are skipped. \n
+ * When single precision was requested with
+ * dxf_read_set_single_precision () the vertices of the polyline
+ * boundary paths are stored in single precision.
+ *
+ * \return a pointer to \c hatch.
  */
-int
-dxf_hatch_write
+DxfHatch *
+dxf_hatch_read
 (
         DxfFile *fp,
-                /*!< file pointer to output file (or device). */
+                /*!< DXF file pointer to an input file (or device). */
         DxfHatch *hatch
-                /*!< DXF hatch entity. */
+                /*!< a pointer to the DXF \c HATCH entity. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HATCH");
-        DxfHatchPatternDefLine *line = NULL;
-        DxfHatchPatternSeedPoint *point = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPath *new_path;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *new_vertex;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeLine *new_line;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeArc *new_arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *new_ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSpline *new_spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *new_control_point;
+        DxfHatchPatternDefLine *def_line = NULL;
+        DxfHatchPatternDefLine *new_def_line;
+        DxfHatchPatternDefLineDash *dash = NULL;
+        DxfHatchPatternDefLineDash *new_dash;
+        DxfHatchPatternSeedPoint *seed_point = NULL;
+        DxfHatchPatternSeedPoint *new_seed_point;
+        /* 0 = header, 1 = boundary paths, 2 = pattern data,
+         * 3 = seed points. */
+        int section = 0;
+        int edge_type = 0;
+        int knot = 0;
+        int source_objects = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -192,298 +222,2036 @@ dxf_hatch_write
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
-                return (EXIT_FAILURE);
-        }
-        if (fp->acad_version_number < AutoCAD_14)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this entity.\n")),
-                  __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
         if (hatch == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
-                return (EXIT_FAILURE);
-        }
-        if (hatch->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
-                return (EXIT_FAILURE);
-        }
-        if (strcmp (hatch->layer, "") == 0)
-        {
-                fprintf (stderr,
-                  (_("Warning: empty layer string for the %s entity with id-code: %x\n")),
-                        dxf_entity_name, hatch->id_code);
-                fprintf (stderr,
-                  (_("    %s entity is relocated to layer 0")),
-                        dxf_entity_name);
-                hatch->layer = strdup (DXF_DEFAULT_LAYER);
-        }
-        if (strcmp (hatch->linetype, "") == 0)
-        {
-                fprintf (stderr,
-                  (_("Warning: empty linetype string for the %s entity with id-code: %x\n")),
-                        dxf_entity_name, hatch->id_code);
-                fprintf (stderr,
-                  (_("    %s entity is reset to default linetype")),
-                        dxf_entity_name);
-                hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        }
-        /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (hatch->id_code != -1)
-        {
-                fprintf (fp->fp, "  5\n%x\n", hatch->id_code);
-        }
-        /*!
-         * \todo for version R14.\n
-         * Implementing the start of application-defined group
-         * "{application_name", with Group code 102.\n
-         * For example: "{ACAD_REACTORS" indicates the start of the
-         * AutoCAD persistent reactors group.\n\n
-         * application-defined codes: Group codes and values within the
-         * 102 groups are application defined (optional).\n\n
-         * End of group, "}" (optional), with Group code 102.
-         */
-        if ((strcmp (hatch->dictionary_owner_soft, "") != 0)
-          && (fp->acad_version_number >= AutoCAD_14))
-        {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", hatch->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
-        }
-        if ((strcmp (hatch->dictionary_owner_hard, "") != 0)
-          && (fp->acad_version_number >= AutoCAD_14))
-        {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", hatch->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
-        }
-        if ((strcmp (hatch->object_owner_soft, "") != 0)
-          && (fp->acad_version_number >= AutoCAD_2000))
-        {
-                fprintf (fp->fp, "330\n%s\n", hatch->object_owner_soft);
-        }
-        if (fp->acad_version_number >= AutoCAD_13)
-        {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
-        }
-        if (hatch->paperspace == DXF_PAPERSPACE)
-        {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
-        }
-        fprintf (fp->fp, "  8\n%s\n", hatch->layer);
-        if (strcmp (hatch->linetype, DXF_DEFAULT_LINETYPE) != 0)
-        {
-                fprintf (fp->fp, "  6\n%s\n", hatch->linetype);
-        }
-        if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (hatch->material, "") != 0))
-        {
-                fprintf (fp->fp, "347\n%s\n", hatch->material);
-        }
-        if (hatch->color != DXF_COLOR_BYLAYER)
-        {
-                fprintf (fp->fp, " 62\n%hd\n", hatch->color);
-        }
-        if (fp->acad_version_number >= AutoCAD_2002)
-        {
-                fprintf (fp->fp, "370\n%d\n", hatch->lineweight);
-        }
-        if ((fp->acad_version_number <= AutoCAD_11)
-          && DXF_FLATLAND
-          && (hatch->elevation != 0.0))
-        {
-                fprintf (fp->fp, " 38\n%f\n", hatch->elevation);
-        }
-        if (hatch->thickness != 0.0)
-        {
-                fprintf (fp->fp, " 39\n%f\n", hatch->thickness);
-        }
-        if (hatch->linetype_scale != 1.0)
-        {
-                fprintf (fp->fp, " 48\n%f\n", hatch->linetype_scale);
+                hatch = dxf_hatch_init (dxf_hatch_new ());
+                if (hatch == NULL)
+                {
+                        return (NULL);
+                }
         }
-        if (hatch->visibility != 0)
+        for (;;)
         {
-                fprintf (fp->fp, " 60\n%hd\n", hatch->visibility);
-        }
-        if (fp->acad_version_number >= AutoCAD_2000)
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
+                {
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
+                }
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 2:
+                                /* Hatch pattern name. */
+                                free (hatch->pattern_name);
+                                hatch->pattern_name = strdup (value);
+                                break;
+                        case 10:
+                                /* X-value of the elevation point, a
+                                 * polyline vertex, an edge, a spline
+                                 * control point or a seed point. */
+                                if (section == 0)
+                                {
+                                        hatch->p0->x0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (polyline != NULL))
+                                {
+                                        new_vertex = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+                                        if (new_vertex == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        dxf_hatch_boundary_path_polyline_append_vertex (polyline, new_vertex);
+                                        vertex = new_vertex;
+                                        vertex->x0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 1))
+                                {
+                                        line->x0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 2))
+                                {
+                                        arc->x0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 3))
+                                {
+                                        ellipse->x0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 4))
+                                {
+                                        new_control_point = dxf_hatch_boundary_path_edge_spline_control_point_init (dxf_hatch_boundary_path_edge_spline_control_point_new ());
+                                        if (new_control_point == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        if (control_point == NULL)
+                                        {
+                                                spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) new_control_point;
+                                        }
+                                        else
+                                        {
+                                                control_point->next = (struct DxfHatchBoundaryPathEdgeSplineCp *) new_control_point;
+                                        }
+                                        control_point = new_control_point;
+                                        spline->last_control_point = (struct DxfHatchBoundaryPathEdgeSplineCp *) control_point;
+                                        control_point->x0 = atof (value);
+                                }
+                                else if (section == 3)
+                                {
+                                        new_seed_point = dxf_hatch_pattern_seedpoint_init (dxf_hatch_pattern_seedpoint_new ());
+                                        if (new_seed_point == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        if (seed_point == NULL)
+                                        {
+                                                hatch->seed_points = (struct DxfHatchPatternSeedPoint *) new_seed_point;
+                                        }
+                                        else
+                                        {
+                                                seed_point->next = (struct DxfHatchPatternSeedPoint *) new_seed_point;
+                                        }
+                                        seed_point = new_seed_point;
+                                        seed_point->x0 = atof (value);
+                                }
+                                break;
+                        case 20:
+                                /* Y-value of the point started with
+                                 * group code 10. */
+                                if (section == 0)
+                                {
+                                        hatch->p0->y0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (polyline != NULL))
+                                {
+                                        if (vertex != NULL)
+                                        {
+                                                vertex->y0 = atof (value);
+                                        }
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 1))
+                                {
+                                        line->y0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 2))
+                                {
+                                        arc->y0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 3))
+                                {
+                                        ellipse->y0 = atof (value);
+                                }
+                                else if ((section == 1)
+                                  && (edge_type == 4))
+                                {
+                                        if (control_point != NULL)
+                                        {
+                                                control_point->y0 = atof (value);
+                                        }
+                                }
+                                else if (section == 3)
+                                {
+                                        if (seed_point != NULL)
+                                        {
+                                                seed_point->y0 = atof (value);
+                                        }
+                                }
+                                break;
+                        case 30:
+                                /* Z-value of the elevation point. */
+                                hatch->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                /* X-value of the end point of a line
+                                 * edge or of the end point of the major
+                                 * axis of an ellipse edge. */
+                                if (edge_type == 1)
+                                {
+                                        line->x1 = atof (value);
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        ellipse->x1 = atof (value);
+                                }
+                                break;
+                        case 21:
+                                /* Y-value of the end point of a line
+                                 * edge or of the end point of the major
+                                 * axis of an ellipse edge. */
+                                if (edge_type == 1)
+                                {
+                                        line->y1 = atof (value);
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        ellipse->y1 = atof (value);
+                                }
+                                break;
+                        case 40:
+                                /* Radius of an arc edge, ratio of an
+                                 * ellipse edge or knot of a spline
+                                 * edge. */
+                                if (edge_type == 2)
+                                {
+                                        arc->radius = atof (value);
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        ellipse->ratio = atof (value);
+                                }
+                                else if ((edge_type == 4)
+                                  && (knot < DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS))
+                                {
+                                        spline->knots[knot] = atof (value);
+                                        knot++;
+                                }
+                                break;
+                        case 41:
+                                /* Hatch pattern scale or spacing. */
+                                hatch->pattern_scale = atof (value);
+                                break;
+                        case 42:
+                                /* Bulge of a polyline vertex or weight
+                                 * of a spline control point. */
+                                if ((polyline != NULL)
+                                  && (vertex != NULL))
+                                {
+                                        vertex->bulge = atof (value);
+                                        vertex->has_bulge = 1;
+                                }
+                                else if ((edge_type == 4)
+                                  && (control_point != NULL))
+                                {
+                                        control_point->weight = atof (value);
+                                }
+                                break;
+                        case 43:
+                                /* X-value of the base point of a
+                                 * pattern definition line. */
+                                if (def_line != NULL)
+                                {
+                                        def_line->x0 = atof (value);
+                                }
+                                break;
+                        case 44:
+                                /* Y-value of the base point of a
+                                 * pattern definition line. */
+                                if (def_line != NULL)
+                                {
+                                        def_line->y0 = atof (value);
+                                }
+                                break;
+                        case 45:
+                                /* X-value of the offset of a pattern
+                                 * definition line. */
+                                if (def_line != NULL)
+                                {
+                                        def_line->x1 = atof (value);
+                                }
+                                break;
+                        case 46:
+                                /* Y-value of the offset of a pattern
+                                 * definition line. */
+                                if (def_line != NULL)
+                                {
+                                        def_line->y1 = atof (value);
+                                }
+                                break;
+                        case 47:
+                                /* Pixel size. */
+                                hatch->pixel_size = atof (value);
+                                break;
+                        case 49:
+                                /* Dash length of a pattern definition
+                                 * line. */
+                                if (def_line == NULL)
+                                {
+                                        break;
+                                }
+                                new_dash = dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+                                if (new_dash == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (dash == NULL)
+                                {
+                                        def_line->dashes = (struct DxfHatchPatternDefLineDash *) new_dash;
+                                }
+                                else
+                                {
+                                        dash->next = (struct DxfHatchPatternDefLineDash *) new_dash;
+                                }
+                                dash = new_dash;
+                                dash->length = atof (value);
+                                break;
+                        case 50:
+                                /* Start angle of an arc or ellipse
+                                 * edge. */
+                                if (edge_type == 2)
+                                {
+                                        arc->start_angle = atof (value);
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        ellipse->start_angle = atof (value);
+                                }
+                                break;
+                        case 51:
+                                /* End angle of an arc or ellipse
+                                 * edge. */
+                                if (edge_type == 2)
+                                {
+                                        arc->end_angle = atof (value);
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        ellipse->end_angle = atof (value);
+                                }
+                                break;
+                        case 52:
+                                /* Hatch pattern angle. */
+                                hatch->pattern_angle = atof (value);
+                                break;
+                        case 53:
+                                /* Angle of a pattern definition line,
+                                 * this starts a new definition line. */
+                                new_def_line = dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+                                if (new_def_line == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (def_line == NULL)
+                                {
+                                        hatch->def_lines = (struct DxfHatchPatternDefLine *) new_def_line;
+                                }
+                                else
+                                {
+                                        def_line->next = (struct DxfHatchPatternDefLine *) new_def_line;
+                                }
+                                def_line = new_def_line;
+                                dash = NULL;
+                                def_line->angle = atof (value);
+                                break;
+                        case 70:
+                                /* Solid fill flag. */
+                                hatch->solid_fill = (int16_t) atoi (value);
+                                break;
+                        case 71:
+                                /* Associativity flag. */
+                                hatch->associative = (int16_t) atoi (value);
+                                break;
+                        case 72:
+                                /* "Has bulge" flag of a polyline path,
+                                 * the bulges are stored per vertex, or
+                                 * the type of the next edge of an edge
+                                 * path:
+                                 * 1 = line, 2 = arc, 3 = ellipse,
+                                 * 4 = spline. */
+                                if ((path == NULL)
+                                  || (polyline != NULL))
+                                {
+                                        break;
+                                }
+                                if (path->edges == NULL)
+                                {
+                                        edge = dxf_hatch_boundary_path_edge_init (dxf_hatch_boundary_path_edge_new ());
+                                        if (edge == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        dxf_hatch_boundary_path_append_edge (path, edge);
+                                }
+                                edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                                edge_type = atoi (value);
+                                if (edge_type == 1)
+                                {
+                                        new_line = dxf_hatch_boundary_path_edge_line_init (dxf_hatch_boundary_path_edge_line_new ());
+                                        if (new_line == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        dxf_hatch_boundary_path_edge_append_line (edge, new_line);
+                                        line = new_line;
+                                }
+                                else if (edge_type == 2)
+                                {
+                                        new_arc = dxf_hatch_boundary_path_edge_arc_init (dxf_hatch_boundary_path_edge_arc_new ());
+                                        if (new_arc == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        dxf_hatch_boundary_path_edge_append_arc (edge, new_arc);
+                                        arc = new_arc;
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        new_ellipse = dxf_hatch_boundary_path_edge_ellipse_init (dxf_hatch_boundary_path_edge_ellipse_new ());
+                                        if (new_ellipse == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        dxf_hatch_boundary_path_edge_append_ellipse (edge, new_ellipse);
+                                        ellipse = new_ellipse;
+                                }
+                                else if (edge_type == 4)
+                                {
+                                        new_spline = dxf_hatch_boundary_path_edge_spline_init (dxf_hatch_boundary_path_edge_spline_new ());
+                                        if (new_spline == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        dxf_hatch_boundary_path_edge_append_spline (edge, new_spline);
+                                        spline = new_spline;
+                                        control_point = NULL;
+                                        knot = 0;
+                                }
+                                else
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown edge type found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                        edge_type = 0;
+                                }
+                                break;
+                        case 73:
+                                /* Closed flag of a polyline path,
+                                 * counterclockwise flag of an arc or
+                                 * ellipse edge or rational flag of a
+                                 * spline edge. */
+                                if (polyline != NULL)
+                                {
+                                        polyline->is_closed = (int16_t) atoi (value);
+                                }
+                                else if (edge_type == 2)
+                                {
+                                        arc->is_ccw = (int16_t) atoi (value);
+                                }
+                                else if (edge_type == 3)
+                                {
+                                        ellipse->is_ccw = (int16_t) atoi (value);
+                                }
+                                else if (edge_type == 4)
+                                {
+                                        spline->rational = (int16_t) atoi (value);
+                                }
+                                break;
+                        case 74:
+                                /* Periodic flag of a spline edge. */
+                                if (edge_type == 4)
+                                {
+                                        spline->periodic = (int16_t) atoi (value);
+                                }
+                                break;
+                        case 75:
+                                /* Hatch style, this ends the boundary
+                                 * paths. */
+                                hatch->hatch_style = (int16_t) atoi (value);
+                                section = 2;
+                                polyline = NULL;
+                                edge_type = 0;
+                                break;
+                        case 76:
+                                /* Hatch pattern type. */
+                                hatch->hatch_pattern_type = (int16_t) atoi (value);
+                                break;
+                        case 77:
+                                /* Hatch pattern double flag. */
+                                hatch->pattern_double = (int16_t) atoi (value);
+                                break;
+                        case 78:
+                                /* Number of pattern definition
+                                 * lines. */
+                                hatch->number_of_pattern_def_lines = (int16_t) atoi (value);
+                                break;
+                        case 79:
+                                /* Number of dash length items of a
+                                 * pattern definition line. */
+                                if (def_line != NULL)
+                                {
+                                        def_line->number_of_dash_items = (int16_t) atoi (value);
+                                }
+                                break;
+                        case 91:
+                                /* Number of boundary paths, these
+                                 * follow now. */
+                                hatch->number_of_boundary_paths = atoi (value);
+                                section = 1;
+                                break;
+                        case 92:
+                                if (section != 1)
+                                {
+                                        /* Graphics data size of the
+                                         * entity. */
+                                        dxf_entity_common_read_pair (fp, &hatch->common, group_code, value);
+                                        break;
+                                }
+                                /* Boundary path type flag, this starts
+                                 * a new boundary path. */
+                                new_path = dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                                if (new_path == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                dxf_hatch_append_boundary_path (hatch, new_path);
+                                path = new_path;
+                                polyline = NULL;
+                                vertex = NULL;
+                                line = NULL;
+                                arc = NULL;
+                                ellipse = NULL;
+                                spline = NULL;
+                                edge_type = 0;
+                                if (atoi (value) & 2)
+                                {
+                                        polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+                                        if (polyline == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+                                }
+                                break;
+                        case 93:
+                                /* Number of polyline vertices or
+                                 * number of edges of the path. */
+                                if (polyline != NULL)
+                                {
+                                        polyline->number_of_vertices = atoi (value);
+                                }
+                                break;
+                        case 94:
+                                /* Degree of a spline edge. */
+                                if (edge_type == 4)
+                                {
+                                        spline->degree = atoi (value);
+                                }
+                                break;
+                        case 95:
+                                /* Number of knots of a spline edge. */
+                                if (edge_type == 4)
+                                {
+                                        spline->number_of_knots = atoi (value);
+                                }
+                                break;
+                        case 96:
+                                /* Number of control points of a spline
+                                 * edge. */
+                                if (edge_type == 4)
+                                {
+                                        spline->number_of_control_points = atoi (value);
+                                }
+                                break;
+                        case 97:
+                                /* Number of source boundary objects,
+                                 * their handles follow with group
+                                 * code 330. */
+                                source_objects = atoi (value);
+                                break;
+                        case 98:
+                                /* Number of seed points, these follow
+                                 * now. */
+                                hatch->number_of_seed_points = atoi (value);
+                                section = 3;
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbHatch") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                /* X-value of the extrusion vector. */
+                                hatch->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                /* Y-value of the extrusion vector. */
+                                hatch->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                /* Z-value of the extrusion vector. */
+                                hatch->extr_z0 = atof (value);
+                                break;
+                        case 330:
+                                if (source_objects > 0)
+                                {
+                                        /* Handle of a source boundary
+                                         * object, not stored. */
+                                        source_objects--;
+                                }
+                                else
+                                {
+                                        dxf_entity_common_read_pair (fp, &hatch->common, group_code, value);
+                                }
+                                break;
+                        case 63:
+                        case 421:
+                        case 450:
+                        case 451:
+                        case 452:
+                        case 453:
+                        case 460:
+                        case 461:
+                        case 462:
+                        case 463:
+                        case 470:
+                                /* Gradient fill data, not stored. */
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &hatch->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                }
+        }
+        /* Handle omitted members and/or illegal values. */
+        if ((hatch->common.linetype == NULL)
+          || (strcmp (hatch->common.linetype, "") == 0))
+        {
+                free (hatch->common.linetype);
+                hatch->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
+        }
+        if ((hatch->common.layer == NULL)
+          || (strcmp (hatch->common.layer, "") == 0))
+        {
+                free (hatch->common.layer);
+                hatch->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
+        if (fp->single_precision)
+        {
+                dxf_hatch_set_single_precision (hatch, fp->origin_x, fp->origin_y);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hatch);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a hatch entity (\c HATCH).
+ */
+int
+dxf_hatch_write
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfHatch *hatch
+                /*!< DXF hatch entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *dxf_entity_name = strdup ("HATCH");
+        DxfHatchPatternDefLine *line = NULL;
+        DxfHatchPatternSeedPoint *point = NULL;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        if (fp->acad_version_number < AutoCAD_14)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () illegal DXF version for this entity.\n")),
+                  __FUNCTION__);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        if (hatch->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        if (strcmp (hatch->common.layer, "") == 0)
+        {
+                fprintf (stderr,
+                  (_("Warning: empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                        dxf_entity_name, hatch->common.id_code);
+                fprintf (stderr,
+                  (_("    %s entity is relocated to layer 0")),
+                        dxf_entity_name);
+                hatch->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
+        if (strcmp (hatch->common.linetype, "") == 0)
+        {
+                fprintf (stderr,
+                  (_("Warning: empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                        dxf_entity_name, hatch->common.id_code);
+                fprintf (stderr,
+                  (_("    %s entity is reset to default linetype")),
+                        dxf_entity_name);
+                hatch->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
+        }
+        /* Start writing output. */
+        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
+        if (hatch->common.id_code != DXF_HANDLE_NONE)
+        {
+                dxf_handle_write (fp, 5, hatch->common.id_code);
+        }
+        /*!
+         * \todo for version R14.\n
+         * Implementing the start of application-defined group
+         * "{application_name", with Group code 102.\n
+         * For example: "{ACAD_REACTORS" indicates the start of the
+         * AutoCAD persistent reactors group.\n\n
+         * application-defined codes: Group codes and values within the
+         * 102 groups are application defined (optional).\n\n
+         * End of group, "}" (optional), with Group code 102.
+         */
+        if ((hatch->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
+          && (fp->acad_version_number >= AutoCAD_14))
+        {
+                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
+                dxf_handle_write (fp, 330, hatch->common.cold->dictionary_owner_soft);
+                fprintf (fp->fp, "102\n}\n");
+        }
+        if ((hatch->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
+          && (fp->acad_version_number >= AutoCAD_14))
+        {
+                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
+                dxf_handle_write (fp, 360, hatch->common.cold->dictionary_owner_hard);
+                fprintf (fp->fp, "102\n}\n");
+        }
+        if ((hatch->common.cold->object_owner_soft != DXF_HANDLE_NONE)
+          && (fp->acad_version_number >= AutoCAD_2000))
+        {
+                dxf_handle_write (fp, 330, hatch->common.cold->object_owner_soft);
+        }
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                fprintf (fp->fp, "100\nAcDbEntity\n");
+        }
+        if (hatch->common.paperspace == DXF_PAPERSPACE)
+        {
+                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
+        }
+        fprintf (fp->fp, "  8\n%s\n", hatch->common.layer);
+        if (strcmp (hatch->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
+        {
+                fprintf (fp->fp, "  6\n%s\n", hatch->common.linetype);
+        }
+        if ((fp->acad_version_number >= AutoCAD_2008)
+          && (hatch->common.cold->material != DXF_HANDLE_NONE))
+        {
+                dxf_handle_write (fp, 347, hatch->common.cold->material);
+        }
+        if (hatch->common.color != DXF_COLOR_BYLAYER)
+        {
+                fprintf (fp->fp, " 62\n%hd\n", hatch->common.color);
+        }
+        if (fp->acad_version_number >= AutoCAD_2002)
+        {
+                fprintf (fp->fp, "370\n%hd\n", hatch->common.lineweight);
+        }
+        if ((fp->acad_version_number <= AutoCAD_11)
+          && DXF_FLATLAND
+          && (hatch->common.elevation != 0.0))
+        {
+                fprintf (fp->fp, " 38\n%f\n", hatch->common.elevation);
+        }
+        if (hatch->common.thickness != 0.0)
+        {
+                fprintf (fp->fp, " 39\n%f\n", hatch->common.thickness);
+        }
+        if (hatch->common.linetype_scale != 1.0)
+        {
+                fprintf (fp->fp, " 48\n%f\n", hatch->common.linetype_scale);
+        }
+        if (hatch->common.visibility != 0)
+        {
+                fprintf (fp->fp, " 60\n%hd\n", hatch->common.visibility);
+        }
+        if (fp->acad_version_number >= AutoCAD_2000)
+        {
+#ifdef BUILD_64
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", hatch->common.cold->graphics_data_size);
+#else
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", hatch->common.cold->graphics_data_size);
+#endif
+                if (hatch->common.cold->binary_graphics_data != NULL)
+                {
+                        dxf_binary_buffer_write (fp, 310, hatch->common.cold->binary_graphics_data);
+                }
+        }
+        if (fp->acad_version_number >= AutoCAD_2004)
+        {
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", hatch->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", hatch->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", hatch->common.cold->transparency);
+        }
+        if (fp->acad_version_number >= AutoCAD_2009)
+        {
+                dxf_handle_write (fp, 390, hatch->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", hatch->common.cold->shadow_mode);
+        }
+        fprintf (fp->fp, "100\nAcDbHatch\n");
+        fprintf (fp->fp, " 10\n%f\n", hatch->p0->x0);
+        fprintf (fp->fp, " 20\n%f\n", hatch->p0->y0);
+        fprintf (fp->fp, " 30\n%f\n", hatch->p0->z0);
+        fprintf (fp->fp, "210\n%f\n", hatch->extr_x0);
+        fprintf (fp->fp, "220\n%f\n", hatch->extr_y0);
+        fprintf (fp->fp, "230\n%f\n", hatch->extr_z0);
+        fprintf (fp->fp, "  2\n%s\n", hatch->pattern_name);
+        fprintf (fp->fp, " 70\n%hd\n", hatch->solid_fill);
+        fprintf (fp->fp, " 71\n%hd\n", hatch->associative);
+        fprintf (fp->fp, " 91\n%" PRIi32 "\n", hatch->number_of_boundary_paths);
+        if (hatch->paths != NULL)
+        {
+                dxf_hatch_boundary_path_write (fp, (DxfHatchBoundaryPath *) hatch->paths);
+        }
+        fprintf (fp->fp, " 75\n%hd\n", hatch->hatch_style);
+        fprintf (fp->fp, " 76\n%hd\n", hatch->hatch_pattern_type);
+        if (!hatch->solid_fill)
+        {
+                fprintf (fp->fp, " 52\n%f\n", hatch->pattern_angle);
+                fprintf (fp->fp, " 41\n%f\n", hatch->pattern_scale);
+                fprintf (fp->fp, " 77\n%hd\n", hatch->pattern_double);
+        }
+        fprintf (fp->fp, " 78\n%hd\n", hatch->number_of_pattern_def_lines);
+        line = (DxfHatchPatternDefLine *) hatch->def_lines;
+        while (line != NULL)
+        {
+                dxf_hatch_pattern_def_line_write (fp, (DxfHatchPatternDefLine *) line);
+                line = (DxfHatchPatternDefLine *) line->next;
+        }
+        fprintf (fp->fp, " 47\n%f\n", hatch->pixel_size);
+        fprintf (fp->fp, " 98\n%" PRIi32 "\n", hatch->number_of_seed_points);
+        point = (DxfHatchPatternSeedPoint *) hatch->seed_points;
+        while (point != NULL)
+        {
+                dxf_hatch_pattern_seedpoint_write (fp, (DxfHatchPatternSeedPoint *) point);
+                point = (DxfHatchPatternSeedPoint *) point->next;
+        }
+        dxf_entity_common_write_xdata (fp, &hatch->common);
+        /* Clean up. */
+        dxf_hatch_pattern_def_line_free (line);
+        dxf_hatch_pattern_seedpoint_free (point);
+        free (dxf_entity_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF \c HATCH and all it's
+ * data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_free
+(
+        DxfHatch *hatch
+                /*!< Pointer to the memory occupied by the DXF \c HATCH
+                 * entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (hatch->next != NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_entity_common_free (&hatch->common);
+        free (hatch->pattern_name);
+        dxf_point_free ((DxfPoint *) hatch->p0);
+        if (hatch->paths != NULL)
+        {
+                dxf_hatch_boundary_path_free_list ((DxfHatchBoundaryPath *) hatch->paths);
+        }
+        if (hatch->patterns != NULL)
+        {
+                dxf_hatch_pattern_free_list ((DxfHatchPattern *) hatch->patterns);
+        }
+        if (hatch->def_lines != NULL)
+        {
+                dxf_hatch_pattern_def_line_free_list ((DxfHatchPatternDefLine *) hatch->def_lines);
+        }
+        if (hatch->seed_points != NULL)
+        {
+                dxf_hatch_pattern_seedpoint_free_list ((DxfHatchPatternSeedPoint *) hatch->seed_points);
+        }
+        free (hatch);
+        hatch = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a single linked list of DXF
+ * \c HATCH entities and all their data fields.
+ */
+void
+dxf_hatch_free_list
+(
+        DxfHatch *hatches
+                /*!< pointer to the single linked list of DXF \c HATCH
+                 * entities. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (hatches == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+        }
+        while (hatches != NULL)
+        {
+                DxfHatch *iter = (DxfHatch *) hatches->next;
+                hatches->next = NULL;
+                dxf_hatch_free (hatches);
+                hatches = (DxfHatch *) iter;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path edge arcs.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathEdgeArc *
+dxf_hatch_boundary_path_edge_arc_copy_list
+(
+        DxfHatchBoundaryPathEdgeArc *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathEdgeArc *copy = NULL;
+        DxfHatchBoundaryPathEdgeArc *last = NULL;
+        DxfHatchBoundaryPathEdgeArc *iter;
+        DxfHatchBoundaryPathEdgeArc *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathEdgeArc *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathEdgeArc));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathEdgeArc));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathEdgeArc *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_edge_arc_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path edge ellipses.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathEdgeEllipse *
+dxf_hatch_boundary_path_edge_ellipse_copy_list
+(
+        DxfHatchBoundaryPathEdgeEllipse *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathEdgeEllipse *copy = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *last = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *iter;
+        DxfHatchBoundaryPathEdgeEllipse *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathEdgeEllipse *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathEdgeEllipse));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathEdgeEllipse));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathEdgeEllipse *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_edge_ellipse_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path edge lines.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathEdgeLine *
+dxf_hatch_boundary_path_edge_line_copy_list
+(
+        DxfHatchBoundaryPathEdgeLine *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathEdgeLine *copy = NULL;
+        DxfHatchBoundaryPathEdgeLine *last = NULL;
+        DxfHatchBoundaryPathEdgeLine *iter;
+        DxfHatchBoundaryPathEdgeLine *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathEdgeLine *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathEdgeLine));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathEdgeLine));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathEdgeLine *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_edge_line_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path edge spline control points.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathEdgeSplineCp *
+dxf_hatch_boundary_path_edge_spline_control_point_copy_list
+(
+        DxfHatchBoundaryPathEdgeSplineCp *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathEdgeSplineCp *copy = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *last = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *iter;
+        DxfHatchBoundaryPathEdgeSplineCp *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathEdgeSplineCp *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathEdgeSplineCp));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathEdgeSplineCp));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathEdgeSplineCp *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_edge_spline_control_point_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path edge splines.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathEdgeSpline *
+dxf_hatch_boundary_path_edge_spline_copy_list
+(
+        DxfHatchBoundaryPathEdgeSpline *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathEdgeSpline *copy = NULL;
+        DxfHatchBoundaryPathEdgeSpline *last = NULL;
+        DxfHatchBoundaryPathEdgeSpline *iter;
+        DxfHatchBoundaryPathEdgeSpline *node;
+        int error = FALSE;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathEdgeSpline *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathEdgeSpline));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                node->control_points = NULL;
+                node->last_control_point = NULL;
+                node->next = NULL;
+                if ((!error) && (iter->control_points != NULL))
+                {
+                        node->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *)
+                          dxf_hatch_boundary_path_edge_spline_control_point_copy_list
+                          ((DxfHatchBoundaryPathEdgeSplineCp *) iter->control_points);
+                        if (node->control_points == NULL)
+                        {
+                                dxf_hatch_boundary_path_edge_spline_free (node);
+                                error = TRUE;
+                        }
+                }
+                if (error)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathEdgeSpline *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_edge_spline_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path edges.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathEdge *
+dxf_hatch_boundary_path_edge_copy_list
+(
+        DxfHatchBoundaryPathEdge *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathEdge *copy = NULL;
+        DxfHatchBoundaryPathEdge *last = NULL;
+        DxfHatchBoundaryPathEdge *iter;
+        DxfHatchBoundaryPathEdge *node;
+        int error = FALSE;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathEdge *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathEdge));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathEdge));
+                node->arcs = NULL;
+                node->ellipses = NULL;
+                node->lines = NULL;
+                node->splines = NULL;
+                node->last_arc = NULL;
+                node->last_ellipse = NULL;
+                node->last_line = NULL;
+                node->last_spline = NULL;
+                node->next = NULL;
+                if ((!error) && (iter->arcs != NULL))
+                {
+                        node->arcs = (struct DxfHatchBoundaryPathEdgeArc *)
+                          dxf_hatch_boundary_path_edge_arc_copy_list
+                          ((DxfHatchBoundaryPathEdgeArc *) iter->arcs);
+                        if (node->arcs == NULL)
+                        {
+                                dxf_hatch_boundary_path_edge_free (node);
+                                error = TRUE;
+                        }
+                }
+                if ((!error) && (iter->ellipses != NULL))
+                {
+                        node->ellipses = (struct DxfHatchBoundaryPathEdgeEllipse *)
+                          dxf_hatch_boundary_path_edge_ellipse_copy_list
+                          ((DxfHatchBoundaryPathEdgeEllipse *) iter->ellipses);
+                        if (node->ellipses == NULL)
+                        {
+                                dxf_hatch_boundary_path_edge_free (node);
+                                error = TRUE;
+                        }
+                }
+                if ((!error) && (iter->lines != NULL))
+                {
+                        node->lines = (struct DxfHatchBoundaryPathEdgeLine *)
+                          dxf_hatch_boundary_path_edge_line_copy_list
+                          ((DxfHatchBoundaryPathEdgeLine *) iter->lines);
+                        if (node->lines == NULL)
+                        {
+                                dxf_hatch_boundary_path_edge_free (node);
+                                error = TRUE;
+                        }
+                }
+                if ((!error) && (iter->splines != NULL))
+                {
+                        node->splines = (struct DxfHatchBoundaryPathEdgeSpline *)
+                          dxf_hatch_boundary_path_edge_spline_copy_list
+                          ((DxfHatchBoundaryPathEdgeSpline *) iter->splines);
+                        if (node->splines == NULL)
+                        {
+                                dxf_hatch_boundary_path_edge_free (node);
+                                error = TRUE;
+                        }
+                }
+                if (error)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathEdge *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_edge_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path polyline vertices.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathPolylineVertex *
+dxf_hatch_boundary_path_polyline_vertex_copy_list
+(
+        DxfHatchBoundaryPathPolylineVertex *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathPolylineVertex *copy = NULL;
+        DxfHatchBoundaryPathPolylineVertex *last = NULL;
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        DxfHatchBoundaryPathPolylineVertex *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathPolylineVertex));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathPolylineVertex));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathPolylineVertex *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_polyline_vertex_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary path polylines.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPathPolyline *
+dxf_hatch_boundary_path_polyline_copy_list
+(
+        DxfHatchBoundaryPathPolyline *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPathPolyline *copy = NULL;
+        DxfHatchBoundaryPathPolyline *last = NULL;
+        DxfHatchBoundaryPathPolyline *iter;
+        DxfHatchBoundaryPathPolyline *node;
+        int error = FALSE;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPathPolyline *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPathPolyline));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPathPolyline));
+                node->vertices = NULL;
+                node->offsets = NULL;
+                node->last_vertex = NULL;
+                node->next = NULL;
+                if ((!error) && (iter->vertices != NULL))
+                {
+                        node->vertices = (struct DxfHatchBoundaryPathPolylineVertex *)
+                          dxf_hatch_boundary_path_polyline_vertex_copy_list
+                          ((DxfHatchBoundaryPathPolylineVertex *) iter->vertices);
+                        if (node->vertices == NULL)
+                        {
+                                dxf_hatch_boundary_path_polyline_free (node);
+                                error = TRUE;
+                        }
+                }
+                if ((!error) && (iter->offsets != NULL))
+                {
+                        node->offsets = dxf_point_offsets_copy (iter->offsets);
+                        if (node->offsets == NULL)
+                        {
+                                dxf_hatch_boundary_path_polyline_free (node);
+                                error = TRUE;
+                        }
+                }
+                if (error)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathPolyline *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_polyline_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH boundary paths.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchBoundaryPath *
+dxf_hatch_boundary_path_copy_list
+(
+        DxfHatchBoundaryPath *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchBoundaryPath *copy = NULL;
+        DxfHatchBoundaryPath *last = NULL;
+        DxfHatchBoundaryPath *iter;
+        DxfHatchBoundaryPath *node;
+        int error = FALSE;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchBoundaryPath *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchBoundaryPath));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchBoundaryPath));
+                node->edges = NULL;
+                node->polylines = NULL;
+                node->last_edge = NULL;
+                node->next = NULL;
+                if ((!error) && (iter->edges != NULL))
+                {
+                        node->edges = (struct DxfHatchBoundaryPathEdge *)
+                          dxf_hatch_boundary_path_edge_copy_list
+                          ((DxfHatchBoundaryPathEdge *) iter->edges);
+                        if (node->edges == NULL)
+                        {
+                                dxf_hatch_boundary_path_free (node);
+                                error = TRUE;
+                        }
+                }
+                if ((!error) && (iter->polylines != NULL))
+                {
+                        node->polylines = (struct DxfHatchBoundaryPathPolyline *)
+                          dxf_hatch_boundary_path_polyline_copy_list
+                          ((DxfHatchBoundaryPathPolyline *) iter->polylines);
+                        if (node->polylines == NULL)
+                        {
+                                dxf_hatch_boundary_path_free (node);
+                                error = TRUE;
+                        }
+                }
+                if (error)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPath *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_boundary_path_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH pattern definition line dashes.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchPatternDefLineDash *
+dxf_hatch_pattern_def_line_dash_copy_list
+(
+        DxfHatchPatternDefLineDash *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchPatternDefLineDash *copy = NULL;
+        DxfHatchPatternDefLineDash *last = NULL;
+        DxfHatchPatternDefLineDash *iter;
+        DxfHatchPatternDefLineDash *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchPatternDefLineDash *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchPatternDefLineDash));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchPatternDefLineDash));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchPatternDefLineDash *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_pattern_def_line_dash_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH pattern definition lines.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchPatternDefLine *
+dxf_hatch_pattern_def_line_copy_list
+(
+        DxfHatchPatternDefLine *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchPatternDefLine *copy = NULL;
+        DxfHatchPatternDefLine *last = NULL;
+        DxfHatchPatternDefLine *iter;
+        DxfHatchPatternDefLine *node;
+        int error = FALSE;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchPatternDefLine *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchPatternDefLine));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchPatternDefLine));
+                node->dashes = NULL;
+                node->next = NULL;
+                if ((!error) && (iter->dashes != NULL))
+                {
+                        node->dashes = (struct DxfHatchPatternDefLineDash *)
+                          dxf_hatch_pattern_def_line_dash_copy_list
+                          ((DxfHatchPatternDefLineDash *) iter->dashes);
+                        if (node->dashes == NULL)
+                        {
+                                dxf_hatch_pattern_def_line_free (node);
+                                error = TRUE;
+                        }
+                }
+                if (error)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchPatternDefLine *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_pattern_def_line_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH pattern seed points.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchPatternSeedPoint *
+dxf_hatch_pattern_seedpoint_copy_list
+(
+        DxfHatchPatternSeedPoint *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchPatternSeedPoint *copy = NULL;
+        DxfHatchPatternSeedPoint *last = NULL;
+        DxfHatchPatternSeedPoint *iter;
+        DxfHatchPatternSeedPoint *node;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchPatternSeedPoint *) iter->next)
+        {
+                node = malloc (sizeof (DxfHatchPatternSeedPoint));
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchPatternSeedPoint));
+                node->next = NULL;
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchPatternSeedPoint *) node;
+                }
+                last = node;
+        }
+        if (iter != NULL)
+        {
+                if (copy != NULL)
+                {
+                        dxf_hatch_pattern_seedpoint_free_list (copy);
+                }
+                return (NULL);
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a single linked list of DXF \c HATCH patterns.
+ *
+ * \return a pointer to the first item of the copied list when
+ * successful, or \c NULL when an error occurred.
+ */
+static DxfHatchPattern *
+dxf_hatch_pattern_copy_list
+(
+        DxfHatchPattern *list
+                /*!< a pointer to the first item of the list to copy. */
+)
+{
+        DxfHatchPattern *copy = NULL;
+        DxfHatchPattern *last = NULL;
+        DxfHatchPattern *iter;
+        DxfHatchPattern *node;
+        int error = FALSE;
+
+        for (iter = list;
+
+          iter != NULL;
+
+          iter = (DxfHatchPattern *) iter->next)
         {
-#ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", hatch->graphics_data_size);
-#else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", hatch->graphics_data_size);
-#endif
-                if (hatch->binary_graphics_data != NULL)
+                node = malloc (sizeof (DxfHatchPattern));
+                if (node == NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) hatch->binary_graphics_data;
-                        while (iter != NULL)
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        break;
+                }
+                memcpy (node, iter, sizeof (DxfHatchPattern));
+                node->def_lines = NULL;
+                node->seed_points = NULL;
+                node->next = NULL;
+                if ((!error) && (iter->def_lines != NULL))
+                {
+                        node->def_lines = (struct DxfHatchPatternDefLine *)
+                          dxf_hatch_pattern_def_line_copy_list
+                          ((DxfHatchPatternDefLine *) iter->def_lines);
+                        if (node->def_lines == NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
+                                dxf_hatch_pattern_free (node);
+                                error = TRUE;
                         }
                 }
+                if ((!error) && (iter->seed_points != NULL))
+                {
+                        node->seed_points = (struct DxfHatchPatternSeedPoint *)
+                          dxf_hatch_pattern_seedpoint_copy_list
+                          ((DxfHatchPatternSeedPoint *) iter->seed_points);
+                        if (node->seed_points == NULL)
+                        {
+                                dxf_hatch_pattern_free (node);
+                                error = TRUE;
+                        }
+                }
+                if (error)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        copy = node;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchPattern *) node;
+                }
+                last = node;
         }
-        if (fp->acad_version_number >= AutoCAD_2004)
-        {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", hatch->color_value);
-                fprintf (fp->fp, "430\n%s\n", hatch->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", hatch->transparency);
-        }
-        if (fp->acad_version_number >= AutoCAD_2009)
-        {
-                fprintf (fp->fp, "390\n%s\n", hatch->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", hatch->shadow_mode);
-        }
-        fprintf (fp->fp, "100\nAcDbHatch\n");
-        fprintf (fp->fp, " 10\n%f\n", hatch->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", hatch->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", hatch->p0->z0);
-        fprintf (fp->fp, "210\n%f\n", hatch->extr_x0);
-        fprintf (fp->fp, "220\n%f\n", hatch->extr_y0);
-        fprintf (fp->fp, "230\n%f\n", hatch->extr_z0);
-        fprintf (fp->fp, "  2\n%s\n", hatch->pattern_name);
-        fprintf (fp->fp, " 70\n%hd\n", hatch->solid_fill);
-        fprintf (fp->fp, " 71\n%hd\n", hatch->associative);
-        fprintf (fp->fp, " 91\n%" PRIi32 "\n", hatch->number_of_boundary_paths);
-        dxf_hatch_boundary_path_write (fp, (DxfHatchBoundaryPath *) hatch->paths);
-        fprintf (fp->fp, " 75\n%hd\n", hatch->hatch_style);
-        fprintf (fp->fp, " 76\n%hd\n", hatch->hatch_pattern_type);
-        if (!hatch->solid_fill)
-        {
-                fprintf (fp->fp, " 52\n%f\n", hatch->pattern_angle);
-                fprintf (fp->fp, " 41\n%f\n", hatch->pattern_scale);
-                fprintf (fp->fp, " 77\n%hd\n", hatch->pattern_double);
-        }
-        fprintf (fp->fp, " 78\n%hd\n", hatch->number_of_pattern_def_lines);
-        line = (DxfHatchPatternDefLine *) hatch->def_lines;
-        while (line != NULL)
-        {
-                dxf_hatch_pattern_def_line_write (fp, (DxfHatchPatternDefLine *) line);
-                line = (DxfHatchPatternDefLine *) line->next;
-        }
-        fprintf (fp->fp, " 47\n%f\n", hatch->pixel_size);
-        fprintf (fp->fp, " 98\n%" PRIi32 "\n", hatch->number_of_seed_points);
-        point = (DxfHatchPatternSeedPoint *) hatch->seed_points;
-        while (point != NULL)
+        if (iter != NULL)
         {
-                dxf_hatch_pattern_seedpoint_write (fp, (DxfHatchPatternSeedPoint *) point);
-                point = (DxfHatchPatternSeedPoint *) point->next;
+                if (copy != NULL)
+                {
+                        dxf_hatch_pattern_free_list (copy);
+                }
+                return (NULL);
         }
-        /* Clean up. */
-        dxf_hatch_pattern_def_line_free (line);
-        dxf_hatch_pattern_seedpoint_free (point);
-        free (dxf_entity_name);
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (EXIT_SUCCESS);
+        return (copy);
 }
 
 
 /*!
- * \brief Free the allocated memory for a DXF \c HATCH and all it's
- * data fields.
+ * \brief Copy a DXF \c HATCH entity.
  *
- * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
- * occurred.
+ * The copy does not share any memory with \c hatch, its \c next
+ * member is \c NULL.\n
+ * The boundary paths, patterns, pattern definition lines and seed
+ * points are copied with all their items.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
  */
-int
-dxf_hatch_free
+DxfHatch *
+dxf_hatch_copy
 (
         DxfHatch *hatch
-                /*!< Pointer to the memory occupied by the DXF \c HATCH
-                 * entity. */
+                /*!< a pointer to the DXF \c HATCH entity to copy. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfHatch *copy;
+
         /* Do some basic checks. */
         if (hatch == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
-        if (hatch->next != NULL)
+        copy = dxf_hatch_new ();
+        if (copy == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
-        free (hatch->linetype);
-        free (hatch->layer);
-        dxf_binary_data_free_list ((DxfBinaryData *) hatch->binary_graphics_data);
-        free (hatch->dictionary_owner_soft);
-        free (hatch->material);
-        free (hatch->dictionary_owner_hard);
-        free (hatch->plot_style_name);
-        free (hatch->color_name);
-        free (hatch->pattern_name);
-        dxf_point_free ((DxfPoint *) hatch->p0);
-        dxf_hatch_boundary_path_free_list ((DxfHatchBoundaryPath *) hatch->paths);
-        dxf_hatch_pattern_free_list ((DxfHatchPattern *) hatch->patterns);
-        dxf_hatch_pattern_def_line_free_list ((DxfHatchPatternDefLine *) hatch->def_lines);
-        dxf_hatch_pattern_seedpoint_free_list ((DxfHatchPatternSeedPoint *) hatch->seed_points);
-        free (hatch);
-        hatch = NULL;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (EXIT_SUCCESS);
-}
-
-
-/*!
- * \brief Free the allocated memory for a single linked list of DXF
- * \c HATCH entities and all their data fields.
- */
-void
-dxf_hatch_free_list
-(
-        DxfHatch *hatches
-                /*!< pointer to the single linked list of DXF \c HATCH
-                 * entities. */
-)
-{
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (hatches == NULL)
+        memcpy (copy, hatch, sizeof (DxfHatch));
+        copy->pattern_name = NULL;
+        copy->p0 = NULL;
+        copy->paths = NULL;
+        copy->last_path = NULL;
+        copy->patterns = NULL;
+        copy->def_lines = NULL;
+        copy->seed_points = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &hatch->common) == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
+                dxf_hatch_free (copy);
+                return (NULL);
         }
-        while (hatches != NULL)
+        if (hatch->pattern_name != NULL)
         {
-                DxfHatch *iter = (DxfHatch *) hatches->next;
-                dxf_hatch_free (hatches);
-                hatches = (DxfHatch *) iter;
+                copy->pattern_name = strdup (hatch->pattern_name);
+                if (copy->pattern_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_hatch_free (copy);
+                        return (NULL);
+                }
+        }
+        if (hatch->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (hatch->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_hatch_free (copy);
+                        return (NULL);
+                }
+        }
+        if (hatch->paths != NULL)
+        {
+                copy->paths = (struct DxfHatchBoundaryPath *) dxf_hatch_boundary_path_copy_list
+                  ((DxfHatchBoundaryPath *) hatch->paths);
+                if (copy->paths == NULL)
+                {
+                        dxf_hatch_free (copy);
+                        return (NULL);
+                }
+        }
+        if (hatch->patterns != NULL)
+        {
+                copy->patterns = (struct DxfHatchPattern *) dxf_hatch_pattern_copy_list
+                  ((DxfHatchPattern *) hatch->patterns);
+                if (copy->patterns == NULL)
+                {
+                        dxf_hatch_free (copy);
+                        return (NULL);
+                }
+        }
+        if (hatch->def_lines != NULL)
+        {
+                copy->def_lines = (struct DxfHatchPatternDefLine *) dxf_hatch_pattern_def_line_copy_list
+                  ((DxfHatchPatternDefLine *) hatch->def_lines);
+                if (copy->def_lines == NULL)
+                {
+                        dxf_hatch_free (copy);
+                        return (NULL);
+                }
+        }
+        if (hatch->seed_points != NULL)
+        {
+                copy->seed_points = (struct DxfHatchPatternSeedPoint *) dxf_hatch_pattern_seedpoint_copy_list
+                  ((DxfHatchPatternSeedPoint *) hatch->seed_points);
+                if (copy->seed_points == NULL)
+                {
+                        dxf_hatch_free (copy);
+                        return (NULL);
+                }
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
+        return (copy);
 }
 
 
@@ -492,7 +2260,7 @@ dxf_hatch_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_get_id_code
 (
         DxfHatch *hatch
@@ -510,16 +2278,10 @@ dxf_hatch_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->id_code);
+        return (hatch->common.id_code);
 }
 
 
@@ -531,7 +2293,7 @@ dxf_hatch_set_id_code
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH pattern. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -548,13 +2310,7 @@ dxf_hatch_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        hatch->id_code = id_code;
+        hatch->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -585,7 +2341,7 @@ dxf_hatch_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->linetype ==  NULL)
+        if (hatch->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -595,7 +2351,7 @@ dxf_hatch_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->linetype));
+        return (strdup (hatch->common.linetype));
 }
 
 
@@ -629,7 +2385,7 @@ dxf_hatch_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->linetype = strdup (linetype);
+        hatch->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -660,7 +2416,7 @@ dxf_hatch_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->layer ==  NULL)
+        if (hatch->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -670,7 +2426,7 @@ dxf_hatch_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->layer));
+        return (strdup (hatch->common.layer));
 }
 
 
@@ -704,7 +2460,7 @@ dxf_hatch_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->layer = strdup (layer);
+        hatch->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -738,7 +2494,7 @@ dxf_hatch_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->elevation);
+        return (hatch->common.elevation);
 }
 
 
@@ -765,7 +2521,7 @@ dxf_hatch_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->elevation = elevation;
+        hatch->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -796,7 +2552,7 @@ dxf_hatch_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->thickness < 0.0)
+        if (hatch->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -805,7 +2561,7 @@ dxf_hatch_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->thickness);
+        return (hatch->common.thickness);
 }
 
 
@@ -838,7 +2594,7 @@ dxf_hatch_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        hatch->thickness = thickness;
+        hatch->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -869,7 +2625,7 @@ dxf_hatch_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->linetype_scale < 0.0)
+        if (hatch->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -878,7 +2634,7 @@ dxf_hatch_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->linetype_scale);
+        return (hatch->common.linetype_scale);
 }
 
 
@@ -911,7 +2667,7 @@ dxf_hatch_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        hatch->linetype_scale = linetype_scale;
+        hatch->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -942,13 +2698,13 @@ dxf_hatch_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->visibility < 0)
+        if (hatch->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (hatch->visibility > 1)
+        if (hatch->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -957,7 +2713,7 @@ dxf_hatch_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->visibility);
+        return (hatch->common.visibility);
 }
 
 
@@ -996,7 +2752,7 @@ dxf_hatch_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        hatch->visibility = visibility;
+        hatch->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1027,7 +2783,7 @@ dxf_hatch_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->color < 0)
+        if (hatch->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1036,7 +2792,7 @@ dxf_hatch_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->color);
+        return (hatch->common.color);
 }
 
 
@@ -1071,7 +2827,7 @@ dxf_hatch_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        hatch->color = color;
+        hatch->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1102,13 +2858,13 @@ dxf_hatch_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->paperspace < 0)
+        if (hatch->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (hatch->paperspace > 1)
+        if (hatch->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1117,7 +2873,7 @@ dxf_hatch_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->paperspace);
+        return (hatch->common.paperspace);
 }
 
 
@@ -1156,7 +2912,7 @@ dxf_hatch_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        hatch->paperspace = paperspace;
+        hatch->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1187,13 +2943,13 @@ dxf_hatch_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->graphics_data_size < 0)
+        if (hatch->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (hatch->graphics_data_size == 0)
+        if (hatch->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1202,7 +2958,7 @@ dxf_hatch_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->graphics_data_size);
+        return (hatch->common.cold->graphics_data_size);
 }
 
 
@@ -1242,7 +2998,7 @@ dxf_hatch_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        hatch->graphics_data_size = graphics_data_size;
+        hatch->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1251,14 +3007,15 @@ dxf_hatch_set_graphics_data_size
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c HATCH entity.
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_hatch_get_binary_graphics_data
 (
         DxfHatch *hatch
@@ -1276,32 +3033,31 @@ dxf_hatch_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) hatch->binary_graphics_data);
+        return (hatch->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c HATCH entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c hatch when successful, or \c NULL when an
+ * error occurred.
  */
 DxfHatch *
 dxf_hatch_set_binary_graphics_data
 (
         DxfHatch *hatch,
                 /*!< a pointer to a DXF \c HATCH entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1322,7 +3078,12 @@ dxf_hatch_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->binary_graphics_data = (DxfBinaryData *) data;
+        if ((hatch->common.cold->binary_graphics_data != NULL)
+          && (hatch->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (hatch->common.cold->binary_graphics_data);
+        }
+        hatch->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1356,17 +3117,10 @@ dxf_hatch_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->dictionary_owner_soft));
+        return (dxf_handle_to_string (hatch->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1402,7 +3156,7 @@ dxf_hatch_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        hatch->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1436,17 +3190,10 @@ dxf_hatch_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->object_owner_soft));
+        return (dxf_handle_to_string (hatch->common.cold->object_owner_soft));
 }
 
 
@@ -1482,7 +3229,7 @@ dxf_hatch_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->object_owner_soft = strdup (object_owner_soft);
+        hatch->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1516,17 +3263,10 @@ dxf_hatch_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->material));
+        return (dxf_handle_to_string (hatch->common.cold->material));
 }
 
 
@@ -1564,7 +3304,7 @@ dxf_hatch_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->material = strdup (material);
+        hatch->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1598,17 +3338,10 @@ dxf_hatch_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->dictionary_owner_hard));
+        return (dxf_handle_to_string (hatch->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1644,7 +3377,7 @@ dxf_hatch_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        hatch->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1676,13 +3409,13 @@ dxf_hatch_get_lineweight
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (hatch->lineweight < 0)
+        if (hatch->common.lineweight < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (hatch->lineweight == 0)
+        if (hatch->common.lineweight == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a value of zero was found.\n")),
@@ -1691,7 +3424,7 @@ dxf_hatch_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->lineweight);
+        return (hatch->common.lineweight);
 }
 
 
@@ -1733,7 +3466,7 @@ dxf_hatch_set_lineweight
                   (_("Warning in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
         }
-        hatch->lineweight = lineweight;
+        hatch->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1765,17 +3498,10 @@ dxf_hatch_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->plot_style_name));
+        return (dxf_handle_to_string (hatch->common.cold->plot_style_name));
 }
 
 
@@ -1813,7 +3539,7 @@ dxf_hatch_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->plot_style_name = strdup (plot_style_name);
+        hatch->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1848,7 +3574,7 @@ dxf_hatch_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->color_value);
+        return (hatch->common.color_value);
 }
 
 
@@ -1878,7 +3604,7 @@ dxf_hatch_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->color_value = color_value;
+        hatch->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1910,7 +3636,7 @@ dxf_hatch_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (hatch->color_name ==  NULL)
+        if (hatch->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1920,7 +3646,7 @@ dxf_hatch_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (hatch->color_name));
+        return (strdup (hatch->common.cold->color_name));
 }
 
 
@@ -1958,7 +3684,7 @@ dxf_hatch_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->color_name = strdup (color_name);
+        hatch->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1993,7 +3719,7 @@ dxf_hatch_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch->transparency);
+        return (hatch->common.cold->transparency);
 }
 
 
@@ -2023,7 +3749,7 @@ dxf_hatch_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->transparency = transparency;
+        hatch->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3284,20 +5010,99 @@ dxf_hatch_set_boundary_paths
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (NULL);
+        }
+        if (paths == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        hatch->paths = (struct DxfHatchBoundaryPath *) paths;
+        hatch->last_path = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hatch);
+}
+
+
+/*!
+ * \brief Append a boundary path to the linked list of boundary paths
+ * of a DXF \c HATCH.
+ *
+ * The last boundary path is remembered in the \c last_path member, so
+ * appending costs O(1) instead of walking the whole list.\n
+ * When \c path is the first boundary path of a chain, the whole chain
+ * is appended.
+ *
+ * \warning The boundary path is not copied, \c hatch takes ownership of
+ * \c path.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_append_boundary_path
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH. */
+        DxfHatchBoundaryPath *path
+                /*!< the boundary path to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *iter;
+
+        /* Do some basic checks. */
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        if (paths == NULL)
+        if (path == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (EXIT_FAILURE);
         }
-        hatch->paths = (struct DxfHatchBoundaryPath *) paths;
+        if (hatch->paths == NULL)
+        {
+                hatch->paths = (struct DxfHatchBoundaryPath *) path;
+        }
+        else
+        {
+                /* use the cached pointer to the last boundary path,
+                 * only when it is unknown start at the first boundary
+                 * path. */
+                iter = (DxfHatchBoundaryPath *) hatch->last_path;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPath *) hatch->paths;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPath *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPath *) path;
+        }
+        /* remember the last boundary path of the appended chain. */
+        iter = path;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPath *) iter->next;
+        }
+        hatch->last_path = (struct DxfHatchBoundaryPath *) iter;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (hatch);
+        return (EXIT_SUCCESS);
 }
 
 
@@ -3657,6 +5462,7 @@ dxf_hatch_pattern_free_list
         while (patterns != NULL)
         {
                 DxfHatchPattern *iter = (DxfHatchPattern *) patterns->next;
+                patterns->next = NULL;
                 dxf_hatch_pattern_free (patterns);
                 patterns = (DxfHatchPattern *) iter;
         }
@@ -3671,7 +5477,7 @@ dxf_hatch_pattern_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_pattern_get_id_code
 (
         DxfHatchPattern *pattern
@@ -3689,12 +5495,6 @@ dxf_hatch_pattern_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (pattern->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3710,7 +5510,7 @@ dxf_hatch_pattern_set_id_code
 (
         DxfHatchPattern *pattern,
                 /*!< a pointer to a DXF \c HATCH pattern. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3727,12 +5527,6 @@ dxf_hatch_pattern_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         pattern->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -4315,6 +6109,7 @@ dxf_hatch_pattern_def_line_dash_free_list
         while (dashes != NULL)
         {
                 DxfHatchPatternDefLineDash *iter = (DxfHatchPatternDefLineDash *) dashes->next;
+                dashes->next = NULL;
                 dxf_hatch_pattern_def_line_dash_free (dashes);
                 dashes = (DxfHatchPatternDefLineDash *) iter;
         }
@@ -4716,6 +6511,10 @@ dxf_hatch_pattern_def_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        if (line->dashes != NULL)
+        {
+                dxf_hatch_pattern_def_line_dash_free_list ((DxfHatchPatternDefLineDash *) line->dashes);
+        }
         free (line);
         line = NULL;
 #if DEBUG
@@ -4750,6 +6549,7 @@ dxf_hatch_pattern_def_line_free_list
         while (lines != NULL)
         {
                 DxfHatchPatternDefLine *iter = (DxfHatchPatternDefLine *) lines->next;
+                lines->next = NULL;
                 dxf_hatch_pattern_def_line_free (lines);
                 lines = (DxfHatchPatternDefLine *) iter;
         }
@@ -4764,7 +6564,7 @@ dxf_hatch_pattern_def_line_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_pattern_def_line_get_id_code
 (
         DxfHatchPatternDefLine *line
@@ -4782,12 +6582,6 @@ dxf_hatch_pattern_def_line_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4803,7 +6597,7 @@ dxf_hatch_pattern_def_line_set_id_code
 (
         DxfHatchPatternDefLine *line,
                 /*!< a pointer to a DXF \c HATCH pattern def line. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -4820,12 +6614,6 @@ dxf_hatch_pattern_def_line_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         line->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -5620,6 +7408,7 @@ dxf_hatch_pattern_seedpoint_free_list
         while (hatch_pattern_seed_points != NULL)
         {
                 DxfHatchPatternSeedPoint *iter = (DxfHatchPatternSeedPoint *) hatch_pattern_seed_points->next;
+                hatch_pattern_seed_points->next = NULL;
                 dxf_hatch_pattern_seedpoint_free (hatch_pattern_seed_points);
                 hatch_pattern_seed_points = (DxfHatchPatternSeedPoint *) iter;
         }
@@ -5634,7 +7423,7 @@ dxf_hatch_pattern_seedpoint_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_pattern_seedpoint_get_id_code
 (
         DxfHatchPatternSeedPoint *point
@@ -5652,12 +7441,6 @@ dxf_hatch_pattern_seedpoint_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5673,7 +7456,7 @@ dxf_hatch_pattern_seedpoint_set_id_code
 (
         DxfHatchPatternSeedPoint *point,
                 /*!< a pointer to a DXF \c HATCH pattern seed point. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -5690,12 +7473,6 @@ dxf_hatch_pattern_seedpoint_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         point->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -6025,6 +7802,7 @@ dxf_hatch_boundary_path_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         path->edges = NULL;
+        path->last_edge = NULL;
         path->polylines = NULL;
         path->next = NULL;
 #if DEBUG
@@ -6069,48 +7847,34 @@ dxf_hatch_boundary_path_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        for (;;)
+        while (path != NULL)
         {
-                if (path->next == NULL)
+                /* Test for edge type or polylines type. */
+                if (path->polylines != NULL)
                 {
-                        fprintf (stderr,
-                          (_("Information from %s () last boundary path encountered.\n")),
-                          __FUNCTION__);
-                        break;
+                        iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                        while (iter != NULL)
+                        {
+                                dxf_hatch_boundary_path_polyline_write
+                                (
+                                        fp,
+                                        iter
+                                );
+                                iter = (DxfHatchBoundaryPathPolyline *) iter->next;
+                        }
+                }
+                else if (path->edges != NULL)
+                {
+                        /*! \todo Write edges data. */
                 }
                 else
                 {
-                        /* Test for edge type or polylines type. */
-                        if (path->edges != NULL)
-                        {
-                                /*! \todo Write edges data. */
-                        }
-                        else if (path->polylines != NULL)
-                        {
-                                iter = dxf_hatch_boundary_path_polyline_new ();
-                                iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
-                                for (;;)
-                                {
-                                        dxf_hatch_boundary_path_polyline_write
-                                        (
-                                                fp,
-                                                iter
-                                        );
-                                        iter = (DxfHatchBoundaryPathPolyline *) iter->next;
-                                        if (iter == NULL)
-                                        {
-                                                break;
-                                        }
-                                }
-                        }
-                        else
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () unknown boundary path type encountered.\n")),
-                                  __FUNCTION__);
-                                return (EXIT_FAILURE);
-                        }
+                        fprintf (stderr,
+                          (_("Error in %s () unknown boundary path type encountered.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
                 }
+                path = (DxfHatchBoundaryPath *) path->next;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -6152,8 +7916,14 @@ dxf_hatch_boundary_path_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (path->edges);
-        free (path->polylines);
+        if (path->edges != NULL)
+        {
+                dxf_hatch_boundary_path_edge_free_list ((DxfHatchBoundaryPathEdge *) path->edges);
+        }
+        if (path->polylines != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_free_list ((DxfHatchBoundaryPathPolyline *) path->polylines);
+        }
         free (path);
         path = NULL;
 #if DEBUG
@@ -6188,6 +7958,7 @@ dxf_hatch_boundary_path_free_list
         while (hatch_boundary_paths != NULL)
         {
                 DxfHatchBoundaryPath *iter = (DxfHatchBoundaryPath *) hatch_boundary_paths->next;
+                hatch_boundary_paths->next = NULL;
                 dxf_hatch_boundary_path_free (hatch_boundary_paths);
                 hatch_boundary_paths = (DxfHatchBoundaryPath *) iter;
         }
@@ -6202,7 +7973,7 @@ dxf_hatch_boundary_path_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_get_id_code
 (
         DxfHatchBoundaryPath *path
@@ -6220,12 +7991,6 @@ dxf_hatch_boundary_path_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (path->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6241,7 +8006,7 @@ dxf_hatch_boundary_path_set_id_code
 (
         DxfHatchBoundaryPath *path,
                 /*!< a pointer to a DXF \c HATCH boundary path. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -6258,12 +8023,6 @@ dxf_hatch_boundary_path_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         path->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -6342,6 +8101,7 @@ dxf_hatch_boundary_path_set_edges
                 return (NULL);
         }
         path->edges = (struct DxfHatchBoundaryPathEdge *) edges;
+        path->last_edge = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6349,6 +8109,83 @@ dxf_hatch_boundary_path_set_edges
 }
 
 
+/*!
+ * \brief Append an edge to the linked list of edges of a DXF \c HATCH
+ * boundary path.
+ *
+ * The last edge is remembered in the \c last_edge member, so
+ * appending costs O(1) instead of walking the whole list.\n
+ * When \c edge is the first edge of a chain, the whole chain is
+ * appended.
+ *
+ * \warning The edge is not copied, \c path takes ownership of
+ * \c edge.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_append_edge
+(
+        DxfHatchBoundaryPath *path,
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+        DxfHatchBoundaryPathEdge *edge
+                /*!< the edge to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdge *iter;
+
+        /* Do some basic checks. */
+        if (path == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (path->edges == NULL)
+        {
+                path->edges = (struct DxfHatchBoundaryPathEdge *) edge;
+        }
+        else
+        {
+                /* use the cached pointer to the last edge, only when
+                 * it is unknown start at the first edge. */
+                iter = (DxfHatchBoundaryPathEdge *) path->last_edge;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdge *) path->edges;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdge *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPathEdge *) edge;
+        }
+        /* remember the last edge of the appended chain. */
+        iter = edge;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPathEdge *) iter->next;
+        }
+        path->last_edge = (struct DxfHatchBoundaryPathEdge *) iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the polylines from a DXF \c HATCH boundary path.
  *
@@ -6627,6 +8464,8 @@ dxf_hatch_boundary_path_polyline_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         polyline->vertices = NULL;
+        polyline->last_vertex = NULL;
+        polyline->offsets = NULL;
         polyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -6654,6 +8493,8 @@ dxf_hatch_boundary_path_polyline_write
         DXF_DEBUG_BEGIN
 #endif
         DxfHatchBoundaryPathPolylineVertex *iter;
+        DxfHatchBoundaryPathPolylineVertex vertex;
+        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -6673,29 +8514,47 @@ dxf_hatch_boundary_path_polyline_write
         fprintf (fp->fp, " 73\n%hd\n", polyline->is_closed);
         fprintf (fp->fp, " 93\n%" PRIi32 "\n", polyline->number_of_vertices);
         /* draw hatch boundary vertices. */
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        for (;;)
+        if (polyline->offsets != NULL)
         {
-                dxf_hatch_boundary_path_polyline_vertex_write
-                (
-                        fp,
-                        iter
-                );
-                iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                if (iter == NULL)
+                /* Single precision mode, write the vertices by way of
+                 * a temporary vertex. */
+                dxf_hatch_boundary_path_polyline_vertex_init (&vertex);
+                for (i = 0; i < polyline->offsets->number_of_points; i++)
                 {
-                        break;
+                        dxf_point_offsets_get (polyline->offsets, i, &vertex.x0, &vertex.y0, &vertex.bulge);
+                        vertex.has_bulge = (vertex.bulge != 0.0);
+                        dxf_hatch_boundary_path_polyline_vertex_write (fp, &vertex);
+                }
+                /* test for closed polyline: close with first vertex. */
+                if ((polyline->is_closed)
+                  && (polyline->offsets->number_of_points > 0))
+                {
+                        dxf_point_offsets_get (polyline->offsets, 0, &vertex.x0, &vertex.y0, &vertex.bulge);
+                        vertex.has_bulge = (vertex.bulge != 0.0);
+                        dxf_hatch_boundary_path_polyline_vertex_write (fp, &vertex);
                 }
         }
-        /* test for closed polyline: close with first vertex. */
-        if (polyline->is_closed)
+        else if (polyline->vertices != NULL)
         {
-                dxf_hatch_boundary_path_polyline_vertex_write
-                (
-                        fp,
-                        (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices
-                );
+                iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                while (iter != NULL)
+                {
+                        dxf_hatch_boundary_path_polyline_vertex_write
+                        (
+                                fp,
+                                iter
+                        );
+                        iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                }
+                /* test for closed polyline: close with first vertex. */
+                if (polyline->is_closed)
+                {
+                        dxf_hatch_boundary_path_polyline_vertex_write
+                        (
+                                fp,
+                                (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices
+                        );
+                }
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -6737,7 +8596,14 @@ dxf_hatch_boundary_path_polyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (polyline->vertices);
+        if (polyline->vertices != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_vertex_free_list ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        }
+        if (polyline->offsets != NULL)
+        {
+                dxf_point_offsets_free (polyline->offsets);
+        }
         free (polyline);
         polyline = NULL;
 #if DEBUG
@@ -6772,6 +8638,7 @@ dxf_hatch_boundary_path_polyline_free_list
         while (polylines != NULL)
         {
                 DxfHatchBoundaryPathPolyline *iter = (DxfHatchBoundaryPathPolyline *) polylines->next;
+                polylines->next = NULL;
                 dxf_hatch_boundary_path_polyline_free (polylines);
                 polylines = (DxfHatchBoundaryPathPolyline *) iter;
         }
@@ -6786,7 +8653,7 @@ dxf_hatch_boundary_path_polyline_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_polyline_get_id_code
 (
         DxfHatchBoundaryPathPolyline *polyline
@@ -6804,12 +8671,6 @@ dxf_hatch_boundary_path_polyline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6825,7 +8686,7 @@ dxf_hatch_boundary_path_polyline_set_id_code
 (
         DxfHatchBoundaryPathPolyline *polyline,
                 /*!< a pointer to a DXF \c HATCH boundary path polyline. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -6842,12 +8703,6 @@ dxf_hatch_boundary_path_polyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         polyline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -7089,6 +8944,7 @@ dxf_hatch_boundary_path_polyline_set_vertices
                 return (NULL);
         }
         polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertices;
+        polyline->last_vertex = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7096,6 +8952,83 @@ dxf_hatch_boundary_path_polyline_set_vertices
 }
 
 
+/*!
+ * \brief Append a vertex to the linked list of vertices of a DXF
+ * \c HATCH boundary path polyline.
+ *
+ * The last vertex is remembered in the \c last_vertex member, so
+ * appending costs O(1) instead of walking the whole list.\n
+ * When \c vertex is the first vertex of a chain, the whole chain is
+ * appended.
+ *
+ * \warning The vertex is not copied, \c polyline takes ownership of
+ * \c vertex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_polyline_append_vertex
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+        DxfHatchBoundaryPathPolylineVertex *vertex
+                /*!< the vertex to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *iter;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (vertex == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->vertices == NULL)
+        {
+                polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+        }
+        else
+        {
+                /* use the cached pointer to the last vertex, only
+                 * when it is unknown start at the first vertex. */
+                iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->last_vertex;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+        }
+        /* remember the last vertex of the appended chain. */
+        iter = vertex;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+        }
+        polyline->last_vertex = (struct DxfHatchBoundaryPathPolylineVertex *) iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Test if a hatch boundary polyline is closed and add the missing
  * vertex.
@@ -7630,6 +9563,7 @@ dxf_hatch_boundary_path_polyline_vertex_free_list
         while (hatch_boundary_path_polyline_vertices != NULL)
         {
                 DxfHatchBoundaryPathPolylineVertex *iter = (DxfHatchBoundaryPathPolylineVertex *) hatch_boundary_path_polyline_vertices->next;
+                hatch_boundary_path_polyline_vertices->next = NULL;
                 dxf_hatch_boundary_path_polyline_vertex_free (hatch_boundary_path_polyline_vertices);
                 hatch_boundary_path_polyline_vertices = (DxfHatchBoundaryPathPolylineVertex *) iter;
         }
@@ -7645,7 +9579,7 @@ dxf_hatch_boundary_path_polyline_vertex_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_polyline_vertex_get_id_code
 (
         DxfHatchBoundaryPathPolylineVertex *vertex
@@ -7664,12 +9598,6 @@ dxf_hatch_boundary_path_polyline_vertex_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7687,7 +9615,7 @@ dxf_hatch_boundary_path_polyline_vertex_set_id_code
         DxfHatchBoundaryPathPolylineVertex *vertex,
                 /*!< a pointer to a DXF \c HATCH boundary path polyline
                  * vertex. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -7704,12 +9632,6 @@ dxf_hatch_boundary_path_polyline_vertex_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         vertex->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -8277,9 +10199,13 @@ dxf_hatch_boundary_path_edge_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         edge->arcs = NULL;
+        edge->last_arc = NULL;
         edge->ellipses = NULL;
+        edge->last_ellipse = NULL;
         edge->lines = NULL;
+        edge->last_line = NULL;
         edge->splines = NULL;
+        edge->last_spline = NULL;
         edge->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -8321,10 +10247,22 @@ dxf_hatch_boundary_path_edge_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (edge->arcs);
-        free (edge->ellipses);
-        free (edge->lines);
-        free (edge->splines);
+        if (edge->arcs != NULL)
+        {
+                dxf_hatch_boundary_path_edge_arc_free_list ((DxfHatchBoundaryPathEdgeArc *) edge->arcs);
+        }
+        if (edge->ellipses != NULL)
+        {
+                dxf_hatch_boundary_path_edge_ellipse_free_list ((DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses);
+        }
+        if (edge->lines != NULL)
+        {
+                dxf_hatch_boundary_path_edge_line_free_list ((DxfHatchBoundaryPathEdgeLine *) edge->lines);
+        }
+        if (edge->splines != NULL)
+        {
+                dxf_hatch_boundary_path_edge_spline_free_list ((DxfHatchBoundaryPathEdgeSpline *) edge->splines);
+        }
         free (edge);
         edge = NULL;
 #if DEBUG
@@ -8359,6 +10297,7 @@ dxf_hatch_boundary_path_edge_free_list
         while (edges != NULL)
         {
                 DxfHatchBoundaryPathEdge *iter = (DxfHatchBoundaryPathEdge *) edges->next;
+                edges->next = NULL;
                 dxf_hatch_boundary_path_edge_free (edges);
                 edges = (DxfHatchBoundaryPathEdge *) iter;
         }
@@ -8373,7 +10312,7 @@ dxf_hatch_boundary_path_edge_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_edge_get_id_code
 (
         DxfHatchBoundaryPathEdge *edge
@@ -8391,12 +10330,6 @@ dxf_hatch_boundary_path_edge_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (edge->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8412,7 +10345,7 @@ dxf_hatch_boundary_path_edge_set_id_code
 (
         DxfHatchBoundaryPathEdge *edge,
                 /*!< a pointer to a DXF \c HATCH boundary path edge. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -8429,12 +10362,6 @@ dxf_hatch_boundary_path_edge_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         edge->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -8514,6 +10441,7 @@ dxf_hatch_boundary_path_edge_set_arcs
                 return (NULL);
         }
         edge->arcs = (struct DxfHatchBoundaryPathEdgeArc *) arcs;
+        edge->last_arc = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8521,6 +10449,83 @@ dxf_hatch_boundary_path_edge_set_arcs
 }
 
 
+/*!
+ * \brief Append an arc to the linked list of arcs of a DXF \c HATCH
+ * boundary path edge.
+ *
+ * The last arc is remembered in the \c last_arc member, so appending
+ * costs O(1) instead of walking the whole list.\n
+ * When \c arc is the first arc of a chain, the whole chain is
+ * appended.
+ *
+ * \warning The arc is not copied, \c edge takes ownership of
+ * \c arc.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_append_arc
+(
+        DxfHatchBoundaryPathEdge *edge,
+                /*!< a pointer to a DXF \c HATCH boundary path edge. */
+        DxfHatchBoundaryPathEdgeArc *arc
+                /*!< the arc to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeArc *iter;
+
+        /* Do some basic checks. */
+        if (edge == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (arc == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge->arcs == NULL)
+        {
+                edge->arcs = (struct DxfHatchBoundaryPathEdgeArc *) arc;
+        }
+        else
+        {
+                /* use the cached pointer to the last arc, only when
+                 * it is unknown start at the first arc. */
+                iter = (DxfHatchBoundaryPathEdgeArc *) edge->last_arc;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeArc *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPathEdgeArc *) arc;
+        }
+        /* remember the last arc of the appended chain. */
+        iter = arc;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPathEdgeArc *) iter->next;
+        }
+        edge->last_arc = (struct DxfHatchBoundaryPathEdgeArc *) iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the pointer to the first ellipse of a linked list of
  * ellipses from a DXF \c HATCH boundary path edge.
@@ -8592,6 +10597,7 @@ dxf_hatch_boundary_path_edge_set_ellipses
                 return (NULL);
         }
         edge->ellipses = (struct DxfHatchBoundaryPathEdgeEllipse *) ellipses;
+        edge->last_ellipse = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8599,6 +10605,83 @@ dxf_hatch_boundary_path_edge_set_ellipses
 }
 
 
+/*!
+ * \brief Append an ellipse to the linked list of ellipses of a DXF
+ * \c HATCH boundary path edge.
+ *
+ * The last ellipse is remembered in the \c last_ellipse member, so
+ * appending costs O(1) instead of walking the whole list.\n
+ * When \c ellipse is the first ellipse of a chain, the whole chain is
+ * appended.
+ *
+ * \warning The ellipse is not copied, \c edge takes ownership of
+ * \c ellipse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_append_ellipse
+(
+        DxfHatchBoundaryPathEdge *edge,
+                /*!< a pointer to a DXF \c HATCH boundary path edge. */
+        DxfHatchBoundaryPathEdgeEllipse *ellipse
+                /*!< the ellipse to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeEllipse *iter;
+
+        /* Do some basic checks. */
+        if (edge == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (ellipse == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge->ellipses == NULL)
+        {
+                edge->ellipses = (struct DxfHatchBoundaryPathEdgeEllipse *) ellipse;
+        }
+        else
+        {
+                /* use the cached pointer to the last ellipse, only
+                 * when it is unknown start at the first ellipse. */
+                iter = (DxfHatchBoundaryPathEdgeEllipse *) edge->last_ellipse;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeEllipse *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPathEdgeEllipse *) ellipse;
+        }
+        /* remember the last ellipse of the appended chain. */
+        iter = ellipse;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPathEdgeEllipse *) iter->next;
+        }
+        edge->last_ellipse = (struct DxfHatchBoundaryPathEdgeEllipse *) iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the pointer to the first line of a linked list of lines
  * from a DXF \c HATCH boundary path edge.
@@ -8670,6 +10753,7 @@ dxf_hatch_boundary_path_edge_set_lines
                 return (NULL);
         }
         edge->lines = (struct DxfHatchBoundaryPathEdgeLine *) lines;
+        edge->last_line = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8677,6 +10761,83 @@ dxf_hatch_boundary_path_edge_set_lines
 }
 
 
+/*!
+ * \brief Append a line to the linked list of lines of a DXF \c HATCH
+ * boundary path edge.
+ *
+ * The last line is remembered in the \c last_line member, so
+ * appending costs O(1) instead of walking the whole list.\n
+ * When \c line is the first line of a chain, the whole chain is
+ * appended.
+ *
+ * \warning The line is not copied, \c edge takes ownership of
+ * \c line.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_append_line
+(
+        DxfHatchBoundaryPathEdge *edge,
+                /*!< a pointer to a DXF \c HATCH boundary path edge. */
+        DxfHatchBoundaryPathEdgeLine *line
+                /*!< the line to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeLine *iter;
+
+        /* Do some basic checks. */
+        if (edge == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (line == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge->lines == NULL)
+        {
+                edge->lines = (struct DxfHatchBoundaryPathEdgeLine *) line;
+        }
+        else
+        {
+                /* use the cached pointer to the last line, only when
+                 * it is unknown start at the first line. */
+                iter = (DxfHatchBoundaryPathEdgeLine *) edge->last_line;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeLine *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPathEdgeLine *) line;
+        }
+        /* remember the last line of the appended chain. */
+        iter = line;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPathEdgeLine *) iter->next;
+        }
+        edge->last_line = (struct DxfHatchBoundaryPathEdgeLine *) iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the pointer to the first spline of a linked list of
  * splines from a DXF \c HATCH boundary path edge.
@@ -8748,6 +10909,7 @@ dxf_hatch_boundary_path_edge_set_splines
                 return (NULL);
         }
         edge->splines = (struct DxfHatchBoundaryPathEdgeSpline *) splines;
+        edge->last_spline = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8755,6 +10917,83 @@ dxf_hatch_boundary_path_edge_set_splines
 }
 
 
+/*!
+ * \brief Append a spline to the linked list of splines of a DXF
+ * \c HATCH boundary path edge.
+ *
+ * The last spline is remembered in the \c last_spline member, so
+ * appending costs O(1) instead of walking the whole list.\n
+ * When \c spline is the first spline of a chain, the whole chain is
+ * appended.
+ *
+ * \warning The spline is not copied, \c edge takes ownership of
+ * \c spline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_append_spline
+(
+        DxfHatchBoundaryPathEdge *edge,
+                /*!< a pointer to a DXF \c HATCH boundary path edge. */
+        DxfHatchBoundaryPathEdgeSpline *spline
+                /*!< the spline to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeSpline *iter;
+
+        /* Do some basic checks. */
+        if (edge == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge->splines == NULL)
+        {
+                edge->splines = (struct DxfHatchBoundaryPathEdgeSpline *) spline;
+        }
+        else
+        {
+                /* use the cached pointer to the last spline, only
+                 * when it is unknown start at the first spline. */
+                iter = (DxfHatchBoundaryPathEdgeSpline *) edge->last_spline;
+                if (iter == NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                }
+                while (iter->next != NULL)
+                {
+                        iter = (DxfHatchBoundaryPathEdgeSpline *) iter->next;
+                }
+                iter->next = (struct DxfHatchBoundaryPathEdgeSpline *) spline;
+        }
+        /* remember the last spline of the appended chain. */
+        iter = spline;
+        while (iter->next != NULL)
+        {
+                iter = (DxfHatchBoundaryPathEdgeSpline *) iter->next;
+        }
+        edge->last_spline = (struct DxfHatchBoundaryPathEdgeSpline *) iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c HATCH boundary path edge from a
  * DXF \c HATCH boundary path edge.
@@ -9034,6 +11273,7 @@ dxf_hatch_boundary_path_edge_arc_free_list
         while (hatch_boundary_path_edge_arcs != NULL)
         {
                 DxfHatchBoundaryPathEdgeArc *iter = (DxfHatchBoundaryPathEdgeArc *) hatch_boundary_path_edge_arcs->next;
+                hatch_boundary_path_edge_arcs->next = NULL;
                 dxf_hatch_boundary_path_edge_arc_free (hatch_boundary_path_edge_arcs);
                 hatch_boundary_path_edge_arcs = (DxfHatchBoundaryPathEdgeArc *) iter;
         }
@@ -9048,7 +11288,7 @@ dxf_hatch_boundary_path_edge_arc_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_edge_arc_get_id_code
 (
         DxfHatchBoundaryPathEdgeArc *arc
@@ -9066,12 +11306,6 @@ dxf_hatch_boundary_path_edge_arc_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (arc->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9087,7 +11321,7 @@ dxf_hatch_boundary_path_edge_arc_set_id_code
 (
         DxfHatchBoundaryPathEdgeArc *arc,
                 /*!< a pointer to a DXF \c HATCH boundary path edge arc. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -9104,12 +11338,6 @@ dxf_hatch_boundary_path_edge_arc_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         arc->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -9254,7 +11482,7 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
 (
         DxfHatchBoundaryPathEdgeArc *arc,
                 /*!< a pointer to a DXF \c HATCH boundary path edge arc. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the \c DXfPoint entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -9281,13 +11509,7 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        p1->id_code = id_code;
+        p1->common.id_code = id_code;
         p1->x0 = arc->x0;
         p1->y0 = arc->y0;
 #if DEBUG
@@ -9904,6 +12126,7 @@ dxf_hatch_boundary_path_edge_ellipse_free_list
         while (hatch_boundary_path_edge_ellipses != NULL)
         {
                 DxfHatchBoundaryPathEdgeEllipse *iter = (DxfHatchBoundaryPathEdgeEllipse *) hatch_boundary_path_edge_ellipses->next;
+                hatch_boundary_path_edge_ellipses->next = NULL;
                 dxf_hatch_boundary_path_edge_ellipse_free (hatch_boundary_path_edge_ellipses);
                 hatch_boundary_path_edge_ellipses = (DxfHatchBoundaryPathEdgeEllipse *) iter;
         }
@@ -9919,7 +12142,7 @@ dxf_hatch_boundary_path_edge_ellipse_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_edge_ellipse_get_id_code
 (
         DxfHatchBoundaryPathEdgeEllipse *ellipse
@@ -9938,12 +12161,6 @@ dxf_hatch_boundary_path_edge_ellipse_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ellipse->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9960,7 +12177,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_id_code
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -9977,12 +12194,6 @@ dxf_hatch_boundary_path_edge_ellipse_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         ellipse->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -10135,7 +12346,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -10162,13 +12373,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        p1->id_code = id_code;
+        p1->common.id_code = id_code;
         p1->x0 = ellipse->x0;
         p1->y0 = ellipse->y0;
 #if DEBUG
@@ -10365,7 +12570,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -10392,13 +12597,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        p1->id_code = id_code;
+        p1->common.id_code = id_code;
         p1->x0 = ellipse->x1;
         p1->y0 = ellipse->y1;
 #if DEBUG
@@ -11032,6 +13231,7 @@ dxf_hatch_boundary_path_edge_line_free_list
         while (hatch_boundary_path_edge_lines != NULL)
         {
                 DxfHatchBoundaryPathEdgeLine *iter = (DxfHatchBoundaryPathEdgeLine *) hatch_boundary_path_edge_lines->next;
+                hatch_boundary_path_edge_lines->next = NULL;
                 dxf_hatch_boundary_path_edge_line_free (hatch_boundary_path_edge_lines);
                 hatch_boundary_path_edge_lines = (DxfHatchBoundaryPathEdgeLine *) iter;
         }
@@ -11046,7 +13246,7 @@ dxf_hatch_boundary_path_edge_line_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_edge_line_get_id_code
 (
         DxfHatchBoundaryPathEdgeLine *line
@@ -11065,12 +13265,6 @@ dxf_hatch_boundary_path_edge_line_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -11087,7 +13281,7 @@ dxf_hatch_boundary_path_edge_line_set_id_code
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * line. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11104,12 +13298,6 @@ dxf_hatch_boundary_path_edge_line_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         line->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -11256,7 +13444,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11291,13 +13479,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        p1->id_code = id_code;
+        p1->common.id_code = id_code;
         p1->x0 = line->x0;
         p1->y0 = line->y0;
 #if DEBUG
@@ -11486,7 +13668,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11521,13 +13703,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        p2->id_code = id_code;
+        p2->common.id_code = id_code;
         p2->x0 = line->x1;
         p2->y0 = line->y1;
 #if DEBUG
@@ -11788,6 +13964,7 @@ dxf_hatch_boundary_path_edge_spline_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         spline->control_points = NULL;
+        spline->last_control_point = NULL;
         spline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -11829,7 +14006,10 @@ dxf_hatch_boundary_path_edge_spline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->control_points);
+        if (spline->control_points != NULL)
+        {
+                dxf_hatch_boundary_path_edge_spline_control_point_free_list ((DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points);
+        }
         free (spline);
         spline = NULL;
 #if DEBUG
@@ -11864,6 +14044,7 @@ dxf_hatch_boundary_path_edge_spline_free_list
         while (hatch_boundary_path_edge_splines != NULL)
         {
                 DxfHatchBoundaryPathEdgeSpline *iter = (DxfHatchBoundaryPathEdgeSpline *) hatch_boundary_path_edge_splines->next;
+                hatch_boundary_path_edge_splines->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_free (hatch_boundary_path_edge_splines);
                 hatch_boundary_path_edge_splines = (DxfHatchBoundaryPathEdgeSpline *) iter;
         }
@@ -11878,7 +14059,7 @@ dxf_hatch_boundary_path_edge_spline_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_edge_spline_get_id_code
 (
         DxfHatchBoundaryPathEdgeSpline *spline
@@ -11897,12 +14078,6 @@ dxf_hatch_boundary_path_edge_spline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -11919,7 +14094,7 @@ dxf_hatch_boundary_path_edge_spline_set_id_code
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * spline. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -11936,12 +14111,6 @@ dxf_hatch_boundary_path_edge_spline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spline->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -12465,6 +14634,7 @@ dxf_hatch_boundary_path_edge_spline_set_control_points
                 return (NULL);
         }
         spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) control_points;
+        spline->last_control_point = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -12566,47 +14736,43 @@ dxf_hatch_boundary_path_edge_spline_append_control_point
         {
                 spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
+        DxfHatchBoundaryPathEdgeSplineCp *new = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *iter = NULL;
+        new = dxf_hatch_boundary_path_edge_spline_control_point_new ();
+        new->id_code = control_point->id_code;
+        new->x0 = control_point->x0;
+        new->y0 = control_point->y0;
+        new->weight = control_point->weight;
+        new->next = NULL;
         if (spline->control_points == NULL)
         {
                 /* no control points yet, so append the first control
                  * point. */
-                spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) control_point;
+                spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) new;
         }
         else
         {
-                /* iterate through all existing pointers to control
-                 * points until the pointer to the last control point
-                 * containing a NULL ponter in it's "next" member is
+                /* use the cached pointer to the last control point,
+                 * only when it is unknown iterate through all
+                 * existing control points until the control point
+                 * containing a NULL pointer in it's "next" member is
                  * found. */
-                DxfHatchBoundaryPathEdgeSplineCp *iter = NULL;
-                iter = dxf_hatch_boundary_path_edge_spline_control_point_new ();
-                iter = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
-                for (;;)
+                iter = (DxfHatchBoundaryPathEdgeSplineCp *) spline->last_control_point;
+                if (iter == NULL)
                 {
-                        iter = (DxfHatchBoundaryPathEdgeSplineCp *) iter->next;
-                        if (iter->next == NULL)
+                        iter = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                        while (iter->next != NULL)
                         {
-                                break;
+                                iter = (DxfHatchBoundaryPathEdgeSplineCp *) iter->next;
                         }
                 }
-                /* "iter" now contains the pointer to the last known
-                 * control point, now we can write the pointer to the
-                 * control point that has to be appended in the "next"
-                 * member. */
-                DxfHatchBoundaryPathEdgeSplineCp *new = NULL;
-                new = dxf_hatch_boundary_path_edge_spline_control_point_new ();
-                new->id_code = control_point->id_code;
-                new->x0 = control_point->x0;
-                new->y0 = control_point->y0;
-                new->weight = control_point->weight;
-                new->next = NULL;
                 iter->next = (struct DxfHatchBoundaryPathEdgeSplineCp *) new;
-                spline->number_of_control_points++;
-                /* clean up. */
-                dxf_hatch_boundary_path_edge_spline_control_point_free (control_point);
-                control_point = NULL;
-                dxf_hatch_boundary_path_edge_spline_control_point_free (iter);
         }
+        spline->last_control_point = (struct DxfHatchBoundaryPathEdgeSplineCp *) new;
+        spline->number_of_control_points++;
+        /* clean up. */
+        dxf_hatch_boundary_path_edge_spline_control_point_free (control_point);
+        control_point = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -12719,6 +14885,7 @@ dxf_hatch_boundary_path_edge_spline_prepend_control_point
                 new->weight = control_point->weight;
                 new->next = NULL;
                 spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) new;
+                spline->last_control_point = (struct DxfHatchBoundaryPathEdgeSplineCp *) new;
         }
         else
         {
@@ -13080,6 +15247,9 @@ dxf_hatch_boundary_path_edge_spline_insert_control_point
         {
                 spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
+        /* the last control point may change, let the next append
+         * search for it. */
+        spline->last_control_point = NULL;
         if (spline->control_points == NULL)
         {
                 /* no control points yet, so insert a copy of "cp" at
@@ -13212,6 +15382,9 @@ dxf_hatch_boundary_path_edge_spline_remove_control_point
         {
                 spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
+        /* the last control point may change, let the next append
+         * search for it. */
+        spline->last_control_point = NULL;
         if (spline->control_points == NULL)
         {
                 /* no control points yet, so there is no control point to
@@ -14136,6 +16309,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_list
         while (hatch_boundary_path_edge_spline_control_points != NULL)
         {
                 DxfHatchBoundaryPathEdgeSplineCp *iter = (DxfHatchBoundaryPathEdgeSplineCp *) hatch_boundary_path_edge_spline_control_points->next;
+                hatch_boundary_path_edge_spline_control_points->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_control_point_free (hatch_boundary_path_edge_spline_control_points);
                 hatch_boundary_path_edge_spline_control_points = (DxfHatchBoundaryPathEdgeSplineCp *) iter;
         }
@@ -14151,7 +16325,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_hatch_boundary_path_edge_spline_cp_get_id_code
 (
         DxfHatchBoundaryPathEdgeSplineCp *control_point
@@ -14170,13 +16344,6 @@ dxf_hatch_boundary_path_edge_spline_cp_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (control_point->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -14194,7 +16361,7 @@ dxf_hatch_boundary_path_edge_spline_cp_set_id_code
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
                 /*!< a pointer to a DXF \c HATCH boundary path spline
                  * control point. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -14211,12 +16378,6 @@ dxf_hatch_boundary_path_edge_spline_cp_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         control_point->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -14369,7 +16530,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
                 /*!< a pointer to a DXF \c HATCH boundary path spline
                  * control point. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the \c DXfPoint entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -14396,13 +16557,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        p1->id_code = id_code;
+        p1->common.id_code = id_code;
         p1->x0 = control_point->x0;
         p1->y0 = control_point->y0;
 #if DEBUG
@@ -14656,4 +16811,257 @@ dxf_hatch_boundary_path_edge_spline_cp_get_last
 }
 
 
+/*!
+ * \brief Store the vertices of a DXF \c HATCH boundary path polyline in
+ * single precision.
+ *
+ * The vertices are stored in \c offsets as \c float offsets from the
+ * origin (\c origin_x, \c origin_y), the Z-value of each offset holds
+ * the bulge of the vertex.\n
+ * The list of vertices is freed.
+ *
+ * \return a pointer to \c polyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfHatchBoundaryPathPolyline *
+dxf_hatch_boundary_path_polyline_set_single_precision
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a DXF \c HATCH boundary path
+                 * polyline. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y
+                /*!< Y-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *offsets = NULL;
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        int number_of_points;
+        int i;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (polyline->offsets != NULL)
+        {
+                /* Convert to the new origin by way of double precision. */
+                if (dxf_hatch_boundary_path_polyline_set_double_precision (polyline) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        number_of_points = 0;
+        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        while (iter != NULL)
+        {
+                number_of_points++;
+                iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+        }
+        offsets = dxf_point_offsets_new (number_of_points, origin_x, origin_y, 0.0);
+        if (offsets == NULL)
+        {
+                return (NULL);
+        }
+        i = 0;
+        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        while (iter != NULL)
+        {
+                dxf_point_offsets_set (offsets, i, iter->x0, iter->y0,
+                  iter->has_bulge ? iter->bulge : 0.0);
+                i++;
+                iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+        }
+        if (polyline->vertices != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_vertex_free_list ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        }
+        polyline->vertices = NULL;
+        polyline->last_vertex = NULL;
+        polyline->offsets = offsets;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+/*!
+ * \brief Store the vertices of a DXF \c HATCH boundary path polyline in
+ * double precision (the default).
+ *
+ * A new list of vertices is allocated from \c offsets, which is freed.
+ *
+ * \return a pointer to \c polyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfHatchBoundaryPathPolyline *
+dxf_hatch_boundary_path_polyline_set_double_precision
+(
+        DxfHatchBoundaryPathPolyline *polyline
+                /*!< a pointer to a DXF \c HATCH boundary path
+                 * polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        int i;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (polyline->offsets == NULL)
+        {
+                return (polyline);
+        }
+        for (i = 0; i < polyline->offsets->number_of_points; i++)
+        {
+                vertex = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+                if (vertex == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        if (polyline->vertices != NULL)
+                        {
+                                dxf_hatch_boundary_path_polyline_vertex_free_list ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+                        }
+                        polyline->vertices = NULL;
+                        polyline->last_vertex = NULL;
+                        return (NULL);
+                }
+                dxf_point_offsets_get (polyline->offsets, i, &vertex->x0, &vertex->y0, &vertex->bulge);
+                vertex->has_bulge = (vertex->bulge != 0.0);
+                dxf_hatch_boundary_path_polyline_append_vertex (polyline, vertex);
+        }
+        dxf_point_offsets_free (polyline->offsets);
+        polyline->offsets = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+/*!
+ * \brief Store the vertices of the polyline boundary paths of a DXF
+ * \c HATCH entity in single precision.
+ *
+ * The polyline boundary paths hold the bulk of the coordinates of a
+ * hatch, edges, seed points and the elevation point are kept in double
+ * precision.
+ *
+ * \return a pointer to \c hatch when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfHatch *
+dxf_hatch_set_single_precision
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y
+                /*!< Y-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+
+        /* Do some basic checks. */
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (path = (DxfHatchBoundaryPath *) hatch->paths;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        if (dxf_hatch_boundary_path_polyline_set_single_precision (polyline, origin_x, origin_y) == NULL)
+                        {
+                                return (NULL);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hatch);
+}
+
+
+/*!
+ * \brief Store the vertices of the polyline boundary paths of a DXF
+ * \c HATCH entity in double precision (the default).
+ *
+ * \return a pointer to \c hatch when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfHatch *
+dxf_hatch_set_double_precision
+(
+        DxfHatch *hatch
+                /*!< a pointer to a DXF \c HATCH entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+
+        /* Do some basic checks. */
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (path = (DxfHatchBoundaryPath *) hatch->paths;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        if (dxf_hatch_boundary_path_polyline_set_double_precision (polyline) == NULL)
+                        {
+                                return (NULL);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hatch);
+}
+
+
 /* EOF */
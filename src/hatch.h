@@ -46,6 +46,8 @@
 #include <math.h>
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "point.h"
 #include "binary_data.h"
 
@@ -65,7 +67,7 @@ extern "C" {
 typedef struct
 dxf_hatch_boundary_path_edge_arc_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -97,7 +99,7 @@ dxf_hatch_boundary_path_edge_arc_struct
 typedef struct
 dxf_hatch_boundary_path_edge_ellipse_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -138,7 +140,7 @@ dxf_hatch_boundary_path_edge_ellipse_struct
 typedef struct
 dxf_hatch_boundary_path_edge_line_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -168,7 +170,7 @@ dxf_hatch_boundary_path_edge_line_struct
 typedef struct
 dxf_hatch_boundary_path_edge_spline_cp_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file.\n
@@ -194,7 +196,7 @@ dxf_hatch_boundary_path_edge_spline_cp_struct
 typedef struct
 dxf_hatch_boundary_path_edge_spline_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< group code = 5. */
         int32_t degree;
                 /*!< group code = 94. */
@@ -216,6 +218,10 @@ dxf_hatch_boundary_path_edge_spline_struct
                 /*!< Pointer to the first DxfHatchBoundaryPathEdgeSplineCp.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdgeSplineCp
                  * in the DxfHatchBoundaryPathEdgeSpline. */
+        struct DxfHatchBoundaryPathEdgeSplineCp *last_control_point;
+                /*!< Pointer to the last DxfHatchBoundaryPathEdgeSplineCp,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchBoundaryPathEdgeSpline *next;
                 /*!< Pointer to the next DxfHatchBoundaryPathEdgeSpline.\n
                  * \c NULL if the last DxfHatchBoundaryPathEdgeSpline. */
@@ -229,7 +235,7 @@ dxf_hatch_boundary_path_edge_spline_struct
 typedef struct
 dxf_hatch_boundary_path_edge_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Treat the boundary path edge as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
@@ -237,18 +243,34 @@ dxf_hatch_boundary_path_edge_struct
                 /*!< Pointer to the first DxfHatchBoundaryPathEdgeArc.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdgeArc in
                  * the DxfHatchBoundaryPathEdge. */
+        struct DxfHatchBoundaryPathEdgeArc *last_arc;
+                /*!< Pointer to the last DxfHatchBoundaryPathEdgeArc,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchBoundaryPathEdgeEllipse *ellipses;
                 /*!< Pointer to the first DxfHatchBoundaryPathEdgeEllipse.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdgeEllipse
                  * in the DxfHatchBoundaryPathEdge. */
+        struct DxfHatchBoundaryPathEdgeEllipse *last_ellipse;
+                /*!< Pointer to the last DxfHatchBoundaryPathEdgeEllipse,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchBoundaryPathEdgeLine * lines;
                 /*!< Pointer to the first DxfHatchBoundaryPathEdgeLine.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdgeLine
                  * in the DxfHatchBoundaryPathEdge. */
+        struct DxfHatchBoundaryPathEdgeLine *last_line;
+                /*!< Pointer to the last DxfHatchBoundaryPathEdgeLine,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchBoundaryPathEdgeSpline *splines;
                 /*!< Pointer to the first DxfHatchBoundaryPathEdgeSpline.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdgeSpline
                  * in the DxfHatchBoundaryPathEdge. */
+        struct DxfHatchBoundaryPathEdgeSpline *last_spline;
+                /*!< Pointer to the last DxfHatchBoundaryPathEdgeSpline,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchBoundaryPathEdge *next;
                 /*!< Pointer to the next DxfHatchBoundaryPathEdge.\n
                  * \c NULL if the last DxfHatchBoundaryPathEdge. */
@@ -262,7 +284,7 @@ dxf_hatch_boundary_path_edge_struct
 typedef struct
 dxf_hatch_boundary_path_polyline_vertex_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Group code = 5.*/
         double x0;
                 /*!< Group code = 10. */
@@ -289,7 +311,7 @@ dxf_hatch_boundary_path_polyline_vertex_struct
 typedef struct
 dxf_hatch_boundary_path_polyline_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Group code = 5. */
         int16_t is_closed;
                 /*!< Group code = 73. */
@@ -303,6 +325,17 @@ dxf_hatch_boundary_path_polyline_struct
                  * \c NULL if there is no
                  * DxfHatchBoundaryPathPolylineVertex in the
                  * DxfHatchBoundaryPathPolyline. */
+        struct DxfHatchBoundaryPathPolylineVertex *last_vertex;
+                /*!< Pointer to the last DxfHatchBoundaryPathPolylineVertex,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
+        DxfPointOffsets *offsets;
+                /*!< Vertices as single precision offsets, \c NULL
+                 * unless the polyline is in single precision mode, see
+                 * dxf_hatch_boundary_path_polyline_set_single_precision ().\n
+                 * The Z-value of each offset holds the bulge of the
+                 * vertex.\n
+                 * \c vertices is \c NULL in single precision mode. */
         struct DxfHatchBoundaryPathPolyline *next;
                 /*!< Pointer to the next DxfHatchBoundaryPathPolyline.\n
                  * \c NULL if the last DxfHatchBoundaryPathPolyline. */
@@ -316,7 +349,7 @@ dxf_hatch_boundary_path_polyline_struct
 typedef struct
 dxf_hatch_boundary_path_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Treat the boundary path as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
@@ -324,6 +357,10 @@ dxf_hatch_boundary_path_struct
                 /*!< Pointer to the first DxfHatchBoundaryPathEdge.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdge in
                  * the DxfHatchBoundaryPath. */
+        struct DxfHatchBoundaryPathEdge *last_edge;
+                /*!< Pointer to the last DxfHatchBoundaryPathEdge,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchBoundaryPathPolyline *polylines;
                 /*!< Pointer to the first DxfHatchBoundaryPathPolyline.\n
                  * \c NULL if there is no DxfHatchBoundaryPathPolyline
@@ -356,7 +393,7 @@ dxf_hatch_pattern_def_line_dash_struct
 typedef struct
 dxf_hatch_pattern_def_line_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< group code = 5. */
         double angle;
                 /*!< Hatch pattern line angle.\n
@@ -391,7 +428,7 @@ dxf_hatch_pattern_def_line_struct
 typedef struct
 dxf_hatch_pattern_seedpoint_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< group code = 5. */
         double x0;
                 /*!< Seed point X-value.\n
@@ -411,7 +448,7 @@ dxf_hatch_pattern_seedpoint_struct
 typedef struct
 dxf_hatch_pattern_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< group code = 5. */
         int16_t number_of_def_lines;
                 /*!< Number of hatch pattern definition lines.\n
@@ -436,131 +473,9 @@ typedef struct
 dxf_hatch_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF hatch. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         char *pattern_name;
                 /*!< group code = 2. */
         DxfPoint *p0;
@@ -622,6 +537,10 @@ dxf_hatch_struct
                 /*!< Pointer to the first DxfHatchBoundaryPath.\n
                  * \c NULL if there is no DxfHatchBoundaryPath in the
                  * DxfHatch. */
+        struct DxfHatchBoundaryPath *last_path;
+                /*!< Pointer to the last DxfHatchBoundaryPath,
+                 * so that appending does not have to walk the list.\n
+                 * \c NULL if unknown. */
         struct DxfHatchPattern *patterns;
                 /*!< Pointer to the first DxfHatchPattern.\n
                  * \c NULL if there is no DxfHatchPattern in the
@@ -641,11 +560,13 @@ dxf_hatch_struct
 /* dxf_hatch functions. */
 DxfHatch *dxf_hatch_new ();
 DxfHatch *dxf_hatch_init (DxfHatch *hatch);
+DxfHatch *dxf_hatch_read (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_write (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_free (DxfHatch *hatch);
 void dxf_hatch_free_list (DxfHatch *hatches);
-int dxf_hatch_get_id_code (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_id_code (DxfHatch *hatch, int id_code);
+DxfHatch *dxf_hatch_copy (DxfHatch *hatch);
+DxfHandle dxf_hatch_get_id_code (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_id_code (DxfHatch *hatch, DxfHandle id_code);
 char *dxf_hatch_get_linetype (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_linetype (DxfHatch *hatch, char *linetype);
 char *dxf_hatch_get_layer (DxfHatch *hatch);
@@ -664,8 +585,8 @@ int16_t dxf_hatch_get_paperspace (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_paperspace (DxfHatch *hatch, int16_t paperspace);
 int32_t dxf_hatch_get_graphics_data_size (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_graphics_data_size (DxfHatch *hatch, int32_t graphics_data_size);
-DxfBinaryData *dxf_hatch_get_binary_graphics_data (DxfHatch *hatch);
-DxfHatch *dxf_hatch_set_binary_graphics_data (DxfHatch *hatch, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_hatch_get_binary_graphics_data (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_binary_graphics_data (DxfHatch *hatch, DxfBinaryBuffer *data);
 char *dxf_hatch_get_dictionary_owner_soft (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_dictionary_owner_soft (DxfHatch *hatch, char *dictionary_owner_soft);
 char *dxf_hatch_get_object_owner_soft (DxfHatch *hatch);
@@ -718,18 +639,21 @@ double dxf_hatch_get_extr_z0 (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_extr_z0 (DxfHatch *hatch, double extr_z0);
 DxfHatchBoundaryPath *dxf_hatch_get_boundary_paths (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_boundary_paths (DxfHatch *hatch, DxfHatchBoundaryPath *paths);
+int dxf_hatch_append_boundary_path (DxfHatch *hatch, DxfHatchBoundaryPath *path);
 DxfHatchPattern *dxf_hatch_get_patterns (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_patterns (DxfHatch *hatch, DxfHatchPattern *patterns);
 DxfHatch *dxf_hatch_get_next (DxfHatch *hatch);
 DxfHatch *dxf_hatch_set_next (DxfHatch *hatch, DxfHatch *next);
 DxfHatch *dxf_hatch_get_last (DxfHatch *hatch);
+DxfHatch *dxf_hatch_set_single_precision (DxfHatch *hatch, double origin_x, double origin_y);
+DxfHatch *dxf_hatch_set_double_precision (DxfHatch *hatch);
 /* dxf_hatch_pattern functions. */
 DxfHatchPattern *dxf_hatch_pattern_new ();
 DxfHatchPattern *dxf_hatch_pattern_init (DxfHatchPattern *pattern);
 int dxf_hatch_pattern_free (DxfHatchPattern *pattern);
 void dxf_hatch_pattern_free_list (DxfHatchPattern *patterns);
-int dxf_hatch_pattern_get_id_code (DxfHatchPattern *pattern);
-DxfHatchPattern *dxf_hatch_pattern_set_id_code (DxfHatchPattern *pattern, int id_code);
+DxfHandle dxf_hatch_pattern_get_id_code (DxfHatchPattern *pattern);
+DxfHatchPattern *dxf_hatch_pattern_set_id_code (DxfHatchPattern *pattern, DxfHandle id_code);
 int16_t dxf_hatch_pattern_get_number_of_def_lines (DxfHatchPattern *pattern);
 DxfHatchPattern *dxf_hatch_pattern_set_number_of_def_lines (DxfHatchPattern *pattern, int16_t number_of_def_lines);
 DxfHatchPatternDefLine *dxf_hatch_pattern_get_def_lines (DxfHatchPattern *pattern);
@@ -757,8 +681,8 @@ DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_init (DxfHatchPatternDefLine
 int dxf_hatch_pattern_def_line_write (DxfFile *fp, DxfHatchPatternDefLine *line);
 int dxf_hatch_pattern_def_line_free (DxfHatchPatternDefLine *line);
 void dxf_hatch_pattern_def_line_free_list (DxfHatchPatternDefLine *lines);
-int dxf_hatch_pattern_def_line_get_id_code (DxfHatchPatternDefLine *line);
-DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_set_id_code (DxfHatchPatternDefLine *line, int id_code);
+DxfHandle dxf_hatch_pattern_def_line_get_id_code (DxfHatchPatternDefLine *line);
+DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_set_id_code (DxfHatchPatternDefLine *line, DxfHandle id_code);
 double dxf_hatch_pattern_def_line_get_angle (DxfHatchPatternDefLine *line);
 DxfHatchPatternDefLine *dxf_hatch_pattern_def_line_set_angle (DxfHatchPatternDefLine *line, double angle);
 double dxf_hatch_pattern_def_line_get_x0 (DxfHatchPatternDefLine *line);
@@ -782,8 +706,8 @@ DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_init (DxfHatchPatternSeedP
 int dxf_hatch_pattern_seedpoint_write (DxfFile *fp, DxfHatchPatternSeedPoint *seedpoint);
 int dxf_hatch_pattern_seedpoint_free (DxfHatchPatternSeedPoint *seedpoint);
 void dxf_hatch_pattern_seedpoint_free_list (DxfHatchPatternSeedPoint *hatch_pattern_seed_points);
-int dxf_hatch_pattern_seedpoint_get_id_code (DxfHatchPatternSeedPoint *point);
-DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_set_id_code (DxfHatchPatternSeedPoint *point, int id_code);
+DxfHandle dxf_hatch_pattern_seedpoint_get_id_code (DxfHatchPatternSeedPoint *point);
+DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_set_id_code (DxfHatchPatternSeedPoint *point, DxfHandle id_code);
 double dxf_hatch_pattern_seedpoint_get_x0 (DxfHatchPatternSeedPoint *point);
 DxfHatchPatternSeedPoint *dxf_hatch_pattern_seedpoint_set_x0 (DxfHatchPatternSeedPoint *point, double x0);
 double dxf_hatch_pattern_seedpoint_get_y0 (DxfHatchPatternSeedPoint *point);
@@ -797,10 +721,11 @@ DxfHatchBoundaryPath *dxf_hatch_boundary_path_init (DxfHatchBoundaryPath *path);
 int dxf_hatch_boundary_path_write (DxfFile *fp, DxfHatchBoundaryPath *path);
 int dxf_hatch_boundary_path_free (DxfHatchBoundaryPath *path);
 void dxf_hatch_boundary_path_free_list (DxfHatchBoundaryPath *hatch_boundary_paths);
-int dxf_hatch_boundary_path_get_id_code (DxfHatchBoundaryPath *path);
-DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_id_code (DxfHatchBoundaryPath *path, int id_code);
+DxfHandle dxf_hatch_boundary_path_get_id_code (DxfHatchBoundaryPath *path);
+DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_id_code (DxfHatchBoundaryPath *path, DxfHandle id_code);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_get_edges (DxfHatchBoundaryPath *path);
 DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_edges (DxfHatchBoundaryPath *path, DxfHatchBoundaryPathEdge *edges);
+int dxf_hatch_boundary_path_append_edge (DxfHatchBoundaryPath *path, DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_get_polylines (DxfHatchBoundaryPath *path);
 DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_polylines (DxfHatchBoundaryPath *path, DxfHatchBoundaryPathPolyline *polylines);
 DxfHatchBoundaryPath *dxf_hatch_boundary_path_get_next (DxfHatchBoundaryPath *path);
@@ -812,16 +737,19 @@ DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_init (DxfHatchBou
 int dxf_hatch_boundary_path_polyline_write (DxfFile *fp, DxfHatchBoundaryPathPolyline *polyline);
 int dxf_hatch_boundary_path_polyline_free (DxfHatchBoundaryPathPolyline *polyline);
 void dxf_hatch_boundary_path_polyline_free_list (DxfHatchBoundaryPathPolyline *polylines);
-int dxf_hatch_boundary_path_polyline_get_id_code (DxfHatchBoundaryPathPolyline *polyline);
-DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_id_code (DxfHatchBoundaryPathPolyline *polyline, int id_code);
+DxfHandle dxf_hatch_boundary_path_polyline_get_id_code (DxfHatchBoundaryPathPolyline *polyline);
+DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_id_code (DxfHatchBoundaryPathPolyline *polyline, DxfHandle id_code);
 int16_t dxf_hatch_boundary_path_polyline_get_is_closed (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_is_closed (DxfHatchBoundaryPathPolyline *polyline, int16_t is_closed);
 int32_t dxf_hatch_boundary_path_polyline_get_number_of_vertices (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_number_of_vertices (DxfHatchBoundaryPathPolyline *polyline, int32_t number_of_vertices);
 DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_get_vertices (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_vertices (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolylineVertex *vertices);
+int dxf_hatch_boundary_path_polyline_append_vertex (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolylineVertex *vertex);
 int dxf_hatch_boundary_path_polyline_close_polyline (DxfHatchBoundaryPathPolyline *polyline);
 int dxf_hatch_boundary_path_polyline_point_inside_polyline (DxfHatchBoundaryPathPolyline *polyline, DxfPoint *point);
+DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_single_precision (DxfHatchBoundaryPathPolyline *polyline, double origin_x, double origin_y);
+DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_double_precision (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_get_next (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_next (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolyline *next);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_get_last (DxfHatchBoundaryPathPolyline *polyline);
@@ -831,8 +759,8 @@ DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_init
 int dxf_hatch_boundary_path_polyline_vertex_write (DxfFile *fp, DxfHatchBoundaryPathPolylineVertex *vertex);
 int dxf_hatch_boundary_path_polyline_vertex_free (DxfHatchBoundaryPathPolylineVertex *vertex);
 void dxf_hatch_boundary_path_polyline_vertex_free_list (DxfHatchBoundaryPathPolylineVertex *hatch_boundary_path_polyline_vertices);
-int dxf_hatch_boundary_path_polyline_vertex_get_id_code (DxfHatchBoundaryPathPolylineVertex *vertex);
-DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_set_id_code (DxfHatchBoundaryPathPolylineVertex *vertex, int id_code);
+DxfHandle dxf_hatch_boundary_path_polyline_vertex_get_id_code (DxfHatchBoundaryPathPolylineVertex *vertex);
+DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_set_id_code (DxfHatchBoundaryPathPolylineVertex *vertex, DxfHandle id_code);
 double dxf_hatch_boundary_path_polyline_vertex_get_x0 (DxfHatchBoundaryPathPolylineVertex *vertex);
 DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_set_x0 (DxfHatchBoundaryPathPolylineVertex *vertex, double x0);
 double dxf_hatch_boundary_path_polyline_vertex_get_y0 (DxfHatchBoundaryPathPolylineVertex *vertex);
@@ -850,16 +778,20 @@ DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_new ();
 DxfHatchBoundaryPathEdge * dxf_hatch_boundary_path_edge_init (DxfHatchBoundaryPathEdge *edge);
 int dxf_hatch_boundary_path_edge_free (DxfHatchBoundaryPathEdge *edge);
 void dxf_hatch_boundary_path_edge_free_list (DxfHatchBoundaryPathEdge *edges);
-int dxf_hatch_boundary_path_edge_get_id_code (DxfHatchBoundaryPathEdge *edge);
-DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_id_code (DxfHatchBoundaryPathEdge *edge, int id_code);
+DxfHandle dxf_hatch_boundary_path_edge_get_id_code (DxfHatchBoundaryPathEdge *edge);
+DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_id_code (DxfHatchBoundaryPathEdge *edge, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_get_arcs (DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_arcs (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeArc *arcs);
+int dxf_hatch_boundary_path_edge_append_arc (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_get_ellipses (DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_ellipses (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeEllipse *ellipses);
+int dxf_hatch_boundary_path_edge_append_ellipse (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_get_lines (DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_lines (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeLine *lines);
+int dxf_hatch_boundary_path_edge_append_line (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_get_splines (DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_splines (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeSpline *splines);
+int dxf_hatch_boundary_path_edge_append_spline (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdgeSpline *spline);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_get_next (DxfHatchBoundaryPathEdge *edge);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_set_next (DxfHatchBoundaryPathEdge *edge, DxfHatchBoundaryPathEdge *next);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_get_last (DxfHatchBoundaryPathEdge *edge);
@@ -868,13 +800,13 @@ DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_new ();
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_init (DxfHatchBoundaryPathEdgeArc *arc);
 int dxf_hatch_boundary_path_edge_arc_free (DxfHatchBoundaryPathEdgeArc *arc);
 void dxf_hatch_boundary_path_edge_arc_free_list (DxfHatchBoundaryPathEdgeArc *hatch_boundary_path_edge_arcs);
-int dxf_hatch_boundary_path_edge_arc_get_id_code (DxfHatchBoundaryPathEdgeArc *arc);
-DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_id_code (DxfHatchBoundaryPathEdgeArc *arc, int id_code);
+DxfHandle dxf_hatch_boundary_path_edge_arc_get_id_code (DxfHatchBoundaryPathEdgeArc *arc);
+DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_id_code (DxfHatchBoundaryPathEdgeArc *arc, DxfHandle id_code);
 double dxf_hatch_boundary_path_edge_arc_get_x0 (DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_x0 (DxfHatchBoundaryPathEdgeArc *arc, double x0);
 double dxf_hatch_boundary_path_edge_arc_get_y0 (DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_y0 (DxfHatchBoundaryPathEdgeArc *arc, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_arc_get_center_point (DxfHatchBoundaryPathEdgeArc *arc, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_arc_get_center_point (DxfHatchBoundaryPathEdgeArc *arc, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_center_point (DxfHatchBoundaryPathEdgeArc *arc, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_arc_get_radius (DxfHatchBoundaryPathEdgeArc *arc);
 DxfHatchBoundaryPathEdgeArc *dxf_hatch_boundary_path_edge_arc_set_radius (DxfHatchBoundaryPathEdgeArc *arc, double radius);
@@ -892,19 +824,19 @@ DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_new ();
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_init (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 int dxf_hatch_boundary_path_edge_ellipse_free (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 void dxf_hatch_boundary_path_edge_ellipse_free_list (DxfHatchBoundaryPathEdgeEllipse *hatch_boundary_path_edge_ellipses);
-int dxf_hatch_boundary_path_edge_ellipse_get_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse);
-DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse, int id_code);
+DxfHandle dxf_hatch_boundary_path_edge_ellipse_get_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse);
+DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_id_code (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfHandle id_code);
 double dxf_hatch_boundary_path_edge_ellipse_get_x0 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_x0 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double x0);
 double dxf_hatch_boundary_path_edge_ellipse_get_y0 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_y0 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_center_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_center_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_center_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_ellipse_get_x1 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_x1 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double x1);
 double dxf_hatch_boundary_path_edge_ellipse_get_y1 (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_y1 (DxfHatchBoundaryPathEdgeEllipse *ellipse, double y1);
-DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_end_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_ellipse_get_end_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_end_point (DxfHatchBoundaryPathEdgeEllipse *ellipse, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_ellipse_get_ratio (DxfHatchBoundaryPathEdgeEllipse *ellipse);
 DxfHatchBoundaryPathEdgeEllipse *dxf_hatch_boundary_path_edge_ellipse_set_ratio (DxfHatchBoundaryPathEdgeEllipse *ellipse, double ratio);
@@ -922,19 +854,19 @@ DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_new ();
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_init (DxfHatchBoundaryPathEdgeLine *line);
 int dxf_hatch_boundary_path_edge_line_free (DxfHatchBoundaryPathEdgeLine *line);
 void dxf_hatch_boundary_path_edge_line_free_list (DxfHatchBoundaryPathEdgeLine *hatch_boundary_path_edge_lines);
-int dxf_hatch_boundary_path_edge_line_get_id_code (DxfHatchBoundaryPathEdgeLine *line);
-DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_id_code (DxfHatchBoundaryPathEdgeLine *line, int id_code);
+DxfHandle dxf_hatch_boundary_path_edge_line_get_id_code (DxfHatchBoundaryPathEdgeLine *line);
+DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_id_code (DxfHatchBoundaryPathEdgeLine *line, DxfHandle id_code);
 double dxf_hatch_boundary_path_edge_line_get_x0 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_x0 (DxfHatchBoundaryPathEdgeLine *line, double x0);
 double dxf_hatch_boundary_path_edge_line_get_y0 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_y0 (DxfHatchBoundaryPathEdgeLine *line, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_line_get_start_point (DxfHatchBoundaryPathEdgeLine *line, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_line_get_start_point (DxfHatchBoundaryPathEdgeLine *line, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_start_point (DxfHatchBoundaryPathEdgeLine *line, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_line_get_x1 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_x1 (DxfHatchBoundaryPathEdgeLine *line, double x1);
 double dxf_hatch_boundary_path_edge_line_get_y1 (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_y1 (DxfHatchBoundaryPathEdgeLine *line, double y1);
-DxfPoint *dxf_hatch_boundary_path_edge_line_get_end_point (DxfHatchBoundaryPathEdgeLine *line, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_line_get_end_point (DxfHatchBoundaryPathEdgeLine *line, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_end_point (DxfHatchBoundaryPathEdgeLine *line, DxfPoint *point);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_get_next (DxfHatchBoundaryPathEdgeLine *line);
 DxfHatchBoundaryPathEdgeLine *dxf_hatch_boundary_path_edge_line_set_next (DxfHatchBoundaryPathEdgeLine *line, DxfHatchBoundaryPathEdgeLine *next);
@@ -944,8 +876,8 @@ DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_new ();
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_init (DxfHatchBoundaryPathEdgeSpline *spline);
 int dxf_hatch_boundary_path_edge_spline_free (DxfHatchBoundaryPathEdgeSpline *spline);
 void dxf_hatch_boundary_path_edge_spline_free_list (DxfHatchBoundaryPathEdgeSpline *hatch_boundary_path_edge_splines);
-int dxf_hatch_boundary_path_edge_spline_get_id_code (DxfHatchBoundaryPathEdgeSpline *spline);
-DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_id_code (DxfHatchBoundaryPathEdgeSpline *spline, int id_code);
+DxfHandle dxf_hatch_boundary_path_edge_spline_get_id_code (DxfHatchBoundaryPathEdgeSpline *spline);
+DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_id_code (DxfHatchBoundaryPathEdgeSpline *spline, DxfHandle id_code);
 int32_t dxf_hatch_boundary_path_edge_spline_get_degree (DxfHatchBoundaryPathEdgeSpline *spline);
 DxfHatchBoundaryPathEdgeSpline *dxf_hatch_boundary_path_edge_spline_set_degree (DxfHatchBoundaryPathEdgeSpline *spline, int32_t degree);
 int16_t dxf_hatch_boundary_path_edge_spline_get_rational (DxfHatchBoundaryPathEdgeSpline *spline);
@@ -982,13 +914,13 @@ DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_control_po
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_control_point_init (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 int dxf_hatch_boundary_path_edge_spline_control_point_free (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 void dxf_hatch_boundary_path_edge_spline_control_point_free_list (DxfHatchBoundaryPathEdgeSplineCp *hatch_boundary_path_edge_spline_control_points);
-int dxf_hatch_boundary_path_edge_spline_cp_get_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point);
-DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point, int id_code);
+DxfHandle dxf_hatch_boundary_path_edge_spline_cp_get_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point);
+DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_id_code (DxfHatchBoundaryPathEdgeSplineCp *control_point, DxfHandle id_code);
 double dxf_hatch_boundary_path_edge_spline_cp_get_x0 (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_x0 (DxfHatchBoundaryPathEdgeSplineCp *control_point, double x0);
 double dxf_hatch_boundary_path_edge_spline_cp_get_y0 (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_y0 (DxfHatchBoundaryPathEdgeSplineCp *control_point, double y0);
-DxfPoint *dxf_hatch_boundary_path_edge_spline_cp_get_point (DxfHatchBoundaryPathEdgeSplineCp *control_point, int id_code);
+DxfPoint *dxf_hatch_boundary_path_edge_spline_cp_get_point (DxfHatchBoundaryPathEdgeSplineCp *control_point, DxfHandle id_code);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_point (DxfHatchBoundaryPathEdgeSplineCp *control_point, DxfPoint *point);
 double dxf_hatch_boundary_path_edge_spline_cp_get_weight (DxfHatchBoundaryPathEdgeSplineCp *control_point);
 DxfHatchBoundaryPathEdgeSplineCp *dxf_hatch_boundary_path_edge_spline_cp_set_weight (DxfHatchBoundaryPathEdgeSplineCp *control_point, double weight);
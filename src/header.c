@@ -3251,4 +3251,48 @@ dxf_header_get_dxf_point_variable
         dxf_point_read(fp, res);
 }
 
+/*!
+ * \brief Get the center of the drawing extents (\c $EXTMIN and
+ * \c $EXTMAX) of a DXF header.
+ *
+ * Useful as origin for reading geometry in single precision, see
+ * dxf_read_set_single_precision ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_header_get_extents_center
+(
+        DxfHeader *header,
+                /*!< DXF header. */
+        double *x,
+                /*!< X-coordinate of the center. */
+        double *y,
+                /*!< Y-coordinate of the center. */
+        double *z
+                /*!< Z-coordinate of the center. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((header == NULL) || (x == NULL) || (y == NULL) || (z == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *x = 0.5 * (header->ExtMin.x0 + header->ExtMax.x0);
+        *y = 0.5 * (header->ExtMin.y0 + header->ExtMax.y0);
+        *z = 0.5 * (header->ExtMin.z0 + header->ExtMax.z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
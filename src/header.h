@@ -58,7 +58,7 @@ extern "C" {
 typedef struct
 dxf_header_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -1256,6 +1256,7 @@ int dxf_header_read_parser (DxfFile *fp, DxfHeader *header, char * temp_string,
 int dxf_header_write (DxfFile *fp, DxfHeader *header);
 int dxf_header_write_metric_new (DxfFile *fp);
 DxfHeader *dxf_header_free (DxfHeader *header);
+int dxf_header_get_extents_center (DxfHeader *header, double *x, double *y, double *z);
 
 
 #ifdef __cplusplus
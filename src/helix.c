@@ -38,6 +38,7 @@
 
 
 #include "helix.h"
+#include "entities.h"
 
 
 /*!
@@ -111,37 +112,34 @@ dxf_helix_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        helix->id_code = 0;
-        helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        helix->layer = strdup (DXF_DEFAULT_LAYER);
-        helix->thickness = 0.0;
+        if (dxf_entity_common_init (&helix->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         helix->radius = 0.0;
         helix->number_of_turns = 0.0;
         helix->turn_height = 0.0;
-        helix->linetype_scale = 0.0;
-        helix->visibility = 0;
-        helix->color = DXF_COLOR_BYLAYER;
-        helix->paperspace = DXF_MODELSPACE;
         helix->major_release_number = 0;
         helix->maintainance_release_number = 0;
-        helix->graphics_data_size = 0;
         helix->constraint_type = 0;
-        helix->shadow_mode = 0;
         helix->handedness = 0;
-        helix->dictionary_owner_hard = strdup ("");
-        helix->material = strdup ("");
-        helix->dictionary_owner_soft = strdup ("");
-        helix->lineweight = 0;
-        helix->plot_style_name = strdup ("");
-        helix->color_value = 0;
-        helix->color_name = strdup ("");
-        helix->transparency = 0;
+        helix->p0 = dxf_point_init (dxf_point_new ());
+        helix->p1 = dxf_point_init (dxf_point_new ());
+        helix->p2 = dxf_point_init (dxf_point_new ());
+        if ((helix->p0 == NULL)
+          || (helix->p1 == NULL)
+          || (helix->p2 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        helix->binary_graphics_data = NULL;
-        helix->p0 = NULL;
-        helix->p1 = NULL;
-        helix->p2 = NULL;
         helix->spline = NULL;
         helix->next = NULL;
 #if DEBUG
@@ -175,7 +173,9 @@ dxf_helix_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -183,8 +183,6 @@ dxf_helix_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (helix == NULL)
@@ -192,317 +190,121 @@ dxf_helix_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                helix = dxf_helix_init (helix);
+                helix = dxf_helix_init (dxf_helix_new ());
+                if (helix == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &helix->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis vector point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis vector point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis vector point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->z0);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * radius. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->radius);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * turns. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->number_of_turns);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the turn
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->turn_height);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->linetype_scale);
+                        break;
                 }
-                else if (strcmp (temp_string, "60") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->visibility);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->paperspace);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing a major
-                         * release number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->major_release_number);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing a maintenance
-                         * release number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->maintainance_release_number);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &helix->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbSpline") == 0))
-                        {
-                                helix->spline = dxf_spline_read (fp, helix->spline);
-                        }
-                        else if ((strcmp (temp_string, "AcDbEntity") != 0)
-                                && ((strcmp (temp_string, "AcDbHelix") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing a constraint
-                         * type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->constraint_type);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->shadow_mode);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing a handedness
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &helix->handedness);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) helix->binary_graphics_data->next);
-                        helix->binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a
-                         * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &helix->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &helix->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                helix->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                helix->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                helix->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                helix->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                helix->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                helix->p1->z0 = atof (value);
+                                break;
+                        case 12:
+                                helix->p2->x0 = atof (value);
+                                break;
+                        case 22:
+                                helix->p2->y0 = atof (value);
+                                break;
+                        case 32:
+                                helix->p2->z0 = atof (value);
+                                break;
+                        case 40:
+                                helix->radius = atof (value);
+                                break;
+                        case 41:
+                                helix->number_of_turns = atof (value);
+                                break;
+                        case 42:
+                                helix->turn_height = atof (value);
+                                break;
+                        case 90:
+                                helix->major_release_number = atoi (value);
+                                break;
+                        case 91:
+                                helix->maintainance_release_number = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbSpline") != 0)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbHelix") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 280:
+                                helix->constraint_type = atoi (value);
+                                break;
+                        case 290:
+                                helix->handedness = atoi (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &helix->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (helix->linetype, "") == 0)
+        if ((helix->common.linetype == NULL)
+          || (strcmp (helix->common.linetype, "") == 0))
         {
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (helix->common.linetype);
+                helix->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (helix->layer, "") == 0)
+        if ((helix->common.layer == NULL)
+          || (strcmp (helix->common.layer, "") == 0))
         {
-                helix->layer = strdup (DXF_DEFAULT_LAYER);
+                free (helix->common.layer);
+                helix->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -531,7 +333,6 @@ dxf_helix_write
         char *dxf_entity_name = strdup ("HELIX");
         int i;
         DxfPoint *iter = NULL;
-        DxfBinaryGraphicsData *iter_310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -564,8 +365,8 @@ dxf_helix_write
         if (helix->radius == 0.0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, helix->id_code);
+                  (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, helix->common.id_code);
                 fprintf (stderr, "    skipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
@@ -578,80 +379,78 @@ dxf_helix_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (helix->linetype, "") == 0)
+        if (strcmp (helix->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, helix->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, helix->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                helix->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (helix->layer, "") == 0)
+        if (strcmp (helix->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, helix->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, helix->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                helix->layer = DXF_DEFAULT_LAYER;
+                helix->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (helix->id_code != -1)
+        if (helix->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", helix->id_code);
+                dxf_handle_write (fp, 5, helix->common.id_code);
         }
-        fprintf (fp->fp, "330\n%s\n", helix->dictionary_owner_soft);
+        dxf_handle_write (fp, 330, helix->common.cold->dictionary_owner_soft);
         fprintf (fp->fp, "100\nAcDbEntity\n");
-        if (helix->paperspace != DXF_MODELSPACE)
+        if (helix->common.paperspace != DXF_MODELSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", helix->layer);
-        if (strcmp (helix->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", helix->common.layer);
+        if (strcmp (helix->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", helix->linetype);
+                fprintf (fp->fp, "  6\n%s\n", helix->common.linetype);
         }
-        if (strcmp (helix->material, "") != 0)
+        if (helix->common.cold->material != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "347\n%s\n", helix->material);
+                dxf_handle_write (fp, 347, helix->common.cold->material);
         }
-        if (helix->color != DXF_COLOR_BYLAYER)
+        if (helix->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", helix->color);
+                fprintf (fp->fp, " 62\n%hd\n", helix->common.color);
         }
-        fprintf (fp->fp, "370\n%d\n", helix->lineweight);
-        if (helix->thickness != 0.0)
+        fprintf (fp->fp, "370\n%hd\n", helix->common.lineweight);
+        if (helix->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", helix->thickness);
+                fprintf (fp->fp, " 39\n%f\n", helix->common.thickness);
         }
-        if (helix->linetype_scale != 1.0)
+        if (helix->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", helix->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", helix->common.linetype_scale);
         }
-        if (helix->visibility != 0)
+        if (helix->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", helix->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", helix->common.visibility);
         }
 #ifdef BUILD_64
-        fprintf (fp->fp, "160\n%" PRIi32 "\n", helix->graphics_data_size);
+        fprintf (fp->fp, "160\n%" PRIi32 "\n", helix->common.cold->graphics_data_size);
 #else
-        fprintf (fp->fp, " 92\n%" PRIi32 "\n", helix->graphics_data_size);
+        fprintf (fp->fp, " 92\n%" PRIi32 "\n", helix->common.cold->graphics_data_size);
 #endif
-        iter_310 = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
-        while (iter_310 != NULL)
+        if (helix->common.cold->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
-                iter_310 = (DxfBinaryGraphicsData *) iter_310->next;
+                dxf_binary_buffer_write (fp, 310, helix->common.cold->binary_graphics_data);
         }
-        fprintf (fp->fp, "420\n%" PRIi32 "\n", helix->color_value);
-        fprintf (fp->fp, "430\n%s\n", helix->color_name);
-        fprintf (fp->fp, "440\n%" PRIi32 "\n", helix->transparency);
-        fprintf (fp->fp, "390\n%s\n", helix->plot_style_name);
-        fprintf (fp->fp, "284\n%hd\n", helix->shadow_mode);
+        fprintf (fp->fp, "420\n%" PRIi32 "\n", helix->common.color_value);
+        fprintf (fp->fp, "430\n%s\n", helix->common.cold->color_name);
+        fprintf (fp->fp, "440\n%" PRIi32 "\n", helix->common.cold->transparency);
+        dxf_handle_write (fp, 390, helix->common.cold->plot_style_name);
+        fprintf (fp->fp, "284\n%hd\n", helix->common.cold->shadow_mode);
         /* Write a spline to a DxfFile. */
         helix->spline->flag = 0;
         helix->spline->degree = 3;
@@ -669,18 +468,13 @@ dxf_helix_write
         fprintf (fp->fp, " 13\n%f\n", helix->spline->p3->x0);
         fprintf (fp->fp, " 23\n%f\n", helix->spline->p3->y0);
         fprintf (fp->fp, " 33\n%f\n", helix->spline->p3->z0);
-        for (i = 0; i < helix->spline->number_of_knots; i++)
+        for (i = 0; i < (int) helix->spline->knot_value->length; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", helix->spline->knot_value->value);
-                /*! \todo implement as a single linked list of double. */
+                fprintf (fp->fp, " 40\n%f\n", helix->spline->knot_value->values[i]);
         }
-        if (helix->spline->number_of_fit_points != 0)
+        for (i = 0; i < (int) helix->spline->weight_value->length; i++)
         {
-                for (i = 0; i < helix->spline->number_of_fit_points; i++)
-                {
-                        fprintf (fp->fp, " 41\n%f\n", helix->spline->weight_value->value);
-                        /*! \todo implement as a single linked list of double. */
-                }
+                fprintf (fp->fp, " 41\n%f\n", helix->spline->weight_value->values[i]);
         }
         iter = (DxfPoint *) helix->spline->p0;
         while (iter != NULL)
@@ -716,6 +510,7 @@ dxf_helix_write
         fprintf (fp->fp, " 42\n%f\n", helix->turn_height);
         fprintf (fp->fp, "290\n%d\n", helix->handedness);
         fprintf (fp->fp, "280\n%hd\n", helix->constraint_type);
+        dxf_entity_common_write_xdata (fp, &helix->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -758,14 +553,7 @@ dxf_helix_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (helix->linetype);
-        free (helix->layer);
-        dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) helix->binary_graphics_data);
-        free (helix->dictionary_owner_hard);
-        free (helix->material);
-        free (helix->dictionary_owner_soft);
-        free (helix->plot_style_name);
-        free (helix->color_name);
+        dxf_entity_common_free (&helix->common);
         dxf_point_free (helix->p0);
         dxf_point_free (helix->p1);
         dxf_point_free (helix->p2);
@@ -802,6 +590,7 @@ dxf_helix_free_list
         while (helices != NULL)
         {
                 DxfHelix *iter = (DxfHelix *) helices->next;
+                helices->next = NULL;
                 dxf_helix_free (helices);
                 helices = (DxfHelix *) iter;
         }
@@ -811,13 +600,99 @@ dxf_helix_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c HELIX entity.
+ *
+ * The copy does not share any memory with \c helix, its \c next
+ * member is \c NULL.\n
+ * The spline is not owned by the helix, the copy refers to the
+ * same spline.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfHelix *
+dxf_helix_copy
+(
+        DxfHelix *helix
+                /*!< a pointer to the DXF \c HELIX entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHelix *copy;
+
+        /* Do some basic checks. */
+        if (helix == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_helix_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, helix, sizeof (DxfHelix));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &helix->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_helix_free (copy);
+                return (NULL);
+        }
+        if (helix->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (helix->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_helix_free (copy);
+                        return (NULL);
+                }
+        }
+        if (helix->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (helix->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_helix_free (copy);
+                        return (NULL);
+                }
+        }
+        if (helix->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (helix->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_helix_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c HELIX entity.
  *
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_helix_get_id_code
 (
         DxfHelix *helix
@@ -835,16 +710,10 @@ dxf_helix_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->id_code);
+        return (helix->common.id_code);
 }
 
 
@@ -859,7 +728,7 @@ dxf_helix_set_id_code
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -876,13 +745,7 @@ dxf_helix_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        helix->id_code = id_code;
+        helix->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -913,7 +776,7 @@ dxf_helix_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->linetype ==  NULL)
+        if (helix->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -923,7 +786,7 @@ dxf_helix_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->linetype));
+        return (strdup (helix->common.linetype));
 }
 
 
@@ -960,7 +823,7 @@ dxf_helix_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->linetype = strdup (linetype);
+        helix->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -991,7 +854,7 @@ dxf_helix_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->layer ==  NULL)
+        if (helix->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1001,7 +864,7 @@ dxf_helix_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->layer));
+        return (strdup (helix->common.layer));
 }
 
 
@@ -1038,7 +901,7 @@ dxf_helix_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->layer = strdup (layer);
+        helix->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1070,7 +933,7 @@ dxf_helix_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->thickness < 0.0)
+        if (helix->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1079,7 +942,7 @@ dxf_helix_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->thickness);
+        return (helix->common.thickness);
 }
 
 
@@ -1115,7 +978,7 @@ dxf_helix_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        helix->thickness = thickness;
+        helix->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1147,7 +1010,7 @@ dxf_helix_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->linetype_scale < 0.0)
+        if (helix->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1156,7 +1019,7 @@ dxf_helix_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->linetype_scale);
+        return (helix->common.linetype_scale);
 }
 
 
@@ -1192,7 +1055,7 @@ dxf_helix_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        helix->linetype_scale = linetype_scale;
+        helix->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1224,13 +1087,13 @@ dxf_helix_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->visibility < 0)
+        if (helix->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (helix->visibility > 1)
+        if (helix->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1239,7 +1102,7 @@ dxf_helix_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->visibility);
+        return (helix->common.visibility);
 }
 
 
@@ -1281,7 +1144,7 @@ dxf_helix_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        helix->visibility = visibility;
+        helix->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1313,7 +1176,7 @@ dxf_helix_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->color < 0)
+        if (helix->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1322,7 +1185,7 @@ dxf_helix_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->color);
+        return (helix->common.color);
 }
 
 
@@ -1360,7 +1223,7 @@ dxf_helix_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        helix->color = color;
+        helix->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1392,13 +1255,13 @@ dxf_helix_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->paperspace < 0)
+        if (helix->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (helix->paperspace > 1)
+        if (helix->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1407,7 +1270,7 @@ dxf_helix_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->paperspace);
+        return (helix->common.paperspace);
 }
 
 
@@ -1450,7 +1313,7 @@ dxf_helix_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        helix->paperspace = paperspace;
+        helix->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1482,13 +1345,13 @@ dxf_helix_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->graphics_data_size < 0)
+        if (helix->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (helix->graphics_data_size == 0)
+        if (helix->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1497,7 +1360,7 @@ dxf_helix_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->graphics_data_size);
+        return (helix->common.cold->graphics_data_size);
 }
 
 
@@ -1540,7 +1403,7 @@ dxf_helix_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        helix->graphics_data_size = graphics_data_size;
+        helix->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1572,13 +1435,13 @@ dxf_helix_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (helix->shadow_mode < 0)
+        if (helix->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (helix->shadow_mode > 3)
+        if (helix->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1587,7 +1450,7 @@ dxf_helix_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->shadow_mode);
+        return (helix->common.cold->shadow_mode);
 }
 
 
@@ -1629,7 +1492,7 @@ dxf_helix_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        helix->shadow_mode = shadow_mode;
+        helix->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1638,14 +1501,15 @@ dxf_helix_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c HELIX entity.
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_helix_get_binary_graphics_data
 (
         DxfHelix *helix
@@ -1663,24 +1527,20 @@ dxf_helix_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) helix->binary_graphics_data);
+        return (helix->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c HELIX entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c helix when successful, or \c NULL when an
  * error occurred.
  */
@@ -1689,9 +1549,9 @@ dxf_helix_set_binary_graphics_data
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1712,7 +1572,12 @@ dxf_helix_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((helix->common.cold->binary_graphics_data != NULL)
+          && (helix->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (helix->common.cold->binary_graphics_data);
+        }
+        helix->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1747,17 +1612,10 @@ dxf_helix_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_soft));
+        return (dxf_handle_to_string (helix->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1796,7 +1654,7 @@ dxf_helix_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        helix->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1830,17 +1688,10 @@ dxf_helix_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->object_owner_soft));
+        return (dxf_handle_to_string (helix->common.cold->object_owner_soft));
 }
 
 
@@ -1876,7 +1727,7 @@ dxf_helix_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->object_owner_soft = strdup (object_owner_soft);
+        helix->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1910,17 +1761,10 @@ dxf_helix_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->material));
+        return (dxf_handle_to_string (helix->common.cold->material));
 }
 
 
@@ -1958,7 +1802,7 @@ dxf_helix_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->material = strdup (material);
+        helix->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1993,17 +1837,10 @@ dxf_helix_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_hard));
+        return (dxf_handle_to_string (helix->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2042,7 +1879,7 @@ dxf_helix_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        helix->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2077,7 +1914,7 @@ dxf_helix_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->lineweight);
+        return (helix->common.lineweight);
 }
 
 
@@ -2107,7 +1944,7 @@ dxf_helix_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->lineweight = lineweight;
+        helix->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2139,17 +1976,10 @@ dxf_helix_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->plot_style_name));
+        return (dxf_handle_to_string (helix->common.cold->plot_style_name));
 }
 
 
@@ -2187,7 +2017,7 @@ dxf_helix_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->plot_style_name = strdup (plot_style_name);
+        helix->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2222,7 +2052,7 @@ dxf_helix_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->color_value);
+        return (helix->common.color_value);
 }
 
 
@@ -2252,7 +2082,7 @@ dxf_helix_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->color_value = color_value;
+        helix->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2284,7 +2114,7 @@ dxf_helix_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->color_name ==  NULL)
+        if (helix->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2294,7 +2124,7 @@ dxf_helix_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->color_name));
+        return (strdup (helix->common.cold->color_name));
 }
 
 
@@ -2332,7 +2162,7 @@ dxf_helix_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->color_name = strdup (color_name);
+        helix->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2367,7 +2197,7 @@ dxf_helix_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->transparency);
+        return (helix->common.cold->transparency);
 }
 
 
@@ -2397,7 +2227,7 @@ dxf_helix_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->transparency = transparency;
+        helix->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
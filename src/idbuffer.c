@@ -116,9 +116,9 @@ dxf_idbuffer_init
         }
         /* Assign initial values to members. */
         idbuffer->id_code = 0;
-        idbuffer->dictionary_owner_soft = strdup ("");
-        idbuffer->object_owner_soft = strdup ("");
-        idbuffer->dictionary_owner_hard = strdup ("");
+        idbuffer->dictionary_owner_soft = DXF_HANDLE_NONE;
+        idbuffer->object_owner_soft = DXF_HANDLE_NONE;
+        idbuffer->dictionary_owner_hard = DXF_HANDLE_NONE;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         idbuffer->entity_pointer = NULL;
@@ -202,8 +202,7 @@ dxf_idbuffer_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &idbuffer->id_code);
+                        idbuffer->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "100") == 0)
                 {
@@ -225,16 +224,14 @@ dxf_idbuffer_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->dictionary_owner_soft);
+                                idbuffer->dictionary_owner_soft = dxf_handle_read (fp);
                                 i++;
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->object_owner_soft);
+                                idbuffer->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -243,8 +240,7 @@ dxf_idbuffer_read
                 {
                         /* Now follows a string containing a Soft
                          * pointer reference to entity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, entity_pointer->soft_pointer);
+                        entity_pointer->soft_pointer = dxf_handle_read (fp);
                         dxf_idbuffer_entity_pointer_init ((DxfIdbufferEntityPointer *) entity_pointer->next);
                         entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
                 }
@@ -252,8 +248,7 @@ dxf_idbuffer_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->dictionary_owner_hard);
+                        idbuffer->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -321,14 +316,14 @@ dxf_idbuffer_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_idbuffer_get_id_code (idbuffer));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_idbuffer_get_id_code (idbuffer) != -1)
+        if (dxf_idbuffer_get_id_code (idbuffer) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_idbuffer_get_id_code (idbuffer));
+                dxf_handle_write (fp, 5, dxf_idbuffer_get_id_code (idbuffer));
         }
         /*!
          * \todo for version R14.\n
@@ -340,34 +335,34 @@ dxf_idbuffer_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (idbuffer->dictionary_owner_soft, "") != 0)
+        if ((idbuffer->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_idbuffer_get_dictionary_owner_soft (idbuffer));
+                dxf_handle_write (fp, 330, idbuffer->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (idbuffer->dictionary_owner_hard, "") != 0)
+        if ((idbuffer->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_idbuffer_get_dictionary_owner_hard (idbuffer));
+                dxf_handle_write (fp, 360, idbuffer->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (idbuffer->object_owner_soft, "") != 0)
+        if ((idbuffer->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", idbuffer->object_owner_soft);
+                dxf_handle_write (fp, 330, idbuffer->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbIdBuffer\n");
         }
         entity_pointer = (DxfIdbufferEntityPointer *) dxf_idbuffer_get_entity_pointer (idbuffer);
-        while (idbuffer->entity_pointer != NULL)
+        while (entity_pointer != NULL)
         {
-                fprintf (fp->fp, "330\n%s\n", dxf_idbuffer_entity_pointer_get_soft_pointer (dxf_idbuffer_get_entity_pointer (idbuffer)));
-                entity_pointer = dxf_idbuffer_entity_pointer_get_next (dxf_idbuffer_get_entity_pointer (idbuffer));
+                dxf_handle_write (fp, 330, entity_pointer->soft_pointer);
+                entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -411,9 +406,6 @@ dxf_idbuffer_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (idbuffer->dictionary_owner_soft);
-        free (idbuffer->object_owner_soft);
-        free (idbuffer->dictionary_owner_hard);
         dxf_idbuffer_entity_pointer_free_list ((DxfIdbufferEntityPointer *) idbuffer->entity_pointer);
         free (idbuffer);
         idbuffer = NULL;
@@ -447,7 +439,8 @@ dxf_idbuffer_free_list
         }
         while (id_buffers != NULL)
         {
-                DxfIdbuffer *iter = (DxfIdbuffer *) dxf_idbuffer_get_next (id_buffers);
+                DxfIdbuffer *iter = (DxfIdbuffer *) id_buffers->next;
+                id_buffers->next = NULL;
                 dxf_idbuffer_free (id_buffers);
                 id_buffers = (DxfIdbuffer *) iter;
         }
@@ -463,7 +456,7 @@ dxf_idbuffer_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_idbuffer_get_id_code
 (
         DxfIdbuffer *idbuffer
@@ -481,12 +474,6 @@ dxf_idbuffer_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (idbuffer->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -505,7 +492,7 @@ dxf_idbuffer_set_id_code
 (
         DxfIdbuffer *idbuffer,
                 /*!< a pointer to a DXF \c IDBUFFER. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -522,12 +509,6 @@ dxf_idbuffer_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         idbuffer->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -563,17 +544,10 @@ dxf_idbuffer_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (idbuffer->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_soft));
+        return (dxf_handle_to_string (idbuffer->dictionary_owner_soft));
 }
 
 
@@ -612,7 +586,7 @@ dxf_idbuffer_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        idbuffer->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -646,17 +620,10 @@ dxf_idbuffer_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (idbuffer->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->object_owner_soft));
+        return (dxf_handle_to_string (idbuffer->object_owner_soft));
 }
 
 
@@ -692,7 +659,7 @@ dxf_idbuffer_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->object_owner_soft = strdup (object_owner_soft);
+        idbuffer->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -727,17 +694,10 @@ dxf_idbuffer_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (idbuffer->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_hard));
+        return (dxf_handle_to_string (idbuffer->dictionary_owner_hard));
 }
 
 
@@ -776,7 +736,7 @@ dxf_idbuffer_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        idbuffer->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1061,7 +1021,7 @@ dxf_idbuffer_entity_pointer_init
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup ("");
+        entity_pointer->soft_pointer = DXF_HANDLE_NONE;
         entity_pointer->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1103,7 +1063,6 @@ dxf_idbuffer_entity_pointer_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (entity_pointer->soft_pointer);
         free (entity_pointer);
         entity_pointer = NULL;
 #if DEBUG
@@ -1137,6 +1096,7 @@ dxf_idbuffer_entity_pointer_free_list
         while (entity_pointers != NULL)
         {
                 DxfIdbufferEntityPointer *iter = (DxfIdbufferEntityPointer *) entity_pointers->next;
+                entity_pointers->next = NULL;
                 dxf_idbuffer_entity_pointer_free (entity_pointers);
                 entity_pointers = (DxfIdbufferEntityPointer *) iter;
         }
@@ -1173,17 +1133,10 @@ dxf_idbuffer_entity_pointer_get_soft_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (entity_pointer->soft_pointer ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (entity_pointer->soft_pointer));
+        return (dxf_handle_to_string (entity_pointer->soft_pointer));
 }
 
 
@@ -1222,7 +1175,7 @@ dxf_idbuffer_entity_pointer_set_soft_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup (soft_pointer);
+        entity_pointer->soft_pointer = dxf_handle_parse (soft_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -49,6 +49,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -62,7 +63,7 @@ extern "C" {
 typedef struct
 dxf_idbuffer_entity_pointer_struct
 {
-        char *soft_pointer;
+        DxfHandle soft_pointer;
                 /*!< Soft pointer reference to entity (multiple entries
                  * may exist).\n
                  * Group code = 330. */
@@ -79,19 +80,19 @@ typedef struct
 dxf_idbuffer_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF idbuffer. */
@@ -112,8 +113,8 @@ DxfIdbuffer *dxf_idbuffer_read (DxfFile *fp, DxfIdbuffer *idbuffer);
 int dxf_idbuffer_write (DxfFile *fp, DxfIdbuffer *idbuffer);
 int dxf_idbuffer_free (DxfIdbuffer *idbuffer);
 void dxf_idbuffer_free_list (DxfIdbuffer *id_buffers);
-int dxf_idbuffer_get_id_code (DxfIdbuffer *idbuffer);
-DxfIdbuffer *dxf_idbuffer_set_id_code (DxfIdbuffer *idbuffer, int id_code);
+DxfHandle dxf_idbuffer_get_id_code (DxfIdbuffer *idbuffer);
+DxfIdbuffer *dxf_idbuffer_set_id_code (DxfIdbuffer *idbuffer, DxfHandle id_code);
 char *dxf_idbuffer_get_dictionary_owner_soft (DxfIdbuffer *idbuffer);
 DxfIdbuffer *dxf_idbuffer_set_dictionary_owner_soft (DxfIdbuffer *idbuffer, char *dictionary_owner_soft);
 char *dxf_idbuffer_get_object_owner_soft (DxfIdbuffer *idbuffer);
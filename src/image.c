@@ -46,6 +46,7 @@
 
 
 #include "image.h"
+#include "entities.h"
 
 
 /*!
@@ -119,25 +120,13 @@ dxf_image_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        image->id_code = 0;
-        image->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        image->layer = strdup (DXF_DEFAULT_LAYER);
-        image->elevation = 0.0;
-        image->thickness = 0.0;
-        image->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        image->visibility = DXF_DEFAULT_VISIBILITY;
-        image->color = DXF_COLOR_BYLAYER;
-        image->paperspace = DXF_MODELSPACE;
-        image->graphics_data_size = 0;
-        image->shadow_mode = 0;
-        image->dictionary_owner_soft = strdup ("");
-        image->material = strdup ("");
-        image->dictionary_owner_hard = strdup ("");
-        image->lineweight = 0;
-        image->plot_style_name = strdup ("");
-        image->color_value = 0;
-        image->color_name = strdup ("");
-        image->transparency = 0;
+        if (dxf_entity_common_init (&image->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         image->image_display_properties = 0;
         image->clipping_boundary_type = 0;
         image->class_version = 0;
@@ -146,16 +135,25 @@ dxf_image_init
         image->brightness = 50;
         image->contrast = 50;
         image->fade = 50;
-        image->imagedef_object = strdup ("");
-        image->imagedef_reactor_object = strdup ("");
+        image->imagedef_object = DXF_HANDLE_NONE;
+        image->imagedef_reactor_object = DXF_HANDLE_NONE;
+        image->p0 = dxf_point_init (dxf_point_new ());
+        image->p1 = dxf_point_init (dxf_point_new ());
+        image->p2 = dxf_point_init (dxf_point_new ());
+        image->p3 = dxf_point_init (dxf_point_new ());
+        if ((image->p0 == NULL)
+          || (image->p1 == NULL)
+          || (image->p2 == NULL)
+          || (image->p3 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        image->p0 = NULL;
-        image->p1 = NULL;
-        image->p2 = NULL;
-        image->p3 = NULL;
         image->p4 = NULL;
-        image->binary_graphics_data = NULL;
         image->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -187,12 +185,12 @@ dxf_image_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfPoint *iter = NULL;
-        int next_x4;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
-        int iter360;
+        DxfPoint *vertex = NULL;
+        int iter360 = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -200,8 +198,6 @@ dxf_image_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (image == NULL)
@@ -209,399 +205,172 @@ dxf_image_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                image = dxf_image_init (image);
-        }
-        iter = (DxfPoint *) image->p4;
-        next_x4 = 0;
-        iter310 = (DxfBinaryData *) image->binary_graphics_data;
-        iter330 = 0;
-        iter360 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+                image = dxf_image_init (dxf_image_new ());
+                if (image == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &image->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the insertion point coordinate. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the insertion point coordinate. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the insertion point coordinate. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the U-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the U-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the U-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p1->z0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the V-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the V-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the V-vector of a single pixel. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * U-value of image size in pixels. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * V-value of image size in pixels. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->p3->y0);
-                }
-                else if (strcmp (temp_string, "14") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of a clip boundary vertex. */
-                        (fp->line_number)++;
-                        if (next_x4)
-                        {
-                                iter->next = (struct DxfPoint *) dxf_point_init ((DxfPoint *) iter->next);
-                                iter = (DxfPoint *) iter->next;
-                                next_x4 = 0;
-                        }
-                        fscanf (fp->fp, "%lf\n", &iter->x0);
-                }
-                else if (strcmp (temp_string, "24") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of a clip boundary vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->y0);
-                        next_x4 = 1;
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (image->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &image->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * image display properties. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->image_display_properties);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * clipping boundary type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->clipping_boundary_type);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the class
-                         * version. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->class_version);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * clip boundary vertices. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->number_of_clip_boundary_vertices);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbRasterImage") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &image->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing the clipping
-                         * state. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->clipping_state);
-                }
-                else if (strcmp (temp_string, "281") == 0)
-                {
-                        /* Now follows a string containing the
-                         * brightness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->brightness);
-                }
-                else if (strcmp (temp_string, "282") == 0)
-                {
-                        /* Now follows a string containing the contrast
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->contrast);
-                }
-                else if (strcmp (temp_string, "283") == 0)
-                {
-                        /* Now follows a string containing the fade
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->fade);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a hard
-                         * reference to imagedef object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->imagedef_object);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        if (iter360 == 0)
-                        {
-                                /* Now follows a string containing a hard-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->dictionary_owner_hard);
-                        }
-                        if (iter360 == 1)
-                        {
-                                /* Now follows a string containing a hard
-                                 * reference to imagedef_reactor object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->imagedef_reactor_object);
-                        }
-                        iter360++;
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &image->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
+        }
+        for (;;)
+        {
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &image->transparency);
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                image->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                image->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                image->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                image->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                image->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                image->p1->z0 = atof (value);
+                                break;
+                        case 12:
+                                image->p2->x0 = atof (value);
+                                break;
+                        case 22:
+                                image->p2->y0 = atof (value);
+                                break;
+                        case 32:
+                                image->p2->z0 = atof (value);
+                                break;
+                        case 13:
+                                image->p3->x0 = atof (value);
+                                break;
+                        case 23:
+                                image->p3->y0 = atof (value);
+                                break;
+                        case 14:
+                                /* Every X-value starts a new clip
+                                 * boundary vertex. */
+                                vertex = dxf_point_init (dxf_point_new ());
+                                if (vertex == NULL)
+                                {
+                                        break;
+                                }
+                                vertex->x0 = atof (value);
+                                if (iter == NULL)
+                                {
+                                        image->p4 = vertex;
+                                }
+                                else
+                                {
+                                        iter->next = (struct DxfPoint *) vertex;
+                                }
+                                iter = vertex;
+                                break;
+                        case 24:
+                                if (iter != NULL)
+                                {
+                                        iter->y0 = atof (value);
+                                }
+                                break;
+                        case 70:
+                                image->image_display_properties = atoi (value);
+                                break;
+                        case 71:
+                                image->clipping_boundary_type = atoi (value);
+                                break;
+                        case 90:
+                                image->class_version = atoi (value);
+                                break;
+                        case 91:
+                                image->number_of_clip_boundary_vertices = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbRasterImage") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 280:
+                                image->clipping_state = atoi (value);
+                                break;
+                        case 281:
+                                image->brightness = atoi (value);
+                                break;
+                        case 282:
+                                image->contrast = atoi (value);
+                                break;
+                        case 283:
+                                image->fade = atoi (value);
+                                break;
+                        case 340:
+                                image->imagedef_object = dxf_handle_parse (value);
+                                break;
+                        case 360:
+                                /* The first one is the owner dictionary,
+                                 * the second one the image definition
+                                 * reactor. */
+                                if (iter360 == 0)
+                                {
+                                        image->common.cold->dictionary_owner_hard = dxf_handle_parse (value);
+                                }
+                                else
+                                {
+                                        image->imagedef_reactor_object = dxf_handle_parse (value);
+                                }
+                                iter360++;
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &image->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (image->linetype, "") == 0)
+        if ((image->common.linetype == NULL)
+          || (strcmp (image->common.linetype, "") == 0))
         {
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (image->common.linetype);
+                image->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (image->layer, "") == 0)
+        if ((image->common.layer == NULL)
+          || (strcmp (image->common.layer, "") == 0))
         {
-                image->layer = strdup (DXF_DEFAULT_LAYER);
+                free (image->common.layer);
+                image->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -655,31 +424,31 @@ dxf_image_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (image->linetype, "") == 0)
+        if (strcmp (image->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, image->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, image->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                image->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (image->layer, "") == 0)
+        if (strcmp (image->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, image->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, image->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                image->layer = strdup (DXF_DEFAULT_LAYER);
+                image->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (image->id_code != -1)
+        if (image->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", image->id_code);
+                dxf_handle_write (fp, 5, image->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -691,100 +460,94 @@ dxf_image_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (image->dictionary_owner_soft, "") != 0)
+        if ((image->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", image->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, image->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (image->dictionary_owner_hard, "") != 0)
+        if ((image->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", image->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, image->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (image->object_owner_soft, "") != 0)
+        if ((image->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", image->object_owner_soft);
+                dxf_handle_write (fp, 330, image->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (image->paperspace == DXF_PAPERSPACE)
+        if (image->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", image->layer);
-        if (strcmp (image->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", image->common.layer);
+        if (strcmp (image->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", image->linetype);
+                fprintf (fp->fp, "  6\n%s\n", image->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (image->material, "") != 0))
+          && (image->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", image->material);
+                dxf_handle_write (fp, 347, image->common.cold->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (image->elevation != 0.0))
+          && (image->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", image->elevation);
+                fprintf (fp->fp, " 38\n%f\n", image->common.elevation);
         }
-        if (image->color != DXF_COLOR_BYLAYER)
+        if (image->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", image->color);
+                fprintf (fp->fp, " 62\n%hd\n", image->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", image->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", image->common.lineweight);
         }
-        if (image->linetype_scale != 1.0)
+        if (image->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", image->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", image->common.linetype_scale);
         }
-        if (image->visibility != 0)
+        if (image->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", image->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", image->common.visibility);
         }        if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", image->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", image->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", image->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", image->common.cold->graphics_data_size);
 #endif
-                if (image->binary_graphics_data != NULL)
+                if (image->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) image->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, image->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", image->color_value);
-                fprintf (fp->fp, "430\n%s\n", image->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", image->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", image->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", image->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", image->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", image->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", image->shadow_mode);
+                dxf_handle_write (fp, 390, image->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", image->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbRasterImage\n");
         }
-        if (image->thickness != 0.0)
+        if (image->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", image->thickness);
+                fprintf (fp->fp, " 39\n%f\n", image->common.thickness);
         }
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", image->class_version);
         fprintf (fp->fp, " 10\n%f\n", image->p0->x0);
@@ -798,13 +561,13 @@ dxf_image_write
         fprintf (fp->fp, " 32\n%f\n", image->p2->z0);
         fprintf (fp->fp, " 13\n%f\n", image->p3->x0);
         fprintf (fp->fp, " 23\n%f\n", image->p3->y0);
-        fprintf (fp->fp, "340\n%s\n", image->imagedef_object);
+        dxf_handle_write (fp, 340, image->imagedef_object);
         fprintf (fp->fp, " 70\n%hd\n", image->image_display_properties);
         fprintf (fp->fp, "280\n%hd\n", image->clipping_state);
         fprintf (fp->fp, "281\n%hd\n", image->brightness);
         fprintf (fp->fp, "282\n%hd\n", image->contrast);
         fprintf (fp->fp, "283\n%hd\n", image->fade);
-        fprintf (fp->fp, "360\n%s\n", image->imagedef_reactor_object);
+        dxf_handle_write (fp, 360, image->imagedef_reactor_object);
         fprintf (fp->fp, " 71\n%hd\n", image->clipping_boundary_type);
         fprintf (fp->fp, " 91\n%" PRIi32 "\n", image->number_of_clip_boundary_vertices);
         /* Now follows a sinle linked list of points (vertices).
@@ -817,6 +580,7 @@ dxf_image_write
                 fprintf (fp->fp, " 24\n%f\n", iter->y0);
                 iter = (DxfPoint *) iter->next;
         }
+        dxf_entity_common_write_xdata (fp, &image->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -859,22 +623,15 @@ dxf_image_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (image->linetype);
-        free (image->layer);
-        dxf_binary_data_free_list (image->binary_graphics_data);
-        free (image->dictionary_owner_soft);
-        free (image->material);
-        free (image->dictionary_owner_hard);
-        free (image->object_owner_soft);
-        free (image->plot_style_name);
-        free (image->color_name);
+        dxf_entity_common_free (&image->common);
         dxf_point_free (image->p0);
         dxf_point_free (image->p1);
         dxf_point_free (image->p2);
         dxf_point_free (image->p3);
-        dxf_point_free_list (image->p4);
-        free (image->imagedef_object);
-        free (image->imagedef_reactor_object);
+        if (image->p4 != NULL)
+        {
+                dxf_point_free_list (image->p4);
+        }
         free (image);
         image = NULL;
 #if DEBUG
@@ -908,6 +665,7 @@ dxf_image_free_list
         while (images != NULL)
         {
                 DxfImage *iter = (DxfImage *) images->next;
+                images->next = NULL;
                 dxf_image_free (images);
                 images = (DxfImage *) iter;
         }
@@ -917,13 +675,117 @@ dxf_image_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c IMAGE entity.
+ *
+ * The copy does not share any memory with \c image, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfImage *
+dxf_image_copy
+(
+        DxfImage *image
+                /*!< a pointer to the DXF \c IMAGE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfImage *copy;
+
+        /* Do some basic checks. */
+        if (image == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_image_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, image, sizeof (DxfImage));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->p4 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &image->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_image_free (copy);
+                return (NULL);
+        }
+        if (image->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (image->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_image_free (copy);
+                        return (NULL);
+                }
+        }
+        if (image->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (image->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_image_free (copy);
+                        return (NULL);
+                }
+        }
+        if (image->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (image->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_image_free (copy);
+                        return (NULL);
+                }
+        }
+        if (image->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (image->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_image_free (copy);
+                        return (NULL);
+                }
+        }
+        if (image->p4 != NULL)
+        {
+                copy->p4 = dxf_point_copy_list (image->p4);
+                if (copy->p4 == NULL)
+                {
+                        dxf_image_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c IMAGE entity.
  *
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_image_get_id_code
 (
         DxfImage *image
@@ -941,16 +803,10 @@ dxf_image_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->id_code);
+        return (image->common.id_code);
 }
 
 
@@ -965,7 +821,7 @@ dxf_image_set_id_code
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -982,13 +838,7 @@ dxf_image_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        image->id_code = id_code;
+        image->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1019,7 +869,7 @@ dxf_image_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->linetype ==  NULL)
+        if (image->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1029,7 +879,7 @@ dxf_image_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->linetype));
+        return (strdup (image->common.linetype));
 }
 
 
@@ -1066,7 +916,7 @@ dxf_image_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        image->linetype = strdup (linetype);
+        image->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1097,7 +947,7 @@ dxf_image_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->layer ==  NULL)
+        if (image->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1107,7 +957,7 @@ dxf_image_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->layer));
+        return (strdup (image->common.layer));
 }
 
 
@@ -1144,7 +994,7 @@ dxf_image_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        image->layer = strdup (layer);
+        image->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1179,7 +1029,7 @@ dxf_image_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->elevation);
+        return (image->common.elevation);
 }
 
 
@@ -1209,7 +1059,7 @@ dxf_image_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        image->elevation = elevation;
+        image->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1241,7 +1091,7 @@ dxf_image_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->thickness < 0.0)
+        if (image->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1250,7 +1100,7 @@ dxf_image_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->thickness);
+        return (image->common.thickness);
 }
 
 
@@ -1286,7 +1136,7 @@ dxf_image_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        image->thickness = thickness;
+        image->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1318,7 +1168,7 @@ dxf_image_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->linetype_scale < 0.0)
+        if (image->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1327,7 +1177,7 @@ dxf_image_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->linetype_scale);
+        return (image->common.linetype_scale);
 }
 
 
@@ -1363,7 +1213,7 @@ dxf_image_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        image->linetype_scale = linetype_scale;
+        image->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1395,13 +1245,13 @@ dxf_image_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->visibility < 0)
+        if (image->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (image->visibility > 1)
+        if (image->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1410,7 +1260,7 @@ dxf_image_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->visibility);
+        return (image->common.visibility);
 }
 
 
@@ -1452,7 +1302,7 @@ dxf_image_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        image->visibility = visibility;
+        image->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1484,7 +1334,7 @@ dxf_image_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->color < 0)
+        if (image->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1493,7 +1343,7 @@ dxf_image_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->color);
+        return (image->common.color);
 }
 
 
@@ -1531,7 +1381,7 @@ dxf_image_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        image->color = color;
+        image->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1563,13 +1413,13 @@ dxf_image_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->paperspace < 0)
+        if (image->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (image->paperspace > 1)
+        if (image->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1578,7 +1428,7 @@ dxf_image_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->paperspace);
+        return (image->common.paperspace);
 }
 
 
@@ -1621,7 +1471,7 @@ dxf_image_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        image->paperspace = paperspace;
+        image->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1654,13 +1504,13 @@ dxf_image_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->graphics_data_size < 0)
+        if (image->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (image->graphics_data_size == 0)
+        if (image->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1669,7 +1519,7 @@ dxf_image_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->graphics_data_size);
+        return (image->common.cold->graphics_data_size);
 }
 
 
@@ -1712,7 +1562,7 @@ dxf_image_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        image->graphics_data_size = graphics_data_size;
+        image->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1744,13 +1594,13 @@ dxf_image_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (image->shadow_mode < 0)
+        if (image->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (image->shadow_mode > 3)
+        if (image->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1759,7 +1609,7 @@ dxf_image_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->shadow_mode);
+        return (image->common.cold->shadow_mode);
 }
 
 
@@ -1801,7 +1651,7 @@ dxf_image_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        image->shadow_mode = shadow_mode;
+        image->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1810,15 +1660,15 @@ dxf_image_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the \c binary_graphics_data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c IMAGE entity.
  *
- * \return a pointer to the \c binary_graphics_data when successful, or
- * \c NULL when an error occurred.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_image_get_binary_graphics_data
 (
         DxfImage *image
@@ -1836,17 +1686,10 @@ dxf_image_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) image->binary_graphics_data);
+        return (image->common.cold->binary_graphics_data);
 }
 
 
@@ -1854,6 +1697,9 @@ dxf_image_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c IMAGE entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c image when successful, or \c NULL when an
  * error occurred.
  */
@@ -1862,9 +1708,9 @@ dxf_image_set_binary_graphics_data
 (
         DxfImage *image,
                 /*!< a pointer to a DXF \c IMAGE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1885,7 +1731,12 @@ dxf_image_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        image->binary_graphics_data = (DxfBinaryData *) data;
+        if ((image->common.cold->binary_graphics_data != NULL)
+          && (image->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (image->common.cold->binary_graphics_data);
+        }
+        image->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1920,17 +1771,10 @@ dxf_image_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->dictionary_owner_soft));
+        return (dxf_handle_to_string (image->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1969,7 +1813,7 @@ dxf_image_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        image->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        image->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2003,17 +1847,10 @@ dxf_image_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->object_owner_soft));
+        return (dxf_handle_to_string (image->common.cold->object_owner_soft));
 }
 
 
@@ -2049,7 +1886,7 @@ dxf_image_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        image->object_owner_soft = strdup (object_owner_soft);
+        image->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2083,17 +1920,10 @@ dxf_image_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->material));
+        return (dxf_handle_to_string (image->common.cold->material));
 }
 
 
@@ -2131,7 +1961,7 @@ dxf_image_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        image->material = strdup (material);
+        image->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2166,17 +1996,10 @@ dxf_image_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->dictionary_owner_hard));
+        return (dxf_handle_to_string (image->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2215,7 +2038,7 @@ dxf_image_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        image->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        image->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2250,7 +2073,7 @@ dxf_image_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->lineweight);
+        return (image->common.lineweight);
 }
 
 
@@ -2280,7 +2103,7 @@ dxf_image_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        image->lineweight = lineweight;
+        image->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2312,17 +2135,10 @@ dxf_image_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->plot_style_name));
+        return (dxf_handle_to_string (image->common.cold->plot_style_name));
 }
 
 
@@ -2360,7 +2176,7 @@ dxf_image_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        image->plot_style_name = strdup (plot_style_name);
+        image->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2395,7 +2211,7 @@ dxf_image_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->color_value);
+        return (image->common.color_value);
 }
 
 
@@ -2425,7 +2241,7 @@ dxf_image_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        image->color_value = color_value;
+        image->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2457,7 +2273,7 @@ dxf_image_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->color_name ==  NULL)
+        if (image->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2467,7 +2283,7 @@ dxf_image_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->color_name));
+        return (strdup (image->common.cold->color_name));
 }
 
 
@@ -2505,7 +2321,7 @@ dxf_image_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        image->color_name = strdup (color_name);
+        image->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2540,7 +2356,7 @@ dxf_image_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (image->transparency);
+        return (image->common.cold->transparency);
 }
 
 
@@ -2570,7 +2386,7 @@ dxf_image_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        image->transparency = transparency;
+        image->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4740,17 +4556,10 @@ dxf_image_get_imagedef_object
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->imagedef_object ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->imagedef_object));
+        return (dxf_handle_to_string (image->imagedef_object));
 }
 
 
@@ -4788,7 +4597,7 @@ dxf_image_set_imagedef_object
                   __FUNCTION__);
                 return (NULL);
         }
-        image->imagedef_object = strdup (imagedef_object);
+        image->imagedef_object = dxf_handle_parse (imagedef_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4820,17 +4629,10 @@ dxf_image_get_imagedef_reactor_object
                   __FUNCTION__);
                 return (NULL);
         }
-        if (image->imagedef_reactor_object ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (image->imagedef_reactor_object));
+        return (dxf_handle_to_string (image->imagedef_reactor_object));
 }
 
 
@@ -4868,7 +4670,7 @@ dxf_image_set_imagedef_reactor_object
                   __FUNCTION__);
                 return (NULL);
         }
-        image->imagedef_reactor_object = strdup (imagedef_reactor_object);
+        image->imagedef_reactor_object = dxf_handle_parse (imagedef_reactor_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
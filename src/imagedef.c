@@ -115,13 +115,13 @@ dxf_imagedef_init
         }
         /* Assign initial values to members. */
         imagedef->id_code = 0;
-        imagedef->dictionary_owner_soft = strdup ("");
-        imagedef->dictionary_owner_hard = strdup ("");
+        imagedef->dictionary_owner_soft = DXF_HANDLE_NONE;
+        imagedef->dictionary_owner_hard = DXF_HANDLE_NONE;
         imagedef->file_name = strdup ("");
         imagedef->class_version = 0;
         imagedef->image_is_loaded_flag = 0;
         imagedef->resolution_units = 0;
-        imagedef->acad_image_dict_soft = strdup ("");
+        imagedef->acad_image_dict_soft = DXF_HANDLE_NONE;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         imagedef->p0 = NULL;
@@ -223,8 +223,7 @@ dxf_imagedef_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &imagedef->id_code);
+                        imagedef->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -296,8 +295,7 @@ dxf_imagedef_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->dictionary_owner_soft);
+                        imagedef->dictionary_owner_soft = dxf_handle_read (fp);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -305,8 +303,7 @@ dxf_imagedef_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->acad_image_dict_soft);
+                        imagedef->acad_image_dict_soft = dxf_handle_read (fp);
                         i++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -315,16 +312,14 @@ dxf_imagedef_read
                 {
                         /* Now follows a string containing a Soft
                          * pointer reference to entity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->imagedef_reactor_soft[i]);
+                        imagedef->imagedef_reactor_soft[i] = dxf_handle_read (fp);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef->dictionary_owner_hard);
+                        imagedef->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -409,14 +404,14 @@ dxf_imagedef_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, imagedef->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (imagedef->id_code != -1)
+        if (imagedef->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", imagedef->id_code);
+                dxf_handle_write (fp, 5, imagedef->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -428,29 +423,29 @@ dxf_imagedef_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (imagedef->dictionary_owner_soft, "") != 0)
+        if ((imagedef->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", imagedef->dictionary_owner_soft);
-                fprintf (fp->fp, "330\n%s\n", imagedef->acad_image_dict_soft);
+                dxf_handle_write (fp, 330, imagedef->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, imagedef->acad_image_dict_soft);
                 if (imagedef->imagedef_reactor != NULL)
                 {
                         DxfImagedefReactor *iter;
                         iter = imagedef->imagedef_reactor;
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "330\n%s\n", dxf_imagedef_reactor_get_associated_image_object (iter));
+                                dxf_handle_write (fp, 330, iter->associated_image_object);
                                 iter = (DxfImagedefReactor *) dxf_imagedef_reactor_get_next (iter);
                         }
                 }
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (imagedef->dictionary_owner_hard, "") != 0)
+        if ((imagedef->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", imagedef->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, imagedef->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -492,8 +487,6 @@ dxf_imagedef_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
@@ -509,14 +502,7 @@ dxf_imagedef_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (imagedef->dictionary_owner_soft);
-        free (imagedef->dictionary_owner_hard);
         free (imagedef->file_name);
-        free (imagedef->acad_image_dict_soft);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                free (imagedef->imagedef_reactor_soft[i]);
-        }
         free (imagedef);
         imagedef = NULL;
 #if DEBUG
@@ -550,6 +536,7 @@ dxf_imagedef_free_list
         while (imagedefs != NULL)
         {
                 DxfImagedef *iter = (DxfImagedef *) imagedefs->next;
+                imagedefs->next = NULL;
                 dxf_imagedef_free (imagedefs);
                 imagedefs = (DxfImagedef *) iter;
         }
@@ -565,7 +552,7 @@ dxf_imagedef_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_imagedef_get_id_code
 (
         DxfImagedef *imagedef
@@ -583,12 +570,6 @@ dxf_imagedef_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (imagedef->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -607,7 +588,7 @@ dxf_imagedef_set_id_code
 (
         DxfImagedef *imagedef,
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -624,12 +605,6 @@ dxf_imagedef_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         imagedef->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -665,17 +640,10 @@ dxf_imagedef_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (imagedef->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_soft));
+        return (dxf_handle_to_string (imagedef->dictionary_owner_soft));
 }
 
 
@@ -714,7 +682,7 @@ dxf_imagedef_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -749,17 +717,10 @@ dxf_imagedef_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (imagedef->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_hard));
+        return (dxf_handle_to_string (imagedef->dictionary_owner_hard));
 }
 
 
@@ -798,7 +759,7 @@ dxf_imagedef_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1699,17 +1660,10 @@ dxf_imagedef_get_acad_image_dict_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (imagedef->acad_image_dict_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->acad_image_dict_soft));
+        return (dxf_handle_to_string (imagedef->acad_image_dict_soft));
 }
 
 
@@ -1748,7 +1702,7 @@ dxf_imagedef_set_acad_image_dict_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->acad_image_dict_soft = strdup (acad_image_dict_soft);
+        imagedef->acad_image_dict_soft = dxf_handle_parse (acad_image_dict_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
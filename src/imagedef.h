@@ -48,6 +48,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "point.h"
 #include "imagedef_reactor.h"
 
@@ -64,15 +65,15 @@ typedef struct
 dxf_imagedef_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF imagedef. */
@@ -106,11 +107,11 @@ dxf_imagedef_struct
                  * <li value = "5"> Inch.</li>
                  * </ol>
                  * Group code = 281. */
-        char *acad_image_dict_soft;
+        DxfHandle acad_image_dict_soft;
                 /*!< Soft-pointer ID/handle to the ACAD_IMAGE_DICT
                  * dictionary.\n
                  * Group code = 330. */
-        char *imagedef_reactor_soft[DXF_MAX_PARAM];
+        DxfHandle imagedef_reactor_soft[DXF_MAX_PARAM];
                 /*!< Soft-pointer ID/handle to IMAGEDEF_REACTOR object
                  * (multiple entries; one for each instance).\n
                  * Group code = 330. */
@@ -131,8 +132,8 @@ DxfImagedef *dxf_imagedef_read (DxfFile *fp, DxfImagedef *imagedef);
 int dxf_imagedef_write (DxfFile *fp, DxfImagedef *imagedef);
 int dxf_imagedef_free (DxfImagedef *imagedef);
 void dxf_imagedef_free_list (DxfImagedef *imagedefs);
-int dxf_imagedef_get_id_code (DxfImagedef *imagedef);
-DxfImagedef *dxf_imagedef_set_id_code (DxfImagedef *imagedef, int id_code);
+DxfHandle dxf_imagedef_get_id_code (DxfImagedef *imagedef);
+DxfImagedef *dxf_imagedef_set_id_code (DxfImagedef *imagedef, DxfHandle id_code);
 char *dxf_imagedef_get_dictionary_owner_soft (DxfImagedef *imagedef);
 DxfImagedef *dxf_imagedef_set_dictionary_owner_soft (DxfImagedef *imagedef, char *dictionary_owner_soft);
 char *dxf_imagedef_get_dictionary_owner_hard (DxfImagedef *imagedef);
@@ -115,10 +115,10 @@ dxf_imagedef_reactor_init
                 return (NULL);
         }
         imagedef_reactor->id_code = 0;
-        imagedef_reactor->dictionary_owner_soft = strdup ("");
-        imagedef_reactor->dictionary_owner_hard = strdup ("");
+        imagedef_reactor->dictionary_owner_soft = DXF_HANDLE_NONE;
+        imagedef_reactor->dictionary_owner_hard = DXF_HANDLE_NONE;
         imagedef_reactor->class_version = 2;
-        imagedef_reactor->associated_image_object = strdup ("");
+        imagedef_reactor->associated_image_object = DXF_HANDLE_NONE;
         imagedef_reactor->associated_image_object_length = 0;
         imagedef_reactor->next = NULL;
 #if DEBUG
@@ -197,8 +197,7 @@ dxf_imagedef_reactor_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &imagedef_reactor->id_code);
+                        imagedef_reactor->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "90") == 0)
                 {
@@ -226,8 +225,7 @@ dxf_imagedef_reactor_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef_reactor->dictionary_owner_soft);
+                        imagedef_reactor->dictionary_owner_soft = dxf_handle_read (fp);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -235,16 +233,14 @@ dxf_imagedef_reactor_read
                 {
                         /* Now follows a string containing object ID for
                          * associated image object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef_reactor->associated_image_object);
+                        imagedef_reactor->associated_image_object = dxf_handle_read (fp);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, imagedef_reactor->dictionary_owner_hard);
+                        imagedef_reactor->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -312,7 +308,7 @@ dxf_imagedef_reactor_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, imagedef_reactor->id_code);
         }
         if (fp->acad_version_number == AutoCAD_14)
@@ -321,9 +317,9 @@ dxf_imagedef_reactor_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (imagedef_reactor->id_code != -1)
+        if (imagedef_reactor->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", imagedef_reactor->id_code);
+                dxf_handle_write (fp, 5, imagedef_reactor->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -335,18 +331,18 @@ dxf_imagedef_reactor_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (imagedef_reactor->dictionary_owner_soft, "") != 0)
+        if ((imagedef_reactor->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", imagedef_reactor->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, imagedef_reactor->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (imagedef_reactor->dictionary_owner_hard, "") != 0)
+        if ((imagedef_reactor->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", imagedef_reactor->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, imagedef_reactor->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -354,7 +350,7 @@ dxf_imagedef_reactor_write
                 fprintf (fp->fp, "100\nAcDbRasterImageDefReactor\n");
         }
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", imagedef_reactor->class_version);
-        fprintf (fp->fp, "330\n%s\n", imagedef_reactor->associated_image_object);
+        dxf_handle_write (fp, 330, imagedef_reactor->associated_image_object);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -397,9 +393,6 @@ dxf_imagedef_reactor_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (imagedef_reactor->dictionary_owner_soft);
-        free (imagedef_reactor->dictionary_owner_hard);
-        free (imagedef_reactor->associated_image_object);
         free (imagedef_reactor);
         imagedef_reactor = NULL;
 #if DEBUG
@@ -433,6 +426,7 @@ dxf_imagedef_reactor_free_list
         while (imagedef_reactors != NULL)
         {
                 DxfImagedefReactor *iter = (DxfImagedefReactor *) imagedef_reactors->next;
+                imagedef_reactors->next = NULL;
                 dxf_imagedef_reactor_free (imagedef_reactors);
                 imagedef_reactors = (DxfImagedefReactor *) iter;
         }
@@ -448,7 +442,7 @@ dxf_imagedef_reactor_free_list
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_imagedef_reactor_get_id_code
 (
         DxfImagedefReactor *imagedef_reactor
@@ -466,13 +460,6 @@ dxf_imagedef_reactor_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (imagedef_reactor->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found in the id_code member.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -491,7 +478,7 @@ dxf_imagedef_reactor_set_id_code
 (
         DxfImagedefReactor *imagedef_reactor,
                 /*!< a pointer to a DXF \c IMAGEDEF_REACTOR object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -508,13 +495,6 @@ dxf_imagedef_reactor_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         imagedef_reactor->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -550,17 +530,10 @@ dxf_imagedef_reactor_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (imagedef_reactor->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_soft));
+        return (dxf_handle_to_string (imagedef_reactor->dictionary_owner_soft));
 }
 
 
@@ -599,7 +572,7 @@ dxf_imagedef_reactor_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef_reactor->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -634,17 +607,10 @@ dxf_imagedef_reactor_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (imagedef_reactor->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_hard));
+        return (dxf_handle_to_string (imagedef_reactor->dictionary_owner_hard));
 }
 
 
@@ -683,7 +649,7 @@ dxf_imagedef_reactor_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef_reactor->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -811,17 +777,10 @@ dxf_imagedef_reactor_get_associated_image_object
                   __FUNCTION__);
                 return (NULL);
         }
-        if (imagedef_reactor->associated_image_object ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the associated_image_object member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->associated_image_object));
+        return (dxf_handle_to_string (imagedef_reactor->associated_image_object));
 }
 
 
@@ -860,7 +819,7 @@ dxf_imagedef_reactor_set_associated_image_object
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->associated_image_object = strdup (associated_image_object);
+        imagedef_reactor->associated_image_object = dxf_handle_parse (associated_image_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
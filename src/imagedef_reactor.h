@@ -49,6 +49,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -64,15 +65,15 @@ typedef struct
 dxf_imagedef_reactor_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF imagedef_reactor. */
@@ -80,7 +81,7 @@ dxf_imagedef_reactor_struct
                 /*!< Class version.\n
                  * 2 = R14 version.\n
                  * Group code = 90. */
-        char *associated_image_object;
+        DxfHandle associated_image_object;
                 /*!< Object ID for associated image object.\n
                  * Group code = 330. */
         int associated_image_object_length;
@@ -97,8 +98,8 @@ DxfImagedefReactor *dxf_imagedef_reactor_read (DxfFile *fp, DxfImagedefReactor *
 int dxf_imagedef_reactor_write (DxfFile *fp, DxfImagedefReactor *imagedef_reactor);
 int dxf_imagedef_reactor_free (DxfImagedefReactor *imagedef_reactor);
 void dxf_imagedef_reactor_free_list (DxfImagedefReactor *imagedef_reactors);
-int dxf_imagedef_reactor_get_id_code (DxfImagedefReactor *imagedef_reactor);
-DxfImagedefReactor *dxf_imagedef_reactor_set_id_code (DxfImagedefReactor *imagedef_reactor, int id_code);
+DxfHandle dxf_imagedef_reactor_get_id_code (DxfImagedefReactor *imagedef_reactor);
+DxfImagedefReactor *dxf_imagedef_reactor_set_id_code (DxfImagedefReactor *imagedef_reactor, DxfHandle id_code);
 char *dxf_imagedef_reactor_get_dictionary_owner_soft (DxfImagedefReactor *imagedef_reactor);
 DxfImagedefReactor *dxf_imagedef_reactor_set_dictionary_owner_soft (DxfImagedefReactor *imagedef_reactor, char *dictionary_owner_soft);
 char *dxf_imagedef_reactor_get_dictionary_owner_hard (DxfImagedefReactor *imagedef_reactor);
@@ -45,6 +45,7 @@
 
 
 #include "insert.h"
+#include "entities.h"
 
 
 /*!
@@ -113,27 +114,13 @@ dxf_insert_init
                 __FUNCTION__);
               return (NULL);
         }
-        insert->id_code = 0;
-        insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        insert->layer = strdup (DXF_DEFAULT_LAYER);
-        insert->elevation = 0.0;
-        insert->thickness = 0.0;
-        insert->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        insert->visibility = DXF_DEFAULT_VISIBILITY;
-        insert->color = DXF_COLOR_BYLAYER;
-        insert->paperspace = DXF_MODELSPACE;
-        insert->graphics_data_size = 0;
-        insert->shadow_mode = 0;
-        insert->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        insert->binary_graphics_data = dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_insert_get_binary_graphics_data (insert));
-        insert->dictionary_owner_soft = strdup ("");
-        insert->material = strdup ("");
-        insert->dictionary_owner_hard = strdup ("");
-        insert->lineweight = 0.0;
-        insert->plot_style_name = strdup ("");
-        insert->color_value = 0;
-        insert->color_name = strdup ("");
-        insert->transparency = 0;
+        if (dxf_entity_common_init (&insert->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         insert->block_name = strdup ("");
         insert->p0 = dxf_point_new ();
         insert->p0 = (DxfPoint *) dxf_point_init (insert->p0);
@@ -152,6 +139,7 @@ dxf_insert_init
         insert->extr_x0 = 0.0;
         insert->extr_y0 = 0.0;
         insert->extr_z0 = 0.0;
+        insert->attributes = NULL;
         insert->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -183,7 +171,9 @@ dxf_insert_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -191,8 +181,6 @@ dxf_insert_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (insert == NULL)
@@ -200,257 +188,122 @@ dxf_insert_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                insert = dxf_insert_init (insert);
+                insert = dxf_insert_init (dxf_insert_new ());
+                if (insert == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a block name
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->block_name);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &insert->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (insert->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->thickness);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative Y-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rel_y_scale);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative Z-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rel_z_scale);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->column_spacing);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the
-                         * row spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->row_spacing);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->rot_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &insert->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->color);
-                }
-                else if (strcmp (temp_string, "66") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attributes follow flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->attributes_follow);
-                        /*!
-                         * \todo After a set attributes_follow flag is
-                         * detected, parsing of following entities should
-                         * be implemented until the end of sequence
-                         * marker (\c SEQEND) is encountered. */
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * number of columns. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->columns);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * number of rows. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &insert->rows);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbBlockReference") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &insert->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->dictionary_owner_soft);
+                        break;
                 }
-                else if (strcmp (temp_string, "360") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->dictionary_owner_hard);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 2:
+                                free (insert->block_name);
+                                insert->block_name = strdup (value);
+                                break;
+                        case 10:
+                                insert->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                insert->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                insert->p0->z0 = atof (value);
+                                break;
+                        case 41:
+                                insert->rel_x_scale = atof (value);
+                                break;
+                        case 42:
+                                insert->rel_y_scale = atof (value);
+                                break;
+                        case 43:
+                                insert->rel_z_scale = atof (value);
+                                break;
+                        case 44:
+                                insert->column_spacing = atof (value);
+                                break;
+                        case 45:
+                                insert->row_spacing = atof (value);
+                                break;
+                        case 50:
+                                insert->rot_angle = atof (value);
+                                break;
+                        case 66:
+                                insert->attributes_follow = atoi (value);
+                                break;
+                        case 70:
+                                insert->columns = atoi (value);
+                                break;
+                        case 71:
+                                insert->rows = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbBlockReference") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                insert->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                insert->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                insert->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &insert->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (insert->linetype, "") == 0)
+        if ((insert->common.linetype == NULL)
+          || (strcmp (insert->common.linetype, "") == 0))
         {
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (insert->common.linetype);
+                insert->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (insert->layer, "") == 0)
+        if ((insert->common.layer == NULL)
+          || (strcmp (insert->common.layer, "") == 0))
         {
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                free (insert->common.layer);
+                insert->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -497,31 +350,31 @@ dxf_insert_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (insert->linetype, "") == 0)
+        if (strcmp (insert->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                insert->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (insert->layer, "") == 0)
+        if (strcmp (insert->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                insert->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (insert->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -530,8 +383,8 @@ dxf_insert_write
         if (insert->rel_y_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative Y-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () relative Y-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault relative Y-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -540,8 +393,8 @@ dxf_insert_write
         if (insert->rel_z_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative Z-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () relative Z-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault relative Z-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -551,8 +404,8 @@ dxf_insert_write
           && (insert->column_spacing == 0.0))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () number of columns is greater than 1 and the column spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () number of columns is greater than 1 and the column spacing has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault number of columns value of 1 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -562,8 +415,8 @@ dxf_insert_write
           && (insert->row_spacing == 0.0))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () number of rows is greater than 1 and the row spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, insert->id_code);
+                  (_("Warning in %s () number of rows is greater than 1 and the row spacing has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, insert->common.id_code);
                 fprintf (stderr,
                   (_("\tdefault number of rows value of 1 applied to %s entity.\n")),
                   dxf_entity_name);
@@ -571,9 +424,9 @@ dxf_insert_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (insert->id_code != -1)
+        if (insert->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", insert->id_code);
+                dxf_handle_write (fp, 5, insert->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -585,54 +438,54 @@ dxf_insert_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (insert->dictionary_owner_soft, "") != 0)
+        if ((insert->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", insert->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, insert->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (insert->dictionary_owner_hard, "") != 0)
+        if ((insert->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", insert->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, insert->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (insert->paperspace == DXF_PAPERSPACE)
+        if (insert->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", insert->layer);
-        if (strcmp (insert->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", insert->common.layer);
+        if (strcmp (insert->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", insert->linetype);
+                fprintf (fp->fp, "  6\n%s\n", insert->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (insert->elevation != 0.0))
+          && (insert->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", insert->elevation);
+                fprintf (fp->fp, " 38\n%f\n", insert->common.elevation);
         }
-        if (insert->thickness != 0.0)
+        if (insert->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", insert->thickness);
+                fprintf (fp->fp, " 39\n%f\n", insert->common.thickness);
         }
-        if (insert->color!= DXF_COLOR_BYLAYER)
+        if (insert->common.color!= DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", insert->color);
+                fprintf (fp->fp, " 62\n%hd\n", insert->common.color);
         }
-        if (insert->linetype_scale != 1.0)
+        if (insert->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", insert->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", insert->common.linetype_scale);
         }
-        if (insert->visibility != 0)
+        if (insert->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", insert->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", insert->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -691,6 +544,7 @@ dxf_insert_write
                 fprintf (fp->fp, "220\n%f\n", insert->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", insert->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &insert->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -733,14 +587,12 @@ dxf_insert_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (insert->linetype);
-        free (insert->layer);
-        dxf_binary_graphics_data_free_list (insert->binary_graphics_data);
-        free (insert->dictionary_owner_soft);
-        free (insert->material);
-        free (insert->dictionary_owner_hard);
-        free (insert->plot_style_name);
-        free (insert->color_name);
+        dxf_entity_common_free (&insert->common);
+        dxf_point_free (insert->p0);
+        if (insert->attributes != NULL)
+        {
+                dxf_attrib_free_list (insert->attributes);
+        }
         free (insert->block_name);
         free (insert);
         insert = NULL;
@@ -775,6 +627,7 @@ dxf_insert_free_list
         while (inserts != NULL)
         {
                 DxfInsert *iter = (DxfInsert *) inserts->next;
+                inserts->next = NULL;
                 dxf_insert_free (inserts);
                 inserts = (DxfInsert *) iter;
         }
@@ -784,12 +637,117 @@ dxf_insert_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c INSERT entity.
+ *
+ * The copy does not share any memory with \c insert, its \c next
+ * member is \c NULL.\n
+ * The \c ATTRIB entities following the \c INSERT are copied too.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfInsert *
+dxf_insert_copy
+(
+        DxfInsert *insert
+                /*!< a pointer to the DXF \c INSERT entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInsert *copy;
+        DxfAttrib *attrib;
+        DxfAttrib *iter;
+        DxfAttrib *last = NULL;
+
+        /* Do some basic checks. */
+        if (insert == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_insert_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, insert, sizeof (DxfInsert));
+        copy->block_name = NULL;
+        copy->p0 = NULL;
+        copy->attributes = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &insert->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_insert_free (copy);
+                return (NULL);
+        }
+        if (insert->block_name != NULL)
+        {
+                copy->block_name = strdup (insert->block_name);
+                if (copy->block_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_insert_free (copy);
+                        return (NULL);
+                }
+        }
+        if (insert->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (insert->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_insert_free (copy);
+                        return (NULL);
+                }
+        }
+        if (insert->attributes != NULL)
+        {
+                for (iter = insert->attributes;
+                  iter != NULL;
+                  iter = (DxfAttrib *) iter->next)
+                {
+                        attrib = dxf_attrib_copy (iter);
+                        if (attrib == NULL)
+                        {
+                                dxf_insert_free (copy);
+                                return (NULL);
+                        }
+                        if (last == NULL)
+                        {
+                                copy->attributes = attrib;
+                        }
+                        else
+                        {
+                                last->next = (struct DxfAttrib *) attrib;
+                        }
+                        last = attrib;
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c INSERT entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_insert_get_id_code
 (
         DxfInsert *insert
@@ -807,17 +765,10 @@ dxf_insert_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->id_code);
+        return (insert->common.id_code);
 }
 
 
@@ -829,7 +780,7 @@ dxf_insert_set_id_code
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -846,14 +797,7 @@ dxf_insert_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        insert->id_code = id_code;
+        insert->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -884,7 +828,7 @@ dxf_insert_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->linetype ==  NULL)
+        if (insert->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -894,7 +838,7 @@ dxf_insert_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->linetype));
+        return (strdup (insert->common.linetype));
 }
 
 
@@ -928,7 +872,7 @@ dxf_insert_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->linetype = strdup (linetype);
+        insert->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -959,7 +903,7 @@ dxf_insert_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->layer ==  NULL)
+        if (insert->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -969,7 +913,7 @@ dxf_insert_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->layer));
+        return (strdup (insert->common.layer));
 }
 
 
@@ -1003,7 +947,7 @@ dxf_insert_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->layer = strdup (layer);
+        insert->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1037,7 +981,7 @@ dxf_insert_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->elevation);
+        return (insert->common.elevation);
 }
 
 
@@ -1064,7 +1008,7 @@ dxf_insert_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->elevation = elevation;
+        insert->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1095,7 +1039,7 @@ dxf_insert_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->thickness < 0.0)
+        if (insert->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1105,7 +1049,7 @@ dxf_insert_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->thickness);
+        return (insert->common.thickness);
 }
 
 
@@ -1139,7 +1083,7 @@ dxf_insert_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->thickness = thickness;
+        insert->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1170,7 +1114,7 @@ dxf_insert_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->linetype_scale < 0.0)
+        if (insert->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1180,7 +1124,7 @@ dxf_insert_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->linetype_scale);
+        return (insert->common.linetype_scale);
 }
 
 
@@ -1214,7 +1158,7 @@ dxf_insert_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->linetype_scale = linetype_scale;
+        insert->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1245,14 +1189,14 @@ dxf_insert_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->visibility < 0)
+        if (insert->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->visibility > 1)
+        if (insert->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1262,7 +1206,7 @@ dxf_insert_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->visibility);
+        return (insert->common.visibility);
 }
 
 
@@ -1303,7 +1247,7 @@ dxf_insert_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->visibility = visibility;
+        insert->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1334,7 +1278,7 @@ dxf_insert_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->color < 0)
+        if (insert->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1343,7 +1287,7 @@ dxf_insert_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->color);
+        return (insert->common.color);
 }
 
 
@@ -1378,7 +1322,7 @@ dxf_insert_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        insert->color = color;
+        insert->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1409,13 +1353,13 @@ dxf_insert_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->paperspace < 0)
+        if (insert->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (insert->paperspace > 1)
+        if (insert->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1424,7 +1368,7 @@ dxf_insert_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->paperspace);
+        return (insert->common.paperspace);
 }
 
 
@@ -1465,7 +1409,7 @@ dxf_insert_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->paperspace = paperspace;
+        insert->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1498,13 +1442,13 @@ dxf_insert_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->graphics_data_size < 0)
+        if (insert->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (insert->graphics_data_size == 0)
+        if (insert->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1513,7 +1457,7 @@ dxf_insert_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->graphics_data_size);
+        return (insert->common.cold->graphics_data_size);
 }
 
 
@@ -1558,7 +1502,7 @@ dxf_insert_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        insert->graphics_data_size = graphics_data_size;
+        insert->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1590,14 +1534,14 @@ dxf_insert_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->shadow_mode < 0)
+        if (insert->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (insert->shadow_mode > 3)
+        if (insert->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1607,7 +1551,7 @@ dxf_insert_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->shadow_mode);
+        return (insert->common.cold->shadow_mode);
 }
 
 
@@ -1651,7 +1595,7 @@ dxf_insert_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->shadow_mode = shadow_mode;
+        insert->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1663,11 +1607,12 @@ dxf_insert_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c INSERT entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_insert_get_binary_graphics_data
 (
         DxfInsert *insert
@@ -1685,32 +1630,31 @@ dxf_insert_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) insert->binary_graphics_data);
+        return (insert->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c INSERT entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c insert when successful, or \c NULL when an
+ * error occurred.
  */
 DxfInsert *
 dxf_insert_set_binary_graphics_data
 (
         DxfInsert *insert,
                 /*!< a pointer to a DXF \c INSERT entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1731,7 +1675,12 @@ dxf_insert_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((insert->common.cold->binary_graphics_data != NULL)
+          && (insert->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (insert->common.cold->binary_graphics_data);
+        }
+        insert->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1765,17 +1714,10 @@ dxf_insert_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->dictionary_owner_soft));
+        return (dxf_handle_to_string (insert->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1811,7 +1753,7 @@ dxf_insert_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        insert->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1845,17 +1787,10 @@ dxf_insert_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->material));
+        return (dxf_handle_to_string (insert->common.cold->material));
 }
 
 
@@ -1893,7 +1828,7 @@ dxf_insert_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->material = strdup (material);
+        insert->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1927,17 +1862,10 @@ dxf_insert_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->dictionary_owner_hard));
+        return (dxf_handle_to_string (insert->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1973,7 +1901,7 @@ dxf_insert_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        insert->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2008,7 +1936,7 @@ dxf_insert_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->lineweight);
+        return (insert->common.lineweight);
 }
 
 
@@ -2038,7 +1966,7 @@ dxf_insert_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->lineweight = lineweight;
+        insert->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2070,17 +1998,10 @@ dxf_insert_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->plot_style_name));
+        return (dxf_handle_to_string (insert->common.cold->plot_style_name));
 }
 
 
@@ -2118,7 +2039,7 @@ dxf_insert_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->plot_style_name = strdup (plot_style_name);
+        insert->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2153,7 +2074,7 @@ dxf_insert_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->color_value);
+        return (insert->common.color_value);
 }
 
 
@@ -2183,7 +2104,7 @@ dxf_insert_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->color_value = color_value;
+        insert->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2215,7 +2136,7 @@ dxf_insert_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (insert->color_name ==  NULL)
+        if (insert->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2225,7 +2146,7 @@ dxf_insert_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (insert->color_name));
+        return (strdup (insert->common.cold->color_name));
 }
 
 
@@ -2263,7 +2184,7 @@ dxf_insert_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->color_name = strdup (color_name);
+        insert->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2298,7 +2219,7 @@ dxf_insert_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (insert->transparency);
+        return (insert->common.cold->transparency);
 }
 
 
@@ -2328,7 +2249,7 @@ dxf_insert_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        insert->transparency = transparency;
+        insert->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3753,6 +3674,72 @@ dxf_insert_set_extrusion_vector
 }
 
 
+/*!
+ * \brief Get the pointer to the first \c ATTRIB entity following a DXF
+ * \c INSERT entity.
+ *
+ * \return pointer to the first \c ATTRIB entity, or \c NULL when no
+ * attributes were read with the insert.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+DxfAttrib *
+dxf_insert_get_attributes
+(
+        DxfInsert *insert
+                /*!< a pointer to a DXF \c INSERT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (insert == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (insert->attributes);
+}
+
+
+/*!
+ * \brief Set the pointer to the first \c ATTRIB entity following a DXF
+ * \c INSERT entity.
+ */
+DxfInsert *
+dxf_insert_set_attributes
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfAttrib *attributes
+                /*!< a pointer to the first \c ATTRIB entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (insert == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        insert->attributes = attributes;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (insert);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c INSERT entity from a DXF 
  * \c INSERT entity.
@@ -117,17 +117,17 @@ dxf_layer_init
               return (NULL);
         }
         dxf_layer_set_id_code (layer, 0);
-        dxf_layer_set_layer_name (layer, strdup (""));
-        dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+        dxf_layer_set_layer_name (layer, "");
+        dxf_layer_set_linetype (layer, DXF_DEFAULT_LINETYPE);
         dxf_layer_set_color (layer, DXF_COLOR_BYLAYER);
         dxf_layer_set_flag (layer, 0);
         dxf_layer_set_plotting_flag (layer, 0);
-        dxf_layer_set_dictionary_owner_soft (layer, strdup (""));
-        dxf_layer_set_material (layer, strdup (""));
-        dxf_layer_set_dictionary_owner_hard (layer, strdup (""));
+        dxf_layer_set_dictionary_owner_soft (layer, "");
+        dxf_layer_set_material (layer, "");
+        dxf_layer_set_dictionary_owner_hard (layer, "");
         dxf_layer_set_lineweight (layer, 0);
-        dxf_layer_set_plot_style_name (layer, strdup (""));
-        dxf_layer_set_next (layer, NULL);
+        dxf_layer_set_plot_style_name (layer, "");
+        layer->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -245,21 +245,18 @@ dxf_layer_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->dictionary_owner_soft);
+                        layer->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing the material. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->material);
+                        layer->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->dictionary_owner_hard);
+                        layer->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -272,8 +269,7 @@ dxf_layer_read
                 {
                         /* Now follows a string containing the plot style
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer->plot_style_name);
+                        layer->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -372,9 +368,9 @@ dxf_layer_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (layer->id_code != -1)
+        if (layer->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_layer_get_id_code (layer));
+                dxf_handle_write (fp, 5, dxf_layer_get_id_code (layer));
         }
         /*!
          * \todo for version R14.\n
@@ -386,11 +382,11 @@ dxf_layer_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dxf_layer_get_dictionary_owner_soft (layer), "") != 0)
+        if ((layer->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_layer_get_dictionary_owner_soft (layer));
+                dxf_handle_write (fp, 330, layer->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_14)
@@ -409,11 +405,11 @@ dxf_layer_write
         {
                 fprintf (fp->fp, "290\n%d\n", dxf_layer_get_plotting_flag (layer));
                 fprintf (fp->fp, "370\n%hd\n", dxf_layer_get_lineweight (layer));
-                fprintf (fp->fp, "390\n%s\n", dxf_layer_get_plot_style_name (layer));
+                dxf_handle_write (fp, 390, layer->plot_style_name);
         }
         if (fp->acad_version_number >= AutoCAD_2007)
         {
-                fprintf (fp->fp, "347\n%s\n", dxf_layer_get_material (layer));
+                dxf_handle_write (fp, 347, layer->material);
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -457,12 +453,8 @@ dxf_layer_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_layer_get_layer_name (layer));
-        free (dxf_layer_get_linetype (layer));
-        free (dxf_layer_get_dictionary_owner_soft (layer));
-        free (dxf_layer_get_material (layer));
-        free (dxf_layer_get_dictionary_owner_hard (layer));
-        free (dxf_layer_get_plot_style_name (layer));
+        free (layer->layer_name);
+        free (layer->linetype);
         free (layer);
         layer = NULL;
 #if DEBUG
@@ -496,6 +488,7 @@ dxf_layer_free_list
         while (layers != NULL)
         {
                 DxfLayer *iter = (DxfLayer *) layers->next;
+                layers->next = NULL;
                 dxf_layer_free (layers);
                 layers = (DxfLayer *) iter;
         }
@@ -505,12 +498,84 @@ dxf_layer_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c LAYER symbol table entry.
+ *
+ * The copy does not share any memory with \c layer, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLayer *
+dxf_layer_copy
+(
+        DxfLayer *layer
+                /*!< a pointer to the DXF \c LAYER symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayer *copy;
+
+        /* Do some basic checks. */
+        if (layer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_layer_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, layer, sizeof (DxfLayer));
+        copy->layer_name = NULL;
+        copy->linetype = NULL;
+        copy->next = NULL;
+        if (layer->layer_name != NULL)
+        {
+                copy->layer_name = strdup (layer->layer_name);
+                if (copy->layer_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_layer_free (copy);
+                        return (NULL);
+                }
+        }
+        if (layer->linetype != NULL)
+        {
+                copy->linetype = strdup (layer->linetype);
+                if (copy->linetype == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_layer_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c LAYER entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_layer_get_id_code
 (
         DxfLayer *layer
@@ -528,13 +593,6 @@ dxf_layer_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (layer->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -550,7 +608,7 @@ dxf_layer_set_id_code
 (
         DxfLayer *layer,
                 /*!< a pointer to a DXF \c LAYER entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -567,13 +625,6 @@ dxf_layer_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         layer->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1193,17 +1244,10 @@ dxf_layer_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (layer->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_soft));
+        return (dxf_handle_to_string (layer->dictionary_owner_soft));
 }
 
 
@@ -1239,7 +1283,7 @@ dxf_layer_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1273,17 +1317,10 @@ dxf_layer_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (layer->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->material));
+        return (dxf_handle_to_string (layer->material));
 }
 
 
@@ -1321,7 +1358,7 @@ dxf_layer_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->material = strdup (material);
+        layer->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1355,17 +1392,10 @@ dxf_layer_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (layer->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_hard));
+        return (dxf_handle_to_string (layer->dictionary_owner_hard));
 }
 
 
@@ -1401,7 +1431,7 @@ dxf_layer_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1498,17 +1528,10 @@ dxf_layer_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (layer->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->plot_style_name));
+        return (dxf_handle_to_string (layer->plot_style_name));
 }
 
 
@@ -1546,7 +1569,7 @@ dxf_layer_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->plot_style_name = strdup (plot_style_name);
+        layer->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
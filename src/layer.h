@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -57,7 +58,7 @@ extern "C" {
 typedef struct
 dxf_layer_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -90,20 +91,20 @@ dxf_layer_struct
                 /*!< Plotting flag.\n
                  * Boolean, if set to 0, do not plot this layer.\n
                  * Group code = 290. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *material;
+        DxfHandle material;
                 /*!< Hard-pointer ID / handle to Material object.\n
                  * Group code = 347. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< group code = 360\n
                  * Hard owner ID/handle to owner dictionary (optional). */
         int16_t lineweight;
                 /*!< Lineweight enum value.\n
                  * Group code = 370. */
-        char *plot_style_name;
+        DxfHandle plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390. */
         struct DxfLayer *next;
@@ -118,8 +119,9 @@ DxfLayer *dxf_layer_read (DxfFile *fp, DxfLayer *layer);
 int dxf_layer_write (DxfFile *fp, DxfLayer *layer);
 int dxf_layer_free (DxfLayer *layer);
 void dxf_layer_free_list (DxfLayer *layers);
-int dxf_layer_get_id_code (DxfLayer *layer);
-DxfLayer *dxf_layer_set_id_code (DxfLayer *layer, int id_code);
+DxfLayer *dxf_layer_copy (DxfLayer *layer);
+DxfHandle dxf_layer_get_id_code (DxfLayer *layer);
+DxfLayer *dxf_layer_set_id_code (DxfLayer *layer, DxfHandle id_code);
 char *dxf_layer_get_layer_name (DxfLayer *layer);
 DxfLayer *dxf_layer_set_layer_name (DxfLayer *layer, char *layer_name);
 char *dxf_layer_get_linetype (DxfLayer *layer);
@@ -133,16 +133,15 @@ dxf_layer_index_init
                 return (NULL);
         }
         layer_index->id_code = 0;
-        layer_index->dictionary_owner_soft = strdup ("");
-        layer_index->dictionary_owner_hard = strdup ("");
+        layer_index->dictionary_owner_soft = DXF_HANDLE_NONE;
+        layer_index->dictionary_owner_hard = DXF_HANDLE_NONE;
         layer_index->time_stamp = 0;
         layer_index->layer_name = (DxfLayerName *) dxf_layer_name_new ();
         layer_index->layer_name = (DxfLayerName *) dxf_layer_name_init (layer_index->layer_name);
-        layer_index->layer_name->name = strdup ("");
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 layer_index->number_of_entries[i] = 0;
-                layer_index->hard_owner_reference[i] = strdup ("");
+                layer_index->hard_owner_reference[i] = DXF_HANDLE_NONE;
         }
         layer_index->next = NULL;
 #if DEBUG
@@ -226,8 +225,7 @@ dxf_layer_index_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &layer_index->id_code);
+                        layer_index->id_code = dxf_handle_read (fp);
                 }
                 if (strcmp (temp_string, "8") == 0)
                 {
@@ -276,16 +274,14 @@ dxf_layer_index_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->dictionary_owner_soft);
+                        layer_index->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if ((strcmp (temp_string, "360") == 0)
                   && (k == 0))
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->dictionary_owner_hard);
+                        layer_index->dictionary_owner_hard = dxf_handle_read (fp);
                         k++;
                 }
                 else if ((strcmp (temp_string, "360") == 0)
@@ -294,8 +290,7 @@ dxf_layer_index_read
                         /* Now follows a string containing a Hard owner
                          * reference LAYER_INDEX (multiple entries may
                          * exist). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->hard_owner_reference[k]);
+                        layer_index->hard_owner_reference[k] = dxf_handle_read (fp);
                         k++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -366,14 +361,14 @@ dxf_layer_index_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, layer_index->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (layer_index->id_code != -1)
+        if (layer_index->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", layer_index->id_code);
+                dxf_handle_write (fp, 5, layer_index->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -385,18 +380,18 @@ dxf_layer_index_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (layer_index->dictionary_owner_soft, "") != 0)
+        if ((layer_index->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", layer_index->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, layer_index->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (layer_index->dictionary_owner_hard, "") != 0)
+        if ((layer_index->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", layer_index->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, layer_index->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -404,21 +399,20 @@ dxf_layer_index_write
                 fprintf (fp->fp, "100\nAcDbIndex\n");
         }
         fprintf (fp->fp, " 40\n%lf\n", layer_index->time_stamp);
+        /* One layer name, IDBUFFER reference and number of entries
+         * per layer, see dxf_layer_partition_fill_layer_index (). */
         iter = (DxfLayerName *) layer_index->layer_name;
         i = 0;
-        while (strlen (iter->name) > 0)
+        while ((iter != NULL)
+          && (iter->name != NULL)
+          && (strlen (iter->name) > 0)
+          && (i < DXF_MAX_PARAM))
         {
                 fprintf (fp->fp, "  8\n%s\n", iter->name);
-                iter = (DxfLayerName *) iter->next;
-                i++;
-        }
-        i = 0;
-        while (strlen (layer_index->layer_name->name) > 0)
-        {
-                fprintf (fp->fp, "360\n%s\n", layer_index->hard_owner_reference[i]);
+                dxf_handle_write (fp, 360, layer_index->hard_owner_reference[i]);
                 fprintf (fp->fp, " 90\n%d\n", layer_index->number_of_entries[i]);
+                iter = (DxfLayerName *) iter->next;
                 i++;
-                /*! \todo Check for overrun of array index. */
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -447,8 +441,6 @@ dxf_layer_index_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
@@ -464,13 +456,7 @@ dxf_layer_index_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (layer_index->dictionary_owner_soft);
-        free (layer_index->dictionary_owner_hard);
         dxf_layer_name_free_list (layer_index->layer_name);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                free (layer_index->hard_owner_reference[i]);
-        }
         free (layer_index);
         layer_index = NULL;
 #if DEBUG
@@ -504,6 +490,7 @@ dxf_layer_index_free_list
         while (layer_indices != NULL)
         {
                 DxfLayerIndex *iter = (DxfLayerIndex *) layer_indices->next;
+                layer_indices->next = NULL;
                 dxf_layer_index_free (layer_indices);
                 layer_indices = (DxfLayerIndex *) iter;
         }
@@ -518,7 +505,7 @@ dxf_layer_index_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_layer_index_get_id_code
 (
         DxfLayerIndex *layer_index
@@ -536,13 +523,6 @@ dxf_layer_index_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (layer_index->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -558,7 +538,7 @@ dxf_layer_index_set_id_code
 (
         DxfLayerIndex *layer_index,
                 /*!< a pointer to a DXF \c LAYER_INDEX object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -575,13 +555,6 @@ dxf_layer_index_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         layer_index->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -616,17 +589,10 @@ dxf_layer_index_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (layer_index->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_soft));
+        return (dxf_handle_to_string (layer_index->dictionary_owner_soft));
 }
 
 
@@ -662,7 +628,7 @@ dxf_layer_index_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer_index->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -696,17 +662,10 @@ dxf_layer_index_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (layer_index->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_hard));
+        return (dxf_handle_to_string (layer_index->dictionary_owner_hard));
 }
 
 
@@ -742,7 +701,7 @@ dxf_layer_index_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer_index->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -65,6 +65,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "layer_name.h"
 
 
@@ -80,15 +81,15 @@ typedef struct
 dxf_layer_index_struct
 {
         /* Members common for all DXF group objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF idbuffer. */
@@ -102,7 +103,7 @@ dxf_layer_index_struct
                 /*!< Number of entries in the IDBUFFER list (multiple
                  * entries may exist).\n
                  * Group code = 90. */
-        char *hard_owner_reference[DXF_MAX_PARAM];
+        DxfHandle hard_owner_reference[DXF_MAX_PARAM];
                 /*!< Hard owner reference to IDBUFFER (multiple entries
                  * may exist).\n
                  * Group code = 360. */
@@ -118,8 +119,8 @@ DxfLayerIndex *dxf_layer_index_read (DxfFile *fp, DxfLayerIndex *layer_index);
 int dxf_layer_index_write (DxfFile *fp, DxfLayerIndex *layer_index);
 int dxf_layer_index_free (DxfLayerIndex *layer_index);
 void dxf_layer_index_free_list (DxfLayerIndex *layer_indices);
-int dxf_layer_index_get_id_code (DxfLayerIndex *layer_index);
-DxfLayerIndex *dxf_layer_index_set_id_code (DxfLayerIndex *layer_index, int id_code);
+DxfHandle dxf_layer_index_get_id_code (DxfLayerIndex *layer_index);
+DxfLayerIndex *dxf_layer_index_set_id_code (DxfLayerIndex *layer_index, DxfHandle id_code);
 char *dxf_layer_index_get_dictionary_owner_soft (DxfLayerIndex *layer_index);
 DxfLayerIndex *dxf_layer_index_set_dictionary_owner_soft (DxfLayerIndex *layer_index, char *dictionary_owner_soft);
 char *dxf_layer_index_get_dictionary_owner_hard (DxfLayerIndex *layer_index);
@@ -188,6 +188,7 @@ dxf_layer_name_free_list
         while (layer_names != NULL)
         {
                 DxfLayerName *iter = (DxfLayerName *) layer_names->next;
+                layer_names->next = NULL;
                 dxf_layer_name_free (layer_names);
                 layer_names = (DxfLayerName *) iter;
         }
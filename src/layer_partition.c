@@ -0,0 +1,1085 @@
+/*!
+ * \file layer_partition.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a layer partitioned index of entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "layer_partition.h"
+
+
+/*!
+ * \brief Hash a layer name.
+ *
+ * Layer names are not case sensitive, so the name is folded to upper
+ * case first.
+ */
+static unsigned int
+dxf_layer_partition_hash
+(
+        const char *layer_name
+                /*!< a layer name. */
+)
+{
+        unsigned int hash = 2166136261u;
+
+        while (*layer_name != '\0')
+        {
+                hash ^= (unsigned char) toupper ((unsigned char) *layer_name);
+                hash *= 16777619u;
+                layer_name++;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Compare two layer names, not case sensitive.
+ *
+ * \return \c TRUE when the names are equal, \c FALSE otherwise.
+ */
+static int
+dxf_layer_partition_equal
+(
+        const char *name_1,
+                /*!< a layer name. */
+        const char *name_2
+                /*!< another layer name. */
+)
+{
+        while ((*name_1 != '\0')
+          && (toupper ((unsigned char) *name_1) == toupper ((unsigned char) *name_2)))
+        {
+                name_1++;
+                name_2++;
+        }
+        return (*name_1 == *name_2);
+}
+
+
+/*!
+ * \brief Find the hash slot of a layer name.
+ *
+ * \return the slot holding \c layer_name, or the empty slot where it
+ * is to be stored.
+ */
+static int
+dxf_layer_partition_find_slot
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        const char *layer_name
+                /*!< a layer name. */
+)
+{
+        int mask;
+        int i;
+
+        mask = (2 * partition->layers_size) - 1;
+        i = (int) (dxf_layer_partition_hash (layer_name) & (unsigned int) mask);
+        while ((partition->slots[i] != 0)
+          && (!dxf_layer_partition_equal (partition->layer_names[partition->slots[i] - 1], layer_name)))
+        {
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of layer ids in a \c DxfLayerPartition.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_layer_partition_grow
+(
+        DxfLayerPartition *partition
+                /*!< a pointer to a layer partition. */
+)
+{
+        int size;
+        int words;
+        int old_words;
+        int i;
+
+        size = (partition->layers_size == 0) ? 64 : 2 * partition->layers_size;
+        words = DXF_LAYER_SET_WORDS (size);
+        old_words = DXF_LAYER_SET_WORDS (partition->layers_size);
+        if (((partition->layer_names = realloc (partition->layer_names, size * sizeof (char *))) == NULL)
+          || ((partition->positions = realloc (partition->positions, size * sizeof (int *))) == NULL)
+          || ((partition->number_of_positions = realloc (partition->number_of_positions, size * sizeof (int))) == NULL)
+          || ((partition->positions_size = realloc (partition->positions_size, size * sizeof (int))) == NULL)
+          || ((partition->frozen = realloc (partition->frozen, words * sizeof (uint64_t))) == NULL)
+          || ((partition->off = realloc (partition->off, words * sizeof (uint64_t))) == NULL)
+          || ((partition->locked = realloc (partition->locked, words * sizeof (uint64_t))) == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = partition->layers_size; i < size; i++)
+        {
+                partition->layer_names[i] = NULL;
+                partition->positions[i] = NULL;
+                partition->number_of_positions[i] = 0;
+                partition->positions_size[i] = 0;
+        }
+        for (i = old_words; i < words; i++)
+        {
+                partition->frozen[i] = 0;
+                partition->off[i] = 0;
+                partition->locked[i] = 0;
+        }
+        /* Rehash the layer names. */
+        free (partition->slots);
+        partition->slots = calloc (2 * size, sizeof (int));
+        if (partition->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        partition->layers_size = size;
+        for (i = 0; i < partition->number_of_layers; i++)
+        {
+                partition->slots[dxf_layer_partition_find_slot (partition, partition->layer_names[i])] = i + 1;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfLayerPartition.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfLayerPartition *
+dxf_layer_partition_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerPartition *partition = NULL;
+        size_t size;
+
+        size = sizeof (DxfLayerPartition);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((partition = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLayerPartition struct.\n")),
+                  __FUNCTION__);
+                partition = NULL;
+        }
+        else
+        {
+                memset (partition, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (partition);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfLayerPartition.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfLayerPartition *
+dxf_layer_partition_init
+(
+        DxfLayerPartition *partition
+                /*!< a pointer to a layer partition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                partition = dxf_layer_partition_new ();
+        }
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (partition, 0, sizeof (DxfLayerPartition));
+        if (dxf_layer_partition_grow (partition) == EXIT_FAILURE)
+        {
+                dxf_layer_partition_free (partition);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (partition);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfLayerPartition.
+ *
+ * The entities are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_free
+(
+        DxfLayerPartition *partition
+                /*!< a pointer to a layer partition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < partition->layers_size; i++)
+        {
+                if (partition->layer_names != NULL)
+                {
+                        free (partition->layer_names[i]);
+                }
+                if (partition->positions != NULL)
+                {
+                        free (partition->positions[i]);
+                }
+        }
+        free (partition->layer_names);
+        free (partition->positions);
+        free (partition->number_of_positions);
+        free (partition->positions_size);
+        free (partition->slots);
+        free (partition->entity_layer);
+        free (partition->frozen);
+        free (partition->off);
+        free (partition->locked);
+        free (partition);
+        partition = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Intern a layer name in a \c DxfLayerPartition.
+ *
+ * \return the id of the layer, or -1 when an error occurred.
+ */
+int
+dxf_layer_partition_intern
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        const char *layer_name
+                /*!< a layer name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int slot;
+        int layer;
+
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (layer_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        slot = dxf_layer_partition_find_slot (partition, layer_name);
+        if (partition->slots[slot] != 0)
+        {
+                return (partition->slots[slot] - 1);
+        }
+        if (partition->number_of_layers == partition->layers_size)
+        {
+                if (dxf_layer_partition_grow (partition) == EXIT_FAILURE)
+                {
+                        return (-1);
+                }
+                slot = dxf_layer_partition_find_slot (partition, layer_name);
+        }
+        layer = partition->number_of_layers;
+        partition->layer_names[layer] = strdup (layer_name);
+        partition->slots[slot] = layer + 1;
+        partition->number_of_layers++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (layer);
+}
+
+
+/*!
+ * \brief Find the id of a layer name in a \c DxfLayerPartition.
+ *
+ * \return the id of the layer, or -1 when the layer name is not known
+ * or an error occurred.
+ */
+int
+dxf_layer_partition_find_layer
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        const char *layer_name
+                /*!< a layer name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int slot;
+
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (layer_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        slot = dxf_layer_partition_find_slot (partition, layer_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (partition->slots[slot] - 1);
+}
+
+
+/*!
+ * \brief Get the name of a layer id in a \c DxfLayerPartition.
+ *
+ * \return a pointer to the interned layer name, or \c NULL when an
+ * error occurred.
+ */
+const char *
+dxf_layer_partition_get_layer_name
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int layer
+                /*!< a layer id. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((layer < 0)
+          || (layer >= partition->number_of_layers))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (partition->layer_names[layer]);
+}
+
+
+/*!
+ * \brief Get the number of layers in a \c DxfLayerPartition.
+ *
+ * \return the number of interned layer names, or -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_get_number_of_layers
+(
+        DxfLayerPartition *partition
+                /*!< a pointer to a layer partition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (partition->number_of_layers);
+}
+
+
+/*!
+ * \brief Add the state of the layers in a \c TABLES section to a
+ * \c DxfLayerPartition.
+ *
+ * A layer is off when its color is negative, frozen when bit 1 of its
+ * flag is set and locked when bit 4 of its flag is set.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_add_tables
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        DxfTables *tables
+                /*!< DXF tables section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayer *iter;
+        int layer;
+
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (tables == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = tables->layers; iter != NULL; iter = (DxfLayer *) iter->next)
+        {
+                if (iter->layer_name == NULL)
+                {
+                        continue;
+                }
+                layer = dxf_layer_partition_intern (partition, iter->layer_name);
+                if (layer < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                partition->frozen[layer / 64] &= ~(UINT64_C (1) << (layer % 64));
+                partition->off[layer / 64] &= ~(UINT64_C (1) << (layer % 64));
+                partition->locked[layer / 64] &= ~(UINT64_C (1) << (layer % 64));
+                if (iter->flag & 1)
+                {
+                        DXF_LAYER_SET_ADD (partition->frozen, layer);
+                }
+                if (iter->color < 0)
+                {
+                        DXF_LAYER_SET_ADD (partition->off, layer);
+                }
+                if (iter->flag & 4)
+                {
+                        DXF_LAYER_SET_ADD (partition->locked, layer);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the entities of an \c ENTITIES section to a
+ * \c DxfLayerPartition.
+ *
+ * Replaces the entities added before, the interned layer names and the
+ * layer states are kept.\n
+ * Entities without a layer name are put on layer "0".
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_add_entities
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntityType type;
+        const char *layer_name;
+        const char *previous_name = NULL;
+        void *entity;
+        int number_of_entities;
+        int layer = -1;
+        int size;
+        int i;
+
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        free (partition->entity_layer);
+        partition->entity_layer = malloc ((number_of_entities + 1) * sizeof (int));
+        if (partition->entity_layer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                partition->number_of_entities = 0;
+                return (EXIT_FAILURE);
+        }
+        partition->number_of_entities = number_of_entities;
+        for (i = 0; i < partition->number_of_layers; i++)
+        {
+                partition->number_of_positions[i] = 0;
+        }
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i, &type);
+                layer_name = dxf_entities_get_layer (type, entity);
+                if (layer_name == NULL)
+                {
+                        layer_name = DXF_DEFAULT_LAYER;
+                }
+                /* Runs of entities on the same layer are common, skip
+                 * the hash lookup for those. */
+                if ((previous_name == NULL)
+                  || ((layer_name != previous_name)
+                  && (strcmp (layer_name, previous_name) != 0)))
+                {
+                        layer = dxf_layer_partition_intern (partition, layer_name);
+                        if (layer < 0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        previous_name = layer_name;
+                }
+                partition->entity_layer[i] = layer;
+                if (partition->number_of_positions[layer] == partition->positions_size[layer])
+                {
+                        size = (partition->positions_size[layer] == 0) ? 16 : 2 * partition->positions_size[layer];
+                        partition->positions[layer] = realloc (partition->positions[layer], size * sizeof (int));
+                        if (partition->positions[layer] == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                partition->positions_size[layer] = 0;
+                                partition->number_of_positions[layer] = 0;
+                                return (EXIT_FAILURE);
+                        }
+                        partition->positions_size[layer] = size;
+                }
+                partition->positions[layer][partition->number_of_positions[layer]] = i;
+                partition->number_of_positions[layer]++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the positions of the entities on a layer.
+ *
+ * \return a pointer to the positions in file order, owned by
+ * \c partition, or \c NULL when there are none or an error occurred.
+ */
+const int *
+dxf_layer_partition_get_entities_on_layer
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int layer,
+                /*!< a layer id. */
+        int *number_of_entities
+                /*!< receives the number of positions. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (number_of_entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        *number_of_entities = 0;
+        if ((layer < 0)
+          || (layer >= partition->number_of_layers))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        *number_of_entities = partition->number_of_positions[layer];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (partition->positions[layer]);
+}
+
+
+/*!
+ * \brief Test a layer id against one of the state sets.
+ *
+ * \return the bit, or -1 when an error occurred.
+ */
+static int
+dxf_layer_partition_test
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        const uint64_t *set,
+                /*!< the state set. */
+        int layer,
+                /*!< a layer id. */
+        const char *function
+                /*!< name of the calling function. */
+)
+{
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  function);
+                return (-1);
+        }
+        if ((layer < 0)
+          || (layer >= partition->number_of_layers))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  function);
+                return (-1);
+        }
+        return ((int) DXF_LAYER_SET_HAS (set, layer));
+}
+
+
+/*!
+ * \brief Test if a layer is frozen.
+ *
+ * \return \c TRUE when frozen, \c FALSE when not, -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_is_frozen
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int layer
+                /*!< a layer id. */
+)
+{
+        return (dxf_layer_partition_test (partition, (partition == NULL) ? NULL : partition->frozen, layer, __FUNCTION__));
+}
+
+
+/*!
+ * \brief Test if a layer is off.
+ *
+ * \return \c TRUE when off, \c FALSE when not, -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_is_off
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int layer
+                /*!< a layer id. */
+)
+{
+        return (dxf_layer_partition_test (partition, (partition == NULL) ? NULL : partition->off, layer, __FUNCTION__));
+}
+
+
+/*!
+ * \brief Test if a layer is locked.
+ *
+ * \return \c TRUE when locked, \c FALSE when not, -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_is_locked
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int layer
+                /*!< a layer id. */
+)
+{
+        return (dxf_layer_partition_test (partition, (partition == NULL) ? NULL : partition->locked, layer, __FUNCTION__));
+}
+
+
+/*!
+ * \brief Test if a layer is visible, that is neither frozen nor off.
+ *
+ * \return \c TRUE when visible, \c FALSE when not, -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_is_visible
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int layer
+                /*!< a layer id. */
+)
+{
+        int hidden;
+
+        hidden = dxf_layer_partition_test (partition, (partition == NULL) ? NULL : partition->frozen, layer, __FUNCTION__);
+        if (hidden != 0)
+        {
+                return ((hidden < 0) ? -1 : FALSE);
+        }
+        return (!DXF_LAYER_SET_HAS (partition->off, layer));
+}
+
+
+/*!
+ * \brief Test if the entity at a position is on a visible layer.
+ *
+ * \return \c TRUE when visible, \c FALSE when not, -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_is_entity_visible
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        int position
+                /*!< position of the entity in the \c ENTITIES
+                 * section. */
+)
+{
+        /* Do some basic checks. */
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((position < 0)
+          || (position >= partition->number_of_entities))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return (dxf_layer_partition_is_visible (partition, partition->entity_layer[position]));
+}
+
+
+/*!
+ * \brief Make a set of layers from a list of layer names.
+ *
+ * Unknown layer names are interned, so the set stays valid for
+ * entities added later on those layers.\n
+ * The set is sized for the layers known when it is made, so make it
+ * after adding the tables and entities. Free it with free ().
+ *
+ * \return a pointer to the set, or \c NULL when an error occurred.
+ */
+uint64_t *
+dxf_layer_partition_new_set
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        char **layer_names,
+                /*!< array of layer names, may be \c NULL for an
+                 * empty set. */
+        int number_of_layer_names
+                /*!< number of names in \c layer_names. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint64_t *set;
+        int layer;
+        int i;
+
+        /* Do some basic checks. */
+        if (partition == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; (layer_names != NULL) && (i < number_of_layer_names); i++)
+        {
+                if (dxf_layer_partition_intern (partition, layer_names[i]) < 0)
+                {
+                        return (NULL);
+                }
+        }
+        set = calloc (DXF_LAYER_SET_WORDS (partition->layers_size), sizeof (uint64_t));
+        if (set == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; (layer_names != NULL) && (i < number_of_layer_names); i++)
+        {
+                layer = dxf_layer_partition_find_layer (partition, layer_names[i]);
+                DXF_LAYER_SET_ADD (set, layer);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (set);
+}
+
+
+/*!
+ * \brief Select the entities on a set of layers.
+ *
+ * Every entity is tested with a bit test on the layer id, no layer
+ * names are compared.
+ *
+ * \return the number of positions stored in \c positions, in file
+ * order, or -1 when an error occurred.
+ */
+int
+dxf_layer_partition_select
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        const uint64_t *layers,
+                /*!< set of layers made with
+                 * dxf_layer_partition_new_set (), \c NULL for all
+                 * layers. */
+        int visible_only,
+                /*!< when \c TRUE skip entities on frozen layers and on
+                 * layers that are off. */
+        int *positions
+                /*!< receives the positions, room for at least the
+                 * number of entities in the partition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint64_t *mask;
+        int words;
+        int layer;
+        int count = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (positions == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        /* Combine the layer set and the visibility in one mask. */
+        words = DXF_LAYER_SET_WORDS (partition->number_of_layers);
+        mask = malloc ((words + 1) * sizeof (uint64_t));
+        if (mask == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        for (i = 0; i < words; i++)
+        {
+                mask[i] = (layers == NULL) ? ~UINT64_C (0) : layers[i];
+                if (visible_only)
+                {
+                        mask[i] &= ~(partition->frozen[i] | partition->off[i]);
+                }
+        }
+        for (i = 0; i < partition->number_of_entities; i++)
+        {
+                layer = partition->entity_layer[i];
+                if (DXF_LAYER_SET_HAS (mask, layer))
+                {
+                        positions[count] = i;
+                        count++;
+                }
+        }
+        free (mask);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (count);
+}
+
+
+/*!
+ * \brief Fill a DXF \c LAYER_INDEX object from a
+ * \c DxfLayerPartition.
+ *
+ * Every layer with entities gets a layer name and a number of entries
+ * in \c layer_index, call this before dxf_layer_index_write ().\n
+ * At most \c DXF_MAX_PARAM layers are stored.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_partition_fill_layer_index
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to a layer partition. */
+        DxfLayerIndex *layer_index
+                /*!< DXF \c LAYER_INDEX object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerName *first = NULL;
+        DxfLayerName *last = NULL;
+        DxfLayerName *layer_name;
+        int layer;
+        int i;
+
+        /* Do some basic checks. */
+        if ((partition == NULL)
+          || (layer_index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        i = 0;
+        for (layer = 0; (layer < partition->number_of_layers) && (i < DXF_MAX_PARAM); layer++)
+        {
+                if (partition->number_of_positions[layer] == 0)
+                {
+                        continue;
+                }
+                layer_name = dxf_layer_name_init (dxf_layer_name_new ());
+                if (layer_name == NULL)
+                {
+                        if (first != NULL)
+                        {
+                                dxf_layer_name_free_list (first);
+                        }
+                        return (EXIT_FAILURE);
+                }
+                free (layer_name->name);
+                layer_name->name = strdup (partition->layer_names[layer]);
+                layer_name->length = strlen (layer_name->name);
+                if (last == NULL)
+                {
+                        first = layer_name;
+                }
+                else
+                {
+                        last->next = (struct DxfLayerName *) layer_name;
+                }
+                last = layer_name;
+                layer_index->number_of_entries[i] = partition->number_of_positions[layer];
+                i++;
+        }
+        for (; i < DXF_MAX_PARAM; i++)
+        {
+                layer_index->number_of_entries[i] = 0;
+        }
+        if (first == NULL)
+        {
+                first = dxf_layer_name_init (dxf_layer_name_new ());
+        }
+        dxf_layer_name_free_list (layer_index->layer_name);
+        layer_index->layer_name = first;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
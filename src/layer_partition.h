@@ -0,0 +1,130 @@
+/*!
+ * \file layer_partition.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a layer partitioned index of entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_LAYER_PARTITION_H
+#define LIBDXF_SRC_LAYER_PARTITION_H
+
+
+#include "global.h"
+#include "entities.h"
+#include "tables.h"
+#include "layer_index.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_LAYER_SET_WORDS(number_of_layers) (((number_of_layers) + 63) / 64)
+        /*!< \brief Number of 64 bit words in a set of layers. */
+#define DXF_LAYER_SET_ADD(set, layer) ((set)[(layer) / 64] |= (UINT64_C (1) << ((layer) % 64)))
+        /*!< \brief Add a layer id to a set of layers. */
+#define DXF_LAYER_SET_HAS(set, layer) (((set)[(layer) / 64] >> ((layer) % 64)) & 1)
+        /*!< \brief Test if a layer id is in a set of layers. */
+
+
+/*!
+ * \brief Index of the entities of an \c ENTITIES section by layer.
+ *
+ * Every layer name is interned once and referred to by a small id,
+ * the position in \c layer_names.\n
+ * The state of the layers in the \c LAYER table is kept in bitsets
+ * indexed by layer id, so filtering entities on visibility is a bit
+ * test instead of a string compare per entity.\n
+ * Entities are referred to by their position in the \c ENTITIES
+ * section, see dxf_entities_get_entity ().
+ */
+typedef struct
+dxf_layer_partition_struct
+{
+        char **layer_names;
+                /*!< Interned layer names, indexed by layer id. */
+        int number_of_layers;
+                /*!< Number of interned layer names. */
+        int layers_size;
+                /*!< Number of allocated layer ids. */
+        int *slots;
+                /*!< Open addressing hash of layer names, holds the
+                 * layer id + 1, 0 for an empty slot. */
+        int **positions;
+                /*!< Positions of the entities on each layer, in file
+                 * order, indexed by layer id. */
+        int *number_of_positions;
+                /*!< Number of entities on each layer. */
+        int *positions_size;
+                /*!< Number of allocated positions for each layer. */
+        int *entity_layer;
+                /*!< Layer id of each entity, indexed by position. */
+        int number_of_entities;
+                /*!< Number of entities in \c entity_layer. */
+        uint64_t *frozen;
+                /*!< Set of frozen layers. */
+        uint64_t *off;
+                /*!< Set of layers that are off. */
+        uint64_t *locked;
+                /*!< Set of locked layers. */
+} DxfLayerPartition;
+
+
+DxfLayerPartition *dxf_layer_partition_new ();
+DxfLayerPartition *dxf_layer_partition_init (DxfLayerPartition *partition);
+int dxf_layer_partition_free (DxfLayerPartition *partition);
+int dxf_layer_partition_intern (DxfLayerPartition *partition, const char *layer_name);
+int dxf_layer_partition_find_layer (DxfLayerPartition *partition, const char *layer_name);
+const char *dxf_layer_partition_get_layer_name (DxfLayerPartition *partition, int layer);
+int dxf_layer_partition_get_number_of_layers (DxfLayerPartition *partition);
+int dxf_layer_partition_add_tables (DxfLayerPartition *partition, DxfTables *tables);
+int dxf_layer_partition_add_entities (DxfLayerPartition *partition, DxfEntities *entities);
+const int *dxf_layer_partition_get_entities_on_layer (DxfLayerPartition *partition, int layer, int *number_of_entities);
+int dxf_layer_partition_is_frozen (DxfLayerPartition *partition, int layer);
+int dxf_layer_partition_is_off (DxfLayerPartition *partition, int layer);
+int dxf_layer_partition_is_locked (DxfLayerPartition *partition, int layer);
+int dxf_layer_partition_is_visible (DxfLayerPartition *partition, int layer);
+int dxf_layer_partition_is_entity_visible (DxfLayerPartition *partition, int position);
+uint64_t *dxf_layer_partition_new_set (DxfLayerPartition *partition, char **layer_names, int number_of_layer_names);
+int dxf_layer_partition_select (DxfLayerPartition *partition, const uint64_t *layers, int visible_only, int *positions);
+int dxf_layer_partition_fill_layer_index (DxfLayerPartition *partition, DxfLayerIndex *layer_index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_LAYER_PARTITION_H */
+
+
+/* EOF */
@@ -42,6 +42,7 @@
 
 
 #include "leader.h"
+#include "entities.h"
 
 
 /*!
@@ -114,17 +115,13 @@ dxf_leader_init
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->id_code = 0;
-        leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        leader->layer = strdup (DXF_DEFAULT_LAYER);
-        leader->elevation = 0.0;
-        leader->thickness = 0.0;
-        leader->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        leader->visibility = DXF_DEFAULT_VISIBILITY;
-        leader->color = DXF_COLOR_BYLAYER;
-        leader->paperspace = DXF_MODELSPACE;
-        leader->dictionary_owner_soft = strdup ("");
-        leader->dictionary_owner_hard = strdup ("");
+        if (dxf_entity_common_init (&leader->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         leader->dimension_style_name = strdup ("");
         leader->p0 = dxf_point_new ();
         leader->p0->x0 = 0.0;
@@ -154,7 +151,7 @@ dxf_leader_init
         leader->p3->x0 = 0.0;
         leader->p3->y0 = 0.0;
         leader->p3->z0 = 0.0;
-        leader->annotation_reference_hard = strdup ("");
+        leader->annotation_reference_hard = DXF_HANDLE_NONE;
         leader->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -186,9 +183,11 @@ dxf_leader_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfPoint *iter;
-        int i;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfPoint *iter = NULL;
+        int i = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -196,367 +195,189 @@ dxf_leader_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
-        if (fp->acad_version_number < AutoCAD_13)
+        if (leader == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this entity.\n")),
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
+                leader = dxf_leader_init (dxf_leader_new ());
+                if (leader == NULL)
+                {
+                        return (NULL);
+                }
         }
-        if (leader == NULL)
+        if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
-                leader = dxf_leader_init (leader);
         }
-        i = 0; /* Number of found vertices. */
-        iter = (DxfPoint *) leader->p0; /* Pointer to first vertex */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
-                        fclose (fp->fp);
-                        return (NULL);
+                        break;
                 }
-                else if (strcmp (temp_string, "  3") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->dimension_style_name);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                if (strcmp (temp_string, "5") == 0)
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &leader->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->layer);
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-                else if ((strcmp (temp_string, "10") == 0)
-                  || (strcmp (temp_string, "20") == 0)
-                  || (strcmp (temp_string, "30") == 0))
+                (fp->line_number)++;
+                switch (group_code)
                 {
-                        if (strcmp (temp_string, "10") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                if (i > 0) /* Create a pointer for the next vertex. */
+                        case 3:
+                                free (leader->dimension_style_name);
+                                leader->dimension_style_name = strdup (value);
+                                break;
+                        case 10:
+                                /* One X-value for each vertex, the first
+                                 * vertex is allocated by dxf_leader_init (). */
+                                if (iter == NULL)
                                 {
-                                        dxf_point_init ((DxfPoint *) iter->next);
+                                        iter = leader->p0;
+                                }
+                                else
+                                {
+                                        iter->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
                                         iter = (DxfPoint *) iter->next;
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter->x0);
-                        }
-                        else if (strcmp (temp_string, "20") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter->y0);
-                        }
-                        else if (strcmp (temp_string, "30") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter->z0);
-                                i++; /* Increase the number of found vertices. */
-                        }
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the text
-                         * annotation height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->text_annotation_height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the text
-                         * annotation width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->text_annotation_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &leader->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->paperspace);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the arrow
-                         * head flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->arrow_head_flag);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the path type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->path_type);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the creation
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->creation_flag);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the hookline
-                         * direction flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->hookline_direction_flag);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the hookline
-                         * flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->hookline_flag);
-                }
-                else if (strcmp (temp_string, "76") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * vertices. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->number_vertices);
-                }
-                else if (strcmp (temp_string, "77") == 0)
-                {
-                        /* Now follows a string containing the leader
-                         * color. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &leader->leader_color);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbLeader") != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->extr_z0);
-                }
-                else if (strcmp (temp_string, "211") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the "Horizontal" direction for
-                         * leader. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p1->x0);
-                }
-                else if (strcmp (temp_string, "221") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the "Horizontal" direction for
-                         * leader. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p1->y0);
-                }
-                else if (strcmp (temp_string, "231") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the "Horizontal" direction for
-                         * leader. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p1->z0);
-                }
-                else if (strcmp (temp_string, "212") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the Block reference insertion
-                         * point offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p2->x0);
-                }
-                else if (strcmp (temp_string, "222") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the Block reference insertion
-                         * point offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p2->y0);
-                }
-                else if (strcmp (temp_string, "232") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the Block reference insertion
-                         * point offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p2->z0);
-                }
-                else if (strcmp (temp_string, "213") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the Annotation placement point
-                         * offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p3->x0);
-                }
-                else if (strcmp (temp_string, "223") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the Annotation placement point
-                         * offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p3->y0);
-                }
-                else if (strcmp (temp_string, "233") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the Annotation placement point
-                         * offset from last leader vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &leader->p3->z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing Hard
-                         * reference to associated annotation (mtext,
-                         * tolerance, or insert entity). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->annotation_reference_hard);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, leader->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                iter->x0 = atof (value);
+                                i++;
+                                break;
+                        case 20:
+                                if (iter != NULL)
+                                {
+                                        iter->y0 = atof (value);
+                                }
+                                break;
+                        case 30:
+                                if (iter != NULL)
+                                {
+                                        iter->z0 = atof (value);
+                                }
+                                break;
+                        case 40:
+                                leader->text_annotation_height = atof (value);
+                                break;
+                        case 41:
+                                leader->text_annotation_width = atof (value);
+                                break;
+                        case 71:
+                                leader->arrow_head_flag = atoi (value);
+                                break;
+                        case 72:
+                                leader->path_type = atoi (value);
+                                break;
+                        case 73:
+                                leader->creation_flag = atoi (value);
+                                break;
+                        case 74:
+                                leader->hookline_direction_flag = atoi (value);
+                                break;
+                        case 75:
+                                leader->hookline_flag = atoi (value);
+                                break;
+                        case 76:
+                                leader->number_vertices = atoi (value);
+                                break;
+                        case 77:
+                                leader->leader_color = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbLeader") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                leader->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                leader->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                leader->extr_z0 = atof (value);
+                                break;
+                        case 211:
+                                leader->p1->x0 = atof (value);
+                                break;
+                        case 221:
+                                leader->p1->y0 = atof (value);
+                                break;
+                        case 231:
+                                leader->p1->z0 = atof (value);
+                                break;
+                        case 212:
+                                leader->p2->x0 = atof (value);
+                                break;
+                        case 222:
+                                leader->p2->y0 = atof (value);
+                                break;
+                        case 232:
+                                leader->p2->z0 = atof (value);
+                                break;
+                        case 213:
+                                leader->p3->x0 = atof (value);
+                                break;
+                        case 223:
+                                leader->p3->y0 = atof (value);
+                                break;
+                        case 233:
+                                leader->p3->z0 = atof (value);
+                                break;
+                        case 340:
+                                leader->annotation_reference_hard = dxf_handle_parse (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &leader->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
-        if (i != leader->number_vertices)
+        /* Handle omitted members and/or illegal values. */
+        if ((leader->common.linetype == NULL)
+          || (strcmp (leader->common.linetype, "") == 0))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () actual number of vertices differs from number_vertices value in struct.\n")),
-                  __FUNCTION__);
+                free (leader->common.linetype);
+                leader->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        /* Handle omitted members and/or illegal values. */
-        if (strcmp (leader->linetype, "") == 0)
+        if ((leader->common.layer == NULL)
+          || (strcmp (leader->common.layer, "") == 0))
         {
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (leader->common.layer);
+                leader->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (strcmp (leader->layer, "") == 0)
+        if (i != leader->number_vertices)
         {
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                fprintf (stderr,
+                  (_("Warning in %s () actual number of vertices differs from number_vertices value in struct.\n")),
+                  __FUNCTION__);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -617,34 +438,34 @@ dxf_leader_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, leader->id_code);
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, leader->common.id_code);
         }
-        if (strcmp (leader->linetype, "") == 0)
+        if (strcmp (leader->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, leader->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, leader->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                leader->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (leader->layer, "") == 0)
+        if (strcmp (leader->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, leader->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, leader->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                leader->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (leader->id_code != -1)
+        if (leader->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", leader->id_code);
+                dxf_handle_write (fp, 5, leader->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -656,54 +477,54 @@ dxf_leader_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (leader->dictionary_owner_soft, "") != 0)
+        if ((leader->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", leader->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, leader->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (leader->dictionary_owner_hard, "") != 0)
+        if ((leader->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", leader->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, leader->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (leader->paperspace == DXF_PAPERSPACE)
+        if (leader->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", leader->layer);
-        if (strcmp (leader->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", leader->common.layer);
+        if (strcmp (leader->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", leader->linetype);
+                fprintf (fp->fp, "  6\n%s\n", leader->common.linetype);
         }
-        if (leader->color != DXF_COLOR_BYLAYER)
+        if (leader->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", leader->color);
+                fprintf (fp->fp, " 62\n%hd\n", leader->common.color);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (leader->elevation != 0.0))
+          && (leader->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", leader->elevation);
+                fprintf (fp->fp, " 38\n%f\n", leader->common.elevation);
         }
-        if (leader->thickness != 0.0)
+        if (leader->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", leader->thickness);
+                fprintf (fp->fp, " 39\n%f\n", leader->common.thickness);
         }
-        if (leader->linetype_scale != 1.0)
+        if (leader->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", leader->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", leader->common.linetype_scale);
         }
-        if (leader->visibility != 0)
+        if (leader->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", leader->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", leader->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -735,7 +556,7 @@ dxf_leader_write
                   __FUNCTION__);
         }
         fprintf (fp->fp, " 77\n%d\n", leader->leader_color);
-        fprintf (fp->fp, "340\n%s\n", leader->annotation_reference_hard);
+        dxf_handle_write (fp, 340, leader->annotation_reference_hard);
         fprintf (fp->fp, "210\n%f\n", leader->extr_x0);
         fprintf (fp->fp, "220\n%f\n", leader->extr_y0);
         fprintf (fp->fp, "230\n%f\n", leader->extr_z0);
@@ -751,6 +572,7 @@ dxf_leader_write
         /*! \todo Xdata belonging to the application ID "ACAD" may
          * follow.\n This describes any dimension overrides that have
          * been applied to this entity. */
+        dxf_entity_common_write_xdata (fp, &leader->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -793,12 +615,12 @@ dxf_leader_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (leader->linetype);
-        free (leader->layer);
-        free (leader->dictionary_owner_soft);
-        free (leader->dictionary_owner_hard);
+        dxf_entity_common_free (&leader->common);
+        dxf_point_free_list (leader->p0);
+        dxf_point_free (leader->p1);
+        dxf_point_free (leader->p2);
+        dxf_point_free (leader->p3);
         free (leader->dimension_style_name);
-        free (leader->annotation_reference_hard);
         free (leader);
         leader = NULL;
 #if DEBUG
@@ -832,6 +654,7 @@ dxf_leader_free_list
         while (leaders != NULL)
         {
                 DxfLeader *iter = (DxfLeader *) leaders->next;
+                leaders->next = NULL;
                 dxf_leader_free (leaders);
                 leaders = (DxfLeader *) iter;
         }
@@ -842,39 +665,139 @@ dxf_leader_free_list
 
 
 /*!
- * \brief Get the ID code from a DXF \c LEADER entity.
+ * \brief Copy a DXF \c LEADER entity.
  *
- * \return ID code.
+ * The copy does not share any memory with \c leader, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
  */
-int
-dxf_leader_get_id_code
+DxfLeader *
+dxf_leader_copy
 (
         DxfLeader *leader
-                /*!< a pointer to a DXF \c LEADER entity. */
+                /*!< a pointer to the DXF \c LEADER entity to copy. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfLeader *copy;
+
         /* Do some basic checks. */
         if (leader == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
-        if (leader->id_code < 0)
+        copy = dxf_leader_new ();
+        if (copy == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, leader, sizeof (DxfLeader));
+        copy->dimension_style_name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &leader->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_leader_free (copy);
+                return (NULL);
+        }
+        if (leader->dimension_style_name != NULL)
+        {
+                copy->dimension_style_name = strdup (leader->dimension_style_name);
+                if (copy->dimension_style_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_leader_free (copy);
+                        return (NULL);
+                }
+        }
+        if (leader->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy_list (leader->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_leader_free (copy);
+                        return (NULL);
+                }
+        }
+        if (leader->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (leader->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_leader_free (copy);
+                        return (NULL);
+                }
+        }
+        if (leader->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (leader->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_leader_free (copy);
+                        return (NULL);
+                }
+        }
+        if (leader->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (leader->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_leader_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Get the ID code from a DXF \c LEADER entity.
+ *
+ * \return ID code.
+ */
+DxfHandle
+dxf_leader_get_id_code
+(
+        DxfLeader *leader
+                /*!< a pointer to a DXF \c LEADER entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (leader == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->id_code);
+        return (leader->common.id_code);
 }
 
 
@@ -886,7 +809,7 @@ dxf_leader_set_id_code
 (
         DxfLeader *leader,
                 /*!< a pointer to a DXF \c LEADER entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -903,14 +826,7 @@ dxf_leader_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        leader->id_code = id_code;
+        leader->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -941,7 +857,7 @@ dxf_leader_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (leader->linetype ==  NULL)
+        if (leader->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -951,7 +867,7 @@ dxf_leader_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->linetype));
+        return (strdup (leader->common.linetype));
 }
 
 
@@ -985,7 +901,7 @@ dxf_leader_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->linetype = strdup (linetype);
+        leader->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1016,7 +932,7 @@ dxf_leader_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (leader->layer ==  NULL)
+        if (leader->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1026,7 +942,7 @@ dxf_leader_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->layer));
+        return (strdup (leader->common.layer));
 }
 
 
@@ -1060,7 +976,7 @@ dxf_leader_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->layer = strdup (layer);
+        leader->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1094,7 +1010,7 @@ dxf_leader_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->elevation);
+        return (leader->common.elevation);
 }
 
 
@@ -1121,7 +1037,7 @@ dxf_leader_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->elevation = elevation;
+        leader->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1152,7 +1068,7 @@ dxf_leader_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->thickness < 0.0)
+        if (leader->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1162,7 +1078,7 @@ dxf_leader_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->thickness);
+        return (leader->common.thickness);
 }
 
 
@@ -1196,7 +1112,7 @@ dxf_leader_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->thickness = thickness;
+        leader->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1227,7 +1143,7 @@ dxf_leader_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->linetype_scale < 0.0)
+        if (leader->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1237,7 +1153,7 @@ dxf_leader_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->linetype_scale);
+        return (leader->common.linetype_scale);
 }
 
 
@@ -1271,7 +1187,7 @@ dxf_leader_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->linetype_scale = linetype_scale;
+        leader->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1302,14 +1218,14 @@ dxf_leader_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->visibility < 0)
+        if (leader->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->visibility > 1)
+        if (leader->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1319,7 +1235,7 @@ dxf_leader_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->visibility);
+        return (leader->common.visibility);
 }
 
 
@@ -1360,7 +1276,7 @@ dxf_leader_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->visibility = visibility;
+        leader->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1391,7 +1307,7 @@ dxf_leader_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->color < 0)
+        if (leader->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1400,7 +1316,7 @@ dxf_leader_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->color);
+        return (leader->common.color);
 }
 
 
@@ -1433,7 +1349,7 @@ dxf_leader_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        leader->color = color;
+        leader->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1464,13 +1380,13 @@ dxf_leader_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (leader->paperspace < 0)
+        if (leader->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (leader->paperspace > 1)
+        if (leader->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1479,7 +1395,7 @@ dxf_leader_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (leader->paperspace);
+        return (leader->common.paperspace);
 }
 
 
@@ -1520,7 +1436,7 @@ dxf_leader_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->paperspace = paperspace;
+        leader->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1554,17 +1470,10 @@ dxf_leader_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (leader->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dictionary_owner_soft));
+        return (dxf_handle_to_string (leader->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1600,7 +1509,7 @@ dxf_leader_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        leader->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1634,17 +1543,10 @@ dxf_leader_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (leader->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->dictionary_owner_hard));
+        return (dxf_handle_to_string (leader->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1680,7 +1582,7 @@ dxf_leader_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        leader->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1757,7 +1659,7 @@ dxf_leader_set_dimension_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->layer = strdup (dimension_style_name);
+        leader->common.layer = strdup (dimension_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4054,17 +3956,10 @@ dxf_leader_get_annotation_reference_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (leader->annotation_reference_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (leader->annotation_reference_hard));
+        return (dxf_handle_to_string (leader->annotation_reference_hard));
 }
 
 
@@ -4100,7 +3995,7 @@ dxf_leader_set_annotation_reference_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        leader->annotation_reference_hard = strdup (annotation_reference_hard);
+        leader->annotation_reference_hard = dxf_handle_parse (annotation_reference_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
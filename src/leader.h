@@ -46,6 +46,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "point.h"
 
 
@@ -61,57 +64,9 @@ typedef struct
 dxf_leader_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360. */
-        /* Specific members for a DXF 3D face. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         char *dimension_style_name;
                 /*!< Dimension style name.\n
                  * Group code = 3. */
@@ -200,7 +155,7 @@ dxf_leader_struct
                 /*!< the Annotation placement point offset from last
                  * leader vertex.\n
                  * Group codes = 213, 223 and 233. */
-        char *annotation_reference_hard;
+        DxfHandle annotation_reference_hard;
                 /*!< Hard reference to associated annotation (mtext,
                  * tolerance, or insert entity).\n
                  * Group code = 340. */
@@ -216,8 +171,9 @@ DxfLeader *dxf_leader_read (DxfFile *fp, DxfLeader *leader);
 int dxf_leader_write (DxfFile *fp, DxfLeader *leader);
 int dxf_leader_free (DxfLeader *leader);
 void dxf_leader_free_list (DxfLeader *leaders);
-int dxf_leader_get_id_code (DxfLeader *leader);
-DxfLeader *dxf_leader_set_id_code (DxfLeader *leader, int id_code);
+DxfLeader *dxf_leader_copy (DxfLeader *leader);
+DxfHandle dxf_leader_get_id_code (DxfLeader *leader);
+DxfLeader *dxf_leader_set_id_code (DxfLeader *leader, DxfHandle id_code);
 char *dxf_leader_get_linetype (DxfLeader *leader);
 DxfLeader *dxf_leader_set_linetype (DxfLeader *leader, char *linetype);
 char *dxf_leader_get_layer (DxfLeader *leader);
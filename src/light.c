@@ -36,6 +36,7 @@
 
 
 #include "light.h"
+#include "entities.h"
 
 
 /*!
@@ -108,28 +109,16 @@ dxf_light_init
                 __FUNCTION__);
               return (NULL);
         }
-        light->id_code = 0;
-        light->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        light->layer = strdup (DXF_DEFAULT_LAYER);
-        light->thickness = 0.0;
-        light->linetype_scale = 0.0;
-        light->visibility = 0;
-        light->color = DXF_COLOR_BYLAYER;
-        light->paperspace = DXF_MODELSPACE;
-        light->graphics_data_size = 0;
-        light->shadow_mode = 0;
-        light->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (light->binary_graphics_data);
-        light->dictionary_owner_hard = strdup ("");
-        light->material = strdup ("");
-        light->dictionary_owner_soft = strdup ("");
-        light->lineweight = 0;
-        light->plot_style_name = strdup ("");
-        light->color_value = 0;
-        light->color_name = strdup ("");
-        light->transparency = 0;
+        if (dxf_entity_common_init (&light->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         light->light_name = strdup ("");
-        light->p0 = dxf_point_init (light->p0);
-        light->p1 = dxf_point_init (light->p1);
+        light->p0 = dxf_point_init (dxf_point_new ());
+        light->p1 = dxf_point_init (dxf_point_new ());
         light->intensity = 0.0;
         light->attenuation_start_limit = 0.0;
         light->attenuation_end_limit = 0.0;
@@ -177,7 +166,9 @@ dxf_light_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -185,8 +176,6 @@ dxf_light_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (light == NULL)
@@ -194,325 +183,139 @@ dxf_light_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                light = dxf_light_init (light);
+                light = dxf_light_init (dxf_light_new ());
+                if (light == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &light->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the axis base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->p1->z0);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * intensity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->intensity);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attenuation start limit. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->attenuation_start_limit);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attenuation end limit. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->attenuation_end_limit);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the hotspot
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->hotspot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the falloff
-                         * angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &light->falloff_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &light->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing a light type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->light_type);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing an
-                         * attenuation type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->attenuation_type);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing a shadow type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->shadow_type);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing a version
-                         * number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &light->version_number);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing a shadow map
-                         * size. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &light->shadow_map_size);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                                && ((strcmp (temp_string, "AcDbLight") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "280") == 0)
-                {
-                        /* Now follows a string containing a shadow map
-                         * softness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hi\n", &light->shadow_map_softness);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &light->shadow_mode);
-                }
-                else if (strcmp (temp_string, "290") == 0)
-                {
-                        /* Now follows a string containing a status
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &light->status);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) light->binary_graphics_data->next);
-                        light->binary_graphics_data = (DxfBinaryGraphicsData *) light->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a
-                         * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->dictionary_owner_soft);
+                        break;
                 }
-                else if (strcmp (temp_string, "347") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->material);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &light->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &light->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &light->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 1:
+                                free (light->light_name);
+                                light->light_name = strdup (value);
+                                break;
+                        case 10:
+                                light->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                light->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                light->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                light->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                light->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                light->p1->z0 = atof (value);
+                                break;
+                        case 40:
+                                light->intensity = atof (value);
+                                break;
+                        case 41:
+                                light->attenuation_start_limit = atof (value);
+                                break;
+                        case 42:
+                                light->attenuation_end_limit = atof (value);
+                                break;
+                        case 50:
+                                light->hotspot_angle = atof (value);
+                                break;
+                        case 51:
+                                light->falloff_angle = atof (value);
+                                break;
+                        case 70:
+                                light->light_type = atoi (value);
+                                break;
+                        case 72:
+                                light->attenuation_type = atoi (value);
+                                break;
+                        case 73:
+                                light->shadow_type = atoi (value);
+                                break;
+                        case 90:
+                                light->version_number = atoi (value);
+                                break;
+                        case 91:
+                                light->shadow_map_size = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbLight") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 280:
+                                light->shadow_map_softness = atoi (value);
+                                break;
+                        case 290:
+                                light->status = atoi (value);
+                                break;
+                        case 291:
+                                light->plot_glyph = atoi (value);
+                                break;
+                        case 292:
+                                light->use_attenuation_limits = atoi (value);
+                                break;
+                        case 293:
+                                light->cast_shadows = atoi (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &light->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (light->linetype, "") == 0)
+        if ((light->common.linetype == NULL)
+          || (strcmp (light->common.linetype, "") == 0))
         {
-                light->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (light->common.linetype);
+                light->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (light->layer, "") == 0)
+        if ((light->common.layer == NULL)
+          || (strcmp (light->common.layer, "") == 0))
         {
-                light->layer = strdup (DXF_DEFAULT_LAYER);
+                free (light->common.layer);
+                light->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -539,7 +342,6 @@ dxf_light_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LIGHT");
-        DxfBinaryGraphicsData *iter_310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -566,80 +368,78 @@ dxf_light_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (light->linetype, "") == 0)
+        if (strcmp (light->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, light->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, light->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                light->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                light->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (light->layer, "") == 0)
+        if (strcmp (light->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, light->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, light->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                light->layer = DXF_DEFAULT_LAYER;
+                light->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (light->id_code != -1)
+        if (light->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", light->id_code);
+                dxf_handle_write (fp, 5, light->common.id_code);
         }
-        fprintf (fp->fp, "330\n%s\n", light->dictionary_owner_soft);
+        dxf_handle_write (fp, 330, light->common.cold->dictionary_owner_soft);
         fprintf (fp->fp, "100\nAcDbEntity\n");
-        if (light->paperspace != DXF_MODELSPACE)
+        if (light->common.paperspace != DXF_MODELSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", light->layer);
-        if (strcmp (light->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", light->common.layer);
+        if (strcmp (light->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", light->linetype);
+                fprintf (fp->fp, "  6\n%s\n", light->common.linetype);
         }
-        if (strcmp (light->material, "") != 0)
+        if (light->common.cold->material != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "347\n%s\n", light->material);
+                dxf_handle_write (fp, 347, light->common.cold->material);
         }
-        if (light->color != DXF_COLOR_BYLAYER)
+        if (light->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", light->color);
+                fprintf (fp->fp, " 62\n%hd\n", light->common.color);
         }
-        fprintf (fp->fp, "370\n%d\n", light->lineweight);
-        if (light->thickness != 0.0)
+        fprintf (fp->fp, "370\n%hd\n", light->common.lineweight);
+        if (light->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", light->thickness);
+                fprintf (fp->fp, " 39\n%f\n", light->common.thickness);
         }
-        if (light->linetype_scale != 1.0)
+        if (light->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", light->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", light->common.linetype_scale);
         }
-        if (light->visibility != 0)
+        if (light->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", light->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", light->common.visibility);
         }
 #ifdef BUILD_64
-        fprintf (fp->fp, "160\n%d\n", light->graphics_data_size);
+        fprintf (fp->fp, "160\n%" PRIi32 "\n", light->common.cold->graphics_data_size);
 #else
-        fprintf (fp->fp, " 92\n%d\n", light->graphics_data_size);
+        fprintf (fp->fp, " 92\n%" PRIi32 "\n", light->common.cold->graphics_data_size);
 #endif
-        iter_310 = (DxfBinaryGraphicsData *) light->binary_graphics_data;
-        while (iter_310 != NULL)
+        if (light->common.cold->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
-                iter_310 = (DxfBinaryGraphicsData *) iter_310->next;
+                dxf_binary_buffer_write (fp, 310, light->common.cold->binary_graphics_data);
         }
-        fprintf (fp->fp, "420\n%ld\n", light->color_value);
-        fprintf (fp->fp, "430\n%s\n", light->color_name);
-        fprintf (fp->fp, "440\n%ld\n", light->transparency);
-        fprintf (fp->fp, "390\n%s\n", light->plot_style_name);
-        fprintf (fp->fp, "284\n%d\n", light->shadow_mode);
+        fprintf (fp->fp, "420\n%" PRIi32 "\n", light->common.color_value);
+        fprintf (fp->fp, "430\n%s\n", light->common.cold->color_name);
+        fprintf (fp->fp, "440\n%" PRIi32 "\n", light->common.cold->transparency);
+        dxf_handle_write (fp, 390, light->common.cold->plot_style_name);
+        fprintf (fp->fp, "284\n%hd\n", light->common.cold->shadow_mode);
         fprintf (fp->fp, "100\nAcDbLight\n");
         fprintf (fp->fp, " 90\n%hi\n", light->version_number);
         fprintf (fp->fp, "  1\n%s\n", light->light_name);
@@ -663,6 +463,7 @@ dxf_light_write
         fprintf (fp->fp, " 73\n%hi\n", light->shadow_type);
         fprintf (fp->fp, " 91\n%hi\n", light->shadow_map_size);
         fprintf (fp->fp, "280\n%d\n", light->shadow_map_softness);
+        dxf_entity_common_write_xdata (fp, &light->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -705,14 +506,7 @@ dxf_light_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (light->linetype);
-        free (light->layer);
-        dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) light->binary_graphics_data);
-        free (light->dictionary_owner_hard);
-        free (light->material);
-        free (light->dictionary_owner_soft);
-        free (light->plot_style_name);
-        free (light->color_name);
+        dxf_entity_common_free (&light->common);
         free (light->light_name);
         dxf_point_free (light->p0);
         dxf_point_free (light->p1);
@@ -749,6 +543,7 @@ dxf_light_free_list
         while (light_list != NULL)
         {
                 DxfLight *iter = (DxfLight *) light_list->next;
+                light_list->next = NULL;
                 dxf_light_free (light_list);
                 light_list = (DxfLight *) iter;
         }
@@ -758,13 +553,100 @@ dxf_light_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c LIGHT entity.
+ *
+ * The copy does not share any memory with \c light, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLight *
+dxf_light_copy
+(
+        DxfLight *light
+                /*!< a pointer to the DXF \c LIGHT entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLight *copy;
+
+        /* Do some basic checks. */
+        if (light == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_light_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, light, sizeof (DxfLight));
+        copy->light_name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &light->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_light_free (copy);
+                return (NULL);
+        }
+        if (light->light_name != NULL)
+        {
+                copy->light_name = strdup (light->light_name);
+                if (copy->light_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_light_free (copy);
+                        return (NULL);
+                }
+        }
+        if (light->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (light->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_light_free (copy);
+                        return (NULL);
+                }
+        }
+        if (light->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (light->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_light_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c LIGHT entity.
  *
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_light_get_id_code
 (
         DxfLight *light
@@ -782,16 +664,10 @@ dxf_light_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->id_code);
+        return (light->common.id_code);
 }
 
 
@@ -806,7 +682,7 @@ dxf_light_set_id_code
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -823,13 +699,7 @@ dxf_light_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        light->id_code = id_code;
+        light->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -860,7 +730,7 @@ dxf_light_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->linetype ==  NULL)
+        if (light->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -870,7 +740,7 @@ dxf_light_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->linetype));
+        return (strdup (light->common.linetype));
 }
 
 
@@ -907,7 +777,7 @@ dxf_light_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        light->linetype = strdup (linetype);
+        light->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -938,7 +808,7 @@ dxf_light_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->layer ==  NULL)
+        if (light->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -948,7 +818,7 @@ dxf_light_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->layer));
+        return (strdup (light->common.layer));
 }
 
 
@@ -985,7 +855,7 @@ dxf_light_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        light->layer = strdup (layer);
+        light->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1017,7 +887,7 @@ dxf_light_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->thickness < 0.0)
+        if (light->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1026,7 +896,7 @@ dxf_light_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->thickness);
+        return (light->common.thickness);
 }
 
 
@@ -1062,7 +932,7 @@ dxf_light_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        light->thickness = thickness;
+        light->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1094,7 +964,7 @@ dxf_light_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->linetype_scale < 0.0)
+        if (light->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1103,7 +973,7 @@ dxf_light_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->linetype_scale);
+        return (light->common.linetype_scale);
 }
 
 
@@ -1139,7 +1009,7 @@ dxf_light_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        light->linetype_scale = linetype_scale;
+        light->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1171,13 +1041,13 @@ dxf_light_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->visibility < 0)
+        if (light->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (light->visibility > 1)
+        if (light->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1186,7 +1056,7 @@ dxf_light_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->visibility);
+        return (light->common.visibility);
 }
 
 
@@ -1228,7 +1098,7 @@ dxf_light_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        light->visibility = visibility;
+        light->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1260,7 +1130,7 @@ dxf_light_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->color < 0)
+        if (light->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1269,7 +1139,7 @@ dxf_light_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->color);
+        return (light->common.color);
 }
 
 
@@ -1307,7 +1177,7 @@ dxf_light_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        light->color = color;
+        light->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1339,13 +1209,13 @@ dxf_light_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->paperspace < 0)
+        if (light->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (light->paperspace > 1)
+        if (light->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1354,7 +1224,7 @@ dxf_light_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->paperspace);
+        return (light->common.paperspace);
 }
 
 
@@ -1397,7 +1267,7 @@ dxf_light_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        light->paperspace = paperspace;
+        light->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1429,13 +1299,13 @@ dxf_light_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->graphics_data_size < 0)
+        if (light->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (light->graphics_data_size == 0)
+        if (light->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1444,7 +1314,7 @@ dxf_light_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->graphics_data_size);
+        return (light->common.cold->graphics_data_size);
 }
 
 
@@ -1487,7 +1357,7 @@ dxf_light_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        light->graphics_data_size = graphics_data_size;
+        light->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1519,13 +1389,13 @@ dxf_light_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (light->shadow_mode < 0)
+        if (light->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (light->shadow_mode > 3)
+        if (light->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1534,7 +1404,7 @@ dxf_light_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->shadow_mode);
+        return (light->common.cold->shadow_mode);
 }
 
 
@@ -1576,7 +1446,7 @@ dxf_light_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        light->shadow_mode = shadow_mode;
+        light->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1585,14 +1455,15 @@ dxf_light_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the binary graphics data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c LIGHT entity.
  *
- * \return pointer to the binary graphics data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_light_get_binary_graphics_data
 (
         DxfLight *light
@@ -1610,24 +1481,20 @@ dxf_light_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) light->binary_graphics_data);
+        return (light->common.cold->binary_graphics_data);
 }
 
 
 /*!
- * \brief Set the pointer to the binary_graphics_data for a DXF
+ * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c LIGHT entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c light when successful, or \c NULL when an
  * error occurred.
  */
@@ -1636,9 +1503,9 @@ dxf_light_set_binary_graphics_data
 (
         DxfLight *light,
                 /*!< a pointer to a DXF \c LIGHT entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1659,7 +1526,12 @@ dxf_light_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        light->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((light->common.cold->binary_graphics_data != NULL)
+          && (light->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (light->common.cold->binary_graphics_data);
+        }
+        light->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1694,17 +1566,10 @@ dxf_light_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->dictionary_owner_soft));
+        return (dxf_handle_to_string (light->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1743,7 +1608,7 @@ dxf_light_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        light->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        light->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1777,17 +1642,10 @@ dxf_light_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->object_owner_soft));
+        return (dxf_handle_to_string (light->common.cold->object_owner_soft));
 }
 
 
@@ -1823,7 +1681,7 @@ dxf_light_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        light->object_owner_soft = strdup (object_owner_soft);
+        light->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1857,17 +1715,10 @@ dxf_light_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->material));
+        return (dxf_handle_to_string (light->common.cold->material));
 }
 
 
@@ -1905,7 +1756,7 @@ dxf_light_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        light->material = strdup (material);
+        light->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1940,17 +1791,10 @@ dxf_light_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->dictionary_owner_hard));
+        return (dxf_handle_to_string (light->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1989,7 +1833,7 @@ dxf_light_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        light->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        light->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2024,7 +1868,7 @@ dxf_light_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->lineweight);
+        return (light->common.lineweight);
 }
 
 
@@ -2054,7 +1898,7 @@ dxf_light_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        light->lineweight = lineweight;
+        light->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2086,17 +1930,10 @@ dxf_light_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->plot_style_name));
+        return (dxf_handle_to_string (light->common.cold->plot_style_name));
 }
 
 
@@ -2134,7 +1971,7 @@ dxf_light_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        light->plot_style_name = strdup (plot_style_name);
+        light->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2169,7 +2006,7 @@ dxf_light_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->color_value);
+        return (light->common.color_value);
 }
 
 
@@ -2199,7 +2036,7 @@ dxf_light_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        light->color_value = color_value;
+        light->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2231,7 +2068,7 @@ dxf_light_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (light->color_name ==  NULL)
+        if (light->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2241,7 +2078,7 @@ dxf_light_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (light->color_name));
+        return (strdup (light->common.cold->color_name));
 }
 
 
@@ -2279,7 +2116,7 @@ dxf_light_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        light->color_name = strdup (color_name);
+        light->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2314,7 +2151,7 @@ dxf_light_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (light->transparency);
+        return (light->common.cold->transparency);
 }
 
 
@@ -2344,7 +2181,7 @@ dxf_light_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        light->transparency = transparency;
+        light->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
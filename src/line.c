@@ -40,6 +40,23 @@
 
 
 #include "line.h"
+#include "entities.h"
+
+
+/*!
+ * \brief Prototype with the default values of a DXF \c LINE entity.
+ */
+static const DxfLine dxf_line_prototype =
+{
+        .common = DXF_ENTITY_COMMON_DEFAULTS,
+        .p0 = NULL,
+        .p1 = NULL,
+        .offsets = NULL,
+        .extr_x0 = 0.0,
+        .extr_y0 = 0.0,
+        .extr_z0 = 0.0,
+        .next = NULL
+};
 
 
 /*!
@@ -116,15 +133,14 @@ dxf_line_init
               return (NULL);
         }
         /* Initialize new structs for members. */
-        line->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (line->binary_graphics_data);
-        if (line->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&line->common) == NULL)
         {
               fprintf (stderr,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        line->p0 = (DxfPoint *) dxf_point_init (line->p0);
+        line->p0 = dxf_point_init (dxf_point_new ());
         if (line->p0 == NULL)
         {
               fprintf (stderr,
@@ -132,7 +148,7 @@ dxf_line_init
                 __FUNCTION__);
               return (NULL);
         }
-        line->p1 = (DxfPoint *) dxf_point_init (line->p1);
+        line->p1 = dxf_point_init (dxf_point_new ());
         if (line->p1 == NULL)
         {
               fprintf (stderr,
@@ -141,32 +157,13 @@ dxf_line_init
               return (NULL);
         }
         /* Assign initial values to members. */
-        line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
-        line->elevation = 0.0;
-        line->thickness = 0.0;
-        line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        line->visibility = DXF_DEFAULT_VISIBILITY;
-        line->color = DXF_COLOR_BYLAYER;
-        line->paperspace = DXF_MODELSPACE;
-        line->graphics_data_size = 0;
-        line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
-        line->lineweight = 0;
-        line->plot_style_name = strdup ("");
-        line->color_value = 0;
-        line->color_name = strdup ("");
-        line->transparency = 0;
         line->p0->x0 = 0.0;
         line->p0->y0 = 0.0;
         line->p0->z0 = 0.0;
         line->p1->x0 = 0.0;
         line->p1->y0 = 0.0;
         line->p1->z0 = 0.0;
+        line->offsets = NULL;
         line->extr_x0 = 0.0;
         line->extr_y0 = 0.0;
         line->extr_z0 = 0.0;
@@ -178,6 +175,114 @@ dxf_line_init
 }
 
 
+/*!
+ * \brief Initialize a DXF \c LINE entity in memory provided by the
+ * caller from the default prototype.
+ *
+ * The defaults are copied with a single memcpy (), the start and end
+ * point are cleared and only hold coordinates.\n
+ * Used by dxf_entities_create_lines () to initialize lines carved from
+ * one contiguous block.
+ *
+ * \return a pointer to \c line, or \c NULL when an error occurred, in
+ * which case the common data is freed by dxf_entity_common_free ().
+ */
+DxfLine *
+dxf_line_init_from_prototype
+(
+        DxfLine *line,
+                /*!< memory for a DXF \c LINE entity. */
+        DxfPoint *p0,
+                /*!< memory for the start point of the entity. */
+        DxfPoint *p1,
+                /*!< memory for the end point of the entity. */
+        const char *layer
+                /*!< layer of the entity, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((line == NULL) || (p0 == NULL) || (p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (line, &dxf_line_prototype, sizeof (DxfLine));
+        memset (p0, 0, sizeof (DxfPoint));
+        memset (p1, 0, sizeof (DxfPoint));
+        line->p0 = p0;
+        line->p1 = p1;
+        if (dxf_entity_common_init_from_prototype (&line->common, layer) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (line);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF \c LINE entity and initialize it
+ * from the default prototype.
+ *
+ * Faster than dxf_line_init () when creating many entities: the
+ * defaults are copied with a single memcpy () and the start and end
+ * points only hold coordinates, their other members are not
+ * allocated.
+ *
+ * \return a pointer to the new entity, or \c NULL when an error
+ * occurred.
+ */
+DxfLine *
+dxf_line_new_from_prototype
+(
+        const char *layer
+                /*!< layer of the entity, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLine *line;
+        DxfPoint *p0;
+        DxfPoint *p1;
+
+        line = malloc (sizeof (DxfLine));
+        p0 = dxf_point_new ();
+        p1 = dxf_point_new ();
+        if ((line == NULL) || (p0 == NULL) || (p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLine struct.\n")),
+                  __FUNCTION__);
+                free (line);
+                free (p0);
+                free (p1);
+                return (NULL);
+        }
+        if (dxf_line_init_from_prototype (line, p0, p1, layer) == NULL)
+        {
+                dxf_line_free (line);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (line);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c LINE entity.
  *
@@ -185,7 +290,10 @@ dxf_line_init
  * Now follows some data for the \c LINE, to be terminated with a
  * "  0" string announcing the following entity, or the end of the
  * \c ENTITY section marker \c ENDSEC. \n
- * While parsing the DXF file store data in \c line.
+ * While parsing the DXF file store data in \c line.\n
+ * When single precision was requested with
+ * dxf_read_set_single_precision () the end points are stored as
+ * single precision offsets.
  *
  * \return a pointer to \c line.
  */
@@ -201,9 +309,9 @@ dxf_line_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -211,8 +319,6 @@ dxf_line_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
@@ -220,284 +326,110 @@ dxf_line_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                line = dxf_line_init (line);
+                line = dxf_line_init (dxf_line_new ());
+                if (line == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        if ((line->p0 == NULL) || (line->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
-        iter310 = (DxfBinaryData *) line->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &line->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbLine") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->transparency);
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                line->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                line->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                line->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                line->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                line->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                line->p1->z0 = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbLine") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                line->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                line->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                line->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &line->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (line->linetype, "") == 0)
+        if ((line->common.linetype == NULL)
+          || (strcmp (line->common.linetype, "") == 0))
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (line->common.linetype);
+                line->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (line->layer, "") == 0)
+        if ((line->common.layer == NULL)
+          || (strcmp (line->common.layer, "") == 0))
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                free (line->common.layer);
+                line->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
+        if (fp->single_precision)
+        {
+                dxf_line_set_single_precision (line, fp->origin_x, fp->origin_y, fp->origin_z);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -524,6 +456,12 @@ dxf_line_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LINE");
+        double x0;
+        double y0;
+        double z0;
+        double x1;
+        double y1;
+        double z1;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -544,43 +482,66 @@ dxf_line_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if ((line->p0->x0 == line->p1->x0)
-                && (line->p0->y0 == line->p1->y0)
-                && (line->p0->z0 == line->p1->z0))
+        if (line->offsets != NULL)
+        {
+                dxf_point_offsets_get (line->offsets, 0, &x0, &y0, &z0);
+                dxf_point_offsets_get (line->offsets, 1, &x1, &y1, &z1);
+        }
+        else if ((line->p0 != NULL) && (line->p1 != NULL))
+        {
+                x0 = line->p0->x0;
+                y0 = line->p0->y0;
+                z0 = line->p0->z0;
+                x1 = line->p1->x0;
+                y1 = line->p1->y0;
+                z1 = line->p1->z0;
+        }
+        else
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        if ((x0 == x1)
+                && (y0 == y1)
+                && (z0 == z1))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, line->id_code);
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, line->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (line->linetype, "") == 0)
+        if (strcmp (line->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, line->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, line->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (line->layer, "") == 0)
+        if (strcmp (line->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, line->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, line->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (line->id_code != -1)
+        if (line->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", line->id_code);
+                dxf_handle_write (fp, 5, line->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -592,109 +553,103 @@ dxf_line_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (line->dictionary_owner_soft, "") != 0)
+        if ((line->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", line->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, line->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (line->dictionary_owner_hard, "") != 0)
+        if ((line->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", line->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, line->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (line->object_owner_soft, "") != 0)
+        if ((line->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", line->object_owner_soft);
+                dxf_handle_write (fp, 330, line->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (line->paperspace == DXF_PAPERSPACE)
+        if (line->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
-        if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", line->common.layer);
+        if (strcmp (line->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", line->linetype);
+                fprintf (fp->fp, "  6\n%s\n", line->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (line->material, "") != 0))
+          && (line->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", line->material);
+                dxf_handle_write (fp, 347, line->common.cold->material);
         }
-        if (line->color != DXF_COLOR_BYLAYER)
+        if (line->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", line->color);
+                fprintf (fp->fp, " 62\n%hd\n", line->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%hd\n", line->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", line->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (line->elevation != 0.0))
+          && (line->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", line->elevation);
+                fprintf (fp->fp, " 38\n%f\n", line->common.elevation);
         }
-        if (line->thickness != 0.0)
+        if (line->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", line->thickness);
+                fprintf (fp->fp, " 39\n%f\n", line->common.thickness);
         }
-        if (line->linetype_scale != 1.0)
+        if (line->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", line->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", line->common.linetype_scale);
         }
-        if (line->visibility != 0)
+        if (line->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", line->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", line->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (line->graphics_data_size > 0))
+          && (line->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->common.cold->graphics_data_size);
 #endif
-                if (line->binary_graphics_data != NULL)
+                if (line->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) line->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, line->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->color_value);
-                fprintf (fp->fp, "430\n%s\n", line->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", line->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", line->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", line->shadow_mode);
+                dxf_handle_write (fp, 390, line->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", line->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbLine\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", line->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", line->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", line->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", line->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", line->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", line->p1->z0);
+        fprintf (fp->fp, " 10\n%f\n", x0);
+        fprintf (fp->fp, " 20\n%f\n", y0);
+        fprintf (fp->fp, " 30\n%f\n", z0);
+        fprintf (fp->fp, " 11\n%f\n", x1);
+        fprintf (fp->fp, " 21\n%f\n", y1);
+        fprintf (fp->fp, " 31\n%f\n", z1);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (line->extr_x0 != 0.0)
                 && (line->extr_y0 != 0.0)
@@ -704,6 +659,7 @@ dxf_line_write
                 fprintf (fp->fp, "220\n%f\n", line->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", line->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &line->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -746,17 +702,19 @@ dxf_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
-        dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
-        dxf_point_free (line->p0);
-        dxf_point_free (line->p1);
+        dxf_entity_common_free (&line->common);
+        if (line->p0 != NULL)
+        {
+                dxf_point_free (line->p0);
+        }
+        if (line->p1 != NULL)
+        {
+                dxf_point_free (line->p1);
+        }
+        if (line->offsets != NULL)
+        {
+                dxf_point_offsets_free (line->offsets);
+        }
         free (line);
         line = NULL;
 #if DEBUG
@@ -790,6 +748,7 @@ dxf_line_free_list
         while (lines != NULL)
         {
                 DxfLine *iter = (DxfLine *) lines->next;
+                lines->next = NULL;
                 dxf_line_free (lines);
                 lines = (DxfLine *) iter;
         }
@@ -799,12 +758,109 @@ dxf_line_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c LINE entity.
+ *
+ * The copy does not share any memory with \c line, its \c next
+ * member is \c NULL.\n
+ * Of the points only the coordinates are copied.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLine *
+dxf_line_copy
+(
+        DxfLine *line
+                /*!< a pointer to the DXF \c LINE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLine *copy;
+
+        /* Do some basic checks. */
+        if (line == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_line_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, line, sizeof (DxfLine));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->offsets = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &line->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_line_free (copy);
+                return (NULL);
+        }
+        if (line->p0 != NULL)
+        {
+                copy->p0 = dxf_point_new ();
+                if (copy->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_line_free (copy);
+                        return (NULL);
+                }
+                copy->p0->x0 = line->p0->x0;
+                copy->p0->y0 = line->p0->y0;
+                copy->p0->z0 = line->p0->z0;
+        }
+        if (line->p1 != NULL)
+        {
+                copy->p1 = dxf_point_new ();
+                if (copy->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_line_free (copy);
+                        return (NULL);
+                }
+                copy->p1->x0 = line->p1->x0;
+                copy->p1->y0 = line->p1->y0;
+                copy->p1->z0 = line->p1->z0;
+        }
+        if (line->offsets != NULL)
+        {
+                copy->offsets = dxf_point_offsets_copy (line->offsets);
+                if (copy->offsets == NULL)
+                {
+                        dxf_line_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c LINE entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_line_get_id_code
 (
         DxfLine *line
@@ -822,16 +878,10 @@ dxf_line_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->id_code);
+        return (line->common.id_code);
 }
 
 
@@ -843,7 +893,7 @@ dxf_line_set_id_code
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -860,13 +910,7 @@ dxf_line_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        line->id_code = id_code;
+        line->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -897,7 +941,7 @@ dxf_line_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->linetype ==  NULL)
+        if (line->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -907,7 +951,7 @@ dxf_line_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (strdup (line->common.linetype));
 }
 
 
@@ -941,7 +985,7 @@ dxf_line_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -972,7 +1016,7 @@ dxf_line_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->layer ==  NULL)
+        if (line->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -982,7 +1026,7 @@ dxf_line_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (strdup (line->common.layer));
 }
 
 
@@ -1016,7 +1060,7 @@ dxf_line_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1050,7 +1094,7 @@ dxf_line_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->elevation);
+        return (line->common.elevation);
 }
 
 
@@ -1077,7 +1121,7 @@ dxf_line_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        line->elevation = elevation;
+        line->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1108,7 +1152,7 @@ dxf_line_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->thickness < 0.0)
+        if (line->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1117,7 +1161,7 @@ dxf_line_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->thickness);
+        return (line->common.thickness);
 }
 
 
@@ -1150,7 +1194,7 @@ dxf_line_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        line->thickness = thickness;
+        line->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1181,7 +1225,7 @@ dxf_line_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->linetype_scale < 0.0)
+        if (line->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1190,7 +1234,7 @@ dxf_line_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->linetype_scale);
+        return (line->common.linetype_scale);
 }
 
 
@@ -1223,7 +1267,7 @@ dxf_line_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        line->linetype_scale = linetype_scale;
+        line->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1254,13 +1298,13 @@ dxf_line_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->visibility < 0)
+        if (line->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->visibility > 1)
+        if (line->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1269,7 +1313,7 @@ dxf_line_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->visibility);
+        return (line->common.visibility);
 }
 
 
@@ -1308,7 +1352,7 @@ dxf_line_set_visibility
                   (_("Waning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        line->visibility = visibility;
+        line->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1339,7 +1383,7 @@ dxf_line_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->color < 0)
+        if (line->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1348,7 +1392,7 @@ dxf_line_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->color);
+        return (line->common.color);
 }
 
 
@@ -1383,7 +1427,7 @@ dxf_line_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        line->color = color;
+        line->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1414,13 +1458,13 @@ dxf_line_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->paperspace < 0)
+        if (line->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->paperspace > 1)
+        if (line->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1429,7 +1473,7 @@ dxf_line_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->paperspace);
+        return (line->common.paperspace);
 }
 
 
@@ -1468,7 +1512,7 @@ dxf_line_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        line->paperspace = paperspace;
+        line->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1501,13 +1545,13 @@ dxf_line_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->graphics_data_size < 0)
+        if (line->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->graphics_data_size == 0)
+        if (line->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1516,7 +1560,7 @@ dxf_line_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->graphics_data_size);
+        return (line->common.cold->graphics_data_size);
 }
 
 
@@ -1560,7 +1604,7 @@ dxf_line_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        line->graphics_data_size = graphics_data_size;
+        line->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1592,13 +1636,13 @@ dxf_line_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (line->shadow_mode < 0)
+        if (line->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (line->shadow_mode > 3)
+        if (line->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1607,7 +1651,7 @@ dxf_line_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->shadow_mode);
+        return (line->common.cold->shadow_mode);
 }
 
 
@@ -1649,7 +1693,7 @@ dxf_line_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        line->shadow_mode = shadow_mode;
+        line->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1661,11 +1705,12 @@ dxf_line_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c LINE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_line_get_binary_graphics_data
 (
         DxfLine *line
@@ -1683,32 +1728,31 @@ dxf_line_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) line->binary_graphics_data);
+        return (line->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c LINE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c line when successful, or \c NULL when an
+ * error occurred.
  */
 DxfLine *
 dxf_line_set_binary_graphics_data
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1729,7 +1773,12 @@ dxf_line_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        line->binary_graphics_data = (DxfBinaryData *) data;
+        if ((line->common.cold->binary_graphics_data != NULL)
+          && (line->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (line->common.cold->binary_graphics_data);
+        }
+        line->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1763,17 +1812,10 @@ dxf_line_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (dxf_handle_to_string (line->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1809,7 +1851,7 @@ dxf_line_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1844,17 +1886,10 @@ dxf_line_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (dxf_handle_to_string (line->common.cold->material));
 }
 
 
@@ -1893,7 +1928,7 @@ dxf_line_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        line->material = strdup (material);
+        line->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1927,17 +1962,10 @@ dxf_line_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (dxf_handle_to_string (line->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1973,7 +2001,7 @@ dxf_line_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2008,7 +2036,7 @@ dxf_line_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->lineweight);
+        return (line->common.lineweight);
 }
 
 
@@ -2038,7 +2066,7 @@ dxf_line_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        line->lineweight = lineweight;
+        line->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2070,17 +2098,10 @@ dxf_line_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (dxf_handle_to_string (line->common.cold->plot_style_name));
 }
 
 
@@ -2118,7 +2139,7 @@ dxf_line_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->plot_style_name = strdup (plot_style_name);
+        line->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2153,7 +2174,7 @@ dxf_line_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->color_value);
+        return (line->common.color_value);
 }
 
 
@@ -2183,7 +2204,7 @@ dxf_line_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_value = color_value;
+        line->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2215,7 +2236,7 @@ dxf_line_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (line->color_name ==  NULL)
+        if (line->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2225,7 +2246,7 @@ dxf_line_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (strdup (line->common.cold->color_name));
 }
 
 
@@ -2263,7 +2284,7 @@ dxf_line_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2298,7 +2319,7 @@ dxf_line_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (line->transparency);
+        return (line->common.cold->transparency);
 }
 
 
@@ -2328,7 +2349,7 @@ dxf_line_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        line->transparency = transparency;
+        line->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3412,7 +3433,7 @@ dxf_line_get_mid_point
 (
         DxfLine *line,
                 /*!< a pointer to a DXF \c LINE entity. */
-        int id_code,
+        DxfHandle id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3456,13 +3477,7 @@ dxf_line_get_mid_point
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        point->id_code = id_code;
+        point->common.id_code = id_code;
         point->x0 = (line->p0->x0 + line->p1->x0) / 2;
         point->y0 = (line->p0->y0 + line->p1->y0) / 2;
         point->z0 = (line->p0->z0 + line->p1->z0) / 2;
@@ -3472,27 +3487,21 @@ dxf_line_get_mid_point
                         /* Do nothing. */
                         break;
                 case 1:
-                        if (line->linetype != NULL)
+                        if (line->common.linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->common.linetype = strdup (line->common.linetype);
                         }
-                        if (line->layer != NULL)
+                        if (line->common.layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
-                        }
-                        point->thickness = line->thickness;
-                        point->linetype_scale = line->linetype_scale;
-                        point->visibility = line->visibility;
-                        point->color = line->color;
-                        point->paperspace = line->paperspace;
-                        if (line->dictionary_owner_soft != NULL)
-                        {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
-                        }
-                        if (line->dictionary_owner_hard != NULL)
-                        {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
+                                point->common.layer = strdup (line->common.layer);
                         }
+                        point->common.thickness = line->common.thickness;
+                        point->common.linetype_scale = line->common.linetype_scale;
+                        point->common.visibility = line->common.visibility;
+                        point->common.color = line->common.color;
+                        point->common.paperspace = line->common.paperspace;
+                        point->common.cold->dictionary_owner_soft = line->common.cold->dictionary_owner_soft;
+                        point->common.cold->dictionary_owner_hard = line->common.cold->dictionary_owner_hard;
                         break;
                 default:
                         fprintf (stderr,
@@ -3572,7 +3581,7 @@ dxf_line_create_from_points
                 /*!< a pointer to a DXF \c POINT entity. */
         DxfPoint *p2,
                 /*!< a pointer to a DXF \c POINT entity. */
-        int id_code,
+        DxfHandle id_code,
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -3622,13 +3631,7 @@ dxf_line_create_from_points
                 __FUNCTION__);
               return (NULL);
         }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                __FUNCTION__);
-        }
-        line->id_code = id_code;
+        line->common.id_code = id_code;
         line->p0->x0 = p1->x0;
         line->p0->y0 = p1->y0;
         line->p0->z0 = p1->z0;
@@ -3641,88 +3644,68 @@ dxf_line_create_from_points
                         /* Do nothing. */
                         break;
                 case 1:
-                        if (p1->linetype != NULL)
-                        {
-                                line->linetype = p1->linetype;
-                        }
-                        if (p1->layer != NULL)
-                        {
-                                line->layer = p1->layer;
-                        }
-                        line->thickness = p1->thickness;
-                        line->linetype_scale = p1->linetype_scale;
-                        line->visibility = p1->visibility;
-                        line->color = p1->color;
-                        line->paperspace = p1->paperspace;
-                        line->graphics_data_size = p1->graphics_data_size;
-                        line-> shadow_mode = p1->shadow_mode;
-                        /*! \todo Do a deep copy of \c binary_graphics_data. */
-                        line->binary_graphics_data = p1->binary_graphics_data;
-                        if (p1->dictionary_owner_soft != NULL)
-                        {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
-                        }
-                        if (p1->material != NULL)
+                        if (p1->common.linetype != NULL)
                         {
-                                line->material = strdup (p1->material);
+                                line->common.linetype = p1->common.linetype;
                         }
-                        if (p1->dictionary_owner_hard != NULL)
+                        if (p1->common.layer != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                line->common.layer = p1->common.layer;
                         }
-                        line->lineweight = p1->lineweight;
-                        if (p1->plot_style_name != NULL)
+                        line->common.thickness = p1->common.thickness;
+                        line->common.linetype_scale = p1->common.linetype_scale;
+                        line->common.visibility = p1->common.visibility;
+                        line->common.color = p1->common.color;
+                        line->common.paperspace = p1->common.paperspace;
+                        line->common.cold->graphics_data_size = p1->common.cold->graphics_data_size;
+                        line->common.cold->shadow_mode = p1->common.cold->shadow_mode;
+                        if (p1->common.cold->binary_graphics_data != NULL)
                         {
-                                line->plot_style_name = strdup (p1->plot_style_name);
+                                line->common.cold->binary_graphics_data = dxf_binary_buffer_copy (p1->common.cold->binary_graphics_data);
                         }
-                        line->color_value = p1->color_value;
-                        if (p1->color_name != NULL)
+                        line->common.cold->dictionary_owner_soft = p1->common.cold->dictionary_owner_soft;
+                        line->common.cold->material = p1->common.cold->material;
+                        line->common.cold->dictionary_owner_hard = p1->common.cold->dictionary_owner_hard;
+                        line->common.lineweight = p1->common.lineweight;
+                        line->common.cold->plot_style_name = p1->common.cold->plot_style_name;
+                        line->common.color_value = p1->common.color_value;
+                        if (p1->common.cold->color_name != NULL)
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->common.cold->color_name = strdup (p1->common.cold->color_name);
                         }
-                        line->transparency = p1->transparency;
+                        line->common.cold->transparency = p1->common.cold->transparency;
                         break;
                 case 2:
-                        if (p2->linetype != NULL)
-                        {
-                                line->linetype = p2->linetype;
-                        }
-                        if (p2->layer != NULL)
-                        {
-                                line->layer = p2->layer;
-                        }
-                        line->thickness = p2->thickness;
-                        line->linetype_scale = p2->linetype_scale;
-                        line->visibility = p2->visibility;
-                        line->color = p2->color;
-                        line->paperspace = p2->paperspace;
-                        line->graphics_data_size = p2->graphics_data_size;
-                        line-> shadow_mode = p2->shadow_mode;
-                        /*! \todo Do a deep copy of \c binary_graphics_data. */
-                        line->binary_graphics_data = p2->binary_graphics_data;
-                        if (p2->dictionary_owner_soft != NULL)
-                        {
-                                line->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
-                        }
-                        if (p2->material != NULL)
+                        if (p2->common.linetype != NULL)
                         {
-                                line->material = strdup (p2->material);
+                                line->common.linetype = p2->common.linetype;
                         }
-                        if (p2->dictionary_owner_hard != NULL)
+                        if (p2->common.layer != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
+                                line->common.layer = p2->common.layer;
                         }
-                        line->lineweight = p2->lineweight;
-                        if (p2->plot_style_name != NULL)
+                        line->common.thickness = p2->common.thickness;
+                        line->common.linetype_scale = p2->common.linetype_scale;
+                        line->common.visibility = p2->common.visibility;
+                        line->common.color = p2->common.color;
+                        line->common.paperspace = p2->common.paperspace;
+                        line->common.cold->graphics_data_size = p2->common.cold->graphics_data_size;
+                        line->common.cold->shadow_mode = p2->common.cold->shadow_mode;
+                        if (p2->common.cold->binary_graphics_data != NULL)
                         {
-                                line->plot_style_name = strdup (p2->plot_style_name);
+                                line->common.cold->binary_graphics_data = dxf_binary_buffer_copy (p2->common.cold->binary_graphics_data);
                         }
-                        line->color_value = p2->color_value;
-                        if (p2->color_name != NULL)
+                        line->common.cold->dictionary_owner_soft = p2->common.cold->dictionary_owner_soft;
+                        line->common.cold->material = p2->common.cold->material;
+                        line->common.cold->dictionary_owner_hard = p2->common.cold->dictionary_owner_hard;
+                        line->common.lineweight = p2->common.lineweight;
+                        line->common.cold->plot_style_name = p2->common.cold->plot_style_name;
+                        line->common.color_value = p2->common.color_value;
+                        if (p2->common.cold->color_name != NULL)
                         {
-                                line->color_name = strdup (p2->color_name);
+                                line->common.cold->color_name = strdup (p2->common.cold->color_name);
                         }
-                        line->transparency = p2->transparency;
+                        line->common.cold->transparency = p2->common.cold->transparency;
                         break;
                 default:
                         fprintf (stderr,
@@ -3739,4 +3722,129 @@ dxf_line_create_from_points
 }
 
 
+/*!
+ * \brief Store the start and end point of a DXF \c LINE entity in single
+ * precision.
+ *
+ * The coordinates are kept as \c float offsets relative to
+ * (\c origin_x, \c origin_y, \c origin_z) in \c offsets, the
+ * \c DxfPoint members are freed and set to \c NULL.\n
+ * Choosing an origin close to the drawing (for instance the center of
+ * the \c $EXTMIN and \c $EXTMAX extents) keeps the offsets small, so
+ * little precision is lost.\n
+ * Functions using the \c DxfPoint members need
+ * dxf_line_set_double_precision () first.
+ *
+ * \return a pointer to \c line when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLine *
+dxf_line_set_single_precision
+(
+        DxfLine *line,
+                /*!< a pointer to a DXF \c LINE entity. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *offsets = NULL;
+        DxfPoint *points[2];
+
+        /* Do some basic checks. */
+        if (line == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (line->offsets != NULL)
+        {
+                /* Convert to the new origin by way of double precision. */
+                if (dxf_line_set_double_precision (line) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        points[0] = line->p0;
+        points[1] = line->p1;
+        offsets = dxf_point_offsets_new_from_points (points, 2, origin_x, origin_y, origin_z);
+        if (offsets == NULL)
+        {
+                return (NULL);
+        }
+        if (line->p0 != NULL)
+        {
+                dxf_point_free (line->p0);
+        }
+        if (line->p1 != NULL)
+        {
+                dxf_point_free (line->p1);
+        }
+        line->p0 = NULL;
+        line->p1 = NULL;
+        line->offsets = offsets;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (line);
+}
+
+
+/*!
+ * \brief Store the start and end point of a DXF \c LINE entity in double
+ * precision (the default).
+ *
+ * New \c DxfPoint members are allocated from \c offsets, which is
+ * freed.
+ *
+ * \return a pointer to \c line when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLine *
+dxf_line_set_double_precision
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *points[2];
+
+        /* Do some basic checks. */
+        if (line == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (line->offsets == NULL)
+        {
+                return (line);
+        }
+        if (dxf_point_offsets_to_points (line->offsets, points) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        line->p0 = points[0];
+        line->p1 = points[1];
+        dxf_point_offsets_free (line->offsets);
+        line->offsets = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (line);
+}
+
+
 /* EOF */
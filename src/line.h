@@ -44,6 +44,8 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "binary_data.h"
 #include "point.h"
 
@@ -60,140 +62,21 @@ typedef struct
 dxf_line_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF line. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfPoint *p0;
                 /*!< Start point for the line.\n
                  * Group codes = 10, 20 and 30.*/
         DxfPoint *p1;
                 /*!< End point for the line.\n
                  * Group codes = 11, 21 and 31.*/
+        DxfPointOffsets *offsets;
+                /*!< Start and end point as single precision offsets,
+                 * \c NULL unless the line is in single precision mode,
+                 * see dxf_line_set_single_precision ().\n
+                 * \c p0 and \c p1 are \c NULL in single precision
+                 * mode. */
         double extr_x0;
                 /*!< X value of the extrusion direction.\n
                  * Optional, if ommited defaults to 0.0.\n
@@ -214,12 +97,15 @@ dxf_line_struct
 
 DxfLine *dxf_line_new ();
 DxfLine *dxf_line_init (DxfLine *line);
+DxfLine *dxf_line_init_from_prototype (DxfLine *line, DxfPoint *p0, DxfPoint *p1, const char *layer);
+DxfLine *dxf_line_new_from_prototype (const char *layer);
 DxfLine *dxf_line_read (DxfFile *fp, DxfLine *line);
 int dxf_line_write (DxfFile *fp, DxfLine *line);
 int dxf_line_free (DxfLine *line);
 void dxf_line_free_list (DxfLine *lines);
-int dxf_line_get_id_code (DxfLine *line);
-DxfLine *dxf_line_set_id_code (DxfLine *line, int id_code);
+DxfLine *dxf_line_copy (DxfLine *line);
+DxfHandle dxf_line_get_id_code (DxfLine *line);
+DxfLine *dxf_line_set_id_code (DxfLine *line, DxfHandle id_code);
 char *dxf_line_get_linetype (DxfLine *line);
 DxfLine *dxf_line_set_linetype (DxfLine *line, char *linetype);
 char *dxf_line_get_layer (DxfLine *line);
@@ -240,8 +126,8 @@ int32_t dxf_line_get_graphics_data_size (DxfLine *line);
 DxfLine *dxf_line_set_graphics_data_size (DxfLine *line, int32_t graphics_data_size);
 int16_t dxf_line_get_shadow_mode (DxfLine *line);
 DxfLine *dxf_line_set_shadow_mode (DxfLine *line, int16_t shadow_mode);
-DxfBinaryData *dxf_line_get_binary_graphics_data (DxfLine *line);
-DxfLine *dxf_line_set_binary_graphics_data (DxfLine *line, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_line_get_binary_graphics_data (DxfLine *line);
+DxfLine *dxf_line_set_binary_graphics_data (DxfLine *line, DxfBinaryBuffer *data);
 char *dxf_line_get_dictionary_owner_soft (DxfLine *line);
 DxfLine *dxf_line_set_dictionary_owner_soft (DxfLine *line, char *dictionary_owner_soft);
 char *dxf_line_get_material (DxfLine *line);
@@ -285,9 +171,11 @@ DxfLine *dxf_line_set_extrusion_vector (DxfLine *line, double extr_x0, double ex
 DxfLine *dxf_line_get_next (DxfLine *line);
 DxfLine *dxf_line_set_next (DxfLine *line, DxfLine *next);
 DxfLine *dxf_line_get_last (DxfLine *line);
-DxfPoint *dxf_line_get_mid_point (DxfLine *line, int id_code, int inheritance);
+DxfPoint *dxf_line_get_mid_point (DxfLine *line, DxfHandle id_code, int inheritance);
 double dxf_line_get_length (DxfLine *line);
-DxfLine *dxf_line_create_from_points (DxfPoint *p1, DxfPoint *p2, int id_code, int inheritance);
+DxfLine *dxf_line_create_from_points (DxfPoint *p1, DxfPoint *p2, DxfHandle id_code, int inheritance);
+DxfLine *dxf_line_set_single_precision (DxfLine *line, double origin_x, double origin_y, double origin_z);
+DxfLine *dxf_line_set_double_precision (DxfLine *line);
 
 
 #ifdef __cplusplus
@@ -116,9 +116,9 @@ dxf_ltype_init
         ltype->description = strdup ("");
         ltype->total_pattern_length = 0.0;
         ltype->number_of_linetype_elements = 0;
-        for ((i = 0); (i <= DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
+        for ((i = 0); (i < DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
         {
-                dxf_ltype_set_complex_text_string (ltype, i, strdup (""));
+                dxf_ltype_set_complex_text_string (ltype, i, "");
                 dxf_ltype_set_complex_x_offset (ltype, i, 0.0);
                 dxf_ltype_set_complex_y_offset (ltype, i, 0.0);
                 dxf_ltype_set_complex_scale (ltype, i, 0.0);
@@ -126,12 +126,12 @@ dxf_ltype_init
                 dxf_ltype_set_complex_rotation (ltype, i, 0.0);
                 dxf_ltype_set_complex_element (ltype, i, 1);
                 dxf_ltype_set_complex_shape_number (ltype, i, 0);
-                dxf_ltype_set_complex_style_pointer (ltype, i, strdup (""));
+                ltype->complex_style_pointer[i] = DXF_HANDLE_NONE;
         }
         ltype->flag = 0;
         ltype->alignment = 65;
-        ltype->dictionary_owner_soft = strdup ("");
-        ltype->dictionary_owner_hard = strdup ("");
+        ltype->dictionary_owner_soft = DXF_HANDLE_NONE;
+        ltype->dictionary_owner_hard = DXF_HANDLE_NONE;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -201,8 +201,7 @@ dxf_ltype_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &ltype->id_code);
+                        ltype->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -313,22 +312,19 @@ dxf_ltype_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->dictionary_owner_soft);
+                        ltype->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a complex
                          * style pointer string (multiple entries possible). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->complex_style_pointer[element]);
+                        ltype->complex_style_pointer[element] = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->dictionary_owner_hard);
+                        ltype->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -348,7 +344,7 @@ dxf_ltype_read
         if (strcmp (ltype->linetype_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s (): empty linetype name string for the entity with id-code: %x\n")),
+                  (_("Error in %s (): empty linetype name string for the entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, ltype->id_code);
                 fprintf (stderr,
                   (_("\tentity is discarded from output.\n")));
@@ -410,7 +406,7 @@ dxf_ltype_write
         if (strcmp (ltype->linetype_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s (): empty linetype name string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s (): empty linetype name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ltype->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -421,9 +417,9 @@ dxf_ltype_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ltype->id_code != -1)
+        if (ltype->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ltype->id_code);
+                dxf_handle_write (fp, 5, ltype->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -435,18 +431,18 @@ dxf_ltype_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ltype->dictionary_owner_soft, "") != 0)
+        if ((ltype->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ltype->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, ltype->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (ltype->dictionary_owner_hard, "") != 0)
+        if ((ltype->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ltype->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, ltype->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_14)
@@ -486,7 +482,7 @@ dxf_ltype_write
                                 fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
                                 fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
-                                fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
+                                dxf_handle_write (fp, 340, ltype->complex_style_pointer[i]);
                                 break;
                         case 2:
                                 /*
@@ -499,7 +495,7 @@ dxf_ltype_write
                                 fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
-                                fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
+                                dxf_handle_write (fp, 340, ltype->complex_style_pointer[i]);
                                 break;
                         case 3:
                                 /*
@@ -512,7 +508,7 @@ dxf_ltype_write
                                 fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
-                                fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
+                                dxf_handle_write (fp, 340, ltype->complex_style_pointer[i]);
                                 break;
                         case 4:
                                 /*
@@ -524,7 +520,7 @@ dxf_ltype_write
                                 fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n%d\n", dxf_ltype_get_complex_shape_number (ltype, i));
-                                fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
+                                dxf_handle_write (fp, 340, ltype->complex_style_pointer[i]);
                                 break;
                         case 5:
                                 /*
@@ -536,11 +532,11 @@ dxf_ltype_write
                                 fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n%d\n", dxf_ltype_get_complex_shape_number (ltype, i));
-                                fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
+                                dxf_handle_write (fp, 340, ltype->complex_style_pointer[i]);
                                 break;
                         default:
                                 fprintf (stderr,
-                                  (_("Warning in %s (): unknown complex element code for the %s entity with id-code: %x\n")),
+                                  (_("Warning in %s (): unknown complex element code for the %s entity with id-code: %" PRIx64 "\n")),
                                   __FUNCTION__, dxf_entity_name, ltype->id_code);
                                 break;
                 }
@@ -591,13 +587,10 @@ dxf_ltype_free
         }
         free (ltype->linetype_name);
         free (ltype->description);
-        for ((i = 0); (i <= DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
+        for ((i = 0); (i < DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
         {
-                free (dxf_ltype_get_complex_text_string (ltype, i));
-                free (dxf_ltype_get_complex_style_pointer (ltype, i));
+                free (ltype->complex_text_string[i]);
         }
-        free (ltype->dictionary_owner_soft);
-        free (ltype->dictionary_owner_hard);
         free (ltype);
         ltype = NULL;
 #if DEBUG
@@ -631,6 +624,7 @@ dxf_ltype_free_list
         while (ltypes != NULL)
         {
                 DxfLType *iter = (DxfLType *) ltypes->next;
+                ltypes->next = NULL;
                 dxf_ltype_free (ltypes);
                 ltypes = (DxfLType *) iter;
         }
@@ -640,12 +634,104 @@ dxf_ltype_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c LTYPE symbol table entry.
+ *
+ * The copy does not share any memory with \c ltype, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLType *
+dxf_ltype_copy
+(
+        DxfLType *ltype
+                /*!< a pointer to the DXF \c LTYPE symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLType *copy;
+        int i;
+
+        /* Do some basic checks. */
+        if (ltype == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_ltype_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, ltype, sizeof (DxfLType));
+        copy->linetype_name = NULL;
+        copy->description = NULL;
+        copy->next = NULL;
+        for (i = 0; i < DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS; i++)
+        {
+                copy->complex_text_string[i] = NULL;
+        }
+        if (ltype->linetype_name != NULL)
+        {
+                copy->linetype_name = strdup (ltype->linetype_name);
+                if (copy->linetype_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_ltype_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ltype->description != NULL)
+        {
+                copy->description = strdup (ltype->description);
+                if (copy->description == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_ltype_free (copy);
+                        return (NULL);
+                }
+        }
+        for (i = 0; i < DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS; i++)
+        {
+                if (ltype->complex_text_string[i] != NULL)
+                {
+                        copy->complex_text_string[i] = strdup (ltype->complex_text_string[i]);
+                        if (copy->complex_text_string[i] == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                dxf_ltype_free (copy);
+                                return (NULL);
+                        }
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c LTYPE entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_ltype_get_id_code
 (
         DxfLType *ltype
@@ -663,13 +749,6 @@ dxf_ltype_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ltype->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -685,7 +764,7 @@ dxf_ltype_set_id_code
 (
         DxfLType *ltype,
                 /*!< a pointer to a DXF \c LTYPE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -702,13 +781,6 @@ dxf_ltype_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         ltype->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -2065,17 +2137,10 @@ dxf_ltype_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ltype->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_soft));
+        return (dxf_handle_to_string (ltype->dictionary_owner_soft));
 }
 
 
@@ -2111,7 +2176,7 @@ dxf_ltype_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ltype->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2160,17 +2225,10 @@ dxf_ltype_get_complex_style_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ltype->complex_style_pointer[i] ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->complex_style_pointer[i]));
+        return (dxf_handle_to_string (ltype->complex_style_pointer[i]));
 }
 
 
@@ -2222,7 +2280,7 @@ dxf_ltype_set_complex_style_pointer
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->complex_style_pointer[i] = strdup (complex_style_pointer);
+        ltype->complex_style_pointer[i] = dxf_handle_parse (complex_style_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2256,17 +2314,10 @@ dxf_ltype_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ltype->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_hard));
+        return (dxf_handle_to_string (ltype->dictionary_owner_hard));
 }
 
 
@@ -2302,7 +2353,7 @@ dxf_ltype_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ltype->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
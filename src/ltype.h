@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -57,7 +58,7 @@ extern "C" {
 typedef struct
 dxf_ltype_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Entity handle; text string of up to 16 hexadecimal
                  * digits (fixed).\n
                  * Group code = 5. */
@@ -137,14 +138,14 @@ dxf_ltype_struct
                  * value is set to 0.\n
                  * If code 74 is set to 0, code 75 is omitted.\n
                  * Group code = 75. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *complex_style_pointer[DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS];
+        DxfHandle complex_style_pointer[DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS];
                 /*!< group code = 340.Pointer to \c STYLE object.\n
                  * One per element if group code 74 > 0.\n
                  * Group code = 340. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         struct DxfLType *next;
@@ -159,8 +160,9 @@ DxfLType *dxf_ltype_read (DxfFile *fp, DxfLType *ltype);
 int dxf_ltype_write (DxfFile *fp, DxfLType *ltype);
 int dxf_ltype_free (DxfLType *ltype);
 void dxf_ltype_free_list (DxfLType *ltypes);
-int dxf_ltype_get_id_code (DxfLType *ltype);
-DxfLType *dxf_ltype_set_id_code (DxfLType *ltype, int id_code);
+DxfLType *dxf_ltype_copy (DxfLType *ltype);
+DxfHandle dxf_ltype_get_id_code (DxfLType *ltype);
+DxfLType *dxf_ltype_set_id_code (DxfLType *ltype, DxfHandle id_code);
 char *dxf_ltype_get_linetype_name (DxfLType *ltype);
 DxfLType *dxf_ltype_set_linetype_name (DxfLType *ltype, char *linetype_name);
 char *dxf_ltype_get_description (DxfLType *ltype);
@@ -44,6 +44,35 @@
 
 
 #include "lwpolyline.h"
+#include "entities.h"
+
+
+/*!
+ * \brief Prototype with the default values of a DXF \c LWPOLYLINE
+ * entity.
+ */
+static const DxfLWPolyline dxf_lwpolyline_prototype =
+{
+        .common = DXF_ENTITY_COMMON_DEFAULTS,
+        .constant_width = 0.0,
+        .flag = 0,
+        .number_vertices = 0,
+        .extr_x0 = 0.0,
+        .extr_y0 = 0.0,
+        .extr_z0 = 0.0,
+        .x = NULL,
+        .y = NULL,
+        .start_width = NULL,
+        .end_width = NULL,
+        .bulge = NULL,
+        .vertices_size = 0,
+        .single_precision = FALSE,
+        .x_offset = NULL,
+        .y_offset = NULL,
+        .origin_x = 0.0,
+        .origin_y = 0.0,
+        .next = NULL
+};
 
 
 /*!
@@ -115,24 +144,30 @@ dxf_lwpolyline_init
                 __FUNCTION__);
               return (NULL);
         }
-        lwpolyline->id_code = 0;
-        lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
-        lwpolyline->elevation = 0.0;
-        lwpolyline->thickness = 0.0;
-        lwpolyline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        lwpolyline->visibility = DXF_DEFAULT_VISIBILITY;
+        if (dxf_entity_common_init (&lwpolyline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         lwpolyline->constant_width = 0.0;
-        lwpolyline->color = DXF_COLOR_BYLAYER;
-        lwpolyline->paperspace = DXF_MODELSPACE;
         lwpolyline->flag = 0;
         lwpolyline->number_vertices = 0;
         lwpolyline->extr_x0 = 0.0;
         lwpolyline->extr_y0 = 0.0;
         lwpolyline->extr_z0 = 0.0;
-        lwpolyline->dictionary_owner_soft = strdup ("");
-        lwpolyline->dictionary_owner_hard = strdup ("");
-        lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_new ();
+        lwpolyline->x = NULL;
+        lwpolyline->y = NULL;
+        lwpolyline->start_width = NULL;
+        lwpolyline->end_width = NULL;
+        lwpolyline->bulge = NULL;
+        lwpolyline->vertices_size = 0;
+        lwpolyline->single_precision = FALSE;
+        lwpolyline->x_offset = NULL;
+        lwpolyline->y_offset = NULL;
+        lwpolyline->origin_x = 0.0;
+        lwpolyline->origin_y = 0.0;
         lwpolyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -141,6 +176,53 @@ dxf_lwpolyline_init
 }
 
 
+/*!
+ * \brief Allocate memory for a DXF \c LWPOLYLINE entity and
+ * initialize it from the default prototype.
+ *
+ * Faster than dxf_lwpolyline_init () when creating many entities: the
+ * defaults are copied with a single memcpy ().
+ *
+ * \return a pointer to the new entity, or \c NULL when an error
+ * occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_new_from_prototype
+(
+        const char *layer
+                /*!< layer of the entity, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolyline *lwpolyline;
+
+        lwpolyline = malloc (sizeof (DxfLWPolyline));
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLWPolyline struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (lwpolyline, &dxf_lwpolyline_prototype, sizeof (DxfLWPolyline));
+        if (dxf_entity_common_init_from_prototype (&lwpolyline->common, layer) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_lwpolyline_free (lwpolyline);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
 /*!
  * \brief Read data from a DXF file into an \c LWPOLYLINE entity.
  *
@@ -164,8 +246,11 @@ dxf_lwpolyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfVertex *iter = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int number_vertices = 0;
+        int i = -1;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -173,8 +258,6 @@ dxf_lwpolyline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (lwpolyline == NULL)
@@ -182,221 +265,156 @@ dxf_lwpolyline_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                lwpolyline = dxf_lwpolyline_init (lwpolyline);
+                lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+                if (lwpolyline == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        lwpolyline->number_vertices = 0;
+        if ((fp->single_precision)
+          && (!lwpolyline->single_precision))
+        {
+                dxf_lwpolyline_set_single_precision (lwpolyline, fp->origin_x, fp->origin_y);
         }
-        iter = (DxfVertex *) lwpolyline->vertices;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &lwpolyline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                        * X-coordinate of a vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                        * Y-coordinate of a vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->p0->y0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (lwpolyline->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width of the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width of the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->end_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the bulge of
-                         * the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->bulge);
-                        /* The last member of the vertex is read.\n */
-                        /*! \todo The pointer administration needs to be checked for functionality. */
-                         /* Increment iter to next DxfVertex. */
-                        iter->next = (struct DxfVertex *) dxf_vertex_new ();
-                        iter = (DxfVertex *) iter->next;
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a string containing the
-                         * constant width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->constant_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &lwpolyline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->flag);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the number
-                         * of following vertices. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->number_vertices);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &lwpolyline->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_hard);
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                /* X-coordinate of a vertex, this starts
+                                 * a new vertex. */
+                                if (dxf_lwpolyline_append_vertex (lwpolyline,
+                                  atof (value), 0.0,
+                                  lwpolyline->constant_width,
+                                  lwpolyline->constant_width,
+                                  0.0) == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                i = lwpolyline->number_vertices - 1;
+                                break;
+                        case 20:
+                                /* Y-coordinate of the vertex. */
+                                if (i >= 0)
+                                {
+                                        dxf_lwpolyline_set_vertex_y (lwpolyline, i, atof (value));
+                                }
+                                break;
+                        case 40:
+                                /* Start width of the vertex. */
+                                if (i >= 0)
+                                {
+                                        lwpolyline->start_width[i] = atof (value);
+                                }
+                                break;
+                        case 41:
+                                /* End width of the vertex. */
+                                if (i >= 0)
+                                {
+                                        lwpolyline->end_width[i] = atof (value);
+                                }
+                                break;
+                        case 42:
+                                /* Bulge of the vertex. */
+                                if (i >= 0)
+                                {
+                                        lwpolyline->bulge[i] = atof (value);
+                                }
+                                break;
+                        case 43:
+                                /* Constant width. */
+                                lwpolyline->constant_width = atof (value);
+                                break;
+                        case 70:
+                                /* Polyline flag. */
+                                lwpolyline->flag = atoi (value);
+                                break;
+                        case 90:
+                                /* Number of following vertices,
+                                 * allocate the vertex arrays in one
+                                 * go. */
+                                number_vertices = atoi (value);
+                                dxf_lwpolyline_reserve_vertices (lwpolyline, number_vertices);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbPolyline") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                /* X-value of the extrusion vector. */
+                                lwpolyline->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                /* Y-value of the extrusion vector. */
+                                lwpolyline->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                /* Z-value of the extrusion vector. */
+                                lwpolyline->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &lwpolyline->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
-        /*! \todo Free memory to the last (unused) vertex in the linked list. */
-
-        /* Set the pointer to the last (unused) vertex in the linked list to NULL. */
-        iter->next = NULL;
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (lwpolyline->linetype, "") == 0)
+        if ((lwpolyline->common.linetype == NULL)
+          || (strcmp (lwpolyline->common.linetype, "") == 0))
         {
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (lwpolyline->common.linetype);
+                lwpolyline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (lwpolyline->layer, "") == 0)
+        if ((lwpolyline->common.layer == NULL)
+          || (strcmp (lwpolyline->common.layer, "") == 0))
         {
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                free (lwpolyline->common.layer);
+                lwpolyline->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
+        if (lwpolyline->number_vertices != number_vertices)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () %d vertices were announced and %d vertices were found for the entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, number_vertices,
+                  lwpolyline->number_vertices, lwpolyline->common.id_code);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -430,7 +448,7 @@ dxf_lwpolyline_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LWPOLYLINE");
-        DxfVertex *iter = NULL;
+        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -455,41 +473,41 @@ dxf_lwpolyline_write
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, lwpolyline->common.id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, lwpolyline->common.id_code);
         }
-        if (strcmp (lwpolyline->linetype, "") == 0)
+        if (strcmp (lwpolyline->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, lwpolyline->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                lwpolyline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (lwpolyline->layer, "") == 0)
+        if (strcmp (lwpolyline->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, lwpolyline->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                lwpolyline->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (lwpolyline->id_code != -1)
+        if (lwpolyline->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", lwpolyline->id_code);
+                dxf_handle_write (fp, 5, lwpolyline->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -501,44 +519,44 @@ dxf_lwpolyline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (lwpolyline->dictionary_owner_soft, "") != 0)
+        if ((lwpolyline->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", lwpolyline->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, lwpolyline->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (lwpolyline->dictionary_owner_hard, "") != 0)
+        if ((lwpolyline->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", lwpolyline->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, lwpolyline->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (lwpolyline->paperspace == DXF_PAPERSPACE)
+        if (lwpolyline->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", lwpolyline->layer);
-        if (strcmp (lwpolyline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", lwpolyline->common.layer);
+        if (strcmp (lwpolyline->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", lwpolyline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", lwpolyline->common.linetype);
         }
-        if (lwpolyline->color != DXF_COLOR_BYLAYER)
+        if (lwpolyline->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", lwpolyline->color);
+                fprintf (fp->fp, " 62\n%hd\n", lwpolyline->common.color);
         }
-        if (lwpolyline->linetype_scale != 1.0)
+        if (lwpolyline->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", lwpolyline->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", lwpolyline->common.linetype_scale);
         }
-        if (lwpolyline->visibility != 0)
+        if (lwpolyline->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", lwpolyline->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", lwpolyline->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -547,28 +565,26 @@ dxf_lwpolyline_write
         fprintf (fp->fp, " 90\n%d\n", lwpolyline->number_vertices);
         fprintf (fp->fp, " 70\n%d\n", lwpolyline->flag);
         fprintf (fp->fp, " 43\n%f\n", lwpolyline->constant_width);
-        if (lwpolyline->elevation != 0.0)
+        if (lwpolyline->common.elevation != 0.0)
         {
-                fprintf (fp->fp, " 38\n%f\n", lwpolyline->elevation);
+                fprintf (fp->fp, " 38\n%f\n", lwpolyline->common.elevation);
         }
-        if (lwpolyline->thickness != 0.0)
+        if (lwpolyline->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", lwpolyline->thickness);
+                fprintf (fp->fp, " 39\n%f\n", lwpolyline->common.thickness);
         }
         /* Start of writing (multiple) vertices. */
-        iter = (DxfVertex *) lwpolyline->vertices;
-        while (iter != NULL)
+        for (i = 0; i < lwpolyline->number_vertices; i++)
         {
-                fprintf (fp->fp, " 10\n%f\n", iter->p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", iter->p0->y0);
-                if ((iter->start_width != lwpolyline->constant_width)
-                  || (iter->end_width != lwpolyline->constant_width))
+                fprintf (fp->fp, " 10\n%f\n", dxf_lwpolyline_get_vertex_x (lwpolyline, i));
+                fprintf (fp->fp, " 20\n%f\n", dxf_lwpolyline_get_vertex_y (lwpolyline, i));
+                if ((lwpolyline->start_width[i] != lwpolyline->constant_width)
+                  || (lwpolyline->end_width[i] != lwpolyline->constant_width))
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter->start_width);
-                        fprintf (fp->fp, " 41\n%f\n", iter->end_width);
+                        fprintf (fp->fp, " 40\n%f\n", lwpolyline->start_width[i]);
+                        fprintf (fp->fp, " 41\n%f\n", lwpolyline->end_width[i]);
                 }
-                fprintf (fp->fp, " 42\n%f\n", iter->bulge);
-                iter = (DxfVertex *) iter->next;
+                fprintf (fp->fp, " 42\n%f\n", lwpolyline->bulge[i]);
         }
         /* End of writing (multiple) vertices. */
         if (fp->acad_version_number >= AutoCAD_12)
@@ -577,6 +593,7 @@ dxf_lwpolyline_write
                 fprintf (fp->fp, "220\n%f\n", lwpolyline->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", lwpolyline->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &lwpolyline->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -618,8 +635,14 @@ dxf_lwpolyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (lwpolyline->linetype);
-        free (lwpolyline->layer);
+        dxf_entity_common_free (&lwpolyline->common);
+        free (lwpolyline->x);
+        free (lwpolyline->y);
+        free (lwpolyline->x_offset);
+        free (lwpolyline->y_offset);
+        free (lwpolyline->start_width);
+        free (lwpolyline->end_width);
+        free (lwpolyline->bulge);
         free (lwpolyline);
         lwpolyline = NULL;
 #if DEBUG
@@ -653,6 +676,7 @@ dxf_lwpolyline_free_list
         while (lwpolylines != NULL)
         {
                 DxfLWPolyline *iter = (DxfLWPolyline *) lwpolylines->next;
+                lwpolylines->next = NULL;
                 dxf_lwpolyline_free (lwpolylines);
                 lwpolylines = (DxfLWPolyline *) iter;
         }
@@ -662,12 +686,100 @@ dxf_lwpolyline_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c LWPOLYLINE entity.
+ *
+ * The copy does not share any memory with \c lwpolyline, its \c next
+ * member is \c NULL.\n
+ * The vertex arrays are trimmed to the number of vertices.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_copy
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to the DXF \c LWPOLYLINE entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolyline *copy;
+        size_t size;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_lwpolyline_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, lwpolyline, sizeof (DxfLWPolyline));
+        copy->x = NULL;
+        copy->y = NULL;
+        copy->start_width = NULL;
+        copy->end_width = NULL;
+        copy->bulge = NULL;
+        copy->x_offset = NULL;
+        copy->y_offset = NULL;
+        copy->next = NULL;
+        copy->vertices_size = 0;
+        if (dxf_entity_common_copy (&copy->common, &lwpolyline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_lwpolyline_free (copy);
+                return (NULL);
+        }
+        if (lwpolyline->number_vertices > 0)
+        {
+                if (dxf_lwpolyline_reserve_vertices (copy, lwpolyline->number_vertices) == NULL)
+                {
+                        dxf_lwpolyline_free (copy);
+                        return (NULL);
+                }
+                size = (size_t) lwpolyline->number_vertices * sizeof (double);
+                if (lwpolyline->single_precision)
+                {
+                        memcpy (copy->x_offset, lwpolyline->x_offset,
+                          (size_t) lwpolyline->number_vertices * sizeof (float));
+                        memcpy (copy->y_offset, lwpolyline->y_offset,
+                          (size_t) lwpolyline->number_vertices * sizeof (float));
+                }
+                else
+                {
+                        memcpy (copy->x, lwpolyline->x, size);
+                        memcpy (copy->y, lwpolyline->y, size);
+                }
+                memcpy (copy->start_width, lwpolyline->start_width, size);
+                memcpy (copy->end_width, lwpolyline->end_width, size);
+                memcpy (copy->bulge, lwpolyline->bulge, size);
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c LWPOLYLINE entity.
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_lwpolyline_get_id_code
 (
         DxfLWPolyline *lwpolyline
@@ -685,17 +797,10 @@ dxf_lwpolyline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->id_code);
+        return (lwpolyline->common.id_code);
 }
 
 
@@ -707,7 +812,7 @@ dxf_lwpolyline_set_id_code
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -724,14 +829,7 @@ dxf_lwpolyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        lwpolyline->id_code = id_code;
+        lwpolyline->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -762,7 +860,7 @@ dxf_lwpolyline_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->linetype ==  NULL)
+        if (lwpolyline->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -772,7 +870,7 @@ dxf_lwpolyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->linetype));
+        return (strdup (lwpolyline->common.linetype));
 }
 
 
@@ -806,7 +904,7 @@ dxf_lwpolyline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->linetype = strdup (linetype);
+        lwpolyline->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -837,7 +935,7 @@ dxf_lwpolyline_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->layer ==  NULL)
+        if (lwpolyline->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -847,7 +945,7 @@ dxf_lwpolyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->layer));
+        return (strdup (lwpolyline->common.layer));
 }
 
 
@@ -881,7 +979,7 @@ dxf_lwpolyline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->layer = strdup (layer);
+        lwpolyline->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -915,7 +1013,7 @@ dxf_lwpolyline_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->elevation);
+        return (lwpolyline->common.elevation);
 }
 
 
@@ -942,7 +1040,7 @@ dxf_lwpolyline_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->elevation = elevation;
+        lwpolyline->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -973,7 +1071,7 @@ dxf_lwpolyline_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->thickness < 0.0)
+        if (lwpolyline->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -983,7 +1081,7 @@ dxf_lwpolyline_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->thickness);
+        return (lwpolyline->common.thickness);
 }
 
 
@@ -1017,7 +1115,7 @@ dxf_lwpolyline_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->thickness = thickness;
+        lwpolyline->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1048,7 +1146,7 @@ dxf_lwpolyline_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->linetype_scale < 0.0)
+        if (lwpolyline->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1058,7 +1156,7 @@ dxf_lwpolyline_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->linetype_scale);
+        return (lwpolyline->common.linetype_scale);
 }
 
 
@@ -1092,7 +1190,7 @@ dxf_lwpolyline_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->linetype_scale = linetype_scale;
+        lwpolyline->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1123,14 +1221,14 @@ dxf_lwpolyline_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->visibility < 0)
+        if (lwpolyline->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->visibility > 1)
+        if (lwpolyline->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1140,7 +1238,7 @@ dxf_lwpolyline_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->visibility);
+        return (lwpolyline->common.visibility);
 }
 
 
@@ -1181,7 +1279,7 @@ dxf_lwpolyline_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->visibility = visibility;
+        lwpolyline->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1212,7 +1310,7 @@ dxf_lwpolyline_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->color < 0)
+        if (lwpolyline->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1221,7 +1319,7 @@ dxf_lwpolyline_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->color);
+        return (lwpolyline->common.color);
 }
 
 
@@ -1254,7 +1352,7 @@ dxf_lwpolyline_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        lwpolyline->color = color;
+        lwpolyline->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1285,13 +1383,13 @@ dxf_lwpolyline_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->paperspace < 0)
+        if (lwpolyline->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (lwpolyline->paperspace > 1)
+        if (lwpolyline->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1300,7 +1398,7 @@ dxf_lwpolyline_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->paperspace);
+        return (lwpolyline->common.paperspace);
 }
 
 
@@ -1341,7 +1439,7 @@ dxf_lwpolyline_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->paperspace = paperspace;
+        lwpolyline->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1374,13 +1472,13 @@ dxf_lwpolyline_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->graphics_data_size < 0)
+        if (lwpolyline->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (lwpolyline->graphics_data_size == 0)
+        if (lwpolyline->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1389,7 +1487,7 @@ dxf_lwpolyline_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->graphics_data_size);
+        return (lwpolyline->common.cold->graphics_data_size);
 }
 
 
@@ -1434,7 +1532,7 @@ dxf_lwpolyline_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        lwpolyline->graphics_data_size = graphics_data_size;
+        lwpolyline->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1466,14 +1564,14 @@ dxf_lwpolyline_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->shadow_mode < 0)
+        if (lwpolyline->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (lwpolyline->shadow_mode > 3)
+        if (lwpolyline->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1483,7 +1581,7 @@ dxf_lwpolyline_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->shadow_mode);
+        return (lwpolyline->common.cold->shadow_mode);
 }
 
 
@@ -1527,7 +1625,7 @@ dxf_lwpolyline_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->shadow_mode = shadow_mode;
+        lwpolyline->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1539,11 +1637,12 @@ dxf_lwpolyline_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c LWPOLYLINE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_lwpolyline_get_binary_graphics_data
 (
         DxfLWPolyline *lwpolyline
@@ -1561,32 +1660,31 @@ dxf_lwpolyline_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) lwpolyline->binary_graphics_data);
+        return (lwpolyline->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c LWPOLYLINE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when an
+ * error occurred.
  */
 DxfLWPolyline *
 dxf_lwpolyline_set_binary_graphics_data
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1607,7 +1705,12 @@ dxf_lwpolyline_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((lwpolyline->common.cold->binary_graphics_data != NULL)
+          && (lwpolyline->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (lwpolyline->common.cold->binary_graphics_data);
+        }
+        lwpolyline->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1641,17 +1744,10 @@ dxf_lwpolyline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_soft));
+        return (dxf_handle_to_string (lwpolyline->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1687,7 +1783,7 @@ dxf_lwpolyline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        lwpolyline->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1721,17 +1817,10 @@ dxf_lwpolyline_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->material));
+        return (dxf_handle_to_string (lwpolyline->common.cold->material));
 }
 
 
@@ -1770,7 +1859,7 @@ dxf_lwpolyline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->material = strdup (material);
+        lwpolyline->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1804,17 +1893,10 @@ dxf_lwpolyline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_hard));
+        return (dxf_handle_to_string (lwpolyline->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1850,7 +1932,7 @@ dxf_lwpolyline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        lwpolyline->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1885,7 +1967,7 @@ dxf_lwpolyline_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->lineweight);
+        return (lwpolyline->common.lineweight);
 }
 
 
@@ -1915,7 +1997,7 @@ dxf_lwpolyline_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->lineweight = lineweight;
+        lwpolyline->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1947,17 +2029,10 @@ dxf_lwpolyline_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->plot_style_name));
+        return (dxf_handle_to_string (lwpolyline->common.cold->plot_style_name));
 }
 
 
@@ -1995,7 +2070,7 @@ dxf_lwpolyline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->plot_style_name = strdup (plot_style_name);
+        lwpolyline->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2030,7 +2105,7 @@ dxf_lwpolyline_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->color_value);
+        return (lwpolyline->common.color_value);
 }
 
 
@@ -2060,7 +2135,7 @@ dxf_lwpolyline_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->color_value = color_value;
+        lwpolyline->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2092,7 +2167,7 @@ dxf_lwpolyline_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->color_name ==  NULL)
+        if (lwpolyline->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2102,7 +2177,7 @@ dxf_lwpolyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->color_name));
+        return (strdup (lwpolyline->common.cold->color_name));
 }
 
 
@@ -2140,7 +2215,7 @@ dxf_lwpolyline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->color_name = strdup (color_name);
+        lwpolyline->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2175,7 +2250,7 @@ dxf_lwpolyline_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (lwpolyline->transparency);
+        return (lwpolyline->common.cold->transparency);
 }
 
 
@@ -2205,7 +2280,7 @@ dxf_lwpolyline_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->transparency = transparency;
+        lwpolyline->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2407,6 +2482,9 @@ dxf_lwpolyline_get_number_vertices
 /*!
  * \brief Set the \c number_vertices value for a DXF \c LWPOLYLINE
  * entity.
+ *
+ * The vertex arrays are grown when needed, added vertices are
+ * initialized with zeros.
  */
 DxfLWPolyline *
 dxf_lwpolyline_set_number_vertices
@@ -2420,6 +2498,8 @@ dxf_lwpolyline_set_number_vertices
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
@@ -2435,6 +2515,18 @@ dxf_lwpolyline_set_number_vertices
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_lwpolyline_reserve_vertices (lwpolyline, number_vertices) == NULL)
+        {
+                return (NULL);
+        }
+        for (i = lwpolyline->number_vertices; i < number_vertices; i++)
+        {
+                dxf_lwpolyline_set_vertex_x (lwpolyline, i, 0.0);
+                dxf_lwpolyline_set_vertex_y (lwpolyline, i, 0.0);
+                lwpolyline->start_width[i] = 0.0;
+                lwpolyline->end_width[i] = 0.0;
+                lwpolyline->bulge[i] = 0.0;
+        }
         lwpolyline->number_vertices = number_vertices;
 #if DEBUG
         DXF_DEBUG_END
@@ -2648,23 +2740,38 @@ dxf_lwpolyline_set_extr_z0
 
 
 /*!
- * \brief Get the pointer to the first vertex of a linked list of
- * \c vertices from a DXF \c LWPOLYLINE entity.
+ * \brief Make sure the vertex arrays of a DXF \c LWPOLYLINE entity can
+ * hold at least \c vertices_size vertices.
  *
- * \return pointer to the first vertex of a linked list of \c vertices.
+ * All five vertex arrays (\c x, \c y, \c start_width, \c end_width
+ * and \c bulge) are grown together, existing vertices are preserved.\n
+ * In single precision mode \c x_offset and \c y_offset are grown
+ * instead of \c x and \c y.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
  */
-DxfVertex *
-dxf_lwpolyline_get_vertices
+DxfLWPolyline *
+dxf_lwpolyline_reserve_vertices
 (
-        DxfLWPolyline *lwpolyline
+        DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int vertices_size
+                /*!< the minimum number of vertices to allocate. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        double *x = NULL;
+        double *y = NULL;
+        float *x_offset = NULL;
+        float *y_offset = NULL;
+        double *start_width;
+        double *end_width;
+        double *bulge;
+        size_t size;
+
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
@@ -2673,37 +2780,89 @@ dxf_lwpolyline_get_vertices
                   __FUNCTION__);
                 return (NULL);
         }
-        if (lwpolyline->vertices == NULL)
+        if (vertices_size < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (vertices_size <= lwpolyline->vertices_size)
+        {
+                return (lwpolyline);
+        }
+        size = (size_t) vertices_size * sizeof (double);
+        if (lwpolyline->single_precision)
+        {
+                x_offset = realloc (lwpolyline->x_offset, (size_t) vertices_size * sizeof (float));
+                if (x_offset != NULL) lwpolyline->x_offset = x_offset;
+                y_offset = realloc (lwpolyline->y_offset, (size_t) vertices_size * sizeof (float));
+                if (y_offset != NULL) lwpolyline->y_offset = y_offset;
+        }
+        else
+        {
+                x = realloc (lwpolyline->x, size);
+                if (x != NULL) lwpolyline->x = x;
+                y = realloc (lwpolyline->y, size);
+                if (y != NULL) lwpolyline->y = y;
+        }
+        start_width = realloc (lwpolyline->start_width, size);
+        if (start_width != NULL) lwpolyline->start_width = start_width;
+        end_width = realloc (lwpolyline->end_width, size);
+        if (end_width != NULL) lwpolyline->end_width = end_width;
+        bulge = realloc (lwpolyline->bulge, size);
+        if (bulge != NULL) lwpolyline->bulge = bulge;
+        if (((lwpolyline->single_precision)
+          ? ((x_offset == NULL) || (y_offset == NULL))
+          : ((x == NULL) || (y == NULL)))
+          || (start_width == NULL)
+          || (end_width == NULL)
+          || (bulge == NULL))
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the vertices member.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        lwpolyline->vertices_size = vertices_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfVertex *) lwpolyline->vertices);
+        return (lwpolyline);
 }
 
 
 /*!
- * \brief Set the pointer to the first vertex of a linked list of
- * \c vertices for a DXF \c LWPOLYLINE entity.
+ * \brief Append a vertex to a DXF \c LWPOLYLINE entity.
+ *
+ * The vertex arrays grow geometrically, so appending \c n vertices
+ * costs amortized O(n).
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
  */
 DxfLWPolyline *
-dxf_lwpolyline_set_vertices
+dxf_lwpolyline_append_vertex
 (
         DxfLWPolyline *lwpolyline,
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
-        DxfVertex *vertices
-                /*!< a pointer to the first vertex of a linked list of
-                 * \c vertices. */
+        double x,
+                /*!< X-coordinate of the vertex. */
+        double y,
+                /*!< Y-coordinate of the vertex. */
+        double start_width,
+                /*!< starting width of the vertex. */
+        double end_width,
+                /*!< end width of the vertex. */
+        double bulge
+                /*!< bulge of the vertex. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
@@ -2712,14 +2871,550 @@ dxf_lwpolyline_set_vertices
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertices == NULL)
+        if (lwpolyline->number_vertices >= lwpolyline->vertices_size)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                if (dxf_lwpolyline_reserve_vertices (lwpolyline,
+                  (lwpolyline->vertices_size > 0)
+                  ? (2 * lwpolyline->vertices_size)
+                  : 4) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        i = lwpolyline->number_vertices;
+        if (lwpolyline->single_precision)
+        {
+                lwpolyline->x_offset[i] = (float) (x - lwpolyline->origin_x);
+                lwpolyline->y_offset[i] = (float) (y - lwpolyline->origin_y);
+        }
+        else
+        {
+                lwpolyline->x[i] = x;
+                lwpolyline->y[i] = y;
+        }
+        lwpolyline->start_width[i] = start_width;
+        lwpolyline->end_width[i] = end_width;
+        lwpolyline->bulge[i] = bulge;
+        lwpolyline->number_vertices++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Set all vertices of a DXF \c LWPOLYLINE entity from arrays.
+ *
+ * The values are copied into the vertex arrays owned by
+ * \c lwpolyline, previous vertices are discarded.\n
+ * \c start_width, \c end_width and \c bulge may be \c NULL, in which
+ * case the widths default to the \c constant_width and the bulges
+ * default to 0.0.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_set_vertices
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int number_vertices,
+                /*!< the number of vertices in each of the arrays. */
+        const double *x,
+                /*!< array of X-coordinates. */
+        const double *y,
+                /*!< array of Y-coordinates. */
+        const double *start_width,
+                /*!< array of starting widths, or \c NULL. */
+        const double *end_width,
+                /*!< array of end widths, or \c NULL. */
+        const double *bulge
+                /*!< array of bulges, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t size;
+        int i;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((x == NULL) || (y == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_lwpolyline_reserve_vertices (lwpolyline, number_vertices) == NULL)
+        {
+                return (NULL);
+        }
+        size = (size_t) number_vertices * sizeof (double);
+        if (lwpolyline->single_precision)
+        {
+                for (i = 0; i < number_vertices; i++)
+                {
+                        lwpolyline->x_offset[i] = (float) (x[i] - lwpolyline->origin_x);
+                        lwpolyline->y_offset[i] = (float) (y[i] - lwpolyline->origin_y);
+                }
+        }
+        else
+        {
+                memcpy (lwpolyline->x, x, size);
+                memcpy (lwpolyline->y, y, size);
+        }
+        if (start_width != NULL)
+        {
+                memcpy (lwpolyline->start_width, start_width, size);
+        }
+        else
+        {
+                for (i = 0; i < number_vertices; i++)
+                {
+                        lwpolyline->start_width[i] = lwpolyline->constant_width;
+                }
+        }
+        if (end_width != NULL)
+        {
+                memcpy (lwpolyline->end_width, end_width, size);
+        }
+        else
+        {
+                for (i = 0; i < number_vertices; i++)
+                {
+                        lwpolyline->end_width[i] = lwpolyline->constant_width;
+                }
+        }
+        if (bulge != NULL)
+        {
+                memcpy (lwpolyline->bulge, bulge, size);
+        }
+        else
+        {
+                memset (lwpolyline->bulge, 0, size);
+        }
+        lwpolyline->number_vertices = number_vertices;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Get a read-only view on the packed vertex arrays of a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * No data is copied, the returned span refers to the storage owned by
+ * \c lwpolyline.
+ *
+ * \return a \c DxfLWPolylineVertexSpan, with \c number_vertices set to
+ * 0 and \c NULL pointers when an error occurred.
+ */
+DxfLWPolylineVertexSpan
+dxf_lwpolyline_get_vertex_span
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolylineVertexSpan span;
+
+        memset (&span, 0, sizeof (span));
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (span);
+        }
+        span.number_vertices = lwpolyline->number_vertices;
+        span.x = lwpolyline->x;
+        span.y = lwpolyline->y;
+        span.x_offset = lwpolyline->x_offset;
+        span.y_offset = lwpolyline->y_offset;
+        span.origin_x = lwpolyline->origin_x;
+        span.origin_y = lwpolyline->origin_y;
+        span.start_width = lwpolyline->start_width;
+        span.end_width = lwpolyline->end_width;
+        span.bulge = lwpolyline->bulge;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (span);
+}
+
+
+/*!
+ * \brief Get the X-coordinate of vertex \c i of a DXF \c LWPOLYLINE
+ * entity.
+ *
+ * In single precision mode the stored offset is added to the origin.
+ *
+ * \return the X-coordinate of the vertex, or 0.0 when an error
+ * occurred.
+ */
+double
+dxf_lwpolyline_get_vertex_x
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int i
+                /*!< index of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double result;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+        if ((i < 0) || (i >= lwpolyline->number_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+        if (lwpolyline->single_precision)
+        {
+                result = lwpolyline->origin_x + (double) lwpolyline->x_offset[i];
+        }
+        else
+        {
+                result = lwpolyline->x[i];
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the X-coordinate of vertex \c i of a DXF \c LWPOLYLINE
+ * entity.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_set_vertex_x
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int i,
+                /*!< index of the vertex. */
+        double x
+                /*!< the X-coordinate of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((i < 0) || (i >= lwpolyline->number_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (lwpolyline->single_precision)
+        {
+                lwpolyline->x_offset[i] = (float) (x - lwpolyline->origin_x);
+        }
+        else
+        {
+                lwpolyline->x[i] = x;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Get the Y-coordinate of vertex \c i of a DXF \c LWPOLYLINE
+ * entity.
+ *
+ * In single precision mode the stored offset is added to the origin.
+ *
+ * \return the Y-coordinate of the vertex, or 0.0 when an error
+ * occurred.
+ */
+double
+dxf_lwpolyline_get_vertex_y
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int i
+                /*!< index of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double result;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+        if ((i < 0) || (i >= lwpolyline->number_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+        if (lwpolyline->single_precision)
+        {
+                result = lwpolyline->origin_y + (double) lwpolyline->y_offset[i];
+        }
+        else
+        {
+                result = lwpolyline->y[i];
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the Y-coordinate of vertex \c i of a DXF \c LWPOLYLINE
+ * entity.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_set_vertex_y
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int i,
+                /*!< index of the vertex. */
+        double y
+                /*!< the Y-coordinate of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((i < 0) || (i >= lwpolyline->number_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (lwpolyline->single_precision)
+        {
+                lwpolyline->y_offset[i] = (float) (y - lwpolyline->origin_y);
+        }
+        else
+        {
+                lwpolyline->y[i] = y;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Store the vertex coordinates of a DXF \c LWPOLYLINE entity
+ * in single precision.
+ *
+ * The coordinates are kept as \c float offsets relative to
+ * (\c origin_x, \c origin_y), which halves the memory used by the
+ * \c x and \c y arrays.\n
+ * Choosing an origin close to the drawing (for instance the center of
+ * the \c $EXTMIN and \c $EXTMAX extents) keeps the offsets small, so
+ * little precision is lost.\n
+ * Existing vertices are converted, \c x and \c y are freed.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_set_single_precision
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y
+                /*!< Y-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        float *x_offset = NULL;
+        float *y_offset = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (lwpolyline->single_precision)
+        {
+                /* Convert to the new origin by way of double precision. */
+                if (dxf_lwpolyline_set_double_precision (lwpolyline) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        if (lwpolyline->vertices_size > 0)
+        {
+                x_offset = malloc ((size_t) lwpolyline->vertices_size * sizeof (float));
+                y_offset = malloc ((size_t) lwpolyline->vertices_size * sizeof (float));
+                if ((x_offset == NULL) || (y_offset == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (x_offset);
+                        free (y_offset);
+                        return (NULL);
+                }
+        }
+        for (i = 0; i < lwpolyline->number_vertices; i++)
+        {
+                x_offset[i] = (float) (lwpolyline->x[i] - origin_x);
+                y_offset[i] = (float) (lwpolyline->y[i] - origin_y);
+        }
+        free (lwpolyline->x);
+        free (lwpolyline->y);
+        lwpolyline->x = NULL;
+        lwpolyline->y = NULL;
+        lwpolyline->x_offset = x_offset;
+        lwpolyline->y_offset = y_offset;
+        lwpolyline->origin_x = origin_x;
+        lwpolyline->origin_y = origin_y;
+        lwpolyline->single_precision = TRUE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Store the vertex coordinates of a DXF \c LWPOLYLINE entity
+ * in double precision (the default).
+ *
+ * Existing vertices are converted, \c x_offset and \c y_offset are
+ * freed.
+ *
+ * \return a pointer to \c lwpolyline when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_set_double_precision
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *x = NULL;
+        double *y = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (!lwpolyline->single_precision)
+        {
+                return (lwpolyline);
+        }
+        if (lwpolyline->vertices_size > 0)
+        {
+                x = malloc ((size_t) lwpolyline->vertices_size * sizeof (double));
+                y = malloc ((size_t) lwpolyline->vertices_size * sizeof (double));
+                if ((x == NULL) || (y == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (x);
+                        free (y);
+                        return (NULL);
+                }
+        }
+        for (i = 0; i < lwpolyline->number_vertices; i++)
+        {
+                x[i] = lwpolyline->origin_x + (double) lwpolyline->x_offset[i];
+                y[i] = lwpolyline->origin_y + (double) lwpolyline->y_offset[i];
         }
-        lwpolyline->vertices = (struct DxfVertex *) vertices;
+        free (lwpolyline->x_offset);
+        free (lwpolyline->y_offset);
+        lwpolyline->x_offset = NULL;
+        lwpolyline->y_offset = NULL;
+        lwpolyline->x = x;
+        lwpolyline->y = y;
+        lwpolyline->origin_x = 0.0;
+        lwpolyline->origin_y = 0.0;
+        lwpolyline->single_precision = FALSE;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -46,6 +46,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "point.h"
 #include "binary_graphics_data.h"
 #include "vertex.h"
@@ -56,6 +59,43 @@ extern "C" {
 #endif
 
 
+/*!
+ * \brief Read-only view on the packed vertex arrays of a DXF light
+ * weight polyline entity.
+ *
+ * The pointers refer to the storage owned by the \c DxfLWPolyline and
+ * are invalidated when vertices are added or the entity is freed.
+ */
+typedef struct
+dxf_lwpolyline_vertex_span_struct
+{
+        int number_vertices;
+                /*!< Number of vertices in each of the arrays. */
+        const double *x;
+                /*!< X-coordinates of the vertices, \c NULL in single
+                 * precision mode. */
+        const double *y;
+                /*!< Y-coordinates of the vertices, \c NULL in single
+                 * precision mode. */
+        const float *x_offset;
+                /*!< X-coordinates of the vertices relative to
+                 * \c origin_x in single precision mode, else \c NULL. */
+        const float *y_offset;
+                /*!< Y-coordinates of the vertices relative to
+                 * \c origin_y in single precision mode, else \c NULL. */
+        double origin_x;
+                /*!< X-coordinate of the origin of \c x_offset. */
+        double origin_y;
+                /*!< Y-coordinate of the origin of \c y_offset. */
+        const double *start_width;
+                /*!< Starting widths of the vertices. */
+        const double *end_width;
+                /*!< End widths of the vertices. */
+        const double *bulge;
+                /*!< Bulges of the vertices. */
+} DxfLWPolylineVertexSpan;
+
+
 /*!
  * \brief Definition of a DXF light weight polyline entity.
  */
@@ -63,130 +103,9 @@ typedef struct
 dxf_lwpolyline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the lwpolyline in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the lwpolyline in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF lwpolyline. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         double constant_width;
                 /*!< Not used if variable width (codes 40 and/or 41) is
                  * set the default widths apply to any vertex that
@@ -217,11 +136,46 @@ dxf_lwpolyline_struct
         double extr_z0;
                 /*!< DXF: Z value of extrusion direction (optional).\n
                  * Group code = 230. */
-        struct DxfVertex *vertices;
-                /*!< Pointer to the first DxfVertex of the lwpolyline.\n
-                 * \c NULL in the last DxfVertex.\n
-                 * \note Not all members of the DxfVertex struct are
-                 * used for lwpolylines. */
+        double *x;
+                /*!< X-coordinates of the vertices, in OCS.\n
+                 * Contiguous array of \c number_vertices values.\n
+                 * Group code = 10. */
+        double *y;
+                /*!< Y-coordinates of the vertices, in OCS.\n
+                 * Contiguous array of \c number_vertices values.\n
+                 * Group code = 20. */
+        double *start_width;
+                /*!< Starting widths of the vertices.\n
+                 * Contiguous array of \c number_vertices values.\n
+                 * Group code = 40. */
+        double *end_width;
+                /*!< End widths of the vertices.\n
+                 * Contiguous array of \c number_vertices values.\n
+                 * Group code = 41. */
+        double *bulge;
+                /*!< Bulges of the vertices.\n
+                 * Contiguous array of \c number_vertices values.\n
+                 * Group code = 42. */
+        int vertices_size;
+                /*!< Number of vertices allocated in each of the \c x,
+                 * \c y, \c start_width, \c end_width and \c bulge
+                 * arrays. */
+        int single_precision;
+                /*!< The coordinates of the vertices are stored as
+                 * \c float offsets in \c x_offset and \c y_offset,
+                 * \c x and \c y are \c NULL. */
+        float *x_offset;
+                /*!< X-coordinates of the vertices relative to
+                 * \c origin_x in single precision mode.\n
+                 * Contiguous array of \c number_vertices values. */
+        float *y_offset;
+                /*!< Y-coordinates of the vertices relative to
+                 * \c origin_y in single precision mode.\n
+                 * Contiguous array of \c number_vertices values. */
+        double origin_x;
+                /*!< X-coordinate of the origin for \c x_offset. */
+        double origin_y;
+                /*!< Y-coordinate of the origin for \c y_offset. */
         struct DxfLWPolyline *next;
                 /*!< Pointer to the next DxfLWPolyline.\n
                  * \c NULL in the last DxfLWPolyline. */
@@ -230,12 +184,14 @@ dxf_lwpolyline_struct
 
 DxfLWPolyline *dxf_lwpolyline_new ();
 DxfLWPolyline *dxf_lwpolyline_init (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_new_from_prototype (const char *layer);
 DxfLWPolyline *dxf_lwpolyline_read (DxfFile *fp, DxfLWPolyline *lwpolyline);
 int dxf_lwpolyline_write (DxfFile *fp, DxfLWPolyline *lwpolyline);
 int dxf_lwpolyline_free (DxfLWPolyline *lwpolyline);
 void dxf_lwpolyline_free_list (DxfLWPolyline *lwpolylines);
-int dxf_lwpolyline_get_id_code (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_id_code (DxfLWPolyline *lwpolyline, int id_code);
+DxfLWPolyline *dxf_lwpolyline_copy (DxfLWPolyline *lwpolyline);
+DxfHandle dxf_lwpolyline_get_id_code (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_id_code (DxfLWPolyline *lwpolyline, DxfHandle id_code);
 char *dxf_lwpolyline_get_linetype (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_linetype (DxfLWPolyline *lwpolyline, char *linetype);
 char *dxf_lwpolyline_get_layer (DxfLWPolyline *lwpolyline);
@@ -256,8 +212,8 @@ int dxf_lwpolyline_get_graphics_data_size (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_graphics_data_size (DxfLWPolyline *lwpolyline, int graphics_data_size);
 int16_t dxf_lwpolyline_get_shadow_mode (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_shadow_mode (DxfLWPolyline *lwpolyline, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_lwpolyline_get_binary_graphics_data (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_binary_graphics_data (DxfLWPolyline *lwpolyline, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_lwpolyline_get_binary_graphics_data (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_set_binary_graphics_data (DxfLWPolyline *lwpolyline, DxfBinaryBuffer *data);
 char *dxf_lwpolyline_get_dictionary_owner_soft (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_dictionary_owner_soft (DxfLWPolyline *lwpolyline, char *dictionary_owner_soft);
 char *dxf_lwpolyline_get_material (DxfLWPolyline *lwpolyline);
@@ -286,8 +242,16 @@ double dxf_lwpolyline_get_extr_y0 (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_extr_y0 (DxfLWPolyline *lwpolyline, double extr_y0);
 double dxf_lwpolyline_get_extr_z0 (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_extr_z0 (DxfLWPolyline *lwpolyline, double extr_z0);
-DxfVertex *dxf_lwpolyline_get_vertices (DxfLWPolyline *lwpolyline);
-DxfLWPolyline *dxf_lwpolyline_set_vertices (DxfLWPolyline *lwpolyline, DxfVertex *vertices);
+DxfLWPolyline *dxf_lwpolyline_reserve_vertices (DxfLWPolyline *lwpolyline, int vertices_size);
+DxfLWPolyline *dxf_lwpolyline_append_vertex (DxfLWPolyline *lwpolyline, double x, double y, double start_width, double end_width, double bulge);
+DxfLWPolyline *dxf_lwpolyline_set_vertices (DxfLWPolyline *lwpolyline, int number_vertices, const double *x, const double *y, const double *start_width, const double *end_width, const double *bulge);
+DxfLWPolylineVertexSpan dxf_lwpolyline_get_vertex_span (DxfLWPolyline *lwpolyline);
+double dxf_lwpolyline_get_vertex_x (DxfLWPolyline *lwpolyline, int i);
+DxfLWPolyline *dxf_lwpolyline_set_vertex_x (DxfLWPolyline *lwpolyline, int i, double x);
+double dxf_lwpolyline_get_vertex_y (DxfLWPolyline *lwpolyline, int i);
+DxfLWPolyline *dxf_lwpolyline_set_vertex_y (DxfLWPolyline *lwpolyline, int i, double y);
+DxfLWPolyline *dxf_lwpolyline_set_single_precision (DxfLWPolyline *lwpolyline, double origin_x, double origin_y);
+DxfLWPolyline *dxf_lwpolyline_set_double_precision (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_get_next (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_set_next (DxfLWPolyline *lwpolyline, DxfLWPolyline *next);
 DxfLWPolyline *dxf_lwpolyline_get_last (DxfLWPolyline *lwpolyline);
@@ -0,0 +1,1110 @@
+/*!
+ * \file memory_usage.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the memory usage accounting of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "memory_usage.h"
+#include "spline.h"
+#include "helix.h"
+
+
+/*!
+ * \brief Names of the sections, indexed by \c DxfMemorySection.
+ */
+static const char *dxf_memory_usage_section_names[DXF_NUMBER_OF_MEMORY_SECTIONS] =
+{
+        "HEADER",
+        "CLASSES",
+        "TABLES",
+        "BLOCKS",
+        "ENTITIES",
+        "OBJECTS",
+        "THUMBNAILIMAGE"
+};
+
+
+/*!
+ * \brief Names of the kinds of sub-structures, indexed by
+ * \c DxfMemoryKind.
+ */
+static const char *dxf_memory_usage_kind_names[DXF_NUMBER_OF_MEMORY_KINDS] =
+{
+        "structs",
+        "strings",
+        "binary data",
+        "vertices"
+};
+
+
+/*!
+ * \brief Get the size of the struct of an entity of type \c type.
+ *
+ * \return the size in bytes, or \c 0 when the type of entity is not
+ * stored in a \c DxfEntities.
+ */
+static size_t
+dxf_memory_usage_sizeof_entity
+(
+        DxfEntityType type
+                /*!< type of entity. */
+)
+{
+        switch (type)
+        {
+                case DFACE:
+                        return (sizeof (Dxf3dface));
+                case DSOLID:
+                        return (sizeof (Dxf3dsolid));
+                case ACADPROXYENTITY:
+                        return (sizeof (DxfAcadProxyEntity));
+                case ARC:
+                        return (sizeof (DxfArc));
+                case ATTDEF:
+                        return (sizeof (DxfAttdef));
+                case ATTRIB:
+                        return (sizeof (DxfAttrib));
+                case BODY:
+                        return (sizeof (DxfBody));
+                case CIRCLE:
+                        return (sizeof (DxfCircle));
+                case DIMENSION:
+                        return (sizeof (DxfDimension));
+                case ELLIPSE:
+                        return (sizeof (DxfEllipse));
+                case HATCH:
+                        return (sizeof (DxfHatch));
+                case HELIX:
+                        return (sizeof (DxfHelix));
+                case IMAGE:
+                        return (sizeof (DxfImage));
+                case INSERT:
+                        return (sizeof (DxfInsert));
+                case LEADER:
+                        return (sizeof (DxfLeader));
+                case LIGHT:
+                        return (sizeof (DxfLight));
+                case LINE:
+                        return (sizeof (DxfLine));
+                case LWPOLYLINE:
+                        return (sizeof (DxfLWPolyline));
+                case MESH:
+                        return (sizeof (DxfMesh));
+                case MLINE:
+                        return (sizeof (DxfMline));
+                case MTEXT:
+                        return (sizeof (DxfMtext));
+                case OLEFRAME:
+                        return (sizeof (DxfOleFrame));
+                case OLE2FRAME:
+                        return (sizeof (DxfOle2Frame));
+                case POINT:
+                        return (sizeof (DxfPoint));
+                case POLYLINE:
+                        return (sizeof (DxfPolyline));
+                case RAY:
+                        return (sizeof (DxfRay));
+                case REGION:
+                        return (sizeof (DxfRegion));
+                case SHAPE:
+                        return (sizeof (DxfShape));
+                case SOLID:
+                        return (sizeof (DxfSolid));
+                case SPLINE:
+                        return (sizeof (DxfSpline));
+                case TABLE:
+                        return (sizeof (DxfTable));
+                case TEXT:
+                        return (sizeof (DxfText));
+                case TOLERANCE:
+                        return (sizeof (DxfTolerance));
+                case TRACE:
+                        return (sizeof (DxfTrace));
+                case VERTEX:
+                        return (sizeof (DxfVertex));
+                case VIEWPORT:
+                        return (sizeof (DxfViewport));
+                default:
+                        return (0);
+        }
+}
+
+
+/*!
+ * \brief Add a \c DxfPoint member of an entity.
+ */
+static void
+dxf_memory_usage_add_point
+(
+        DxfMemoryUsage *usage,
+                /*!< memory usage to add to. */
+        DxfMemorySection section,
+                /*!< section the point belongs to. */
+        DxfEntityType type,
+                /*!< type of entity the point belongs to. */
+        DxfPoint *point
+                /*!< point, may be \c NULL. */
+)
+{
+        if (point != NULL)
+        {
+                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, sizeof (DxfPoint));
+        }
+}
+
+
+/*!
+ * \brief Add the single precision storage of the points of an entity.
+ */
+static void
+dxf_memory_usage_add_point_offsets
+(
+        DxfMemoryUsage *usage,
+                /*!< memory usage to add to. */
+        DxfMemorySection section,
+                /*!< section the points belong to. */
+        DxfEntityType type,
+                /*!< type of entity the points belong to. */
+        DxfPointOffsets *offsets
+                /*!< single precision storage, may be \c NULL. */
+)
+{
+        if (offsets != NULL)
+        {
+                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES,
+                  sizeof (DxfPointOffsets) + ((size_t) offsets->number_of_points * 3 * sizeof (float)));
+        }
+}
+
+
+/*!
+ * \brief Add a \c DxfBinaryBuffer.
+ */
+static void
+dxf_memory_usage_add_binary_buffer
+(
+        DxfMemoryUsage *usage,
+                /*!< memory usage to add to. */
+        DxfMemorySection section,
+                /*!< section the buffer belongs to. */
+        DxfEntityType type,
+                /*!< type of entity the buffer belongs to. */
+        DxfBinaryBuffer *buffer
+                /*!< buffer, may be \c NULL. */
+)
+{
+        if (buffer != NULL)
+        {
+                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_BINARY_DATA, sizeof (DxfBinaryBuffer));
+                if (buffer->data != NULL)
+                {
+                        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_BINARY_DATA, buffer->capacity);
+                }
+        }
+}
+
+
+/*!
+ * \brief Add a \c DxfDoubleArray.
+ */
+static void
+dxf_memory_usage_add_double_array
+(
+        DxfMemoryUsage *usage,
+                /*!< memory usage to add to. */
+        DxfMemorySection section,
+                /*!< section the array belongs to. */
+        DxfEntityType type,
+                /*!< type of entity the array belongs to. */
+        DxfDoubleArray *array
+                /*!< array, may be \c NULL. */
+)
+{
+        if (array != NULL)
+        {
+                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, sizeof (DxfDoubleArray));
+                if (array->values != NULL)
+                {
+                        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, array->capacity * sizeof (double));
+                }
+        }
+}
+
+
+/*!
+ * \brief Add a \c DxfProprietaryDataRange.
+ *
+ * Only the range itself is held in memory, the proprietary data stays
+ * in the DXF file until it is decoded.
+ */
+static void
+dxf_memory_usage_add_proprietary_data_range
+(
+        DxfMemoryUsage *usage,
+                /*!< memory usage to add to. */
+        DxfMemorySection section,
+                /*!< section the range belongs to. */
+        DxfEntityType type,
+                /*!< type of entity the range belongs to. */
+        DxfProprietaryDataRange *range
+                /*!< range, may be \c NULL. */
+)
+{
+        if (range != NULL)
+        {
+                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_BINARY_DATA, sizeof (DxfProprietaryDataRange));
+                if (range->filename != NULL)
+                {
+                        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRINGS, strlen (range->filename) + 1);
+                }
+        }
+}
+
+
+/*!
+ * \brief Add the strings and cold members of a \c DxfEntityCommon.
+ *
+ * The \c DxfEntityCommon itself is part of the entity struct.
+ */
+static void
+dxf_memory_usage_add_common
+(
+        DxfMemoryUsage *usage,
+                /*!< memory usage to add to. */
+        DxfMemorySection section,
+                /*!< section the entity belongs to. */
+        DxfEntityType type,
+                /*!< type of entity. */
+        DxfEntityCommon *common
+                /*!< common entity header, may be \c NULL. */
+)
+{
+        if (common == NULL)
+        {
+                return;
+        }
+        dxf_memory_usage_add_string (usage, section, type, common->layer);
+        dxf_memory_usage_add_string (usage, section, type, common->linetype);
+        if (common->cold != NULL)
+        {
+                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfEntityCommonCold));
+                dxf_memory_usage_add_string (usage, section, type, common->cold->color_name);
+                dxf_memory_usage_add_string (usage, section, type, common->cold->xdata_application_name);
+                dxf_memory_usage_add_binary_buffer (usage, section, type, common->cold->binary_graphics_data);
+                dxf_memory_usage_add_binary_buffer (usage, section, type, common->cold->xdata_binary_data);
+        }
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfMemoryUsage.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfMemoryUsage *
+dxf_memory_usage_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMemoryUsage *usage = NULL;
+        size_t size;
+
+        size = sizeof (DxfMemoryUsage);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((usage = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfMemoryUsage struct.\n")),
+                  __FUNCTION__);
+                usage = NULL;
+        }
+        else
+        {
+                memset (usage, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (usage);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfMemoryUsage.
+ *
+ * All counters are set to zero.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfMemoryUsage *
+dxf_memory_usage_init
+(
+        DxfMemoryUsage *usage
+                /*!< a pointer to a \c DxfMemoryUsage. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (usage == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                usage = dxf_memory_usage_new ();
+        }
+        if (usage == NULL)
+        {
+              fprintf (stderr,
+                (_("Error in %s () could not allocate memory for a DxfMemoryUsage struct.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        memset (usage, 0, sizeof (DxfMemoryUsage));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (usage);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfMemoryUsage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_free
+(
+        DxfMemoryUsage *usage
+                /*!< a pointer to the memory occupied by the
+                 * \c DxfMemoryUsage. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (usage == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (usage);
+        usage = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a single allocation to a \c DxfMemoryUsage.
+ *
+ * Use \c UNKNOWN_ENTITY as \c type for allocations which do not belong
+ * to an entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_add
+(
+        DxfMemoryUsage *usage,
+                /*!< a pointer to a \c DxfMemoryUsage. */
+        DxfMemorySection section,
+                /*!< section the allocation belongs to. */
+        DxfEntityType type,
+                /*!< type of entity the allocation belongs to. */
+        DxfMemoryKind kind,
+                /*!< kind of sub-structure of the allocation. */
+        size_t bytes
+                /*!< number of bytes allocated. */
+)
+{
+        /* Do some basic checks. */
+        if (usage == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((section < 0) || (section >= DXF_NUMBER_OF_MEMORY_SECTIONS)
+          || (kind < 0) || (kind >= DXF_NUMBER_OF_MEMORY_KINDS)
+          || (type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        usage->total.bytes += bytes;
+        usage->total.allocations++;
+        usage->section[section].bytes += bytes;
+        usage->section[section].allocations++;
+        usage->kind[kind].bytes += bytes;
+        usage->kind[kind].allocations++;
+        if (type != UNKNOWN_ENTITY)
+        {
+                usage->entity_type[type].bytes += bytes;
+                usage->entity_type[type].allocations++;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a string to a \c DxfMemoryUsage.
+ *
+ * \c NULL strings are not counted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_add_string
+(
+        DxfMemoryUsage *usage,
+                /*!< a pointer to a \c DxfMemoryUsage. */
+        DxfMemorySection section,
+                /*!< section the string belongs to. */
+        DxfEntityType type,
+                /*!< type of entity the string belongs to. */
+        const char *string
+                /*!< string, may be \c NULL. */
+)
+{
+        if (string == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        return (dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRINGS, strlen (string) + 1));
+}
+
+
+/*!
+ * \brief Add an entity and the memory it owns to a \c DxfMemoryUsage.
+ *
+ * The entity struct, its strings, points, binary data and coordinate
+ * arrays are counted.\n
+ * Members which are not listed here are counted as part of the entity
+ * struct only.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_add_entity
+(
+        DxfMemoryUsage *usage,
+                /*!< a pointer to a \c DxfMemoryUsage. */
+        DxfMemorySection section,
+                /*!< section the entity belongs to. */
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity
+                /*!< pointer to an entity of type \c type. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *vertex = NULL;
+        size_t size;
+        int i;
+
+        /* Do some basic checks. */
+        if ((usage == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        size = dxf_memory_usage_sizeof_entity (type);
+        if (size == 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () unsupported entity type %d.\n")),
+                  __FUNCTION__, type);
+                return (EXIT_FAILURE);
+        }
+        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRUCTS, size);
+        switch (type)
+        {
+                case DFACE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((Dxf3dface *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((Dxf3dface *) entity)->p1);
+                        dxf_memory_usage_add_point (usage, section, type, ((Dxf3dface *) entity)->p2);
+                        dxf_memory_usage_add_point (usage, section, type, ((Dxf3dface *) entity)->p3);
+                        dxf_memory_usage_add_point_offsets (usage, section, type, ((Dxf3dface *) entity)->offsets);
+                        break;
+                case DSOLID:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_proprietary_data_range (usage, section, type, ((Dxf3dsolid *) entity)->proprietary_data_range);
+                        break;
+                case ACADPROXYENTITY:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case ARC:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfArc *) entity)->p0);
+                        break;
+                case ATTDEF:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case ATTRIB:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case BODY:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_proprietary_data_range (usage, section, type, ((DxfBody *) entity)->proprietary_data_range);
+                        break;
+                case CIRCLE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfCircle *) entity)->p0);
+                        break;
+                case DIMENSION:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case ELLIPSE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfEllipse *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfEllipse *) entity)->p1);
+                        break;
+                case HATCH:
+                {
+                        DxfHatchBoundaryPath *path;
+                        DxfHatchBoundaryPathPolyline *polyline;
+                        DxfHatchBoundaryPathPolylineVertex *vertex;
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfHatch *) entity)->p0);
+                        for (path = (DxfHatchBoundaryPath *) ((DxfHatch *) entity)->paths;
+                          path != NULL;
+                          path = (DxfHatchBoundaryPath *) path->next)
+                        {
+                                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                                  polyline != NULL;
+                                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                                {
+                                        dxf_memory_usage_add_point_offsets (usage, section, type, polyline->offsets);
+                                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                          vertex != NULL;
+                                          vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                                        {
+                                                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, sizeof (DxfHatchBoundaryPathPolylineVertex));
+                                        }
+                                }
+                        }
+                        break;
+                }
+                case HELIX:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case IMAGE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case INSERT:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfInsert *) entity)->p0);
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfInsert *) entity)->block_name);
+                        break;
+                case LEADER:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case LIGHT:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case LINE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfLine *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfLine *) entity)->p1);
+                        dxf_memory_usage_add_point_offsets (usage, section, type, ((DxfLine *) entity)->offsets);
+                        break;
+                case LWPOLYLINE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        if (((DxfLWPolyline *) entity)->vertices_size > 0)
+                        {
+                                /* The start_width, end_width and bulge arrays. */
+                                for (i = 0; i < 3; i++)
+                                {
+                                        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, ((DxfLWPolyline *) entity)->vertices_size * sizeof (double));
+                                }
+                                /* The x and y (or x_offset and y_offset) arrays. */
+                                for (i = 0; i < 2; i++)
+                                {
+                                        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, ((DxfLWPolyline *) entity)->vertices_size * ((((DxfLWPolyline *) entity)->single_precision) ? sizeof (float) : sizeof (double)));
+                                }
+                        }
+                        break;
+                case MESH:
+                {
+                        DxfPoint *point;
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        for (point = ((DxfMesh *) entity)->p0;
+                          point != NULL;
+                          point = (DxfPoint *) point->next)
+                        {
+                                dxf_memory_usage_add_point (usage, section, type, point);
+                        }
+                        dxf_memory_usage_add_point_offsets (usage, section, type, ((DxfMesh *) entity)->offsets);
+                        break;
+                }
+                case MLINE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case MTEXT:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfMtext *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfMtext *) entity)->p1);
+                        if (((DxfMtext *) entity)->text_value != NULL)
+                        {
+                                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRINGS, ((DxfMtext *) entity)->text_size);
+                        }
+                        if (((DxfMtext *) entity)->text_chunk_offset != NULL)
+                        {
+                                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRINGS, ((DxfMtext *) entity)->text_chunk_offset_size * sizeof (size_t));
+                        }
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfMtext *) entity)->text_style);
+                        break;
+                case OLEFRAME:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case OLE2FRAME:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfOle2Frame *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfOle2Frame *) entity)->p1);
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfOle2Frame *) entity)->end_of_data);
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfOle2Frame *) entity)->length_of_binary_data);
+                        dxf_memory_usage_add_binary_buffer (usage, section, type, ((DxfOle2Frame *) entity)->binary_data);
+                        break;
+                case POINT:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case POLYLINE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfPolyline *) entity)->p0);
+                        vertex = ((DxfPolyline *) entity)->vertices;
+                        while (vertex != NULL)
+                        {
+                                /* Vertices are accounted to the polyline they belong to. */
+                                dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_VERTICES, sizeof (DxfVertex));
+                                dxf_memory_usage_add_common (usage, section, type, &vertex->common);
+                                dxf_memory_usage_add_point (usage, section, type, vertex->p0);
+                                vertex = (DxfVertex *) vertex->next;
+                        }
+                        break;
+                case RAY:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case REGION:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_proprietary_data_range (usage, section, type, ((DxfRegion *) entity)->proprietary_data_range);
+                        break;
+                case SHAPE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case SOLID:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSolid *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSolid *) entity)->p1);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSolid *) entity)->p2);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSolid *) entity)->p3);
+                        break;
+                case SPLINE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSpline *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSpline *) entity)->p1);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSpline *) entity)->p2);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfSpline *) entity)->p3);
+                        dxf_memory_usage_add_double_array (usage, section, type, ((DxfSpline *) entity)->knot_value);
+                        dxf_memory_usage_add_double_array (usage, section, type, ((DxfSpline *) entity)->weight_value);
+                        break;
+                case TABLE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfTable *) entity)->block_name);
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfTable *) entity)->table_text_style_name);
+                        break;
+                case TEXT:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfText *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfText *) entity)->p1);
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfText *) entity)->text_value);
+                        dxf_memory_usage_add_string (usage, section, type, ((DxfText *) entity)->text_style);
+                        break;
+                case TOLERANCE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                case TRACE:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfTrace *) entity)->p0);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfTrace *) entity)->p1);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfTrace *) entity)->p2);
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfTrace *) entity)->p3);
+                        break;
+                case VERTEX:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        dxf_memory_usage_add_point (usage, section, type, ((DxfVertex *) entity)->p0);
+                        break;
+                case VIEWPORT:
+                        dxf_memory_usage_add_common (usage, section, type, dxf_entity_get_common (type, entity));
+                        break;
+                default:
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add all entities of a DXF \c ENTITIES section to a
+ * \c DxfMemoryUsage.
+ *
+ * The single linked lists of entities are walked, together with the
+ * file order sequence and the typed pools of the section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_add_entities
+(
+        DxfMemoryUsage *usage,
+                /*!< a pointer to a \c DxfMemoryUsage. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMemorySection section = DXF_MEMORY_SECTION_ENTITIES;
+        DxfEntityType type;
+        void *iter = NULL;
+
+        /* Do some basic checks. */
+        if ((usage == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfEntities));
+        if (entities->sequence != NULL)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, entities->sequence_size * sizeof (DxfEntitiesItem));
+        }
+        for (type = UNKNOWN_ENTITY + 1; type < DXF_NUMBER_OF_ENTITY_TYPES; type++)
+        {
+                if (entities->pool[type] != NULL)
+                {
+                        dxf_memory_usage_add (usage, section, type, DXF_MEMORY_KIND_STRUCTS, entities->pool_size[type] * sizeof (void *));
+                }
+                if (dxf_memory_usage_sizeof_entity (type) == 0)
+                {
+                        continue;
+                }
+                iter = dxf_entities_get_first (entities, type);
+                while (iter != NULL)
+                {
+                        dxf_memory_usage_add_entity (usage, section, type, iter);
+                        iter = dxf_entities_get_next (type, iter);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the tables of a DXF \c TABLES section to a
+ * \c DxfMemoryUsage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_add_tables
+(
+        DxfMemoryUsage *usage,
+                /*!< a pointer to a \c DxfMemoryUsage. */
+        DxfTables *tables
+                /*!< DXF tables section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMemorySection section = DXF_MEMORY_SECTION_TABLES;
+        DxfAppid *appid = NULL;
+        DxfBlockRecord *block_record = NULL;
+        DxfDimStyle *dimstyle = NULL;
+        DxfLayer *layer = NULL;
+        DxfLType *ltype = NULL;
+        DxfStyle *style = NULL;
+        DxfUcs *ucs = NULL;
+        DxfView *view = NULL;
+        DxfVPort *vport = NULL;
+
+        /* Do some basic checks. */
+        if ((usage == NULL) || (tables == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfTables));
+        for (appid = tables->appids; appid != NULL; appid = (DxfAppid *) appid->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfAppid));
+        }
+        for (block_record = tables->block_records; block_record != NULL; block_record = (DxfBlockRecord *) block_record->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfBlockRecord));
+        }
+        for (dimstyle = tables->dimstyles; dimstyle != NULL; dimstyle = (DxfDimStyle *) dimstyle->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfDimStyle));
+        }
+        for (layer = tables->layers; layer != NULL; layer = (DxfLayer *) layer->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfLayer));
+                dxf_memory_usage_add_string (usage, section, UNKNOWN_ENTITY, layer->layer_name);
+                dxf_memory_usage_add_string (usage, section, UNKNOWN_ENTITY, layer->linetype);
+        }
+        for (ltype = tables->ltypes; ltype != NULL; ltype = (DxfLType *) ltype->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfLType));
+        }
+        for (style = tables->styles; style != NULL; style = (DxfStyle *) style->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfStyle));
+        }
+        for (ucs = tables->ucss; ucs != NULL; ucs = (DxfUcs *) ucs->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfUcs));
+        }
+        for (view = tables->views; view != NULL; view = (DxfView *) view->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfView));
+        }
+        for (vport = tables->vports; vport != NULL; vport = (DxfVPort *) vport->next)
+        {
+                dxf_memory_usage_add (usage, section, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfVPort));
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a DXF drawing to a \c DxfMemoryUsage.
+ *
+ * Walks all sections of the drawing, the counters in \c usage are
+ * not reset, so several drawings can be added to the same
+ * \c DxfMemoryUsage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_add_drawing
+(
+        DxfMemoryUsage *usage,
+                /*!< a pointer to a \c DxfMemoryUsage. */
+        DxfDrawing *drawing
+                /*!< a pointer to a DXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClass *class = NULL;
+        DxfBlock *block = NULL;
+        DxfObject *object = NULL;
+        DxfThumbnail *thumbnail = NULL;
+
+        /* Do some basic checks. */
+        if ((usage == NULL) || (drawing == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->header != NULL)
+        {
+                dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_HEADER, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfHeader));
+        }
+        for (class = (DxfClass *) drawing->class_list; class != NULL; class = (DxfClass *) class->next)
+        {
+                dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_CLASSES, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfClass));
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_CLASSES, UNKNOWN_ENTITY, class->record_type);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_CLASSES, UNKNOWN_ENTITY, class->record_name);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_CLASSES, UNKNOWN_ENTITY, class->class_name);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_CLASSES, UNKNOWN_ENTITY, class->app_name);
+        }
+        if (drawing->tables_list != NULL)
+        {
+                dxf_memory_usage_add_tables (usage, (DxfTables *) drawing->tables_list);
+        }
+        for (block = (DxfBlock *) drawing->block_list; block != NULL; block = (DxfBlock *) block->next)
+        {
+                dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfBlock));
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, block->xref_name);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, block->block_name);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, block->block_name_additional);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, block->description);
+                dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, block->layer);
+                dxf_memory_usage_add_point (usage, DXF_MEMORY_SECTION_BLOCKS, UNKNOWN_ENTITY, block->p0);
+        }
+        if (drawing->entities_list != NULL)
+        {
+                dxf_memory_usage_add_entities (usage, (DxfEntities *) drawing->entities_list);
+        }
+        for (object = (DxfObject *) drawing->object_list; object != NULL; object = (DxfObject *) object->next)
+        {
+                dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_OBJECTS, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfObject));
+        }
+        thumbnail = (DxfThumbnail *) drawing->thumbnail;
+        if (thumbnail != NULL)
+        {
+                dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_THUMBNAILIMAGE, UNKNOWN_ENTITY, DXF_MEMORY_KIND_STRUCTS, sizeof (DxfThumbnail));
+                if (thumbnail->image != NULL)
+                {
+                        dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_THUMBNAILIMAGE, UNKNOWN_ENTITY, DXF_MEMORY_KIND_BINARY_DATA, sizeof (DxfBinaryBuffer));
+                        if (thumbnail->image->data != NULL)
+                        {
+                                dxf_memory_usage_add (usage, DXF_MEMORY_SECTION_THUMBNAILIMAGE, UNKNOWN_ENTITY, DXF_MEMORY_KIND_BINARY_DATA, thumbnail->image->capacity);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Print a report of a \c DxfMemoryUsage to \c stream.
+ *
+ * Sections, kinds of sub-structures and entity types without any
+ * allocations are left out.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_usage_print
+(
+        FILE *stream,
+                /*!< stream to print to, e.g. \c stdout. */
+        DxfMemoryUsage *usage
+                /*!< a pointer to a \c DxfMemoryUsage. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((stream == NULL) || (usage == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (stream, "%-20s %12s %12s\n", "", "bytes", "allocations");
+        fprintf (stream, "%-20s %12lu %12lu\n", "total",
+          (unsigned long) usage->total.bytes,
+          (unsigned long) usage->total.allocations);
+        for (i = 0; i < DXF_NUMBER_OF_MEMORY_SECTIONS; i++)
+        {
+                if (usage->section[i].allocations > 0)
+                {
+                        fprintf (stream, "%-20s %12lu %12lu\n",
+                          dxf_memory_usage_section_names[i],
+                          (unsigned long) usage->section[i].bytes,
+                          (unsigned long) usage->section[i].allocations);
+                }
+        }
+        for (i = 0; i < DXF_NUMBER_OF_MEMORY_KINDS; i++)
+        {
+                if (usage->kind[i].allocations > 0)
+                {
+                        fprintf (stream, "%-20s %12lu %12lu\n",
+                          dxf_memory_usage_kind_names[i],
+                          (unsigned long) usage->kind[i].bytes,
+                          (unsigned long) usage->kind[i].allocations);
+                }
+        }
+        for (i = 0; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (usage->entity_type[i].allocations > 0)
+                {
+                        fprintf (stream, "%-20s %12lu %12lu\n",
+                          dxf_entity_get_name (i),
+                          (unsigned long) usage->entity_type[i].bytes,
+                          (unsigned long) usage->entity_type[i].allocations);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,145 @@
+/*!
+ * \file memory_usage.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the memory usage accounting of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_MEMORY_USAGE_H
+#define LIBDXF_SRC_MEMORY_USAGE_H
+
+
+#include "global.h"
+#include "drawing.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Sections of a DXF drawing for memory usage accounting.
+ */
+typedef enum
+dxf_memory_section
+{
+        DXF_MEMORY_SECTION_HEADER,
+        DXF_MEMORY_SECTION_CLASSES,
+        DXF_MEMORY_SECTION_TABLES,
+        DXF_MEMORY_SECTION_BLOCKS,
+        DXF_MEMORY_SECTION_ENTITIES,
+        DXF_MEMORY_SECTION_OBJECTS,
+        DXF_MEMORY_SECTION_THUMBNAILIMAGE
+} DxfMemorySection;
+
+
+#define DXF_NUMBER_OF_MEMORY_SECTIONS (DXF_MEMORY_SECTION_THUMBNAILIMAGE + 1)
+        /*!< \brief Number of sections in \c DxfMemorySection. */
+
+
+/*!
+ * \brief Kinds of sub-structures for memory usage accounting.
+ */
+typedef enum
+dxf_memory_kind
+{
+        DXF_MEMORY_KIND_STRUCTS,
+                /*!< Entity, table and object structs. */
+        DXF_MEMORY_KIND_STRINGS,
+                /*!< Character strings (names, text values). */
+        DXF_MEMORY_KIND_BINARY_DATA,
+                /*!< Binary and proprietary data. */
+        DXF_MEMORY_KIND_VERTICES
+                /*!< Points, vertices and coordinate arrays. */
+} DxfMemoryKind;
+
+
+#define DXF_NUMBER_OF_MEMORY_KINDS (DXF_MEMORY_KIND_VERTICES + 1)
+        /*!< \brief Number of kinds in \c DxfMemoryKind. */
+
+
+/*!
+ * \brief Number of bytes and allocations.
+ */
+typedef struct
+dxf_memory_count_struct
+{
+        size_t bytes;
+                /*!< Number of bytes requested from the allocator. */
+        size_t allocations;
+                /*!< Number of allocations. */
+} DxfMemoryCount;
+
+
+/*!
+ * \brief Memory usage of a DXF drawing.
+ *
+ * Every allocation is counted once in \c total, once in \c section,
+ * once in \c kind and, when it belongs to an entity, once in
+ * \c entity_type.
+ */
+typedef struct
+dxf_memory_usage_struct
+{
+        DxfMemoryCount total;
+                /*!< Memory usage of the whole drawing. */
+        DxfMemoryCount section[DXF_NUMBER_OF_MEMORY_SECTIONS];
+                /*!< Memory usage per section. */
+        DxfMemoryCount entity_type[DXF_NUMBER_OF_ENTITY_TYPES];
+                /*!< Memory usage per entity type, indexed by
+                 * \c DxfEntityType. */
+        DxfMemoryCount kind[DXF_NUMBER_OF_MEMORY_KINDS];
+                /*!< Memory usage per kind of sub-structure. */
+} DxfMemoryUsage;
+
+
+DxfMemoryUsage *dxf_memory_usage_new ();
+DxfMemoryUsage *dxf_memory_usage_init (DxfMemoryUsage *usage);
+int dxf_memory_usage_free (DxfMemoryUsage *usage);
+int dxf_memory_usage_add (DxfMemoryUsage *usage, DxfMemorySection section, DxfEntityType type, DxfMemoryKind kind, size_t bytes);
+int dxf_memory_usage_add_string (DxfMemoryUsage *usage, DxfMemorySection section, DxfEntityType type, const char *string);
+int dxf_memory_usage_add_entity (DxfMemoryUsage *usage, DxfMemorySection section, DxfEntityType type, void *entity);
+int dxf_memory_usage_add_entities (DxfMemoryUsage *usage, DxfEntities *entities);
+int dxf_memory_usage_add_tables (DxfMemoryUsage *usage, DxfTables *tables);
+int dxf_memory_usage_add_drawing (DxfMemoryUsage *usage, DxfDrawing *drawing);
+int dxf_memory_usage_print (FILE *stream, DxfMemoryUsage *usage);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_MEMORY_USAGE_H */
+
+
+/* EOF */
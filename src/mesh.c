@@ -36,6 +36,7 @@
 
 
 #include "mesh.h"
+#include "entities.h"
 
 
 /*!
@@ -108,33 +109,19 @@ dxf_mesh_init
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->id_code = 0;
-        mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mesh->layer = strdup (DXF_DEFAULT_LAYER);
-        mesh->elevation = 0.0;
-        mesh->thickness = 0.0;
-        mesh->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        mesh->visibility = DXF_DEFAULT_VISIBILITY;
-        mesh->color = DXF_COLOR_BYLAYER;
-        mesh->paperspace = DXF_MODELSPACE;
-        mesh->graphics_data_size = 0;
-        mesh->shadow_mode = 0;
-        mesh->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        mesh->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mesh->binary_graphics_data);
-        mesh->dictionary_owner_soft = strdup ("");
-        mesh->object_owner_soft = strdup ("");
-        mesh->material = strdup ("");
-        mesh->dictionary_owner_hard = strdup ("");
-        mesh->lineweight = 0;
-        mesh->plot_style_name = strdup ("");
-        mesh->color_value = 0;
-        mesh->color_name = strdup ("");
-        mesh->transparency = 0;
+        if (dxf_entity_common_init (&mesh->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         mesh->p0 = dxf_point_new ();
         mesh->p0 = dxf_point_init (mesh->p0);
         mesh->p0->x0 = 0.0;
         mesh->p0->y0 = 0.0;
         mesh->p0->z0 = 0.0;
+        mesh->offsets = NULL;
         mesh->version = 0;
         mesh->blend_crease_property = 0;
         mesh->face_list_item = dxf_int32_new ();
@@ -150,8 +137,8 @@ dxf_mesh_init
         mesh->face_list_size_level_0 = 0;
         mesh->edge_count_level_0 = 0;
         mesh->edge_crease_count_level_0 = 0;
-        mesh->edge_create_value = dxf_double_new ();
-        mesh->edge_create_value = dxf_double_init (mesh->edge_create_value);
+        mesh->edge_create_value = dxf_double_array_new ();
+        mesh->edge_create_value = dxf_double_array_init (mesh->edge_create_value);
         mesh->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -160,6 +147,59 @@ dxf_mesh_init
 }
 
 
+/*!
+ * \brief Store \c value in the next node of a single linked list of
+ * \c DxfInt32 objects while reading a DXF \c MESH entity.
+ *
+ * The first value goes into the node allocated by dxf_mesh_init (),
+ * \c last keeps track of the node filled last.
+ *
+ * \return a pointer to the first node of the list.
+ */
+static DxfInt32 *
+dxf_mesh_read_int32
+(
+        DxfInt32 *list,
+                /*!< a pointer to the first node of the list, or
+                 * \c NULL for an empty list. */
+        DxfInt32 **last,
+                /*!< a pointer to the node filled last, \c NULL
+                 * before the first value. */
+        int32_t value
+                /*!< the value to store. */
+)
+{
+        DxfInt32 *node;
+
+        if ((*last == NULL) && (list != NULL))
+        {
+                node = list;
+        }
+        else
+        {
+                node = dxf_int32_init (dxf_int32_new ());
+                if (node == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (list);
+                }
+                if (list == NULL)
+                {
+                        list = node;
+                }
+                else
+                {
+                        dxf_int32_append (*last, node);
+                }
+        }
+        node->value = value;
+        *last = node;
+        return (list);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c MESH entity.
  *
@@ -183,9 +223,15 @@ dxf_mesh_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfPoint *vertex = NULL;
+        DxfPoint *point;
+        DxfInt32 *face_list_item = NULL;
+        DxfInt32 *edge_vertex_index = NULL;
+        int count_code = 0;
+        int sub_mesh = FALSE;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -193,8 +239,6 @@ dxf_mesh_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mesh == NULL)
@@ -202,244 +246,211 @@ dxf_mesh_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                mesh = dxf_mesh_init (mesh);
+                mesh = dxf_mesh_init (dxf_mesh_new ());
+                if (mesh == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter310 = (DxfBinaryGraphicsData *) mesh->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &mesh->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->paperspace);
-                }
-                /*! \todo Implement Group codes 90 - 95 in a proper way. */
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbSubMesh") != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mesh->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mesh->transparency);
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                /* X-coordinate of a vertex, this starts
+                                 * a new vertex, the first one is the
+                                 * vertex allocated by dxf_mesh_init (). */
+                                if ((vertex == NULL)
+                                  && (mesh->p0 != NULL))
+                                {
+                                        vertex = mesh->p0;
+                                }
+                                else
+                                {
+                                        point = dxf_point_init (dxf_point_new ());
+                                        if (point == NULL)
+                                        {
+                                                fprintf (stderr,
+                                                  (_("Error in %s () could not allocate memory.\n")),
+                                                  __FUNCTION__);
+                                                return (NULL);
+                                        }
+                                        if (vertex == NULL)
+                                        {
+                                                mesh->p0 = point;
+                                        }
+                                        else
+                                        {
+                                                vertex->next = (struct DxfPoint *) point;
+                                        }
+                                        vertex = point;
+                                }
+                                vertex->x0 = atof (value);
+                                break;
+                        case 20:
+                                /* Y-coordinate of the vertex. */
+                                if (vertex != NULL)
+                                {
+                                        vertex->y0 = atof (value);
+                                }
+                                break;
+                        case 30:
+                                /* Z-coordinate of the vertex. */
+                                if (vertex != NULL)
+                                {
+                                        vertex->z0 = atof (value);
+                                }
+                                break;
+                        case 71:
+                                /* Version number. */
+                                mesh->version = (int16_t) atoi (value);
+                                break;
+                        case 72:
+                                /* "Blend Crease" property. */
+                                mesh->blend_crease_property = (int16_t) atoi (value);
+                                break;
+                        case 90:
+                                /* The meaning depends on the count
+                                 * read before. */
+                                if (count_code == 93)
+                                {
+                                        /* Face list item. */
+                                        mesh->face_list_item = dxf_mesh_read_int32 (mesh->face_list_item, &face_list_item, atoi (value));
+                                }
+                                else if (count_code == 94)
+                                {
+                                        /* Vertex index of an edge. */
+                                        mesh->edge_vertex_index = dxf_mesh_read_int32 (mesh->edge_vertex_index, &edge_vertex_index, atoi (value));
+                                }
+                                else if (count_code == 95)
+                                {
+                                        /* Count of overridden
+                                         * sub-entities. */
+                                        mesh->number_of_property_overridden_sub_entities = atoi (value);
+                                        count_code = 90;
+                                }
+                                else
+                                {
+                                        /* Property type. */
+                                        mesh->property_type = atoi (value);
+                                }
+                                break;
+                        case 91:
+                                if (count_code >= 95)
+                                {
+                                        /* Sub-entity marker. */
+                                        mesh->sub_entity_marker = atoi (value);
+                                }
+                                else
+                                {
+                                        /* Number of subdivision level. */
+                                        mesh->subdivision_level = atoi (value);
+                                }
+                                break;
+                        case 92:
+                                if (!sub_mesh)
+                                {
+                                        /* Graphics data size of the
+                                         * entity. */
+                                        dxf_entity_common_read_pair (fp, &mesh->common, group_code, value);
+                                }
+                                else if (count_code >= 95)
+                                {
+                                        /* Count of overridden
+                                         * properties. */
+                                        mesh->count_of_property_overridden = atoi (value);
+                                }
+                                else
+                                {
+                                        /* Vertex count of level 0. */
+                                        mesh->vertex_count_level_0 = atoi (value);
+                                }
+                                break;
+                        case 93:
+                                /* Size of the face list of level 0. */
+                                mesh->face_list_size_level_0 = atoi (value);
+                                count_code = 93;
+                                break;
+                        case 94:
+                                /* Edge count of level 0. */
+                                mesh->edge_count_level_0 = atoi (value);
+                                count_code = 94;
+                                break;
+                        case 95:
+                                /* Edge crease count of level 0, make
+                                 * room for all edge create values at
+                                 * once. */
+                                mesh->edge_crease_count_level_0 = atoi (value);
+                                dxf_double_array_reserve (mesh->edge_create_value, mesh->edge_crease_count_level_0);
+                                count_code = 95;
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if (strcmp (value, "AcDbSubMesh") == 0)
+                                {
+                                        sub_mesh = TRUE;
+                                }
+                                else if (strcmp (value, "AcDbEntity") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 140:
+                                /* Edge create value. */
+                                dxf_double_array_append (mesh->edge_create_value, atof (value));
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &mesh->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (mesh->linetype, "") == 0)
+        if ((mesh->common.linetype == NULL)
+          || (strcmp (mesh->common.linetype, "") == 0))
         {
-                mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (mesh->common.linetype);
+                mesh->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (mesh->layer, "") == 0)
+        if ((mesh->common.layer == NULL)
+          || (strcmp (mesh->common.layer, "") == 0))
         {
-                mesh->layer = strdup (DXF_DEFAULT_LAYER);
+                free (mesh->common.layer);
+                mesh->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
+        if (fp->single_precision)
+        {
+                dxf_mesh_set_single_precision (mesh, fp->origin_x, fp->origin_y, fp->origin_z);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -466,6 +477,10 @@ dxf_mesh_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("MESH");
+        int i;
+        double x;
+        double y;
+        double z;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -486,7 +501,8 @@ dxf_mesh_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (mesh->p0 == NULL)
+        if ((mesh->p0 == NULL)
+          && (mesh->offsets == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -495,31 +511,31 @@ dxf_mesh_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (mesh->linetype, "") == 0)
+        if (strcmp (mesh->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, mesh->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, mesh->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mesh->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (mesh->layer, "") == 0)
+        if (strcmp (mesh->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, mesh->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, mesh->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                mesh->layer = DXF_DEFAULT_LAYER;
+                mesh->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (mesh->id_code != -1)
+        if (mesh->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", mesh->id_code);
+                dxf_handle_write (fp, 5, mesh->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -531,97 +547,91 @@ dxf_mesh_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mesh->dictionary_owner_soft, "") != 0)
+        if ((mesh->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", mesh->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, mesh->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (mesh->dictionary_owner_hard, "") != 0)
+        if ((mesh->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", mesh->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, mesh->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (mesh->object_owner_soft, "") != 0)
+        if ((mesh->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", mesh->object_owner_soft);
+                dxf_handle_write (fp, 330, mesh->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (mesh->paperspace == DXF_PAPERSPACE)
+        if (mesh->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mesh->layer);
-        if (strcmp (mesh->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", mesh->common.layer);
+        if (strcmp (mesh->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mesh->linetype);
+                fprintf (fp->fp, "  6\n%s\n", mesh->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (mesh->material, "") != 0))
+          && (mesh->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", mesh->material);
+                dxf_handle_write (fp, 347, mesh->common.cold->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (mesh->elevation != 0.0))
+          && (mesh->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", mesh->elevation);
+                fprintf (fp->fp, " 38\n%f\n", mesh->common.elevation);
         }
-        if (mesh->color != DXF_COLOR_BYLAYER)
+        if (mesh->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", mesh->color);
+                fprintf (fp->fp, " 62\n%hd\n", mesh->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", mesh->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", mesh->common.lineweight);
         }
-        if (mesh->linetype_scale != 1.0)
+        if (mesh->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", mesh->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", mesh->common.linetype_scale);
         }
-        if (mesh->visibility != 0)
+        if (mesh->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", mesh->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", mesh->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", mesh->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", mesh->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", mesh->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", mesh->common.cold->graphics_data_size);
 #endif
-                if (mesh->binary_graphics_data != NULL)
+                if (mesh->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) mesh->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, mesh->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", mesh->color_value);
-                fprintf (fp->fp, "430\n%s\n", mesh->color_name);
-                fprintf (fp->fp, "440\n%ld\n", mesh->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", mesh->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", mesh->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", mesh->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", mesh->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", mesh->shadow_mode);
+                dxf_handle_write (fp, 390, mesh->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", mesh->common.cold->shadow_mode);
         }
-        if (mesh->thickness != 0.0)
+        if (mesh->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", mesh->thickness);
+                fprintf (fp->fp, " 39\n%f\n", mesh->common.thickness);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -631,15 +641,25 @@ dxf_mesh_write
         fprintf (fp->fp, " 72\n%d\n", mesh->blend_crease_property);
         fprintf (fp->fp, " 91\n%d\n", mesh->subdivision_level);
         fprintf (fp->fp, " 92\n%d\n", mesh->vertex_count_level_0);
-        if (mesh->p0 != NULL)
+        if (mesh->offsets != NULL)
+        {
+                for (i = 0; i < mesh->offsets->number_of_points; i++)
+                {
+                        dxf_point_offsets_get (mesh->offsets, i, &x, &y, &z);
+                        fprintf (fp->fp, " 10\n%f\n", x);
+                        fprintf (fp->fp, " 20\n%f\n", y);
+                        fprintf (fp->fp, " 30\n%f\n", z);
+                }
+        }
+        else
         {
                 DxfPoint *p0_iter;
                 p0_iter = (DxfPoint *) mesh->p0;
                 while (p0_iter != NULL)
                 {
-                        fprintf (fp->fp, " 10\n%f\n", mesh->p0->x0);
-                        fprintf (fp->fp, " 20\n%f\n", mesh->p0->y0);
-                        fprintf (fp->fp, " 30\n%f\n", mesh->p0->z0);
+                        fprintf (fp->fp, " 10\n%f\n", p0_iter->x0);
+                        fprintf (fp->fp, " 20\n%f\n", p0_iter->y0);
+                        fprintf (fp->fp, " 30\n%f\n", p0_iter->z0);
                         p0_iter = (DxfPoint *) p0_iter->next;
                 }
         }
@@ -668,18 +688,16 @@ dxf_mesh_write
         fprintf (fp->fp, " 95\n%d\n", mesh->edge_crease_count_level_0);
         if (mesh->edge_create_value != NULL)
         {
-                DxfDouble *edge_create_value_iter;
-                edge_create_value_iter = (DxfDouble *) mesh->edge_create_value;
-                while (edge_create_value_iter != NULL)
+                for (i = 0; i < (int) mesh->edge_create_value->length; i++)
                 {
-                        fprintf (fp->fp, "140\n%f\n", mesh->edge_create_value->value);
-                        edge_create_value_iter = (DxfDouble *) edge_create_value_iter->next;
+                        fprintf (fp->fp, "140\n%f\n", mesh->edge_create_value->values[i]);
                 }
         }
         fprintf (fp->fp, " 90\n%d\n", mesh->number_of_property_overridden_sub_entities);
         fprintf (fp->fp, " 91\n%d\n", mesh->sub_entity_marker);
         fprintf (fp->fp, " 92\n%d\n", mesh->count_of_property_overridden);
         fprintf (fp->fp, " 90\n%d\n", mesh->property_type);
+        dxf_entity_common_write_xdata (fp, &mesh->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -722,19 +740,18 @@ dxf_mesh_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mesh->linetype);
-        free (mesh->layer);
-        dxf_binary_graphics_data_free_list (mesh->binary_graphics_data);
-        free (mesh->dictionary_owner_soft);
-        free (mesh->object_owner_soft);
-        free (mesh->material);
-        free (mesh->dictionary_owner_hard);
-        free (mesh->plot_style_name);
-        free (mesh->color_name);
-        dxf_point_free_list (mesh->p0);
+        dxf_entity_common_free (&mesh->common);
+        if (mesh->p0 != NULL)
+        {
+                dxf_point_free_list (mesh->p0);
+        }
+        if (mesh->offsets != NULL)
+        {
+                dxf_point_offsets_free (mesh->offsets);
+        }
         dxf_int32_free_list (mesh->face_list_item);
         dxf_int32_free_list (mesh->edge_vertex_index);
-        dxf_double_free_list (mesh->edge_create_value);
+        dxf_double_array_free (mesh->edge_create_value);
         free (mesh);
         mesh = NULL;
 #if DEBUG
@@ -768,6 +785,7 @@ dxf_mesh_free_list
         while (meshes != NULL)
         {
                 DxfMesh *iter = (DxfMesh *) meshes->next;
+                meshes->next = NULL;
                 dxf_mesh_free (meshes);
                 meshes = (DxfMesh *) iter;
         }
@@ -777,12 +795,164 @@ dxf_mesh_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c MESH entity.
+ *
+ * The copy does not share any memory with \c mesh, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfMesh *
+dxf_mesh_copy
+(
+        DxfMesh *mesh
+                /*!< a pointer to the DXF \c MESH entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMesh *copy;
+        DxfPoint *point;
+        DxfPoint *last_point = NULL;
+        DxfPoint *iter;
+        DxfInt32 *item;
+        DxfInt32 *last_item;
+        DxfInt32 *iter_item;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_mesh_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, mesh, sizeof (DxfMesh));
+        copy->offsets = NULL;
+        copy->p0 = NULL;
+        copy->face_list_item = NULL;
+        copy->edge_vertex_index = NULL;
+        copy->edge_create_value = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &mesh->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_mesh_free (copy);
+                return (NULL);
+        }
+        if (mesh->offsets != NULL)
+        {
+                copy->offsets = dxf_point_offsets_copy (mesh->offsets);
+                if (copy->offsets == NULL)
+                {
+                        dxf_mesh_free (copy);
+                        return (NULL);
+                }
+        }
+        for (iter = mesh->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                point = dxf_point_copy (iter);
+                if (point == NULL)
+                {
+                        dxf_mesh_free (copy);
+                        return (NULL);
+                }
+                if (last_point == NULL)
+                {
+                        copy->p0 = point;
+                }
+                else
+                {
+                        last_point->next = (struct DxfPoint *) point;
+                }
+                last_point = point;
+        }
+        last_item = NULL;
+        for (iter_item = mesh->face_list_item; iter_item != NULL; iter_item = (DxfInt32 *) iter_item->next)
+        {
+                item = dxf_int32_new ();
+                if (item == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mesh_free (copy);
+                        return (NULL);
+                }
+                item->value = iter_item->value;
+                item->next = NULL;
+                if (last_item == NULL)
+                {
+                        copy->face_list_item = item;
+                }
+                else
+                {
+                        last_item->next = (struct DxfInt32 *) item;
+                }
+                last_item = item;
+        }
+        last_item = NULL;
+        for (iter_item = mesh->edge_vertex_index; iter_item != NULL; iter_item = (DxfInt32 *) iter_item->next)
+        {
+                item = dxf_int32_new ();
+                if (item == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mesh_free (copy);
+                        return (NULL);
+                }
+                item->value = iter_item->value;
+                item->next = NULL;
+                if (last_item == NULL)
+                {
+                        copy->edge_vertex_index = item;
+                }
+                else
+                {
+                        last_item->next = (struct DxfInt32 *) item;
+                }
+                last_item = item;
+        }
+        if (mesh->edge_create_value != NULL)
+        {
+                copy->edge_create_value = dxf_double_array_init (dxf_double_array_new ());
+                if ((copy->edge_create_value == NULL)
+                  || (dxf_double_array_append_values (copy->edge_create_value,
+                  mesh->edge_create_value->values,
+                  mesh->edge_create_value->length) == EXIT_FAILURE))
+                {
+                        dxf_mesh_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c MESH entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_mesh_get_id_code
 (
         DxfMesh *mesh
@@ -800,16 +970,10 @@ dxf_mesh_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->id_code);
+        return (mesh->common.id_code);
 }
 
 
@@ -824,7 +988,7 @@ dxf_mesh_set_id_code
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -841,13 +1005,7 @@ dxf_mesh_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        mesh->id_code = id_code;
+        mesh->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -878,7 +1036,7 @@ dxf_mesh_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->linetype ==  NULL)
+        if (mesh->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -888,7 +1046,7 @@ dxf_mesh_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->linetype));
+        return (strdup (mesh->common.linetype));
 }
 
 
@@ -926,7 +1084,7 @@ dxf_mesh_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->linetype = strdup (linetype);
+        mesh->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -957,7 +1115,7 @@ dxf_mesh_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->layer ==  NULL)
+        if (mesh->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -967,7 +1125,7 @@ dxf_mesh_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->layer));
+        return (strdup (mesh->common.layer));
 }
 
 
@@ -1005,7 +1163,7 @@ dxf_mesh_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->layer = strdup (layer);
+        mesh->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1039,7 +1197,7 @@ dxf_mesh_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->elevation);
+        return (mesh->common.elevation);
 }
 
 
@@ -1069,7 +1227,7 @@ dxf_mesh_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->elevation = elevation;
+        mesh->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1100,7 +1258,7 @@ dxf_mesh_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->thickness < 0.0)
+        if (mesh->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1110,7 +1268,7 @@ dxf_mesh_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->thickness);
+        return (mesh->common.thickness);
 }
 
 
@@ -1146,7 +1304,7 @@ dxf_mesh_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->thickness = thickness;
+        mesh->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1177,7 +1335,7 @@ dxf_mesh_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->linetype_scale < 0.0)
+        if (mesh->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1186,7 +1344,7 @@ dxf_mesh_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->linetype_scale);
+        return (mesh->common.linetype_scale);
 }
 
 
@@ -1222,7 +1380,7 @@ dxf_mesh_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->linetype_scale = linetype_scale;
+        mesh->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1253,13 +1411,13 @@ dxf_mesh_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->visibility < 0)
+        if (mesh->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mesh->visibility > 1)
+        if (mesh->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1268,7 +1426,7 @@ dxf_mesh_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->visibility);
+        return (mesh->common.visibility);
 }
 
 
@@ -1310,7 +1468,7 @@ dxf_mesh_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->visibility = visibility;
+        mesh->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1341,7 +1499,7 @@ dxf_mesh_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->color < 0)
+        if (mesh->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1350,7 +1508,7 @@ dxf_mesh_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->color);
+        return (mesh->common.color);
 }
 
 
@@ -1386,7 +1544,7 @@ dxf_mesh_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->color = color;
+        mesh->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1417,13 +1575,13 @@ dxf_mesh_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->paperspace < 0)
+        if (mesh->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mesh->paperspace > 1)
+        if (mesh->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1432,7 +1590,7 @@ dxf_mesh_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->paperspace);
+        return (mesh->common.paperspace);
 }
 
 
@@ -1475,7 +1633,7 @@ dxf_mesh_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->paperspace = paperspace;
+        mesh->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1507,13 +1665,13 @@ dxf_mesh_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->graphics_data_size < 0)
+        if (mesh->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mesh->graphics_data_size == 0)
+        if (mesh->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1522,7 +1680,7 @@ dxf_mesh_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->graphics_data_size);
+        return (mesh->common.cold->graphics_data_size);
 }
 
 
@@ -1565,7 +1723,7 @@ dxf_mesh_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->graphics_data_size = graphics_data_size;
+        mesh->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1597,13 +1755,13 @@ dxf_mesh_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mesh->shadow_mode < 0)
+        if (mesh->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mesh->shadow_mode > 3)
+        if (mesh->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1612,7 +1770,7 @@ dxf_mesh_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->shadow_mode);
+        return (mesh->common.cold->shadow_mode);
 }
 
 
@@ -1654,7 +1812,7 @@ dxf_mesh_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        mesh->shadow_mode = shadow_mode;
+        mesh->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1666,11 +1824,12 @@ dxf_mesh_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c MESH entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_mesh_get_binary_graphics_data
 (
         DxfMesh *mesh
@@ -1688,17 +1847,10 @@ dxf_mesh_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) mesh->binary_graphics_data);
+        return (mesh->common.cold->binary_graphics_data);
 }
 
 
@@ -1706,17 +1858,20 @@ dxf_mesh_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c MESH entity.
  *
- * \return a pointer to \c mesh when successful, or \c NULL when an error
- * occurred.
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c mesh when successful, or \c NULL when an
+ * error occurred.
  */
 DxfMesh *
 dxf_mesh_set_binary_graphics_data
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1737,7 +1892,12 @@ dxf_mesh_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((mesh->common.cold->binary_graphics_data != NULL)
+          && (mesh->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (mesh->common.cold->binary_graphics_data);
+        }
+        mesh->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1771,17 +1931,10 @@ dxf_mesh_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->dictionary_owner_soft));
+        return (dxf_handle_to_string (mesh->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1820,7 +1973,7 @@ dxf_mesh_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mesh->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1854,17 +2007,10 @@ dxf_mesh_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->object_owner_soft));
+        return (dxf_handle_to_string (mesh->common.cold->object_owner_soft));
 }
 
 
@@ -1903,7 +2049,7 @@ dxf_mesh_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->object_owner_soft = strdup (object_owner_soft);
+        mesh->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1937,17 +2083,10 @@ dxf_mesh_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->material));
+        return (dxf_handle_to_string (mesh->common.cold->material));
 }
 
 
@@ -1985,7 +2124,7 @@ dxf_mesh_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->material = strdup (material);
+        mesh->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2019,17 +2158,10 @@ dxf_mesh_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->dictionary_owner_hard));
+        return (dxf_handle_to_string (mesh->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2068,7 +2200,7 @@ dxf_mesh_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mesh->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2103,7 +2235,7 @@ dxf_mesh_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->lineweight);
+        return (mesh->common.lineweight);
 }
 
 
@@ -2133,7 +2265,7 @@ dxf_mesh_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->lineweight = lineweight;
+        mesh->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2165,17 +2297,10 @@ dxf_mesh_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->plot_style_name));
+        return (dxf_handle_to_string (mesh->common.cold->plot_style_name));
 }
 
 
@@ -2213,7 +2338,7 @@ dxf_mesh_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->plot_style_name = strdup (plot_style_name);
+        mesh->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2248,7 +2373,7 @@ dxf_mesh_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->color_value);
+        return (mesh->common.color_value);
 }
 
 
@@ -2278,7 +2403,7 @@ dxf_mesh_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->color_value = color_value;
+        mesh->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2310,7 +2435,7 @@ dxf_mesh_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->color_name ==  NULL)
+        if (mesh->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2320,7 +2445,7 @@ dxf_mesh_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mesh->color_name));
+        return (strdup (mesh->common.cold->color_name));
 }
 
 
@@ -2358,7 +2483,7 @@ dxf_mesh_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->color_name = strdup (color_name);
+        mesh->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2393,7 +2518,7 @@ dxf_mesh_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh->transparency);
+        return (mesh->common.cold->transparency);
 }
 
 
@@ -2423,7 +2548,7 @@ dxf_mesh_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->transparency = transparency;
+        mesh->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3667,7 +3792,7 @@ dxf_mesh_set_edge_crease_count_level_0
  *
  * \return \c edge_create_value.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_mesh_get_edge_create_value
 (
         DxfMesh *mesh
@@ -3689,7 +3814,7 @@ dxf_mesh_get_edge_create_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) mesh->edge_create_value);
+        return ((DxfDoubleArray *) mesh->edge_create_value);
 }
 
 
@@ -3704,7 +3829,7 @@ dxf_mesh_set_edge_create_value
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        DxfDouble *edge_create_value
+        DxfDoubleArray *edge_create_value
                 /*!< the \c edge_create_value of a DXF \c MESH entity. */
 )
 {
@@ -3854,4 +3979,165 @@ dxf_mesh_get_last
 }
 
 
+/*!
+ * \brief Store the vertices of a DXF \c MESH entity in single
+ * precision.
+ *
+ * The vertices are stored in \c offsets as \c float offsets from the
+ * origin (\c origin_x, \c origin_y, \c origin_z), the list of
+ * \c DxfPoint vertices in \c p0 is freed.\n
+ * Choose an origin near the mesh to keep the precision of the
+ * offsets.
+ *
+ * \return a pointer to \c mesh when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfMesh *
+dxf_mesh_set_single_precision
+(
+        DxfMesh *mesh,
+                /*!< a pointer to a DXF \c MESH entity. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *offsets = NULL;
+        DxfPoint **points = NULL;
+        DxfPoint *iter;
+        int number_of_points;
+        int i;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (mesh->offsets != NULL)
+        {
+                /* Convert to the new origin by way of double precision. */
+                if (dxf_mesh_set_double_precision (mesh) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        number_of_points = 0;
+        for (iter = mesh->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                number_of_points++;
+        }
+        if (number_of_points > 0)
+        {
+                points = malloc (number_of_points * sizeof (DxfPoint *));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                i = 0;
+                for (iter = mesh->p0; iter != NULL; iter = (DxfPoint *) iter->next)
+                {
+                        points[i++] = iter;
+                }
+                offsets = dxf_point_offsets_new_from_points (points, number_of_points, origin_x, origin_y, origin_z);
+                free (points);
+        }
+        else
+        {
+                offsets = dxf_point_offsets_new (0, origin_x, origin_y, origin_z);
+        }
+        if (offsets == NULL)
+        {
+                return (NULL);
+        }
+        if (mesh->p0 != NULL)
+        {
+                dxf_point_free_list (mesh->p0);
+        }
+        mesh->p0 = NULL;
+        mesh->offsets = offsets;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh);
+}
+
+
+/*!
+ * \brief Store the vertices of a DXF \c MESH entity in double
+ * precision (the default).
+ *
+ * A new list of \c DxfPoint vertices is allocated from \c offsets,
+ * which is freed.
+ *
+ * \return a pointer to \c mesh when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfMesh *
+dxf_mesh_set_double_precision
+(
+        DxfMesh *mesh
+                /*!< a pointer to a DXF \c MESH entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint **points = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (mesh->offsets == NULL)
+        {
+                return (mesh);
+        }
+        if (mesh->offsets->number_of_points > 0)
+        {
+                points = malloc (mesh->offsets->number_of_points * sizeof (DxfPoint *));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                if (dxf_point_offsets_to_points (mesh->offsets, points) == EXIT_FAILURE)
+                {
+                        free (points);
+                        return (NULL);
+                }
+                for (i = 1; i < mesh->offsets->number_of_points; i++)
+                {
+                        points[i - 1]->next = (struct DxfPoint *) points[i];
+                }
+                mesh->p0 = points[0];
+        }
+        free (points);
+        dxf_point_offsets_free (mesh->offsets);
+        mesh->offsets = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh);
+}
+
+
 /* EOF*/
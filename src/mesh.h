@@ -39,6 +39,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "binary_graphics_data.h"
 #include "point.h"
 #include "util.h"
@@ -56,137 +59,18 @@ typedef struct
 dxf_mesh_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF mesh. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfPoint *p0;
-                /*!< Vertex position.\n
+                /*!< Vertex position, a single linked list of all
+                 * vertices.\n
                  * Group codes = 10, 20 and 30.*/
+        DxfPointOffsets *offsets;
+                /*!< Vertex positions as single precision offsets,
+                 * \c NULL unless the mesh is in single precision mode,
+                 * see dxf_mesh_set_single_precision ().\n
+                 * \c p0 is \c NULL in single precision mode. */
         int16_t version;
                 /*!< Version number.\n
                  * Group code = 71. */
@@ -242,8 +126,8 @@ dxf_mesh_struct
         int32_t edge_crease_count_level_0;
                 /*!< Edge crease count of level 0.\n
                  * Group code = 95. */
-        DxfDouble *edge_create_value;
-                /*!< Edge create value.\n
+        DxfDoubleArray *edge_create_value;
+                /*!< Edge create values.\n
                  * Group code = 140. */
         struct DxfMesh *next;
                 /*!< Pointer to the next DxfMesh.\n
@@ -257,8 +141,9 @@ DxfMesh *dxf_mesh_read (DxfFile *fp, DxfMesh *mesh);
 int dxf_mesh_write (DxfFile *fp, DxfMesh *mesh);
 int dxf_mesh_free (DxfMesh *mesh);
 void dxf_mesh_free_list (DxfMesh *meshes);
-int dxf_mesh_get_id_code (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_id_code (DxfMesh *mesh, int id_code);
+DxfMesh *dxf_mesh_copy (DxfMesh *mesh);
+DxfHandle dxf_mesh_get_id_code (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_id_code (DxfMesh *mesh, DxfHandle id_code);
 char *dxf_mesh_get_linetype (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_linetype (DxfMesh *mesh, char *linetype);
 char *dxf_mesh_get_layer (DxfMesh *mesh);
@@ -279,8 +164,8 @@ int dxf_mesh_get_graphics_data_size (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_graphics_data_size (DxfMesh *mesh, int graphics_data_size);
 int16_t dxf_mesh_get_shadow_mode (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_shadow_mode (DxfMesh *mesh, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_mesh_get_binary_graphics_data (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_binary_graphics_data (DxfMesh *mesh, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_mesh_get_binary_graphics_data (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_binary_graphics_data (DxfMesh *mesh, DxfBinaryBuffer *data);
 char *dxf_mesh_get_dictionary_owner_soft (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_dictionary_owner_soft (DxfMesh *mesh, char *dictionary_owner_soft);
 char *dxf_mesh_get_object_owner_soft (DxfMesh *mesh);
@@ -333,11 +218,15 @@ int32_t dxf_mesh_get_edge_count_level_0 (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_edge_count_level_0 (DxfMesh *mesh, int32_t edge_count_level_0);
 int32_t dxf_mesh_get_edge_crease_count_level_0 (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_edge_crease_count_level_0 (DxfMesh *mesh, int32_t edge_crease_count_level_0);
-DxfDouble *dxf_mesh_get_edge_create_value (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_edge_create_value (DxfMesh *mesh, DxfDouble *edge_create_value);
+DxfDoubleArray *dxf_mesh_get_edge_create_value (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_edge_create_value (DxfMesh *mesh, DxfDoubleArray *edge_create_value);
 DxfMesh *dxf_mesh_get_next (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_next (DxfMesh *mesh, DxfMesh *next);
 DxfMesh *dxf_mesh_get_last (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_single_precision (DxfMesh *mesh, double origin_x, double origin_y, double origin_z);
+DxfMesh *dxf_mesh_set_double_precision (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_single_precision (DxfMesh *mesh, double origin_x, double origin_y, double origin_z);
+DxfMesh *dxf_mesh_set_double_precision (DxfMesh *mesh);
 
 
 #ifdef __cplusplus
@@ -107,28 +107,13 @@ dxf_mleader_init
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->id_code = 0;
-        mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        mleader->layer = strdup (DXF_DEFAULT_LAYER);
-        mleader->elevation = 0.0;
-        mleader->thickness = 0.0;
-        mleader->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        mleader->visibility = DXF_DEFAULT_VISIBILITY;
-        mleader->color = DXF_COLOR_BYLAYER;
-        mleader->paperspace = DXF_MODELSPACE;
-        mleader->graphics_data_size = 0;
-        mleader->shadow_mode = 0;
-        mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleader->binary_graphics_data);
-        mleader->dictionary_owner_soft = strdup ("");
-        mleader->object_owner_soft = strdup ("");
-        mleader->material = strdup ("");
-        mleader->dictionary_owner_hard = strdup ("");
-        mleader->lineweight = 0;
-        mleader->plot_style_name = strdup ("");
-        mleader->color_value = 0;
-        mleader->color_name = strdup ("");
-        mleader->transparency = 0;
+        if (dxf_entity_common_init (&mleader->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         mleader->block_content_scale = 0.0;
         mleader->dogleg_length = 0.0;
         mleader->arrowhead_size = 0.0;
@@ -159,12 +144,12 @@ dxf_mleader_init
         mleader->enable_annotation_scale = 0;
         mleader->text_direction_negative = 0;
         mleader->block_attribute_text_string = strdup ("");
-        mleader->block_attribute_id = strdup ("");
-        mleader->leader_style_id = strdup ("");
-        mleader->arrowhead_id = strdup ("");
-        mleader->text_style_id = strdup ("");
-        mleader->block_content_id = strdup ("");
-        mleader->arrow_head_id = strdup ("");
+        mleader->block_attribute_id = DXF_HANDLE_NONE;
+        mleader->leader_style_id = DXF_HANDLE_NONE;
+        mleader->arrowhead_id = DXF_HANDLE_NONE;
+        mleader->text_style_id = DXF_HANDLE_NONE;
+        mleader->block_content_id = DXF_HANDLE_NONE;
+        mleader->arrow_head_id = DXF_HANDLE_NONE;
         mleader->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -197,7 +182,6 @@ dxf_mleader_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
         int iter92;
         int iter330;
 
@@ -218,7 +202,6 @@ dxf_mleader_read
                   __FUNCTION__);
                 mleader = dxf_mleader_init (mleader);
         }
-        iter310 = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
         iter92 = 0;
         iter330 = 0;
         (fp->line_number)++;
@@ -239,21 +222,20 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &mleader->id_code);
+                        mleader->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->common.linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->common.layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -268,14 +250,14 @@ dxf_mleader_read
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->elevation);
+                        fscanf (fp->fp, "%lf\n", &mleader->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->thickness);
+                        fscanf (fp->fp, "%lf\n", &mleader->common.thickness);
                 }
                 else if (strcmp (temp_string, "41") == 0)
                 {
@@ -310,28 +292,28 @@ dxf_mleader_read
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mleader->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &mleader->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->visibility);
+                        fscanf (fp->fp, "%hd\n", &mleader->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->color);
+                        fscanf (fp->fp, "%hd\n", &mleader->common.color);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->paperspace);
+                        fscanf (fp->fp, "%hd\n", &mleader->common.paperspace);
                 }
                 else if (strcmp (temp_string, "90") == 0)
                 {
@@ -354,7 +336,7 @@ dxf_mleader_read
                                 /* Now follows a string containing the
                                  * graphics data size value. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, "%d\n", &mleader->graphics_data_size);
+                                fscanf (fp->fp, "%" PRIi32 "\n", &mleader->common.cold->graphics_data_size);
                         }
                         if (iter92 == 1)
                         {
@@ -391,7 +373,7 @@ dxf_mleader_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mleader->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &mleader->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "170") == 0)
                 {
@@ -489,7 +471,7 @@ dxf_mleader_read
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &mleader->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "290") == 0)
                 {
@@ -537,10 +519,11 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        if (mleader->common.cold->binary_graphics_data == NULL)
+                        {
+                                mleader->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, mleader->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -548,22 +531,19 @@ dxf_mleader_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->dictionary_owner_soft);
+                                mleader->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->object_owner_soft);
+                                mleader->common.cold->object_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 2)
                         {
                                 /* Now follows a string containing a
                                  * Block attribute ID. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_attribute_id);
+                                mleader->block_attribute_id = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -571,91 +551,82 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a
                          * Leader style ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->leader_style_id);
+                        mleader->leader_style_id = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "341") == 0)
                 {
                         /* Now follows a string containing a
                          * Leader linetype ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->leader_linetype_id);
+                        mleader->leader_linetype_id = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "342") == 0)
                 {
                         /* Now follows a string containing a
                          * Arrowhead ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->arrowhead_id);
+                        mleader->arrowhead_id = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "343") == 0)
                 {
                         /* Now follows a string containing a
                          * Text style ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->text_style_id);
+                        mleader->text_style_id = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "344") == 0)
                 {
                         /* Now follows a string containing a
                          * Block content ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_content_id);
+                        mleader->block_content_id = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "345") == 0)
                 {
                         /* Now follows a string containing a
                          * Arrow head ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->arrow_head_id);
+                        mleader->arrow_head_id = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->material);
+                        mleader->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->dictionary_owner_hard);
+                        mleader->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mleader->lineweight);
+                        fscanf (fp->fp, "%hd\n", &mleader->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->plot_style_name);
+                        mleader->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mleader->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &mleader->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mleader->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &mleader->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -672,13 +643,13 @@ dxf_mleader_read
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (mleader->linetype, "") == 0)
+        if (strcmp (mleader->common.linetype, "") == 0)
         {
-                mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleader->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (mleader->layer, "") == 0)
+        if (strcmp (mleader->common.layer, "") == 0)
         {
-                mleader->layer = strdup (DXF_DEFAULT_LAYER);
+                mleader->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -728,31 +699,31 @@ dxf_mleader_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if ((strcmp (mleader->layer, "") == 0) || (mleader->layer == NULL))
+        if ((strcmp (mleader->common.layer, "") == 0) || (mleader->common.layer == NULL))
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, mleader->id_code);
+                  (_("Warning in %s () invalid layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, mleader->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                mleader->layer = strdup (DXF_DEFAULT_LAYER);
+                mleader->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (mleader->linetype == NULL)
+        if (mleader->common.linetype == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, mleader->id_code);
+                  (_("Warning in %s () invalid linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, mleader->common.id_code);
                 fprintf (stderr,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                mleader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mleader->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (mleader->id_code != -1)
+        if (mleader->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", mleader->id_code);
+                dxf_handle_write (fp, 5, mleader->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -764,99 +735,94 @@ dxf_mleader_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mleader->dictionary_owner_soft, "") != 0)
+        if ((mleader->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", mleader->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, mleader->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (mleader->dictionary_owner_hard, "") != 0)
+        if ((mleader->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", mleader->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, mleader->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (mleader->object_owner_soft, "") != 0)
+        if ((mleader->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", mleader->object_owner_soft);
+                dxf_handle_write (fp, 330, mleader->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (mleader->paperspace == DXF_PAPERSPACE)
+        if (mleader->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mleader->layer);
-        if (strcmp (mleader->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", mleader->common.layer);
+        if (strcmp (mleader->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mleader->linetype);
+                fprintf (fp->fp, "  6\n%s\n", mleader->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (mleader->material, "") != 0))
+          && (mleader->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", mleader->material);
+                dxf_handle_write (fp, 347, mleader->common.cold->material);
         }
-        if (mleader->color != DXF_COLOR_BYLAYER)
+        if (mleader->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", mleader->color);
+                fprintf (fp->fp, " 62\n%hd\n", mleader->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", mleader->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", mleader->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (mleader->elevation != 0.0))
+          && (mleader->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", mleader->elevation);
+                fprintf (fp->fp, " 38\n%f\n", mleader->common.elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
-          && (mleader->thickness != 0.0))
+          && (mleader->common.thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", mleader->thickness);
+                fprintf (fp->fp, " 39\n%f\n", mleader->common.thickness);
         }
-        if (mleader->linetype_scale != 1.0)
+        if (mleader->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", mleader->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", mleader->common.linetype_scale);
         }
-        if (mleader->visibility != 0)
+        if (mleader->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", mleader->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", mleader->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", mleader->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", mleader->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", mleader->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", mleader->common.cold->graphics_data_size);
 #endif
-                if (mleader->binary_graphics_data != NULL)
+                if (mleader->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, mleader->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", mleader->color_value);
-                fprintf (fp->fp, "430\n%s\n", mleader->color_name);
-                fprintf (fp->fp, "440\n%ld\n", mleader->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", mleader->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", mleader->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", mleader->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", mleader->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", mleader->shadow_mode);
+                dxf_handle_write (fp, 390, mleader->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", mleader->common.cold->shadow_mode);
         }
+        dxf_entity_common_write_xdata (fp, &mleader->common);
         /* Clean up. */
         free (dxf_entity_name);
 #ifdef DEBUG
@@ -899,23 +865,8 @@ dxf_mleader_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mleader->linetype);
-        free (mleader->layer);
-        dxf_binary_graphics_data_free_list (mleader->binary_graphics_data);
-        free (mleader->dictionary_owner_soft);
-        free (mleader->object_owner_soft);
-        free (mleader->material);
-        free (mleader->dictionary_owner_hard);
-        free (mleader->plot_style_name);
-        free (mleader->color_name);
+        dxf_entity_common_free (&mleader->common);
         free (mleader->block_attribute_text_string);
-        free (mleader->block_attribute_id);
-        free (mleader->leader_style_id);
-        free (mleader->leader_linetype_id);
-        free (mleader->arrowhead_id);
-        free (mleader->text_style_id);
-        free (mleader->block_content_id);
-        free (mleader->arrow_head_id);
         free (mleader);
         mleader = NULL;
 #if DEBUG
@@ -949,6 +900,7 @@ dxf_mleader_free_list
         while (mleaders != NULL)
         {
                 DxfMLeader *iter = (DxfMLeader *) mleaders->next;
+                mleaders->next = NULL;
                 dxf_mleader_free (mleaders);
                 mleaders = (DxfMLeader *) iter;
         }
@@ -963,7 +915,7 @@ dxf_mleader_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_mleader_get_id_code
 (
         DxfMLeader *mleader
@@ -981,16 +933,10 @@ dxf_mleader_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->id_code);
+        return (mleader->common.id_code);
 }
 
 
@@ -1005,7 +951,7 @@ dxf_mleader_set_id_code
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -1022,13 +968,7 @@ dxf_mleader_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        mleader->id_code = id_code;
+        mleader->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1059,7 +999,7 @@ dxf_mleader_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->linetype ==  NULL)
+        if (mleader->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1069,7 +1009,7 @@ dxf_mleader_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->linetype));
+        return (strdup (mleader->common.linetype));
 }
 
 
@@ -1107,7 +1047,7 @@ dxf_mleader_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->linetype = strdup (linetype);
+        mleader->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1138,7 +1078,7 @@ dxf_mleader_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->layer ==  NULL)
+        if (mleader->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1148,7 +1088,7 @@ dxf_mleader_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->layer));
+        return (strdup (mleader->common.layer));
 }
 
 
@@ -1186,7 +1126,7 @@ dxf_mleader_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->layer = strdup (layer);
+        mleader->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1220,7 +1160,7 @@ dxf_mleader_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->elevation);
+        return (mleader->common.elevation);
 }
 
 
@@ -1250,7 +1190,7 @@ dxf_mleader_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->elevation = elevation;
+        mleader->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1281,7 +1221,7 @@ dxf_mleader_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->thickness < 0.0)
+        if (mleader->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1291,7 +1231,7 @@ dxf_mleader_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->thickness);
+        return (mleader->common.thickness);
 }
 
 
@@ -1327,7 +1267,7 @@ dxf_mleader_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->thickness = thickness;
+        mleader->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1358,7 +1298,7 @@ dxf_mleader_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->linetype_scale < 0.0)
+        if (mleader->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1367,7 +1307,7 @@ dxf_mleader_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->linetype_scale);
+        return (mleader->common.linetype_scale);
 }
 
 
@@ -1403,7 +1343,7 @@ dxf_mleader_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->linetype_scale = linetype_scale;
+        mleader->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1434,13 +1374,13 @@ dxf_mleader_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->visibility < 0)
+        if (mleader->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mleader->visibility > 1)
+        if (mleader->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1449,7 +1389,7 @@ dxf_mleader_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->visibility);
+        return (mleader->common.visibility);
 }
 
 
@@ -1491,7 +1431,7 @@ dxf_mleader_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->visibility = visibility;
+        mleader->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1522,7 +1462,7 @@ dxf_mleader_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->color < 0)
+        if (mleader->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1531,7 +1471,7 @@ dxf_mleader_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->color);
+        return (mleader->common.color);
 }
 
 
@@ -1567,7 +1507,7 @@ dxf_mleader_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->color = color;
+        mleader->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1598,13 +1538,13 @@ dxf_mleader_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->paperspace < 0)
+        if (mleader->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mleader->paperspace > 1)
+        if (mleader->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1613,7 +1553,7 @@ dxf_mleader_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->paperspace);
+        return (mleader->common.paperspace);
 }
 
 
@@ -1656,7 +1596,7 @@ dxf_mleader_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->paperspace = paperspace;
+        mleader->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1689,13 +1629,13 @@ dxf_mleader_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->graphics_data_size < 0)
+        if (mleader->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mleader->graphics_data_size == 0)
+        if (mleader->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1704,7 +1644,7 @@ dxf_mleader_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->graphics_data_size);
+        return (mleader->common.cold->graphics_data_size);
 }
 
 
@@ -1748,7 +1688,7 @@ dxf_mleader_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->graphics_data_size = graphics_data_size;
+        mleader->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1780,13 +1720,13 @@ dxf_mleader_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleader->shadow_mode < 0)
+        if (mleader->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mleader->shadow_mode > 3)
+        if (mleader->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1795,7 +1735,7 @@ dxf_mleader_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->shadow_mode);
+        return (mleader->common.cold->shadow_mode);
 }
 
 
@@ -1837,7 +1777,7 @@ dxf_mleader_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        mleader->shadow_mode = shadow_mode;
+        mleader->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1849,11 +1789,12 @@ dxf_mleader_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c MLEADER entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_mleader_get_binary_graphics_data
 (
         DxfMLeader *mleader
@@ -1871,17 +1812,10 @@ dxf_mleader_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) mleader->binary_graphics_data);
+        return (mleader->common.cold->binary_graphics_data);
 }
 
 
@@ -1889,17 +1823,20 @@ dxf_mleader_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c MLEADER entity.
  *
- * \return a pointer to \c mleader when successful, or \c NULL when an error
- * occurred.
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c mleader when successful, or \c NULL when an
+ * error occurred.
  */
 DxfMLeader *
 dxf_mleader_set_binary_graphics_data
 (
         DxfMLeader *mleader,
                 /*!< a pointer to a DXF \c MLEADER entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1920,7 +1857,12 @@ dxf_mleader_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((mleader->common.cold->binary_graphics_data != NULL)
+          && (mleader->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (mleader->common.cold->binary_graphics_data);
+        }
+        mleader->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1954,17 +1896,10 @@ dxf_mleader_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->dictionary_owner_soft));
+        return (dxf_handle_to_string (mleader->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2003,7 +1938,7 @@ dxf_mleader_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mleader->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2037,17 +1972,10 @@ dxf_mleader_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->object_owner_soft));
+        return (dxf_handle_to_string (mleader->common.cold->object_owner_soft));
 }
 
 
@@ -2086,7 +2014,7 @@ dxf_mleader_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->object_owner_soft = strdup (object_owner_soft);
+        mleader->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2121,17 +2049,10 @@ dxf_mleader_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->material));
+        return (dxf_handle_to_string (mleader->common.cold->material));
 }
 
 
@@ -2169,7 +2090,7 @@ dxf_mleader_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->material = strdup (material);
+        mleader->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2203,17 +2124,10 @@ dxf_mleader_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->dictionary_owner_hard));
+        return (dxf_handle_to_string (mleader->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2252,7 +2166,7 @@ dxf_mleader_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mleader->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2287,7 +2201,7 @@ dxf_mleader_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->lineweight);
+        return (mleader->common.lineweight);
 }
 
 
@@ -2317,7 +2231,7 @@ dxf_mleader_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->lineweight = lineweight;
+        mleader->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2349,17 +2263,10 @@ dxf_mleader_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->plot_style_name));
+        return (dxf_handle_to_string (mleader->common.cold->plot_style_name));
 }
 
 
@@ -2397,7 +2304,7 @@ dxf_mleader_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->plot_style_name = strdup (plot_style_name);
+        mleader->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2432,7 +2339,7 @@ dxf_mleader_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->color_value);
+        return (mleader->common.color_value);
 }
 
 
@@ -2462,7 +2369,7 @@ dxf_mleader_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->color_value = color_value;
+        mleader->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2494,7 +2401,7 @@ dxf_mleader_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->color_name ==  NULL)
+        if (mleader->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2504,7 +2411,7 @@ dxf_mleader_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->color_name));
+        return (strdup (mleader->common.cold->color_name));
 }
 
 
@@ -2542,7 +2449,7 @@ dxf_mleader_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->color_name = strdup (color_name);
+        mleader->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2577,7 +2484,7 @@ dxf_mleader_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mleader->transparency);
+        return (mleader->common.cold->transparency);
 }
 
 
@@ -2607,7 +2514,7 @@ dxf_mleader_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->transparency = transparency;
+        mleader->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4771,17 +4678,10 @@ dxf_mleader_get_block_attribute_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->block_attribute_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_attribute_id));
+        return (dxf_handle_to_string (mleader->block_attribute_id));
 }
 
 
@@ -4819,7 +4719,7 @@ dxf_mleader_set_block_attribute_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_attribute_id = strdup (block_attribute_id);
+        mleader->block_attribute_id = dxf_handle_parse (block_attribute_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4851,17 +4751,10 @@ dxf_mleader_get_leader_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->leader_style_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->leader_style_id));
+        return (dxf_handle_to_string (mleader->leader_style_id));
 }
 
 
@@ -4899,7 +4792,7 @@ dxf_mleader_set_leader_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->leader_style_id = strdup (leader_style_id);
+        mleader->leader_style_id = dxf_handle_parse (leader_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4931,17 +4824,10 @@ dxf_mleader_get_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->leader_linetype_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->leader_linetype_id));
+        return (dxf_handle_to_string (mleader->leader_linetype_id));
 }
 
 
@@ -4979,7 +4865,7 @@ dxf_mleader_set_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->leader_linetype_id = strdup (leader_linetype_id);
+        mleader->leader_linetype_id = dxf_handle_parse (leader_linetype_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5011,17 +4897,10 @@ dxf_mleader_get_arrowhead_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->arrowhead_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->arrowhead_id));
+        return (dxf_handle_to_string (mleader->arrowhead_id));
 }
 
 
@@ -5059,7 +4938,7 @@ dxf_mleader_set_arrowhead_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->arrowhead_id = strdup (arrowhead_id);
+        mleader->arrowhead_id = dxf_handle_parse (arrowhead_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5091,17 +4970,10 @@ dxf_mleader_get_text_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->text_style_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->text_style_id));
+        return (dxf_handle_to_string (mleader->text_style_id));
 }
 
 
@@ -5139,7 +5011,7 @@ dxf_mleader_set_text_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->text_style_id = strdup (text_style_id);
+        mleader->text_style_id = dxf_handle_parse (text_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5171,17 +5043,10 @@ dxf_mleader_get_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->block_content_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->block_content_id));
+        return (dxf_handle_to_string (mleader->block_content_id));
 }
 
 
@@ -5219,7 +5084,7 @@ dxf_mleader_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->block_content_id = strdup (block_content_id);
+        mleader->block_content_id = dxf_handle_parse (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5251,17 +5116,10 @@ dxf_mleader_get_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleader->arrow_head_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleader->arrow_head_id));
+        return (dxf_handle_to_string (mleader->arrow_head_id));
 }
 
 
@@ -5299,7 +5157,7 @@ dxf_mleader_set_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleader->arrow_head_id = strdup (arrow_head_id);
+        mleader->arrow_head_id = dxf_handle_parse (arrow_head_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5556,8 +5414,8 @@ dxf_mleader_context_data_init
         data->has_block = 0;
         data->MLeader_plane_normal_reversed = 0;
         data->default_text_contents = strdup ("");
-        data->type_style_id = strdup ("");
-        data->block_content_id = strdup ("");
+        data->type_style_id = DXF_HANDLE_NONE;
+        data->block_content_id = DXF_HANDLE_NONE;
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5608,8 +5466,6 @@ dxf_mleader_context_data_free
         dxf_point_free_list (data->p4);
         dxf_point_free_list (data->p5);
         free (data->default_text_contents);
-        free (data->type_style_id);
-        free (data->block_content_id);
         free (data);
         data = NULL;
 #if DEBUG
@@ -5644,6 +5500,7 @@ dxf_mleader_context_data_free_list
         while (datas != NULL)
         {
                 DxfMLeaderContextData *iter = (DxfMLeaderContextData *) datas->next;
+                datas->next = NULL;
                 dxf_mleader_context_data_free (datas);
                 datas = (DxfMLeaderContextData *) iter;
         }
@@ -10371,7 +10228,7 @@ dxf_mleader_context_data_get_type_style_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (data->type_style_id);
+        return (dxf_handle_to_string (data->type_style_id));
 }
 
 
@@ -10402,7 +10259,7 @@ dxf_mleader_context_data_set_type_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        data->type_style_id = type_style_id;
+        data->type_style_id = dxf_handle_parse (type_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10437,7 +10294,7 @@ dxf_mleader_context_data_get_block_content_id
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (data->block_content_id);
+        return (dxf_handle_to_string (data->block_content_id));
 }
 
 
@@ -10468,7 +10325,7 @@ dxf_mleader_context_data_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        data->block_content_id = block_content_id;
+        data->block_content_id = dxf_handle_parse (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10768,6 +10625,7 @@ dxf_mleader_leader_node_free_list
         while (nodes != NULL)
         {
                 DxfMLeaderLeaderNode *iter = (DxfMLeaderLeaderNode *) nodes->next;
+                nodes->next = NULL;
                 dxf_mleader_leader_node_free (nodes);
                 nodes = (DxfMLeaderLeaderNode *) iter;
         }
@@ -12652,6 +12510,7 @@ dxf_mleader_leader_line_free_list
         while (lines != NULL)
         {
                 DxfMLeaderLeaderLine *iter = (DxfMLeaderLeaderLine *) lines->next;
+                lines->next = NULL;
                 dxf_mleader_leader_line_free (lines);
                 lines = (DxfMLeaderLeaderLine *) iter;
         }
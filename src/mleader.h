@@ -39,6 +39,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "binary_graphics_data.h"
 #include "point.h"
 
@@ -55,134 +58,9 @@ typedef struct
 dxf_mleader_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF MLeader. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         double block_content_scale;
                 /*!< Block content scale.\n
                  * Group code = 10. */
@@ -285,29 +163,29 @@ dxf_mleader_struct
         char *block_attribute_text_string;
                 /*!< Block attribute text string.\n
                  * Group code = 302. */
-        char *block_attribute_id;
+        DxfHandle block_attribute_id;
                 /*!< Block attribute ID (string representing hex object
                  * IDs).\n
                  * Group code = 330. */
-        char *leader_style_id;
+        DxfHandle leader_style_id;
                 /*!< Leader style ID (string representing hex object
                  * IDs).\n
                  * Group code = 340. */
-        char *leader_linetype_id;
+        DxfHandle leader_linetype_id;
                 /*!< Leader linetype ID (string representing hex object
                  * IDs).\n
                  * Group code = 341. */
-        char *arrowhead_id;
+        DxfHandle arrowhead_id;
                 /*!< Arrowhead ID (string representing hex object IDs).\n
                  * Group code = 342. */
-        char *text_style_id;
+        DxfHandle text_style_id;
                 /*!< Text style ID (string representing hex object IDs).\n
                  * Group code = 343. */
-        char *block_content_id;
+        DxfHandle block_content_id;
                 /*!< Block content ID (string representing hex object
                  * IDs).\n
                  * Group code = 344. */
-        char *arrow_head_id;
+        DxfHandle arrow_head_id;
                 /*!< Arrowhead ID (string representing hex object
                  * IDs).\n
                  * Another Arrowhead ID ?.\n
@@ -453,11 +331,11 @@ dxf_mleader_context_data_struct
         char *default_text_contents;
                 /*!< Default text contents.\n
                  * Group code = 304. */
-        char *type_style_id;
+        DxfHandle type_style_id;
                 /*!< Type style ID (string representing hex object
                  * IDs).\n
                  * Group code = 340. */
-        char *block_content_id;
+        DxfHandle block_content_id;
                 /*!< Block content ID (string representing hex object
                  * IDs).\n
                  * Group code = 341. */
@@ -536,8 +414,8 @@ DxfMLeader *dxf_mleader_read (DxfFile *fp, DxfMLeader *mleader);
 int dxf_mleader_write (DxfFile *fp, DxfMLeader *mleader);
 int dxf_mleader_free (DxfMLeader *mleader);
 void dxf_mleader_free_list (DxfMLeader *mleaders);
-int dxf_mleader_get_id_code (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_id_code (DxfMLeader *mleader, int id_code);
+DxfHandle dxf_mleader_get_id_code (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_id_code (DxfMLeader *mleader, DxfHandle id_code);
 char *dxf_mleader_get_linetype (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_linetype (DxfMLeader *mleader, char *linetype);
 char *dxf_mleader_get_layer (DxfMLeader *mleader);
@@ -558,8 +436,8 @@ int dxf_mleader_get_graphics_data_size (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_graphics_data_size (DxfMLeader *mleader, int graphics_data_size);
 int16_t dxf_mleader_get_shadow_mode (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_shadow_mode (DxfMLeader *mleader, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_mleader_get_binary_graphics_data (DxfMLeader *mleader);
-DxfMLeader *dxf_mleader_set_binary_graphics_data (DxfMLeader *mleader, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_mleader_get_binary_graphics_data (DxfMLeader *mleader);
+DxfMLeader *dxf_mleader_set_binary_graphics_data (DxfMLeader *mleader, DxfBinaryBuffer *data);
 char *dxf_mleader_get_dictionary_owner_soft (DxfMLeader *mleader);
 DxfMLeader *dxf_mleader_set_dictionary_owner_soft (DxfMLeader *mleader, char *dictionary_owner_soft);
 char *dxf_mleader_get_object_owner_soft (DxfMLeader *mleader);
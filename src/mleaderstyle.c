@@ -120,12 +120,12 @@ dxf_mleaderstyle_init
         mleaderstyle->shadow_mode = 0;
         mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
         mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleaderstyle->binary_graphics_data);
-        mleaderstyle->dictionary_owner_soft = strdup ("");
-        mleaderstyle->object_owner_soft = strdup ("");
-        mleaderstyle->material = strdup ("");
-        mleaderstyle->dictionary_owner_hard = strdup ("");
+        mleaderstyle->dictionary_owner_soft = DXF_HANDLE_NONE;
+        mleaderstyle->object_owner_soft = DXF_HANDLE_NONE;
+        mleaderstyle->material = DXF_HANDLE_NONE;
+        mleaderstyle->dictionary_owner_hard = DXF_HANDLE_NONE;
         mleaderstyle->lineweight = 0;
-        mleaderstyle->plot_style_name = strdup ("");
+        mleaderstyle->plot_style_name = DXF_HANDLE_NONE;
         mleaderstyle->color_value = 0;
         mleaderstyle->color_name = strdup ("");
         mleaderstyle->transparency = 0;
@@ -167,10 +167,10 @@ dxf_mleaderstyle_init
         mleaderstyle->is_annotative = 1;
         mleaderstyle->text_align_always_left = 1;
         mleaderstyle->default_mtext_contents = strdup ("");
-        mleaderstyle->leader_linetype_id = strdup ("");
-        mleaderstyle->arrow_head_id = strdup ("");
-        mleaderstyle->mtext_style_id = strdup ("");
-        mleaderstyle->block_content_id = strdup ("");
+        mleaderstyle->leader_linetype_id = DXF_HANDLE_NONE;
+        mleaderstyle->arrow_head_id = DXF_HANDLE_NONE;
+        mleaderstyle->mtext_style_id = DXF_HANDLE_NONE;
+        mleaderstyle->block_content_id = DXF_HANDLE_NONE;
         mleaderstyle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -245,8 +245,7 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &mleaderstyle->id_code);
+                        mleaderstyle->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
@@ -347,15 +346,13 @@ dxf_mleaderstyle_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->dictionary_owner_soft);
+                                mleaderstyle->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->object_owner_soft);
+                                mleaderstyle->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -363,15 +360,13 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->material);
+                        mleaderstyle->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->dictionary_owner_hard);
+                        mleaderstyle->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -384,8 +379,7 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->plot_style_name);
+                        mleaderstyle->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -506,18 +500,9 @@ dxf_mleaderstyle_free
         free (mleaderstyle->linetype);
         free (mleaderstyle->layer);
         dxf_binary_graphics_data_free_list (mleaderstyle->binary_graphics_data);
-        free (mleaderstyle->dictionary_owner_soft);
-        free (mleaderstyle->object_owner_soft);
-        free (mleaderstyle->material);
-        free (mleaderstyle->dictionary_owner_hard);
-        free (mleaderstyle->plot_style_name);
         free (mleaderstyle->color_name);
         free (mleaderstyle->mleaderstyle_description);
         free (mleaderstyle->default_mtext_contents);
-        free (mleaderstyle->leader_linetype_id);
-        free (mleaderstyle->arrow_head_id);
-        free (mleaderstyle->mtext_style_id);
-        free (mleaderstyle->block_content_id);
         free (mleaderstyle);
         mleaderstyle = NULL;
 #if DEBUG
@@ -551,6 +536,7 @@ dxf_mleaderstyle_free_list
         while (mleaderstyles != NULL)
         {
                 DxfMLeaderstyle *iter = (DxfMLeaderstyle *) mleaderstyles->next;
+                mleaderstyles->next = NULL;
                 dxf_mleaderstyle_free (mleaderstyles);
                 mleaderstyles = (DxfMLeaderstyle *) iter;
         }
@@ -565,7 +551,7 @@ dxf_mleaderstyle_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_mleaderstyle_get_id_code
 (
         DxfMLeaderstyle *mleaderstyle
@@ -583,12 +569,6 @@ dxf_mleaderstyle_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mleaderstyle->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -607,7 +587,7 @@ dxf_mleaderstyle_set_id_code
 (
         DxfMLeaderstyle *mleaderstyle,
                 /*!< a pointer to a DXF \c MLEADERSTYLE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -624,12 +604,6 @@ dxf_mleaderstyle_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         mleaderstyle->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1557,17 +1531,10 @@ dxf_mleaderstyle_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->dictionary_owner_soft));
+        return (dxf_handle_to_string (mleaderstyle->dictionary_owner_soft));
 }
 
 
@@ -1606,7 +1573,7 @@ dxf_mleaderstyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mleaderstyle->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1640,17 +1607,10 @@ dxf_mleaderstyle_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->object_owner_soft));
+        return (dxf_handle_to_string (mleaderstyle->object_owner_soft));
 }
 
 
@@ -1689,7 +1649,7 @@ dxf_mleaderstyle_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->object_owner_soft = strdup (object_owner_soft);
+        mleaderstyle->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1724,17 +1684,10 @@ dxf_mleaderstyle_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->material));
+        return (dxf_handle_to_string (mleaderstyle->material));
 }
 
 
@@ -1773,7 +1726,7 @@ dxf_mleaderstyle_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->material = strdup (material);
+        mleaderstyle->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1807,17 +1760,10 @@ dxf_mleaderstyle_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->dictionary_owner_hard));
+        return (dxf_handle_to_string (mleaderstyle->dictionary_owner_hard));
 }
 
 
@@ -1856,7 +1802,7 @@ dxf_mleaderstyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mleaderstyle->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1953,17 +1899,10 @@ dxf_mleaderstyle_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->plot_style_name));
+        return (dxf_handle_to_string (mleaderstyle->plot_style_name));
 }
 
 
@@ -2001,7 +1940,7 @@ dxf_mleaderstyle_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->plot_style_name = strdup (plot_style_name);
+        mleaderstyle->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4838,17 +4777,10 @@ dxf_mleaderstyle_get_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->leader_linetype_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->leader_linetype_id));
+        return (dxf_handle_to_string (mleaderstyle->leader_linetype_id));
 }
 
 
@@ -4887,7 +4819,7 @@ dxf_mleaderstyle_set_leader_linetype_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->leader_linetype_id = strdup (leader_linetype_id);
+        mleaderstyle->leader_linetype_id = dxf_handle_parse (leader_linetype_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4920,17 +4852,10 @@ dxf_mleaderstyle_get_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->arrow_head_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->arrow_head_id));
+        return (dxf_handle_to_string (mleaderstyle->arrow_head_id));
 }
 
 
@@ -4969,7 +4894,7 @@ dxf_mleaderstyle_set_arrow_head_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->arrow_head_id = strdup (arrow_head_id);
+        mleaderstyle->arrow_head_id = dxf_handle_parse (arrow_head_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5002,17 +4927,10 @@ dxf_mleaderstyle_get_mtext_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->mtext_style_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->mtext_style_id));
+        return (dxf_handle_to_string (mleaderstyle->mtext_style_id));
 }
 
 
@@ -5051,7 +4969,7 @@ dxf_mleaderstyle_set_mtext_style_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->mtext_style_id = strdup (mtext_style_id);
+        mleaderstyle->mtext_style_id = dxf_handle_parse (mtext_style_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5084,17 +5002,10 @@ dxf_mleaderstyle_get_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mleaderstyle->block_content_id ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mleaderstyle->block_content_id));
+        return (dxf_handle_to_string (mleaderstyle->block_content_id));
 }
 
 
@@ -5133,7 +5044,7 @@ dxf_mleaderstyle_set_block_content_id
                   __FUNCTION__);
                 return (NULL);
         }
-        mleaderstyle->block_content_id = strdup (block_content_id);
+        mleaderstyle->block_content_id = dxf_handle_parse (block_content_id);
 #if DEBUG
         DXF_DEBUG_END
 #endif
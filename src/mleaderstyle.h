@@ -39,6 +39,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "binary_graphics_data.h"
 
 #ifdef __cplusplus
@@ -53,7 +54,7 @@ typedef struct
 dxf_mleaderstyle_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -126,20 +127,20 @@ dxf_mleaderstyle_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330.\n
                  * \since Introduced in version R14. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000. */
-        char *material;
+        DxfHandle material;
                 /*!< Hard-pointer ID/handle to material object (present if
                  * not BYLAYER).\n
                  * Group code = 347.\n
                  * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360.\n
                  * \since Introduced in version R14. */
@@ -148,7 +149,7 @@ dxf_mleaderstyle_struct
                  * Stored and moved around as a 16-bit integer.\n
                  * Group code = 370.\n
                  * \since Introduced in version R2002. */
-        char *plot_style_name;
+        DxfHandle plot_style_name;
                 /*!< Hard pointer ID / handle of PlotStyleName object.\n
                  * Group code = 390.\n
                  * \since Introduced in version R2009. */
@@ -310,19 +311,19 @@ dxf_mleaderstyle_struct
         char *default_mtext_contents;
                 /*!< Default MText Contents.\n
                  * Group code = 300. */
-        char *leader_linetype_id;
+        DxfHandle leader_linetype_id;
                 /*!< LeaderLineType ID (string representing hex object
                  * IDs).\n
                  * Group code = 340. */
-        char *arrow_head_id;
+        DxfHandle arrow_head_id;
                 /*!< Arrowhead ID (string representing hex object
                  * IDs).\n
                  * Group code = 341. */
-        char *mtext_style_id;
+        DxfHandle mtext_style_id;
                 /*!< mTextStyleId (string representing hex object
                  * IDs).\n
                  * Group code = 342. */
-        char *block_content_id;
+        DxfHandle block_content_id;
                 /*!< Block Content Id (string representing hex object
                  * IDs).\n
                  * Group code = 343. */
@@ -338,8 +339,8 @@ DxfMLeaderstyle *dxf_mleaderstyle_read (DxfFile *fp, DxfMLeaderstyle *mleadersty
 int dxf_mleaderstyle_write (DxfFile *fp, DxfMLeaderstyle *mleaderstyle);
 int dxf_mleaderstyle_free (DxfMLeaderstyle *mleaderstyle);
 void dxf_mleaderstyle_free_list (DxfMLeaderstyle *mleaderstyles);
-int dxf_mleaderstyle_get_id_code (DxfMLeaderstyle *mleaderstyle);
-DxfMLeaderstyle *dxf_mleaderstyle_set_id_code (DxfMLeaderstyle *mleaderstyle, int id_code);
+DxfHandle dxf_mleaderstyle_get_id_code (DxfMLeaderstyle *mleaderstyle);
+DxfMLeaderstyle *dxf_mleaderstyle_set_id_code (DxfMLeaderstyle *mleaderstyle, DxfHandle id_code);
 char *dxf_mleaderstyle_get_linetype (DxfMLeaderstyle *mleaderstyle);
 DxfMLeaderstyle *dxf_mleaderstyle_set_linetype (DxfMLeaderstyle *mleaderstyle, char *linetype);
 char *dxf_mleaderstyle_get_layer (DxfMLeaderstyle *mleaderstyle);
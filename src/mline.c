@@ -42,6 +42,7 @@
 
 
 #include "mline.h"
+#include "entities.h"
 
 
 /*!
@@ -115,28 +116,14 @@ dxf_mline_init
                 __FUNCTION__);
               return (NULL);
         }
-        dxf_mline_set_id_code (mline, 0);
-        dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
-        dxf_mline_set_elevation (mline, 0.0);
-        dxf_mline_set_thickness (mline, 0.0);
-        dxf_mline_set_linetype_scale (mline, DXF_DEFAULT_LINETYPE_SCALE);
-        dxf_mline_set_visibility (mline, DXF_DEFAULT_VISIBILITY);
-        dxf_mline_set_color (mline, DXF_COLOR_BYLAYER);
-        dxf_mline_set_paperspace (mline, DXF_MODELSPACE);
-        dxf_mline_set_graphics_data_size (mline, 0);
-        dxf_mline_set_shadow_mode (mline, 0);
-        dxf_mline_set_binary_graphics_data (mline, dxf_binary_graphics_data_new ());
-        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline));
-        dxf_mline_set_dictionary_owner_soft (mline, strdup (""));
-        dxf_mline_set_material (mline, strdup (""));
-        dxf_mline_set_dictionary_owner_hard (mline, strdup (""));
-        dxf_mline_set_lineweight (mline, 0);
-        dxf_mline_set_plot_style_name (mline, strdup (""));
-        dxf_mline_set_color_value (mline, 0);
-        dxf_mline_set_color_name (mline, strdup (""));
-        dxf_mline_set_transparency (mline, 0);
-        dxf_mline_set_style_name (mline, strdup (""));
+        if (dxf_entity_common_init (&mline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_mline_set_style_name (mline, "");
         dxf_mline_set_p0 (mline, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_mline_get_p0 (mline));
         dxf_mline_set_p1 (mline, dxf_point_new ());
@@ -159,8 +146,8 @@ dxf_mline_init
         dxf_mline_set_extr_x0 (mline, 0.0);
         dxf_mline_set_extr_y0 (mline, 0.0);
         dxf_mline_set_extr_z0 (mline, 1.0);
-        dxf_mline_set_mlinestyle_dictionary (mline, strdup (""));
-        dxf_mline_set_next (mline, NULL);
+        dxf_mline_set_mlinestyle_dictionary (mline, "");
+        mline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -191,15 +178,14 @@ dxf_mline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
-        int j;
-        int k;
-        int l;
-        int m;
-        DxfPoint *iter_p1;
-        DxfPoint *iter_p2;
-        DxfPoint *iter_p3;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfPoint *iter_p1 = NULL;
+        DxfPoint *iter_p2 = NULL;
+        DxfPoint *iter_p3 = NULL;
+        int l = 0;
+        int m = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -207,8 +193,6 @@ dxf_mline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mline == NULL)
@@ -216,376 +200,211 @@ dxf_mline_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                mline = dxf_mline_init (mline);
-        }
-        l = 0;
-        m = 0;
-        i = 0; /* Number of found vertices in linked list p1. */
-        iter_p1 = (DxfPoint *) mline->p1; /* Pointer to first vertex p1. */
-        j = 0; /* Number of found direction vectors in linked list p2. */
-        iter_p2 = (DxfPoint *) mline->p2; /* Pointer to first direction vector p2. */
-        k = 0;
-        iter_p3 = (DxfPoint *) mline->p3; /* Pointer to first direction vector p3. */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+                mline = dxf_mline_init (dxf_mline_new ());
+                if (mline == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a string of
-                         * up to 32 characters with the name of the
-                         * style used for this mline. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->style_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &mline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
+        }
+        for (;;)
+        {
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
-                        /* Now follows a string containing the
-                         * X value of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->p0->x0);
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-                else if (strcmp (temp_string, "20") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * Y value of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->p0->y0);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "30") == 0)
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
-                        /* Now follows a string containing the
-                         * Z value of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->p0->z0);
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-                else if ((strcmp (temp_string, "11") == 0)
-                  || (strcmp (temp_string, "21") == 0)
-                  || (strcmp (temp_string, "31") == 0))
+                (fp->line_number)++;
+                switch (group_code)
                 {
-                        if (strcmp (temp_string, "11") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                if (i > 0) /* Create a pointer for the next vertex. */
+                        case 2:
+                                free (mline->style_name);
+                                mline->style_name = strdup (value);
+                                break;
+                        case 10:
+                                mline->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                mline->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                mline->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                /* One vertex for each segment, the first one is stored in
+                                 * the point allocated by dxf_mline_init (). */
+                                if (iter_p1 == NULL)
+                                {
+                                        iter_p1 = mline->p1;
+                                }
+                                else
                                 {
-                                        dxf_point_init ((DxfPoint *) iter_p1->next);
+                                        iter_p1->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
                                         iter_p1 = (DxfPoint *) iter_p1->next;
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p1->x0);
-                        }
-                        else if (strcmp (temp_string, "21") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p1->y0);
-                        }
-                        else if (strcmp (temp_string, "31") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Vertex coordinates (one entry for each
-                                 * vertex). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p1->z0);
-                                i++; /* Increase the number of found vertices. */
-                        }
-                }
-                else if ((strcmp (temp_string, "12") == 0)
-                  || (strcmp (temp_string, "22") == 0)
-                  || (strcmp (temp_string, "32") == 0))
-                {
-                        if (strcmp (temp_string, "12") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                if (j > 0) /* Create a pointer for the next vector. */
+                                iter_p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                if (iter_p1 != NULL)
+                                {
+                                        iter_p1->y0 = atof (value);
+                                }
+                                break;
+                        case 31:
+                                if (iter_p1 != NULL)
+                                {
+                                        iter_p1->z0 = atof (value);
+                                }
+                                break;
+                        case 12:
+                                /* One direction vector for each segment, the first one is stored in
+                                 * the point allocated by dxf_mline_init (). */
+                                if (iter_p2 == NULL)
+                                {
+                                        iter_p2 = mline->p2;
+                                }
+                                else
                                 {
-                                        dxf_point_init ((DxfPoint *) iter_p2->next);
+                                        iter_p2->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
                                         iter_p2 = (DxfPoint *) iter_p2->next;
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p2->x0);
-                        }
-                        else if (strcmp (temp_string, "22") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p2->y0);
-                        }
-                        else if (strcmp (temp_string, "32") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p2->z0);
-                                j++; /* Increase the number of found vectors. */
-                        }
-                }
-                else if ((strcmp (temp_string, "13") == 0)
-                  || (strcmp (temp_string, "23") == 0)
-                  || (strcmp (temp_string, "33") == 0))
-                {
-                        if (strcmp (temp_string, "13") == 0)
-                        {
-                                /* Now follows a string containing the X-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                if (k > 0) /* Create a pointer for the next vector. */
+                                iter_p2->x0 = atof (value);
+                                break;
+                        case 22:
+                                if (iter_p2 != NULL)
                                 {
-                                        dxf_point_init ((DxfPoint *) iter_p3->next);
+                                        iter_p2->y0 = atof (value);
+                                }
+                                break;
+                        case 32:
+                                if (iter_p2 != NULL)
+                                {
+                                        iter_p2->z0 = atof (value);
+                                }
+                                break;
+                        case 13:
+                                /* One miter direction for each segment, the first one is stored in
+                                 * the point allocated by dxf_mline_init (). */
+                                if (iter_p3 == NULL)
+                                {
+                                        iter_p3 = mline->p3;
+                                }
+                                else
+                                {
+                                        iter_p3->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
                                         iter_p3 = (DxfPoint *) iter_p3->next;
                                 }
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p3->x0);
-                        }
-                        else if (strcmp (temp_string, "23") == 0)
-                        {
-                                /* Now follows a string containing the Y-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p3->y0);
-                        }
-                        else if (strcmp (temp_string, "33") == 0)
-                        {
-                                /* Now follows a string containing the Z-value
-                                 * of the Direction vector (one entry for each
-                                 * vector). */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, "%lf\n", &iter_p3->z0);
-                                k++; /* Increase the number of found vectors. */
-                        }
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the scale
-                         * factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->scale_factor);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the element
-                         * parameters (repeats based on previous code 74). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->element_parameters[l]);
-                        l++;
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the area fill
-                         * parameters (repeats based on previous code 75). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->area_fill_parameters[m]);
-                        m++;
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * justification value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->justification);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the flags
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * vertices value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_vertices);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * elements in MLINESTYLE definition. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_elements);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * parameters for this element (repeats for each
-                         * element in segment). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_parameters);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * area fill parameters for this element
-                         * (repeats for each element in segment). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mline->number_of_area_fill_parameters);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbMline") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X value of the extrusion direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y value of the extrusion direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z value of the extrusion direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mline->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "340") == 0)
-                {
-                        /* Now follows a string containing a
-                         * Pointer-handle/ID of MLINESTYLE dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->mlinestyle_dictionary);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                iter_p3->x0 = atof (value);
+                                break;
+                        case 23:
+                                if (iter_p3 != NULL)
+                                {
+                                        iter_p3->y0 = atof (value);
+                                }
+                                break;
+                        case 33:
+                                if (iter_p3 != NULL)
+                                {
+                                        iter_p3->z0 = atof (value);
+                                }
+                                break;
+                        case 40:
+                                mline->scale_factor = atof (value);
+                                break;
+                        case 41:
+                                if (l < DXF_MAX_PARAM)
+                                {
+                                        mline->element_parameters[l] = atof (value);
+                                        l++;
+                                }
+                                break;
+                        case 42:
+                                if (m < DXF_MAX_PARAM)
+                                {
+                                        mline->area_fill_parameters[m] = atof (value);
+                                        m++;
+                                }
+                                break;
+                        case 70:
+                                mline->justification = atoi (value);
+                                break;
+                        case 71:
+                                mline->flags = atoi (value);
+                                break;
+                        case 72:
+                                mline->number_of_vertices = atoi (value);
+                                break;
+                        case 73:
+                                mline->number_of_elements = atoi (value);
+                                break;
+                        case 74:
+                                mline->number_of_parameters = atoi (value);
+                                break;
+                        case 75:
+                                mline->number_of_area_fill_parameters = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbMline") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                mline->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                mline->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                mline->extr_z0 = atof (value);
+                                break;
+                        case 340:
+                                mline->mlinestyle_dictionary = dxf_handle_parse (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &mline->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
+        if ((mline->common.linetype == NULL)
+          || (strcmp (mline->common.linetype, "") == 0))
         {
-                dxf_mline_set_linetype (mline, strdup (DXF_DEFAULT_LINETYPE));
+                free (mline->common.linetype);
+                mline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (dxf_mline_get_layer (mline), "") == 0)
+        if ((mline->common.layer == NULL)
+          || (strcmp (mline->common.layer, "") == 0))
         {
-                dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
+                free (mline->common.layer);
+                mline->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -645,20 +464,20 @@ dxf_mline_write
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, mline->id_code);
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, mline->common.id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
         }
         if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
@@ -668,7 +487,7 @@ dxf_mline_write
         if (strcmp (dxf_mline_get_layer (mline), "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mline_get_id_code (mline));
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
@@ -695,9 +514,9 @@ dxf_mline_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_mline_get_id_code (mline) != -1)
+        if (dxf_mline_get_id_code (mline) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_mline_get_id_code (mline));
+                dxf_handle_write (fp, 5, dxf_mline_get_id_code (mline));
         }
         /*!
          * \todo for version R14.\n
@@ -709,18 +528,18 @@ dxf_mline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mline->dictionary_owner_soft, "") != 0)
+        if ((mline->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_mline_get_dictionary_owner_soft (mline));
+                dxf_handle_write (fp, 330, mline->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dxf_mline_get_dictionary_owner_hard (mline), "") != 0)
+        if ((mline->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_mline_get_dictionary_owner_hard (mline));
+                dxf_handle_write (fp, 360, mline->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -737,9 +556,9 @@ dxf_mline_write
                 fprintf (fp->fp, "  6\n%s\n", dxf_mline_get_linetype (mline));
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (dxf_mline_get_material (mline), "") != 0))
+          && (mline->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", dxf_mline_get_material (mline));
+                dxf_handle_write (fp, 347, mline->common.cold->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -770,11 +589,9 @@ dxf_mline_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", dxf_mline_get_graphics_data_size (mline));
 #endif
-                DxfBinaryGraphicsData *bgd_iter = (DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline);
-                while (dxf_binary_graphics_data_get_data_line (bgd_iter) != NULL)
+                if (dxf_mline_get_binary_graphics_data (mline) != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (bgd_iter));
-                        bgd_iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (bgd_iter);
+                        dxf_binary_buffer_write (fp, 310, dxf_mline_get_binary_graphics_data (mline));
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -785,19 +602,19 @@ dxf_mline_write
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", dxf_mline_get_plot_style_name (mline));
+                dxf_handle_write (fp, 390, mline->common.cold->plot_style_name);
                 fprintf (fp->fp, "284\n%d\n", dxf_mline_get_shadow_mode (mline));
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbMline\n");
         }
-        if (mline->thickness != 0.0)
+        if (mline->common.thickness != 0.0)
         {
                 fprintf (fp->fp, " 39\n%f\n", dxf_mline_get_thickness (mline));
         }
         fprintf (fp->fp, "  2\n%s\n", dxf_mline_get_style_name (mline));
-        fprintf (fp->fp, "340\n%s\n", dxf_mline_get_mlinestyle_dictionary (mline));
+        dxf_handle_write (fp, 340, mline->mlinestyle_dictionary);
         fprintf (fp->fp, " 40\n%f\n", dxf_mline_get_scale_factor (mline));
         fprintf (fp->fp, " 70\n%d\n", dxf_mline_get_justification (mline));
         fprintf (fp->fp, " 71\n%d\n", dxf_mline_get_flags (mline));
@@ -873,6 +690,7 @@ dxf_mline_write
         {
                 fprintf (fp->fp, " 42\n%f\n", mline->area_fill_parameters[i]);
         }
+        dxf_entity_common_write_xdata (fp, &mline->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -915,20 +733,12 @@ dxf_mline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mline->linetype);
-        free (mline->layer);
-        dxf_binary_graphics_data_free_list (mline->binary_graphics_data);
-        free (mline->dictionary_owner_soft);
-        free (mline->material);
-        free (mline->dictionary_owner_hard);
-        free (mline->plot_style_name);
-        free (mline->color_name);
+        dxf_entity_common_free (&mline->common);
         free (mline->style_name);
         dxf_point_free (mline->p0);
         dxf_point_free_list (mline->p1);
         dxf_point_free_list (mline->p2);
         dxf_point_free_list (mline->p3);
-        free (mline->mlinestyle_dictionary);
         free (mline);
         mline = NULL;
 #if DEBUG
@@ -962,6 +772,7 @@ dxf_mline_free_list
         while (mlines != NULL)
         {
                 DxfMline *iter = (DxfMline *) mlines->next;
+                mlines->next = NULL;
                 dxf_mline_free (mlines);
                 mlines = (DxfMline *) iter;
         }
@@ -972,39 +783,139 @@ dxf_mline_free_list
 
 
 /*!
- * \brief Get the ID code from a DXF \c MLINE entity.
+ * \brief Copy a DXF \c MLINE entity.
  *
- * \return ID code.
+ * The copy does not share any memory with \c mline, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
  */
-int
-dxf_mline_get_id_code
+DxfMline *
+dxf_mline_copy
 (
         DxfMline *mline
-                /*!< a pointer to a DXF \c MLINE entity. */
+                /*!< a pointer to the DXF \c MLINE entity to copy. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfMline *copy;
+
         /* Do some basic checks. */
         if (mline == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
-        if (mline->id_code < 0)
+        copy = dxf_mline_new ();
+        if (copy == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, mline, sizeof (DxfMline));
+        copy->style_name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &mline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_mline_free (copy);
+                return (NULL);
+        }
+        if (mline->style_name != NULL)
+        {
+                copy->style_name = strdup (mline->style_name);
+                if (copy->style_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mline->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (mline->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_mline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mline->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy_list (mline->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_mline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mline->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy_list (mline->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_mline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mline->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy_list (mline->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_mline_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Get the ID code from a DXF \c MLINE entity.
+ *
+ * \return ID code.
+ */
+DxfHandle
+dxf_mline_get_id_code
+(
+        DxfMline *mline
+                /*!< a pointer to a DXF \c MLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->id_code);
+        return (mline->common.id_code);
 }
 
 
@@ -1016,7 +927,7 @@ dxf_mline_set_id_code
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1033,14 +944,7 @@ dxf_mline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mline->id_code = id_code;
+        mline->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1071,7 +975,7 @@ dxf_mline_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->linetype ==  NULL)
+        if (mline->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1081,7 +985,7 @@ dxf_mline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->linetype));
+        return (strdup (mline->common.linetype));
 }
 
 
@@ -1115,7 +1019,7 @@ dxf_mline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->linetype = strdup (linetype);
+        mline->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1146,7 +1050,7 @@ dxf_mline_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->layer ==  NULL)
+        if (mline->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1156,7 +1060,7 @@ dxf_mline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->layer));
+        return (strdup (mline->common.layer));
 }
 
 
@@ -1190,7 +1094,7 @@ dxf_mline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->layer = strdup (layer);
+        mline->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1224,7 +1128,7 @@ dxf_mline_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->elevation);
+        return (mline->common.elevation);
 }
 
 
@@ -1251,7 +1155,7 @@ dxf_mline_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->elevation = elevation;
+        mline->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1282,7 +1186,7 @@ dxf_mline_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->thickness < 0.0)
+        if (mline->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1292,7 +1196,7 @@ dxf_mline_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->thickness);
+        return (mline->common.thickness);
 }
 
 
@@ -1326,7 +1230,7 @@ dxf_mline_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->thickness = thickness;
+        mline->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1357,7 +1261,7 @@ dxf_mline_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->linetype_scale < 0.0)
+        if (mline->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1367,7 +1271,7 @@ dxf_mline_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->linetype_scale);
+        return (mline->common.linetype_scale);
 }
 
 
@@ -1401,7 +1305,7 @@ dxf_mline_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->linetype_scale = linetype_scale;
+        mline->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1432,14 +1336,14 @@ dxf_mline_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->visibility < 0)
+        if (mline->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->visibility > 1)
+        if (mline->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1449,7 +1353,7 @@ dxf_mline_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->visibility);
+        return (mline->common.visibility);
 }
 
 
@@ -1490,7 +1394,7 @@ dxf_mline_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->visibility = visibility;
+        mline->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1521,7 +1425,7 @@ dxf_mline_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->color < 0)
+        if (mline->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1530,7 +1434,7 @@ dxf_mline_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->color);
+        return (mline->common.color);
 }
 
 
@@ -1563,7 +1467,7 @@ dxf_mline_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mline->color = color;
+        mline->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1594,13 +1498,13 @@ dxf_mline_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->paperspace < 0)
+        if (mline->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mline->paperspace > 1)
+        if (mline->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1609,7 +1513,7 @@ dxf_mline_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->paperspace);
+        return (mline->common.paperspace);
 }
 
 
@@ -1650,7 +1554,7 @@ dxf_mline_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->paperspace = paperspace;
+        mline->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1682,13 +1586,13 @@ dxf_mline_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->graphics_data_size < 0)
+        if (mline->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mline->graphics_data_size == 0)
+        if (mline->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1697,7 +1601,7 @@ dxf_mline_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->graphics_data_size);
+        return (mline->common.cold->graphics_data_size);
 }
 
 
@@ -1741,7 +1645,7 @@ dxf_mline_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        mline->graphics_data_size = graphics_data_size;
+        mline->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1773,14 +1677,14 @@ dxf_mline_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->shadow_mode < 0)
+        if (mline->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mline->shadow_mode > 3)
+        if (mline->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1790,7 +1694,7 @@ dxf_mline_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->shadow_mode);
+        return (mline->common.cold->shadow_mode);
 }
 
 
@@ -1834,7 +1738,7 @@ dxf_mline_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->shadow_mode = shadow_mode;
+        mline->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1846,11 +1750,12 @@ dxf_mline_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c MLINE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_mline_get_binary_graphics_data
 (
         DxfMline *mline
@@ -1868,32 +1773,31 @@ dxf_mline_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) mline->binary_graphics_data);
+        return (mline->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c MLINE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c mline when successful, or \c NULL when an
+ * error occurred.
  */
 DxfMline *
 dxf_mline_set_binary_graphics_data
 (
         DxfMline *mline,
                 /*!< a pointer to a DXF \c MLINE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1914,7 +1818,12 @@ dxf_mline_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((mline->common.cold->binary_graphics_data != NULL)
+          && (mline->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (mline->common.cold->binary_graphics_data);
+        }
+        mline->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1948,17 +1857,10 @@ dxf_mline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->dictionary_owner_soft));
+        return (dxf_handle_to_string (mline->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1994,7 +1896,7 @@ dxf_mline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mline->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2028,17 +1930,10 @@ dxf_mline_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->material));
+        return (dxf_handle_to_string (mline->common.cold->material));
 }
 
 
@@ -2076,7 +1971,7 @@ dxf_mline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->material = strdup (material);
+        mline->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2110,17 +2005,10 @@ dxf_mline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->dictionary_owner_hard));
+        return (dxf_handle_to_string (mline->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2156,7 +2044,7 @@ dxf_mline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mline->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2191,7 +2079,7 @@ dxf_mline_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->lineweight);
+        return (mline->common.lineweight);
 }
 
 
@@ -2221,7 +2109,7 @@ dxf_mline_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->lineweight = lineweight;
+        mline->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2253,17 +2141,10 @@ dxf_mline_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->plot_style_name));
+        return (dxf_handle_to_string (mline->common.cold->plot_style_name));
 }
 
 
@@ -2301,7 +2182,7 @@ dxf_mline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->plot_style_name = strdup (plot_style_name);
+        mline->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2336,7 +2217,7 @@ dxf_mline_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->color_value);
+        return (mline->common.color_value);
 }
 
 
@@ -2366,7 +2247,7 @@ dxf_mline_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->color_value = color_value;
+        mline->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2398,7 +2279,7 @@ dxf_mline_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->color_name ==  NULL)
+        if (mline->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2408,7 +2289,7 @@ dxf_mline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->color_name));
+        return (strdup (mline->common.cold->color_name));
 }
 
 
@@ -2446,7 +2327,7 @@ dxf_mline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->color_name = strdup (color_name);
+        mline->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2481,7 +2362,7 @@ dxf_mline_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mline->transparency);
+        return (mline->common.cold->transparency);
 }
 
 
@@ -2511,7 +2392,7 @@ dxf_mline_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->transparency = transparency;
+        mline->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4978,17 +4859,10 @@ dxf_mline_get_mlinestyle_dictionary
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mline->mlinestyle_dictionary ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mline->mlinestyle_dictionary));
+        return (dxf_handle_to_string (mline->mlinestyle_dictionary));
 }
 
 
@@ -5026,7 +4900,7 @@ dxf_mline_set_mlinestyle_dictionary
                   __FUNCTION__);
                 return (NULL);
         }
-        mline->mlinestyle_dictionary = strdup (mlinestyle_dictionary);
+        mline->mlinestyle_dictionary = dxf_handle_parse (mlinestyle_dictionary);
 #if DEBUG
         DXF_DEBUG_END
 #endif
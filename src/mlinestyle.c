@@ -222,8 +222,7 @@ dxf_mlinestyle_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &mlinestyle->id_code);
+                        mlinestyle->id_code = dxf_handle_read (fp);
                 }
                 if (strcmp (temp_string, "6") == 0)
                 {
@@ -303,15 +302,13 @@ dxf_mlinestyle_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->dictionary_owner_soft);
+                        mlinestyle->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->dictionary_owner_hard);
+                        mlinestyle->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -387,21 +384,21 @@ dxf_mlinestyle_write
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_mlinestyle_get_id_code (mlinestyle) != -1)
+        if (dxf_mlinestyle_get_id_code (mlinestyle) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_mlinestyle_get_id_code (mlinestyle));
+                dxf_handle_write (fp, 5, dxf_mlinestyle_get_id_code (mlinestyle));
         }
         /*!
          * \todo for version R14.\n
@@ -413,18 +410,18 @@ dxf_mlinestyle_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle), "") != 0)
+        if ((mlinestyle->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
+                dxf_handle_write (fp, 330, mlinestyle->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle), "") != 0)
+        if ((mlinestyle->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
+                dxf_handle_write (fp, 360, mlinestyle->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -488,8 +485,6 @@ dxf_mlinestyle_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
-        free (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
         free (dxf_mlinestyle_get_name (mlinestyle));
         free (dxf_mlinestyle_get_description (mlinestyle));
         for (i = 0; i < DXF_MAX_PARAM; i++)
@@ -529,6 +524,7 @@ dxf_mlinestyle_free_list
         while (mlinestyles != NULL)
         {
                 DxfMlinestyle *iter = (DxfMlinestyle *) mlinestyles->next;
+                mlinestyles->next = NULL;
                 dxf_mlinestyle_free (mlinestyles);
                 mlinestyles = (DxfMlinestyle *) iter;
         }
@@ -543,7 +539,7 @@ dxf_mlinestyle_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_mlinestyle_get_id_code
 (
         DxfMlinestyle *mlinestyle
@@ -561,13 +557,6 @@ dxf_mlinestyle_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mlinestyle->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -583,7 +572,7 @@ dxf_mlinestyle_set_id_code
 (
         DxfMlinestyle *mlinestyle,
                 /*!< a pointer to a DXF \c MLINESTYLE object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -600,13 +589,6 @@ dxf_mlinestyle_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         mlinestyle->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -641,17 +623,10 @@ dxf_mlinestyle_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mlinestyle->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_soft));
+        return (dxf_handle_to_string (mlinestyle->dictionary_owner_soft));
 }
 
 
@@ -687,7 +662,7 @@ dxf_mlinestyle_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mlinestyle->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -721,17 +696,10 @@ dxf_mlinestyle_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mlinestyle->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_hard));
+        return (dxf_handle_to_string (mlinestyle->dictionary_owner_hard));
 }
 
 
@@ -767,7 +735,7 @@ dxf_mlinestyle_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mlinestyle->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -42,6 +42,7 @@
 
 
 #include "mtext.h"
+#include "entities.h"
 
 
 /*!
@@ -95,8 +96,6 @@ dxf_mtext_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (mtext == NULL)
         {
@@ -112,23 +111,30 @@ dxf_mtext_init
                 __FUNCTION__);
               return (NULL);
         }
-        mtext->id_code = 0;
-        mtext->text_value = strdup ("");
-        for (i = 1; i < DXF_MAX_PARAM; i++)
+        if (dxf_entity_common_init (&mtext->common) == NULL)
         {
-                mtext->text_additional_value[i] = strdup ("");
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
-        mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+        mtext->text_value = strdup ("");
+        mtext->text_length = 0;
+        mtext->text_size = 1;
+        mtext->text_chunk_offset = NULL;
+        mtext->number_of_text_chunks = 0;
+        mtext->text_chunk_offset_size = 0;
         mtext->text_style = strdup ("");
-        mtext->layer = strdup (DXF_DEFAULT_LAYER);
-        mtext->p0->x0 = 0.0;
-        mtext->p0->y0 = 0.0;
-        mtext->p0->z0 = 0.0;
-        mtext->p1->x0 = 0.0;
-        mtext->p1->y0 = 0.0;
-        mtext->p1->z0 = 0.0;
-        mtext->elevation = 0.0;
-        mtext->thickness = 0.0;
+        mtext->p0 = dxf_point_init (dxf_point_new ());
+        mtext->p1 = dxf_point_init (dxf_point_new ());
+        if ((mtext->p0 == NULL)
+          || (mtext->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         mtext->height = 0.0;
         mtext->rectangle_width = 0.0;
         mtext->horizontal_width = 0.0;
@@ -139,9 +145,7 @@ dxf_mtext_init
         mtext->column_gutter = 0.0;
         mtext->column_heights = 0.0;
         mtext->rot_angle = 0.0;
-        mtext->color = DXF_COLOR_BYLAYER;
         mtext->background_color = 0;
-        mtext->paperspace = DXF_MODELSPACE;
         mtext->attachment_point = 0;
         mtext->drawing_direction = 0;
         mtext->spacing_style = 0;
@@ -187,7 +191,9 @@ dxf_mtext_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -195,8 +201,6 @@ dxf_mtext_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mtext == NULL)
@@ -204,322 +208,180 @@ dxf_mtext_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                mtext = dxf_mtext_init (mtext);
+                mtext = dxf_mtext_init (dxf_mtext_new ());
+                if (mtext == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_value);
-                }
-                else if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        //fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_additional_value[number_additional]);
-                        //number_additional++;
-                }
-                /*!< I'm not sure this number_additional is correct.*/
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &mtext->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                  && DXF_FLATLAND
-                  && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * reference rectangle width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->rectangle_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal width of the characters. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->horizontal_width);
+                        break;
                 }
-                else if (strcmp (temp_string, "43") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * vertical rectangle height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->rectangle_height);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text line spacing factor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->spacing_factor);
-                }
-                else if (strcmp (temp_string, "45") == 0)
-                {
-                        /* Now follows a string containing the
-                         * fill box scale (border around text). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->box_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->column_width);
-                }
-                else if (strcmp (temp_string, "49") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column gutter. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->column_gutter);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_2006)
-                        && (strcmp (temp_string, "50") == 0))
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->rot_angle);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_2007)
-                        && (strcmp (temp_string, "50") == 0))
-                {
-                        /* Can follows a string containing the
-                         * rotation angle or column heights. */
-                        (fp->line_number)++;
-                /*!< Add more code here, I'm stop because the double use of group code 50*/
-                }
-                else if (strcmp (temp_string, "63") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color to use for background fill. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->background_color);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * attachment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->attachment_point);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * drawing direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->drawing_direction);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * mtext line spacing style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->spacing_style);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_type);
-                }
-                else if (strcmp (temp_string, "76") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column count. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_count);
-                }
-                else if (strcmp (temp_string, "78") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column flow reverse. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_flow);
-                }
-                else if (strcmp (temp_string, "79") == 0)
-                {
-                        /* Now follows a string containing the
-                         * column autoheight. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->column_autoheight);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the
-                         * background fill setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mtext->background_fill);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbMText") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mtext->extr_z0);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 1:
+                        case 3:
+                                /* Group 3 chunks precede the final
+                                 * group 1 chunk of the text value. */
+                                dxf_mtext_append_text_chunk (mtext, value, strlen (value));
+                                break;
+                        case 7:
+                                free (mtext->text_style);
+                                mtext->text_style = strdup (value);
+                                break;
+                        case 10:
+                                mtext->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                mtext->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                mtext->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                mtext->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                mtext->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                mtext->p1->z0 = atof (value);
+                                break;
+                        case 40:
+                                mtext->height = atof (value);
+                                break;
+                        case 41:
+                                mtext->rectangle_width = atof (value);
+                                break;
+                        case 42:
+                                mtext->horizontal_width = atof (value);
+                                break;
+                        case 43:
+                                mtext->rectangle_height = atof (value);
+                                break;
+                        case 44:
+                                mtext->spacing_factor = atof (value);
+                                break;
+                        case 45:
+                                mtext->box_scale = atof (value);
+                                break;
+                        case 48:
+                                mtext->column_width = atof (value);
+                                break;
+                        case 49:
+                                mtext->column_gutter = atof (value);
+                                break;
+                        case 50:
+                                /* From R2007 on the column heights
+                                 * follow the column count with the
+                                 * same group code as the rotation
+                                 * angle. */
+                                if ((fp->acad_version_number >= AutoCAD_2007)
+                                  && (mtext->column_count > 0))
+                                {
+                                        mtext->column_heights = atof (value);
+                                }
+                                else
+                                {
+                                        mtext->rot_angle = atof (value);
+                                }
+                                break;
+                        case 63:
+                                mtext->background_color = atoi (value);
+                                break;
+                        case 71:
+                                mtext->attachment_point = atoi (value);
+                                break;
+                        case 72:
+                                mtext->drawing_direction = atoi (value);
+                                break;
+                        case 73:
+                                mtext->spacing_style = atoi (value);
+                                break;
+                        case 75:
+                                mtext->column_type = atoi (value);
+                                break;
+                        case 76:
+                                mtext->column_count = atoi (value);
+                                break;
+                        case 78:
+                                mtext->column_flow = atoi (value);
+                                break;
+                        case 79:
+                                mtext->column_autoheight = atoi (value);
+                                break;
+                        case 90:
+                                mtext->background_fill = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbMText") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                mtext->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                mtext->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                mtext->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &mtext->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (mtext->linetype, "") == 0)
+        if ((mtext->common.linetype == NULL)
+          || (strcmp (mtext->common.linetype, "") == 0))
         {
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (mtext->common.linetype);
+                mtext->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (mtext->layer, "") == 0)
+        if ((mtext->common.layer == NULL)
+          || (strcmp (mtext->common.layer, "") == 0))
         {
-                mtext->layer = strdup (DXF_DEFAULT_LAYER);
+                free (mtext->common.layer);
+                mtext->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (mtext);
 }
 
 
@@ -549,6 +411,8 @@ dxf_mtext_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("MTEXT");
+        const char *chunk;
+        size_t length;
         int i;
 
         /* Do some basic checks. */
@@ -574,41 +438,41 @@ dxf_mtext_write
           && (fp->follow_strict_version_rules))
         {
                 fprintf (stderr,
-                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, mtext->id_code);
+                  (_("Error in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, mtext->common.id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, mtext->id_code);
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, mtext->common.id_code);
         }
-        if (strcmp (mtext->linetype, "") == 0)
+        if (strcmp (mtext->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, mtext->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, mtext->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                mtext->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (mtext->layer, "") == 0)
+        if (strcmp (mtext->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, mtext->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, mtext->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                mtext->layer = DXF_DEFAULT_LAYER;
+                mtext->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (mtext->id_code != -1)
+        if (mtext->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", mtext->id_code);
+                dxf_handle_write (fp, 5, mtext->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -620,54 +484,54 @@ dxf_mtext_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (mtext->dictionary_owner_soft, "") != 0)
+        if ((mtext->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", mtext->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, mtext->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (mtext->dictionary_owner_hard, "") != 0)
+        if ((mtext->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", mtext->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, mtext->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (mtext->paperspace == DXF_PAPERSPACE)
+        if (mtext->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mtext->layer);
-        if (strcmp (mtext->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", mtext->common.layer);
+        if (strcmp (mtext->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mtext->linetype);
+                fprintf (fp->fp, "  6\n%s\n", mtext->common.linetype);
         }
-        if (mtext->color != DXF_COLOR_BYLAYER)
+        if (mtext->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", mtext->color);
+                fprintf (fp->fp, " 62\n%hd\n", mtext->common.color);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (mtext->elevation != 0.0))
+          && (mtext->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", mtext->elevation);
+                fprintf (fp->fp, " 38\n%f\n", mtext->common.elevation);
         }
-        if (mtext->thickness != 0.0)
+        if (mtext->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", mtext->thickness);
+                fprintf (fp->fp, " 39\n%f\n", mtext->common.thickness);
         }
-        if (mtext->linetype_scale != 1.0)
+        if (mtext->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", mtext->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", mtext->common.linetype_scale);
         }
-        if (mtext->visibility != 0)
+        if (mtext->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", mtext->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", mtext->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -680,12 +544,21 @@ dxf_mtext_write
         fprintf (fp->fp, " 41\n%f\n", mtext->rectangle_width);
         fprintf (fp->fp, " 71\n%d\n", mtext->attachment_point);
         fprintf (fp->fp, " 72\n%d\n", mtext->drawing_direction);
-        fprintf (fp->fp, "  1\n%s\n", mtext->text_value);
-        i = 0;
-        while (strlen (mtext->text_additional_value[i]) > 0)
+        /* All chunks but the last one are written as group 3, the last
+         * chunk is written as group 1. */
+        for (i = 0; i < (mtext->number_of_text_chunks - 1); i++)
+        {
+                chunk = dxf_mtext_get_text_chunk (mtext, i, &length);
+                fprintf (fp->fp, "  3\n%.*s\n", (int) length, chunk);
+        }
+        if (mtext->number_of_text_chunks > 0)
+        {
+                chunk = dxf_mtext_get_text_chunk (mtext, i, &length);
+                fprintf (fp->fp, "  1\n%.*s\n", (int) length, chunk);
+        }
+        else
         {
-                fprintf (fp->fp, "  3\n%s\n", mtext->text_additional_value[i]);
-                i++;
+                fprintf (fp->fp, "  1\n\n");
         }
         fprintf (fp->fp, "  7\n%s\n", mtext->text_style);
 
@@ -704,6 +577,7 @@ dxf_mtext_write
         fprintf (fp->fp, " 42\n%f\n", mtext->horizontal_width);
         fprintf (fp->fp, " 43\n%f\n", mtext->rectangle_height);
         fprintf (fp->fp, " 50\n%f\n", mtext->rot_angle);
+        dxf_entity_common_write_xdata (fp, &mtext->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -730,8 +604,6 @@ dxf_mtext_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (mtext == NULL)
         {
@@ -747,16 +619,12 @@ dxf_mtext_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mtext->linetype);
-        free (mtext->layer);
+        dxf_entity_common_free (&mtext->common);
+        dxf_point_free (mtext->p0);
+        dxf_point_free (mtext->p1);
         free (mtext->text_value);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                free (mtext->text_additional_value[i]);
-        }
+        free (mtext->text_chunk_offset);
         free (mtext->text_style);
-        free (mtext->dictionary_owner_soft);
-        free (mtext->dictionary_owner_hard);
         free (mtext->background_color_name);
         free (mtext);
         mtext = NULL;
@@ -791,6 +659,7 @@ dxf_mtext_free_list
         while (mtexts != NULL)
         {
                 DxfMtext *iter = (DxfMtext *) mtexts->next;
+                mtexts->next = NULL;
                 dxf_mtext_free (mtexts);
                 mtexts = (DxfMtext *) iter;
         }
@@ -800,12 +669,145 @@ dxf_mtext_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c MTEXT entity.
+ *
+ * The copy does not share any memory with \c mtext, its \c next
+ * member is \c NULL.\n
+ * The text buffer and the chunk offsets are trimmed to their length.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfMtext *
+dxf_mtext_copy
+(
+        DxfMtext *mtext
+                /*!< a pointer to the DXF \c MTEXT entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMtext *copy;
+
+        /* Do some basic checks. */
+        if (mtext == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_mtext_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, mtext, sizeof (DxfMtext));
+        copy->text_style = NULL;
+        copy->background_color_name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->text_value = NULL;
+        copy->text_chunk_offset = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &mtext->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_mtext_free (copy);
+                return (NULL);
+        }
+        if (mtext->text_style != NULL)
+        {
+                copy->text_style = strdup (mtext->text_style);
+                if (copy->text_style == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mtext_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mtext->background_color_name != NULL)
+        {
+                copy->background_color_name = strdup (mtext->background_color_name);
+                if (copy->background_color_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mtext_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mtext->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (mtext->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_mtext_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mtext->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (mtext->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_mtext_free (copy);
+                        return (NULL);
+                }
+        }
+        if (mtext->text_value != NULL)
+        {
+                copy->text_size = mtext->text_length + 1;
+                copy->text_value = malloc (copy->text_size);
+                if (copy->text_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mtext_free (copy);
+                        return (NULL);
+                }
+                memcpy (copy->text_value, mtext->text_value, copy->text_size);
+        }
+        if (mtext->text_chunk_offset != NULL)
+        {
+                copy->text_chunk_offset_size = (mtext->number_of_text_chunks > 0)
+                  ? mtext->number_of_text_chunks : 1;
+                copy->text_chunk_offset = malloc ((size_t) copy->text_chunk_offset_size * sizeof (size_t));
+                if (copy->text_chunk_offset == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mtext_free (copy);
+                        return (NULL);
+                }
+                memcpy (copy->text_chunk_offset, mtext->text_chunk_offset,
+                  (size_t) mtext->number_of_text_chunks * sizeof (size_t));
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c MTEXT entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_mtext_get_id_code
 (
         DxfMtext *mtext
@@ -823,17 +825,10 @@ dxf_mtext_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->id_code);
+        return (mtext->common.id_code);
 }
 
 
@@ -845,7 +840,7 @@ dxf_mtext_set_id_code
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -862,14 +857,7 @@ dxf_mtext_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mtext->id_code = id_code;
+        mtext->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -900,7 +888,7 @@ dxf_mtext_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->linetype ==  NULL)
+        if (mtext->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -910,7 +898,7 @@ dxf_mtext_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->linetype));
+        return (strdup (mtext->common.linetype));
 }
 
 
@@ -944,7 +932,7 @@ dxf_mtext_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->linetype = strdup (linetype);
+        mtext->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -975,7 +963,7 @@ dxf_mtext_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->layer ==  NULL)
+        if (mtext->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -985,7 +973,7 @@ dxf_mtext_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->layer));
+        return (strdup (mtext->common.layer));
 }
 
 
@@ -1019,7 +1007,7 @@ dxf_mtext_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->layer = strdup (layer);
+        mtext->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1053,7 +1041,7 @@ dxf_mtext_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->elevation);
+        return (mtext->common.elevation);
 }
 
 
@@ -1080,7 +1068,7 @@ dxf_mtext_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->elevation = elevation;
+        mtext->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1111,7 +1099,7 @@ dxf_mtext_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->thickness < 0.0)
+        if (mtext->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1121,7 +1109,7 @@ dxf_mtext_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->thickness);
+        return (mtext->common.thickness);
 }
 
 
@@ -1155,7 +1143,7 @@ dxf_mtext_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->thickness = thickness;
+        mtext->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1186,7 +1174,7 @@ dxf_mtext_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->linetype_scale < 0.0)
+        if (mtext->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1196,7 +1184,7 @@ dxf_mtext_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->linetype_scale);
+        return (mtext->common.linetype_scale);
 }
 
 
@@ -1230,7 +1218,7 @@ dxf_mtext_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->linetype_scale = linetype_scale;
+        mtext->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1261,14 +1249,14 @@ dxf_mtext_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->visibility < 0)
+        if (mtext->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->visibility > 1)
+        if (mtext->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1278,7 +1266,7 @@ dxf_mtext_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->visibility);
+        return (mtext->common.visibility);
 }
 
 
@@ -1319,7 +1307,7 @@ dxf_mtext_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->visibility = visibility;
+        mtext->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1350,7 +1338,7 @@ dxf_mtext_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->color < 0)
+        if (mtext->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1359,7 +1347,7 @@ dxf_mtext_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->color);
+        return (mtext->common.color);
 }
 
 
@@ -1392,7 +1380,7 @@ dxf_mtext_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        mtext->color = color;
+        mtext->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1423,13 +1411,13 @@ dxf_mtext_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->paperspace < 0)
+        if (mtext->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mtext->paperspace > 1)
+        if (mtext->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1438,7 +1426,7 @@ dxf_mtext_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->paperspace);
+        return (mtext->common.paperspace);
 }
 
 
@@ -1479,7 +1467,7 @@ dxf_mtext_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->paperspace = paperspace;
+        mtext->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1511,13 +1499,13 @@ dxf_mtext_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->graphics_data_size < 0)
+        if (mtext->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (mtext->graphics_data_size == 0)
+        if (mtext->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1526,7 +1514,7 @@ dxf_mtext_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->graphics_data_size);
+        return (mtext->common.cold->graphics_data_size);
 }
 
 
@@ -1570,7 +1558,7 @@ dxf_mtext_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        mtext->graphics_data_size = graphics_data_size;
+        mtext->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1602,14 +1590,14 @@ dxf_mtext_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->shadow_mode < 0)
+        if (mtext->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (mtext->shadow_mode > 3)
+        if (mtext->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1619,7 +1607,7 @@ dxf_mtext_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->shadow_mode);
+        return (mtext->common.cold->shadow_mode);
 }
 
 
@@ -1663,7 +1651,7 @@ dxf_mtext_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->shadow_mode = shadow_mode;
+        mtext->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1675,11 +1663,12 @@ dxf_mtext_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c MTEXT entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_mtext_get_binary_graphics_data
 (
         DxfMtext *mtext
@@ -1697,32 +1686,31 @@ dxf_mtext_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) mtext->binary_graphics_data);
+        return (mtext->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c MTEXT entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c mtext when successful, or \c NULL when an
+ * error occurred.
  */
 DxfMtext *
 dxf_mtext_set_binary_graphics_data
 (
         DxfMtext *mtext,
                 /*!< a pointer to a DXF \c MTEXT entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1743,7 +1731,12 @@ dxf_mtext_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((mtext->common.cold->binary_graphics_data != NULL)
+          && (mtext->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (mtext->common.cold->binary_graphics_data);
+        }
+        mtext->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1777,17 +1770,10 @@ dxf_mtext_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->dictionary_owner_soft));
+        return (dxf_handle_to_string (mtext->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1823,7 +1809,7 @@ dxf_mtext_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mtext->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1857,17 +1843,10 @@ dxf_mtext_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->material));
+        return (dxf_handle_to_string (mtext->common.cold->material));
 }
 
 
@@ -1905,7 +1884,7 @@ dxf_mtext_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->material = strdup (material);
+        mtext->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1939,17 +1918,10 @@ dxf_mtext_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->dictionary_owner_hard));
+        return (dxf_handle_to_string (mtext->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1985,7 +1957,7 @@ dxf_mtext_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mtext->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2020,7 +1992,7 @@ dxf_mtext_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->lineweight);
+        return (mtext->common.lineweight);
 }
 
 
@@ -2050,7 +2022,7 @@ dxf_mtext_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->lineweight = lineweight;
+        mtext->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2082,17 +2054,10 @@ dxf_mtext_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->plot_style_name));
+        return (dxf_handle_to_string (mtext->common.cold->plot_style_name));
 }
 
 
@@ -2130,7 +2095,7 @@ dxf_mtext_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->plot_style_name = strdup (plot_style_name);
+        mtext->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2165,7 +2130,7 @@ dxf_mtext_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->color_value);
+        return (mtext->common.color_value);
 }
 
 
@@ -2195,7 +2160,7 @@ dxf_mtext_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->color_value = color_value;
+        mtext->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2227,7 +2192,7 @@ dxf_mtext_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mtext->color_name ==  NULL)
+        if (mtext->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2237,7 +2202,7 @@ dxf_mtext_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mtext->color_name));
+        return (strdup (mtext->common.cold->color_name));
 }
 
 
@@ -2275,7 +2240,7 @@ dxf_mtext_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->color_name = strdup (color_name);
+        mtext->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2310,7 +2275,7 @@ dxf_mtext_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mtext->transparency);
+        return (mtext->common.cold->transparency);
 }
 
 
@@ -2340,7 +2305,7 @@ dxf_mtext_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->transparency = transparency;
+        mtext->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2389,6 +2354,10 @@ dxf_mtext_get_text_value
 /*!
  * \brief Set the \c text_value for a DXF \c MTEXT entity.
  *
+ * The text string is split into chunks of at most
+ * \c DXF_MTEXT_CHUNK_LENGTH characters, which are written as group 3
+ * codes followed by a final group 1 code.
+ *
  * \return a pointer to \c mtext when successful, or \c NULL when an
  * error occurred.
  */
@@ -2405,6 +2374,9 @@ dxf_mtext_set_text_value
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        size_t length;
+        size_t chunk_length;
+
         /* Do some basic checks. */
         if (mtext == NULL)
         {
@@ -2420,7 +2392,124 @@ dxf_mtext_set_text_value
                   __FUNCTION__);
                 return (NULL);
         }
-        mtext->text_value = strdup (text_value);
+        /* Discard the previous chunks, the storage is kept for reuse. */
+        mtext->text_length = 0;
+        mtext->number_of_text_chunks = 0;
+        if (mtext->text_value != NULL)
+        {
+                mtext->text_value[0] = '\0';
+        }
+        length = strlen (text_value);
+        /* Split the text string into chunks of at most
+         * DXF_MTEXT_CHUNK_LENGTH characters, the last (shorter) chunk
+         * is to be written as group 1. */
+        do
+        {
+                chunk_length = (length > DXF_MTEXT_CHUNK_LENGTH)
+                  ? DXF_MTEXT_CHUNK_LENGTH
+                  : length;
+                if (dxf_mtext_append_text_chunk (mtext, text_value, chunk_length) == NULL)
+                {
+                        return (NULL);
+                }
+                text_value += chunk_length;
+                length -= chunk_length;
+        }
+        while (length > 0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mtext);
+}
+
+
+/*!
+ * \brief Append a group 3 (or the final group 1) text chunk to the
+ * \c text_value of a DXF \c MTEXT entity.
+ *
+ * The chunk is copied at the end of the growable \c text_value buffer
+ * and the offset of the chunk is recorded, the buffer grows
+ * geometrically so appending \c n chunks costs amortized O(n).
+ *
+ * \return a pointer to \c mtext when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfMtext *
+dxf_mtext_append_text_chunk
+(
+        DxfMtext *mtext,
+                /*!< a pointer to a DXF \c MTEXT entity. */
+        const char *chunk,
+                /*!< a pointer to the characters of the chunk, need not
+                 * be terminated with a '\\0' character. */
+        size_t length
+                /*!< the number of characters in \c chunk. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *text_value;
+        size_t *text_chunk_offset;
+        size_t size;
+
+        /* Do some basic checks. */
+        if (mtext == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (chunk == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((mtext->text_value == NULL)
+          || (mtext->text_length + length + 1 > mtext->text_size))
+        {
+                size = (mtext->text_size > 0) ? mtext->text_size : 1;
+                while (mtext->text_length + length + 1 > size)
+                {
+                        size *= 2;
+                }
+                if ((text_value = realloc (mtext->text_value, size)) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                if (mtext->text_value == NULL)
+                {
+                        mtext->text_length = 0;
+                }
+                mtext->text_value = text_value;
+                mtext->text_size = size;
+        }
+        if (mtext->number_of_text_chunks >= mtext->text_chunk_offset_size)
+        {
+                size = (mtext->text_chunk_offset_size > 0)
+                  ? 2 * mtext->text_chunk_offset_size
+                  : 4;
+                if ((text_chunk_offset = realloc (mtext->text_chunk_offset, size * sizeof (size_t))) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                mtext->text_chunk_offset = text_chunk_offset;
+                mtext->text_chunk_offset_size = (int) size;
+        }
+        mtext->text_chunk_offset[mtext->number_of_text_chunks] = mtext->text_length;
+        mtext->number_of_text_chunks++;
+        memcpy (mtext->text_value + mtext->text_length, chunk, length);
+        mtext->text_length += length;
+        mtext->text_value[mtext->text_length] = '\0';
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2428,6 +2517,168 @@ dxf_mtext_set_text_value
 }
 
 
+/*!
+ * \brief Get the concatenated text string (all group 3 chunks followed
+ * by the group 1 chunk) from a DXF \c MTEXT entity.
+ *
+ * \return a pointer to the '\\0' terminated text string when
+ * sucessful, or \c NULL when an error occurred.
+ *
+ * \warning The returned pointer refers to the storage owned by
+ * \c mtext and is not copied, do not free it and do not use it after
+ * \c mtext is modified or freed.
+ */
+const char *
+dxf_mtext_get_text
+(
+        DxfMtext *mtext
+                /*!< a pointer to a DXF \c MTEXT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mtext == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (mtext->text_value ==  NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mtext->text_value);
+}
+
+
+/*!
+ * \brief Get the length of the concatenated text string from a DXF
+ * \c MTEXT entity.
+ *
+ * \return the number of characters in the text string, without the
+ * terminating '\\0' character.
+ */
+size_t
+dxf_mtext_get_text_length
+(
+        DxfMtext *mtext
+                /*!< a pointer to a DXF \c MTEXT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mtext == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mtext->text_length);
+}
+
+
+/*!
+ * \brief Get the number of text chunks (group 3 chunks plus the final
+ * group 1 chunk) stored in a DXF \c MTEXT entity.
+ *
+ * \return the number of text chunks, or \c -1 when an error occurred.
+ */
+int
+dxf_mtext_get_number_of_text_chunks
+(
+        DxfMtext *mtext
+                /*!< a pointer to a DXF \c MTEXT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mtext == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mtext->number_of_text_chunks);
+}
+
+
+/*!
+ * \brief Get the text chunk with index \c i from a DXF \c MTEXT
+ * entity.
+ *
+ * \return a pointer into the \c text_value buffer where the chunk
+ * starts, or \c NULL when an error occurred.\n
+ * The number of characters in the chunk is returned in \c length, the
+ * chunk itself is not terminated with a '\\0' character (with the
+ * exception of the last chunk).
+ */
+const char *
+dxf_mtext_get_text_chunk
+(
+        DxfMtext *mtext,
+                /*!< a pointer to a DXF \c MTEXT entity. */
+        int i,
+                /*!< index of the chunk (starting at 0). */
+        size_t *length
+                /*!< pointer to store the number of characters in the
+                 * chunk. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t end;
+
+        /* Do some basic checks. */
+        if (mtext == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((i < 0) || (i >= mtext->number_of_text_chunks))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range index was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        end = (i + 1 < mtext->number_of_text_chunks)
+          ? mtext->text_chunk_offset[i + 1]
+          : mtext->text_length;
+        if (length != NULL)
+        {
+                *length = end - mtext->text_chunk_offset[i];
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mtext->text_value + mtext->text_chunk_offset[i]);
+}
+
+
 /*!
  * \brief Get the \c text_style from a DXF \c MTEXT entity.
  *
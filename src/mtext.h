@@ -46,8 +46,12 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "point.h"
 #include "binary_graphics_data.h"
+#include "util.h"
 
 
 #ifdef __cplusplus
@@ -55,6 +59,11 @@ extern "C" {
 #endif
 
 
+#define DXF_MTEXT_CHUNK_LENGTH 250
+        /*!< \brief The maximum number of characters in a group 3 text
+         * chunk. */
+
+
 /*!
  * \brief DXF definition of an AutoCAD mtext entity (\c MTEXT).
  */
@@ -62,130 +71,9 @@ typedef struct
 dxf_mtext_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification code for the entity.\n
-                 * This is to be an unique sequential code in the DXF
-                 * file (the number can be hexadecimal).\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF mtext. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         char *text_value;
                 /*!< Text string.\n
                  * If the text string is less than 250 characters, all
@@ -195,11 +83,24 @@ dxf_mtext_struct
                  * which appear in one or more group 3 codes.\n
                  * If group 3 codes are used, the last group is a group
                  * 1 and has fewer than 250 characters.\n
-                 * Group code = 1. */
-        char *text_additional_value[DXF_MAX_PARAM];
-                /*!< Optional, only if the text string in group 1 is
-                 * greater than 250 characters.\n
-                 * Group code = 3. */
+                 * All chunks are stored in file order in this single
+                 * growable buffer, which is always terminated with a
+                 * '\\0' character, the concatenated string can thus be
+                 * used without copying.\n
+                 * Group codes = 3 and 1. */
+        size_t text_length;
+                /*!< Number of characters stored in \c text_value,
+                 * without the terminating '\\0' character. */
+        size_t text_size;
+                /*!< Number of bytes allocated for \c text_value. */
+        size_t *text_chunk_offset;
+                /*!< Offsets into \c text_value where each group 3 (or
+                 * the final group 1) chunk starts. */
+        int number_of_text_chunks;
+                /*!< Number of chunks stored in \c text_value. */
+        int text_chunk_offset_size;
+                /*!< Number of offsets allocated for
+                 * \c text_chunk_offset. */
         char *text_style;
                 /*!< Text style.\n
                  * Optional, defaults to \c STANDARD.\n
@@ -352,8 +253,9 @@ DxfMtext *dxf_mtext_read (DxfFile *fp, DxfMtext *mtext);
 int dxf_mtext_write (DxfFile *fp, DxfMtext *mtext);
 int dxf_mtext_free (DxfMtext *mtext);
 void dxf_mtext_free_list (DxfMtext *mtexts);
-int dxf_mtext_get_id_code (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_id_code (DxfMtext *mtext, int id_code);
+DxfMtext *dxf_mtext_copy (DxfMtext *mtext);
+DxfHandle dxf_mtext_get_id_code (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_id_code (DxfMtext *mtext, DxfHandle id_code);
 char *dxf_mtext_get_linetype (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_linetype (DxfMtext *mtext, char *linetype);
 char *dxf_mtext_get_layer (DxfMtext *mtext);
@@ -374,8 +276,8 @@ int dxf_mtext_get_graphics_data_size (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_graphics_data_size (DxfMtext *mtext, int graphics_data_size);
 int16_t dxf_mtext_get_shadow_mode (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_shadow_mode (DxfMtext *mtext, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_mtext_get_binary_graphics_data (DxfMtext *mtext);
-DxfMtext *dxf_mtext_set_binary_graphics_data (DxfMtext *mtext, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_mtext_get_binary_graphics_data (DxfMtext *mtext);
+DxfMtext *dxf_mtext_set_binary_graphics_data (DxfMtext *mtext, DxfBinaryBuffer *data);
 char *dxf_mtext_get_dictionary_owner_soft (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_dictionary_owner_soft (DxfMtext *mtext, char *dictionary_owner_soft);
 char *dxf_mtext_get_material (DxfMtext *mtext);
@@ -394,6 +296,11 @@ long dxf_mtext_get_transparency (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_transparency (DxfMtext *mtext, long transparency);
 char *dxf_mtext_get_text_value (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_text_value (DxfMtext *mtext, char *text_value);
+DxfMtext *dxf_mtext_append_text_chunk (DxfMtext *mtext, const char *chunk, size_t length);
+const char *dxf_mtext_get_text (DxfMtext *mtext);
+size_t dxf_mtext_get_text_length (DxfMtext *mtext);
+int dxf_mtext_get_number_of_text_chunks (DxfMtext *mtext);
+const char *dxf_mtext_get_text_chunk (DxfMtext *mtext, int i, size_t *length);
 char *dxf_mtext_get_text_style (DxfMtext *mtext);
 DxfMtext *dxf_mtext_set_text_style (DxfMtext *mtext, char *text_style);
 DxfPoint *dxf_mtext_get_p0 (DxfMtext *mtext);
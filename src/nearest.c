@@ -0,0 +1,673 @@
+/*!
+ * \file nearest.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for nearest entity queries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "nearest.h"
+
+
+#define DXF_NEAREST_TWO_PI (2.0 * M_PI)
+        /*!< \brief A full turn in radians. */
+
+
+/*!
+ * \brief Kinds of entries in the queue of a nearest entity search.
+ */
+typedef enum
+dxf_nearest_kind
+{
+        DXF_NEAREST_NODE,
+                /*!< A node of the R-tree, keyed on its box. */
+        DXF_NEAREST_BOX,
+                /*!< An item, keyed on its box. */
+        DXF_NEAREST_ITEM
+                /*!< An item, keyed on its exact distance. */
+} DxfNearestKind;
+
+
+/*!
+ * \brief Entry in the queue of a nearest entity search.
+ */
+typedef struct
+dxf_nearest_entry_struct
+{
+        double distance;
+                /*!< Key of the entry, never more than the distance to
+                 * the closest entity in it. */
+        DxfNearestKind kind;
+                /*!< Kind of the entry. */
+        int index;
+                /*!< Index in the nodes or items of the R-tree. */
+} DxfNearestEntry;
+
+
+/*!
+ * \brief Binary min-heap of queue entries.
+ */
+typedef struct
+dxf_nearest_queue_struct
+{
+        DxfNearestEntry *entries;
+                /*!< Heap ordered entries. */
+        int number_of_entries;
+                /*!< Number of entries. */
+        int size;
+                /*!< Number of allocated entries. */
+} DxfNearestQueue;
+
+
+/*!
+ * \brief Push an entry on a queue.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_nearest_queue_push
+(
+        DxfNearestQueue *queue,
+                /*!< the queue. */
+        double distance,
+                /*!< key of the entry. */
+        DxfNearestKind kind,
+                /*!< kind of the entry. */
+        int index
+                /*!< index of the entry. */
+)
+{
+        DxfNearestEntry *entries;
+        DxfNearestEntry entry;
+        int i;
+        int parent;
+
+        if (queue->number_of_entries == queue->size)
+        {
+                entries = realloc (queue->entries, 2 * (queue->size + 32) * sizeof (DxfNearestEntry));
+                if (entries == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                queue->entries = entries;
+                queue->size = 2 * (queue->size + 32);
+        }
+        entry.distance = distance;
+        entry.kind = kind;
+        entry.index = index;
+        i = queue->number_of_entries++;
+        while (i > 0)
+        {
+                parent = (i - 1) / 2;
+                if (queue->entries[parent].distance <= distance)
+                {
+                        break;
+                }
+                queue->entries[i] = queue->entries[parent];
+                i = parent;
+        }
+        queue->entries[i] = entry;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Pop the entry with the smallest key from a queue.
+ */
+static DxfNearestEntry
+dxf_nearest_queue_pop
+(
+        DxfNearestQueue *queue
+                /*!< the queue, not empty. */
+)
+{
+        DxfNearestEntry top;
+        DxfNearestEntry last;
+        int i;
+        int child;
+
+        top = queue->entries[0];
+        last = queue->entries[--queue->number_of_entries];
+        i = 0;
+        for (;;)
+        {
+                child = (2 * i) + 1;
+                if (child >= queue->number_of_entries)
+                {
+                        break;
+                }
+                if (((child + 1) < queue->number_of_entries)
+                  && (queue->entries[child + 1].distance < queue->entries[child].distance))
+                {
+                        child++;
+                }
+                if (last.distance <= queue->entries[child].distance)
+                {
+                        break;
+                }
+                queue->entries[i] = queue->entries[child];
+                i = child;
+        }
+        if (queue->number_of_entries > 0)
+        {
+                queue->entries[i] = last;
+        }
+        return (top);
+}
+
+
+/*!
+ * \brief Distance from a point to a box in the XY-plane.
+ */
+static double
+dxf_nearest_box_distance
+(
+        const DxfBoundingBox *box,
+                /*!< the box. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        double dx;
+        double dy;
+
+        dx = (x < box->min_x) ? (box->min_x - x) : ((x > box->max_x) ? (x - box->max_x) : 0.0);
+        dy = (y < box->min_y) ? (box->min_y - y) : ((y > box->max_y) ? (y - box->max_y) : 0.0);
+        return (sqrt ((dx * dx) + (dy * dy)));
+}
+
+
+/*!
+ * \brief Distance from a point to a line segment.
+ */
+static double
+dxf_nearest_segment_distance
+(
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1
+                /*!< Y-value of the end point. */
+)
+{
+        double dx;
+        double dy;
+        double length_squared;
+        double t;
+
+        dx = x1 - x0;
+        dy = y1 - y0;
+        length_squared = (dx * dx) + (dy * dy);
+        t = (length_squared > 0.0) ? ((((x - x0) * dx) + ((y - y0) * dy)) / length_squared) : 0.0;
+        t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+        return (hypot (x - (x0 + t * dx), y - (y0 + t * dy)));
+}
+
+
+/*!
+ * \brief Distance from a point to a circular arc.
+ *
+ * The arc runs counterclockwise from \c start to \c end, equal angles
+ * give a full circle.
+ */
+static double
+dxf_nearest_arc_distance
+(
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double center_x,
+                /*!< X-value of the center point. */
+        double center_y,
+                /*!< Y-value of the center point. */
+        double radius,
+                /*!< radius of the arc. */
+        double start,
+                /*!< start angle in radians. */
+        double end
+                /*!< end angle in radians. */
+)
+{
+        double sweep;
+        double delta;
+        double d0;
+        double d1;
+
+        radius = fabs (radius);
+        sweep = fmod (end - start, DXF_NEAREST_TWO_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += DXF_NEAREST_TWO_PI;
+        }
+        delta = fmod (atan2 (y - center_y, x - center_x) - start, DXF_NEAREST_TWO_PI);
+        if (delta < 0.0)
+        {
+                delta += DXF_NEAREST_TWO_PI;
+        }
+        if (delta <= sweep)
+        {
+                return (fabs (hypot (x - center_x, y - center_y) - radius));
+        }
+        /* Outside the sweep the closest point is an end point. */
+        d0 = hypot (x - (center_x + radius * cos (start)), y - (center_y + radius * sin (start)));
+        d1 = hypot (x - (center_x + radius * cos (end)), y - (center_y + radius * sin (end)));
+        return ((d0 < d1) ? d0 : d1);
+}
+
+
+/*!
+ * \brief Distance from a point to a polyline segment with a bulge.
+ */
+static double
+dxf_nearest_bulge_distance
+(
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge
+                /*!< bulge of the segment. */
+)
+{
+        double dx;
+        double dy;
+        double chord;
+        double height;
+        double radius;
+        double center_x;
+        double center_y;
+        double start;
+        double end;
+
+        dx = x1 - x0;
+        dy = y1 - y0;
+        chord = sqrt ((dx * dx) + (dy * dy));
+        if ((bulge == 0.0)
+          || (chord == 0.0))
+        {
+                return (dxf_nearest_segment_distance (x, y, x0, y0, x1, y1));
+        }
+        height = chord * (1.0 - (bulge * bulge)) / (4.0 * bulge);
+        radius = chord * (1.0 + (bulge * bulge)) / (4.0 * fabs (bulge));
+        center_x = 0.5 * (x0 + x1) - (dy / chord) * height;
+        center_y = 0.5 * (y0 + y1) + (dx / chord) * height;
+        start = atan2 (y0 - center_y, x0 - center_x);
+        end = atan2 (y1 - center_y, x1 - center_x);
+        if (bulge > 0.0)
+        {
+                return (dxf_nearest_arc_distance (x, y, center_x, center_y, radius, start, end));
+        }
+        return (dxf_nearest_arc_distance (x, y, center_x, center_y, radius, end, start));
+}
+
+
+/*!
+ * \brief Bring a query point in the Object Coordinate System of an
+ * entity.
+ *
+ * Only the default extrusion direction and its mirror image
+ * (0, 0, -1) are handled, a zero vector (left by the init functions
+ * when the extrusion direction is omitted) is the default.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE for any other
+ * extrusion direction.
+ */
+static int
+dxf_nearest_to_ocs
+(
+        double extr_x0,
+                /*!< X-value of the extrusion direction. */
+        double extr_y0,
+                /*!< Y-value of the extrusion direction. */
+        double extr_z0,
+                /*!< Z-value of the extrusion direction. */
+        double *x
+                /*!< X-value of the point, mirrored when needed. */
+)
+{
+        if ((extr_x0 != 0.0)
+          || (extr_y0 != 0.0))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (extr_z0 < 0.0)
+        {
+                *x = -*x;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the distance from a point to an entity in the XY-plane.
+ *
+ * Exact distances are computed for \c LINE, \c POINT, \c ARC,
+ * \c CIRCLE and \c LWPOLYLINE entities, including the bulged segments
+ * of a \c LWPOLYLINE.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * or extrusion direction is not supported or an error occurred.
+ */
+int
+dxf_nearest_get_distance
+(
+        DxfEntityType type,
+                /*!< type of entity. */
+        void *entity,
+                /*!< pointer to an entity of type \c type. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double *distance
+                /*!< receives the distance. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double d;
+        int n;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((entity == NULL)
+          || (distance == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case LINE:
+                {
+                        DxfLine *line = (DxfLine *) entity;
+                        double x0;
+                        double y0;
+                        double x1;
+                        double y1;
+                        double z;
+                        if (line->offsets != NULL)
+                        {
+                                dxf_point_offsets_get (line->offsets, 0, &x0, &y0, &z);
+                                dxf_point_offsets_get (line->offsets, 1, &x1, &y1, &z);
+                        }
+                        else if ((line->p0 != NULL) && (line->p1 != NULL))
+                        {
+                                x0 = line->p0->x0;
+                                y0 = line->p0->y0;
+                                x1 = line->p1->x0;
+                                y1 = line->p1->y0;
+                        }
+                        else
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        *distance = dxf_nearest_segment_distance (x, y, x0, y0, x1, y1);
+                        break;
+                }
+                case POINT:
+                {
+                        DxfPoint *point = (DxfPoint *) entity;
+                        *distance = hypot (x - point->x0, y - point->y0);
+                        break;
+                }
+                case ARC:
+                {
+                        DxfArc *arc = (DxfArc *) entity;
+                        if ((arc->p0 == NULL)
+                          || (dxf_nearest_to_ocs (arc->extr_x0, arc->extr_y0, arc->extr_z0, &x) == EXIT_FAILURE))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        *distance = dxf_nearest_arc_distance (x, y,
+                          arc->p0->x0, arc->p0->y0,
+                          dxf_arc_get_radius (arc),
+                          arc->start_angle * M_PI / 180.0,
+                          arc->end_angle * M_PI / 180.0);
+                        break;
+                }
+                case CIRCLE:
+                {
+                        DxfCircle *circle = (DxfCircle *) entity;
+                        if ((circle->p0 == NULL)
+                          || (dxf_nearest_to_ocs (circle->extr_x0, circle->extr_y0, circle->extr_z0, &x) == EXIT_FAILURE))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        *distance = fabs (hypot (x - circle->p0->x0, y - circle->p0->y0)
+                          - fabs (dxf_circle_get_radius (circle)));
+                        break;
+                }
+                case LWPOLYLINE:
+                {
+                        DxfLWPolyline *lwpolyline = (DxfLWPolyline *) entity;
+                        n = lwpolyline->number_vertices;
+                        if ((n == 0)
+                          || (dxf_nearest_to_ocs (lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0, &x) == EXIT_FAILURE))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        *distance = hypot (x - dxf_lwpolyline_get_vertex_x (lwpolyline, 0),
+                          y - dxf_lwpolyline_get_vertex_y (lwpolyline, 0));
+                        for (i = 0; i < n; i++)
+                        {
+                                j = i + 1;
+                                if (j == n)
+                                {
+                                        if (!(lwpolyline->flag & 1)) break;
+                                        j = 0;
+                                }
+                                d = dxf_nearest_bulge_distance (x, y,
+                                  dxf_lwpolyline_get_vertex_x (lwpolyline, i),
+                                  dxf_lwpolyline_get_vertex_y (lwpolyline, i),
+                                  dxf_lwpolyline_get_vertex_x (lwpolyline, j),
+                                  dxf_lwpolyline_get_vertex_y (lwpolyline, j),
+                                  (lwpolyline->bulge != NULL) ? lwpolyline->bulge[i] : 0.0);
+                                if (d < *distance)
+                                {
+                                        *distance = d;
+                                }
+                        }
+                        break;
+                }
+                default:
+                        return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the \c k entities closest to a point.
+ *
+ * Best first search through \c rtree: nodes and items are visited in
+ * the order of the distance to their box, an item is reported once its
+ * exact distance is the smallest left in the queue. Entities without an
+ * exact distance are reported on the distance to their box.\n
+ * \c rtree holds entity positions as items, see
+ * dxf_bounds_build_rtree ().
+ *
+ * \return the number of entities stored in \c nearest, closest first,
+ * or -1 when an error occurred.
+ */
+int
+dxf_nearest_search
+(
+        DxfRtree *rtree,
+                /*!< R-tree over the entities. */
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        int k,
+                /*!< maximum number of entities to find. */
+        double max_distance,
+                /*!< entities further away are skipped, a negative
+                 * value for no limit. */
+        DxfNearest *nearest
+                /*!< receives the entities, room for \c k results. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfNearestQueue queue;
+        DxfNearestEntry entry;
+        DxfRtreeNode *node;
+        DxfEntityType type;
+        void *entity;
+        double distance;
+        int position;
+        int count = 0;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL)
+          || (entities == NULL)
+          || (nearest == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((k <= 0)
+          || (rtree->root < 0))
+        {
+                return (0);
+        }
+        if (max_distance < 0.0)
+        {
+                max_distance = HUGE_VAL;
+        }
+        queue.entries = NULL;
+        queue.number_of_entries = 0;
+        queue.size = 0;
+        status = dxf_nearest_queue_push (&queue,
+          dxf_nearest_box_distance (&rtree->nodes[rtree->root].box, x, y),
+          DXF_NEAREST_NODE, rtree->root);
+        while ((status == EXIT_SUCCESS)
+          && (queue.number_of_entries > 0)
+          && (count < k))
+        {
+                entry = dxf_nearest_queue_pop (&queue);
+                if (entry.distance > max_distance)
+                {
+                        break;
+                }
+                switch (entry.kind)
+                {
+                        case DXF_NEAREST_NODE:
+                                node = &rtree->nodes[entry.index];
+                                for (i = node->first; (status == EXIT_SUCCESS) && (i < (node->first + node->count)); i++)
+                                {
+                                        if (node->level > 0)
+                                        {
+                                                status = dxf_nearest_queue_push (&queue,
+                                                  dxf_nearest_box_distance (&rtree->nodes[i].box, x, y),
+                                                  DXF_NEAREST_NODE, i);
+                                        }
+                                        else
+                                        {
+                                                status = dxf_nearest_queue_push (&queue,
+                                                  dxf_nearest_box_distance (&rtree->item_boxes[i], x, y),
+                                                  DXF_NEAREST_BOX, i);
+                                        }
+                                }
+                                break;
+                        case DXF_NEAREST_BOX:
+                                entity = dxf_entities_get_entity (entities, rtree->items[entry.index], &type);
+                                distance = entry.distance;
+                                if (entity != NULL)
+                                {
+                                        dxf_nearest_get_distance (type, entity, x, y, &distance);
+                                }
+                                /* The box distance is a lower bound, never
+                                 * go below it on rounding. */
+                                if (distance < entry.distance)
+                                {
+                                        distance = entry.distance;
+                                }
+                                status = dxf_nearest_queue_push (&queue, distance, DXF_NEAREST_ITEM, entry.index);
+                                break;
+                        case DXF_NEAREST_ITEM:
+                                position = rtree->items[entry.index];
+                                nearest[count].position = position;
+                                nearest[count].entity = dxf_entities_get_entity (entities, position, &nearest[count].type);
+                                nearest[count].distance = entry.distance;
+                                count++;
+                                break;
+                }
+        }
+        free (queue.entries);
+        if (status == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (count);
+}
+
+
+/* EOF */
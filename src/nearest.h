@@ -0,0 +1,80 @@
+/*!
+ * \file nearest.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for nearest entity queries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_NEAREST_H
+#define LIBDXF_SRC_NEAREST_H
+
+
+#include "global.h"
+#include "entities.h"
+#include "rtree.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Result of a nearest entity query.
+ */
+typedef struct
+dxf_nearest_struct
+{
+        int position;
+                /*!< Position of the entity in the \c ENTITIES
+                 * section. */
+        DxfEntityType type;
+                /*!< Type of the entity. */
+        void *entity;
+                /*!< Pointer to the entity. */
+        double distance;
+                /*!< Distance from the query point to the entity. */
+} DxfNearest;
+
+
+int dxf_nearest_get_distance (DxfEntityType type, void *entity, double x, double y, double *distance);
+int dxf_nearest_search (DxfRtree *rtree, DxfEntities *entities, double x, double y, int k, double max_distance, DxfNearest *nearest);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_NEAREST_H */
+
+
+/* EOF */
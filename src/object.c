@@ -210,6 +210,7 @@ dxf_object_free_list
         while (objects != NULL)
         {
                 DxfObject *iter = (DxfObject *) objects->next;
+                objects->next = NULL;
                 dxf_object_free (objects);
                 objects = (DxfObject *) iter;
         }
@@ -179,6 +179,7 @@ dxf_object_id_free_list
         while (object_ids != NULL)
         {
                 DxfObjectId *iter = (DxfObjectId *) object_ids->next;
+                object_ids->next = NULL;
                 dxf_object_id_free (object_ids);
                 object_ids = (DxfObjectId *) iter;
         }
@@ -188,6 +189,77 @@ dxf_object_id_free_list
 }
 
 
+/*!
+ * \brief Copy a single linked list of DxfObjectId objects.
+ *
+ * The copy does not share any memory with \c object_ids.
+ *
+ * \return a pointer to the first item of the copy, or \c NULL when an
+ * error occurred.
+ */
+DxfObjectId *
+dxf_object_id_copy_list
+(
+        DxfObjectId *object_ids
+                /*!< a pointer to the single linked list of DxfObjectId
+                 * objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfObjectId *first = NULL;
+        DxfObjectId *last = NULL;
+        DxfObjectId *copy;
+
+        /* Do some basic checks. */
+        if (object_ids == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (; object_ids != NULL; object_ids = (DxfObjectId *) object_ids->next)
+        {
+                copy = dxf_object_id_new ();
+                if (copy != NULL)
+                {
+                        memcpy (copy, object_ids, sizeof (DxfObjectId));
+                        copy->data = NULL;
+                        copy->next = NULL;
+                }
+                if ((copy == NULL)
+                  || ((object_ids->data != NULL)
+                  && ((copy->data = strdup (object_ids->data)) == NULL)))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (copy);
+                        if (first != NULL)
+                        {
+                                dxf_object_id_free_list (first);
+                        }
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        first = copy;
+                }
+                else
+                {
+                        last->next = (struct DxfObjectId *) copy;
+                }
+                last = copy;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
 /*!
  * \brief Get the \c group_code from a DXF \c object_id.
  *
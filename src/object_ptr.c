@@ -112,8 +112,8 @@ dxf_object_ptr_init
                 return (NULL);
         }
         object_ptr->id_code = 0;
-        object_ptr->dictionary_owner_soft = strdup ("");
-        object_ptr->dictionary_owner_hard = strdup ("");
+        object_ptr->dictionary_owner_soft = DXF_HANDLE_NONE;
+        object_ptr->dictionary_owner_hard = DXF_HANDLE_NONE;
         object_ptr->xdata->value = NULL;
         object_ptr->xdata->length = 0;
         object_ptr->xdata->next = NULL;
@@ -191,22 +191,19 @@ dxf_object_ptr_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &object_ptr->id_code);
+                        object_ptr->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->dictionary_owner_soft);
+                        object_ptr->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->dictionary_owner_hard);
+                        object_ptr->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -282,14 +279,14 @@ dxf_object_ptr_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, object_ptr->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (object_ptr->id_code != -1)
+        if (object_ptr->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", object_ptr->id_code);
+                dxf_handle_write (fp, 5, object_ptr->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -301,18 +298,18 @@ dxf_object_ptr_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (object_ptr->dictionary_owner_soft, "") != 0)
+        if ((object_ptr->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", object_ptr->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, object_ptr->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (object_ptr->dictionary_owner_hard, "") != 0)
+        if ((object_ptr->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", object_ptr->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, object_ptr->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         while (object_ptr->xdata->value != NULL)
@@ -364,8 +361,6 @@ dxf_object_ptr_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object_ptr->dictionary_owner_soft);
-        free (object_ptr->dictionary_owner_hard);
         while (object_ptr->xdata->value != NULL)
         {
                 iter = (struct DxfChar *) object_ptr->xdata->next;
@@ -411,6 +406,7 @@ dxf_object_ptr_free_list
         while (objectptrs != NULL)
         {
                 DxfObjectPtr *iter = (DxfObjectPtr *) objectptrs->next;
+                objectptrs->next = NULL;
                 dxf_object_ptr_free (objectptrs);
                 objectptrs = (DxfObjectPtr *) iter;
         }
@@ -425,7 +421,7 @@ dxf_object_ptr_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_object_ptr_get_id_code
 (
         DxfObjectPtr *object_ptr
@@ -443,13 +439,6 @@ dxf_object_ptr_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (object_ptr->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -465,7 +454,7 @@ dxf_object_ptr_set_id_code
 (
         DxfObjectPtr *object_ptr,
                 /*!< a pointer to a DXF \c OBJECT_PTR object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -482,13 +471,6 @@ dxf_object_ptr_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         object_ptr->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -523,17 +505,10 @@ dxf_object_ptr_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_ptr->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_soft));
+        return (dxf_handle_to_string (object_ptr->dictionary_owner_soft));
 }
 
 
@@ -569,7 +544,7 @@ dxf_object_ptr_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        object_ptr->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -603,17 +578,10 @@ dxf_object_ptr_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (object_ptr->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_hard));
+        return (dxf_handle_to_string (object_ptr->dictionary_owner_hard));
 }
 
 
@@ -649,7 +617,7 @@ dxf_object_ptr_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        object_ptr->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -60,15 +61,15 @@ typedef struct
 dxf_object_ptr_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF object_ptr. */
@@ -87,8 +88,8 @@ DxfObjectPtr *dxf_object_ptr_read (DxfFile *fp, DxfObjectPtr *object_ptr);
 int dxf_object_ptr_write (DxfFile *fp, DxfObjectPtr *object_ptr);
 int dxf_object_ptr_free (DxfObjectPtr *object_ptr);
 void dxf_object_ptr_free_list (DxfObjectPtr *objectptrs);
-int dxf_object_ptr_get_id_code (DxfObjectPtr *object_ptr);
-DxfObjectPtr *dxf_object_ptr_set_id_code (DxfObjectPtr *object_ptr, int id_code);
+DxfHandle dxf_object_ptr_get_id_code (DxfObjectPtr *object_ptr);
+DxfObjectPtr *dxf_object_ptr_set_id_code (DxfObjectPtr *object_ptr, DxfHandle id_code);
 char *dxf_object_ptr_get_dictionary_owner_soft (DxfObjectPtr *object_ptr);
 DxfObjectPtr *dxf_object_ptr_set_dictionary_owner_soft (DxfObjectPtr *object_ptr, char *dictionary_owner_soft);
 char *dxf_object_ptr_get_dictionary_owner_hard (DxfObjectPtr *object_ptr);
@@ -42,6 +42,7 @@
 
 
 #include "ole2frame.h"
+#include "entities.h"
 
 
 /*!
@@ -111,17 +112,13 @@ dxf_ole2frame_init
                 __FUNCTION__);
               return (NULL);
         }
-        ole2frame->id_code = 0;
-        ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
-        ole2frame->elevation = 0.0;
-        ole2frame->thickness = 0.0;
-        ole2frame->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        ole2frame->visibility = DXF_DEFAULT_VISIBILITY;
-        ole2frame->color = DXF_COLOR_BYLAYER;
-        ole2frame->paperspace = DXF_MODELSPACE;
-        ole2frame->dictionary_owner_soft = strdup ("");
-        ole2frame->dictionary_owner_hard = strdup ("");
+        if (dxf_entity_common_init (&ole2frame->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         ole2frame->end_of_data = strdup ("OLE");
         ole2frame->length_of_binary_data = strdup ("");
         dxf_ole2frame_set_p0 (ole2frame, dxf_point_new ());
@@ -138,11 +135,8 @@ dxf_ole2frame_init
         ole2frame->ole_object_type = 0;
         ole2frame->tilemode_descriptor = 0;
         ole2frame->length = 0;
-        ole2frame->binary_data = dxf_char_new ();
-        ole2frame->binary_data = dxf_char_init (ole2frame->binary_data);
-        ole2frame->binary_data->value = strdup ("");
-        ole2frame->binary_data->length = 0;
-        ole2frame->binary_data->next = NULL;
+        ole2frame->binary_data = dxf_binary_buffer_new ();
+        ole2frame->binary_data = dxf_binary_buffer_init (ole2frame->binary_data);
         ole2frame->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -174,8 +168,9 @@ dxf_ole2frame_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfChar *iter = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -183,8 +178,6 @@ dxf_ole2frame_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ole2frame == NULL)
@@ -192,238 +185,126 @@ dxf_ole2frame_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                ole2frame = dxf_ole2frame_init (ole2frame);
+                ole2frame = dxf_ole2frame_init (dxf_ole2frame_new ());
+                if (ole2frame == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter = (DxfChar *) ole2frame->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a End of Ole
-                         * data marker. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "OLE") != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing the length of
-                         * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->length_of_binary_data);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &ole2frame->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ole2frame->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ole2frame->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the ole
-                         * version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->ole_version_number);
+                        break;
                 }
-                else if (strcmp (temp_string, "71") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the ole
-                         * object type. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->ole_object_type);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the tilemode
-                         * descriptor. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ole2frame->tilemode_descriptor);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the length of
-                         * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &ole2frame->length);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbOle2Frame") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 1:
+                                /* End of OLE data marker. */
+                                if (strcmp (value, "OLE") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 3:
+                                free (ole2frame->length_of_binary_data);
+                                ole2frame->length_of_binary_data = strdup (value);
+                                break;
+                        case 10:
+                                ole2frame->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                ole2frame->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                ole2frame->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                ole2frame->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                ole2frame->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                ole2frame->p1->z0 = atof (value);
+                                break;
+                        case 70:
+                                ole2frame->ole_version_number = atoi (value);
+                                break;
+                        case 71:
+                                ole2frame->ole_object_type = atoi (value);
+                                break;
+                        case 72:
+                                ole2frame->tilemode_descriptor = atoi (value);
+                                break;
+                        case 90:
+                                ole2frame->length = atol (value);
+                                /* Make room for all binary data at once. */
+                                if (ole2frame->length > 0)
+                                {
+                                        dxf_binary_buffer_reserve (ole2frame->binary_data, (size_t) ole2frame->length);
+                                }
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbOle2Frame") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 310:
+                                /* Binary data is decoded straight into
+                                 * the buffer. */
+                                dxf_binary_buffer_append_hex (ole2frame->binary_data, value, strlen (value));
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &ole2frame->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (ole2frame->linetype, "") == 0)
+        if ((ole2frame->common.linetype == NULL)
+          || (strcmp (ole2frame->common.linetype, "") == 0))
         {
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (ole2frame->common.linetype);
+                ole2frame->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ole2frame->layer, "") == 0)
+        if ((ole2frame->common.layer == NULL)
+          || (strcmp (ole2frame->common.layer, "") == 0))
         {
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                free (ole2frame->common.layer);
+                ole2frame->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -450,7 +331,6 @@ dxf_ole2frame_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("OLE2FRAME");
-        DxfChar *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -477,31 +357,31 @@ dxf_ole2frame_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (ole2frame->linetype, "") == 0)
+        if (strcmp (ole2frame->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ole2frame->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ole2frame->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ole2frame->layer, "") == 0)
+        if (strcmp (ole2frame->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ole2frame->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ole2frame->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ole2frame->id_code != -1)
+        if (ole2frame->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ole2frame->id_code);
+                dxf_handle_write (fp, 5, ole2frame->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -513,58 +393,58 @@ dxf_ole2frame_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ole2frame->dictionary_owner_soft, "") != 0)
+        if ((ole2frame->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ole2frame->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, ole2frame->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (ole2frame->dictionary_owner_hard, "") != 0)
+        if ((ole2frame->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ole2frame->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, ole2frame->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (ole2frame->paperspace == DXF_PAPERSPACE)
+        if (ole2frame->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ole2frame->layer);
-        if (strcmp (ole2frame->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", ole2frame->common.layer);
+        if (strcmp (ole2frame->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", ole2frame->linetype);
+                fprintf (fp->fp, "  6\n%s\n", ole2frame->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (ole2frame->elevation != 0.0))
+          && (ole2frame->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ole2frame->elevation);
+                fprintf (fp->fp, " 38\n%f\n", ole2frame->common.elevation);
         }
-        if (ole2frame->color != DXF_COLOR_BYLAYER)
+        if (ole2frame->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", ole2frame->color);
+                fprintf (fp->fp, " 62\n%hd\n", ole2frame->common.color);
         }
-        if (ole2frame->linetype_scale != 1.0)
+        if (ole2frame->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ole2frame->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", ole2frame->common.linetype_scale);
         }
-        if (ole2frame->visibility != 0)
+        if (ole2frame->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", ole2frame->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", ole2frame->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbOle2Frame\n");
         }
-        if (ole2frame->thickness != 0.0)
+        if (ole2frame->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", ole2frame->thickness);
+                fprintf (fp->fp, " 39\n%f\n", ole2frame->common.thickness);
         }
         fprintf (fp->fp, " 70\n%d\n", ole2frame->ole_version_number);
         fprintf (fp->fp, "  3\n%s\n", ole2frame->length_of_binary_data);
@@ -577,20 +457,17 @@ dxf_ole2frame_write
         fprintf (fp->fp, " 71\n%d\n", ole2frame->ole_object_type);
         fprintf (fp->fp, " 72\n%d\n", ole2frame->tilemode_descriptor);
         fprintf (fp->fp, " 90\n%ld\n", ole2frame->length);
-        if (ole2frame->binary_data != NULL)
+        if ((ole2frame->binary_data != NULL)
+          && (ole2frame->binary_data->length > 0))
         {
-                iter = (DxfChar*) ole2frame->binary_data;
-                while ((iter != NULL) && (iter->value != NULL))
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter->value);
-                        iter = (DxfChar*) iter->next;
-                }
+                dxf_binary_buffer_write (fp, 310, ole2frame->binary_data);
         }
         else
         {
                 fprintf (fp->fp, "310\n\n");
         }
         fprintf (fp->fp, "  1\nOLE\n");
+        dxf_entity_common_write_xdata (fp, &ole2frame->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -635,14 +512,10 @@ dxf_ole2frame_free
         }
         free (ole2frame->end_of_data);
         free (ole2frame->length_of_binary_data);
-        free (ole2frame->linetype);
-        free (ole2frame->layer);
-        free (ole2frame->dictionary_owner_soft);
-        free (ole2frame->dictionary_owner_hard);
-        free (ole2frame->binary_data->value);
-        /*! \todo Needs a proper implementation. */
-        free (ole2frame->binary_data);
-        /*! \todo Needs a proper implementation. */
+        dxf_entity_common_free (&ole2frame->common);
+        dxf_point_free (ole2frame->p0);
+        dxf_point_free (ole2frame->p1);
+        dxf_binary_buffer_free (ole2frame->binary_data);
         free (ole2frame);
         ole2frame = NULL;
 #if DEBUG
@@ -676,6 +549,7 @@ dxf_ole2frame_free_list
         while (ole2frames != NULL)
         {
                 DxfOle2Frame *iter = (DxfOle2Frame *) ole2frames->next;
+                ole2frames->next = NULL;
                 dxf_ole2frame_free (ole2frames);
                 ole2frames = (DxfOle2Frame *) iter;
         }
@@ -686,39 +560,142 @@ dxf_ole2frame_free_list
 
 
 /*!
- * \brief Get the \c id_code from a DXF \c OLE2FRAME entity.
+ * \brief Copy a DXF \c OLE2FRAME entity.
  *
- * \return \c id_code.
+ * The copy does not share any memory with \c ole2frame, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
  */
-int
-dxf_ole2frame_get_id_code
+DxfOle2Frame *
+dxf_ole2frame_copy
 (
         DxfOle2Frame *ole2frame
-                /*!< a pointer to a DXF \c OLE2FRAME entity. */
+                /*!< a pointer to the DXF \c OLE2FRAME entity to copy. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfOle2Frame *copy;
+
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
+        }
+        copy = dxf_ole2frame_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, ole2frame, sizeof (DxfOle2Frame));
+        copy->end_of_data = NULL;
+        copy->length_of_binary_data = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->binary_data = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &ole2frame->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_ole2frame_free (copy);
+                return (NULL);
+        }
+        if (ole2frame->end_of_data != NULL)
+        {
+                copy->end_of_data = strdup (ole2frame->end_of_data);
+                if (copy->end_of_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_ole2frame_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ole2frame->length_of_binary_data != NULL)
+        {
+                copy->length_of_binary_data = strdup (ole2frame->length_of_binary_data);
+                if (copy->length_of_binary_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_ole2frame_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ole2frame->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (ole2frame->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_ole2frame_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ole2frame->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (ole2frame->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_ole2frame_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ole2frame->binary_data != NULL)
+        {
+                copy->binary_data = dxf_binary_buffer_copy (ole2frame->binary_data);
+                if (copy->binary_data == NULL)
+                {
+                        dxf_ole2frame_free (copy);
+                        return (NULL);
+                }
         }
-        if (ole2frame->id_code < 0)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Get the \c id_code from a DXF \c OLE2FRAME entity.
+ *
+ * \return \c id_code.
+ */
+DxfHandle
+dxf_ole2frame_get_id_code
+(
+        DxfOle2Frame *ole2frame
+                /*!< a pointer to a DXF \c OLE2FRAME entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (ole2frame == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a negative value was found.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->id_code);
+        return (ole2frame->common.id_code);
 }
 
 
@@ -730,7 +707,7 @@ dxf_ole2frame_set_id_code
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -747,14 +724,7 @@ dxf_ole2frame_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ole2frame->id_code = id_code;
+        ole2frame->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -785,7 +755,7 @@ dxf_ole2frame_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->linetype ==  NULL)
+        if (ole2frame->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -795,7 +765,7 @@ dxf_ole2frame_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->linetype));
+        return (strdup (ole2frame->common.linetype));
 }
 
 
@@ -829,7 +799,7 @@ dxf_ole2frame_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->linetype = strdup (linetype);
+        ole2frame->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -860,7 +830,7 @@ dxf_ole2frame_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->layer ==  NULL)
+        if (ole2frame->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -870,7 +840,7 @@ dxf_ole2frame_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->layer));
+        return (strdup (ole2frame->common.layer));
 }
 
 
@@ -904,7 +874,7 @@ dxf_ole2frame_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->layer = strdup (layer);
+        ole2frame->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -938,7 +908,7 @@ dxf_ole2frame_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->elevation);
+        return (ole2frame->common.elevation);
 }
 
 
@@ -965,7 +935,7 @@ dxf_ole2frame_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->elevation = elevation;
+        ole2frame->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -996,7 +966,7 @@ dxf_ole2frame_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->thickness < 0.0)
+        if (ole2frame->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1005,7 +975,7 @@ dxf_ole2frame_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->thickness);
+        return (ole2frame->common.thickness);
 }
 
 
@@ -1039,7 +1009,7 @@ dxf_ole2frame_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->thickness = thickness;
+        ole2frame->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1070,7 +1040,7 @@ dxf_ole2frame_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->linetype_scale < 0.0)
+        if (ole2frame->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1079,7 +1049,7 @@ dxf_ole2frame_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->linetype_scale);
+        return (ole2frame->common.linetype_scale);
 }
 
 
@@ -1112,7 +1082,7 @@ dxf_ole2frame_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        ole2frame->linetype_scale = linetype_scale;
+        ole2frame->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1143,13 +1113,13 @@ dxf_ole2frame_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->visibility < 0)
+        if (ole2frame->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ole2frame->visibility > 1)
+        if (ole2frame->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1158,7 +1128,7 @@ dxf_ole2frame_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->visibility);
+        return (ole2frame->common.visibility);
 }
 
 
@@ -1197,7 +1167,7 @@ dxf_ole2frame_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        ole2frame->visibility = visibility;
+        ole2frame->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1228,7 +1198,7 @@ dxf_ole2frame_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->color < 0)
+        if (ole2frame->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1237,7 +1207,7 @@ dxf_ole2frame_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->color);
+        return (ole2frame->common.color);
 }
 
 
@@ -1270,7 +1240,7 @@ dxf_ole2frame_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        ole2frame->color = color;
+        ole2frame->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1301,13 +1271,13 @@ dxf_ole2frame_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->paperspace < 0)
+        if (ole2frame->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ole2frame->paperspace > 1)
+        if (ole2frame->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1316,7 +1286,7 @@ dxf_ole2frame_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->paperspace);
+        return (ole2frame->common.paperspace);
 }
 
 
@@ -1355,7 +1325,7 @@ dxf_ole2frame_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        ole2frame->paperspace = paperspace;
+        ole2frame->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1388,13 +1358,13 @@ dxf_ole2frame_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->graphics_data_size < 0)
+        if (ole2frame->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ole2frame->graphics_data_size == 0)
+        if (ole2frame->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1403,7 +1373,7 @@ dxf_ole2frame_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->graphics_data_size);
+        return (ole2frame->common.cold->graphics_data_size);
 }
 
 
@@ -1448,7 +1418,7 @@ dxf_ole2frame_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        ole2frame->graphics_data_size = graphics_data_size;
+        ole2frame->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1480,13 +1450,13 @@ dxf_ole2frame_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ole2frame->shadow_mode < 0)
+        if (ole2frame->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ole2frame->shadow_mode > 3)
+        if (ole2frame->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1495,7 +1465,7 @@ dxf_ole2frame_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->shadow_mode);
+        return (ole2frame->common.cold->shadow_mode);
 }
 
 
@@ -1537,7 +1507,7 @@ dxf_ole2frame_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        ole2frame->shadow_mode = shadow_mode;
+        ole2frame->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1549,11 +1519,12 @@ dxf_ole2frame_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c OLE2FRAME entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_ole2frame_get_binary_graphics_data
 (
         DxfOle2Frame *ole2frame
@@ -1571,32 +1542,31 @@ dxf_ole2frame_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) ole2frame->binary_graphics_data);
+        return (ole2frame->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c OLE2FRAME entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c ole2frame when successful, or \c NULL when an
+ * error occurred.
  */
 DxfOle2Frame *
 dxf_ole2frame_set_binary_graphics_data
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1617,7 +1587,12 @@ dxf_ole2frame_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((ole2frame->common.cold->binary_graphics_data != NULL)
+          && (ole2frame->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (ole2frame->common.cold->binary_graphics_data);
+        }
+        ole2frame->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1651,17 +1626,10 @@ dxf_ole2frame_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_soft));
+        return (dxf_handle_to_string (ole2frame->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1697,7 +1665,7 @@ dxf_ole2frame_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ole2frame->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1732,17 +1700,10 @@ dxf_ole2frame_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->material));
+        return (dxf_handle_to_string (ole2frame->common.cold->material));
 }
 
 
@@ -1781,7 +1742,7 @@ dxf_ole2frame_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->material = strdup (material);
+        ole2frame->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1815,17 +1776,10 @@ dxf_ole2frame_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_hard));
+        return (dxf_handle_to_string (ole2frame->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1861,7 +1815,7 @@ dxf_ole2frame_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ole2frame->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1896,7 +1850,7 @@ dxf_ole2frame_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->lineweight);
+        return (ole2frame->common.lineweight);
 }
 
 
@@ -1926,7 +1880,7 @@ dxf_ole2frame_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->lineweight = lineweight;
+        ole2frame->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1958,17 +1912,10 @@ dxf_ole2frame_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->plot_style_name));
+        return (dxf_handle_to_string (ole2frame->common.cold->plot_style_name));
 }
 
 
@@ -2006,7 +1953,7 @@ dxf_ole2frame_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->plot_style_name = strdup (plot_style_name);
+        ole2frame->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2041,7 +1988,7 @@ dxf_ole2frame_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->color_value);
+        return (ole2frame->common.color_value);
 }
 
 
@@ -2071,7 +2018,7 @@ dxf_ole2frame_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->color_value = color_value;
+        ole2frame->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2103,7 +2050,7 @@ dxf_ole2frame_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ole2frame->color_name ==  NULL)
+        if (ole2frame->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2113,7 +2060,7 @@ dxf_ole2frame_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->color_name));
+        return (strdup (ole2frame->common.cold->color_name));
 }
 
 
@@ -2151,7 +2098,7 @@ dxf_ole2frame_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->color_name = strdup (color_name);
+        ole2frame->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2186,7 +2133,7 @@ dxf_ole2frame_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ole2frame->transparency);
+        return (ole2frame->common.cold->transparency);
 }
 
 
@@ -2216,7 +2163,7 @@ dxf_ole2frame_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->transparency = transparency;
+        ole2frame->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3346,7 +3293,7 @@ dxf_ole2frame_set_length
  *
  * \warning No deep copy is made of the \c binary_data.
  */
-DxfChar *
+DxfBinaryBuffer *
 dxf_ole2frame_get_binary_data
 (
         DxfOle2Frame *ole2frame
@@ -3391,7 +3338,7 @@ dxf_ole2frame_set_binary_data
 (
         DxfOle2Frame *ole2frame,
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
-        DxfChar *binary_data
+        DxfBinaryBuffer *binary_data
                 /*!< a string containing the \c binary_data for the
                  * entity. */
 )
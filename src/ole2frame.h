@@ -46,8 +46,11 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "util.h"
 #include "point.h"
+#include "binary_data.h"
 #include "binary_graphics_data.h"
 
 
@@ -63,124 +66,9 @@ typedef struct
 dxf_ole2frame_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible.</li>
-                 * <li value = "1"> Invisible.</li>
-                 * </ol>
-                 * Group code = 60. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF ole2frame. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         char *end_of_data;
                 /*!< End of Ole data (the string "OLE").\n
                  * Group code = 1.  */
@@ -211,9 +99,10 @@ dxf_ole2frame_struct
         long length;
                 /*!< group code = 90\n
                  * Length of binary data.\n */
-        DxfChar *binary_data;
+        DxfBinaryBuffer *binary_data;
                 /*!< group code = 310\n
-                 * Binary data (multiple lines).*/
+                 * Binary data (multiple lines), decoded into one
+                 * contiguous buffer of bytes.*/
         struct DxfOle2Frame *next;
                 /*!< pointer to the next DxfOle2Frame.\n
                  * \c NULL in the last DxfOle2Frame. */
@@ -226,8 +115,9 @@ DxfOle2Frame *dxf_ole2frame_read (DxfFile *fp, DxfOle2Frame *ole2frame);
 int dxf_ole2frame_write (DxfFile *fp, DxfOle2Frame *ole2frame);
 int dxf_ole2frame_free (DxfOle2Frame *ole2frame);
 void dxf_ole2frame_free_list (DxfOle2Frame *ole2frames);
-int dxf_ole2frame_get_id_code (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_id_code (DxfOle2Frame *ole2frame, int id_code);
+DxfOle2Frame *dxf_ole2frame_copy (DxfOle2Frame *ole2frame);
+DxfHandle dxf_ole2frame_get_id_code (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_id_code (DxfOle2Frame *ole2frame, DxfHandle id_code);
 char *dxf_ole2frame_get_linetype (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_linetype (DxfOle2Frame *ole2frame, char *linetype);
 char *dxf_ole2frame_get_layer (DxfOle2Frame *ole2frame);
@@ -248,8 +138,8 @@ int dxf_ole2frame_get_graphics_data_size (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_graphics_data_size (DxfOle2Frame *ole2frame, int graphics_data_size);
 int16_t dxf_ole2frame_get_shadow_mode (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_shadow_mode (DxfOle2Frame *ole2frame, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_ole2frame_get_binary_graphics_data (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_binary_graphics_data (DxfOle2Frame *ole2frame, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_ole2frame_get_binary_graphics_data (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_binary_graphics_data (DxfOle2Frame *ole2frame, DxfBinaryBuffer *data);
 char *dxf_ole2frame_get_dictionary_owner_soft (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_dictionary_owner_soft (DxfOle2Frame *ole2frame, char *dictionary_owner_soft);
 char *dxf_ole2frame_get_material (DxfOle2Frame *ole2frame);
@@ -294,8 +184,8 @@ int dxf_ole2frame_get_tilemode_descriptor (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_tilemode_descriptor (DxfOle2Frame *ole2frame, int tilemode_descriptor);
 long dxf_ole2frame_get_length (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_length (DxfOle2Frame *ole2frame, long length);
-DxfChar *dxf_ole2frame_get_binary_data (DxfOle2Frame *ole2frame);
-DxfOle2Frame *dxf_ole2frame_set_binary_data (DxfOle2Frame *ole2frame, DxfChar *binary_data);
+DxfBinaryBuffer *dxf_ole2frame_get_binary_data (DxfOle2Frame *ole2frame);
+DxfOle2Frame *dxf_ole2frame_set_binary_data (DxfOle2Frame *ole2frame, DxfBinaryBuffer *binary_data);
 DxfOle2Frame *dxf_ole2frame_get_next (DxfOle2Frame *ole2frame);
 DxfOle2Frame *dxf_ole2frame_set_next (DxfOle2Frame *ole2frame, DxfOle2Frame *next);
 DxfOle2Frame *dxf_ole2frame_get_last (DxfOle2Frame *ole2frame);
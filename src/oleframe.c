@@ -40,6 +40,7 @@
 
 
 #include "oleframe.h"
+#include "entities.h"
 
 
 /*!
@@ -109,24 +110,16 @@ dxf_oleframe_init
                 __FUNCTION__);
               return (NULL);
         }
-        oleframe->id_code = 0;
-        oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        oleframe->layer = strdup (DXF_DEFAULT_LAYER);
-        oleframe->elevation = 0.0;
-        oleframe->thickness = 0.0;
-        oleframe->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        oleframe->visibility = DXF_DEFAULT_VISIBILITY;
-        oleframe->color = DXF_COLOR_BYLAYER;
-        oleframe->paperspace = DXF_MODELSPACE;
-        oleframe->dictionary_owner_soft = strdup ("");
-        oleframe->dictionary_owner_hard = strdup ("");
+        if (dxf_entity_common_init (&oleframe->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         oleframe->ole_version_number = 1;
         oleframe->length = 0;
-        oleframe->binary_data = dxf_char_new ();
-        oleframe->binary_data = dxf_char_init (oleframe->binary_data);
-        oleframe->binary_data->value = strdup ("");
-        oleframe->binary_data->length = 0;
-        oleframe->binary_data->next = NULL;
+        oleframe->binary_data = dxf_char_init (dxf_char_new ());
         oleframe->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -158,7 +151,9 @@ dxf_oleframe_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -167,8 +162,6 @@ dxf_oleframe_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (oleframe == NULL)
@@ -176,176 +169,104 @@ dxf_oleframe_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                oleframe = dxf_oleframe_init (oleframe);
+                oleframe = dxf_oleframe_init (dxf_oleframe_new ());
+                if (oleframe == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter = (DxfChar *) oleframe->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a End of Ole
-                         * data marker. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "OLE") != 0)
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &oleframe->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->layer);
+                        break;
                 }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (oleframe->elevation != 0.0))
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &oleframe->elevation);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &oleframe->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &oleframe->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &oleframe->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &oleframe->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &oleframe->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the ole
-                         * version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &oleframe->ole_version_number);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the length of
-                         * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &oleframe->length);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbOleFrame") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 1:
+                                /* End of OLE data marker. */
+                                if (strcmp (value, "OLE") != 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 70:
+                                oleframe->ole_version_number = atoi (value);
+                                break;
+                        case 90:
+                                oleframe->length = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbOleFrame") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 310:
+                                /* The first line is stored in the node
+                                 * allocated by dxf_oleframe_init (). */
+                                if (iter == NULL)
+                                {
+                                        iter = oleframe->binary_data;
+                                }
+                                else
+                                {
+                                        iter->next = (struct DxfChar *) dxf_char_init (dxf_char_new ());
+                                        iter = (DxfChar *) iter->next;
+                                }
+                                free (iter->value);
+                                iter->value = strdup (value);
+                                iter->length = strlen (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &oleframe->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (oleframe->linetype, "") == 0)
+        if ((oleframe->common.linetype == NULL)
+          || (strcmp (oleframe->common.linetype, "") == 0))
         {
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (oleframe->common.linetype);
+                oleframe->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (oleframe->layer, "") == 0)
+        if ((oleframe->common.layer == NULL)
+          || (strcmp (oleframe->common.layer, "") == 0))
         {
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                free (oleframe->common.layer);
+                oleframe->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,31 +320,31 @@ dxf_oleframe_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (oleframe->linetype, "") == 0)
+        if (strcmp (oleframe->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, oleframe->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, oleframe->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (oleframe->layer, "") == 0)
+        if (strcmp (oleframe->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, oleframe->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, oleframe->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (oleframe->id_code != -1)
+        if (oleframe->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", oleframe->id_code);
+                dxf_handle_write (fp, 5, oleframe->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -435,58 +356,58 @@ dxf_oleframe_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (oleframe->dictionary_owner_soft, "") != 0)
+        if ((oleframe->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", oleframe->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, oleframe->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (oleframe->dictionary_owner_hard, "") != 0)
+        if ((oleframe->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", oleframe->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, oleframe->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (oleframe->paperspace == DXF_PAPERSPACE)
+        if (oleframe->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", oleframe->layer);
-        if (strcmp (oleframe->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", oleframe->common.layer);
+        if (strcmp (oleframe->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", oleframe->linetype);
+                fprintf (fp->fp, "  6\n%s\n", oleframe->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (oleframe->elevation != 0.0))
+          && (oleframe->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", oleframe->elevation);
+                fprintf (fp->fp, " 38\n%f\n", oleframe->common.elevation);
         }
-        if (oleframe->color != DXF_COLOR_BYLAYER)
+        if (oleframe->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", oleframe->color);
+                fprintf (fp->fp, " 62\n%hd\n", oleframe->common.color);
         }
-        if (oleframe->linetype_scale != 1.0)
+        if (oleframe->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", oleframe->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", oleframe->common.linetype_scale);
         }
-        if (oleframe->visibility != 0)
+        if (oleframe->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", oleframe->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", oleframe->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbOleFrame\n");
         }
-        if (oleframe->thickness != 0.0)
+        if (oleframe->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", oleframe->thickness);
+                fprintf (fp->fp, " 39\n%f\n", oleframe->common.thickness);
         }
         fprintf (fp->fp, " 70\n%d\n", oleframe->ole_version_number);
         fprintf (fp->fp, " 90\n%ld\n", oleframe->length);
@@ -504,6 +425,7 @@ dxf_oleframe_write
                 fprintf (fp->fp, "310\n\n");
         }
         fprintf (fp->fp, "  1\nOLE\n");
+        dxf_entity_common_write_xdata (fp, &oleframe->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -546,10 +468,7 @@ dxf_oleframe_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (oleframe->linetype);
-        free (oleframe->layer);
-        free (oleframe->dictionary_owner_soft);
-        free (oleframe->dictionary_owner_hard);
+        dxf_entity_common_free (&oleframe->common);
         dxf_char_free_list (oleframe->binary_data);
         free (oleframe);
         oleframe = NULL;
@@ -584,6 +503,7 @@ dxf_oleframe_free_list
         while (oleframes != NULL)
         {
                 DxfOleFrame *iter = (DxfOleFrame *) oleframes->next;
+                oleframes->next = NULL;
                 dxf_oleframe_free (oleframes);
                 oleframes = (DxfOleFrame *) iter;
         }
@@ -593,12 +513,76 @@ dxf_oleframe_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c OLEFRAME entity.
+ *
+ * The copy does not share any memory with \c oleframe, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfOleFrame *
+dxf_oleframe_copy
+(
+        DxfOleFrame *oleframe
+                /*!< a pointer to the DXF \c OLEFRAME entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfOleFrame *copy;
+
+        /* Do some basic checks. */
+        if (oleframe == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_oleframe_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, oleframe, sizeof (DxfOleFrame));
+        copy->binary_data = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &oleframe->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_oleframe_free (copy);
+                return (NULL);
+        }
+        if (oleframe->binary_data != NULL)
+        {
+                copy->binary_data = dxf_char_copy_list (oleframe->binary_data);
+                if (copy->binary_data == NULL)
+                {
+                        dxf_oleframe_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c OLEFRAME entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_oleframe_get_id_code
 (
         DxfOleFrame *oleframe
@@ -616,16 +600,10 @@ dxf_oleframe_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->id_code);
+        return (oleframe->common.id_code);
 }
 
 
@@ -637,7 +615,7 @@ dxf_oleframe_set_id_code
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -654,13 +632,7 @@ dxf_oleframe_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        oleframe->id_code = id_code;
+        oleframe->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -691,7 +663,7 @@ dxf_oleframe_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->linetype ==  NULL)
+        if (oleframe->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -701,7 +673,7 @@ dxf_oleframe_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->linetype));
+        return (strdup (oleframe->common.linetype));
 }
 
 
@@ -735,7 +707,7 @@ dxf_oleframe_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->linetype = strdup (linetype);
+        oleframe->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -766,7 +738,7 @@ dxf_oleframe_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->layer ==  NULL)
+        if (oleframe->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -776,7 +748,7 @@ dxf_oleframe_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->layer));
+        return (strdup (oleframe->common.layer));
 }
 
 
@@ -810,7 +782,7 @@ dxf_oleframe_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->layer = strdup (layer);
+        oleframe->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -844,7 +816,7 @@ dxf_oleframe_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->elevation);
+        return (oleframe->common.elevation);
 }
 
 
@@ -871,7 +843,7 @@ dxf_oleframe_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->elevation = elevation;
+        oleframe->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -902,7 +874,7 @@ dxf_oleframe_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->thickness < 0.0)
+        if (oleframe->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -911,7 +883,7 @@ dxf_oleframe_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->thickness);
+        return (oleframe->common.thickness);
 }
 
 
@@ -944,7 +916,7 @@ dxf_oleframe_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->thickness = thickness;
+        oleframe->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -975,7 +947,7 @@ dxf_oleframe_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->linetype_scale < 0.0)
+        if (oleframe->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -984,7 +956,7 @@ dxf_oleframe_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->linetype_scale);
+        return (oleframe->common.linetype_scale);
 }
 
 
@@ -1017,7 +989,7 @@ dxf_oleframe_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->linetype_scale = linetype_scale;
+        oleframe->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1048,13 +1020,13 @@ dxf_oleframe_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->visibility < 0)
+        if (oleframe->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (oleframe->visibility > 1)
+        if (oleframe->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1063,7 +1035,7 @@ dxf_oleframe_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->visibility);
+        return (oleframe->common.visibility);
 }
 
 
@@ -1102,7 +1074,7 @@ dxf_oleframe_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->visibility = visibility;
+        oleframe->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1133,7 +1105,7 @@ dxf_oleframe_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->color < 0)
+        if (oleframe->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1142,7 +1114,7 @@ dxf_oleframe_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->color);
+        return (oleframe->common.color);
 }
 
 
@@ -1175,7 +1147,7 @@ dxf_oleframe_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->color = color;
+        oleframe->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1206,13 +1178,13 @@ dxf_oleframe_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->paperspace < 0)
+        if (oleframe->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (oleframe->paperspace > 1)
+        if (oleframe->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1221,7 +1193,7 @@ dxf_oleframe_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->paperspace);
+        return (oleframe->common.paperspace);
 }
 
 
@@ -1261,7 +1233,7 @@ dxf_oleframe_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->paperspace = paperspace;
+        oleframe->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1294,13 +1266,13 @@ dxf_oleframe_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->graphics_data_size < 0)
+        if (oleframe->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (oleframe->graphics_data_size == 0)
+        if (oleframe->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1309,7 +1281,7 @@ dxf_oleframe_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->graphics_data_size);
+        return (oleframe->common.cold->graphics_data_size);
 }
 
 
@@ -1353,7 +1325,7 @@ dxf_oleframe_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->graphics_data_size = graphics_data_size;
+        oleframe->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1385,13 +1357,13 @@ dxf_oleframe_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (oleframe->shadow_mode < 0)
+        if (oleframe->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (oleframe->shadow_mode > 3)
+        if (oleframe->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1400,7 +1372,7 @@ dxf_oleframe_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->shadow_mode);
+        return (oleframe->common.cold->shadow_mode);
 }
 
 
@@ -1442,7 +1414,7 @@ dxf_oleframe_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        oleframe->shadow_mode = shadow_mode;
+        oleframe->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1454,11 +1426,12 @@ dxf_oleframe_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c OLEFRAME entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_oleframe_get_binary_graphics_data
 (
         DxfOleFrame *oleframe
@@ -1476,32 +1449,31 @@ dxf_oleframe_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) oleframe->binary_graphics_data);
+        return (oleframe->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c OLEFRAME entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c oleframe when successful, or \c NULL when an
+ * error occurred.
  */
 DxfOleFrame *
 dxf_oleframe_set_binary_graphics_data
 (
         DxfOleFrame *oleframe,
                 /*!< a pointer to a DXF \c OLEFRAME entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1522,7 +1494,12 @@ dxf_oleframe_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((oleframe->common.cold->binary_graphics_data != NULL)
+          && (oleframe->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (oleframe->common.cold->binary_graphics_data);
+        }
+        oleframe->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1556,17 +1533,10 @@ dxf_oleframe_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->dictionary_owner_soft));
+        return (dxf_handle_to_string (oleframe->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1602,7 +1572,7 @@ dxf_oleframe_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        oleframe->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1636,17 +1606,10 @@ dxf_oleframe_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->material));
+        return (dxf_handle_to_string (oleframe->common.cold->material));
 }
 
 
@@ -1685,7 +1648,7 @@ dxf_oleframe_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->material = strdup (material);
+        oleframe->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1719,17 +1682,10 @@ dxf_oleframe_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->dictionary_owner_hard));
+        return (dxf_handle_to_string (oleframe->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1765,7 +1721,7 @@ dxf_oleframe_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        oleframe->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1800,7 +1756,7 @@ dxf_oleframe_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->lineweight);
+        return (oleframe->common.lineweight);
 }
 
 
@@ -1830,7 +1786,7 @@ dxf_oleframe_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->lineweight = lineweight;
+        oleframe->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1862,17 +1818,10 @@ dxf_oleframe_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->plot_style_name));
+        return (dxf_handle_to_string (oleframe->common.cold->plot_style_name));
 }
 
 
@@ -1910,7 +1859,7 @@ dxf_oleframe_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->plot_style_name = strdup (plot_style_name);
+        oleframe->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1945,7 +1894,7 @@ dxf_oleframe_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->color_value);
+        return (oleframe->common.color_value);
 }
 
 
@@ -1975,7 +1924,7 @@ dxf_oleframe_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->color_value = color_value;
+        oleframe->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2007,7 +1956,7 @@ dxf_oleframe_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (oleframe->color_name ==  NULL)
+        if (oleframe->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2017,7 +1966,7 @@ dxf_oleframe_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (oleframe->color_name));
+        return (strdup (oleframe->common.cold->color_name));
 }
 
 
@@ -2055,7 +2004,7 @@ dxf_oleframe_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->color_name = strdup (color_name);
+        oleframe->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2090,7 +2039,7 @@ dxf_oleframe_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (oleframe->transparency);
+        return (oleframe->common.cold->transparency);
 }
 
 
@@ -2120,7 +2069,7 @@ dxf_oleframe_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        oleframe->transparency = transparency;
+        oleframe->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
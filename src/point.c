@@ -57,6 +57,24 @@
 
 
 #include "point.h"
+#include "entities.h"
+
+
+/*!
+ * \brief Prototype with the default values of a DXF \c POINT entity.
+ */
+static const DxfPoint dxf_point_prototype =
+{
+        .common = DXF_ENTITY_COMMON_DEFAULTS,
+        .x0 = 0.0,
+        .y0 = 0.0,
+        .z0 = 0.0,
+        .angle_to_X = 0.0,
+        .extr_x0 = 0.0,
+        .extr_y0 = 0.0,
+        .extr_z0 = 0.0,
+        .next = NULL
+};
 
 
 /*!
@@ -125,28 +143,13 @@ dxf_point_init
                   __FUNCTION__);
                 return (NULL);
         }
-        point->id_code = 0;
-        point->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        point->layer = strdup (DXF_DEFAULT_LAYER);
-        point->elevation = 0.0;
-        point->thickness = 0.0;
-        point->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        point->visibility = DXF_DEFAULT_VISIBILITY;
-        point->color = DXF_COLOR_BYLAYER;
-        point->paperspace = DXF_MODELSPACE;
-        point->graphics_data_size = 0;
-        point->shadow_mode = 0;
-        point->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
-        point->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (point->binary_graphics_data);
-        point->dictionary_owner_soft = strdup ("");
-        point->object_owner_soft = strdup ("");
-        point->material = strdup ("");
-        point->dictionary_owner_hard = strdup ("");
-        point->lineweight = 0;
-        point->plot_style_name = strdup ("");
-        point->color_value = 0;
-        point->color_name = strdup ("");
-        point->transparency = 0;
+        if (dxf_entity_common_init (&point->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         point->x0 = 0.0;
         point->y0 = 0.0;
         point->z0 = 0.0;
@@ -162,6 +165,96 @@ dxf_point_init
 }
 
 
+/*!
+ * \brief Initialize a DXF \c POINT entity in memory provided by the
+ * caller from the default prototype.
+ *
+ * Used by dxf_entities_create_points () to initialize points carved
+ * from one contiguous block.
+ *
+ * \return a pointer to \c point, or \c NULL when an error occurred, in
+ * which case the common data is freed by dxf_entity_common_free ().
+ */
+DxfPoint *
+dxf_point_init_from_prototype
+(
+        DxfPoint *point,
+                /*!< memory for a DXF \c POINT entity. */
+        const char *layer
+                /*!< layer of the entity, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (point == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (point, &dxf_point_prototype, sizeof (DxfPoint));
+        if (dxf_entity_common_init_from_prototype (&point->common, layer) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (point);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF \c POINT entity and initialize it
+ * from the default prototype.
+ *
+ * Faster than dxf_point_init () when creating many entities: the
+ * defaults are copied with a single memcpy () and the binary graphics
+ * data is left \c NULL until there is content.
+ *
+ * \return a pointer to the new entity, or \c NULL when an error
+ * occurred.
+ */
+DxfPoint *
+dxf_point_new_from_prototype
+(
+        const char *layer
+                /*!< layer of the entity, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *point;
+
+        point = malloc (sizeof (DxfPoint));
+        if (point == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_point_init_from_prototype (point, layer) == NULL)
+        {
+                dxf_point_free (point);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (point);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a \c POINT entity.
  *
@@ -186,9 +279,9 @@ dxf_point_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -196,8 +289,6 @@ dxf_point_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (point == NULL)
@@ -205,273 +296,94 @@ dxf_point_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                point = dxf_point_init (point);
+                point = dxf_point_init (dxf_point_new ());
+                if (point == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter310 = (DxfBinaryData *) point->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &point->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (point->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->angle_to_X);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->graphics_data_size);
+                        break;
                 }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbPoint") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->extr_y0);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &point->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &point->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, point->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &point->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                point->x0 = atof (value);
+                                break;
+                        case 20:
+                                point->y0 = atof (value);
+                                break;
+                        case 30:
+                                point->z0 = atof (value);
+                                break;
+                        case 50:
+                                point->angle_to_X = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbPoint") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                point->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                point->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                point->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &point->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (point->linetype, "") == 0)
+        if ((point->common.linetype == NULL)
+          || (strcmp (point->common.linetype, "") == 0))
         {
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (point->common.linetype);
+                point->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (point->layer, "") == 0)
+        if ((point->common.layer == NULL)
+          || (strcmp (point->common.layer, "") == 0))
         {
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                free (point->common.layer);
+                point->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -518,32 +430,32 @@ dxf_point_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (point->linetype, "") == 0)
+        if (strcmp (point->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, point->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, point->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                point->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (point->layer, "") == 0)
+        if (strcmp (point->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name,
-                        point->id_code);
+                        point->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                point->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (point->id_code != -1)
+        if (point->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", point->id_code);
+                dxf_handle_write (fp, 5, point->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -555,92 +467,86 @@ dxf_point_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (point->dictionary_owner_soft, "") != 0)
+        if ((point->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", point->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, point->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (point->dictionary_owner_hard, "") != 0)
+        if ((point->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", point->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, point->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (point->paperspace == DXF_PAPERSPACE)
+        if (point->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", point->layer);
-        if (strcmp (point->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", point->common.layer);
+        if (strcmp (point->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", point->linetype);
+                fprintf (fp->fp, "  6\n%s\n", point->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (point->material, "") != 0))
+          && (point->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", point->material);
+                dxf_handle_write (fp, 347, point->common.cold->material);
         }
-        if (point->color != DXF_COLOR_BYLAYER)
+        if (point->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", point->color);
+                fprintf (fp->fp, " 62\n%hd\n", point->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", point->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", point->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (point->elevation != 0.0))
+          && (point->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", point->elevation);
+                fprintf (fp->fp, " 38\n%f\n", point->common.elevation);
         }
-        if (point->thickness != 0.0)
+        if (point->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", point->thickness);
+                fprintf (fp->fp, " 39\n%f\n", point->common.thickness);
         }
-        if (point->linetype_scale != 1.0)
+        if (point->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", point->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", point->common.linetype_scale);
         }
-        if (point->visibility != 0)
+        if (point->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", point->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", point->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", point->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", point->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", point->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", point->common.cold->graphics_data_size);
 #endif
-                if (point->binary_graphics_data != NULL)
+                if (point->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) point->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, point->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", point->color_value);
-                fprintf (fp->fp, "430\n%s\n", point->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", point->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", point->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", point->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", point->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", point->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", point->shadow_mode);
+                dxf_handle_write (fp, 390, point->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", point->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -659,6 +565,7 @@ dxf_point_write
                 fprintf (fp->fp, "230\n%f\n", point->extr_z0);
         }
         fprintf (fp->fp, " 50\n%f\n", point->angle_to_X);
+        dxf_entity_common_write_xdata (fp, &point->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -701,10 +608,7 @@ dxf_point_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (point->linetype);
-        free (point->layer);
-        free (point->dictionary_owner_soft);
-        free (point->dictionary_owner_hard);
+        dxf_entity_common_free (&point->common);
         free (point);
         point = NULL;
 #if DEBUG
@@ -738,6 +642,7 @@ dxf_point_free_list
         while (points != NULL)
         {
                 DxfPoint *iter = (DxfPoint *) points->next;
+                points->next = NULL;
                 dxf_point_free (points);
                 points = (DxfPoint *) iter;
         }
@@ -747,12 +652,125 @@ dxf_point_free_list
 }
 
 
+/*!
+ * \brief Copy a single linked list of DXF \c POINT entities.
+ *
+ * The copy does not share any memory with \c points.
+ *
+ * \return a pointer to the first item of the copy, or \c NULL when an
+ * error occurred.
+ */
+DxfPoint *
+dxf_point_copy_list
+(
+        DxfPoint *points
+                /*!< a pointer to the single linked list of DXF
+                 * \c POINT entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *first = NULL;
+        DxfPoint *last = NULL;
+        DxfPoint *copy;
+
+        /* Do some basic checks. */
+        if (points == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (; points != NULL; points = (DxfPoint *) points->next)
+        {
+                copy = dxf_point_copy (points);
+                if (copy == NULL)
+                {
+                        if (first != NULL)
+                        {
+                                dxf_point_free_list (first);
+                        }
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        first = copy;
+                }
+                else
+                {
+                        last->next = (struct DxfPoint *) copy;
+                }
+                last = copy;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
+/*!
+ * \brief Copy a DXF \c POINT entity.
+ *
+ * The copy does not share any memory with \c point, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfPoint *
+dxf_point_copy
+(
+        DxfPoint *point
+                /*!< a pointer to the DXF \c POINT entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *copy;
+
+        /* Do some basic checks. */
+        if (point == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_point_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, point, sizeof (DxfPoint));
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &point->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_point_free (copy);
+                return (NULL);
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from this DXF \c POINT entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_point_get_id_code
 (
         DxfPoint *point
@@ -770,16 +788,10 @@ dxf_point_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->id_code);
+        return (point->common.id_code);
 }
 
 
@@ -794,7 +806,7 @@ dxf_point_set_id_code
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -811,13 +823,7 @@ dxf_point_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        point->id_code = id_code;
+        point->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -848,7 +854,7 @@ dxf_point_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->linetype ==  NULL)
+        if (point->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -858,7 +864,7 @@ dxf_point_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->linetype));
+        return (strdup (point->common.linetype));
 }
 
 
@@ -895,7 +901,7 @@ dxf_point_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        point->linetype = strdup (linetype);
+        point->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -926,7 +932,7 @@ dxf_point_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->layer ==  NULL)
+        if (point->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -936,7 +942,7 @@ dxf_point_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->layer));
+        return (strdup (point->common.layer));
 }
 
 
@@ -973,7 +979,7 @@ dxf_point_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        point->layer = strdup (layer);
+        point->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1007,7 +1013,7 @@ dxf_point_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->elevation);
+        return (point->common.elevation);
 }
 
 
@@ -1037,7 +1043,7 @@ dxf_point_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        point->elevation = elevation;
+        point->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1068,7 +1074,7 @@ dxf_point_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->thickness < 0.0)
+        if (point->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1077,7 +1083,7 @@ dxf_point_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->thickness);
+        return (point->common.thickness);
 }
 
 
@@ -1113,7 +1119,7 @@ dxf_point_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        point->thickness = thickness;
+        point->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1144,7 +1150,7 @@ dxf_point_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->linetype_scale < 0.0)
+        if (point->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1153,7 +1159,7 @@ dxf_point_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->linetype_scale);
+        return (point->common.linetype_scale);
 }
 
 
@@ -1189,7 +1195,7 @@ dxf_point_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        point->linetype_scale = linetype_scale;
+        point->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1220,13 +1226,13 @@ dxf_point_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->visibility < 0)
+        if (point->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (point->visibility > 1)
+        if (point->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1235,7 +1241,7 @@ dxf_point_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->visibility);
+        return (point->common.visibility);
 }
 
 
@@ -1277,7 +1283,7 @@ dxf_point_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        point->visibility = visibility;
+        point->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1308,7 +1314,7 @@ dxf_point_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->color < 0)
+        if (point->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1317,7 +1323,7 @@ dxf_point_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->color);
+        return (point->common.color);
 }
 
 
@@ -1355,7 +1361,7 @@ dxf_point_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        point->color = color;
+        point->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1386,13 +1392,13 @@ dxf_point_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->paperspace < 0)
+        if (point->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (point->paperspace > 1)
+        if (point->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1401,7 +1407,7 @@ dxf_point_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->paperspace);
+        return (point->common.paperspace);
 }
 
 
@@ -1443,7 +1449,7 @@ dxf_point_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        point->paperspace = paperspace;
+        point->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1475,13 +1481,13 @@ dxf_point_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->graphics_data_size < 0)
+        if (point->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (point->graphics_data_size == 0)
+        if (point->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1490,7 +1496,7 @@ dxf_point_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->graphics_data_size);
+        return (point->common.cold->graphics_data_size);
 }
 
 
@@ -1533,7 +1539,7 @@ dxf_point_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        point->graphics_data_size = graphics_data_size;
+        point->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1565,13 +1571,13 @@ dxf_point_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point->shadow_mode < 0)
+        if (point->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (point->shadow_mode > 3)
+        if (point->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1580,7 +1586,7 @@ dxf_point_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->shadow_mode);
+        return (point->common.cold->shadow_mode);
 }
 
 
@@ -1622,7 +1628,7 @@ dxf_point_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        point->shadow_mode = shadow_mode;
+        point->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1631,15 +1637,15 @@ dxf_point_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the \c binary_graphics_data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c POINT entity.
  *
- * \return a pointer to the \c binary_graphics_data when successful, or
- * \c NULL when an error occurred.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_point_get_binary_graphics_data
 (
         DxfPoint *point
@@ -1657,17 +1663,10 @@ dxf_point_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) point->binary_graphics_data);
+        return (point->common.cold->binary_graphics_data);
 }
 
 
@@ -1675,6 +1674,9 @@ dxf_point_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c POINT entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c point when successful, or \c NULL when an
  * error occurred.
  */
@@ -1683,9 +1685,9 @@ dxf_point_set_binary_graphics_data
 (
         DxfPoint *point,
                 /*!< a pointer to a DXF \c POINT entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1706,7 +1708,12 @@ dxf_point_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        point->binary_graphics_data = (DxfBinaryData *) data;
+        if ((point->common.cold->binary_graphics_data != NULL)
+          && (point->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (point->common.cold->binary_graphics_data);
+        }
+        point->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1740,17 +1747,10 @@ dxf_point_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->dictionary_owner_soft));
+        return (dxf_handle_to_string (point->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1789,7 +1789,7 @@ dxf_point_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        point->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        point->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1823,17 +1823,10 @@ dxf_point_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->material));
+        return (dxf_handle_to_string (point->common.cold->material));
 }
 
 
@@ -1871,7 +1864,7 @@ dxf_point_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        point->material = strdup (material);
+        point->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1905,17 +1898,10 @@ dxf_point_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->dictionary_owner_hard));
+        return (dxf_handle_to_string (point->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1954,7 +1940,7 @@ dxf_point_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        point->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        point->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1989,7 +1975,7 @@ dxf_point_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->lineweight);
+        return (point->common.lineweight);
 }
 
 
@@ -2019,7 +2005,7 @@ dxf_point_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        point->lineweight = lineweight;
+        point->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2051,17 +2037,10 @@ dxf_point_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->plot_style_name));
+        return (dxf_handle_to_string (point->common.cold->plot_style_name));
 }
 
 
@@ -2099,7 +2078,7 @@ dxf_point_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        point->plot_style_name = strdup (plot_style_name);
+        point->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2134,7 +2113,7 @@ dxf_point_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->color_value);
+        return (point->common.color_value);
 }
 
 
@@ -2164,7 +2143,7 @@ dxf_point_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        point->color_value = color_value;
+        point->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2196,7 +2175,7 @@ dxf_point_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point->color_name ==  NULL)
+        if (point->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2206,7 +2185,7 @@ dxf_point_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (point->color_name));
+        return (strdup (point->common.cold->color_name));
 }
 
 
@@ -2244,7 +2223,7 @@ dxf_point_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        point->color_name = strdup (color_name);
+        point->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2279,7 +2258,7 @@ dxf_point_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (point->transparency);
+        return (point->common.cold->transparency);
 }
 
 
@@ -2309,7 +2288,7 @@ dxf_point_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        point->transparency = transparency;
+        point->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2789,4 +2768,346 @@ dxf_point_get_last
 }
 
 
+/*!
+ * \brief Allocate single precision storage for \c number_of_points
+ * points.
+ *
+ * All offsets are set to 0.0, so each point starts at the origin.
+ *
+ * \return a pointer to the allocated storage, or \c NULL when an error
+ * occurred.
+ */
+DxfPointOffsets *
+dxf_point_offsets_new
+(
+        int number_of_points,
+                /*!< number of points to store. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *offsets = NULL;
+
+        /* Do some basic checks. */
+        if (number_of_points < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        offsets = calloc (1, sizeof (DxfPointOffsets)
+          + (size_t) number_of_points * 3 * sizeof (float));
+        if (offsets == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        offsets->origin_x = origin_x;
+        offsets->origin_y = origin_y;
+        offsets->origin_z = origin_z;
+        offsets->number_of_points = number_of_points;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (offsets);
+}
+
+
+/*!
+ * \brief Allocate single precision storage for the coordinates of an
+ * array of \c POINT entities.
+ *
+ * A \c NULL point in \c points is stored at the origin.
+ *
+ * \return a pointer to the allocated storage, or \c NULL when an error
+ * occurred.
+ */
+DxfPointOffsets *
+dxf_point_offsets_new_from_points
+(
+        DxfPoint **points,
+                /*!< array of \c number_of_points pointers to DXF
+                 * \c POINT entities. */
+        int number_of_points,
+                /*!< number of points in \c points. */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *offsets = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (points == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        offsets = dxf_point_offsets_new (number_of_points, origin_x, origin_y, origin_z);
+        if (offsets == NULL)
+        {
+                return (NULL);
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                if (points[i] != NULL)
+                {
+                        dxf_point_offsets_set (offsets, i,
+                          points[i]->x0, points[i]->y0, points[i]->z0);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (offsets);
+}
+
+
+/*!
+ * \brief Get the coordinates of point \c i from single precision
+ * storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_offsets_get
+(
+        DxfPointOffsets *offsets,
+                /*!< a pointer to the single precision storage. */
+        int i,
+                /*!< index of the point. */
+        double *x,
+                /*!< X-coordinate of the point, may be \c NULL. */
+        double *y,
+                /*!< Y-coordinate of the point, may be \c NULL. */
+        double *z
+                /*!< Z-coordinate of the point, may be \c NULL. */
+)
+{
+        /* Do some basic checks. */
+        if (offsets == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((i < 0) || (i >= offsets->number_of_points))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () index %d is out of range.\n")),
+                  __FUNCTION__, i);
+                return (EXIT_FAILURE);
+        }
+        if (x != NULL)
+        {
+                *x = offsets->origin_x + (double) offsets->offset[3 * i];
+        }
+        if (y != NULL)
+        {
+                *y = offsets->origin_y + (double) offsets->offset[3 * i + 1];
+        }
+        if (z != NULL)
+        {
+                *z = offsets->origin_z + (double) offsets->offset[3 * i + 2];
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the coordinates of point \c i in single precision
+ * storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_offsets_set
+(
+        DxfPointOffsets *offsets,
+                /*!< a pointer to the single precision storage. */
+        int i,
+                /*!< index of the point. */
+        double x,
+                /*!< X-coordinate of the point. */
+        double y,
+                /*!< Y-coordinate of the point. */
+        double z
+                /*!< Z-coordinate of the point. */
+)
+{
+        /* Do some basic checks. */
+        if (offsets == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((i < 0) || (i >= offsets->number_of_points))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () index %d is out of range.\n")),
+                  __FUNCTION__, i);
+                return (EXIT_FAILURE);
+        }
+        offsets->offset[3 * i] = (float) (x - offsets->origin_x);
+        offsets->offset[3 * i + 1] = (float) (y - offsets->origin_y);
+        offsets->offset[3 * i + 2] = (float) (z - offsets->origin_z);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Convert single precision storage back into \c POINT entities.
+ *
+ * For each point a new \c POINT entity is allocated in \c points,
+ * which must have room for \c number_of_points pointers.\n
+ * On an error the points allocated so far are freed and set to \c NULL.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_offsets_to_points
+(
+        DxfPointOffsets *offsets,
+                /*!< a pointer to the single precision storage. */
+        DxfPoint **points
+                /*!< array receiving the pointers to the new DXF
+                 * \c POINT entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((offsets == NULL) || (points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < offsets->number_of_points; i++)
+        {
+                points[i] = dxf_point_init (dxf_point_new ());
+                if (points[i] == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        for (j = 0; j < i; j++)
+                        {
+                                dxf_point_free (points[j]);
+                                points[j] = NULL;
+                        }
+                        return (EXIT_FAILURE);
+                }
+                dxf_point_offsets_get (offsets, i,
+                  &points[i]->x0, &points[i]->y0, &points[i]->z0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy single precision storage.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfPointOffsets *
+dxf_point_offsets_copy
+(
+        DxfPointOffsets *offsets
+                /*!< a pointer to the single precision storage. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointOffsets *copy = NULL;
+
+        /* Do some basic checks. */
+        if (offsets == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_point_offsets_new (offsets->number_of_points,
+          offsets->origin_x, offsets->origin_y, offsets->origin_z);
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        memcpy (copy->offset, offsets->offset,
+          (size_t) offsets->number_of_points * 3 * sizeof (float));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Free the allocated memory of single precision storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_offsets_free
+(
+        DxfPointOffsets *offsets
+                /*!< a pointer to the single precision storage. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (offsets == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (offsets);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -39,6 +39,8 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "binary_data.h"
 
 
@@ -72,112 +74,9 @@ typedef struct
 dxf_point_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< group code = 5\n
-                 * Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
-        char *linetype;
-                /*!< group code = 6\n
-                 * The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file. */
-        char *layer;
-                /*!< group code = 8\n
-                 * Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given. */
-        double elevation;
-                /*!< group code = 38\n
-                 * Elevation of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default). */
-        double thickness;
-                /*!< group code = 39\n
-                 * Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file. */
-        double linetype_scale;
-                /*!< group code = 48\n
-                 * Linetype scale (optional). */
-        int16_t visibility;
-                /*!< group code = 60\n
-                 * Object visibility (optional): 0 = Visible; 1 = Invisible. */
-        int16_t color;
-                /*!< group code = 62\n
-                 * Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity. */
-        int16_t paperspace;
-                /*!< group code = 67\n
-                 * Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0). */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92. */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310. */
-        char *dictionary_owner_soft;
-                /*!< group code = 330\n
-                 * Soft-pointer ID/handle to owner dictionary (optional). */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347. */
-        char *dictionary_owner_hard;
-                /*!< group code = 360\n
-                 * Hard owner ID/handle to owner dictionary (optional). */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440. */
-        /* Specific members for a DXF point. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         double x0;
                 /*!< group code = 10. */
         double y0;
@@ -207,14 +106,41 @@ dxf_point_struct
 } DxfPoint;
 
 
+/*!
+ * \brief Single precision storage of the points of an entity.
+ *
+ * The coordinates are kept as \c float offsets relative to an origin,
+ * which takes a fraction of the memory of a \c DxfPoint for each point.
+ * Allocated in one block with dxf_point_offsets_new ().
+ */
+typedef struct
+dxf_point_offsets_struct
+{
+        double origin_x;
+                /*!< X-coordinate of the origin of the offsets. */
+        double origin_y;
+                /*!< Y-coordinate of the origin of the offsets. */
+        double origin_z;
+                /*!< Z-coordinate of the origin of the offsets. */
+        int number_of_points;
+                /*!< Number of points in \c offset. */
+        float offset[];
+                /*!< X-, Y- and Z-offset of each point. */
+} DxfPointOffsets;
+
+
 DxfPoint *dxf_point_new ();
 DxfPoint *dxf_point_init (DxfPoint *point);
+DxfPoint *dxf_point_init_from_prototype (DxfPoint *point, const char *layer);
+DxfPoint *dxf_point_new_from_prototype (const char *layer);
 DxfPoint *dxf_point_read (DxfFile *fp, DxfPoint *point);
 int dxf_point_write (DxfFile *fp, DxfPoint *point);
 int dxf_point_free (DxfPoint *point);
 void dxf_point_free_list (DxfPoint *points);
-int dxf_point_get_id_code (DxfPoint *point);
-DxfPoint *dxf_point_set_id_code (DxfPoint *point, int id_code);
+DxfPoint *dxf_point_copy_list (DxfPoint *points);
+DxfPoint *dxf_point_copy (DxfPoint *point);
+DxfHandle dxf_point_get_id_code (DxfPoint *point);
+DxfPoint *dxf_point_set_id_code (DxfPoint *point, DxfHandle id_code);
 char *dxf_point_get_linetype (DxfPoint *point);
 DxfPoint *dxf_point_set_linetype (DxfPoint *point, char *linetype);
 char *dxf_point_get_layer (DxfPoint *point);
@@ -235,8 +161,8 @@ int32_t dxf_point_get_graphics_data_size (DxfPoint *point);
 DxfPoint *dxf_point_set_graphics_data_size (DxfPoint *point, int32_t graphics_data_size);
 int16_t dxf_point_get_shadow_mode (DxfPoint *point);
 DxfPoint *dxf_point_set_shadow_mode (DxfPoint *point, int16_t shadow_mode);
-DxfBinaryData *dxf_point_get_binary_graphics_data (DxfPoint *point);
-DxfPoint *dxf_point_set_binary_graphics_data (DxfPoint *point, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_point_get_binary_graphics_data (DxfPoint *point);
+DxfPoint *dxf_point_set_binary_graphics_data (DxfPoint *point, DxfBinaryBuffer *data);
 char *dxf_point_get_dictionary_owner_soft (DxfPoint *point);
 DxfPoint *dxf_point_set_dictionary_owner_soft (DxfPoint *point, char *dictionary_owner_soft);
 char *dxf_point_get_material (DxfPoint *point);
@@ -266,6 +192,13 @@ DxfPoint *dxf_point_set_extrusion_vector (DxfPoint *point, double extr_x0, doubl
 DxfPoint *dxf_point_get_next (DxfPoint *point);
 DxfPoint *dxf_point_set_next (DxfPoint *point, DxfPoint *next);
 DxfPoint *dxf_point_get_last (DxfPoint *point);
+DxfPointOffsets *dxf_point_offsets_new (int number_of_points, double origin_x, double origin_y, double origin_z);
+DxfPointOffsets *dxf_point_offsets_new_from_points (DxfPoint **points, int number_of_points, double origin_x, double origin_y, double origin_z);
+int dxf_point_offsets_get (DxfPointOffsets *offsets, int i, double *x, double *y, double *z);
+int dxf_point_offsets_set (DxfPointOffsets *offsets, int i, double x, double y, double z);
+int dxf_point_offsets_to_points (DxfPointOffsets *offsets, DxfPoint **points);
+DxfPointOffsets *dxf_point_offsets_copy (DxfPointOffsets *offsets);
+int dxf_point_offsets_free (DxfPointOffsets *offsets);
 
 
 #ifdef __cplusplus
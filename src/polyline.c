@@ -42,6 +42,7 @@
 
 
 #include "polyline.h"
+#include "entities.h"
 
 
 /*!
@@ -110,26 +111,13 @@ dxf_polyline_init
                 __FUNCTION__);
               return (NULL);
         }
-        dxf_polyline_set_id_code (polyline, 0);
-        dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
-        dxf_polyline_set_elevation (polyline, 0.0);
-        dxf_polyline_set_thickness (polyline, 0.0);
-        dxf_polyline_set_linetype_scale (polyline, DXF_DEFAULT_LINETYPE_SCALE);
-        dxf_polyline_set_visibility (polyline, DXF_DEFAULT_VISIBILITY);
-        dxf_polyline_set_color (polyline, DXF_COLOR_BYLAYER);
-        dxf_polyline_set_paperspace (polyline, DXF_MODELSPACE);
-        dxf_polyline_set_graphics_data_size (polyline, 0);
-        dxf_polyline_set_shadow_mode (polyline, 0);
-        dxf_polyline_set_binary_graphics_data (polyline, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
-        dxf_polyline_set_dictionary_owner_soft (polyline, strdup (""));
-        dxf_polyline_set_material (polyline, strdup (""));
-        dxf_polyline_set_dictionary_owner_hard (polyline, strdup (""));
-        dxf_polyline_set_lineweight (polyline, 0);
-        dxf_polyline_set_plot_style_name (polyline, strdup (""));
-        dxf_polyline_set_color_value (polyline, 0);
-        dxf_polyline_set_color_name (polyline, strdup (""));
-        dxf_polyline_set_transparency (polyline, 0);
+        if (dxf_entity_common_init (&polyline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         dxf_polyline_set_p0 (polyline, (DxfPoint *) dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_polyline_get_p0 (polyline));
         dxf_polyline_set_x0 (polyline, 0.0);
@@ -149,7 +137,7 @@ dxf_polyline_init
         dxf_polyline_set_extr_z0 (polyline, 0.0);
         dxf_polyline_set_vertices (polyline, (DxfVertex *) dxf_vertex_new ());
         dxf_vertex_init ((DxfVertex *) dxf_polyline_get_vertices (polyline));
-        dxf_polyline_set_next (polyline, NULL);
+        polyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -182,7 +170,9 @@ dxf_polyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -190,8 +180,6 @@ dxf_polyline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (polyline == NULL)
@@ -199,238 +187,120 @@ dxf_polyline_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                polyline = dxf_polyline_init (polyline);
+                polyline = dxf_polyline_init (dxf_polyline_new ());
+                if (polyline == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &polyline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the primary point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the primary point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the primary point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->p0->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * starting width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->end_width);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &polyline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->color);
-                }
-                else if (strcmp (temp_string, "66") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertces follow flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->vertices_follow);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the
-                         * flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the polygon
-                         * mesh M vertex count value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->polygon_mesh_M_vertex_count);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the polygon
-                         * mesh N vertex count value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->polygon_mesh_N_vertex_count);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the smooth M
-                         * surface density value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->smooth_M_surface_density);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the smooth N
-                         * surface density value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->smooth_M_surface_density);
-                }
-                else if (strcmp (temp_string, "75") == 0)
-                {
-                        /* Now follows a string containing the surface
-                         * type value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &polyline->surface_type);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &polyline->extr_z0);
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_soft);
+                        break;
                 }
-                else if (strcmp (temp_string, "360") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_hard);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                polyline->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                polyline->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                polyline->p0->z0 = atof (value);
+                                break;
+                        case 40:
+                                polyline->start_width = atof (value);
+                                break;
+                        case 41:
+                                polyline->end_width = atof (value);
+                                break;
+                        case 66:
+                                polyline->vertices_follow = atoi (value);
+                                break;
+                        case 70:
+                                polyline->flag = atoi (value);
+                                break;
+                        case 71:
+                                polyline->polygon_mesh_M_vertex_count = atoi (value);
+                                break;
+                        case 72:
+                                polyline->polygon_mesh_N_vertex_count = atoi (value);
+                                break;
+                        case 73:
+                                polyline->smooth_M_surface_density = atoi (value);
+                                break;
+                        case 74:
+                                polyline->smooth_M_surface_density = atoi (value);
+                                break;
+                        case 75:
+                                polyline->surface_type = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDb2dPolyline") != 0)
+                                  && (strcmp (value, "AcDb3dPolyline") != 0)
+                                  && (strcmp (value, "AcDbPolyFaceMesh") != 0)
+                                  && (strcmp (value, "AcDbPolygonMesh") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                polyline->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                polyline->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                polyline->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &polyline->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
+        if ((polyline->common.linetype == NULL)
+          || (strcmp (polyline->common.linetype, "") == 0))
         {
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                free (polyline->common.linetype);
+                polyline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
+        if ((polyline->common.layer == NULL)
+          || (strcmp (polyline->common.layer, "") == 0))
         {
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                free (polyline->common.layer);
+                polyline->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -481,7 +351,7 @@ dxf_polyline_write
         if (dxf_polyline_get_x0 (polyline) != 0.0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point has an invalid X-value for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point has an invalid X-value for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -490,7 +360,7 @@ dxf_polyline_write
         if (dxf_polyline_get_y0 (polyline) != 0.0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point has an invalid Y-value for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () start point has an invalid Y-value for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -499,26 +369,26 @@ dxf_polyline_write
         if (dxf_polyline_get_vertices_follow (polyline) != 1)
         {
                 fprintf (stderr,
-                  (_("Error in %s () vertices follow flag has an invalid value for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () vertices follow flag has an invalid value for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
+        if (strcmp (polyline->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
                 dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
         }
-        if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
+        if (strcmp (polyline->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
@@ -527,9 +397,9 @@ dxf_polyline_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (dxf_polyline_get_id_code (polyline) != -1)
+        if (dxf_polyline_get_id_code (polyline) != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", dxf_polyline_get_id_code (polyline));
+                dxf_handle_write (fp, 5, dxf_polyline_get_id_code (polyline));
         }
         /*!
          * \todo for version R14.\n
@@ -541,18 +411,18 @@ dxf_polyline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (polyline->dictionary_owner_soft, "") != 0)
+        if ((polyline->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", dxf_polyline_get_dictionary_owner_soft (polyline));
+                dxf_handle_write (fp, 330, polyline->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (polyline->dictionary_owner_hard, "") != 0)
+        if ((polyline->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", dxf_polyline_get_dictionary_owner_hard (polyline));
+                dxf_handle_write (fp, 360, polyline->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -563,10 +433,10 @@ dxf_polyline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", dxf_polyline_get_layer (polyline));
-        if (strcmp (dxf_polyline_get_linetype (polyline), DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", polyline->common.layer);
+        if (strcmp (polyline->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", dxf_polyline_get_linetype (polyline));
+                fprintf (fp->fp, "  6\n%s\n", polyline->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -631,7 +501,7 @@ dxf_polyline_write
                 dxf_vertex_write (fp, iter);
                 iter = (DxfVertex *) iter->next;
         }
-        dxf_vertex_free (iter);
+        dxf_entity_common_write_xdata (fp, &polyline->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -674,14 +544,7 @@ dxf_polyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_polyline_get_linetype (polyline));
-        free (dxf_polyline_get_layer (polyline));
-        dxf_binary_graphics_data_free_list (dxf_polyline_get_binary_graphics_data (polyline));
-        free (dxf_polyline_get_dictionary_owner_soft (polyline));
-        free (dxf_polyline_get_material (polyline));
-        free (dxf_polyline_get_dictionary_owner_hard (polyline));
-        free (dxf_polyline_get_plot_style_name (polyline));
-        free (dxf_polyline_get_color_name (polyline));
+        dxf_entity_common_free (&polyline->common);
         dxf_point_free (dxf_polyline_get_p0 (polyline));
         dxf_vertex_free_list (dxf_polyline_get_vertices (polyline));
         free (polyline);
@@ -717,6 +580,7 @@ dxf_polyline_free_list
         while (polylines != NULL)
         {
                 DxfPolyline *iter = (DxfPolyline *) polylines->next;
+                polylines->next = NULL;
                 dxf_polyline_free (polylines);
                 polylines = (DxfPolyline *) iter;
         }
@@ -726,12 +590,101 @@ dxf_polyline_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c POLYLINE entity.
+ *
+ * The copy does not share any memory with \c polyline, its \c next
+ * member is \c NULL.\n
+ * The \c VERTEX entities following the \c POLYLINE are copied too.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfPolyline *
+dxf_polyline_copy
+(
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF \c POLYLINE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPolyline *copy;
+        DxfVertex *vertex;
+        DxfVertex *iter;
+        DxfVertex *last = NULL;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_polyline_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, polyline, sizeof (DxfPolyline));
+        copy->p0 = NULL;
+        copy->vertices = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &polyline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_polyline_free (copy);
+                return (NULL);
+        }
+        if (polyline->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (polyline->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_polyline_free (copy);
+                        return (NULL);
+                }
+        }
+        for (iter = polyline->vertices;
+          iter != NULL;
+          iter = (DxfVertex *) iter->next)
+        {
+                vertex = dxf_vertex_copy (iter);
+                if (vertex == NULL)
+                {
+                        dxf_polyline_free (copy);
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        copy->vertices = vertex;
+                }
+                else
+                {
+                        last->next = (struct DxfVertex *) vertex;
+                }
+                last = vertex;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c POLYLINE entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_polyline_get_id_code
 (
         DxfPolyline *polyline
@@ -749,16 +702,10 @@ dxf_polyline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found in the id-code member.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->id_code);
+        return (polyline->common.id_code);
 }
 
 
@@ -773,7 +720,7 @@ dxf_polyline_set_id_code
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -790,13 +737,7 @@ dxf_polyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-        }
-        polyline->id_code = id_code;
+        polyline->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -828,7 +769,7 @@ dxf_polyline_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->linetype ==  NULL)
+        if (polyline->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
@@ -838,7 +779,7 @@ dxf_polyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->linetype));
+        return (strdup (polyline->common.linetype));
 }
 
 
@@ -878,7 +819,7 @@ dxf_polyline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->linetype = strdup (linetype);
+        polyline->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -910,7 +851,7 @@ dxf_polyline_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->layer ==  NULL)
+        if (polyline->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
@@ -920,7 +861,7 @@ dxf_polyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->layer));
+        return (strdup (polyline->common.layer));
 }
 
 
@@ -959,7 +900,7 @@ dxf_polyline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->layer = strdup (layer);
+        polyline->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -993,7 +934,7 @@ dxf_polyline_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->elevation);
+        return (polyline->common.elevation);
 }
 
 
@@ -1023,7 +964,7 @@ dxf_polyline_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->elevation = elevation;
+        polyline->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1054,7 +995,7 @@ dxf_polyline_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->thickness < 0.0)
+        if (polyline->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
@@ -1063,7 +1004,7 @@ dxf_polyline_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->thickness);
+        return (polyline->common.thickness);
 }
 
 
@@ -1099,7 +1040,7 @@ dxf_polyline_set_thickness
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
-        polyline->thickness = thickness;
+        polyline->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1130,7 +1071,7 @@ dxf_polyline_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->linetype_scale < 0.0)
+        if (polyline->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the linetype_scale member.\n")),
@@ -1139,7 +1080,7 @@ dxf_polyline_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->linetype_scale);
+        return (polyline->common.linetype_scale);
 }
 
 
@@ -1175,7 +1116,7 @@ dxf_polyline_set_linetype_scale
                   (_("Warning in %s () a negative linetype_scale value was passed.\n")),
                   __FUNCTION__);
         }
-        polyline->linetype_scale = linetype_scale;
+        polyline->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1206,14 +1147,14 @@ dxf_polyline_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->visibility < 0)
+        if (polyline->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->visibility > 1)
+        if (polyline->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
@@ -1223,7 +1164,7 @@ dxf_polyline_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->visibility);
+        return (polyline->common.visibility);
 }
 
 
@@ -1267,7 +1208,7 @@ dxf_polyline_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->visibility = visibility;
+        polyline->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1298,7 +1239,7 @@ dxf_polyline_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->color < 0)
+        if (polyline->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
@@ -1307,7 +1248,7 @@ dxf_polyline_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->color);
+        return (polyline->common.color);
 }
 
 
@@ -1345,7 +1286,7 @@ dxf_polyline_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        polyline->color = color;
+        polyline->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1377,13 +1318,13 @@ dxf_polyline_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->paperspace < 0)
+        if (polyline->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
-        if (polyline->paperspace > 1)
+        if (polyline->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
@@ -1392,7 +1333,7 @@ dxf_polyline_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->paperspace);
+        return (polyline->common.paperspace);
 }
 
 
@@ -1436,7 +1377,7 @@ dxf_polyline_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->paperspace = paperspace;
+        polyline->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1469,13 +1410,13 @@ dxf_polyline_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->graphics_data_size < 0)
+        if (polyline->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
-        if (polyline->graphics_data_size == 0)
+        if (polyline->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
@@ -1484,7 +1425,7 @@ dxf_polyline_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->graphics_data_size);
+        return (polyline->common.cold->graphics_data_size);
 }
 
 
@@ -1529,7 +1470,7 @@ dxf_polyline_set_graphics_data_size
                   (_("Warning in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
         }
-        polyline->graphics_data_size = graphics_data_size;
+        polyline->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1561,14 +1502,14 @@ dxf_polyline_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->shadow_mode < 0)
+        if (polyline->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->shadow_mode > 3)
+        if (polyline->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
@@ -1578,7 +1519,7 @@ dxf_polyline_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->shadow_mode);
+        return (polyline->common.cold->shadow_mode);
 }
 
 
@@ -1622,7 +1563,7 @@ dxf_polyline_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->shadow_mode = shadow_mode;
+        polyline->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1634,11 +1575,12 @@ dxf_polyline_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c POLYLINE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_polyline_get_binary_graphics_data
 (
         DxfPolyline *polyline
@@ -1656,32 +1598,31 @@ dxf_polyline_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) polyline->binary_graphics_data);
+        return (polyline->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c POLYLINE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c polyline when successful, or \c NULL when an
+ * error occurred.
  */
 DxfPolyline *
 dxf_polyline_set_binary_graphics_data
 (
         DxfPolyline *polyline,
                 /*!< a pointer to a DXF \c POLYLINE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1702,7 +1643,12 @@ dxf_polyline_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((polyline->common.cold->binary_graphics_data != NULL)
+          && (polyline->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (polyline->common.cold->binary_graphics_data);
+        }
+        polyline->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1736,17 +1682,10 @@ dxf_polyline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_soft));
+        return (dxf_handle_to_string (polyline->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1782,7 +1721,7 @@ dxf_polyline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        polyline->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1817,17 +1756,10 @@ dxf_polyline_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the material member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->material));
+        return (dxf_handle_to_string (polyline->common.cold->material));
 }
 
 
@@ -1866,7 +1798,7 @@ dxf_polyline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->material = strdup (material);
+        polyline->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1900,17 +1832,10 @@ dxf_polyline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_hard));
+        return (dxf_handle_to_string (polyline->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1949,7 +1874,7 @@ dxf_polyline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        polyline->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1984,7 +1909,7 @@ dxf_polyline_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->lineweight);
+        return (polyline->common.lineweight);
 }
 
 
@@ -2014,7 +1939,7 @@ dxf_polyline_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->lineweight = lineweight;
+        polyline->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2046,17 +1971,10 @@ dxf_polyline_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->plot_style_name));
+        return (dxf_handle_to_string (polyline->common.cold->plot_style_name));
 }
 
 
@@ -2094,7 +2012,7 @@ dxf_polyline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->plot_style_name = strdup (plot_style_name);
+        polyline->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2129,7 +2047,7 @@ dxf_polyline_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->color_value);
+        return (polyline->common.color_value);
 }
 
 
@@ -2159,7 +2077,7 @@ dxf_polyline_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->color_value = color_value;
+        polyline->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2191,7 +2109,7 @@ dxf_polyline_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->color_name ==  NULL)
+        if (polyline->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
@@ -2201,7 +2119,7 @@ dxf_polyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->color_name));
+        return (strdup (polyline->common.cold->color_name));
 }
 
 
@@ -2239,7 +2157,7 @@ dxf_polyline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->color_name = strdup (color_name);
+        polyline->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2274,7 +2192,7 @@ dxf_polyline_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->transparency);
+        return (polyline->common.cold->transparency);
 }
 
 
@@ -2304,7 +2222,7 @@ dxf_polyline_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->transparency = transparency;
+        polyline->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
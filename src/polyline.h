@@ -44,6 +44,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "binary_graphics_data.h"
 #include "vertex.h"
 #include "point.h"
@@ -104,130 +107,9 @@ typedef struct
 dxf_polyline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF polyline. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfPoint *p0;
                 /*!< Insertion point for the polyline.\n
                  * The \c z0 value of \c p0 is the default elevation for
@@ -313,8 +195,9 @@ DxfPolyline *dxf_polyline_read (DxfFile *fp, DxfPolyline *polyline);
 int dxf_polyline_write (DxfFile *fp, DxfPolyline *polyline);
 int dxf_polyline_free (DxfPolyline *polyline);
 void dxf_polyline_free_list (DxfPolyline *polylines);
-int dxf_polyline_get_id_code (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_id_code (DxfPolyline *polyline, int id_code);
+DxfPolyline *dxf_polyline_copy (DxfPolyline *polyline);
+DxfHandle dxf_polyline_get_id_code (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_id_code (DxfPolyline *polyline, DxfHandle id_code);
 char *dxf_polyline_get_linetype (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_linetype (DxfPolyline *polyline, char *linetype);
 char *dxf_polyline_get_layer (DxfPolyline *polyline);
@@ -335,8 +218,8 @@ int dxf_polyline_get_graphics_data_size (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_graphics_data_size (DxfPolyline *polyline, int graphics_data_size);
 int16_t dxf_polyline_get_shadow_mode (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_shadow_mode (DxfPolyline *polyline, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_polyline_get_binary_graphics_data (DxfPolyline *polyline);
-DxfPolyline *dxf_polyline_set_binary_graphics_data (DxfPolyline *polyline, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_polyline_get_binary_graphics_data (DxfPolyline *polyline);
+DxfPolyline *dxf_polyline_set_binary_graphics_data (DxfPolyline *polyline, DxfBinaryBuffer *data);
 char *dxf_polyline_get_dictionary_owner_soft (DxfPolyline *polyline);
 DxfPolyline *dxf_polyline_set_dictionary_owner_soft (DxfPolyline *polyline, char *dictionary_owner_soft);
 char *dxf_polyline_get_material (DxfPolyline *polyline);
@@ -179,6 +179,7 @@ dxf_proprietary_data_free_list
         while (datas != NULL)
         {
                 DxfProprietaryData *iter = (DxfProprietaryData *) datas->next;
+                datas->next = NULL;
                 dxf_proprietary_data_free (datas);
                 datas = (DxfProprietaryData *) iter;
         }
@@ -627,4 +628,555 @@ dxf_proprietary_data_get_last
 }
 
 
+/*!
+ * \brief Get the next line of proprietary data from \c file.
+ *
+ * The line is decoded into \c buffer: the DXF caret escapes are
+ * undone, followed by the ACIS character substitution (every character
+ * \c c other than a space was stored as <tt>159 - c</tt>).\n
+ * Line endings are not copied into \c buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_proprietary_data_range_decode_line
+(
+        FILE *file,
+                /*!< file positioned at the start of a value line. */
+        char **buffer,
+                /*!< pointer to the growing output buffer. */
+        size_t *length,
+                /*!< number of characters in \c buffer. */
+        size_t *size
+                /*!< allocated size of \c buffer. */
+)
+{
+        int c;
+        int escape = 0;
+        char *new_buffer = NULL;
+
+        while (((c = fgetc (file)) != EOF) && (c != '\n'))
+        {
+                if (c == '\r')
+                {
+                        continue;
+                }
+                if (escape)
+                {
+                        /* "^ " is a caret, "^X" is control character
+                         * X - 64. */
+                        c = (c == ' ') ? '^' : (c - 64);
+                        escape = 0;
+                }
+                else if (c == '^')
+                {
+                        escape = 1;
+                        continue;
+                }
+                if (c != ' ')
+                {
+                        c = 159 - c;
+                }
+                /* Keep room for the terminating '\0'. */
+                if (*length + 1 >= *size)
+                {
+                        new_buffer = realloc (*buffer, 2 * (*size));
+                        if (new_buffer == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        *buffer = new_buffer;
+                        *size = 2 * (*size);
+                }
+                (*buffer)[(*length)++] = (char) c;
+        }
+        (*buffer)[*length] = '\0';
+        return (ferror (file) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Open the DXF file of a \c DxfProprietaryDataRange at the
+ * start of the range.
+ *
+ * The file is only opened when its size and modification time are
+ * still the ones recorded when the range was read.
+ *
+ * \return the opened file, or \c NULL when the file was changed or
+ * could not be opened.
+ */
+static FILE *
+dxf_proprietary_data_range_open
+(
+        DxfProprietaryDataRange *range,
+                /*!< a pointer to a DXF \c DxfProprietaryDataRange
+                 * object. */
+        const char *function
+                /*!< name of the calling function, for the error
+                 * messages. */
+)
+{
+        FILE *file;
+        struct stat status;
+
+        file = fopen (range->filename, "r");
+        if (file == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s.\n")),
+                  function, range->filename);
+                return (NULL);
+        }
+        if ((range->file_size >= 0)
+          && ((fstat (fileno (file), &status) != 0)
+          || ((long) status.st_size != range->file_size)
+          || (status.st_mtime != range->file_mtime)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () file: %s was changed after it was read.\n")),
+                  function, range->filename);
+                fclose (file);
+                return (NULL);
+        }
+        if (fseek (file, range->begin, SEEK_SET) != 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s.\n")),
+                  function, range->filename);
+                fclose (file);
+                return (NULL);
+        }
+        return (file);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF \c DxfProprietaryDataRange object.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfProprietaryDataRange *
+dxf_proprietary_data_range_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryDataRange *range = NULL;
+        size_t size;
+
+        size = sizeof (DxfProprietaryDataRange);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((range = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfProprietaryDataRange struct.\n")),
+                  __FUNCTION__);
+                range = NULL;
+        }
+        else
+        {
+                memset (range, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (range);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF
+ * \c DxfProprietaryDataRange object.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfProprietaryDataRange *
+dxf_proprietary_data_range_init
+(
+        DxfProprietaryDataRange *range
+                /*!< a pointer to a DXF \c DxfProprietaryDataRange
+                 * object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                range = dxf_proprietary_data_range_new ();
+        }
+        if (range == NULL)
+        {
+              fprintf (stderr,
+                (_("Error in %s () could not allocate memory for a DxfProprietaryDataRange struct.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        range->filename = NULL;
+        range->begin = -1;
+        range->end = -1;
+        range->number_of_lines = 0;
+        range->file_size = -1;
+        range->file_mtime = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (range);
+}
+
+
+/*!
+ * \brief Record a group 1 or group 3 line of proprietary data in a
+ * DXF \c DxfProprietaryDataRange object.
+ *
+ * The last line read from file contained the group code, the value
+ * is skipped without being stored or decoded.\n
+ * Only the byte range of the lines is kept, which assumes the group 1
+ * and group 3 lines of an entity are consecutive, as written by
+ * AutoCAD.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_proprietary_data_range_read
+(
+        DxfFile *fp,
+                /*!< a DXF file pointer to an input file (or device). */
+        DxfProprietaryDataRange *range
+                /*!< a pointer to a DXF \c DxfProprietaryDataRange
+                 * object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        struct stat status;
+        int c;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Step past the end of the group code line if the reader did
+         * not consume it. */
+        c = fgetc (fp->fp);
+        if (c == '\r')
+        {
+                c = fgetc (fp->fp);
+        }
+        if (c != '\n')
+        {
+                ungetc (c, fp->fp);
+        }
+        if (range->number_of_lines == 0)
+        {
+                range->begin = ftell (fp->fp);
+                free (range->filename);
+                range->filename = strdup (fp->filename);
+                /* Remember which version of the file the offsets
+                 * belong to. */
+                range->file_size = -1;
+                if (fstat (fileno (fp->fp), &status) == 0)
+                {
+                        range->file_size = (long) status.st_size;
+                        range->file_mtime = status.st_mtime;
+                }
+        }
+        /* Skip the value. */
+        (fp->line_number)++;
+        while (((c = fgetc (fp->fp)) != EOF) && (c != '\n'))
+        {
+                ;
+        }
+        range->end = ftell (fp->fp);
+        range->number_of_lines++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (ferror (fp->fp) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read and decode the proprietary data of a DXF
+ * \c DxfProprietaryDataRange object.
+ *
+ * The DXF file is opened again and only the recorded byte range is
+ * read, provided the file was not changed after the range was
+ * read.\n
+ * Every group 1 line starts a new line of SAT text, group 3 lines are
+ * continuations of the previous line.
+ *
+ * \return a contiguous, '\\0' terminated buffer with the decoded SAT
+ * text, to be freed by the caller, or \c NULL when an error occurred.
+ */
+char *
+dxf_proprietary_data_range_decode
+(
+        DxfProprietaryDataRange *range,
+                /*!< a pointer to a DXF \c DxfProprietaryDataRange
+                 * object. */
+        size_t *length
+                /*!< the number of characters in the returned buffer,
+                 * may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        FILE *file = NULL;
+        char *buffer = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        size_t buffer_length = 0;
+        size_t buffer_size;
+        int group_code;
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((range->filename == NULL) || (range->number_of_lines == 0))
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () no proprietary data was recorded.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        file = dxf_proprietary_data_range_open (range, __FUNCTION__);
+        if (file == NULL)
+        {
+                return (NULL);
+        }
+        /* The decoded text is never longer than the encoded text. */
+        buffer_size = (size_t) (range->end - range->begin) + 1;
+        buffer = malloc (buffer_size);
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                fclose (file);
+                return (NULL);
+        }
+        buffer[0] = '\0';
+        /* The range starts at the value of the first group 1 line. */
+        status = dxf_proprietary_data_range_decode_line (file, &buffer, &buffer_length, &buffer_size);
+        while ((status == EXIT_SUCCESS)
+          && (ftell (file) < range->end)
+          && (fgets (code, DXF_MAX_STRING_LENGTH, file) != NULL))
+        {
+                /* Read the group code line with fgets () to keep any
+                 * leading spaces of the following value. */
+                group_code = (int) strtol (code, NULL, 10);
+                if (group_code == 1)
+                {
+                        buffer[buffer_length++] = '\n';
+                }
+                else if (group_code != 3)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () unexpected group code %d in proprietary data of file: %s.\n")),
+                          __FUNCTION__, group_code, range->filename);
+                }
+                status = dxf_proprietary_data_range_decode_line (file, &buffer, &buffer_length, &buffer_size);
+        }
+        fclose (file);
+        if (status == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s.\n")),
+                  __FUNCTION__, range->filename);
+                free (buffer);
+                return (NULL);
+        }
+        if (length != NULL)
+        {
+                *length = buffer_length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a DXF
+ * \c DxfProprietaryDataRange object.
+ *
+ * The group 1 and group 3 lines are copied from the recorded range of
+ * the source file without decoding them, provided the source file was
+ * not changed after the range was read.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_proprietary_data_range_write
+(
+        DxfFile *fp,
+                /*!< a DXF file pointer to an output file (or device). */
+        DxfProprietaryDataRange *range
+                /*!< a pointer to a DXF \c DxfProprietaryDataRange
+                 * object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        FILE *file = NULL;
+        int c;
+        int at_line_start = 1;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (range == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((range->filename == NULL) || (range->number_of_lines == 0))
+        {
+                return (EXIT_SUCCESS);
+        }
+        file = dxf_proprietary_data_range_open (range, __FUNCTION__);
+        if (file == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp->fp, "  1\n");
+        while ((ftell (file) < range->end)
+          && ((c = fgetc (file)) != EOF))
+        {
+                if (c == '\r')
+                {
+                        continue;
+                }
+                fputc (c, fp->fp);
+                at_line_start = (c == '\n');
+        }
+        if (!at_line_start)
+        {
+                fputc ('\n', fp->fp);
+        }
+        fclose (file);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF
+ * \c DxfProprietaryDataRange object and all it's data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_proprietary_data_range_free
+(
+        DxfProprietaryDataRange *range
+                /*!< a pointer to the memory occupied by the DXF
+                 * \c DxfProprietaryDataRange object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (range->filename);
+        free (range);
+        range = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy a \c DxfProprietaryDataRange.
+ *
+ * The copy refers to the same range of the same file, it does not
+ * share any memory with \c range.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfProprietaryDataRange *
+dxf_proprietary_data_range_copy
+(
+        DxfProprietaryDataRange *range
+                /*!< a pointer to a \c DxfProprietaryDataRange. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryDataRange *copy;
+
+        /* Do some basic checks. */
+        if (range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_proprietary_data_range_new ();
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        memcpy (copy, range, sizeof (DxfProprietaryDataRange));
+        copy->filename = NULL;
+        if ((range->filename != NULL)
+          && ((copy->filename = strdup (range->filename)) == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_proprietary_data_range_free (copy);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /* EOF */
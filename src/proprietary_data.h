@@ -67,6 +67,42 @@ dxf_proprietary_data_struct
 } DxfProprietaryData;
 
 
+/*!
+ * \brief DXF definition of a deferred block of proprietary data.
+ *
+ * Instead of the (often megabytes of) group 1 and group 3 lines with
+ * encoded ACIS data, only the byte range of these lines in the DXF file
+ * is kept.\n
+ * The data is read and decoded on demand with
+ * dxf_proprietary_data_range_decode ().\n
+ * The size and modification time of the DXF file are kept too:
+ * dxf_proprietary_data_range_decode () and
+ * dxf_proprietary_data_range_write () refuse to read the range when the
+ * file was changed or replaced after it was read, as the byte offsets
+ * would no longer point at the proprietary data.
+ */
+typedef struct
+dxf_proprietary_data_range_struct
+{
+        char *filename;
+                /*!< Name of the DXF file containing the data. */
+        long begin;
+                /*!< Byte offset of the value of the first group 1
+                 * line. */
+        long end;
+                /*!< Byte offset just past the value of the last group 1
+                 * or group 3 line. */
+        int number_of_lines;
+                /*!< Number of group 1 and group 3 lines in the range. */
+        long file_size;
+                /*!< Size in bytes of the DXF file when the range was
+                 * read, \c -1 when unknown. */
+        time_t file_mtime;
+                /*!< Modification time of the DXF file when the range
+                 * was read. */
+} DxfProprietaryDataRange;
+
+
 DxfProprietaryData *dxf_proprietary_data_new ();
 DxfProprietaryData *dxf_proprietary_data_init (DxfProprietaryData *data);
 int dxf_proprietary_data_free (DxfProprietaryData *data);
@@ -81,6 +117,13 @@ DxfProprietaryData *dxf_proprietary_data_set_length (DxfProprietaryData *data, i
 DxfProprietaryData *dxf_proprietary_data_get_next (DxfProprietaryData *data);
 DxfProprietaryData *dxf_proprietary_data_set_next (DxfProprietaryData *data, DxfProprietaryData *next);
 DxfProprietaryData *dxf_proprietary_data_get_last (DxfProprietaryData *data);
+DxfProprietaryDataRange *dxf_proprietary_data_range_new ();
+DxfProprietaryDataRange *dxf_proprietary_data_range_init (DxfProprietaryDataRange *range);
+int dxf_proprietary_data_range_read (DxfFile *fp, DxfProprietaryDataRange *range);
+char *dxf_proprietary_data_range_decode (DxfProprietaryDataRange *range, size_t *length);
+int dxf_proprietary_data_range_write (DxfFile *fp, DxfProprietaryDataRange *range);
+int dxf_proprietary_data_range_free (DxfProprietaryDataRange *range);
+DxfProprietaryDataRange *dxf_proprietary_data_range_copy (DxfProprietaryDataRange *range);
 
 
 #ifdef __cplusplus
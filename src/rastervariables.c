@@ -112,8 +112,8 @@ dxf_rastervariables_init
                 return (NULL);
         }
         rastervariables->id_code = 0;
-        rastervariables->dictionary_owner_soft = strdup ("");
-        rastervariables->dictionary_owner_hard = strdup ("");
+        rastervariables->dictionary_owner_soft = DXF_HANDLE_NONE;
+        rastervariables->dictionary_owner_hard = DXF_HANDLE_NONE;
         rastervariables->display_image_frame = 0;
         rastervariables->display_quality = 0;
         rastervariables->units = 0;
@@ -194,8 +194,7 @@ dxf_rastervariables_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &rastervariables->id_code);
+                        rastervariables->id_code = dxf_handle_read (fp);
                 }
                 if (strcmp (temp_string, "70") == 0)
                 {
@@ -243,16 +242,14 @@ dxf_rastervariables_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rastervariables->dictionary_owner_soft);
+                        rastervariables->dictionary_owner_soft = dxf_handle_read (fp);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rastervariables->dictionary_owner_hard);
+                        rastervariables->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -319,14 +316,14 @@ dxf_rastervariables_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, rastervariables->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (rastervariables->id_code != -1)
+        if (rastervariables->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", rastervariables->id_code);
+                dxf_handle_write (fp, 5, rastervariables->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -338,18 +335,18 @@ dxf_rastervariables_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (rastervariables->dictionary_owner_soft, "") != 0)
+        if ((rastervariables->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", rastervariables->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, rastervariables->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (rastervariables->dictionary_owner_hard, "") != 0)
+        if ((rastervariables->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", rastervariables->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, rastervariables->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -402,8 +399,6 @@ dxf_rastervariables_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (rastervariables->dictionary_owner_soft);
-        free (rastervariables->dictionary_owner_hard);
         free (rastervariables);
         rastervariables = NULL;
 #if DEBUG
@@ -437,6 +432,7 @@ dxf_rastervariables_free_list
         while (rastervariables != NULL)
         {
                 DxfRasterVariables *iter = (DxfRasterVariables *) rastervariables->next;
+                rastervariables->next = NULL;
                 dxf_rastervariables_free (rastervariables);
                 rastervariables = (DxfRasterVariables *) iter;
         }
@@ -451,7 +447,7 @@ dxf_rastervariables_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_rastervariables_get_id_code
 (
         DxfRasterVariables *rastervariables
@@ -469,12 +465,6 @@ dxf_rastervariables_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rastervariables->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -490,7 +480,7 @@ dxf_rastervariables_set_id_code
 (
         DxfRasterVariables *rastervariables,
                 /*!< a pointer to a DXF \c RASTERVARIABLES object. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -507,12 +497,6 @@ dxf_rastervariables_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         rastervariables->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -547,17 +531,10 @@ dxf_rastervariables_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rastervariables->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rastervariables->dictionary_owner_soft));
+        return (dxf_handle_to_string (rastervariables->dictionary_owner_soft));
 }
 
 
@@ -593,7 +570,7 @@ dxf_rastervariables_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        rastervariables->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        rastervariables->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -627,17 +604,10 @@ dxf_rastervariables_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rastervariables->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rastervariables->dictionary_owner_hard));
+        return (dxf_handle_to_string (rastervariables->dictionary_owner_hard));
 }
 
 
@@ -673,7 +643,7 @@ dxf_rastervariables_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        rastervariables->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        rastervariables->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
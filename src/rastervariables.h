@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -61,15 +62,15 @@ typedef struct
 dxf_rastervariables_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF rastervariables. */
@@ -120,8 +121,8 @@ DxfRasterVariables *dxf_rastervariables_read (DxfFile *fp, DxfRasterVariables *r
 int dxf_rastervariables_write (DxfFile *fp, DxfRasterVariables *rastervariables);
 int dxf_rastervariables_free (DxfRasterVariables *rastervariables);
 void dxf_rastervariables_free_list (DxfRasterVariables *rastervariables);
-int dxf_rastervariables_get_id_code (DxfRasterVariables *rastervariables);
-DxfRasterVariables *dxf_rastervariables_set_id_code (DxfRasterVariables *rastervariables, int id_code);
+DxfHandle dxf_rastervariables_get_id_code (DxfRasterVariables *rastervariables);
+DxfRasterVariables *dxf_rastervariables_set_id_code (DxfRasterVariables *rastervariables, DxfHandle id_code);
 char *dxf_rastervariables_get_dictionary_owner_soft (DxfRasterVariables *rastervariables);
 DxfRasterVariables *dxf_rastervariables_set_dictionary_owner_soft (DxfRasterVariables *rastervariables, char *dictionary_owner_soft);
 char *dxf_rastervariables_get_dictionary_owner_hard (DxfRasterVariables *rastervariables);
@@ -42,6 +42,7 @@
 
 
 #include "ray.h"
+#include "entities.h"
 
 
 /*!
@@ -113,27 +114,13 @@ dxf_ray_init
                 __FUNCTION__);
               return (NULL);
         }
-        ray->id_code = 0;
-        ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ray->layer = strdup (DXF_DEFAULT_LAYER);
-        ray->elevation = 0.0;
-        ray->thickness = 0.0;
-        ray->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        ray->visibility = DXF_DEFAULT_VISIBILITY;
-        ray->color = DXF_COLOR_BYLAYER;
-        ray->paperspace = DXF_MODELSPACE;
-        ray->graphics_data_size = 0;
-        ray->shadow_mode = 0;
-        ray->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        ray->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) ray->binary_graphics_data);
-        ray->dictionary_owner_soft = strdup ("");
-        ray->material = strdup ("");
-        ray->dictionary_owner_hard = strdup ("");
-        ray->lineweight = 0;
-        ray->plot_style_name = strdup ("");
-        ray->color_value = 0;
-        ray->color_name = strdup ("");
-        ray->transparency = 0;
+        if (dxf_entity_common_init (&ray->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         ray->p0 = (DxfPoint *) dxf_point_new ();
         ray->p0 = dxf_point_init ((DxfPoint *) ray->p0);
         ray->p0->x0 = 0.0;
@@ -176,7 +163,9 @@ dxf_ray_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,8 +173,6 @@ dxf_ray_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ray == NULL)
@@ -193,182 +180,91 @@ dxf_ray_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                ray = dxf_ray_init (ray);
+                ray = dxf_ray_init (dxf_ray_new ());
+                if (ray == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &ray->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (ray->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &ray->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &ray->visibility);
+                        break;
                 }
-                else if (strcmp (temp_string, "62") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ray->color);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &ray->paperspace);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbRay") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ray->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                ray->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                ray->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                ray->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                ray->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                ray->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                ray->p1->z0 = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbRay") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &ray->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (ray->linetype, "") == 0)
+        if ((ray->common.linetype == NULL)
+          || (strcmp (ray->common.linetype, "") == 0))
         {
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (ray->common.linetype);
+                ray->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ray->layer, "") == 0)
+        if ((ray->common.layer == NULL)
+          || (strcmp (ray->common.layer, "") == 0))
         {
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                free (ray->common.layer);
+                ray->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -420,8 +316,8 @@ dxf_ray_write
                 && (ray->p0->z0 == ray->p1->z0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ray->id_code);
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ray->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -433,31 +329,31 @@ dxf_ray_write
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (ray->linetype, "") == 0)
+        if (strcmp (ray->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ray->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ray->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ray->layer, "") == 0)
+        if (strcmp (ray->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, ray->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, ray->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ray->id_code != -1)
+        if (ray->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ray->id_code);
+                dxf_handle_write (fp, 5, ray->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -469,58 +365,58 @@ dxf_ray_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ray->dictionary_owner_soft, "") != 0)
+        if ((ray->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ray->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, ray->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (ray->dictionary_owner_hard, "") != 0)
+        if ((ray->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ray->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, ray->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (ray->paperspace == DXF_PAPERSPACE)
+        if (ray->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ray->layer);
-        if (strcmp (ray->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", ray->common.layer);
+        if (strcmp (ray->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", ray->linetype);
+                fprintf (fp->fp, "  6\n%s\n", ray->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (ray->elevation != 0.0))
+          && (ray->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ray->elevation);
+                fprintf (fp->fp, " 38\n%f\n", ray->common.elevation);
         }
-        if (ray->color != DXF_COLOR_BYLAYER)
+        if (ray->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", ray->color);
+                fprintf (fp->fp, " 62\n%hd\n", ray->common.color);
         }
-        if (ray->linetype_scale != 1.0)
+        if (ray->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ray->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", ray->common.linetype_scale);
         }
-        if (ray->visibility != 0)
+        if (ray->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", ray->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", ray->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbRay\n");
         }
-        if (ray->thickness != 0.0)
+        if (ray->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", ray->thickness);
+                fprintf (fp->fp, " 39\n%f\n", ray->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", ray->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", ray->p0->y0);
@@ -528,6 +424,7 @@ dxf_ray_write
         fprintf (fp->fp, " 11\n%f\n", ray->p1->x0);
         fprintf (fp->fp, " 21\n%f\n", ray->p1->y0);
         fprintf (fp->fp, " 31\n%f\n", ray->p1->z0);
+        dxf_entity_common_write_xdata (fp, &ray->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -570,10 +467,7 @@ dxf_ray_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ray->linetype);
-        free (ray->layer);
-        free (ray->dictionary_owner_soft);
-        free (ray->dictionary_owner_hard);
+        dxf_entity_common_free (&ray->common);
         dxf_point_free (ray->p0);
         dxf_point_free (ray->p1);
         free (ray);
@@ -609,6 +503,7 @@ dxf_ray_free_list
         while (rays != NULL)
         {
                 DxfRay *iter = (DxfRay *) rays->next;
+                rays->next = NULL;
                 dxf_ray_free (rays);
                 rays = (DxfRay *) iter;
         }
@@ -618,12 +513,86 @@ dxf_ray_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c RAY entity.
+ *
+ * The copy does not share any memory with \c ray, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfRay *
+dxf_ray_copy
+(
+        DxfRay *ray
+                /*!< a pointer to the DXF \c RAY entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRay *copy;
+
+        /* Do some basic checks. */
+        if (ray == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_ray_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, ray, sizeof (DxfRay));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &ray->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_ray_free (copy);
+                return (NULL);
+        }
+        if (ray->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (ray->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_ray_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ray->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (ray->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_ray_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c RAY entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_ray_get_id_code
 (
         DxfRay *ray
@@ -641,16 +610,10 @@ dxf_ray_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->id_code);
+        return (ray->common.id_code);
 }
 
 
@@ -662,7 +625,7 @@ dxf_ray_set_id_code
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -679,13 +642,7 @@ dxf_ray_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        ray->id_code = id_code;
+        ray->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -716,7 +673,7 @@ dxf_ray_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->linetype ==  NULL)
+        if (ray->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -726,7 +683,7 @@ dxf_ray_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->linetype));
+        return (strdup (ray->common.linetype));
 }
 
 
@@ -761,7 +718,7 @@ dxf_ray_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->linetype = strdup (linetype);
+        ray->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -792,7 +749,7 @@ dxf_ray_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->layer ==  NULL)
+        if (ray->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -802,7 +759,7 @@ dxf_ray_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->layer));
+        return (strdup (ray->common.layer));
 }
 
 
@@ -837,7 +794,7 @@ dxf_ray_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->layer = strdup (layer);
+        ray->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -871,7 +828,7 @@ dxf_ray_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->elevation);
+        return (ray->common.elevation);
 }
 
 
@@ -898,7 +855,7 @@ dxf_ray_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->elevation = elevation;
+        ray->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -929,7 +886,7 @@ dxf_ray_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->thickness < 0.0)
+        if (ray->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -939,7 +896,7 @@ dxf_ray_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->thickness);
+        return (ray->common.thickness);
 }
 
 
@@ -973,7 +930,7 @@ dxf_ray_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->thickness = thickness;
+        ray->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1004,7 +961,7 @@ dxf_ray_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->linetype_scale < 0.0)
+        if (ray->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1014,7 +971,7 @@ dxf_ray_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->linetype_scale);
+        return (ray->common.linetype_scale);
 }
 
 
@@ -1048,7 +1005,7 @@ dxf_ray_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->linetype_scale = linetype_scale;
+        ray->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1079,14 +1036,14 @@ dxf_ray_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->visibility < 0)
+        if (ray->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->visibility > 1)
+        if (ray->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1096,7 +1053,7 @@ dxf_ray_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->visibility);
+        return (ray->common.visibility);
 }
 
 
@@ -1137,7 +1094,7 @@ dxf_ray_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->visibility = visibility;
+        ray->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1168,7 +1125,7 @@ dxf_ray_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->color < 0)
+        if (ray->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1177,7 +1134,7 @@ dxf_ray_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->color);
+        return (ray->common.color);
 }
 
 
@@ -1210,7 +1167,7 @@ dxf_ray_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        ray->color = color;
+        ray->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1241,13 +1198,13 @@ dxf_ray_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->paperspace < 0)
+        if (ray->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ray->paperspace > 1)
+        if (ray->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1256,7 +1213,7 @@ dxf_ray_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->paperspace);
+        return (ray->common.paperspace);
 }
 
 
@@ -1298,7 +1255,7 @@ dxf_ray_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->paperspace = paperspace;
+        ray->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1330,13 +1287,13 @@ dxf_ray_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->graphics_data_size < 0)
+        if (ray->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (ray->graphics_data_size == 0)
+        if (ray->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1345,7 +1302,7 @@ dxf_ray_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->graphics_data_size);
+        return (ray->common.cold->graphics_data_size);
 }
 
 
@@ -1389,7 +1346,7 @@ dxf_ray_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        ray->graphics_data_size = graphics_data_size;
+        ray->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1421,14 +1378,14 @@ dxf_ray_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->shadow_mode < 0)
+        if (ray->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ray->shadow_mode > 3)
+        if (ray->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1438,7 +1395,7 @@ dxf_ray_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->shadow_mode);
+        return (ray->common.cold->shadow_mode);
 }
 
 
@@ -1482,7 +1439,7 @@ dxf_ray_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->shadow_mode = shadow_mode;
+        ray->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1494,11 +1451,12 @@ dxf_ray_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c RAY entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_ray_get_binary_graphics_data
 (
         DxfRay *ray
@@ -1516,32 +1474,31 @@ dxf_ray_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) ray->binary_graphics_data);
+        return (ray->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c RAY entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c ray when successful, or \c NULL when an
+ * error occurred.
  */
 DxfRay *
 dxf_ray_set_binary_graphics_data
 (
         DxfRay *ray,
                 /*!< a pointer to a DXF \c RAY entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1562,7 +1519,12 @@ dxf_ray_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((ray->common.cold->binary_graphics_data != NULL)
+          && (ray->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (ray->common.cold->binary_graphics_data);
+        }
+        ray->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1596,17 +1558,10 @@ dxf_ray_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->dictionary_owner_soft));
+        return (dxf_handle_to_string (ray->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1642,7 +1597,7 @@ dxf_ray_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ray->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1676,17 +1631,10 @@ dxf_ray_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->material));
+        return (dxf_handle_to_string (ray->common.cold->material));
 }
 
 
@@ -1724,7 +1672,7 @@ dxf_ray_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->material = strdup (material);
+        ray->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1758,17 +1706,10 @@ dxf_ray_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->dictionary_owner_hard));
+        return (dxf_handle_to_string (ray->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1804,7 +1745,7 @@ dxf_ray_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ray->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1839,7 +1780,7 @@ dxf_ray_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->lineweight);
+        return (ray->common.lineweight);
 }
 
 
@@ -1869,7 +1810,7 @@ dxf_ray_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->lineweight = lineweight;
+        ray->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1901,17 +1842,10 @@ dxf_ray_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->plot_style_name));
+        return (dxf_handle_to_string (ray->common.cold->plot_style_name));
 }
 
 
@@ -1949,7 +1883,7 @@ dxf_ray_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->plot_style_name = strdup (plot_style_name);
+        ray->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1984,7 +1918,7 @@ dxf_ray_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->color_value);
+        return (ray->common.color_value);
 }
 
 
@@ -2014,7 +1948,7 @@ dxf_ray_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->color_value = color_value;
+        ray->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2046,7 +1980,7 @@ dxf_ray_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ray->color_name ==  NULL)
+        if (ray->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2056,7 +1990,7 @@ dxf_ray_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ray->color_name));
+        return (strdup (ray->common.cold->color_name));
 }
 
 
@@ -2094,7 +2028,7 @@ dxf_ray_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->color_name = strdup (color_name);
+        ray->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2129,7 +2063,7 @@ dxf_ray_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (ray->transparency);
+        return (ray->common.cold->transparency);
 }
 
 
@@ -2159,7 +2093,7 @@ dxf_ray_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        ray->transparency = transparency;
+        ray->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
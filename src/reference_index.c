@@ -0,0 +1,1069 @@
+/*!
+ * \file reference_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for an index of the references to a handle.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "reference_index.h"
+#include "entities.h"
+
+
+/*!
+ * \brief Compute the home slot of a handle (Fibonacci hashing).
+ */
+static size_t
+dxf_reference_index_home
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle handle
+                /*!< the handle. */
+)
+{
+        return ((size_t) ((handle * UINT64_C (0x9E3779B97F4A7C15)) >> 32) & (index->size - 1));
+}
+
+
+/*!
+ * \brief Find the slot of a handle.
+ *
+ * \return a pointer to the slot, or \c NULL when the handle is not in
+ * the index.
+ */
+static DxfReferenceIndexSlot *
+dxf_reference_index_find_slot
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle handle
+                /*!< the handle. */
+)
+{
+        size_t i;
+
+        if ((index->size == 0)
+          || (handle == DXF_HANDLE_NONE))
+        {
+                return (NULL);
+        }
+        i = dxf_reference_index_home (index, handle);
+        while (index->slots[i].handle != DXF_HANDLE_NONE)
+        {
+                if (index->slots[i].handle == handle)
+                {
+                        return (&index->slots[i]);
+                }
+                i = (i + 1) & (index->size - 1);
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Get the slot of a handle, store the handle in an empty slot
+ * when it is not in the index.
+ *
+ * The table must have room for one more handle.
+ */
+static DxfReferenceIndexSlot *
+dxf_reference_index_get_slot
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle handle
+                /*!< the handle. */
+)
+{
+        size_t i;
+
+        i = dxf_reference_index_home (index, handle);
+        while (index->slots[i].handle != DXF_HANDLE_NONE)
+        {
+                if (index->slots[i].handle == handle)
+                {
+                        return (&index->slots[i]);
+                }
+                i = (i + 1) & (index->size - 1);
+        }
+        index->slots[i].handle = handle;
+        index->slots[i].first_in = -1;
+        index->slots[i].first_out = -1;
+        index->slots[i].degree = 0;
+        index->number_of_handles++;
+        return (&index->slots[i]);
+}
+
+
+/*!
+ * \brief Make room for \c number_of_handles handles, keeping the table
+ * at most half full.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_reference_index_reserve
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        size_t number_of_handles
+                /*!< number of handles to make room for. */
+)
+{
+        DxfReferenceIndexSlot *old_slots;
+        size_t old_size;
+        size_t size;
+        size_t i;
+        size_t j;
+
+        if (2 * number_of_handles <= index->size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        size = (index->size == 0) ? 64 : index->size;
+        while (size < 2 * number_of_handles)
+        {
+                size *= 2;
+        }
+        old_slots = index->slots;
+        old_size = index->size;
+        index->slots = calloc (size, sizeof (DxfReferenceIndexSlot));
+        if (index->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                index->slots = old_slots;
+                return (EXIT_FAILURE);
+        }
+        index->size = size;
+        for (i = 0; i < old_size; i++)
+        {
+                if (old_slots[i].handle == DXF_HANDLE_NONE)
+                {
+                        continue;
+                }
+                j = dxf_reference_index_home (index, old_slots[i].handle);
+                while (index->slots[j].handle != DXF_HANDLE_NONE)
+                {
+                        j = (j + 1) & (index->size - 1);
+                }
+                index->slots[j] = old_slots[i];
+        }
+        free (old_slots);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Unlink a reference from the lists of its target and source,
+ * and put it on the list of removed references.
+ */
+static void
+dxf_reference_index_unlink
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        int reference
+                /*!< id of the reference. */
+)
+{
+        DxfReference *references = index->references;
+        DxfReferenceIndexSlot *slot;
+        int *link;
+
+        slot = dxf_reference_index_find_slot (index, references[reference].target);
+        for (link = &slot->first_in; *link != reference; link = &references[*link].next_in)
+        {
+                ;
+        }
+        *link = references[reference].next_in;
+        slot->degree--;
+        slot = dxf_reference_index_find_slot (index, references[reference].source);
+        for (link = &slot->first_out; *link != reference; link = &references[*link].next_out)
+        {
+                ;
+        }
+        *link = references[reference].next_out;
+        references[reference].kind = -1;
+        references[reference].next_out = -1;
+        references[reference].next_in = index->first_free;
+        index->first_free = reference;
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfReferenceIndex.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfReferenceIndex *
+dxf_reference_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReferenceIndex *index = NULL;
+        size_t size;
+
+        size = sizeof (DxfReferenceIndex);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((index = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfReferenceIndex struct.\n")),
+                  __FUNCTION__);
+                index = NULL;
+        }
+        else
+        {
+                memset (index, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfReferenceIndex.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfReferenceIndex *
+dxf_reference_index_init
+(
+        DxfReferenceIndex *index
+                /*!< a pointer to a reference index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                index = dxf_reference_index_new ();
+        }
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        index->slots = NULL;
+        index->size = 0;
+        index->number_of_handles = 0;
+        index->references = NULL;
+        index->number_of_references = 0;
+        index->references_size = 0;
+        index->first_free = -1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfReferenceIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_free
+(
+        DxfReferenceIndex *index
+                /*!< a pointer to a reference index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (index->slots);
+        free (index->references);
+        free (index);
+        index = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a reference to a \c DxfReferenceIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_add
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle source,
+                /*!< handle of the referring item. */
+        DxfHandle target,
+                /*!< handle of the referenced item. */
+        int kind,
+                /*!< a \c DxfReferenceKind. */
+        int group_code
+                /*!< group code of the pointer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReference *references;
+        DxfReferenceIndexSlot *slot;
+        int reference;
+        int size;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((source == DXF_HANDLE_NONE)
+          || (target == DXF_HANDLE_NONE))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_reference_index_reserve (index, index->number_of_handles + 2) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (index->first_free >= 0)
+        {
+                reference = index->first_free;
+                index->first_free = index->references[reference].next_in;
+        }
+        else
+        {
+                if (index->number_of_references == index->references_size)
+                {
+                        size = (index->references_size == 0) ? 64 : 2 * index->references_size;
+                        references = realloc (index->references, size * sizeof (DxfReference));
+                        if (references == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (EXIT_FAILURE);
+                        }
+                        index->references = references;
+                        index->references_size = size;
+                }
+                reference = index->number_of_references;
+                index->number_of_references++;
+        }
+        index->references[reference].source = source;
+        index->references[reference].target = target;
+        index->references[reference].kind = kind;
+        index->references[reference].group_code = group_code;
+        slot = dxf_reference_index_get_slot (index, target);
+        index->references[reference].next_in = slot->first_in;
+        slot->first_in = reference;
+        slot->degree++;
+        slot = dxf_reference_index_get_slot (index, source);
+        index->references[reference].next_out = slot->first_out;
+        slot->first_out = reference;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove a reference from a \c DxfReferenceIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when there is
+ * no such reference or an error occurred.
+ */
+int
+dxf_reference_index_remove
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle source,
+                /*!< handle of the referring item. */
+        DxfHandle target
+                /*!< handle of the referenced item. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReferenceIndexSlot *slot;
+        int reference;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        slot = dxf_reference_index_find_slot (index, target);
+        if (slot == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (reference = slot->first_in; reference >= 0; reference = index->references[reference].next_in)
+        {
+                if (index->references[reference].source == source)
+                {
+                        dxf_reference_index_unlink (index, reference);
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (EXIT_SUCCESS);
+                }
+        }
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Remove all references to and from a handle, for instance when
+ * the item is deleted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_remove_handle
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle handle
+                /*!< the handle of the deleted item. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReferenceIndexSlot *slot;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        slot = dxf_reference_index_find_slot (index, handle);
+        if (slot == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        while (slot->first_in >= 0)
+        {
+                dxf_reference_index_unlink (index, slot->first_in);
+        }
+        while (slot->first_out >= 0)
+        {
+                dxf_reference_index_unlink (index, slot->first_out);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of references to a handle.
+ *
+ * \return the number of references, or -1 when an error occurred.
+ */
+int
+dxf_reference_index_get_degree
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle target
+                /*!< handle of the referenced item. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReferenceIndexSlot *slot;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        slot = dxf_reference_index_find_slot (index, target);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((slot == NULL) ? 0 : slot->degree);
+}
+
+
+/*!
+ * \brief Get the handles of the items referring to a handle.
+ *
+ * At most \c max_sources handles are stored in \c sources, a handle is
+ * stored once for each reference.
+ *
+ * \return the number of references of kind \c kind, which may be more
+ * than \c max_sources, or -1 when an error occurred.
+ */
+int
+dxf_reference_index_get_referrers
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle target,
+                /*!< handle of the referenced item. */
+        int kind,
+                /*!< a \c DxfReferenceKind, or -1 for any kind. */
+        DxfHandle *sources,
+                /*!< receives the handles of the referring items, may
+                 * be \c NULL when \c max_sources is 0. */
+        int max_sources
+                /*!< number of handles \c sources can hold. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReferenceIndexSlot *slot;
+        int reference;
+        int count = 0;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || ((sources == NULL) && (max_sources > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        slot = dxf_reference_index_find_slot (index, target);
+        if (slot == NULL)
+        {
+                return (0);
+        }
+        for (reference = slot->first_in; reference >= 0; reference = index->references[reference].next_in)
+        {
+                if ((kind >= 0)
+                  && (index->references[reference].kind != kind))
+                {
+                        continue;
+                }
+                if (count < max_sources)
+                {
+                        sources[count] = index->references[reference].source;
+                }
+                count++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (count);
+}
+
+
+/*!
+ * \brief Test if a handle is referenced.
+ *
+ * \return \c TRUE when there is a reference of kind \c kind to
+ * \c target, \c FALSE when there is not.
+ */
+int
+dxf_reference_index_is_referenced
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfHandle target,
+                /*!< handle of the referenced item. */
+        int kind
+                /*!< a \c DxfReferenceKind, or -1 for any kind. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_reference_index_get_referrers (index, target, kind, NULL, 0) > 0);
+}
+
+
+/*!
+ * \brief Add the entities in a list of \c GROUP objects to a
+ * \c DxfReferenceIndex.
+ *
+ * Each list node holds one entity of the group with handle
+ * \c id_code.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_add_groups
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfGroup *groups
+                /*!< a list of \c GROUP objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfGroup *iter;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = groups; iter != NULL; iter = (DxfGroup *) iter->next)
+        {
+                if ((iter->id_code == 0)
+                  || (iter->handle_entity_in_group == DXF_HANDLE_NONE))
+                {
+                        continue;
+                }
+                if (dxf_reference_index_add (index, iter->id_code,
+                  iter->handle_entity_in_group, DXF_REFERENCE_GROUP, 340) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the entity pointers of a list of \c IDBUFFER objects to a
+ * \c DxfReferenceIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_add_idbuffers
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfIdbuffer *idbuffers
+                /*!< a list of \c IDBUFFER objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfIdbuffer *iter;
+        DxfIdbufferEntityPointer *entity_pointer;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = idbuffers; iter != NULL; iter = (DxfIdbuffer *) iter->next)
+        {
+                if (iter->id_code == 0)
+                {
+                        continue;
+                }
+                for (entity_pointer = iter->entity_pointer;
+                  entity_pointer != NULL;
+                  entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next)
+                {
+                        if (entity_pointer->soft_pointer == DXF_HANDLE_NONE)
+                        {
+                                continue;
+                        }
+                        if (dxf_reference_index_add (index, iter->id_code,
+                          entity_pointer->soft_pointer, DXF_REFERENCE_IDBUFFER, 330) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the images of a list of \c IMAGEDEF_REACTOR objects to a
+ * \c DxfReferenceIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_add_imagedef_reactors
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfImagedefReactor *imagedef_reactors
+                /*!< a list of \c IMAGEDEF_REACTOR objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfImagedefReactor *iter;
+        DxfHandle image;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = imagedef_reactors; iter != NULL; iter = (DxfImagedefReactor *) iter->next)
+        {
+                image = iter->associated_image_object;
+                if ((iter->id_code == 0)
+                  || (image == DXF_HANDLE_NONE))
+                {
+                        continue;
+                }
+                if (dxf_reference_index_add (index, iter->id_code,
+                  image, DXF_REFERENCE_IMAGEDEF_REACTOR, 330) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the entries of a \c DICTIONARY object to a
+ * \c DxfReferenceIndex.
+ *
+ * Each list node holds one entry of the dictionary with handle
+ * \c id_code.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_add_dictionary
+(
+        DxfReferenceIndex *index,
+                /*!< a pointer to a reference index. */
+        DxfDictionary *dictionary
+                /*!< the entries of a \c DICTIONARY object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDictionary *iter;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = dictionary; iter != NULL; iter = (DxfDictionary *) iter->next)
+        {
+                if ((iter->id_code == 0)
+                  || (iter->entry_object_handle == DXF_HANDLE_NONE))
+                {
+                        continue;
+                }
+                if (dxf_reference_index_add (index, iter->id_code,
+                  iter->entry_object_handle, DXF_REFERENCE_DICTIONARY, 350) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Scan a DXF section for references.
+ *
+ * The file is expected to be positioned just after the
+ * "  2\n<section name>" lines, any section with handles can be
+ * scanned (\c TABLES, \c BLOCKS, \c ENTITIES or \c OBJECTS).\n
+ * The pointer group codes 330 up to 369 and 1005 of every item are
+ * added as references from the handle (group code 5 or 105) of the
+ * item, up to and including the \c ENDSEC marker.\n
+ * The kind of a reference follows from the group code, the item type
+ * and the 102 group it is in.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_reference_index_scan
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfReferenceIndex *index
+                /*!< a pointer to a reference index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReference *pending = NULL;
+        DxfReference *references;
+        char code[DXF_MAX_STRING_LENGTH];
+        char name[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        DxfHandle handle = DXF_HANDLE_NONE;
+        DxfHandle target;
+        int number_of_pending = 0;
+        int pending_size = 0;
+        int in_group = 0;
+        int subclass = FALSE;
+        int group_code;
+        int kind;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if ((fp == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        name[0] = '\0';
+        for (;;)
+        {
+                if ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                  || (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        status = EXIT_FAILURE;
+                        break;
+                }
+                fp->line_number += 2;
+                group_code = atoi (code);
+                if (group_code == 0)
+                {
+                        /* The handle of the item is known now. */
+                        for (i = 0; (i < number_of_pending) && (handle != DXF_HANDLE_NONE); i++)
+                        {
+                                if (dxf_reference_index_add (index, handle, pending[i].target,
+                                  pending[i].kind, pending[i].group_code) == EXIT_FAILURE)
+                                {
+                                        status = EXIT_FAILURE;
+                                        break;
+                                }
+                        }
+                        if ((status == EXIT_FAILURE)
+                          || (strcmp (value, "ENDSEC") == 0))
+                        {
+                                break;
+                        }
+                        strcpy (name, value);
+                        handle = DXF_HANDLE_NONE;
+                        number_of_pending = 0;
+                        in_group = 0;
+                        subclass = FALSE;
+                        continue;
+                }
+                if ((group_code == 5)
+                  || (group_code == 105))
+                {
+                        handle = dxf_handle_parse (value);
+                        continue;
+                }
+                if (group_code == 100)
+                {
+                        subclass = TRUE;
+                        continue;
+                }
+                if (group_code == 102)
+                {
+                        if (strcmp (value, "{ACAD_REACTORS") == 0)
+                        {
+                                in_group = 1;
+                        }
+                        else if (strcmp (value, "{ACAD_XDICTIONARY") == 0)
+                        {
+                                in_group = 2;
+                        }
+                        else
+                        {
+                                in_group = (value[0] == '{') ? 3 : 0;
+                        }
+                        continue;
+                }
+                if (((group_code < 330) || (group_code > 369))
+                  && (group_code != 1005))
+                {
+                        continue;
+                }
+                target = dxf_handle_parse (value);
+                if (target == DXF_HANDLE_NONE)
+                {
+                        continue;
+                }
+                if (in_group == 1)
+                {
+                        kind = DXF_REFERENCE_REACTOR;
+                }
+                else if (in_group == 2)
+                {
+                        kind = DXF_REFERENCE_OWNER;
+                }
+                else if (in_group == 3)
+                {
+                        kind = DXF_REFERENCE_OTHER;
+                }
+                else if (((strcmp (name, "DICTIONARY") == 0)
+                  || (strcmp (name, "ACDBDICTIONARYWDFLT") == 0))
+                  && ((group_code == 350) || (group_code == 360)))
+                {
+                        kind = DXF_REFERENCE_DICTIONARY;
+                }
+                else if ((strcmp (name, "GROUP") == 0)
+                  && (group_code == 340))
+                {
+                        kind = DXF_REFERENCE_GROUP;
+                }
+                else if ((strcmp (name, "IDBUFFER") == 0)
+                  && (group_code == 330)
+                  && (subclass))
+                {
+                        kind = DXF_REFERENCE_IDBUFFER;
+                }
+                else if ((strcmp (name, "IMAGEDEF_REACTOR") == 0)
+                  && (group_code == 330)
+                  && (subclass))
+                {
+                        kind = DXF_REFERENCE_IMAGEDEF_REACTOR;
+                }
+                else if (group_code == 330)
+                {
+                        kind = DXF_REFERENCE_OWNER;
+                }
+                else
+                {
+                        kind = DXF_REFERENCE_OTHER;
+                }
+                if (number_of_pending == pending_size)
+                {
+                        pending_size = (pending_size == 0) ? 16 : 2 * pending_size;
+                        references = realloc (pending, pending_size * sizeof (DxfReference));
+                        if (references == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                status = EXIT_FAILURE;
+                                break;
+                        }
+                        pending = references;
+                }
+                pending[number_of_pending].target = target;
+                pending[number_of_pending].kind = kind;
+                pending[number_of_pending].group_code = group_code;
+                number_of_pending++;
+        }
+        free (pending);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
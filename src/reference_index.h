@@ -0,0 +1,177 @@
+/*!
+ * \file reference_index.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for an index of the references to a handle.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_REFERENCE_INDEX_H
+#define LIBDXF_SRC_REFERENCE_INDEX_H
+
+
+#include "global.h"
+#include "handle.h"
+#include "dictionary.h"
+#include "group.h"
+#include "idbuffer.h"
+#include "imagedef_reactor.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Kinds of references between the items of a DXF drawing.
+ */
+typedef enum
+dxf_reference_kind
+{
+        DXF_REFERENCE_OWNER,
+                /*!< Owner of an item (group code 330, 360 in an
+                 * {ACAD_XDICTIONARY group). */
+        DXF_REFERENCE_REACTOR,
+                /*!< Persistent reactor (group code 330 in an
+                 * {ACAD_REACTORS group). */
+        DXF_REFERENCE_DICTIONARY,
+                /*!< Dictionary entry (group code 350 or 360). */
+        DXF_REFERENCE_GROUP,
+                /*!< Entity in a \c GROUP (group code 340). */
+        DXF_REFERENCE_IDBUFFER,
+                /*!< Entity in an \c IDBUFFER (group code 330). */
+        DXF_REFERENCE_IMAGEDEF_REACTOR,
+                /*!< Image of an \c IMAGEDEF_REACTOR (group code 330). */
+        DXF_REFERENCE_OTHER
+                /*!< Any other pointer (group codes 331 up to 369). */
+} DxfReferenceKind;
+
+
+/*!
+ * \brief Reference from one handle to another.
+ */
+typedef struct
+dxf_reference_struct
+{
+        DxfHandle source;
+                /*!< Handle of the referring item. */
+        DxfHandle target;
+                /*!< Handle of the referenced item. */
+        int kind;
+                /*!< A \c DxfReferenceKind, -1 for a removed
+                 * reference. */
+        int group_code;
+                /*!< Group code of the pointer. */
+        int next_in;
+                /*!< Next reference to \c target, -1 for the last one. */
+        int next_out;
+                /*!< Next reference from \c source, -1 for the last
+                 * one. */
+} DxfReference;
+
+
+/*!
+ * \brief Slot of a reference index.
+ */
+typedef struct
+dxf_reference_index_slot_struct
+{
+        DxfHandle handle;
+                /*!< Handle, \c DXF_HANDLE_NONE for an empty slot. */
+        int first_in;
+                /*!< First reference to \c handle, -1 when there are
+                 * none. */
+        int first_out;
+                /*!< First reference from \c handle, -1 when there are
+                 * none. */
+        int degree;
+                /*!< Number of references to \c handle. */
+} DxfReferenceIndexSlot;
+
+
+/*!
+ * \brief Index of the references between the items of a DXF drawing,
+ * keyed by target handle.
+ *
+ * Each handle has a slot in an open addressing hash, with the heads of
+ * the linked lists of references to and from that handle, so finding,
+ * adding or removing the references of a handle costs O(degree)
+ * instead of a scan of the drawing.\n
+ * The references live in one contiguous array, removed references are
+ * reused.
+ */
+typedef struct
+dxf_reference_index_struct
+{
+        DxfReferenceIndexSlot *slots;
+                /*!< Contiguous array of \c size slots. */
+        size_t size;
+                /*!< Number of slots, a power of two or 0. */
+        size_t number_of_handles;
+                /*!< Number of slots in use. */
+        DxfReference *references;
+                /*!< Contiguous array with the references. */
+        int number_of_references;
+                /*!< Number of items in use in \c references, including
+                 * the removed references. */
+        int references_size;
+                /*!< Number of items allocated for \c references. */
+        int first_free;
+                /*!< First removed reference, chained through
+                 * \c next_in, -1 when there are none. */
+} DxfReferenceIndex;
+
+
+DxfReferenceIndex *dxf_reference_index_new ();
+DxfReferenceIndex *dxf_reference_index_init (DxfReferenceIndex *index);
+int dxf_reference_index_free (DxfReferenceIndex *index);
+int dxf_reference_index_add (DxfReferenceIndex *index, DxfHandle source, DxfHandle target, int kind, int group_code);
+int dxf_reference_index_remove (DxfReferenceIndex *index, DxfHandle source, DxfHandle target);
+int dxf_reference_index_remove_handle (DxfReferenceIndex *index, DxfHandle handle);
+int dxf_reference_index_get_degree (DxfReferenceIndex *index, DxfHandle target);
+int dxf_reference_index_get_referrers (DxfReferenceIndex *index, DxfHandle target, int kind, DxfHandle *sources, int max_sources);
+int dxf_reference_index_is_referenced (DxfReferenceIndex *index, DxfHandle target, int kind);
+int dxf_reference_index_add_groups (DxfReferenceIndex *index, DxfGroup *groups);
+int dxf_reference_index_add_idbuffers (DxfReferenceIndex *index, DxfIdbuffer *idbuffers);
+int dxf_reference_index_add_imagedef_reactors (DxfReferenceIndex *index, DxfImagedefReactor *imagedef_reactors);
+int dxf_reference_index_add_dictionary (DxfReferenceIndex *index, DxfDictionary *dictionary);
+int dxf_reference_index_scan (DxfFile *fp, DxfReferenceIndex *index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_REFERENCE_INDEX_H */
+
+
+/* EOF */
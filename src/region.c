@@ -42,6 +42,7 @@
 
 
 #include "region.h"
+#include "entities.h"
 
 
 /*!
@@ -111,29 +112,25 @@ dxf_region_init
                 __FUNCTION__);
               return (NULL);
         }
+        region->proprietary_data_range = dxf_proprietary_data_range_init (dxf_proprietary_data_range_new ());
+        if (region->proprietary_data_range == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         region->modeler_format_version_number = 0;
-        region->id_code = 0;
-        region->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        region->layer = strdup (DXF_DEFAULT_LAYER);
-        region->elevation = 0.0;
-        region->thickness = 0.0;
-        region->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        region->visibility = DXF_DEFAULT_VISIBILITY;
-        region->color = DXF_COLOR_BYLAYER;
-        region->paperspace = DXF_MODELSPACE;
+        if (dxf_entity_common_init (&region->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         region->modeler_format_version_number = 1;
-        dxf_char_new (region->proprietary_data);
-        region->proprietary_data = dxf_char_init (region->proprietary_data);
-        region->proprietary_data->value = strdup ("");
-        region->proprietary_data->length = 0;
-        region->proprietary_data->next = NULL;
-        dxf_char_new (region->additional_proprietary_data);
-        region->additional_proprietary_data = dxf_char_init (region->additional_proprietary_data);
-        region->additional_proprietary_data->value = strdup ("");
-        region->additional_proprietary_data->length = 0;
-        region->additional_proprietary_data->next = NULL;
-        region->dictionary_owner_soft = strdup ("");
-        region->dictionary_owner_hard = strdup ("");
+        region->proprietary_data = dxf_char_init (dxf_char_new ());
+        region->additional_proprietary_data = dxf_char_init (dxf_char_new ());
         region->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -166,9 +163,9 @@ dxf_region_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfChar *iter1 = NULL;
-        DxfChar *iter2 = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -176,8 +173,6 @@ dxf_region_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (region == NULL)
@@ -185,166 +180,85 @@ dxf_region_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                region = dxf_region_init (region);
+                region = dxf_region_init (dxf_region_new ());
+                if (region == NULL)
+                {
+                        return (NULL);
+                }
         }
-        iter1 = (DxfChar *) region->proprietary_data;
-        iter2 = (DxfChar *) region->additional_proprietary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                else if (strcmp (temp_string, "  1") == 0)
-                {
-                        /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter1->value);
-                        iter1->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter1->next);
-                        iter1 = (DxfChar *) iter1->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter2->value);
-                        iter2->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter2->next);
-                        iter2 = (DxfChar *) iter2->next;
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &region->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->layer);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (region->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &region->elevation);
+                        break;
                 }
-                else if (strcmp (temp_string, "39") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &region->thickness);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "48") == 0)
+                if ((group_code == 1) || (group_code == 3))
                 {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &region->linetype_scale);
+                        /* Proprietary data, only record where it is. */
+                        dxf_proprietary_data_range_read (fp, region->proprietary_data_range);
+                        continue;
                 }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &region->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &region->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &region->paperspace);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "70") == 0))
-                {
-                        /* Now follows a string containing the modeler
-                         * format version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &region->modeler_format_version_number);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                        {
-                                fprintf (stderr, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
-                                        fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 70:
+                                if (fp->acad_version_number >= AutoCAD_13)
+                                {
+                                        region->modeler_format_version_number = atoi (value);
+                                }
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbModelerGeometry") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &region->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (region->linetype, "") == 0)
+        if ((region->common.linetype == NULL)
+          || (strcmp (region->common.linetype, "") == 0))
         {
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (region->common.linetype);
+                region->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (region->layer, "") == 0)
+        if ((region->common.layer == NULL)
+          || (strcmp (region->common.layer, "") == 0))
         {
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                free (region->common.layer);
+                region->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -396,34 +310,34 @@ dxf_region_write
         if (fp->acad_version_number < AutoCAD_13)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, region->id_code);
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, region->common.id_code);
         }
-        if (strcmp (region->linetype, "") == 0)
+        if (strcmp (region->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, region->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, region->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                region->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (region->layer, "") == 0)
+        if (strcmp (region->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, region->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, region->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                region->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (region->id_code != -1)
+        if (region->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", region->id_code);
+                dxf_handle_write (fp, 5, region->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -435,89 +349,100 @@ dxf_region_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (region->dictionary_owner_soft, "") != 0)
+        if ((region->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", region->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, region->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (region->dictionary_owner_hard, "") != 0)
+        if ((region->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", region->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, region->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (region->paperspace == DXF_PAPERSPACE)
+        if (region->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", region->layer);
-        if (strcmp (region->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", region->common.layer);
+        if (strcmp (region->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", region->linetype);
+                fprintf (fp->fp, "  6\n%s\n", region->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (region->elevation != 0.0))
+          && (region->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", region->elevation);
+                fprintf (fp->fp, " 38\n%f\n", region->common.elevation);
         }
-        if (region->color != DXF_COLOR_BYLAYER)
+        if (region->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", region->color);
+                fprintf (fp->fp, " 62\n%hd\n", region->common.color);
         }
-        if (region->linetype_scale != 1.0)
+        if (region->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", region->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", region->common.linetype_scale);
         }
-        if (region->visibility != 0)
+        if (region->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", region->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", region->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbModelerGeometry\n");
         }
-        if (region->thickness != 0.0)
+        if (region->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", region->thickness);
+                fprintf (fp->fp, " 39\n%f\n", region->common.thickness);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, " 70\n%d\n", region->modeler_format_version_number);
         }
-        if (region->proprietary_data != NULL)
+        if ((region->proprietary_data_range != NULL)
+          && (region->proprietary_data_range->number_of_lines > 0))
         {
-                iter1 = (DxfChar*) region->proprietary_data;
-                while ((iter1 != NULL) && (iter1->value != NULL))
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter1->value);
-                        iter1 = (DxfChar*) iter1->next;
-                }
+                /* Copy the proprietary data from the file it was read
+                 * from. */
+                dxf_proprietary_data_range_write (fp, region->proprietary_data_range);
         }
         else
         {
-                fprintf (fp->fp, "  1\n\n");
-        }
-        if (region->additional_proprietary_data != NULL)
-        {
-                iter2 = (DxfChar*) region->additional_proprietary_data;
-                while ((iter2 != NULL) && (iter2->value != NULL))
+                if (region->proprietary_data != NULL)
+                {
+                        iter1 = (DxfChar*) region->proprietary_data;
+                        while ((iter1 != NULL) && (iter1->value != NULL))
+                        {
+                                fprintf (fp->fp, "  1\n%s\n", iter1->value);
+                                iter1 = (DxfChar*) iter1->next;
+                        }
+                }
+                else
                 {
-                        fprintf (fp->fp, "  3\n%s\n", iter2->value);
-                        iter2 = (DxfChar*) iter2->next;
+                        fprintf (fp->fp, "  1\n\n");
+                }
+                if (region->additional_proprietary_data != NULL)
+                {
+                        iter2 = (DxfChar*) region->additional_proprietary_data;
+                        while ((iter2 != NULL) && (iter2->value != NULL))
+                        {
+                                fprintf (fp->fp, "  3\n%s\n", iter2->value);
+                                iter2 = (DxfChar*) iter2->next;
+                        }
+                }
+                else
+                {
+                        fprintf (fp->fp, "  3\n\n");
                 }
         }
-        else
-        {
-                fprintf (fp->fp, "  3\n\n");
-        }
+        dxf_entity_common_write_xdata (fp, &region->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -560,14 +485,8 @@ dxf_region_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (region->linetype);
-        free (region->layer);
-        dxf_binary_graphics_data_free_list (region->binary_graphics_data);
-        free (region->dictionary_owner_soft);
-        free (region->material);
-        free (region->dictionary_owner_hard);
-        free (region->plot_style_name);
-        free (region->color_name);
+        dxf_entity_common_free (&region->common);
+        dxf_proprietary_data_range_free (region->proprietary_data_range);
         dxf_char_free_list (region->proprietary_data);
         dxf_char_free_list (region->additional_proprietary_data);
         free (region);
@@ -603,6 +522,7 @@ dxf_region_free_list
         while (regions != NULL)
         {
                 DxfRegion *iter = (DxfRegion *) regions->next;
+                regions->next = NULL;
                 dxf_region_free (regions);
                 regions = (DxfRegion *) iter;
         }
@@ -612,12 +532,96 @@ dxf_region_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c REGION entity.
+ *
+ * The copy does not share any memory with \c region, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfRegion *
+dxf_region_copy
+(
+        DxfRegion *region
+                /*!< a pointer to the DXF \c REGION entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRegion *copy;
+
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_region_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, region, sizeof (DxfRegion));
+        copy->proprietary_data = NULL;
+        copy->additional_proprietary_data = NULL;
+        copy->proprietary_data_range = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &region->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_region_free (copy);
+                return (NULL);
+        }
+        if (region->proprietary_data != NULL)
+        {
+                copy->proprietary_data = dxf_char_copy_list (region->proprietary_data);
+                if (copy->proprietary_data == NULL)
+                {
+                        dxf_region_free (copy);
+                        return (NULL);
+                }
+        }
+        if (region->additional_proprietary_data != NULL)
+        {
+                copy->additional_proprietary_data = dxf_char_copy_list (region->additional_proprietary_data);
+                if (copy->additional_proprietary_data == NULL)
+                {
+                        dxf_region_free (copy);
+                        return (NULL);
+                }
+        }
+        if (region->proprietary_data_range != NULL)
+        {
+                copy->proprietary_data_range = dxf_proprietary_data_range_copy (region->proprietary_data_range);
+                if (copy->proprietary_data_range == NULL)
+                {
+                        dxf_region_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c REGION entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_region_get_id_code
 (
         DxfRegion *region
@@ -635,16 +639,10 @@ dxf_region_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->id_code);
+        return (region->common.id_code);
 }
 
 
@@ -656,7 +654,7 @@ dxf_region_set_id_code
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -673,13 +671,7 @@ dxf_region_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        region->id_code = id_code;
+        region->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -710,7 +702,7 @@ dxf_region_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->linetype ==  NULL)
+        if (region->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -720,7 +712,7 @@ dxf_region_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->linetype));
+        return (strdup (region->common.linetype));
 }
 
 
@@ -755,7 +747,7 @@ dxf_region_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        region->linetype = strdup (linetype);
+        region->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -786,7 +778,7 @@ dxf_region_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->layer ==  NULL)
+        if (region->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -796,7 +788,7 @@ dxf_region_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->layer));
+        return (strdup (region->common.layer));
 }
 
 
@@ -831,7 +823,7 @@ dxf_region_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        region->layer = strdup (layer);
+        region->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -865,7 +857,7 @@ dxf_region_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->elevation);
+        return (region->common.elevation);
 }
 
 
@@ -892,7 +884,7 @@ dxf_region_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        region->elevation = elevation;
+        region->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -923,7 +915,7 @@ dxf_region_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->thickness < 0.0)
+        if (region->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -933,7 +925,7 @@ dxf_region_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->thickness);
+        return (region->common.thickness);
 }
 
 
@@ -967,7 +959,7 @@ dxf_region_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        region->thickness = thickness;
+        region->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -998,7 +990,7 @@ dxf_region_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->linetype_scale < 0.0)
+        if (region->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1008,7 +1000,7 @@ dxf_region_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->linetype_scale);
+        return (region->common.linetype_scale);
 }
 
 
@@ -1042,7 +1034,7 @@ dxf_region_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        region->linetype_scale = linetype_scale;
+        region->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1073,14 +1065,14 @@ dxf_region_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->visibility < 0)
+        if (region->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->visibility > 1)
+        if (region->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1090,7 +1082,7 @@ dxf_region_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->visibility);
+        return (region->common.visibility);
 }
 
 
@@ -1131,7 +1123,7 @@ dxf_region_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        region->visibility = visibility;
+        region->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1162,7 +1154,7 @@ dxf_region_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->color < 0)
+        if (region->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1171,7 +1163,7 @@ dxf_region_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->color);
+        return (region->common.color);
 }
 
 
@@ -1204,7 +1196,7 @@ dxf_region_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        region->color = color;
+        region->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1235,13 +1227,13 @@ dxf_region_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->paperspace < 0)
+        if (region->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (region->paperspace > 1)
+        if (region->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1250,7 +1242,7 @@ dxf_region_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->paperspace);
+        return (region->common.paperspace);
 }
 
 
@@ -1292,7 +1284,7 @@ dxf_region_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        region->paperspace = paperspace;
+        region->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1325,13 +1317,13 @@ dxf_region_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->graphics_data_size < 0)
+        if (region->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (region->graphics_data_size == 0)
+        if (region->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1340,7 +1332,7 @@ dxf_region_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->graphics_data_size);
+        return (region->common.cold->graphics_data_size);
 }
 
 
@@ -1384,7 +1376,7 @@ dxf_region_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        region->graphics_data_size = graphics_data_size;
+        region->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1416,14 +1408,14 @@ dxf_region_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->shadow_mode < 0)
+        if (region->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (region->shadow_mode > 3)
+        if (region->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1433,7 +1425,7 @@ dxf_region_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->shadow_mode);
+        return (region->common.cold->shadow_mode);
 }
 
 
@@ -1477,7 +1469,7 @@ dxf_region_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        region->shadow_mode = shadow_mode;
+        region->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1489,11 +1481,12 @@ dxf_region_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c REGION entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_region_get_binary_graphics_data
 (
         DxfRegion *region
@@ -1511,32 +1504,31 @@ dxf_region_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) region->binary_graphics_data);
+        return (region->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c REGION entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c region when successful, or \c NULL when an
+ * error occurred.
  */
 DxfRegion *
 dxf_region_set_binary_graphics_data
 (
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1557,7 +1549,12 @@ dxf_region_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        region->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((region->common.cold->binary_graphics_data != NULL)
+          && (region->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (region->common.cold->binary_graphics_data);
+        }
+        region->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1591,17 +1588,10 @@ dxf_region_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->dictionary_owner_soft));
+        return (dxf_handle_to_string (region->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1637,7 +1627,7 @@ dxf_region_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        region->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        region->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1671,17 +1661,10 @@ dxf_region_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->material));
+        return (dxf_handle_to_string (region->common.cold->material));
 }
 
 
@@ -1719,7 +1702,7 @@ dxf_region_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        region->material = strdup (material);
+        region->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1753,17 +1736,10 @@ dxf_region_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->dictionary_owner_hard));
+        return (dxf_handle_to_string (region->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1799,7 +1775,7 @@ dxf_region_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        region->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        region->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1834,7 +1810,7 @@ dxf_region_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->lineweight);
+        return (region->common.lineweight);
 }
 
 
@@ -1864,7 +1840,7 @@ dxf_region_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        region->lineweight = lineweight;
+        region->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1896,17 +1872,10 @@ dxf_region_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->plot_style_name));
+        return (dxf_handle_to_string (region->common.cold->plot_style_name));
 }
 
 
@@ -1944,7 +1913,7 @@ dxf_region_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        region->plot_style_name = strdup (plot_style_name);
+        region->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1979,7 +1948,7 @@ dxf_region_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->color_value);
+        return (region->common.color_value);
 }
 
 
@@ -2009,7 +1978,7 @@ dxf_region_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        region->color_value = color_value;
+        region->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2041,7 +2010,7 @@ dxf_region_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->color_name ==  NULL)
+        if (region->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2051,7 +2020,7 @@ dxf_region_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (region->color_name));
+        return (strdup (region->common.cold->color_name));
 }
 
 
@@ -2089,7 +2058,7 @@ dxf_region_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        region->color_name = strdup (color_name);
+        region->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2124,7 +2093,7 @@ dxf_region_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->transparency);
+        return (region->common.cold->transparency);
 }
 
 
@@ -2154,7 +2123,7 @@ dxf_region_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        region->transparency = transparency;
+        region->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2428,6 +2397,80 @@ dxf_region_set_modeler_format_version_number
 }
 
 
+/*!
+ * \brief Get the \c proprietary_data_range from a DXF \c REGION entity.
+ *
+ * \warning No checks are performed on the returned pointer.
+ *
+ * \return \c proprietary_data_range when sucessful, or \c NULL when an
+ * error occurred.
+ */
+DxfProprietaryDataRange *
+dxf_region_get_proprietary_data_range
+(
+        DxfRegion *region
+                /*!< a pointer to a DXF \c REGION entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region->proprietary_data_range);
+}
+
+
+/*!
+ * \brief Get the decoded proprietary (ACIS) data from a DXF \c REGION
+ * entity.
+ *
+ * The group 1 and group 3 lines are read from the DXF file and decoded
+ * into SAT text on each call.
+ *
+ * \return a '\\0' terminated buffer with the SAT text, to be freed by
+ * the caller, or \c NULL when an error occurred.
+ */
+char *
+dxf_region_get_sat_data
+(
+        DxfRegion *region,
+                /*!< a pointer to a DXF \c REGION entity. */
+        size_t *length
+                /*!< the number of characters in the returned buffer,
+                 * may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *sat_data = NULL;
+
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        sat_data = dxf_proprietary_data_range_decode (region->proprietary_data_range, length);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (sat_data);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c REGION entity from a DXF
  * \c REGION entity.
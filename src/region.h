@@ -46,6 +46,10 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
+#include "proprietary_data.h"
 #include "point.h"
 #include "binary_graphics_data.h"
 #include "util.h"
@@ -63,130 +67,9 @@ typedef struct
 dxf_region_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        long color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        long transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF region. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfChar *proprietary_data;
                 /*!< Proprietary data (multiple lines < 255 characters
                  * each).\n
@@ -196,6 +79,10 @@ dxf_region_struct
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfProprietaryDataRange *proprietary_data_range;
+                /*!< Byte range of the group 1 and group 3 lines in the
+                 * DXF file, the proprietary data is only decoded on
+                 * demand. */
         int modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -211,8 +98,9 @@ DxfRegion *dxf_region_read (DxfFile *fp, DxfRegion *region);
 int dxf_region_write (DxfFile *fp, DxfRegion *region);
 int dxf_region_free (DxfRegion *region);
 void dxf_region_free_list (DxfRegion *regions);
-int dxf_region_get_id_code (DxfRegion *region);
-DxfRegion *dxf_region_set_id_code (DxfRegion *region, int id_code);
+DxfRegion *dxf_region_copy (DxfRegion *region);
+DxfHandle dxf_region_get_id_code (DxfRegion *region);
+DxfRegion *dxf_region_set_id_code (DxfRegion *region, DxfHandle id_code);
 char *dxf_region_get_linetype (DxfRegion *region);
 DxfRegion *dxf_region_set_linetype (DxfRegion *region, char *linetype);
 char *dxf_region_get_layer (DxfRegion *region);
@@ -233,8 +121,8 @@ int dxf_region_get_graphics_data_size (DxfRegion *region);
 DxfRegion *dxf_region_set_graphics_data_size (DxfRegion *region, int graphics_data_size);
 int16_t dxf_region_get_shadow_mode (DxfRegion *region);
 DxfRegion *dxf_region_set_shadow_mode (DxfRegion *region, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_region_get_binary_graphics_data (DxfRegion *region);
-DxfRegion *dxf_region_set_binary_graphics_data (DxfRegion *region, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_region_get_binary_graphics_data (DxfRegion *region);
+DxfRegion *dxf_region_set_binary_graphics_data (DxfRegion *region, DxfBinaryBuffer *data);
 char *dxf_region_get_dictionary_owner_soft (DxfRegion *region);
 DxfRegion *dxf_region_set_dictionary_owner_soft (DxfRegion *region, char *dictionary_owner_soft);
 char *dxf_region_get_material (DxfRegion *region);
@@ -255,6 +143,8 @@ DxfChar *dxf_region_get_proprietary_data (DxfRegion *region);
 DxfRegion *dxf_region_set_proprietary_data (DxfRegion *region, DxfChar *proprietary_data);
 DxfChar *dxf_region_get_additional_proprietary_data (DxfRegion *region);
 DxfRegion *dxf_region_set_additional_proprietary_data (DxfRegion *region, DxfChar *additional_proprietary_data);
+DxfProprietaryDataRange *dxf_region_get_proprietary_data_range (DxfRegion *region);
+char *dxf_region_get_sat_data (DxfRegion *region, size_t *length);
 int dxf_region_get_modeler_format_version_number (DxfRegion *region);
 DxfRegion *dxf_region_set_modeler_format_version_number (DxfRegion *region, int modeler_format_version_number);
 DxfRegion *dxf_region_get_next (DxfRegion *region);
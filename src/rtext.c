@@ -108,27 +108,13 @@ dxf_rtext_init
                 __FUNCTION__);
               return (NULL);
         }
-        rtext->id_code = 0;
-        rtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        rtext->layer = strdup (DXF_DEFAULT_LAYER);
-        rtext->elevation = 0.0;
-        rtext->thickness = 0.0;
-        rtext->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        rtext->visibility = DXF_DEFAULT_VISIBILITY;
-        rtext->color = DXF_COLOR_BYLAYER;
-        rtext->paperspace = DXF_MODELSPACE;
-        rtext->graphics_data_size = 0;
-        rtext->shadow_mode = 0;
-        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data);
-        rtext->dictionary_owner_soft = strdup ("");
-        rtext->material = strdup ("");
-        rtext->dictionary_owner_hard = strdup ("");
-        rtext->lineweight = 0;
-        rtext->plot_style_name = strdup ("");
-        rtext->color_value = 0;
-        rtext->color_name = strdup ("");
-        rtext->transparency = 0;
+        if (dxf_entity_common_init (&rtext->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         rtext->text_value = strdup ("");
         rtext->text_style = strdup ("");
         rtext->p0 = (DxfPoint *) dxf_point_new ();
@@ -218,15 +204,14 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &rtext->id_code);
+                        rtext->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->common.linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
@@ -239,7 +224,7 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->common.layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -264,19 +249,19 @@ dxf_rtext_read
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
-                        && (rtext->elevation != 0.0))
+                        && (rtext->common.elevation != 0.0))
                 {
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->elevation);
+                        fscanf (fp->fp, "%lf\n", &rtext->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->thickness);
+                        fscanf (fp->fp, "%lf\n", &rtext->common.thickness);
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
@@ -290,7 +275,7 @@ dxf_rtext_read
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &rtext->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &rtext->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "50") == 0)
                 {
@@ -304,21 +289,21 @@ dxf_rtext_read
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &rtext->visibility);
+                        fscanf (fp->fp, "%hd\n", &rtext->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->color);
+                        fscanf (fp->fp, "%hd\n", &rtext->common.color);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->paperspace);
+                        fscanf (fp->fp, "%hd\n", &rtext->common.paperspace);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -332,7 +317,7 @@ dxf_rtext_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &rtext->common.cold->graphics_data_size);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
@@ -354,7 +339,7 @@ dxf_rtext_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &rtext->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &rtext->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "210") == 0)
                 {
@@ -382,71 +367,68 @@ dxf_rtext_read
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &rtext->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &rtext->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data->next);
-                        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) rtext->binary_graphics_data->next;
+                        if (rtext->common.cold->binary_graphics_data == NULL)
+                        {
+                                rtext->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, rtext->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->dictionary_owner_soft);
+                        rtext->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->material);
+                        rtext->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->dictionary_owner_hard);
+                        rtext->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &rtext->lineweight);
+                        fscanf (fp->fp, "%hd\n", &rtext->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->plot_style_name);
+                        rtext->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &rtext->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &rtext->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &rtext->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &rtext->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -466,18 +448,18 @@ dxf_rtext_read
         if (strcmp (rtext->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, rtext->id_code);
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, rtext->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 return (NULL);
         }
-        if (strcmp (rtext->linetype, "") == 0)
+        if (strcmp (rtext->common.linetype, "") == 0)
         {
-                rtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                rtext->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (rtext->layer, "") == 0)
+        if (strcmp (rtext->common.layer, "") == 0)
         {
-                rtext->layer = strdup (DXF_DEFAULT_LAYER);
+                rtext->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -527,8 +509,8 @@ dxf_rtext_write
         if (strcmp (rtext->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, rtext->id_code);
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, rtext->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -537,31 +519,31 @@ dxf_rtext_write
         if (strcmp (rtext->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, rtext->id_code);
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, rtext->common.id_code);
                 rtext->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
         }
-        if (strcmp (rtext->layer, "") == 0)
+        if (strcmp (rtext->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, rtext->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, rtext->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                rtext->layer = strdup (DXF_DEFAULT_LAYER);
+                rtext->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (rtext->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, rtext->id_code);
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, rtext->common.id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (rtext->id_code != -1)
+        if (rtext->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", rtext->id_code);
+                dxf_handle_write (fp, 5, rtext->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -573,97 +555,91 @@ dxf_rtext_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (rtext->dictionary_owner_soft, "") != 0)
+        if ((rtext->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", rtext->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, rtext->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (rtext->dictionary_owner_hard, "") != 0)
+        if ((rtext->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", rtext->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, rtext->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (rtext->paperspace == 1)
+        if (rtext->common.paperspace == 1)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", rtext->layer);
-        if (strcmp (rtext->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", rtext->common.layer);
+        if (strcmp (rtext->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", rtext->linetype);
+                fprintf (fp->fp, "  6\n%s\n", rtext->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (rtext->material, "") != 0))
+          && (rtext->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", rtext->material);
+                dxf_handle_write (fp, 347, rtext->common.cold->material);
         }
-        if (rtext->color != DXF_COLOR_BYLAYER)
+        if (rtext->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", rtext->color);
+                fprintf (fp->fp, " 62\n%hd\n", rtext->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", rtext->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", rtext->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (rtext->elevation != 0.0))
+          && (rtext->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", rtext->elevation);
+                fprintf (fp->fp, " 38\n%f\n", rtext->common.elevation);
         }
-        if (rtext->linetype_scale != 1.0)
+        if (rtext->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", rtext->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", rtext->common.linetype_scale);
         }
-        if (rtext->visibility != 0)
+        if (rtext->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", rtext->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", rtext->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (rtext->graphics_data_size > 0))
+          && (rtext->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", rtext->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", rtext->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", rtext->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", rtext->common.cold->graphics_data_size);
 #endif
-                if (rtext->binary_graphics_data != NULL)
+                if (rtext->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = rtext->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, rtext->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", rtext->color_value);
-                fprintf (fp->fp, "430\n%s\n", rtext->color_name);
-                fprintf (fp->fp, "440\n%ld\n", rtext->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", rtext->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", rtext->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", rtext->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", rtext->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", rtext->shadow_mode);
+                dxf_handle_write (fp, 390, rtext->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", rtext->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbRText\n");
         }
-        if (rtext->thickness != 0.0)
+        if (rtext->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", rtext->thickness);
+                fprintf (fp->fp, " 39\n%f\n", rtext->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", rtext->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", rtext->p0->y0);
@@ -695,6 +671,7 @@ dxf_rtext_write
         {
                 fprintf (fp->fp, "100\nAcDbRText\n");
         }
+        dxf_entity_common_write_xdata (fp, &rtext->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -736,14 +713,7 @@ dxf_rtext_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (rtext->linetype);
-        free (rtext->layer);
-        dxf_binary_graphics_data_free_list (rtext->binary_graphics_data);
-        free (rtext->dictionary_owner_soft);
-        free (rtext->material);
-        free (rtext->dictionary_owner_hard);
-        free (rtext->plot_style_name);
-        free (rtext->color_name);
+        dxf_entity_common_free (&rtext->common);
         free (rtext->text_value);
         free (rtext->text_style);
         dxf_point_free (rtext->p0);
@@ -780,6 +750,7 @@ dxf_rtext_free_list
         while (rtexts != NULL)
         {
                 DxfRText *iter = (DxfRText *) rtexts->next;
+                rtexts->next = NULL;
                 dxf_rtext_free (rtexts);
                 rtexts = (DxfRText *) iter;
         }
@@ -794,7 +765,7 @@ dxf_rtext_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_rtext_get_id_code
 (
         DxfRText *rtext
@@ -812,16 +783,10 @@ dxf_rtext_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->id_code);
+        return (rtext->common.id_code);
 }
 
 
@@ -833,7 +798,7 @@ dxf_rtext_set_id_code
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -850,13 +815,7 @@ dxf_rtext_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        rtext->id_code = id_code;
+        rtext->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -887,7 +846,7 @@ dxf_rtext_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->linetype ==  NULL)
+        if (rtext->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -897,7 +856,7 @@ dxf_rtext_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->linetype));
+        return (strdup (rtext->common.linetype));
 }
 
 
@@ -932,7 +891,7 @@ dxf_rtext_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->linetype = strdup (linetype);
+        rtext->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -963,7 +922,7 @@ dxf_rtext_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->layer ==  NULL)
+        if (rtext->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -973,7 +932,7 @@ dxf_rtext_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->layer));
+        return (strdup (rtext->common.layer));
 }
 
 
@@ -1008,7 +967,7 @@ dxf_rtext_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->layer = strdup (layer);
+        rtext->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1042,7 +1001,7 @@ dxf_rtext_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->elevation);
+        return (rtext->common.elevation);
 }
 
 
@@ -1069,7 +1028,7 @@ dxf_rtext_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->elevation = elevation;
+        rtext->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1100,7 +1059,7 @@ dxf_rtext_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->thickness < 0.0)
+        if (rtext->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1109,7 +1068,7 @@ dxf_rtext_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->thickness);
+        return (rtext->common.thickness);
 }
 
 
@@ -1142,7 +1101,7 @@ dxf_rtext_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->thickness = thickness;
+        rtext->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1173,7 +1132,7 @@ dxf_rtext_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->linetype_scale < 0.0)
+        if (rtext->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1182,7 +1141,7 @@ dxf_rtext_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->linetype_scale);
+        return (rtext->common.linetype_scale);
 }
 
 
@@ -1215,7 +1174,7 @@ dxf_rtext_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->linetype_scale = linetype_scale;
+        rtext->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1246,13 +1205,13 @@ dxf_rtext_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->visibility < 0)
+        if (rtext->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (rtext->visibility > 1)
+        if (rtext->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1261,7 +1220,7 @@ dxf_rtext_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->visibility);
+        return (rtext->common.visibility);
 }
 
 
@@ -1300,7 +1259,7 @@ dxf_rtext_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->visibility = visibility;
+        rtext->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1331,7 +1290,7 @@ dxf_rtext_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->color < 0)
+        if (rtext->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1340,7 +1299,7 @@ dxf_rtext_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->color);
+        return (rtext->common.color);
 }
 
 
@@ -1373,7 +1332,7 @@ dxf_rtext_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->color = color;
+        rtext->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1404,13 +1363,13 @@ dxf_rtext_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->paperspace < 0)
+        if (rtext->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (rtext->paperspace > 1)
+        if (rtext->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1419,7 +1378,7 @@ dxf_rtext_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->paperspace);
+        return (rtext->common.paperspace);
 }
 
 
@@ -1459,7 +1418,7 @@ dxf_rtext_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->paperspace = paperspace;
+        rtext->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1491,13 +1450,13 @@ dxf_rtext_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->graphics_data_size < 0)
+        if (rtext->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (rtext->graphics_data_size == 0)
+        if (rtext->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1506,7 +1465,7 @@ dxf_rtext_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->graphics_data_size);
+        return (rtext->common.cold->graphics_data_size);
 }
 
 
@@ -1549,7 +1508,7 @@ dxf_rtext_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->graphics_data_size = graphics_data_size;
+        rtext->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1581,13 +1540,13 @@ dxf_rtext_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (rtext->shadow_mode < 0)
+        if (rtext->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (rtext->shadow_mode > 3)
+        if (rtext->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1596,7 +1555,7 @@ dxf_rtext_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->shadow_mode);
+        return (rtext->common.cold->shadow_mode);
 }
 
 
@@ -1638,7 +1597,7 @@ dxf_rtext_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        rtext->shadow_mode = shadow_mode;
+        rtext->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1650,15 +1609,16 @@ dxf_rtext_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c RTEXT entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_rtext_get_binary_graphics_data
 (
         DxfRText *rtext
-                /*!< a pointer to a DXF \c TEXT entity. */
+                /*!< a pointer to a DXF \c RTEXT entity. */
 )
 {
 #if DEBUG
@@ -1672,32 +1632,31 @@ dxf_rtext_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) rtext->binary_graphics_data);
+        return (rtext->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c RTEXT entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c rtext when successful, or \c NULL when an
+ * error occurred.
  */
 DxfRText *
 dxf_rtext_set_binary_graphics_data
 (
         DxfRText *rtext,
                 /*!< a pointer to a DXF \c RTEXT entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1718,7 +1677,12 @@ dxf_rtext_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((rtext->common.cold->binary_graphics_data != NULL)
+          && (rtext->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (rtext->common.cold->binary_graphics_data);
+        }
+        rtext->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1752,17 +1716,10 @@ dxf_rtext_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->dictionary_owner_soft));
+        return (dxf_handle_to_string (rtext->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1798,7 +1755,7 @@ dxf_rtext_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        rtext->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1832,17 +1789,10 @@ dxf_rtext_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->material));
+        return (dxf_handle_to_string (rtext->common.cold->material));
 }
 
 
@@ -1880,7 +1830,7 @@ dxf_rtext_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->material = strdup (material);
+        rtext->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1914,17 +1864,10 @@ dxf_rtext_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->dictionary_owner_hard));
+        return (dxf_handle_to_string (rtext->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1960,7 +1903,7 @@ dxf_rtext_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        rtext->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1995,7 +1938,7 @@ dxf_rtext_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->lineweight);
+        return (rtext->common.lineweight);
 }
 
 
@@ -2025,7 +1968,7 @@ dxf_rtext_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->lineweight = lineweight;
+        rtext->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2057,17 +2000,10 @@ dxf_rtext_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->plot_style_name));
+        return (dxf_handle_to_string (rtext->common.cold->plot_style_name));
 }
 
 
@@ -2105,7 +2041,7 @@ dxf_rtext_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->plot_style_name = strdup (plot_style_name);
+        rtext->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2140,7 +2076,7 @@ dxf_rtext_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->color_value);
+        return (rtext->common.color_value);
 }
 
 
@@ -2170,7 +2106,7 @@ dxf_rtext_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->color_value = color_value;
+        rtext->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2202,7 +2138,7 @@ dxf_rtext_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (rtext->color_name ==  NULL)
+        if (rtext->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2212,7 +2148,7 @@ dxf_rtext_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (rtext->color_name));
+        return (strdup (rtext->common.cold->color_name));
 }
 
 
@@ -2250,7 +2186,7 @@ dxf_rtext_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->color_name = strdup (color_name);
+        rtext->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2285,7 +2221,7 @@ dxf_rtext_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (rtext->transparency);
+        return (rtext->common.cold->transparency);
 }
 
 
@@ -2315,7 +2251,7 @@ dxf_rtext_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        rtext->transparency = transparency;
+        rtext->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -0,0 +1,670 @@
+/*!
+ * \file rtree.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for an in-memory R-tree of bounding boxes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "rtree.h"
+
+
+#define DXF_RTREE_STACK_SIZE (DXF_RTREE_NODE_CAPACITY * 32)
+        /*!< \brief Size of the stack of nodes to visit in a query,
+         * enough for any tree that fits in memory. */
+
+
+/*!
+ * \brief Compare two nodes on the X-value of the centre of their box.
+ */
+static int
+dxf_rtree_compare_x
+(
+        const void *a,
+                /*!< a pointer to a node. */
+        const void *b
+                /*!< a pointer to another node. */
+)
+{
+        const DxfRtreeNode *node_a = (const DxfRtreeNode *) a;
+        const DxfRtreeNode *node_b = (const DxfRtreeNode *) b;
+        double centre_a = node_a->box.min_x + node_a->box.max_x;
+        double centre_b = node_b->box.min_x + node_b->box.max_x;
+
+        return ((centre_a > centre_b) - (centre_a < centre_b));
+}
+
+
+/*!
+ * \brief Compare two nodes on the Y-value of the centre of their box.
+ */
+static int
+dxf_rtree_compare_y
+(
+        const void *a,
+                /*!< a pointer to a node. */
+        const void *b
+                /*!< a pointer to another node. */
+)
+{
+        const DxfRtreeNode *node_a = (const DxfRtreeNode *) a;
+        const DxfRtreeNode *node_b = (const DxfRtreeNode *) b;
+        double centre_a = node_a->box.min_y + node_a->box.max_y;
+        double centre_b = node_b->box.min_y + node_b->box.max_y;
+
+        return ((centre_a > centre_b) - (centre_a < centre_b));
+}
+
+
+/*!
+ * \brief Sort nodes in Sort-Tile-Recursive order.
+ *
+ * After sorting every run of \c DXF_RTREE_NODE_CAPACITY nodes forms one
+ * tile of the next level.
+ */
+static void
+dxf_rtree_sort_tiles
+(
+        DxfRtreeNode *nodes,
+                /*!< array of nodes. */
+        int number_of_nodes
+                /*!< number of nodes in \c nodes. */
+)
+{
+        int number_of_tiles;
+        int number_of_slices;
+        int slice_size;
+        int i;
+
+        number_of_tiles = (number_of_nodes + DXF_RTREE_NODE_CAPACITY - 1) / DXF_RTREE_NODE_CAPACITY;
+        number_of_slices = (int) ceil (sqrt ((double) number_of_tiles));
+        slice_size = number_of_slices * DXF_RTREE_NODE_CAPACITY;
+        qsort (nodes, number_of_nodes, sizeof (DxfRtreeNode), dxf_rtree_compare_x);
+        for (i = 0; i < number_of_nodes; i += slice_size)
+        {
+                qsort (nodes + i,
+                  ((number_of_nodes - i) < slice_size) ? (number_of_nodes - i) : slice_size,
+                  sizeof (DxfRtreeNode), dxf_rtree_compare_y);
+        }
+}
+
+
+/*!
+ * \brief Grow a box to include another box.
+ */
+static void
+dxf_rtree_extend
+(
+        DxfBoundingBox *box,
+                /*!< the box to grow. */
+        const DxfBoundingBox *other
+                /*!< the box to include. */
+)
+{
+        if (other->min_x < box->min_x) box->min_x = other->min_x;
+        if (other->min_y < box->min_y) box->min_y = other->min_y;
+        if (other->min_z < box->min_z) box->min_z = other->min_z;
+        if (other->max_x > box->max_x) box->max_x = other->max_x;
+        if (other->max_y > box->max_y) box->max_y = other->max_y;
+        if (other->max_z > box->max_z) box->max_z = other->max_z;
+}
+
+
+/*!
+ * \brief Test if two boxes overlap or touch.
+ */
+static int
+dxf_rtree_intersects
+(
+        const DxfBoundingBox *box,
+                /*!< a box. */
+        const DxfBoundingBox *region,
+                /*!< the query region. */
+        int dimensions
+                /*!< 2 to ignore the Z-values, or 3. */
+)
+{
+        return ((box->min_x <= region->max_x)
+          && (box->max_x >= region->min_x)
+          && (box->min_y <= region->max_y)
+          && (box->max_y >= region->min_y)
+          && ((dimensions == 2)
+          || ((box->min_z <= region->max_z)
+          && (box->max_z >= region->min_z))));
+}
+
+
+/*!
+ * \brief Test if a box lies completely inside a region.
+ */
+static int
+dxf_rtree_contains
+(
+        const DxfBoundingBox *region,
+                /*!< the query region. */
+        const DxfBoundingBox *box,
+                /*!< a box. */
+        int dimensions
+                /*!< 2 to ignore the Z-values, or 3. */
+)
+{
+        return ((box->min_x >= region->min_x)
+          && (box->max_x <= region->max_x)
+          && (box->min_y >= region->min_y)
+          && (box->max_y <= region->max_y)
+          && ((dimensions == 2)
+          || ((box->min_z >= region->min_z)
+          && (box->max_z <= region->max_z))));
+}
+
+
+/*!
+ * \brief Append the parents of a run of nodes to the node array.
+ *
+ * \return the number of nodes after appending.
+ */
+static int
+dxf_rtree_pack
+(
+        DxfRtree *rtree,
+                /*!< a pointer to an R-tree. */
+        const DxfRtreeNode *children,
+                /*!< the run of children, already in tile order. */
+        int first,
+                /*!< index of the first child. */
+        int number_of_children,
+                /*!< number of children in the run. */
+        int level
+                /*!< level of the new nodes. */
+)
+{
+        DxfRtreeNode *node;
+        int i;
+        int j;
+
+        for (i = 0; i < number_of_children; i += DXF_RTREE_NODE_CAPACITY)
+        {
+                node = &rtree->nodes[rtree->number_of_nodes];
+                node->box = children[i].box;
+                node->first = first + i;
+                node->count = ((number_of_children - i) < DXF_RTREE_NODE_CAPACITY)
+                  ? (number_of_children - i)
+                  : DXF_RTREE_NODE_CAPACITY;
+                node->level = level;
+                for (j = 1; j < node->count; j++)
+                {
+                        dxf_rtree_extend (&node->box, &children[i + j].box);
+                }
+                rtree->number_of_nodes++;
+        }
+        return (rtree->number_of_nodes);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfRtree.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfRtree *
+dxf_rtree_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRtree *rtree = NULL;
+        size_t size;
+
+        size = sizeof (DxfRtree);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((rtree = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfRtree struct.\n")),
+                  __FUNCTION__);
+                rtree = NULL;
+        }
+        else
+        {
+                memset (rtree, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (rtree);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a \c DxfRtree.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfRtree *
+dxf_rtree_init
+(
+        DxfRtree *rtree
+                /*!< a pointer to an R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                rtree = dxf_rtree_new ();
+        }
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        rtree->nodes = NULL;
+        rtree->number_of_nodes = 0;
+        rtree->root = -1;
+        rtree->items = NULL;
+        rtree->item_boxes = NULL;
+        rtree->number_of_items = 0;
+        rtree->dimensions = 2;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (rtree);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfRtree.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_rtree_free
+(
+        DxfRtree *rtree
+                /*!< a pointer to an R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (rtree->nodes);
+        free (rtree->items);
+        free (rtree->item_boxes);
+        free (rtree);
+        rtree = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build a \c DxfRtree over an array of bounding boxes.
+ *
+ * Item \c i of the tree is \c boxes[i], for the boxes of an
+ * \c ENTITIES section this is the position of the entity.\n
+ * A tree built before is replaced.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_rtree_build
+(
+        DxfRtree *rtree,
+                /*!< a pointer to an R-tree. */
+        const DxfBoundingBox *boxes,
+                /*!< array of bounding boxes. */
+        int number_of_boxes,
+                /*!< number of boxes in \c boxes. */
+        int dimensions
+                /*!< 2 to ignore the Z-values in queries, or 3. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRtreeNode *entries;
+        int max_nodes;
+        int start;
+        int end;
+        int level;
+        int i;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL)
+          || ((boxes == NULL) && (number_of_boxes > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((number_of_boxes < 0)
+          || ((dimensions != 2) && (dimensions != 3)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (rtree->nodes);
+        free (rtree->items);
+        free (rtree->item_boxes);
+        rtree->nodes = NULL;
+        rtree->items = NULL;
+        rtree->item_boxes = NULL;
+        rtree->number_of_nodes = 0;
+        rtree->number_of_items = 0;
+        rtree->root = -1;
+        rtree->dimensions = dimensions;
+        if (number_of_boxes == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        /* Every level has at most 1 / capacity of the nodes of the
+         * level below it, plus one partly filled node. */
+        max_nodes = (number_of_boxes / (DXF_RTREE_NODE_CAPACITY - 1)) + 64;
+        entries = malloc (number_of_boxes * sizeof (DxfRtreeNode));
+        rtree->nodes = malloc (max_nodes * sizeof (DxfRtreeNode));
+        rtree->items = malloc (number_of_boxes * sizeof (int));
+        rtree->item_boxes = malloc (number_of_boxes * sizeof (DxfBoundingBox));
+        if ((entries == NULL)
+          || (rtree->nodes == NULL)
+          || (rtree->items == NULL)
+          || (rtree->item_boxes == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (entries);
+                free (rtree->nodes);
+                free (rtree->items);
+                free (rtree->item_boxes);
+                rtree->nodes = NULL;
+                rtree->items = NULL;
+                rtree->item_boxes = NULL;
+                return (EXIT_FAILURE);
+        }
+        /* Put the items in tile order and pack the leaves. */
+        for (i = 0; i < number_of_boxes; i++)
+        {
+                entries[i].box = boxes[i];
+                entries[i].first = i;
+                entries[i].count = 0;
+                entries[i].level = -1;
+        }
+        dxf_rtree_sort_tiles (entries, number_of_boxes);
+        for (i = 0; i < number_of_boxes; i++)
+        {
+                rtree->items[i] = entries[i].first;
+                rtree->item_boxes[i] = entries[i].box;
+        }
+        rtree->number_of_items = number_of_boxes;
+        dxf_rtree_pack (rtree, entries, 0, number_of_boxes, 0);
+        free (entries);
+        /* Pack each level into the next until one root is left. */
+        start = 0;
+        end = rtree->number_of_nodes;
+        level = 0;
+        while ((end - start) > 1)
+        {
+                dxf_rtree_sort_tiles (rtree->nodes + start, end - start);
+                level++;
+                dxf_rtree_pack (rtree, rtree->nodes + start, start, end - start, level);
+                start = end;
+                end = rtree->number_of_nodes;
+        }
+        rtree->root = start;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Search a \c DxfRtree for the items in a region.
+ *
+ * \return the number of items found, or -1 when an error occurred.
+ * When this is larger than \c max_items only the first \c max_items
+ * item numbers are stored in \c items.
+ */
+int
+dxf_rtree_search
+(
+        DxfRtree *rtree,
+                /*!< a pointer to an R-tree. */
+        const DxfBoundingBox *region,
+                /*!< the query region. */
+        DxfRtreeQuery query,
+                /*!< \c DXF_RTREE_WINDOW or \c DXF_RTREE_CROSSING. */
+        int *items,
+                /*!< receives the item numbers, may be \c NULL to only
+                 * count the items. */
+        int max_items
+                /*!< room in \c items. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int stack[DXF_RTREE_STACK_SIZE];
+        int depth;
+        int count = 0;
+        int found;
+        DxfRtreeNode *node;
+        int i;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL)
+          || (region == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (rtree->root < 0)
+        {
+                return (0);
+        }
+        depth = 0;
+        stack[depth++] = rtree->root;
+        while (depth > 0)
+        {
+                node = &rtree->nodes[stack[--depth]];
+                if (!dxf_rtree_intersects (&node->box, region, rtree->dimensions))
+                {
+                        continue;
+                }
+                if (node->level > 0)
+                {
+                        for (i = 0; i < node->count; i++)
+                        {
+                                stack[depth++] = node->first + i;
+                        }
+                        continue;
+                }
+                for (i = node->first; i < (node->first + node->count); i++)
+                {
+                        if (query == DXF_RTREE_WINDOW)
+                        {
+                                found = dxf_rtree_contains (region, &rtree->item_boxes[i], rtree->dimensions);
+                        }
+                        else
+                        {
+                                found = dxf_rtree_intersects (&rtree->item_boxes[i], region, rtree->dimensions);
+                        }
+                        if (found)
+                        {
+                                if ((items != NULL)
+                                  && (count < max_items))
+                                {
+                                        items[count] = rtree->items[i];
+                                }
+                                count++;
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (count);
+}
+
+
+/*!
+ * \brief Search a \c DxfRtree for the items with a box containing a
+ * point.
+ *
+ * \return the number of items found, or -1 when an error occurred.
+ * When this is larger than \c max_items only the first \c max_items
+ * item numbers are stored in \c items.
+ */
+int
+dxf_rtree_search_point
+(
+        DxfRtree *rtree,
+                /*!< a pointer to an R-tree. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z,
+                /*!< Z-value of the point, ignored in a 2D tree. */
+        double tolerance,
+                /*!< distance by which the boxes are grown. */
+        int *items,
+                /*!< receives the item numbers, may be \c NULL to only
+                 * count the items. */
+        int max_items
+                /*!< room in \c items. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundingBox region;
+
+        region.min_x = x - tolerance;
+        region.min_y = y - tolerance;
+        region.min_z = z - tolerance;
+        region.max_x = x + tolerance;
+        region.max_y = y + tolerance;
+        region.max_z = z + tolerance;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_rtree_search (rtree, &region, DXF_RTREE_CROSSING, items, max_items));
+}
+
+
+/*!
+ * \brief Get the number of items in a \c DxfRtree.
+ *
+ * \return the number of items, or -1 when an error occurred.
+ */
+int
+dxf_rtree_get_number_of_items
+(
+        DxfRtree *rtree
+                /*!< a pointer to an R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (rtree->number_of_items);
+}
+
+
+/*!
+ * \brief Get the height of a \c DxfRtree.
+ *
+ * \return the number of levels, 0 for an empty tree, or -1 when an
+ * error occurred.
+ */
+int
+dxf_rtree_get_height
+(
+        DxfRtree *rtree
+                /*!< a pointer to an R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((rtree->root < 0) ? 0 : rtree->nodes[rtree->root].level + 1);
+}
+
+
+/* EOF */
@@ -0,0 +1,153 @@
+/*!
+ * \file rtree.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for an in-memory R-tree of bounding boxes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_RTREE_H
+#define LIBDXF_SRC_RTREE_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_RTREE_NODE_CAPACITY 16
+        /*!< \brief Maximum number of children of a node. */
+
+
+/*!
+ * \brief Axis aligned bounding box.
+ */
+typedef struct
+dxf_bounding_box_struct
+{
+        double min_x;
+                /*!< Minimum X-value. */
+        double min_y;
+                /*!< Minimum Y-value. */
+        double min_z;
+                /*!< Minimum Z-value. */
+        double max_x;
+                /*!< Maximum X-value. */
+        double max_y;
+                /*!< Maximum Y-value. */
+        double max_z;
+                /*!< Maximum Z-value. */
+} DxfBoundingBox;
+
+
+/*!
+ * \brief Kinds of region queries on a \c DxfRtree.
+ */
+typedef enum
+dxf_rtree_query
+{
+        DXF_RTREE_WINDOW,
+                /*!< Items with a box completely inside the region. */
+        DXF_RTREE_CROSSING
+                /*!< Items with a box inside or crossing the region. */
+} DxfRtreeQuery;
+
+
+/*!
+ * \brief Node of a \c DxfRtree.
+ */
+typedef struct
+dxf_rtree_node_struct
+{
+        DxfBoundingBox box;
+                /*!< Bounding box of all children. */
+        int first;
+                /*!< Index of the first child, in \c nodes for an
+                 * internal node, in \c items for a leaf. */
+        int count;
+                /*!< Number of children. */
+        int level;
+                /*!< 0 for a leaf, the height above the leaves
+                 * otherwise. */
+} DxfRtreeNode;
+
+
+/*!
+ * \brief Bulk loaded R-tree of bounding boxes.
+ *
+ * The tree is packed with the Sort-Tile-Recursive algorithm: the boxes
+ * are sorted on the X-value of their centre, cut in vertical slices,
+ * every slice is sorted on the Y-value and cut in full nodes.
+ * The same is repeated for each level up to the root.\n
+ * All nodes live in one array, the children of a node are contiguous.
+ * The tree is read-only, build it again after the boxes changed.
+ */
+typedef struct
+dxf_rtree_struct
+{
+        DxfRtreeNode *nodes;
+                /*!< All nodes, leaves first, the root last. */
+        int number_of_nodes;
+                /*!< Number of nodes. */
+        int root;
+                /*!< Index of the root node, -1 for an empty tree. */
+        int *items;
+                /*!< Item numbers in leaf order. */
+        DxfBoundingBox *item_boxes;
+                /*!< Bounding boxes of the items in leaf order. */
+        int number_of_items;
+                /*!< Number of items. */
+        int dimensions;
+                /*!< 2 to ignore the Z-values in queries, or 3. */
+} DxfRtree;
+
+
+DxfRtree *dxf_rtree_new ();
+DxfRtree *dxf_rtree_init (DxfRtree *rtree);
+int dxf_rtree_free (DxfRtree *rtree);
+int dxf_rtree_build (DxfRtree *rtree, const DxfBoundingBox *boxes, int number_of_boxes, int dimensions);
+int dxf_rtree_search (DxfRtree *rtree, const DxfBoundingBox *region, DxfRtreeQuery query, int *items, int max_items);
+int dxf_rtree_search_point (DxfRtree *rtree, double x, double y, double z, double tolerance, int *items, int max_items);
+int dxf_rtree_get_number_of_items (DxfRtree *rtree);
+int dxf_rtree_get_height (DxfRtree *rtree);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_RTREE_H */
+
+
+/* EOF */
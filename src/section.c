@@ -42,6 +42,10 @@
 
 /*!
  * \brief Function reads a SECTION in a DXF file.
+ *
+ * The block definitions of a \c BLOCKS section are stored in the
+ * global \c dxf_blocks_list, the caller owns the list and frees it with
+ * dxf_block_free_list ().
  */
 int
 dxf_section_read
@@ -91,15 +95,15 @@ dxf_section_read
                         }
                         else if (strcmp (temp_string, "BLOCKS") == 0)
                         {
-                                /* We have found the begin of the BLOCKS sction. */
-
-                                /*! \todo Experimental usage of block_read */
-//                                dxf_read_blocks
-//                                (
-//                                        fp->fp,
-//                                        &dxf_blocks_list,
-//                                        dxf_header._AcadVer
-//                                );
+                                /* We have found the begin of the BLOCKS sction.
+                                 * The list of blocks is handed to the
+                                 * caller in dxf_blocks_list, replacing the
+                                 * blocks of a previously read file. */
+                                if (dxf_blocks_list != NULL)
+                                {
+                                        dxf_block_free_list (dxf_blocks_list);
+                                }
+                                dxf_blocks_list = dxf_block_read_table (fp);
                         }
                         else if (strcmp (temp_string, "ENTITIES") == 0)
                         {
@@ -114,27 +114,13 @@ dxf_seqend_init
                 __FUNCTION__);
               return (NULL);
         }
-        seqend->id_code = 0;
-        seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        seqend->layer = strdup (DXF_DEFAULT_LAYER);
-        seqend->elevation = 0.0;
-        seqend->thickness = 0.0;
-        seqend->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        seqend->visibility = DXF_DEFAULT_VISIBILITY;
-        seqend->color = DXF_COLOR_BYLAYER;
-        seqend->paperspace = DXF_MODELSPACE;
-        seqend->graphics_data_size = 0;
-        seqend->shadow_mode = 0;
-        seqend->binary_graphics_data = dxf_binary_graphics_data_new ();
-        seqend->binary_graphics_data = dxf_binary_graphics_data_init (seqend->binary_graphics_data);
-        seqend->dictionary_owner_soft = strdup ("");
-        seqend->material = strdup ("");
-        seqend->dictionary_owner_hard = strdup ("");
-        seqend->lineweight = 0;
-        seqend->plot_style_name = strdup ("");
-        seqend->color_value = 0;
-        seqend->color_name = strdup ("");
-        seqend->transparency = 0;
+        if (dxf_entity_common_init (&seqend->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         seqend->app_name = strdup ("");
 #if DEBUG
         DXF_DEBUG_END
@@ -210,70 +196,69 @@ dxf_seqend_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &seqend->id_code);
+                        seqend->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->common.linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->common.layer);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &seqend->elevation);
+                        fscanf (fp->fp, "%lf\n", &seqend->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &seqend->thickness);
+                        fscanf (fp->fp, "%lf\n", &seqend->common.thickness);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &seqend->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &seqend->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &seqend->visibility);
+                        fscanf (fp->fp, "%hd\n", &seqend->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &seqend->color);
+                        fscanf (fp->fp, "%hd\n", &seqend->common.color);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &seqend->paperspace);
+                        fscanf (fp->fp, "%hd\n", &seqend->common.paperspace);
                 }
                 else if (strcmp (temp_string, "92") == 0)
                 {
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &seqend->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &seqend->common.cold->graphics_data_size);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
@@ -294,71 +279,68 @@ dxf_seqend_read
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &seqend->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &seqend->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) seqend->binary_graphics_data->next);
-                        seqend->binary_graphics_data = (DxfBinaryGraphicsData *) seqend->binary_graphics_data->next;
+                        if (seqend->common.cold->binary_graphics_data == NULL)
+                        {
+                                seqend->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, seqend->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_soft);
+                        seqend->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->material);
+                        seqend->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_hard);
+                        seqend->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &seqend->lineweight);
+                        fscanf (fp->fp, "%hd\n", &seqend->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->plot_style_name);
+                        seqend->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &seqend->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &seqend->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &seqend->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &seqend->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -375,13 +357,13 @@ dxf_seqend_read
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (seqend->linetype, "") == 0)
+        if (strcmp (seqend->common.linetype, "") == 0)
         {
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (seqend->layer, "") == 0)
+        if (strcmp (seqend->common.layer, "") == 0)
         {
-                seqend->layer = strdup (DXF_DEFAULT_LAYER);
+                seqend->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -439,31 +421,31 @@ dxf_seqend_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (seqend->linetype, "") == 0)
+        if (strcmp (seqend->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, seqend->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, seqend->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (seqend->layer, "") == 0)
+        if (strcmp (seqend->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, seqend->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, seqend->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                seqend->layer = DXF_DEFAULT_LAYER;
+                seqend->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (seqend->id_code != -1)
+        if (seqend->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", seqend->id_code);
+                dxf_handle_write (fp, 5, seqend->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -475,95 +457,90 @@ dxf_seqend_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (seqend->dictionary_owner_soft, "") != 0)
+        if ((seqend->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", seqend->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, seqend->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (seqend->dictionary_owner_hard, "") != 0)
+        if ((seqend->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", seqend->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, seqend->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (seqend->paperspace == DXF_PAPERSPACE)
+        if (seqend->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", seqend->layer);
-        if (strcmp (seqend->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", seqend->common.layer);
+        if (strcmp (seqend->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", seqend->linetype);
+                fprintf (fp->fp, "  6\n%s\n", seqend->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (seqend->material, "") != 0))
+          && (seqend->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", seqend->material);
+                dxf_handle_write (fp, 347, seqend->common.cold->material);
         }
-        if (seqend->color != DXF_COLOR_BYLAYER)
+        if (seqend->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", seqend->color);
+                fprintf (fp->fp, " 62\n%hd\n", seqend->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", seqend->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", seqend->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (seqend->elevation != 0.0))
+          && (seqend->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", seqend->elevation);
+                fprintf (fp->fp, " 38\n%f\n", seqend->common.elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
-          && (seqend->thickness != 0.0))
+          && (seqend->common.thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", seqend->thickness);
+                fprintf (fp->fp, " 39\n%f\n", seqend->common.thickness);
         }
-        if (seqend->linetype_scale != 1.0)
+        if (seqend->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", seqend->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", seqend->common.linetype_scale);
         }
-        if (seqend->visibility != 0)
+        if (seqend->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", seqend->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", seqend->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (seqend->graphics_data_size > 0))
+          && (seqend->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", seqend->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", seqend->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", seqend->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", seqend->common.cold->graphics_data_size);
 #endif
-                if (seqend->binary_graphics_data != NULL)
+                if (seqend->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) seqend->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, seqend->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", seqend->color_value);
-                fprintf (fp->fp, "430\n%s\n", seqend->color_name);
-                fprintf (fp->fp, "440\n%ld\n", seqend->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", seqend->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", seqend->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", seqend->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", seqend->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", seqend->shadow_mode);
+                dxf_handle_write (fp, 390, seqend->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", seqend->common.cold->shadow_mode);
         }
+        dxf_entity_common_write_xdata (fp, &seqend->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -599,14 +576,7 @@ dxf_seqend_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (seqend->linetype);
-        free (seqend->layer);
-        dxf_binary_graphics_data_free_list (seqend->binary_graphics_data);
-        free (seqend->dictionary_owner_soft);
-        free (seqend->material);
-        free (seqend->dictionary_owner_hard);
-        free (seqend->plot_style_name);
-        free (seqend->color_name);
+        dxf_entity_common_free (&seqend->common);
         free (seqend->app_name);
         free (seqend);
         seqend = NULL;
@@ -622,7 +592,7 @@ dxf_seqend_free
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_seqend_get_id_code
 (
         DxfSeqend *seqend
@@ -640,16 +610,10 @@ dxf_seqend_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->id_code);
+        return (seqend->common.id_code);
 }
 
 
@@ -661,7 +625,7 @@ dxf_seqend_set_id_code
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -678,13 +642,7 @@ dxf_seqend_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        seqend->id_code = id_code;
+        seqend->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -715,7 +673,7 @@ dxf_seqend_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->linetype ==  NULL)
+        if (seqend->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -725,7 +683,7 @@ dxf_seqend_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->linetype));
+        return (strdup (seqend->common.linetype));
 }
 
 
@@ -760,7 +718,7 @@ dxf_seqend_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->linetype = strdup (linetype);
+        seqend->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -791,7 +749,7 @@ dxf_seqend_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->layer ==  NULL)
+        if (seqend->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -801,7 +759,7 @@ dxf_seqend_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->layer));
+        return (strdup (seqend->common.layer));
 }
 
 
@@ -836,7 +794,7 @@ dxf_seqend_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->layer = strdup (layer);
+        seqend->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -870,7 +828,7 @@ dxf_seqend_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->elevation);
+        return (seqend->common.elevation);
 }
 
 
@@ -897,7 +855,7 @@ dxf_seqend_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->elevation = elevation;
+        seqend->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -928,7 +886,7 @@ dxf_seqend_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->thickness < 0.0)
+        if (seqend->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -938,7 +896,7 @@ dxf_seqend_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->thickness);
+        return (seqend->common.thickness);
 }
 
 
@@ -972,7 +930,7 @@ dxf_seqend_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->thickness = thickness;
+        seqend->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1003,7 +961,7 @@ dxf_seqend_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->linetype_scale < 0.0)
+        if (seqend->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1013,7 +971,7 @@ dxf_seqend_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->linetype_scale);
+        return (seqend->common.linetype_scale);
 }
 
 
@@ -1047,7 +1005,7 @@ dxf_seqend_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->linetype_scale = linetype_scale;
+        seqend->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1078,14 +1036,14 @@ dxf_seqend_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->visibility < 0)
+        if (seqend->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->visibility > 1)
+        if (seqend->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1095,7 +1053,7 @@ dxf_seqend_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->visibility);
+        return (seqend->common.visibility);
 }
 
 
@@ -1136,7 +1094,7 @@ dxf_seqend_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->visibility = visibility;
+        seqend->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1167,7 +1125,7 @@ dxf_seqend_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->color < 0)
+        if (seqend->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1176,7 +1134,7 @@ dxf_seqend_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->color);
+        return (seqend->common.color);
 }
 
 
@@ -1209,7 +1167,7 @@ dxf_seqend_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        seqend->color = color;
+        seqend->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1240,13 +1198,13 @@ dxf_seqend_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->paperspace < 0)
+        if (seqend->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (seqend->paperspace > 1)
+        if (seqend->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1255,7 +1213,7 @@ dxf_seqend_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->paperspace);
+        return (seqend->common.paperspace);
 }
 
 
@@ -1297,7 +1255,7 @@ dxf_seqend_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->paperspace = paperspace;
+        seqend->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1330,13 +1288,13 @@ dxf_seqend_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->graphics_data_size < 0)
+        if (seqend->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (seqend->graphics_data_size == 0)
+        if (seqend->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1345,7 +1303,7 @@ dxf_seqend_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->graphics_data_size);
+        return (seqend->common.cold->graphics_data_size);
 }
 
 
@@ -1390,7 +1348,7 @@ dxf_seqend_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        seqend->graphics_data_size = graphics_data_size;
+        seqend->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1422,14 +1380,14 @@ dxf_seqend_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->shadow_mode < 0)
+        if (seqend->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (seqend->shadow_mode > 3)
+        if (seqend->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1439,7 +1397,7 @@ dxf_seqend_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->shadow_mode);
+        return (seqend->common.cold->shadow_mode);
 }
 
 
@@ -1483,7 +1441,7 @@ dxf_seqend_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->shadow_mode = shadow_mode;
+        seqend->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1495,11 +1453,12 @@ dxf_seqend_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c SEQEND entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_seqend_get_binary_graphics_data
 (
         DxfSeqend *seqend
@@ -1517,32 +1476,31 @@ dxf_seqend_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) seqend->binary_graphics_data);
+        return (seqend->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c SEQEND entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c seqend when successful, or \c NULL when an
+ * error occurred.
  */
 DxfSeqend *
 dxf_seqend_set_binary_graphics_data
 (
         DxfSeqend *seqend,
                 /*!< a pointer to a DXF \c SEQEND entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1563,7 +1521,12 @@ dxf_seqend_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((seqend->common.cold->binary_graphics_data != NULL)
+          && (seqend->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (seqend->common.cold->binary_graphics_data);
+        }
+        seqend->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1597,17 +1560,10 @@ dxf_seqend_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->dictionary_owner_soft));
+        return (dxf_handle_to_string (seqend->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1643,7 +1599,7 @@ dxf_seqend_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        seqend->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1677,17 +1633,10 @@ dxf_seqend_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->material));
+        return (dxf_handle_to_string (seqend->common.cold->material));
 }
 
 
@@ -1725,7 +1674,7 @@ dxf_seqend_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->material = strdup (material);
+        seqend->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1759,17 +1708,10 @@ dxf_seqend_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->dictionary_owner_hard));
+        return (dxf_handle_to_string (seqend->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1805,7 +1747,7 @@ dxf_seqend_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        seqend->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1840,7 +1782,7 @@ dxf_seqend_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->lineweight);
+        return (seqend->common.lineweight);
 }
 
 
@@ -1870,7 +1812,7 @@ dxf_seqend_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->lineweight = lineweight;
+        seqend->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1902,17 +1844,10 @@ dxf_seqend_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->plot_style_name));
+        return (dxf_handle_to_string (seqend->common.cold->plot_style_name));
 }
 
 
@@ -1950,7 +1885,7 @@ dxf_seqend_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->plot_style_name = strdup (plot_style_name);
+        seqend->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1985,7 +1920,7 @@ dxf_seqend_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->color_value);
+        return (seqend->common.color_value);
 }
 
 
@@ -2015,7 +1950,7 @@ dxf_seqend_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->color_value = color_value;
+        seqend->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2047,7 +1982,7 @@ dxf_seqend_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (seqend->color_name ==  NULL)
+        if (seqend->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2057,7 +1992,7 @@ dxf_seqend_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (seqend->color_name));
+        return (strdup (seqend->common.cold->color_name));
 }
 
 
@@ -2095,7 +2030,7 @@ dxf_seqend_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->color_name = strdup (color_name);
+        seqend->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2130,7 +2065,7 @@ dxf_seqend_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (seqend->transparency);
+        return (seqend->common.cold->transparency);
 }
 
 
@@ -2160,7 +2095,7 @@ dxf_seqend_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        seqend->transparency = transparency;
+        seqend->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -42,6 +42,7 @@
 
 
 #include "shape.h"
+#include "entities.h"
 
 
 /*!
@@ -114,31 +115,22 @@ dxf_shape_init
                 __FUNCTION__);
               return (NULL);
         }
-        shape->id_code = 0;
-        shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        shape->layer = strdup (DXF_DEFAULT_LAYER);
-        shape->elevation = 0.0;
-        shape->thickness = 0.0;
-        shape->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        shape->visibility = DXF_DEFAULT_VISIBILITY;
-        shape->color = DXF_COLOR_BYLAYER;
-        shape->paperspace = DXF_MODELSPACE;
-        shape->graphics_data_size = 0;
-        shape->shadow_mode = 0;
-        shape->binary_graphics_data = dxf_binary_graphics_data_new ();
-        shape->binary_graphics_data = dxf_binary_graphics_data_init (shape->binary_graphics_data);
-        shape->dictionary_owner_soft = strdup ("");
-        shape->material = strdup ("");
-        shape->dictionary_owner_hard = strdup ("");
-        shape->lineweight = 0;
-        shape->plot_style_name = strdup ("");
-        shape->color_value = 0;
-        shape->color_name = strdup ("");
-        shape->transparency = 0;
+        if (dxf_entity_common_init (&shape->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         shape->shape_name = strdup ("");
-        shape->p0->x0 = 0.0;
-        shape->p0->y0 = 0.0;
-        shape->p0->z0 = 0.0;
+        shape->p0 = dxf_point_init (dxf_point_new ());
+        if (shape->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         shape->size = 0.0;
         shape->rel_x_scale = 0.0;
         shape->rot_angle = 0.0;
@@ -176,8 +168,9 @@ dxf_shape_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        char *dxf_entity_name = strdup ("SHAPE");
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -185,8 +178,6 @@ dxf_shape_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (shape == NULL)
@@ -194,286 +185,114 @@ dxf_shape_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                shape = dxf_shape_init (shape);
+                shape = dxf_shape_init (dxf_shape_new ());
+                if (shape == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a shape
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->shape_name);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &shape->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->p0->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * size. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->size);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * oblique angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &shape->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &shape->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &shape->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &shape->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbShape") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &shape->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &shape->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) shape->binary_graphics_data->next);
-                        shape->binary_graphics_data = (DxfBinaryGraphicsData *) shape->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->material);
+                        break;
                 }
-                else if (strcmp (temp_string, "360") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->dictionary_owner_hard);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &shape->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &shape->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &shape->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 2:
+                                free (shape->shape_name);
+                                shape->shape_name = strdup (value);
+                                break;
+                        case 10:
+                                shape->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                shape->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                shape->p0->z0 = atof (value);
+                                break;
+                        case 40:
+                                shape->size = atof (value);
+                                break;
+                        case 41:
+                                shape->rel_x_scale = atof (value);
+                                break;
+                        case 50:
+                                shape->rot_angle = atof (value);
+                                break;
+                        case 51:
+                                shape->obl_angle = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbShape") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                shape->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                shape->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                shape->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &shape->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (shape->shape_name, "") == 0)
+        if ((shape->common.linetype == NULL)
+          || (strcmp (shape->common.linetype, "") == 0))
         {
-                fprintf (stderr,
-                  (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, shape->id_code);
-                return (NULL);
+                free (shape->common.linetype);
+                shape->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (shape->linetype, "") == 0)
+        if ((shape->common.layer == NULL)
+          || (strcmp (shape->common.layer, "") == 0))
         {
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (shape->common.layer);
+                shape->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (strcmp (shape->layer, "") == 0)
+        if ((shape->shape_name == NULL)
+          || (strcmp (shape->shape_name, "") == 0))
         {
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                fprintf (stderr,
+                  (_("Error in %s () empty name string for the SHAPE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, shape->common.id_code);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -523,49 +342,49 @@ dxf_shape_write
         if (strcmp (shape->shape_name, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, shape->id_code);
+                  (_("Error in %s () empty name string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, shape->common.id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (shape->linetype, "") == 0)
+        if (strcmp (shape->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, shape->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, shape->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (shape->layer, "") == 0)
+        if (strcmp (shape->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, shape->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, shape->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (shape->size == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () size has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, shape->id_code);
+                  (_("Warning in %s () size has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, shape->common.id_code);
         }
         if (shape->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning: in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, shape->id_code);
+                  (_("Warning: in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, shape->common.id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (shape->id_code != -1)
+        if (shape->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", shape->id_code);
+                dxf_handle_write (fp, 5, shape->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -577,102 +396,96 @@ dxf_shape_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (shape->dictionary_owner_soft, "") != 0)
+        if ((shape->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", shape->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, shape->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (shape->dictionary_owner_hard, "") != 0)
+        if ((shape->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", shape->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, shape->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (shape->paperspace == DXF_PAPERSPACE)
+        if (shape->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", shape->layer);
-        if (strcmp (shape->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", shape->common.layer);
+        if (strcmp (shape->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", shape->linetype);
+                fprintf (fp->fp, "  6\n%s\n", shape->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (shape->material, "") != 0))
+          && (shape->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", shape->material);
+                dxf_handle_write (fp, 347, shape->common.cold->material);
         }
-        if (shape->color != DXF_COLOR_BYLAYER)
+        if (shape->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", shape->color);
+                fprintf (fp->fp, " 62\n%hd\n", shape->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", shape->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", shape->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (shape->elevation != 0.0))
+          && (shape->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", shape->elevation);
+                fprintf (fp->fp, " 38\n%f\n", shape->common.elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
-          && (shape->thickness != 0.0))
+          && (shape->common.thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", shape->thickness);
+                fprintf (fp->fp, " 39\n%f\n", shape->common.thickness);
         }
-        if (shape->linetype_scale != 1.0)
+        if (shape->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", shape->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", shape->common.linetype_scale);
         }
-        if (shape->visibility != 0)
+        if (shape->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", shape->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", shape->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (shape->graphics_data_size > 0))
+          && (shape->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", shape->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", shape->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", shape->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", shape->common.cold->graphics_data_size);
 #endif
-                if (shape->binary_graphics_data != NULL)
+                if (shape->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) shape->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, shape->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", shape->color_value);
-                fprintf (fp->fp, "430\n%s\n", shape->color_name);
-                fprintf (fp->fp, "440\n%ld\n", shape->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", shape->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", shape->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", shape->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", shape->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", shape->shadow_mode);
+                dxf_handle_write (fp, 390, shape->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", shape->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbShape\n");
         }
-        if (shape->thickness != 0.0)
+        if (shape->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", shape->thickness);
+                fprintf (fp->fp, " 39\n%f\n", shape->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", shape->x0);
         fprintf (fp->fp, " 20\n%f\n", shape->y0);
@@ -700,6 +513,7 @@ dxf_shape_write
                 fprintf (fp->fp, "220\n%f\n", shape->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", shape->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &shape->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -742,14 +556,7 @@ dxf_shape_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (shape->linetype);
-        free (shape->layer);
-        dxf_binary_graphics_data_free_list (shape->binary_graphics_data);
-        free (shape->dictionary_owner_soft);
-        free (shape->material);
-        free (shape->dictionary_owner_hard);
-        free (shape->plot_style_name);
-        free (shape->color_name);
+        dxf_entity_common_free (&shape->common);
         free (shape->shape_name);
         dxf_point_free (shape->p0);
         free (shape);
@@ -785,6 +592,7 @@ dxf_shape_free_list
         while (shapes != NULL)
         {
                 DxfShape *iter = (DxfShape *) shapes->next;
+                shapes->next = NULL;
                 dxf_shape_free (shapes);
                 shapes = (DxfShape *) iter;
         }
@@ -794,12 +602,89 @@ dxf_shape_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c SHAPE entity.
+ *
+ * The copy does not share any memory with \c shape, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfShape *
+dxf_shape_copy
+(
+        DxfShape *shape
+                /*!< a pointer to the DXF \c SHAPE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfShape *copy;
+
+        /* Do some basic checks. */
+        if (shape == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_shape_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, shape, sizeof (DxfShape));
+        copy->shape_name = NULL;
+        copy->p0 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &shape->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_shape_free (copy);
+                return (NULL);
+        }
+        if (shape->shape_name != NULL)
+        {
+                copy->shape_name = strdup (shape->shape_name);
+                if (copy->shape_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_shape_free (copy);
+                        return (NULL);
+                }
+        }
+        if (shape->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (shape->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_shape_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c SHAPE entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_shape_get_id_code
 (
         DxfShape *shape
@@ -817,16 +702,10 @@ dxf_shape_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->id_code);
+        return (shape->common.id_code);
 }
 
 
@@ -838,7 +717,7 @@ dxf_shape_set_id_code
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -855,13 +734,7 @@ dxf_shape_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        shape->id_code = id_code;
+        shape->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -892,7 +765,7 @@ dxf_shape_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->linetype ==  NULL)
+        if (shape->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -902,7 +775,7 @@ dxf_shape_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->linetype));
+        return (strdup (shape->common.linetype));
 }
 
 
@@ -937,7 +810,7 @@ dxf_shape_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->linetype = strdup (linetype);
+        shape->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -968,7 +841,7 @@ dxf_shape_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->layer ==  NULL)
+        if (shape->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -978,7 +851,7 @@ dxf_shape_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->layer));
+        return (strdup (shape->common.layer));
 }
 
 
@@ -1013,7 +886,7 @@ dxf_shape_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->layer = strdup (layer);
+        shape->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1047,7 +920,7 @@ dxf_shape_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->elevation);
+        return (shape->common.elevation);
 }
 
 
@@ -1074,7 +947,7 @@ dxf_shape_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->elevation = elevation;
+        shape->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1105,7 +978,7 @@ dxf_shape_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->thickness < 0.0)
+        if (shape->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1115,7 +988,7 @@ dxf_shape_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->thickness);
+        return (shape->common.thickness);
 }
 
 
@@ -1149,7 +1022,7 @@ dxf_shape_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->thickness = thickness;
+        shape->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1180,7 +1053,7 @@ dxf_shape_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->linetype_scale < 0.0)
+        if (shape->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1189,7 +1062,7 @@ dxf_shape_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->linetype_scale);
+        return (shape->common.linetype_scale);
 }
 
 
@@ -1223,7 +1096,7 @@ dxf_shape_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->linetype_scale = linetype_scale;
+        shape->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1254,13 +1127,13 @@ dxf_shape_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->visibility < 0)
+        if (shape->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (shape->visibility > 1)
+        if (shape->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1269,7 +1142,7 @@ dxf_shape_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->visibility);
+        return (shape->common.visibility);
 }
 
 
@@ -1308,7 +1181,7 @@ dxf_shape_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        shape->visibility = visibility;
+        shape->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1339,7 +1212,7 @@ dxf_shape_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->color < 0)
+        if (shape->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1348,7 +1221,7 @@ dxf_shape_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->color);
+        return (shape->common.color);
 }
 
 
@@ -1381,7 +1254,7 @@ dxf_shape_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        shape->color = color;
+        shape->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1412,13 +1285,13 @@ dxf_shape_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->paperspace < 0)
+        if (shape->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (shape->paperspace > 1)
+        if (shape->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1427,7 +1300,7 @@ dxf_shape_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->paperspace);
+        return (shape->common.paperspace);
 }
 
 
@@ -1467,7 +1340,7 @@ dxf_shape_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        shape->paperspace = paperspace;
+        shape->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1499,13 +1372,13 @@ dxf_shape_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->graphics_data_size < 0)
+        if (shape->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (shape->graphics_data_size == 0)
+        if (shape->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1514,7 +1387,7 @@ dxf_shape_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->graphics_data_size);
+        return (shape->common.cold->graphics_data_size);
 }
 
 
@@ -1557,7 +1430,7 @@ dxf_shape_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        shape->graphics_data_size = graphics_data_size;
+        shape->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1589,13 +1462,13 @@ dxf_shape_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (shape->shadow_mode < 0)
+        if (shape->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (shape->shadow_mode > 3)
+        if (shape->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1604,7 +1477,7 @@ dxf_shape_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->shadow_mode);
+        return (shape->common.cold->shadow_mode);
 }
 
 
@@ -1646,7 +1519,7 @@ dxf_shape_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        shape->shadow_mode = shadow_mode;
+        shape->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1658,11 +1531,12 @@ dxf_shape_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c SHAPE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_shape_get_binary_graphics_data
 (
         DxfShape *shape
@@ -1680,32 +1554,31 @@ dxf_shape_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) shape->binary_graphics_data);
+        return (shape->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c SHAPE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c shape when successful, or \c NULL when an
+ * error occurred.
  */
 DxfShape *
 dxf_shape_set_binary_graphics_data
 (
         DxfShape *shape,
                 /*!< a pointer to a DXF \c SHAPE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1726,7 +1599,12 @@ dxf_shape_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((shape->common.cold->binary_graphics_data != NULL)
+          && (shape->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (shape->common.cold->binary_graphics_data);
+        }
+        shape->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1760,17 +1638,10 @@ dxf_shape_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->dictionary_owner_soft));
+        return (dxf_handle_to_string (shape->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1806,7 +1677,7 @@ dxf_shape_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        shape->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1840,17 +1711,10 @@ dxf_shape_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->material));
+        return (dxf_handle_to_string (shape->common.cold->material));
 }
 
 
@@ -1888,7 +1752,7 @@ dxf_shape_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->material = strdup (material);
+        shape->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1922,17 +1786,10 @@ dxf_shape_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->dictionary_owner_hard));
+        return (dxf_handle_to_string (shape->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1968,7 +1825,7 @@ dxf_shape_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        shape->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2003,7 +1860,7 @@ dxf_shape_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->lineweight);
+        return (shape->common.lineweight);
 }
 
 
@@ -2033,7 +1890,7 @@ dxf_shape_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->lineweight = lineweight;
+        shape->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2065,17 +1922,10 @@ dxf_shape_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->plot_style_name));
+        return (dxf_handle_to_string (shape->common.cold->plot_style_name));
 }
 
 
@@ -2113,7 +1963,7 @@ dxf_shape_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->plot_style_name = strdup (plot_style_name);
+        shape->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2148,7 +1998,7 @@ dxf_shape_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->color_value);
+        return (shape->common.color_value);
 }
 
 
@@ -2178,7 +2028,7 @@ dxf_shape_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->color_value = color_value;
+        shape->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2210,7 +2060,7 @@ dxf_shape_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (shape->color_name ==  NULL)
+        if (shape->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2220,7 +2070,7 @@ dxf_shape_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (shape->color_name));
+        return (strdup (shape->common.cold->color_name));
 }
 
 
@@ -2258,7 +2108,7 @@ dxf_shape_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->color_name = strdup (color_name);
+        shape->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2293,7 +2143,7 @@ dxf_shape_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (shape->transparency);
+        return (shape->common.cold->transparency);
 }
 
 
@@ -2323,7 +2173,7 @@ dxf_shape_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        shape->transparency = transparency;
+        shape->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -0,0 +1,977 @@
+/*!
+ * \file snapshot.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for copy-on-write snapshots of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "snapshot.h"
+#include "section.h"
+#include "endsec.h"
+
+
+/*!
+ * \brief Find the private copy of the entity at \c position.
+ *
+ * \return the index in \c copies of the copy, or when there is no
+ * copy, minus one minus the index where it should be inserted.
+ */
+static int
+dxf_snapshot_find_copy
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        int position
+                /*!< position of the entity. */
+)
+{
+        int low = 0;
+        int high = snapshot->number_of_copies - 1;
+        int middle;
+
+        while (low <= high)
+        {
+                middle = low + ((high - low) / 2);
+                if (snapshot->copies[middle].position < position)
+                {
+                        low = middle + 1;
+                }
+                else if (snapshot->copies[middle].position > position)
+                {
+                        high = middle - 1;
+                }
+                else
+                {
+                        return (middle);
+                }
+        }
+        return (-1 - low);
+}
+
+
+/*!
+ * \brief Find the private copy of the table entry \c shared.
+ *
+ * \return the index in \c table_copies of the copy, or when there is
+ * no copy, minus one minus the index where it should be inserted.
+ */
+static int
+dxf_snapshot_find_table_copy
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        const void *shared
+                /*!< the entry in the tables of the drawing. */
+)
+{
+        int low = 0;
+        int high = snapshot->number_of_table_copies - 1;
+        int middle;
+
+        while (low <= high)
+        {
+                middle = low + ((high - low) / 2);
+                if ((uintptr_t) snapshot->table_copies[middle].shared < (uintptr_t) shared)
+                {
+                        low = middle + 1;
+                }
+                else if ((uintptr_t) snapshot->table_copies[middle].shared > (uintptr_t) shared)
+                {
+                        high = middle - 1;
+                }
+                else
+                {
+                        return (middle);
+                }
+        }
+        return (-1 - low);
+}
+
+
+/*!
+ * \brief Copy a symbol table entry of symbol table \c table.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when
+ * \c table is not a symbol table or an error occurred.
+ */
+static void *
+dxf_snapshot_copy_table_entry
+(
+        DxfHandleIndexType table,
+                /*!< symbol table of the entry. */
+        const void *entry
+                /*!< the entry to copy. */
+)
+{
+        void *copy = NULL;
+
+        switch (table)
+        {
+                case DXF_HANDLE_INDEX_APPID:
+                        copy = dxf_appid_copy ((DxfAppid *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_BLOCK_RECORD:
+                        copy = dxf_block_record_copy ((DxfBlockRecord *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_DIMSTYLE:
+                        copy = dxf_dimstyle_copy ((DxfDimStyle *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_LAYER:
+                        copy = dxf_layer_copy ((DxfLayer *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_LTYPE:
+                        copy = dxf_ltype_copy ((DxfLType *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_STYLE:
+                        copy = dxf_style_copy ((DxfStyle *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_UCS:
+                        copy = dxf_ucs_copy ((DxfUcs *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_VIEW:
+                        copy = dxf_view_copy ((DxfView *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_VPORT:
+                        copy = dxf_vport_copy ((DxfVPort *) entry);
+                        break;
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () an unsupported symbol table was passed.\n")),
+                          __FUNCTION__);
+                        break;
+        }
+        return (copy);
+}
+
+
+/*!
+ * \brief Free a symbol table entry of symbol table \c table.
+ */
+static void
+dxf_snapshot_free_table_entry
+(
+        DxfHandleIndexType table,
+                /*!< symbol table of the entry. */
+        void *entry
+                /*!< the entry to free. */
+)
+{
+        switch (table)
+        {
+                case DXF_HANDLE_INDEX_APPID:
+                        dxf_appid_free ((DxfAppid *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_BLOCK_RECORD:
+                        dxf_block_record_free ((DxfBlockRecord *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_DIMSTYLE:
+                        dxf_dimstyle_free ((DxfDimStyle *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_LAYER:
+                        dxf_layer_free ((DxfLayer *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_LTYPE:
+                        dxf_ltype_free ((DxfLType *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_STYLE:
+                        dxf_style_free ((DxfStyle *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_UCS:
+                        dxf_ucs_free ((DxfUcs *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_VIEW:
+                        dxf_view_free ((DxfView *) entry);
+                        break;
+                case DXF_HANDLE_INDEX_VPORT:
+                        dxf_vport_free ((DxfVPort *) entry);
+                        break;
+                default:
+                        break;
+        }
+}
+
+
+/*!
+ * \brief Check the snapshot and the position of an entity.
+ *
+ * \return \c TRUE when \c position is a valid position in the
+ * \c ENTITIES section of the drawing of \c snapshot, else \c FALSE.
+ */
+static int
+dxf_snapshot_check_position
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        int position,
+                /*!< position of the entity. */
+        const char *function
+                /*!< name of the calling function. */
+)
+{
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  function);
+                return (FALSE);
+        }
+        if ((position < 0)
+          || (position >= dxf_snapshot_get_number_of_entities (snapshot)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  function);
+                return (FALSE);
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfSnapshot.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfSnapshot *
+dxf_snapshot_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSnapshot *snapshot = NULL;
+        size_t size;
+
+        size = sizeof (DxfSnapshot);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((snapshot = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfSnapshot struct.\n")),
+                  __FUNCTION__);
+                snapshot = NULL;
+        }
+        else
+        {
+                memset (snapshot, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (snapshot);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfSnapshot of \c drawing.
+ *
+ * Taking a snapshot does not copy anything, the cost is independent
+ * of the size of the drawing.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfSnapshot *
+dxf_snapshot_init
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing to take a snapshot of. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                snapshot = dxf_snapshot_new ();
+        }
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        snapshot->drawing = drawing;
+        snapshot->copies = NULL;
+        snapshot->number_of_copies = 0;
+        snapshot->copies_size = 0;
+        snapshot->table_copies = NULL;
+        snapshot->number_of_table_copies = 0;
+        snapshot->table_copies_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (snapshot);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfSnapshot and all its
+ * private copies.
+ *
+ * The shared drawing is not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_snapshot_free
+(
+        DxfSnapshot *snapshot
+                /*!< a pointer to a snapshot. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < snapshot->number_of_copies; i++)
+        {
+                dxf_entities_free_entity (snapshot->copies[i].type,
+                  snapshot->copies[i].entity);
+        }
+        free (snapshot->copies);
+        for (i = 0; i < snapshot->number_of_table_copies; i++)
+        {
+                dxf_snapshot_free_table_entry (snapshot->table_copies[i].table,
+                  snapshot->table_copies[i].entry);
+        }
+        free (snapshot->table_copies);
+        free (snapshot);
+        snapshot = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the shared drawing of a \c DxfSnapshot.
+ *
+ * \warning The drawing is shared with other snapshots and must not be
+ * modified.
+ *
+ * \return a pointer to the drawing, or \c NULL when an error
+ * occurred.
+ */
+DxfDrawing *
+dxf_snapshot_get_drawing
+(
+        DxfSnapshot *snapshot
+                /*!< a pointer to a snapshot. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (snapshot->drawing);
+}
+
+
+/*!
+ * \brief Get the number of entities in the \c ENTITIES section of a
+ * \c DxfSnapshot.
+ *
+ * \return the number of entities, 0 when an error occurred.
+ */
+int
+dxf_snapshot_get_number_of_entities
+(
+        DxfSnapshot *snapshot
+                /*!< a pointer to a snapshot. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((snapshot == NULL)
+          || (snapshot->drawing == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if (snapshot->drawing->entities_list == NULL)
+        {
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (((DxfEntities *) snapshot->drawing->entities_list)->number_of_entities);
+}
+
+
+/*!
+ * \brief Get the number of private copies of entities in a
+ * \c DxfSnapshot.
+ *
+ * \return the number of copies, 0 when an error occurred.
+ */
+int
+dxf_snapshot_get_number_of_copies
+(
+        DxfSnapshot *snapshot
+                /*!< a pointer to a snapshot. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (snapshot->number_of_copies);
+}
+
+
+/*!
+ * \brief Test if the entity at \c position in a \c DxfSnapshot is
+ * still shared with the drawing.
+ *
+ * \return \c TRUE when shared, \c FALSE when the snapshot has a
+ * private copy or an error occurred.
+ */
+int
+dxf_snapshot_is_shared
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        int position
+                /*!< position of the entity in the file order sequence
+                 * of the \c ENTITIES section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (!dxf_snapshot_check_position (snapshot, position, __FUNCTION__))
+        {
+                return (FALSE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_snapshot_find_copy (snapshot, position) < 0);
+}
+
+
+/*!
+ * \brief Get the entity at \c position in a \c DxfSnapshot for
+ * reading.
+ *
+ * \warning The entity may be shared with the drawing and other
+ * snapshots and must not be modified, use
+ * dxf_snapshot_get_entity_for_write () to modify it.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+const void *
+dxf_snapshot_get_entity
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        int position,
+                /*!< position of the entity in the file order sequence
+                 * of the \c ENTITIES section. */
+        DxfEntityType *type
+                /*!< receives the type of the entity, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (!dxf_snapshot_check_position (snapshot, position, __FUNCTION__))
+        {
+                return (NULL);
+        }
+        i = dxf_snapshot_find_copy (snapshot, position);
+        if (i >= 0)
+        {
+                if (type != NULL)
+                {
+                        *type = snapshot->copies[i].type;
+                }
+                return (snapshot->copies[i].entity);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_entities_get_entity ((DxfEntities *) snapshot->drawing->entities_list, position, type));
+}
+
+
+/*!
+ * \brief Get the entity at \c position in a \c DxfSnapshot for
+ * writing.
+ *
+ * On the first write the shared entity is copied with
+ * dxf_entities_copy_entity (), later calls return the same private
+ * copy.
+ *
+ * \return a pointer to the private copy, or \c NULL when an error
+ * occurred.
+ */
+void *
+dxf_snapshot_get_entity_for_write
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        int position,
+                /*!< position of the entity in the file order sequence
+                 * of the \c ENTITIES section. */
+        DxfEntityType *type
+                /*!< receives the type of the entity, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntityType entity_type;
+        void *entity;
+        void *copy;
+        int i;
+
+        /* Do some basic checks. */
+        if (!dxf_snapshot_check_position (snapshot, position, __FUNCTION__))
+        {
+                return (NULL);
+        }
+        i = dxf_snapshot_find_copy (snapshot, position);
+        if (i >= 0)
+        {
+                if (type != NULL)
+                {
+                        *type = snapshot->copies[i].type;
+                }
+                return (snapshot->copies[i].entity);
+        }
+        entity = dxf_entities_get_entity ((DxfEntities *) snapshot->drawing->entities_list, position, &entity_type);
+        copy = dxf_entities_copy_entity (entity_type, entity);
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not copy entity %d.\n")),
+                  __FUNCTION__, position);
+                return (NULL);
+        }
+        if (dxf_snapshot_set_entity (snapshot, position, entity_type, copy) == NULL)
+        {
+                dxf_entities_free_entity (entity_type, copy);
+                return (NULL);
+        }
+        if (type != NULL)
+        {
+                *type = entity_type;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Replace the entity at \c position in a \c DxfSnapshot.
+ *
+ * The snapshot takes ownership of \c entity, a previous private copy
+ * at \c position is freed, the shared entity is left untouched.
+ *
+ * \return a pointer to \c snapshot when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfSnapshot *
+dxf_snapshot_set_entity
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        int position,
+                /*!< position of the entity in the file order sequence
+                 * of the \c ENTITIES section. */
+        DxfEntityType type,
+                /*!< type of \c entity. */
+        void *entity
+                /*!< pointer to the new entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSnapshotCopy *copies;
+        int size;
+        int i;
+
+        /* Do some basic checks. */
+        if (!dxf_snapshot_check_position (snapshot, position, __FUNCTION__))
+        {
+                return (NULL);
+        }
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_snapshot_find_copy (snapshot, position);
+        if (i >= 0)
+        {
+                if (snapshot->copies[i].entity != entity)
+                {
+                        dxf_entities_free_entity (snapshot->copies[i].type,
+                          snapshot->copies[i].entity);
+                }
+                snapshot->copies[i].type = type;
+                snapshot->copies[i].entity = entity;
+                return (snapshot);
+        }
+        i = -1 - i;
+        if (snapshot->number_of_copies >= snapshot->copies_size)
+        {
+                size = (snapshot->copies_size > 0) ? (2 * snapshot->copies_size) : 8;
+                copies = realloc (snapshot->copies, (size_t) size * sizeof (DxfSnapshotCopy));
+                if (copies == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                snapshot->copies = copies;
+                snapshot->copies_size = size;
+        }
+        memmove (&snapshot->copies[i + 1], &snapshot->copies[i],
+          (size_t) (snapshot->number_of_copies - i) * sizeof (DxfSnapshotCopy));
+        snapshot->copies[i].position = position;
+        snapshot->copies[i].type = type;
+        snapshot->copies[i].entity = entity;
+        snapshot->number_of_copies++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (snapshot);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for the \c ENTITIES section of a
+ * \c DxfSnapshot.
+ *
+ * Shared entities are written from the drawing, modified entities
+ * from their private copies, in file order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_snapshot_write_entities
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfSnapshot *snapshot
+                /*!< a pointer to a snapshot. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntities *entities;
+        DxfEntityType type;
+        void *entity;
+        int status = EXIT_SUCCESS;
+        int number_of_entities;
+        int i;
+        int j = 0;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        entities = (DxfEntities *) snapshot->drawing->entities_list;
+        number_of_entities = dxf_snapshot_get_number_of_entities (snapshot);
+        dxf_section_write (fp, "ENTITIES");
+        for (i = 0; i < number_of_entities; i++)
+        {
+                /* The copies are sorted by position, so a single
+                 * cursor walks them alongside the sequence. */
+                if ((j < snapshot->number_of_copies)
+                  && (snapshot->copies[j].position == i))
+                {
+                        type = snapshot->copies[j].type;
+                        entity = snapshot->copies[j].entity;
+                        j++;
+                }
+                else
+                {
+                        entity = dxf_entities_get_entity (entities, i, &type);
+                }
+                if (dxf_entities_write_entity (fp, type, entity) == EXIT_FAILURE)
+                {
+                        status = EXIT_FAILURE;
+                }
+        }
+        dxf_endsec_write (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/*!
+ * \brief Get the number of private copies of table entries in a
+ * \c DxfSnapshot.
+ *
+ * \return the number of table entries modified through the snapshot,
+ * or \c -1 when an error occurred.
+ */
+int
+dxf_snapshot_get_number_of_table_copies
+(
+        DxfSnapshot *snapshot
+                /*!< a pointer to a snapshot. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (snapshot == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (snapshot->number_of_table_copies);
+}
+
+
+/*!
+ * \brief Get a symbol table entry in a \c DxfSnapshot for reading.
+ *
+ * \c entry is an entry in the tables of the drawing, for instance
+ * found by walking \c layers of the drawing's \c DxfTables.
+ *
+ * \warning The entry may be shared with the drawing and other
+ * snapshots and must not be modified, use
+ * dxf_snapshot_get_table_entry_for_write () to modify it.
+ *
+ * \return the private copy when the entry was modified through the
+ * snapshot, else \c entry itself, or \c NULL when an error occurred.
+ */
+const void *
+dxf_snapshot_get_table_entry
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        DxfHandleIndexType table,
+                /*!< symbol table of the entry. */
+        const void *entry
+                /*!< the entry in the tables of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((snapshot == NULL) || (entry == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_snapshot_find_table_copy (snapshot, entry);
+        if ((i >= 0)
+          && (snapshot->table_copies[i].table == table))
+        {
+                return (snapshot->table_copies[i].entry);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entry);
+}
+
+
+/*!
+ * \brief Get a symbol table entry in a \c DxfSnapshot for writing.
+ *
+ * On the first write the shared entry is copied, later calls return
+ * the same private copy.\n
+ * All symbol tables (\c DXF_HANDLE_INDEX_APPID up to and including
+ * \c DXF_HANDLE_INDEX_VPORT) are supported, for any other value of
+ * \c table \c NULL is returned.
+ *
+ * \return a pointer to the private copy, or \c NULL when an error
+ * occurred.
+ */
+void *
+dxf_snapshot_get_table_entry_for_write
+(
+        DxfSnapshot *snapshot,
+                /*!< a pointer to a snapshot. */
+        DxfHandleIndexType table,
+                /*!< symbol table of the entry. */
+        const void *entry
+                /*!< the entry in the tables of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSnapshotTableCopy *table_copies;
+        void *copy;
+        int size;
+        int i;
+
+        /* Do some basic checks. */
+        if ((snapshot == NULL) || (entry == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_snapshot_find_table_copy (snapshot, entry);
+        if (i >= 0)
+        {
+                if (snapshot->table_copies[i].table != table)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () the entry is not in the passed symbol table.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                return (snapshot->table_copies[i].entry);
+        }
+        i = -1 - i;
+        copy = dxf_snapshot_copy_table_entry (table, entry);
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        if (snapshot->number_of_table_copies >= snapshot->table_copies_size)
+        {
+                size = (snapshot->table_copies_size > 0) ? (2 * snapshot->table_copies_size) : 8;
+                table_copies = realloc (snapshot->table_copies, (size_t) size * sizeof (DxfSnapshotTableCopy));
+                if (table_copies == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_snapshot_free_table_entry (table, copy);
+                        return (NULL);
+                }
+                snapshot->table_copies = table_copies;
+                snapshot->table_copies_size = size;
+        }
+        memmove (&snapshot->table_copies[i + 1], &snapshot->table_copies[i],
+          (size_t) (snapshot->number_of_table_copies - i) * sizeof (DxfSnapshotTableCopy));
+        snapshot->table_copies[i].table = table;
+        snapshot->table_copies[i].shared = entry;
+        snapshot->table_copies[i].entry = copy;
+        snapshot->number_of_table_copies++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/* EOF */
@@ -0,0 +1,143 @@
+/*!
+ * \file snapshot.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for copy-on-write snapshots of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_SNAPSHOT_H
+#define LIBDXF_SRC_SNAPSHOT_H
+
+
+#include "global.h"
+#include "drawing.h"
+#include "handle_index.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Private copy of an entity in a snapshot.
+ */
+typedef struct
+dxf_snapshot_copy_struct
+{
+        int position;
+                /*!< Position of the entity in the file order sequence
+                 * of the \c ENTITIES section. */
+        DxfEntityType type;
+                /*!< Type of \c entity. */
+        void *entity;
+                /*!< The private copy, owned by the snapshot. */
+} DxfSnapshotCopy;
+
+
+/*!
+ * \brief Private copy of a symbol table entry in a snapshot.
+ */
+typedef struct
+dxf_snapshot_table_copy_struct
+{
+        DxfHandleIndexType table;
+                /*!< Symbol table of the entry, \c DXF_HANDLE_INDEX_APPID
+                 * up to and including \c DXF_HANDLE_INDEX_VPORT. */
+        const void *shared;
+                /*!< The entry in the tables of the drawing. */
+        void *entry;
+                /*!< The private copy, owned by the snapshot. */
+} DxfSnapshotTableCopy;
+
+
+/*!
+ * \brief Copy-on-write snapshot of a DXF drawing.
+ *
+ * A snapshot shares all entities, table entries and other sections
+ * with its drawing, only entities and table entries that are modified
+ * through the snapshot are copied, on their first write.\n
+ * The drawing is only read, so any number of snapshots of the same
+ * drawing can be used at the same time (for instance one per thread)
+ * without locking, as long as the drawing itself is not modified and
+ * outlives its snapshots.\n
+ * A snapshot has the same entities at the same positions as its
+ * drawing: entities can be modified or replaced through the snapshot,
+ * but not inserted or deleted.
+ */
+typedef struct
+dxf_snapshot_struct
+{
+        DxfDrawing *drawing;
+                /*!< The shared drawing, never modified through the
+                 * snapshot. */
+        DxfSnapshotCopy *copies;
+                /*!< Contiguous array with the private copies, sorted
+                 * by \c position. */
+        int number_of_copies;
+                /*!< Number of items in use in \c copies. */
+        int copies_size;
+                /*!< Number of items allocated for \c copies. */
+        DxfSnapshotTableCopy *table_copies;
+                /*!< Contiguous array with the private copies of table
+                 * entries, sorted by the address of \c shared. */
+        int number_of_table_copies;
+                /*!< Number of items in use in \c table_copies. */
+        int table_copies_size;
+                /*!< Number of items allocated for \c table_copies. */
+} DxfSnapshot;
+
+
+DxfSnapshot *dxf_snapshot_new ();
+DxfSnapshot *dxf_snapshot_init (DxfSnapshot *snapshot, DxfDrawing *drawing);
+int dxf_snapshot_free (DxfSnapshot *snapshot);
+DxfDrawing *dxf_snapshot_get_drawing (DxfSnapshot *snapshot);
+int dxf_snapshot_get_number_of_entities (DxfSnapshot *snapshot);
+int dxf_snapshot_get_number_of_copies (DxfSnapshot *snapshot);
+int dxf_snapshot_is_shared (DxfSnapshot *snapshot, int position);
+const void *dxf_snapshot_get_entity (DxfSnapshot *snapshot, int position, DxfEntityType *type);
+void *dxf_snapshot_get_entity_for_write (DxfSnapshot *snapshot, int position, DxfEntityType *type);
+DxfSnapshot *dxf_snapshot_set_entity (DxfSnapshot *snapshot, int position, DxfEntityType type, void *entity);
+int dxf_snapshot_write_entities (DxfFile *fp, DxfSnapshot *snapshot);
+int dxf_snapshot_get_number_of_table_copies (DxfSnapshot *snapshot);
+const void *dxf_snapshot_get_table_entry (DxfSnapshot *snapshot, DxfHandleIndexType table, const void *entry);
+void *dxf_snapshot_get_table_entry_for_write (DxfSnapshot *snapshot, DxfHandleIndexType table, const void *entry);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_SNAPSHOT_H */
+
+
+/* EOF */
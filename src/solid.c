@@ -49,6 +49,7 @@
 
 
 #include "solid.h"
+#include "entities.h"
 
 
 /*!
@@ -119,27 +120,13 @@ dxf_solid_init
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->id_code = 0;
-        solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        solid->layer = strdup (DXF_DEFAULT_LAYER);
-        solid->elevation = 0.0;
-        solid->thickness = 0.0;
-        solid->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        solid->visibility = DXF_DEFAULT_VISIBILITY;
-        solid->color = DXF_COLOR_BYLAYER;
-        solid->paperspace = DXF_MODELSPACE;
-        solid->graphics_data_size = 0;
-        solid->shadow_mode = 0;
-        solid->binary_graphics_data = dxf_binary_graphics_data_new ();
-        solid->binary_graphics_data = dxf_binary_graphics_data_init (solid->binary_graphics_data);
-        solid->dictionary_owner_soft = strdup ("");
-        solid->material = strdup ("");
-        solid->dictionary_owner_hard = strdup ("");
-        solid->lineweight = 0;
-        solid->plot_style_name = strdup ("");
-        solid->color_value = 0;
-        solid->color_name = strdup ("");
-        solid->transparency = 0;
+        if (dxf_entity_common_init (&solid->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         solid->p0 = (DxfPoint *) dxf_point_new ();
         solid->p0 = (DxfPoint *) dxf_point_init ((DxfPoint *) solid->p0);
         solid->p0->x0 = 0.0;
@@ -194,7 +181,9 @@ dxf_solid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -202,8 +191,6 @@ dxf_solid_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (solid == NULL)
@@ -211,340 +198,118 @@ dxf_solid_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                solid = dxf_solid_init (solid);
-        }
-        if (solid->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                solid->p0 = dxf_point_init (solid->p0);
-        }
-        if (solid->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                solid->p1 = dxf_point_new ();
-                solid->p1 = dxf_point_init (solid->p1);
-        }
-        if (solid->p2 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                solid->p2 = dxf_point_init (solid->p2);
-        }
-        if (solid->p3== NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                solid->p3 = dxf_point_init (solid->p3);
+                solid = dxf_solid_init (dxf_solid_new ());
+                if (solid == NULL)
+                {
+                        return (NULL);
+                }
         }
-        /* Start reading and parsing. */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &solid->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p1->y0);
+                        break;
                 }
-                else if (strcmp (temp_string, "31") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p1->z0);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->p3->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &solid->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &solid->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &solid->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_12)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Subclass markers are post AutoCAD R12
-                         * variable so additional testing for the
-                         * version should probably be added here.
-                         * Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &solid->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &solid->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) solid->binary_graphics_data->next);
-                        solid->binary_graphics_data = (DxfBinaryGraphicsData *) solid->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &solid->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &solid->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &solid->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                solid->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                solid->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                solid->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                solid->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                solid->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                solid->p1->z0 = atof (value);
+                                break;
+                        case 12:
+                                solid->p2->x0 = atof (value);
+                                break;
+                        case 22:
+                                solid->p2->y0 = atof (value);
+                                break;
+                        case 32:
+                                solid->p2->z0 = atof (value);
+                                break;
+                        case 13:
+                                solid->p3->x0 = atof (value);
+                                break;
+                        case 23:
+                                solid->p3->y0 = atof (value);
+                                break;
+                        case 33:
+                                solid->p3->z0 = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_12)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbTrace") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                solid->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                solid->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                solid->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &solid->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (solid->linetype, "") == 0)
+        if ((solid->common.linetype == NULL)
+          || (strcmp (solid->common.linetype, "") == 0))
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (solid->common.linetype);
+                solid->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (solid->layer, "") == 0)
+        if ((solid->common.layer == NULL)
+          || (strcmp (solid->common.layer, "") == 0))
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                free (solid->common.layer);
+                solid->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -591,25 +356,25 @@ dxf_solid_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (solid->linetype, "") == 0)
+        if (strcmp (solid->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, solid->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, solid->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (solid->layer, "") == 0)
+        if (strcmp (solid->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, solid->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, solid->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (solid->p0 == NULL)
         {
@@ -649,9 +414,9 @@ dxf_solid_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (solid->id_code != -1)
+        if (solid->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", solid->id_code);
+                dxf_handle_write (fp, 5, solid->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -663,89 +428,83 @@ dxf_solid_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (solid->dictionary_owner_soft, "") != 0)
+        if ((solid->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", solid->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, solid->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (solid->dictionary_owner_hard, "") != 0)
+        if ((solid->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", solid->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, solid->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (solid->paperspace == DXF_PAPERSPACE)
+        if (solid->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", solid->layer);
-        if (strcmp (solid->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", solid->common.layer);
+        if (strcmp (solid->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", solid->linetype);
+                fprintf (fp->fp, "  6\n%s\n", solid->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (solid->material, "") != 0))
+          && (solid->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", solid->material);
+                dxf_handle_write (fp, 347, solid->common.cold->material);
         }
-        if (solid->color != DXF_COLOR_BYLAYER)
+        if (solid->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", solid->color);
+                fprintf (fp->fp, " 62\n%hd\n", solid->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", solid->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", solid->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (solid->elevation != 0.0))
+          && (solid->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", solid->elevation);
+                fprintf (fp->fp, " 38\n%f\n", solid->common.elevation);
         }
-        if (solid->linetype_scale != 1.0)
+        if (solid->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", solid->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", solid->common.linetype_scale);
         }
-        if (solid->visibility != 0)
+        if (solid->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", solid->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", solid->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (solid->graphics_data_size > 0))
+          && (solid->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", solid->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", solid->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", solid->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", solid->common.cold->graphics_data_size);
 #endif
-                if (solid->binary_graphics_data != NULL)
+                if (solid->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = solid->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, solid->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", solid->color_value);
-                fprintf (fp->fp, "430\n%s\n", solid->color_name);
-                fprintf (fp->fp, "440\n%ld\n", solid->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", solid->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", solid->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", solid->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", solid->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", solid->shadow_mode);
+                dxf_handle_write (fp, 390, solid->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", solid->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -763,9 +522,9 @@ dxf_solid_write
         fprintf (fp->fp, " 13\n%f\n", solid->p3->x0);
         fprintf (fp->fp, " 23\n%f\n", solid->p3->y0);
         fprintf (fp->fp, " 33\n%f\n", solid->p3->z0);
-        if (solid->thickness != 0.0)
+        if (solid->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", solid->thickness);
+                fprintf (fp->fp, " 39\n%f\n", solid->common.thickness);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (solid->extr_x0 != 0.0)
@@ -776,6 +535,7 @@ dxf_solid_write
                 fprintf (fp->fp, "220\n%f\n", solid->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", solid->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &solid->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -818,10 +578,11 @@ dxf_solid_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (solid->linetype);
-        free (solid->layer);
-        free (solid->dictionary_owner_soft);
-        free (solid->dictionary_owner_hard);
+        dxf_entity_common_free (&solid->common);
+        dxf_point_free (solid->p0);
+        dxf_point_free (solid->p1);
+        dxf_point_free (solid->p2);
+        dxf_point_free (solid->p3);
         free (solid);
         solid = NULL;
 #if DEBUG
@@ -855,6 +616,7 @@ dxf_solid_free_list
         while (solids != NULL)
         {
                 DxfSolid *iter = (DxfSolid *) solids->next;
+                solids->next = NULL;
                 dxf_solid_free (solids);
                 solids = (DxfSolid *) iter;
         }
@@ -864,12 +626,106 @@ dxf_solid_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c SOLID entity.
+ *
+ * The copy does not share any memory with \c solid, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfSolid *
+dxf_solid_copy
+(
+        DxfSolid *solid
+                /*!< a pointer to the DXF \c SOLID entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSolid *copy;
+
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_solid_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, solid, sizeof (DxfSolid));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &solid->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_solid_free (copy);
+                return (NULL);
+        }
+        if (solid->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (solid->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_solid_free (copy);
+                        return (NULL);
+                }
+        }
+        if (solid->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (solid->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_solid_free (copy);
+                        return (NULL);
+                }
+        }
+        if (solid->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (solid->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_solid_free (copy);
+                        return (NULL);
+                }
+        }
+        if (solid->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (solid->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_solid_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c SOLID entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_solid_get_id_code
 (
         DxfSolid *solid
@@ -887,16 +743,10 @@ dxf_solid_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->id_code);
+        return (solid->common.id_code);
 }
 
 
@@ -908,7 +758,7 @@ dxf_solid_set_id_code
 (
         DxfSolid *solid,
                 /*!< a pointer to a DXF \c SOLID entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -925,13 +775,7 @@ dxf_solid_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        solid->id_code = id_code;
+        solid->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -962,7 +806,7 @@ dxf_solid_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->linetype ==  NULL)
+        if (solid->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -972,7 +816,7 @@ dxf_solid_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->linetype));
+        return (strdup (solid->common.linetype));
 }
 
 
@@ -1007,7 +851,7 @@ dxf_solid_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->linetype = strdup (linetype);
+        solid->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1038,7 +882,7 @@ dxf_solid_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->layer ==  NULL)
+        if (solid->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1048,7 +892,7 @@ dxf_solid_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->layer));
+        return (strdup (solid->common.layer));
 }
 
 
@@ -1083,7 +927,7 @@ dxf_solid_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->layer = strdup (layer);
+        solid->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1117,7 +961,7 @@ dxf_solid_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->elevation);
+        return (solid->common.elevation);
 }
 
 
@@ -1144,7 +988,7 @@ dxf_solid_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->elevation = elevation;
+        solid->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1175,7 +1019,7 @@ dxf_solid_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->thickness < 0.0)
+        if (solid->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1184,7 +1028,7 @@ dxf_solid_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->thickness);
+        return (solid->common.thickness);
 }
 
 
@@ -1217,7 +1061,7 @@ dxf_solid_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->thickness = thickness;
+        solid->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1248,7 +1092,7 @@ dxf_solid_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->linetype_scale < 0.0)
+        if (solid->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1257,7 +1101,7 @@ dxf_solid_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->linetype_scale);
+        return (solid->common.linetype_scale);
 }
 
 
@@ -1290,7 +1134,7 @@ dxf_solid_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->linetype_scale = linetype_scale;
+        solid->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1321,13 +1165,13 @@ dxf_solid_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->visibility < 0)
+        if (solid->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->visibility > 1)
+        if (solid->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1336,7 +1180,7 @@ dxf_solid_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->visibility);
+        return (solid->common.visibility);
 }
 
 
@@ -1375,7 +1219,7 @@ dxf_solid_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->visibility = visibility;
+        solid->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1406,7 +1250,7 @@ dxf_solid_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->color < 0)
+        if (solid->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1415,7 +1259,7 @@ dxf_solid_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->color);
+        return (solid->common.color);
 }
 
 
@@ -1448,7 +1292,7 @@ dxf_solid_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->color = color;
+        solid->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1479,13 +1323,13 @@ dxf_solid_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->paperspace < 0)
+        if (solid->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->paperspace > 1)
+        if (solid->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1494,7 +1338,7 @@ dxf_solid_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->paperspace);
+        return (solid->common.paperspace);
 }
 
 
@@ -1534,7 +1378,7 @@ dxf_solid_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->paperspace = paperspace;
+        solid->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1566,13 +1410,13 @@ dxf_solid_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->graphics_data_size < 0)
+        if (solid->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->graphics_data_size == 0)
+        if (solid->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1581,7 +1425,7 @@ dxf_solid_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->graphics_data_size);
+        return (solid->common.cold->graphics_data_size);
 }
 
 
@@ -1624,7 +1468,7 @@ dxf_solid_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->graphics_data_size = graphics_data_size;
+        solid->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1656,13 +1500,13 @@ dxf_solid_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (solid->shadow_mode < 0)
+        if (solid->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (solid->shadow_mode > 3)
+        if (solid->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1671,7 +1515,7 @@ dxf_solid_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->shadow_mode);
+        return (solid->common.cold->shadow_mode);
 }
 
 
@@ -1713,7 +1557,7 @@ dxf_solid_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        solid->shadow_mode = shadow_mode;
+        solid->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1725,11 +1569,12 @@ dxf_solid_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c SOLID entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_solid_get_binary_graphics_data
 (
         DxfSolid *solid
@@ -1747,32 +1592,31 @@ dxf_solid_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) solid->binary_graphics_data);
+        return (solid->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c SOLID entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c solid when successful, or \c NULL when an
+ * error occurred.
  */
 DxfSolid *
 dxf_solid_set_binary_graphics_data
 (
         DxfSolid *solid,
                 /*!< a pointer to a DXF \c SOLID entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1793,7 +1637,12 @@ dxf_solid_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((solid->common.cold->binary_graphics_data != NULL)
+          && (solid->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (solid->common.cold->binary_graphics_data);
+        }
+        solid->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1827,17 +1676,10 @@ dxf_solid_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_soft));
+        return (dxf_handle_to_string (solid->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1873,7 +1715,7 @@ dxf_solid_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        solid->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1907,17 +1749,10 @@ dxf_solid_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->object_owner_soft));
+        return (dxf_handle_to_string (solid->common.cold->object_owner_soft));
 }
 
 
@@ -1953,7 +1788,7 @@ dxf_solid_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->object_owner_soft = strdup (object_owner_soft);
+        solid->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1987,17 +1822,10 @@ dxf_solid_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->material));
+        return (dxf_handle_to_string (solid->common.cold->material));
 }
 
 
@@ -2035,7 +1863,7 @@ dxf_solid_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->material = strdup (material);
+        solid->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2069,17 +1897,10 @@ dxf_solid_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_hard));
+        return (dxf_handle_to_string (solid->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2115,7 +1936,7 @@ dxf_solid_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        solid->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2150,7 +1971,7 @@ dxf_solid_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->lineweight);
+        return (solid->common.lineweight);
 }
 
 
@@ -2180,7 +2001,7 @@ dxf_solid_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->lineweight = lineweight;
+        solid->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2212,17 +2033,10 @@ dxf_solid_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->plot_style_name));
+        return (dxf_handle_to_string (solid->common.cold->plot_style_name));
 }
 
 
@@ -2260,7 +2074,7 @@ dxf_solid_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->plot_style_name = strdup (plot_style_name);
+        solid->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2295,7 +2109,7 @@ dxf_solid_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->color_value);
+        return (solid->common.color_value);
 }
 
 
@@ -2325,7 +2139,7 @@ dxf_solid_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_value = color_value;
+        solid->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2357,7 +2171,7 @@ dxf_solid_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->color_name ==  NULL)
+        if (solid->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2367,7 +2181,7 @@ dxf_solid_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->color_name));
+        return (strdup (solid->common.cold->color_name));
 }
 
 
@@ -2405,7 +2219,7 @@ dxf_solid_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_name = strdup (color_name);
+        solid->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2440,7 +2254,7 @@ dxf_solid_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (solid->transparency);
+        return (solid->common.cold->transparency);
 }
 
 
@@ -2470,7 +2284,7 @@ dxf_solid_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->transparency = transparency;
+        solid->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
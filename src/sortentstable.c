@@ -121,9 +121,9 @@ dxf_sortentstable_init
                 return (NULL);
         }
         sortentstable->id_code = 0;
-        sortentstable->dictionary_owner_soft = strdup ("");
-        sortentstable->dictionary_owner_hard = strdup ("");
-        sortentstable->block_owner = strdup ("");
+        sortentstable->dictionary_owner_soft = DXF_HANDLE_NONE;
+        sortentstable->dictionary_owner_hard = DXF_HANDLE_NONE;
+        sortentstable->block_owner = DXF_HANDLE_NONE;
         sortentstable->entity_owner = dxf_char_init (sortentstable->entity_owner);
         sortentstable->sort_handle->value = 0;
         sortentstable->next = NULL;
@@ -211,8 +211,7 @@ dxf_sortentstable_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &sortentstable->id_code);
+                        sortentstable->id_code = dxf_handle_read (fp);
                 }
                 if ((strcmp (temp_string, "5") == 0)
                   && (i > 0))
@@ -243,8 +242,7 @@ dxf_sortentstable_read
                 {
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->dictionary_owner_soft);
+                        sortentstable->dictionary_owner_soft = dxf_handle_read (fp);
                         j++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -253,8 +251,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing a soft pointer
                          * ID/handle to owner (currently only the
                          * *MODEL_SPACE or *PAPER_SPACE blocks). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->block_owner);
+                        sortentstable->block_owner = dxf_handle_read (fp);
                         j++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -272,8 +269,7 @@ dxf_sortentstable_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->dictionary_owner_hard);
+                        sortentstable->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -342,14 +338,14 @@ dxf_sortentstable_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, sortentstable->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (sortentstable->id_code != -1)
+        if (sortentstable->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", sortentstable->id_code);
+                dxf_handle_write (fp, 5, sortentstable->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -361,25 +357,25 @@ dxf_sortentstable_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (sortentstable->dictionary_owner_soft, "") != 0)
+        if ((sortentstable->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", sortentstable->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, sortentstable->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (sortentstable->dictionary_owner_hard, "") != 0)
+        if ((sortentstable->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", sortentstable->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, sortentstable->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbSortentsTable\n");
         }
-        fprintf (fp->fp, "330\n%s\n", sortentstable->block_owner);
+        dxf_handle_write (fp, 330, sortentstable->block_owner);
         if (sortentstable->entity_owner != NULL)
         {
                 iter_331 = (DxfChar*) sortentstable->entity_owner;
@@ -440,9 +436,6 @@ dxf_sortentstable_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (sortentstable->dictionary_owner_soft);
-        free (sortentstable->dictionary_owner_hard);
-        free (sortentstable->block_owner);
         dxf_char_free_list (sortentstable->entity_owner);
         free (sortentstable);
         sortentstable = NULL;
@@ -477,6 +470,7 @@ dxf_sortentstable_free_list
         while (sortentstables != NULL)
         {
                 DxfSortentsTable *iter = (DxfSortentsTable *) sortentstables->next;
+                sortentstables->next = NULL;
                 dxf_sortentstable_free (sortentstables);
                 sortentstables = (DxfSortentsTable *) iter;
         }
@@ -491,7 +485,7 @@ dxf_sortentstable_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_sortentstable_get_id_code
 (
         DxfSortentsTable *sortentstable
@@ -509,12 +503,6 @@ dxf_sortentstable_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sortentstable->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -530,7 +518,7 @@ dxf_sortentstable_set_id_code
 (
         DxfSortentsTable *sortentstable,
                 /*!< a pointer to a DXF \c SORTENTSTABLE object. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -547,12 +535,6 @@ dxf_sortentstable_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         sortentstable->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -587,17 +569,10 @@ dxf_sortentstable_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sortentstable->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->dictionary_owner_soft));
+        return (dxf_handle_to_string (sortentstable->dictionary_owner_soft));
 }
 
 
@@ -633,7 +608,7 @@ dxf_sortentstable_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        sortentstable->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -667,17 +642,10 @@ dxf_sortentstable_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sortentstable->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->dictionary_owner_hard));
+        return (dxf_handle_to_string (sortentstable->dictionary_owner_hard));
 }
 
 
@@ -713,7 +681,7 @@ dxf_sortentstable_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        sortentstable->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -747,17 +715,10 @@ dxf_sortentstable_get_block_owner
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sortentstable->block_owner ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sortentstable->block_owner));
+        return (dxf_handle_to_string (sortentstable->block_owner));
 }
 
 
@@ -793,7 +754,7 @@ dxf_sortentstable_set_block_owner
                   __FUNCTION__);
                 return (NULL);
         }
-        sortentstable->block_owner = strdup (block_owner);
+        sortentstable->block_owner = dxf_handle_parse (block_owner);
 #if DEBUG
         DXF_DEBUG_END
 #endif
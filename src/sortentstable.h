@@ -55,6 +55,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "util.h"
 
 
@@ -71,20 +72,20 @@ typedef struct
 dxf_sortentstable_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (ACAD_SORTENTS).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF sortentstable. */
-        char *block_owner;
+        DxfHandle block_owner;
                 /*!< Soft pointer ID/handle to owner (currently only the
                  * *MODEL_SPACE or *PAPER_SPACE blocks).\n
                  * Group code = 330. */
@@ -109,8 +110,8 @@ DxfSortentsTable *dxf_sortentstable_read (DxfFile *fp, DxfSortentsTable *sortent
 int dxf_sortentstable_write (DxfFile *fp, DxfSortentsTable *sortentstable);
 int dxf_sortentstable_free (DxfSortentsTable *sortentstable);
 void dxf_sortentstable_free_list (DxfSortentsTable *sortentstables);
-int dxf_sortentstable_get_id_code (DxfSortentsTable *sortentstable);
-DxfSortentsTable *dxf_sortentstable_set_id_code (DxfSortentsTable *sortentstable, int id_code);
+DxfHandle dxf_sortentstable_get_id_code (DxfSortentsTable *sortentstable);
+DxfSortentsTable *dxf_sortentstable_set_id_code (DxfSortentsTable *sortentstable, DxfHandle id_code);
 char *dxf_sortentstable_get_dictionary_owner_soft (DxfSortentsTable *sortentstable);
 DxfSortentsTable *dxf_sortentstable_set_dictionary_owner_soft (DxfSortentsTable *sortentstable, char *dictionary_owner_soft);
 char *dxf_sortentstable_get_dictionary_owner_hard (DxfSortentsTable *sortentstable);
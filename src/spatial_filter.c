@@ -114,8 +114,8 @@ dxf_spatial_filter_init
                 return (NULL);
         }
         spatial_filter->id_code = 0;
-        spatial_filter->dictionary_owner_soft = strdup ("");
-        spatial_filter->dictionary_owner_hard = strdup ("");
+        spatial_filter->dictionary_owner_soft = DXF_HANDLE_NONE;
+        spatial_filter->dictionary_owner_hard = DXF_HANDLE_NONE;
         spatial_filter->p0 = dxf_point_new ();
         spatial_filter->p0 = dxf_point_init (spatial_filter->p0);
         spatial_filter->p0->x0 = 0.0;
@@ -219,8 +219,7 @@ dxf_spatial_filter_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &spatial_filter->id_code);
+                        spatial_filter->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -371,16 +370,14 @@ dxf_spatial_filter_read
                         /* Now follows a string containing the Z-value
                          * of the normal to the plane containing the
                          * clip boundary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_filter->dictionary_owner_soft);
+                        spatial_filter->dictionary_owner_soft = dxf_handle_read (fp);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_filter->dictionary_owner_hard);
+                        spatial_filter->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -452,7 +449,7 @@ dxf_spatial_filter_write
                   (_("Error in %s () number of the clip boundary definition points is too small.\n")),
                   __FUNCTION__);
                 fprintf (stderr,
-                  (_("\tThe %s object with id-code %x is dropped from output.\n")),
+                  (_("\tThe %s object with id-code %" PRIx64 " is dropped from output.\n")),
                   dxf_entity_name, spatial_filter->id_code);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -461,14 +458,14 @@ dxf_spatial_filter_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, spatial_filter->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (spatial_filter->id_code != -1)
+        if (spatial_filter->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", spatial_filter->id_code);
+                dxf_handle_write (fp, 5, spatial_filter->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -480,18 +477,18 @@ dxf_spatial_filter_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (spatial_filter->dictionary_owner_soft, "") != 0)
+        if ((spatial_filter->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", spatial_filter->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, spatial_filter->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (spatial_filter->dictionary_owner_hard, "") != 0)
+        if ((spatial_filter->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", spatial_filter->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, spatial_filter->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -583,8 +580,6 @@ dxf_spatial_filter_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spatial_filter->dictionary_owner_soft);
-        free (spatial_filter->dictionary_owner_hard);
         free (spatial_filter);
         spatial_filter = NULL;
 #if DEBUG
@@ -618,6 +613,7 @@ dxf_spatial_filter_free_list
         while (spatial_filters != NULL)
         {
                 DxfSpatialFilter *iter = (DxfSpatialFilter *) spatial_filters->next;
+                spatial_filters->next = NULL;
                 dxf_spatial_filter_free (spatial_filters);
                 spatial_filters = (DxfSpatialFilter *) iter;
         }
@@ -632,7 +628,7 @@ dxf_spatial_filter_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_spatial_filter_get_id_code
 (
         DxfSpatialFilter *spatial_filter
@@ -650,12 +646,6 @@ dxf_spatial_filter_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spatial_filter->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -671,7 +661,7 @@ dxf_spatial_filter_set_id_code
 (
         DxfSpatialFilter *spatial_filter,
                 /*!< a pointer to a DXF \c SPATIAL_FILTER object. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the object.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -688,12 +678,6 @@ dxf_spatial_filter_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spatial_filter->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -728,17 +712,10 @@ dxf_spatial_filter_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spatial_filter->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_filter->dictionary_owner_soft));
+        return (dxf_handle_to_string (spatial_filter->dictionary_owner_soft));
 }
 
 
@@ -774,7 +751,7 @@ dxf_spatial_filter_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_filter->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spatial_filter->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -808,17 +785,10 @@ dxf_spatial_filter_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spatial_filter->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_filter->dictionary_owner_hard));
+        return (dxf_handle_to_string (spatial_filter->dictionary_owner_hard));
 }
 
 
@@ -854,7 +824,7 @@ dxf_spatial_filter_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_filter->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spatial_filter->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
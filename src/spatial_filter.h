@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "point.h"
 
 
@@ -61,15 +62,15 @@ typedef struct
 dxf_spatial_filter_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (SPATIAL).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF spatial_filter. */
@@ -173,8 +174,8 @@ DxfSpatialFilter *dxf_spatial_filter_read (DxfFile *fp, DxfSpatialFilter *spatia
 int dxf_spatial_filter_write (DxfFile *fp, DxfSpatialFilter *spatial_filter);
 int dxf_spatial_filter_free (DxfSpatialFilter *spatial_filter);
 void dxf_spatial_filter_free_list (DxfSpatialFilter *spatial_filters);
-int dxf_spatial_filter_get_id_code (DxfSpatialFilter *spatial_filter);
-DxfSpatialFilter *dxf_spatial_filter_set_id_code (DxfSpatialFilter *spatial_filter, int id_code);
+DxfHandle dxf_spatial_filter_get_id_code (DxfSpatialFilter *spatial_filter);
+DxfSpatialFilter *dxf_spatial_filter_set_id_code (DxfSpatialFilter *spatial_filter, DxfHandle id_code);
 char *dxf_spatial_filter_get_dictionary_owner_soft (DxfSpatialFilter *spatial_filter);
 DxfSpatialFilter *dxf_spatial_filter_set_dictionary_owner_soft (DxfSpatialFilter *spatial_filter, char *dictionary_owner_soft);
 char *dxf_spatial_filter_get_dictionary_owner_hard (DxfSpatialFilter *spatial_filter);
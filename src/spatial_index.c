@@ -117,8 +117,8 @@ dxf_spatial_index_init
                 return (NULL);
         }
         spatial_index->id_code = 0;
-        spatial_index->dictionary_owner_soft = strdup ("");
-        spatial_index->dictionary_owner_hard = strdup ("");
+        spatial_index->dictionary_owner_soft = DXF_HANDLE_NONE;
+        spatial_index->dictionary_owner_hard = DXF_HANDLE_NONE;
         if (time (&now) != (time_t)(-1))
         {
                 float fraction_day;
@@ -206,8 +206,7 @@ dxf_spatial_index_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &spatial_index->id_code);
+                        spatial_index->id_code = dxf_handle_read (fp);
                 }
                 if (strcmp (temp_string, "40") == 0)
                 {
@@ -235,15 +234,13 @@ dxf_spatial_index_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_index->dictionary_owner_soft);
+                        spatial_index->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_index->dictionary_owner_hard);
+                        spatial_index->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -313,14 +310,14 @@ dxf_spatial_index_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s entity with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, spatial_index->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (spatial_index->id_code != -1)
+        if (spatial_index->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", spatial_index->id_code);
+                dxf_handle_write (fp, 5, spatial_index->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -332,18 +329,18 @@ dxf_spatial_index_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (spatial_index->dictionary_owner_soft, "") != 0)
+        if ((spatial_index->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", spatial_index->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, spatial_index->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (spatial_index->dictionary_owner_hard, "") != 0)
+        if ((spatial_index->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", spatial_index->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, spatial_index->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -397,8 +394,6 @@ dxf_spatial_index_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spatial_index->dictionary_owner_soft);
-        free (spatial_index->dictionary_owner_hard);
         free (spatial_index);
         spatial_index = NULL;
 #if DEBUG
@@ -432,6 +427,7 @@ dxf_spatial_index_free_list
         while (spatial_indices != NULL)
         {
                 DxfSpatialIndex *iter = (DxfSpatialIndex *) spatial_indices->next;
+                spatial_indices->next = NULL;
                 dxf_spatial_index_free (spatial_indices);
                 spatial_indices = (DxfSpatialIndex *) iter;
         }
@@ -446,7 +442,7 @@ dxf_spatial_index_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_spatial_index_get_id_code
 (
         DxfSpatialIndex *spatial_index
@@ -464,12 +460,6 @@ dxf_spatial_index_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spatial_index->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -485,7 +475,7 @@ dxf_spatial_index_set_id_code
 (
         DxfSpatialIndex *spatial_index,
                 /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the object.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -502,12 +492,6 @@ dxf_spatial_index_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         spatial_index->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -542,17 +526,10 @@ dxf_spatial_index_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spatial_index->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_index->dictionary_owner_soft));
+        return (dxf_handle_to_string (spatial_index->dictionary_owner_soft));
 }
 
 
@@ -588,7 +565,7 @@ dxf_spatial_index_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spatial_index->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -622,17 +599,10 @@ dxf_spatial_index_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spatial_index->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spatial_index->dictionary_owner_hard));
+        return (dxf_handle_to_string (spatial_index->dictionary_owner_hard));
 }
 
 
@@ -668,7 +638,7 @@ dxf_spatial_index_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        spatial_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spatial_index->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
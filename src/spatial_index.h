@@ -49,6 +49,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -63,15 +64,15 @@ typedef struct
 dxf_spatial_index_struct
 {
         /* Members common for all DXF objects. */
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
                  * Group code = 5. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary.\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF spatial_index. */
@@ -90,8 +91,8 @@ DxfSpatialIndex *dxf_spatial_index_read (DxfFile *fp, DxfSpatialIndex *spatial_i
 int dxf_spatial_index_write (DxfFile *fp, DxfSpatialIndex *spatial_index);
 int dxf_spatial_index_free (DxfSpatialIndex *spatial_index);
 void dxf_spatial_index_free_list (DxfSpatialIndex *spatial_indices);
-int dxf_spatial_index_get_id_code (DxfSpatialIndex *spatial_index);
-DxfSpatialIndex *dxf_spatial_index_set_id_code (DxfSpatialIndex *spatial_index, int id_code);
+DxfHandle dxf_spatial_index_get_id_code (DxfSpatialIndex *spatial_index);
+DxfSpatialIndex *dxf_spatial_index_set_id_code (DxfSpatialIndex *spatial_index, DxfHandle id_code);
 char *dxf_spatial_index_get_dictionary_owner_soft (DxfSpatialIndex *spatial_index);
 DxfSpatialIndex *dxf_spatial_index_set_dictionary_owner_soft (DxfSpatialIndex *spatial_index, char *dictionary_owner_soft);
 char *dxf_spatial_index_get_dictionary_owner_hard (DxfSpatialIndex *spatial_index);
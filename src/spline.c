@@ -231,6 +231,7 @@
 
 
 #include "spline.h"
+#include "entities.h"
 
 
 /*!
@@ -303,26 +304,13 @@ dxf_spline_init
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->id_code = 0;
-        spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        spline->layer = strdup (DXF_DEFAULT_LAYER);
-        spline->elevation = 0.0;
-        spline->thickness = 0.0;
-        spline->linetype_scale = 1.0;
-        spline->visibility = 0;
-        spline->color = DXF_COLOR_BYLAYER;
-        spline->paperspace = DXF_MODELSPACE;
-        spline->graphics_data_size = 0;
-        spline->shadow_mode = 0;
-        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        spline->dictionary_owner_soft = strdup ("");
-        spline->material = strdup ("");
-        spline->dictionary_owner_hard = strdup ("");
-        spline->lineweight = 0;
-        spline->plot_style_name = strdup ("");
-        spline->color_value = 0;
-        spline->color_name = strdup ("");
-        spline->transparency = 0;
+        if (dxf_entity_common_init (&spline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         spline->p0 = dxf_point_new ();
         spline->p0 = dxf_point_init (spline->p0);
         spline->p1 = dxf_point_new ();
@@ -331,12 +319,10 @@ dxf_spline_init
         spline->p2 = dxf_point_init (spline->p2);
         spline->p3 = dxf_point_new ();
         spline->p3 = dxf_point_init (spline->p3);
-        dxf_double_new (spline->knot_value);
-        spline->knot_value = dxf_double_init (spline->knot_value);
-        spline->knot_value->value = 0.0;
-        dxf_double_new (spline->weight_value);
-        spline->weight_value = dxf_double_init (spline->weight_value);
-        spline->weight_value->value = 0.0;
+        spline->knot_value = dxf_double_array_new ();
+        spline->knot_value = dxf_double_array_init (spline->knot_value);
+        spline->weight_value = dxf_double_array_new ();
+        spline->weight_value = dxf_double_array_init (spline->weight_value);
         spline->extr_x0 = 0.0;
         spline->extr_y0 = 0.0;
         spline->extr_z0 = 0.0;
@@ -379,14 +365,11 @@ dxf_spline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryGraphicsData *binary_graphics_data = NULL;
-        DxfPoint *p0 = NULL;
-        DxfPoint *p1 = NULL;
-        DxfPoint *p2 = NULL;
-        DxfPoint *p3 = NULL;
-        DxfDouble *kv = NULL; /* knot_value iter. */
-        DxfDouble *wv = NULL; /* weight value iter. */
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        DxfPoint *iter_p0 = NULL;
+        DxfPoint *iter_p1 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -394,8 +377,6 @@ dxf_spline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (spline == NULL)
@@ -403,358 +384,174 @@ dxf_spline_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                spline = dxf_spline_init (spline);
+                spline = dxf_spline_init (dxf_spline_new ());
+                if (spline == NULL)
+                {
+                        return (NULL);
+                }
         }
-        binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
-        p0 = (DxfPoint *) spline->p0;
-        p1 = (DxfPoint *) spline->p1;
-        p2 = (DxfPoint *) spline->p2;
-        p3 = (DxfPoint *) spline->p3;
-        kv = (DxfDouble *) spline->knot_value;
-        wv = (DxfDouble *) spline->weight_value;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &spline->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the control point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of control point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the control point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->z0);
-                        dxf_point_init ((DxfPoint *) p0->next);
-                        p0 = (DxfPoint *) p0->next;
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the fit point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the fit point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the fit point coordinate
-                         * (multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->z0);
-                        dxf_point_init ((DxfPoint *) p1->next);
-                        p1 = (DxfPoint *) p1->next;
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->x0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->y0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->z0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the end tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->x0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the end tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->y0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the end tangent,
-                         * may be omitted (in WCS). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (spline->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a thickness value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a knot value (one entry per knot, multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &kv->value);
-                        dxf_double_init ((DxfDouble *) kv->next);
-                        kv = (DxfDouble *) kv->next;
+                        break;
                 }
-                else if (strcmp (temp_string, "41") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a weight value (one entry per knot, multiple entries). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &wv->value);
-                        dxf_double_init ((DxfDouble *) wv->next);
-                        wv = (DxfDouble *) wv->next;
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a knot tolerance value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->knot_tolerance);
-                }
-                else if (strcmp (temp_string, "43") == 0)
-                {
-                        /* Now follows a control point tolerance value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->control_point_tolerance);
-                }
-                else if (strcmp (temp_string, "44") == 0)
-                {
-                        /* Now follows a fit point tolerance value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->fit_tolerance);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a linetype scale value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a flag value (bit coded). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a degree of spline curve value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->degree);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a number of knots value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->number_of_knots);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a number of control points value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->number_of_control_points);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a number of fit points value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->number_of_fit_points);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &spline->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
-                        binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a
-                         * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &spline->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &spline->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &spline->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                /* One control point after the other, the first one is stored in
+                                 * the point allocated by dxf_spline_init (). */
+                                if (iter_p0 == NULL)
+                                {
+                                        iter_p0 = spline->p0;
+                                }
+                                else
+                                {
+                                        iter_p0->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
+                                        iter_p0 = (DxfPoint *) iter_p0->next;
+                                }
+                                iter_p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                if (iter_p0 != NULL)
+                                {
+                                        iter_p0->y0 = atof (value);
+                                }
+                                break;
+                        case 30:
+                                if (iter_p0 != NULL)
+                                {
+                                        iter_p0->z0 = atof (value);
+                                }
+                                break;
+                        case 11:
+                                /* One fit point after the other, the first one is stored in
+                                 * the point allocated by dxf_spline_init (). */
+                                if (iter_p1 == NULL)
+                                {
+                                        iter_p1 = spline->p1;
+                                }
+                                else
+                                {
+                                        iter_p1->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
+                                        iter_p1 = (DxfPoint *) iter_p1->next;
+                                }
+                                iter_p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                if (iter_p1 != NULL)
+                                {
+                                        iter_p1->y0 = atof (value);
+                                }
+                                break;
+                        case 31:
+                                if (iter_p1 != NULL)
+                                {
+                                        iter_p1->z0 = atof (value);
+                                }
+                                break;
+                        case 12:
+                                spline->p2->x0 = atof (value);
+                                break;
+                        case 22:
+                                spline->p2->y0 = atof (value);
+                                break;
+                        case 32:
+                                spline->p2->z0 = atof (value);
+                                break;
+                        case 13:
+                                spline->p3->x0 = atof (value);
+                                break;
+                        case 23:
+                                spline->p3->y0 = atof (value);
+                                break;
+                        case 33:
+                                spline->p3->z0 = atof (value);
+                                break;
+                        case 40:
+                                dxf_double_array_append (spline->knot_value, atof (value));
+                                break;
+                        case 41:
+                                dxf_double_array_append (spline->weight_value, atof (value));
+                                break;
+                        case 42:
+                                spline->knot_tolerance = atof (value);
+                                break;
+                        case 43:
+                                spline->control_point_tolerance = atof (value);
+                                break;
+                        case 44:
+                                spline->fit_tolerance = atof (value);
+                                break;
+                        case 70:
+                                spline->flag = atoi (value);
+                                break;
+                        case 71:
+                                spline->degree = atoi (value);
+                                break;
+                        case 72:
+                                spline->number_of_knots = atoi (value);
+                                /* Make room for all knot values at once. */
+                                dxf_double_array_reserve (spline->knot_value, spline->number_of_knots);
+                                break;
+                        case 73:
+                                spline->number_of_control_points = atoi (value);
+                                break;
+                        case 74:
+                                spline->number_of_fit_points = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbSpline") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &spline->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (spline->linetype, "") == 0)
+        if ((spline->common.linetype == NULL)
+          || (strcmp (spline->common.linetype, "") == 0))
         {
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (spline->common.linetype);
+                spline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (spline->layer, "") == 0)
+        if ((spline->common.layer == NULL)
+          || (strcmp (spline->common.layer, "") == 0))
         {
-                spline->layer = strdup (DXF_DEFAULT_LAYER);
+                free (spline->common.layer);
+                spline->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -782,7 +579,6 @@ dxf_spline_write
 #endif
         char *dxf_entity_name = strdup ("SPLINE");
         int i;
-        DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
         DxfPoint *p2 = NULL;
@@ -813,36 +609,35 @@ dxf_spline_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (spline->linetype, "") == 0)
+        if (strcmp (spline->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, spline->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, spline->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                spline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (spline->layer, "") == 0)
+        if (strcmp (spline->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, spline->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, spline->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                spline->layer = DXF_DEFAULT_LAYER;
+                spline->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
         p2 = (DxfPoint *) spline->p2;
         p3 = (DxfPoint *) spline->p3;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (spline->id_code != -1)
+        if (spline->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", spline->id_code);
+                dxf_handle_write (fp, 5, spline->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -854,72 +649,71 @@ dxf_spline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (spline->dictionary_owner_soft, "") != 0)
+        if ((spline->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", spline->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, spline->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (spline->dictionary_owner_hard, "") != 0)
+        if ((spline->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", spline->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, spline->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (spline->paperspace == DXF_PAPERSPACE)
+        if (spline->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", spline->layer);
-        if (strcmp (spline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", spline->common.layer);
+        if (strcmp (spline->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", spline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", spline->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (spline->elevation != 0.0))
+          && (spline->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", spline->elevation);
+                fprintf (fp->fp, " 38\n%f\n", spline->common.elevation);
         }
         if ((fp->acad_version_number >= AutoCAD_2007)
-          && (strcmp (spline->material, "") != 0))
+          && (spline->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", spline->material);
+                dxf_handle_write (fp, 347, spline->common.cold->material);
         }
-        if (spline->color != DXF_COLOR_BYLAYER)
+        if (spline->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%hd\n", spline->color);
+                fprintf (fp->fp, " 62\n%hd\n", spline->common.color);
         }
-        if (spline->thickness != 0.0)
+        if (spline->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", spline->thickness);
+                fprintf (fp->fp, " 39\n%f\n", spline->common.thickness);
         }
-        fprintf (fp->fp, "370\n%d\n", spline->lineweight);
-        fprintf (fp->fp, " 48\n%f\n", spline->linetype_scale);
-        if (spline->visibility != 0)
+        fprintf (fp->fp, "370\n%hd\n", spline->common.lineweight);
+        fprintf (fp->fp, " 48\n%f\n", spline->common.linetype_scale);
+        if (spline->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%hd\n", spline->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", spline->common.visibility);
         }
-        fprintf (fp->fp, " 92\n%" PRIi32 "\n", spline->graphics_data_size);
+        fprintf (fp->fp, " 92\n%" PRIi32 "\n", spline->common.cold->graphics_data_size);
         /*!
          * \todo On 64 bit machines use group code 160.
          */
-        while (binary_graphics_data != NULL)
+        if (spline->common.cold->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
-                binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (binary_graphics_data);
+                dxf_binary_buffer_write (fp, 310, spline->common.cold->binary_graphics_data);
         }
-        fprintf (fp->fp, "420\n%" PRIi32 "\n", spline->color_value);
-        fprintf (fp->fp, "430\n%s\n", spline->color_name);
-        fprintf (fp->fp, "440\n%" PRIi32 "\n", spline->transparency);
-        fprintf (fp->fp, "390\n%s\n", spline->plot_style_name);
-        fprintf (fp->fp, "284\n%hd\n", spline->shadow_mode);
+        fprintf (fp->fp, "420\n%" PRIi32 "\n", spline->common.color_value);
+        fprintf (fp->fp, "430\n%s\n", spline->common.cold->color_name);
+        fprintf (fp->fp, "440\n%" PRIi32 "\n", spline->common.cold->transparency);
+        dxf_handle_write (fp, 390, spline->common.cold->plot_style_name);
+        fprintf (fp->fp, "284\n%hd\n", spline->common.cold->shadow_mode);
         fprintf (fp->fp, "100\nAcDbSpline\n");
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (spline->extr_x0 != 0.0)
@@ -943,33 +737,29 @@ dxf_spline_write
         fprintf (fp->fp, " 13\n%f\n", p3->x0);
         fprintf (fp->fp, " 23\n%f\n", p3->y0);
         fprintf (fp->fp, " 33\n%f\n", p3->z0);
-        for (i = 0; i < spline->number_of_knots; i++)
+        for (i = 0; i < (int) spline->knot_value->length; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spline->knot_value->value);
-                /*! \todo implement as a single linked list of double. */
+                fprintf (fp->fp, " 40\n%f\n", spline->knot_value->values[i]);
         }
-        if (spline->number_of_fit_points != 0)
+        for (i = 0; i < (int) spline->weight_value->length; i++)
         {
-        for (i = 0; i < spline->number_of_fit_points; i++)
-                {
-                        fprintf (fp->fp, " 41\n%f\n", spline->weight_value->value);
-                        /*! \todo implement as a single linked list of double. */
-                }
+                fprintf (fp->fp, " 41\n%f\n", spline->weight_value->values[i]);
         }
-        while (spline->p0 != NULL)
+        while (p0 != NULL)
         {
                 fprintf (fp->fp, " 10\n%f\n", p0->x0);
                 fprintf (fp->fp, " 20\n%f\n", p0->y0);
                 fprintf (fp->fp, " 30\n%f\n", p0->z0);
                 p0 = (DxfPoint *) dxf_point_get_next (p0);
         }
-        while (spline->p1 != NULL)
+        while (p1 != NULL)
         {
                 fprintf (fp->fp, " 11\n%f\n", p1->x0);
                 fprintf (fp->fp, " 21\n%f\n", p1->y0);
                 fprintf (fp->fp, " 31\n%f\n", p1->z0);
                 p1 = (DxfPoint *) dxf_point_get_next (p1);
         }
+        dxf_entity_common_write_xdata (fp, &spline->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -1012,20 +802,13 @@ dxf_spline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->linetype);
-        free (spline->layer);
-        dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        free (spline->dictionary_owner_soft);
-        free (spline->material);
-        free (spline->dictionary_owner_hard);
-        free (spline->plot_style_name);
-        free (spline->color_name);
+        dxf_entity_common_free (&spline->common);
         dxf_point_free_list (spline->p0);
         dxf_point_free_list (spline->p1);
         dxf_point_free (spline->p2);
         dxf_point_free (spline->p3);
-        dxf_double_free_list (spline->knot_value);
-        dxf_double_free_list (spline->weight_value);
+        dxf_double_array_free (spline->knot_value);
+        dxf_double_array_free (spline->weight_value);
         free (spline);
         spline = NULL;
 #if DEBUG
@@ -1059,6 +842,7 @@ dxf_spline_free_list
         while (splines != NULL)
         {
                 DxfSpline *iter = (DxfSpline *) splines->next;
+                splines->next = NULL;
                 dxf_spline_free (splines);
                 splines = (DxfSpline *) iter;
         }
@@ -1068,13 +852,127 @@ dxf_spline_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c SPLINE entity.
+ *
+ * The copy does not share any memory with \c spline, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfSpline *
+dxf_spline_copy
+(
+        DxfSpline *spline
+                /*!< a pointer to the DXF \c SPLINE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpline *copy;
+
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_spline_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, spline, sizeof (DxfSpline));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->knot_value = NULL;
+        copy->weight_value = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &spline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_spline_free (copy);
+                return (NULL);
+        }
+        if (spline->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy_list (spline->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_spline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (spline->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy_list (spline->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_spline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (spline->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (spline->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_spline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (spline->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (spline->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_spline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (spline->knot_value != NULL)
+        {
+                copy->knot_value = dxf_double_array_copy (spline->knot_value);
+                if (copy->knot_value == NULL)
+                {
+                        dxf_spline_free (copy);
+                        return (NULL);
+                }
+        }
+        if (spline->weight_value != NULL)
+        {
+                copy->weight_value = dxf_double_array_copy (spline->weight_value);
+                if (copy->weight_value == NULL)
+                {
+                        dxf_spline_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c SPLINE.
  *
  * \return \c id_code when successful, or \c EXIT_FAILURE when an error
  * occurred.
  */
-int
+DxfHandle
 dxf_spline_get_id_code
 (
         DxfSpline *spline
@@ -1092,16 +990,10 @@ dxf_spline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->id_code);
+        return (spline->common.id_code);
 }
 
 
@@ -1115,7 +1007,7 @@ dxf_spline_set_id_code
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -1132,13 +1024,7 @@ dxf_spline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        spline->id_code = id_code;
+        spline->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1169,7 +1055,7 @@ dxf_spline_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->linetype ==  NULL)
+        if (spline->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
@@ -1179,7 +1065,7 @@ dxf_spline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->linetype));
+        return (strdup (spline->common.linetype));
 }
 
 
@@ -1216,7 +1102,7 @@ dxf_spline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->linetype = strdup (linetype);
+        spline->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1247,7 +1133,7 @@ dxf_spline_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->layer ==  NULL)
+        if (spline->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
@@ -1257,7 +1143,7 @@ dxf_spline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->layer));
+        return (strdup (spline->common.layer));
 }
 
 
@@ -1294,7 +1180,7 @@ dxf_spline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->layer = strdup (layer);
+        spline->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1329,7 +1215,7 @@ dxf_spline_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->elevation);
+        return (spline->common.elevation);
 }
 
 
@@ -1359,7 +1245,7 @@ dxf_spline_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->elevation = elevation;
+        spline->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1391,7 +1277,7 @@ dxf_spline_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->thickness < 0.0)
+        if (spline->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
@@ -1400,7 +1286,7 @@ dxf_spline_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->thickness);
+        return (spline->common.thickness);
 }
 
 
@@ -1436,7 +1322,7 @@ dxf_spline_set_thickness
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
-        spline->thickness = thickness;
+        spline->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1468,7 +1354,7 @@ dxf_spline_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->linetype_scale < 0.0)
+        if (spline->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
@@ -1478,7 +1364,7 @@ dxf_spline_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->linetype_scale);
+        return (spline->common.linetype_scale);
 }
 
 
@@ -1515,7 +1401,7 @@ dxf_spline_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->linetype_scale = linetype_scale;
+        spline->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1547,14 +1433,14 @@ dxf_spline_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->visibility < 0)
+        if (spline->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->visibility > 1)
+        if (spline->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
@@ -1564,7 +1450,7 @@ dxf_spline_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->visibility);
+        return (spline->common.visibility);
 }
 
 
@@ -1608,7 +1494,7 @@ dxf_spline_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->visibility = visibility;
+        spline->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1640,7 +1526,7 @@ dxf_spline_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->color < 0)
+        if (spline->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
@@ -1649,7 +1535,7 @@ dxf_spline_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->color);
+        return (spline->common.color);
 }
 
 
@@ -1687,7 +1573,7 @@ dxf_spline_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        spline->color = color;
+        spline->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1719,13 +1605,13 @@ dxf_spline_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->paperspace < 0)
+        if (spline->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
-        if (spline->paperspace > 1)
+        if (spline->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
@@ -1734,7 +1620,7 @@ dxf_spline_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->paperspace);
+        return (spline->common.paperspace);
 }
 
 
@@ -1779,7 +1665,7 @@ dxf_spline_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->paperspace = paperspace;
+        spline->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1811,13 +1697,13 @@ dxf_spline_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->graphics_data_size < 0)
+        if (spline->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
-        if (spline->graphics_data_size == 0)
+        if (spline->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
@@ -1826,7 +1712,7 @@ dxf_spline_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->graphics_data_size);
+        return (spline->common.cold->graphics_data_size);
 }
 
 
@@ -1871,7 +1757,7 @@ dxf_spline_set_graphics_data_size
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->graphics_data_size = graphics_data_size;
+        spline->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1903,14 +1789,14 @@ dxf_spline_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->shadow_mode < 0)
+        if (spline->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->shadow_mode > 3)
+        if (spline->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
@@ -1920,7 +1806,7 @@ dxf_spline_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->shadow_mode);
+        return (spline->common.cold->shadow_mode);
 }
 
 
@@ -1964,7 +1850,7 @@ dxf_spline_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->shadow_mode = shadow_mode;
+        spline->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1973,15 +1859,15 @@ dxf_spline_set_shadow_mode
 
 
 /*!
- * \brief Get the pointer to the \c binary_graphics_data from a DXF 
+ * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c SPLINE entity.
  *
- * \return a pointer to the \c binary_graphics_data when successful, or
- * \c NULL when an error occurred.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_spline_get_binary_graphics_data
 (
         DxfSpline *spline
@@ -1999,17 +1885,10 @@ dxf_spline_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
+        return (spline->common.cold->binary_graphics_data);
 }
 
 
@@ -2017,6 +1896,9 @@ dxf_spline_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c SPLINE entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c spline when successful, or \c NULL when an
  * error occurred.
  */
@@ -2025,9 +1907,9 @@ dxf_spline_set_binary_graphics_data
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -2048,7 +1930,12 @@ dxf_spline_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((spline->common.cold->binary_graphics_data != NULL)
+          && (spline->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (spline->common.cold->binary_graphics_data);
+        }
+        spline->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2083,17 +1970,10 @@ dxf_spline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_soft));
+        return (dxf_handle_to_string (spline->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2132,7 +2012,7 @@ dxf_spline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spline->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2166,17 +2046,10 @@ dxf_spline_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the material member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->material));
+        return (dxf_handle_to_string (spline->common.cold->material));
 }
 
 
@@ -2214,7 +2087,7 @@ dxf_spline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->material = strdup (material);
+        spline->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2249,17 +2122,10 @@ dxf_spline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_hard));
+        return (dxf_handle_to_string (spline->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2298,7 +2164,7 @@ dxf_spline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spline->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2333,7 +2199,7 @@ dxf_spline_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->lineweight);
+        return (spline->common.lineweight);
 }
 
 
@@ -2363,7 +2229,7 @@ dxf_spline_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->lineweight = lineweight;
+        spline->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2395,17 +2261,10 @@ dxf_spline_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->plot_style_name));
+        return (dxf_handle_to_string (spline->common.cold->plot_style_name));
 }
 
 
@@ -2443,7 +2302,7 @@ dxf_spline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->plot_style_name = strdup (plot_style_name);
+        spline->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2478,7 +2337,7 @@ dxf_spline_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->color_value);
+        return (spline->common.color_value);
 }
 
 
@@ -2508,7 +2367,7 @@ dxf_spline_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->color_value = color_value;
+        spline->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2540,7 +2399,7 @@ dxf_spline_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (spline->color_name ==  NULL)
+        if (spline->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
@@ -2550,7 +2409,7 @@ dxf_spline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->color_name));
+        return (strdup (spline->common.cold->color_name));
 }
 
 
@@ -2588,7 +2447,7 @@ dxf_spline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->color_name = strdup (color_name);
+        spline->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2623,7 +2482,7 @@ dxf_spline_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (spline->transparency);
+        return (spline->common.cold->transparency);
 }
 
 
@@ -2653,7 +2512,7 @@ dxf_spline_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->transparency = transparency;
+        spline->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
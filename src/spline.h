@@ -44,6 +44,9 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
+#include "binary_data.h"
 #include "binary_graphics_data.h"
 #include "point.h"
 #include "util.h"
@@ -66,112 +69,9 @@ typedef struct
 dxf_spline_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the spline in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67. */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92. */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284. */
-        DxfBinaryGraphicsData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440. */
-        /* Specific members for a DXF spline. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfPoint *p0;
                 /*!< Control point (multiple entries).\n
                  * Group codes = 10, 20 and 30.*/
@@ -186,11 +86,11 @@ dxf_spline_struct
                 /*!< End tangent point.\n
                  * May be omitted (in WCS).\n
                  * Group codes = 13, 23 and 33. */
-        DxfDouble *knot_value;
-                /*!< Knot value (one entry per knot, multiple entries).\n
+        DxfDoubleArray *knot_value;
+                /*!< Knot values (one entry per knot, multiple entries).\n
                  * Group code = 40. */
-        DxfDouble *weight_value;
-                /*!< Weight (if not 1); with multiple group pairs, they
+        DxfDoubleArray *weight_value;
+                /*!< Weights (if not 1); with multiple group pairs, they
                  * are present if all are not 1.\n
                  * Group code = 41. */
         double knot_tolerance;
@@ -248,8 +148,9 @@ DxfSpline *dxf_spline_read (DxfFile *fp, DxfSpline *spline);
 int dxf_spline_write (DxfFile *fp, DxfSpline *spline);
 int dxf_spline_free (DxfSpline *spline);
 void dxf_spline_free_list (DxfSpline *splines);
-int dxf_spline_get_id_code (DxfSpline *spline);
-DxfSpline *dxf_spline_set_id_code (DxfSpline *spline, int id_code);
+DxfSpline *dxf_spline_copy (DxfSpline *spline);
+DxfHandle dxf_spline_get_id_code (DxfSpline *spline);
+DxfSpline *dxf_spline_set_id_code (DxfSpline *spline, DxfHandle id_code);
 char *dxf_spline_get_linetype (DxfSpline *spline);
 DxfSpline *dxf_spline_set_linetype (DxfSpline *spline, char *linetype);
 char *dxf_spline_get_layer (DxfSpline *spline);
@@ -270,8 +171,8 @@ int32_t dxf_spline_get_graphics_data_size (DxfSpline *spline);
 DxfSpline *dxf_spline_set_graphics_data_size (DxfSpline *spline, int32_t graphics_data_size);
 int16_t dxf_spline_get_shadow_mode (DxfSpline *spline);
 DxfSpline *dxf_spline_set_shadow_mode (DxfSpline *spline, int16_t shadow_mode);
-DxfBinaryGraphicsData *dxf_spline_get_binary_graphics_data (DxfSpline *spline);
-DxfSpline *dxf_spline_set_binary_graphics_data (DxfSpline *spline, DxfBinaryGraphicsData *data);
+DxfBinaryBuffer *dxf_spline_get_binary_graphics_data (DxfSpline *spline);
+DxfSpline *dxf_spline_set_binary_graphics_data (DxfSpline *spline, DxfBinaryBuffer *data);
 char *dxf_spline_get_dictionary_owner_soft (DxfSpline *spline);
 DxfSpline *dxf_spline_set_dictionary_owner_soft (DxfSpline *spline, char *dictionary_owner_soft);
 char *dxf_spline_get_material (DxfSpline *spline);
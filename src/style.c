@@ -129,8 +129,8 @@ dxf_style_init
         style->oblique_angle = 0.0;
         style->flag = 0;
         style->text_generation_flag = 0;
-        style->dictionary_owner_soft = strdup ("");
-        style->dictionary_owner_hard = strdup ("");
+        style->dictionary_owner_soft = DXF_HANDLE_NONE;
+        style->dictionary_owner_hard = DXF_HANDLE_NONE;
         style->ttf_flags = 0;
         style->next = NULL;
 #if DEBUG
@@ -200,8 +200,7 @@ dxf_style_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &style->id_code);
+                        style->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -284,15 +283,13 @@ dxf_style_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->dictionary_owner_soft);
+                        style->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, style->dictionary_owner_hard);
+                        style->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -317,7 +314,7 @@ dxf_style_read
         /* Handle omitted members and/or illegal values. */
         if (strcmp (style->style_name, "") == 0)
         {
-                sprintf (style->style_name, "%i", style->id_code);
+                sprintf (style->style_name, "%" PRIu64, style->id_code);
                 fprintf (stderr,
                   (_("Warning in %s () illegal style name value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
@@ -325,7 +322,7 @@ dxf_style_read
         if ((strcmp (style->primary_font_filename, "") == 0)
           && (style->flag == 1))
         {
-                sprintf (style->primary_font_filename, "%i", style->id_code);
+                sprintf (style->primary_font_filename, "%" PRIu64, style->id_code);
                 fprintf (stderr,
                   (_("Warning in %s () illegal primary font filename value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
@@ -380,9 +377,9 @@ dxf_style_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (style->id_code != -1)
+        if (style->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", style->id_code);
+                dxf_handle_write (fp, 5, style->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -394,18 +391,18 @@ dxf_style_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (style->dictionary_owner_soft, "") != 0)
+        if ((style->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", style->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, style->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (style->dictionary_owner_hard, "") != 0)
+        if ((style->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", style->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, style->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -468,8 +465,6 @@ dxf_style_free
         free (style->style_name);
         free (style->primary_font_filename);
         free (style->big_font_filename);
-        free (style->dictionary_owner_soft);
-        free (style->dictionary_owner_hard);
         free (style);
         style = NULL;
 #if DEBUG
@@ -503,6 +498,7 @@ dxf_style_free_list
         while (styles != NULL)
         {
                 DxfStyle *iter = (DxfStyle *) styles->next;
+                styles->next = NULL;
                 dxf_style_free (styles);
                 styles = (DxfStyle *) iter;
         }
@@ -512,12 +508,97 @@ dxf_style_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c STYLE symbol table entry.
+ *
+ * The copy does not share any memory with \c style, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfStyle *
+dxf_style_copy
+(
+        DxfStyle *style
+                /*!< a pointer to the DXF \c STYLE symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStyle *copy;
+
+        /* Do some basic checks. */
+        if (style == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_style_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, style, sizeof (DxfStyle));
+        copy->style_name = NULL;
+        copy->primary_font_filename = NULL;
+        copy->big_font_filename = NULL;
+        copy->next = NULL;
+        if (style->style_name != NULL)
+        {
+                copy->style_name = strdup (style->style_name);
+                if (copy->style_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_style_free (copy);
+                        return (NULL);
+                }
+        }
+        if (style->primary_font_filename != NULL)
+        {
+                copy->primary_font_filename = strdup (style->primary_font_filename);
+                if (copy->primary_font_filename == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_style_free (copy);
+                        return (NULL);
+                }
+        }
+        if (style->big_font_filename != NULL)
+        {
+                copy->big_font_filename = strdup (style->big_font_filename);
+                if (copy->big_font_filename == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_style_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c STYLE symbol table entries.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_style_get_id_code
 (
         DxfStyle *style
@@ -536,12 +617,6 @@ dxf_style_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (style->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -557,7 +632,7 @@ dxf_style_set_id_code
 (
         DxfStyle *style,
                 /*!< a pointer to a DXF \c STYLE symbol table entries. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -574,12 +649,6 @@ dxf_style_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         style->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -1524,17 +1593,10 @@ dxf_style_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (style->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->dictionary_owner_soft));
+        return (dxf_handle_to_string (style->dictionary_owner_soft));
 }
 
 
@@ -1570,7 +1632,7 @@ dxf_style_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        style->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        style->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1604,17 +1666,10 @@ dxf_style_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (style->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (style->dictionary_owner_hard));
+        return (dxf_handle_to_string (style->dictionary_owner_hard));
 }
 
 
@@ -1650,7 +1705,7 @@ dxf_style_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        style->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        style->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -51,6 +51,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "file.h"
 
 
@@ -70,7 +71,7 @@ extern "C" {
 typedef struct
 dxf_style_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -125,10 +126,10 @@ dxf_style_struct
                  * <li value = "4"> Text is upside down (mirrored in Y).</li>
                  * </ol>\n
                  * Group code = 71. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         int32_t ttf_flags;
@@ -147,8 +148,9 @@ DxfStyle *dxf_style_read (DxfFile *fp, DxfStyle *style);
 int dxf_style_write (DxfFile *fp, DxfStyle *style);
 int dxf_style_free (DxfStyle *style);
 void dxf_style_free_list (DxfStyle *styles);
-int dxf_style_get_id_code (DxfStyle *style);
-DxfStyle *dxf_style_set_id_code (DxfStyle *style, int id_code);
+DxfStyle *dxf_style_copy (DxfStyle *style);
+DxfHandle dxf_style_get_id_code (DxfStyle *style);
+DxfStyle *dxf_style_set_id_code (DxfStyle *style, DxfHandle id_code);
 char *dxf_style_get_style_name (DxfStyle *style);
 DxfStyle *dxf_style_set_color_name (DxfStyle *style, char *style_name);
 char *dxf_style_get_primary_font_filename (DxfStyle *style);
@@ -113,28 +113,13 @@ dxf_sun_init
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->id_code = 0;
-        sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        sun->layer = strdup (DXF_DEFAULT_LAYER);
-        sun->elevation = 0.0;
-        sun->thickness = 0.0;
-        sun->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        sun->visibility = DXF_DEFAULT_VISIBILITY;
-        sun->color = DXF_COLOR_BYLAYER;
-        sun->paperspace = DXF_MODELSPACE;
-        sun->graphics_data_size = 0;
-        sun->shadow_mode = 0;
-        sun->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        sun->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (sun->binary_graphics_data);
-        sun->dictionary_owner_soft = strdup ("");
-        sun->object_owner_soft = strdup ("");
-        sun->material = strdup ("");
-        sun->dictionary_owner_hard = strdup ("");
-        sun->lineweight = 0;
-        sun->plot_style_name = strdup ("");
-        sun->color_value = 0;
-        sun->color_name = strdup ("");
-        sun->transparency = 0;
+        if (dxf_entity_common_init (&sun->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         sun->intensity = 0.0;
         sun->sun_color = DXF_COLOR_BYLAYER;
         sun->shadow_type = 0;
@@ -179,7 +164,6 @@ dxf_sun_read
 #endif
         char *temp_string = NULL;
         int iter92;
-        DxfBinaryGraphicsData *iter310 = NULL;
         int iter330;
 
         /* Do some basic checks. */
@@ -200,7 +184,6 @@ dxf_sun_read
                 sun = dxf_sun_init (sun);
         }
         iter92 = 0;
-        iter310 = (DxfBinaryGraphicsData *) sun->binary_graphics_data;
         iter330 = 0;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
@@ -220,21 +203,20 @@ dxf_sun_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &sun->id_code);
+                        sun->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->common.linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->common.layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0))
@@ -242,14 +224,14 @@ dxf_sun_read
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->elevation);
+                        fscanf (fp->fp, "%lf\n", &sun->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->thickness);
+                        fscanf (fp->fp, "%lf\n", &sun->common.thickness);
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
@@ -263,21 +245,21 @@ dxf_sun_read
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &sun->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &sun->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->visibility);
+                        fscanf (fp->fp, "%hd\n", &sun->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->color);
+                        fscanf (fp->fp, "%hd\n", &sun->common.color);
                 }
                 else if (strcmp (temp_string, "63") == 0)
                 {
@@ -291,7 +273,7 @@ dxf_sun_read
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->paperspace);
+                        fscanf (fp->fp, "%hd\n", &sun->common.paperspace);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -328,7 +310,7 @@ dxf_sun_read
                                 /* Now follows a string containing the
                                  * graphics data size value. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, "%" PRIi32 "\n", &sun->graphics_data_size);
+                                fscanf (fp->fp, "%" PRIi32 "\n", &sun->common.cold->graphics_data_size);
                         }
                         if (iter92 == 1)
                         {
@@ -359,7 +341,7 @@ dxf_sun_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &sun->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &sun->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "280") == 0)
                 {
@@ -373,7 +355,7 @@ dxf_sun_read
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &sun->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "290") == 0)
                 {
@@ -400,10 +382,11 @@ dxf_sun_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        if (sun->common.cold->binary_graphics_data == NULL)
+                        {
+                                sun->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, sun->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -411,15 +394,13 @@ dxf_sun_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->dictionary_owner_soft);
+                                sun->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->object_owner_soft);
+                                sun->common.cold->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -427,49 +408,46 @@ dxf_sun_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->material);
+                        sun->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->dictionary_owner_hard);
+                        sun->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &sun->lineweight);
+                        fscanf (fp->fp, "%hd\n", &sun->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->plot_style_name);
+                        sun->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &sun->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &sun->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sun->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &sun->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &sun->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -486,13 +464,13 @@ dxf_sun_read
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (sun->linetype, "") == 0)
+        if (strcmp (sun->common.linetype, "") == 0)
         {
-                sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                sun->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (sun->layer, "") == 0)
+        if (strcmp (sun->common.layer, "") == 0)
         {
-                sun->layer = strdup (DXF_DEFAULT_LAYER);
+                sun->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -542,31 +520,31 @@ dxf_sun_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (sun->linetype, "") == 0)
+        if (strcmp (sun->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, sun->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, sun->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                sun->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                sun->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (sun->layer, "") == 0)
+        if (strcmp (sun->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, sun->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, sun->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                sun->layer = DXF_DEFAULT_LAYER;
+                sun->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (sun->id_code != -1)
+        if (sun->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", sun->id_code);
+                dxf_handle_write (fp, 5, sun->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -578,101 +556,95 @@ dxf_sun_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (sun->dictionary_owner_soft, "") != 0)
+        if ((sun->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", sun->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, sun->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (sun->dictionary_owner_hard, "") != 0)
+        if ((sun->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", sun->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, sun->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (sun->object_owner_soft, "") != 0)
+        if ((sun->common.cold->object_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_2000))
         {
-                fprintf (fp->fp, "330\n%s\n", sun->object_owner_soft);
+                dxf_handle_write (fp, 330, sun->common.cold->object_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (sun->paperspace == DXF_PAPERSPACE)
+        if (sun->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", sun->layer);
-        if (strcmp (sun->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", sun->common.layer);
+        if (strcmp (sun->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", sun->linetype);
+                fprintf (fp->fp, "  6\n%s\n", sun->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (sun->material, "") != 0))
+          && (sun->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", sun->material);
+                dxf_handle_write (fp, 347, sun->common.cold->material);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (sun->elevation != 0.0))
+          && (sun->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", sun->elevation);
+                fprintf (fp->fp, " 38\n%f\n", sun->common.elevation);
         }
-        if (sun->color != DXF_COLOR_BYLAYER)
+        if (sun->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", sun->color);
+                fprintf (fp->fp, " 62\n%hd\n", sun->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", sun->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", sun->common.lineweight);
         }
-        if (sun->linetype_scale != 1.0)
+        if (sun->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", sun->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", sun->common.linetype_scale);
         }
-        if (sun->visibility != 0)
+        if (sun->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", sun->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", sun->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_2000)
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", sun->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", sun->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", sun->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", sun->common.cold->graphics_data_size);
 #endif
-                if (sun->binary_graphics_data != NULL)
+                if (sun->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) sun->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
+                        dxf_binary_buffer_write (fp, 310, sun->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", sun->color_value);
-                fprintf (fp->fp, "430\n%s\n", sun->color_name);
-                fprintf (fp->fp, "440\n%ld\n", sun->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", sun->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", sun->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", sun->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", sun->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", sun->shadow_mode);
+                dxf_handle_write (fp, 390, sun->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", sun->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbSun\n");
         }
-        if (sun->thickness != 0.0)
+        if (sun->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", sun->thickness);
+                fprintf (fp->fp, " 39\n%f\n", sun->common.thickness);
         }
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", sun->version);
         fprintf (fp->fp, "290\n%hd\n", sun->status);
@@ -685,6 +657,7 @@ dxf_sun_write
         fprintf (fp->fp, " 70\n%d\n", sun->shadow_type);
         fprintf (fp->fp, " 71\n%d\n", sun->shadow_map_size);
         fprintf (fp->fp, "280\n%" PRIi16 "\n", sun->shadow_softness);
+        dxf_entity_common_write_xdata (fp, &sun->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -727,14 +700,7 @@ dxf_sun_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (sun->linetype);
-        free (sun->layer);
-        free (sun->dictionary_owner_soft);
-        free (sun->object_owner_soft);
-        free (sun->material);
-        free (sun->dictionary_owner_hard);
-        free (sun->plot_style_name);
-        free (sun->color_name);
+        dxf_entity_common_free (&sun->common);
         free (sun);
         sun = NULL;
 #if DEBUG
@@ -768,6 +734,7 @@ dxf_sun_free_list
         while (suns != NULL)
         {
                 DxfSun *iter = (DxfSun *) suns->next;
+                suns->next = NULL;
                 dxf_sun_free (suns);
                 suns = (DxfSun *) iter;
         }
@@ -782,7 +749,7 @@ dxf_sun_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_sun_get_id_code
 (
         DxfSun *sun
@@ -800,16 +767,10 @@ dxf_sun_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->id_code);
+        return (sun->common.id_code);
 }
 
 
@@ -824,7 +785,7 @@ dxf_sun_set_id_code
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -841,13 +802,7 @@ dxf_sun_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        sun->id_code = id_code;
+        sun->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -878,7 +833,7 @@ dxf_sun_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->linetype ==  NULL)
+        if (sun->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -888,7 +843,7 @@ dxf_sun_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->linetype));
+        return (strdup (sun->common.linetype));
 }
 
 
@@ -926,7 +881,7 @@ dxf_sun_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->linetype = strdup (linetype);
+        sun->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -957,7 +912,7 @@ dxf_sun_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->layer ==  NULL)
+        if (sun->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -967,7 +922,7 @@ dxf_sun_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->layer));
+        return (strdup (sun->common.layer));
 }
 
 
@@ -1005,7 +960,7 @@ dxf_sun_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->layer = strdup (layer);
+        sun->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1039,7 +994,7 @@ dxf_sun_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->elevation);
+        return (sun->common.elevation);
 }
 
 
@@ -1069,7 +1024,7 @@ dxf_sun_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->elevation = elevation;
+        sun->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1100,7 +1055,7 @@ dxf_sun_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->thickness < 0.0)
+        if (sun->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1110,7 +1065,7 @@ dxf_sun_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->thickness);
+        return (sun->common.thickness);
 }
 
 
@@ -1146,7 +1101,7 @@ dxf_sun_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->thickness = thickness;
+        sun->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1177,7 +1132,7 @@ dxf_sun_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->linetype_scale < 0.0)
+        if (sun->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1186,7 +1141,7 @@ dxf_sun_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->linetype_scale);
+        return (sun->common.linetype_scale);
 }
 
 
@@ -1222,7 +1177,7 @@ dxf_sun_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->linetype_scale = linetype_scale;
+        sun->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1253,13 +1208,13 @@ dxf_sun_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->visibility < 0)
+        if (sun->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (sun->visibility > 1)
+        if (sun->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1268,7 +1223,7 @@ dxf_sun_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->visibility);
+        return (sun->common.visibility);
 }
 
 
@@ -1310,7 +1265,7 @@ dxf_sun_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->visibility = visibility;
+        sun->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1341,7 +1296,7 @@ dxf_sun_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->color < 0)
+        if (sun->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1350,7 +1305,7 @@ dxf_sun_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->color);
+        return (sun->common.color);
 }
 
 
@@ -1386,7 +1341,7 @@ dxf_sun_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->color = color;
+        sun->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1417,13 +1372,13 @@ dxf_sun_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->paperspace < 0)
+        if (sun->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (sun->paperspace > 1)
+        if (sun->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1432,7 +1387,7 @@ dxf_sun_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->paperspace);
+        return (sun->common.paperspace);
 }
 
 
@@ -1475,7 +1430,7 @@ dxf_sun_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->paperspace = paperspace;
+        sun->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1507,13 +1462,13 @@ dxf_sun_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->graphics_data_size < 0)
+        if (sun->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (sun->graphics_data_size == 0)
+        if (sun->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1522,7 +1477,7 @@ dxf_sun_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->graphics_data_size);
+        return (sun->common.cold->graphics_data_size);
 }
 
 
@@ -1565,7 +1520,7 @@ dxf_sun_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->graphics_data_size = graphics_data_size;
+        sun->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1597,13 +1552,13 @@ dxf_sun_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (sun->shadow_mode < 0)
+        if (sun->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (sun->shadow_mode > 3)
+        if (sun->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1612,7 +1567,7 @@ dxf_sun_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->shadow_mode);
+        return (sun->common.cold->shadow_mode);
 }
 
 
@@ -1654,7 +1609,7 @@ dxf_sun_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        sun->shadow_mode = shadow_mode;
+        sun->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1666,11 +1621,12 @@ dxf_sun_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c SUN entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_sun_get_binary_graphics_data
 (
         DxfSun *sun
@@ -1688,17 +1644,10 @@ dxf_sun_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) sun->binary_graphics_data);
+        return (sun->common.cold->binary_graphics_data);
 }
 
 
@@ -1706,17 +1655,20 @@ dxf_sun_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c SUN entity.
  *
- * \return a pointer to \c sun when successful, or \c NULL when an error
- * occurred.
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c sun when successful, or \c NULL when an
+ * error occurred.
  */
 DxfSun *
 dxf_sun_set_binary_graphics_data
 (
         DxfSun *sun,
                 /*!< a pointer to a DXF \c SUN entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1737,7 +1689,12 @@ dxf_sun_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((sun->common.cold->binary_graphics_data != NULL)
+          && (sun->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (sun->common.cold->binary_graphics_data);
+        }
+        sun->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1771,17 +1728,10 @@ dxf_sun_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->dictionary_owner_soft));
+        return (dxf_handle_to_string (sun->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1820,7 +1770,7 @@ dxf_sun_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        sun->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1854,17 +1804,10 @@ dxf_sun_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->object_owner_soft));
+        return (dxf_handle_to_string (sun->common.cold->object_owner_soft));
 }
 
 
@@ -1900,7 +1843,7 @@ dxf_sun_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->object_owner_soft = strdup (object_owner_soft);
+        sun->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1934,17 +1877,10 @@ dxf_sun_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->material));
+        return (dxf_handle_to_string (sun->common.cold->material));
 }
 
 
@@ -1982,7 +1918,7 @@ dxf_sun_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->material = strdup (material);
+        sun->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2016,17 +1952,10 @@ dxf_sun_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->dictionary_owner_hard));
+        return (dxf_handle_to_string (sun->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2065,7 +1994,7 @@ dxf_sun_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        sun->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2100,7 +2029,7 @@ dxf_sun_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->lineweight);
+        return (sun->common.lineweight);
 }
 
 
@@ -2130,7 +2059,7 @@ dxf_sun_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->lineweight = lineweight;
+        sun->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2162,17 +2091,10 @@ dxf_sun_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->plot_style_name));
+        return (dxf_handle_to_string (sun->common.cold->plot_style_name));
 }
 
 
@@ -2210,7 +2132,7 @@ dxf_sun_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->plot_style_name = strdup (plot_style_name);
+        sun->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2245,7 +2167,7 @@ dxf_sun_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->color_value);
+        return (sun->common.color_value);
 }
 
 
@@ -2275,7 +2197,7 @@ dxf_sun_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->color_value = color_value;
+        sun->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2307,7 +2229,7 @@ dxf_sun_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (sun->color_name ==  NULL)
+        if (sun->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2317,7 +2239,7 @@ dxf_sun_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (sun->color_name));
+        return (strdup (sun->common.cold->color_name));
 }
 
 
@@ -2355,7 +2277,7 @@ dxf_sun_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->color_name = strdup (color_name);
+        sun->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2390,7 +2312,7 @@ dxf_sun_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (sun->transparency);
+        return (sun->common.cold->transparency);
 }
 
 
@@ -2420,7 +2342,7 @@ dxf_sun_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        sun->transparency = transparency;
+        sun->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
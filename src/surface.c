@@ -114,8 +114,7 @@ dxf_surface_init
                 return (NULL);
         }
         /* Initialize new structs for members. */
-        surface->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (surface->binary_graphics_data);
-        if (surface->binary_graphics_data == NULL)
+        if (dxf_entity_common_init (&surface->common) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory.\n")),
@@ -139,26 +138,6 @@ dxf_surface_init
                 return (NULL);
         }
         /* Assign initial values to members. */
-        surface->id_code = 0;
-        surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        surface->layer = strdup (DXF_DEFAULT_LAYER);
-        surface->elevation = 0.0;
-        surface->thickness = 0.0;
-        surface->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        surface->visibility = DXF_DEFAULT_VISIBILITY;
-        surface->color = DXF_COLOR_BYLAYER;
-        surface->paperspace = DXF_MODELSPACE;
-        surface->graphics_data_size = 0;
-        surface->shadow_mode = 0;
-        surface->dictionary_owner_soft = strdup ("");
-        surface->object_owner_soft = strdup ("");
-        surface->material = strdup ("");
-        surface->dictionary_owner_hard = strdup ("");
-        surface->lineweight = 0;
-        surface->plot_style_name = strdup ("");
-        surface->color_value = 0;
-        surface->color_name = strdup ("");
-        surface->transparency = 0;
         surface->modeler_format_version_number = 1;
         surface->number_of_U_isolines = 0;
         surface->number_of_V_isolines = 0;
@@ -195,7 +174,6 @@ dxf_surface_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
         int i;
 
@@ -222,7 +200,6 @@ dxf_surface_read
                   __FUNCTION__);
                 surface = dxf_surface_init (surface);
         }
-        iter310 = (DxfBinaryData *) surface->binary_graphics_data;
         iter330 = 0;
         i = 1;
         (fp->line_number)++;
@@ -265,63 +242,62 @@ dxf_surface_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &surface->id_code);
+                        surface->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->common.linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->common.layer);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &surface->elevation);
+                        fscanf (fp->fp, "%lf\n", &surface->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &surface->thickness);
+                        fscanf (fp->fp, "%lf\n", &surface->common.thickness);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &surface->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &surface->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->visibility);
+                        fscanf (fp->fp, "%hd\n", &surface->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->color);
+                        fscanf (fp->fp, "%hd\n", &surface->common.color);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->paperspace);
+                        fscanf (fp->fp, "%hd\n", &surface->common.paperspace);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -349,7 +325,7 @@ dxf_surface_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "100") == 0)
                 {
@@ -416,23 +392,24 @@ dxf_surface_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "284") == 0)
                 {
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &surface->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        if (surface->common.cold->binary_graphics_data == NULL)
+                        {
+                                surface->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, surface->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -440,15 +417,13 @@ dxf_surface_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_soft);
+                                surface->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->object_owner_soft);
+                                surface->common.cold->object_owner_soft = dxf_handle_read (fp);
                         }
                         iter330++;
                 }
@@ -456,49 +431,46 @@ dxf_surface_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->material);
+                        surface->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_hard);
+                        surface->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &surface->lineweight);
+                        fscanf (fp->fp, "%hd\n", &surface->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->plot_style_name);
+                        surface->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &surface->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -515,13 +487,13 @@ dxf_surface_read
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (surface->linetype, "") == 0)
+        if (strcmp (surface->common.linetype, "") == 0)
         {
-                surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                surface->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (surface->layer, "") == 0)
+        if (strcmp (surface->common.layer, "") == 0)
         {
-                surface->layer = strdup (DXF_DEFAULT_LAYER);
+                surface->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -568,21 +540,21 @@ dxf_surface_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (surface->layer, "") == 0)
+        if (strcmp (surface->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, surface->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, surface->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                surface->layer = strdup (DXF_DEFAULT_LAYER);
+                surface->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (surface->id_code != -1)
+        if (surface->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", surface->id_code);
+                dxf_handle_write (fp, 5, surface->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -594,97 +566,91 @@ dxf_surface_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (surface->dictionary_owner_soft, "") != 0)
+        if ((surface->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", surface->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, surface->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (surface->dictionary_owner_hard, "") != 0)
+        if ((surface->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", surface->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, surface->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (surface->paperspace == 1)
+        if (surface->common.paperspace == 1)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", surface->layer);
-        if (strcmp (surface->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", surface->common.layer);
+        if (strcmp (surface->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", surface->linetype);
+                fprintf (fp->fp, "  6\n%s\n", surface->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (surface->material, "") != 0))
+          && (surface->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", surface->material);
+                dxf_handle_write (fp, 347, surface->common.cold->material);
         }
-        if (surface->color != DXF_COLOR_BYLAYER)
+        if (surface->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", surface->color);
+                fprintf (fp->fp, " 62\n%hd\n", surface->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", surface->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", surface->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (surface->elevation != 0.0))
+          && (surface->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", surface->elevation);
+                fprintf (fp->fp, " 38\n%f\n", surface->common.elevation);
         }
-        if (surface->linetype_scale != 1.0)
+        if (surface->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", surface->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", surface->common.linetype_scale);
         }
-        if (surface->visibility != 0)
+        if (surface->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", surface->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", surface->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (surface->graphics_data_size > 0))
+          && (surface->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", surface->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", surface->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", surface->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", surface->common.cold->graphics_data_size);
 #endif
-                if (surface->binary_graphics_data != NULL)
+                if (surface->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = surface->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_data_get_data_line (iter));
-                                iter = (DxfBinaryData *) dxf_binary_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, surface->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", surface->color_value);
-                fprintf (fp->fp, "430\n%s\n", surface->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", surface->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", surface->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", surface->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", surface->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", surface->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", surface->shadow_mode);
+                dxf_handle_write (fp, 390, surface->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", surface->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbModelerGeometry\n");
         }
-        if (surface->thickness != 0.0)
+        if (surface->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", surface->thickness);
+                fprintf (fp->fp, " 39\n%f\n", surface->common.thickness);
         }
         if (surface->modeler_format_version_number != 0)
         {
@@ -747,6 +713,7 @@ dxf_surface_write
                   (_("Warning in %s () an unknown type value was passed.\n")),
                   __FUNCTION__);
         }
+        dxf_entity_common_write_xdata (fp, &surface->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -789,14 +756,7 @@ dxf_surface_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (surface->linetype);
-        free (surface->layer);
-        free (surface->dictionary_owner_soft);
-        free (surface->object_owner_soft);
-        free (surface->material);
-        free (surface->dictionary_owner_hard);
-        free (surface->plot_style_name);
-        free (surface->color_name);
+        dxf_entity_common_free (&surface->common);
         dxf_proprietary_data_free_list (surface->proprietary_data);
         dxf_proprietary_data_free_list (surface->additional_proprietary_data);
         free (surface);
@@ -832,6 +792,7 @@ dxf_surface_free_list
         while (surfaces != NULL)
         {
                 DxfSurface *iter = (DxfSurface *) surfaces->next;
+                surfaces->next = NULL;
                 dxf_surface_free (surfaces);
                 surfaces = (DxfSurface *) iter;
         }
@@ -846,7 +807,7 @@ dxf_surface_free_list
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_surface_get_id_code
 (
         DxfSurface *surface
@@ -864,16 +825,10 @@ dxf_surface_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->id_code);
+        return (surface->common.id_code);
 }
 
 
@@ -888,7 +843,7 @@ dxf_surface_set_id_code
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -905,13 +860,7 @@ dxf_surface_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        surface->id_code = id_code;
+        surface->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -942,7 +891,7 @@ dxf_surface_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->linetype ==  NULL)
+        if (surface->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -952,7 +901,7 @@ dxf_surface_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->linetype));
+        return (strdup (surface->common.linetype));
 }
 
 
@@ -992,7 +941,7 @@ dxf_surface_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->linetype = strdup (linetype);
+        surface->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1023,7 +972,7 @@ dxf_surface_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->layer ==  NULL)
+        if (surface->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1033,7 +982,7 @@ dxf_surface_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->layer));
+        return (strdup (surface->common.layer));
 }
 
 
@@ -1071,7 +1020,7 @@ dxf_surface_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->layer = strdup (layer);
+        surface->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1105,7 +1054,7 @@ dxf_surface_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->elevation);
+        return (surface->common.elevation);
 }
 
 
@@ -1135,7 +1084,7 @@ dxf_surface_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->elevation = elevation;
+        surface->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1166,13 +1115,13 @@ dxf_surface_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->thickness < 0.0)
+        if (surface->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (surface->thickness == 0.0)
+        if (surface->common.thickness == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a value of zero was found.\n")),
@@ -1181,7 +1130,7 @@ dxf_surface_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->thickness);
+        return (surface->common.thickness);
 }
 
 
@@ -1223,7 +1172,7 @@ dxf_surface_set_thickness
                   (_("Warning in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
         }
-        surface->thickness = thickness;
+        surface->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1254,13 +1203,13 @@ dxf_surface_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->linetype_scale < 0.0)
+        if (surface->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (surface->linetype_scale == 0.0)
+        if (surface->common.linetype_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a value of zero was found.\n")),
@@ -1269,7 +1218,7 @@ dxf_surface_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->linetype_scale);
+        return (surface->common.linetype_scale);
 }
 
 
@@ -1311,7 +1260,7 @@ dxf_surface_set_linetype_scale
                   (_("Warning in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
         }
-        surface->linetype_scale = linetype_scale;
+        surface->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1342,13 +1291,13 @@ dxf_surface_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->visibility < 0)
+        if (surface->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (surface->visibility > 1)
+        if (surface->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1357,7 +1306,7 @@ dxf_surface_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->visibility);
+        return (surface->common.visibility);
 }
 
 
@@ -1399,7 +1348,7 @@ dxf_surface_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        surface->visibility = visibility;
+        surface->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1430,7 +1379,7 @@ dxf_surface_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->color < 0)
+        if (surface->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1439,7 +1388,7 @@ dxf_surface_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->color);
+        return (surface->common.color);
 }
 
 
@@ -1475,7 +1424,7 @@ dxf_surface_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        surface->color = color;
+        surface->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1506,13 +1455,13 @@ dxf_surface_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->paperspace < 0)
+        if (surface->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (surface->paperspace > 1)
+        if (surface->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1521,7 +1470,7 @@ dxf_surface_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->paperspace);
+        return (surface->common.paperspace);
 }
 
 
@@ -1564,7 +1513,7 @@ dxf_surface_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        surface->paperspace = paperspace;
+        surface->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1597,13 +1546,13 @@ dxf_surface_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->graphics_data_size < 0)
+        if (surface->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (surface->graphics_data_size == 0)
+        if (surface->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1612,7 +1561,7 @@ dxf_surface_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->graphics_data_size);
+        return (surface->common.cold->graphics_data_size);
 }
 
 
@@ -1656,7 +1605,7 @@ dxf_surface_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        surface->graphics_data_size = graphics_data_size;
+        surface->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1688,13 +1637,13 @@ dxf_surface_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (surface->shadow_mode < 0)
+        if (surface->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (surface->shadow_mode > 3)
+        if (surface->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1703,7 +1652,7 @@ dxf_surface_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->shadow_mode);
+        return (surface->common.cold->shadow_mode);
 }
 
 
@@ -1745,7 +1694,7 @@ dxf_surface_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        surface->shadow_mode = shadow_mode;
+        surface->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1757,11 +1706,12 @@ dxf_surface_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c SURFACE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryData *
+DxfBinaryBuffer *
 dxf_surface_get_binary_graphics_data
 (
         DxfSurface *surface
@@ -1779,17 +1729,10 @@ dxf_surface_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) surface->binary_graphics_data);
+        return (surface->common.cold->binary_graphics_data);
 }
 
 
@@ -1797,6 +1740,9 @@ dxf_surface_get_binary_graphics_data
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c SURFACE entity.
  *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
  * \return a pointer to \c surface when successful, or \c NULL when an
  * error occurred.
  */
@@ -1805,9 +1751,9 @@ dxf_surface_set_binary_graphics_data
 (
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
-        DxfBinaryData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1828,7 +1774,12 @@ dxf_surface_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->binary_graphics_data = (DxfBinaryData *) data;
+        if ((surface->common.cold->binary_graphics_data != NULL)
+          && (surface->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (surface->common.cold->binary_graphics_data);
+        }
+        surface->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1862,17 +1813,10 @@ dxf_surface_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->dictionary_owner_soft));
+        return (dxf_handle_to_string (surface->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1911,7 +1855,7 @@ dxf_surface_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        surface->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1945,17 +1889,10 @@ dxf_surface_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->object_owner_soft));
+        return (dxf_handle_to_string (surface->common.cold->object_owner_soft));
 }
 
 
@@ -1991,7 +1928,7 @@ dxf_surface_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->object_owner_soft = strdup (object_owner_soft);
+        surface->common.cold->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2026,17 +1963,10 @@ dxf_surface_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->material));
+        return (dxf_handle_to_string (surface->common.cold->material));
 }
 
 
@@ -2075,7 +2005,7 @@ dxf_surface_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->material = strdup (material);
+        surface->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2109,17 +2039,10 @@ dxf_surface_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->dictionary_owner_hard));
+        return (dxf_handle_to_string (surface->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2158,7 +2081,7 @@ dxf_surface_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        surface->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2193,7 +2116,7 @@ dxf_surface_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->lineweight);
+        return (surface->common.lineweight);
 }
 
 
@@ -2223,7 +2146,7 @@ dxf_surface_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->lineweight = lineweight;
+        surface->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2255,17 +2178,10 @@ dxf_surface_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->plot_style_name));
+        return (dxf_handle_to_string (surface->common.cold->plot_style_name));
 }
 
 
@@ -2303,7 +2219,7 @@ dxf_surface_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->plot_style_name = strdup (plot_style_name);
+        surface->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2338,7 +2254,7 @@ dxf_surface_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->color_value);
+        return (surface->common.color_value);
 }
 
 
@@ -2368,7 +2284,7 @@ dxf_surface_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->color_value = color_value;
+        surface->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2400,7 +2316,7 @@ dxf_surface_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->color_name ==  NULL)
+        if (surface->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2410,7 +2326,7 @@ dxf_surface_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (surface->color_name));
+        return (strdup (surface->common.cold->color_name));
 }
 
 
@@ -2448,7 +2364,7 @@ dxf_surface_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->color_name = strdup (color_name);
+        surface->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2483,7 +2399,7 @@ dxf_surface_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (surface->transparency);
+        return (surface->common.cold->transparency);
 }
 
 
@@ -2513,7 +2429,7 @@ dxf_surface_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->transparency = transparency;
+        surface->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3141,7 +3057,7 @@ dxf_surface_extruded_init
                   __FUNCTION__);
                 return (NULL);
         }
-        extruded_surface->transform_matrix = (DxfDouble *) dxf_double_init (extruded_surface->transform_matrix);
+        extruded_surface->transform_matrix = (DxfDoubleArray *) dxf_double_array_init (extruded_surface->transform_matrix);
         if (extruded_surface->transform_matrix == NULL)
         {
                 fprintf (stderr,
@@ -3149,7 +3065,7 @@ dxf_surface_extruded_init
                   __FUNCTION__);
                 return (NULL);
         }
-        extruded_surface->sweep_matrix = (DxfDouble *) dxf_double_init (extruded_surface->sweep_matrix);
+        extruded_surface->sweep_matrix = (DxfDoubleArray *) dxf_double_array_init (extruded_surface->sweep_matrix);
         if (extruded_surface->sweep_matrix == NULL)
         {
                 fprintf (stderr,
@@ -3157,7 +3073,7 @@ dxf_surface_extruded_init
                   __FUNCTION__);
                 return (NULL);
         }
-        extruded_surface->path_matrix = (DxfDouble *) dxf_double_init (extruded_surface->path_matrix);
+        extruded_surface->path_matrix = (DxfDoubleArray *) dxf_double_array_init (extruded_surface->path_matrix);
         if (extruded_surface->path_matrix == NULL)
         {
                 fprintf (stderr,
@@ -3223,9 +3139,7 @@ dxf_surface_extruded_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfDouble *iter40 = NULL;
-        DxfDouble *iter46 = NULL;
-        DxfDouble *iter47 = NULL;
+        double value;
         int iter90;
         DxfBinaryData *iter310 = NULL;
 
@@ -3252,9 +3166,6 @@ dxf_surface_extruded_read
                   __FUNCTION__);
                 extruded_surface = dxf_surface_extruded_init (extruded_surface);
         }
-        iter40 = (DxfDouble *) extruded_surface->transform_matrix;
-        iter46 = (DxfDouble *) extruded_surface->sweep_matrix;
-        iter47 = (DxfDouble *) extruded_surface->path_matrix;
         iter90 = 0;
         iter310 = (DxfBinaryData *) extruded_surface->binary_data;
         (fp->line_number)++;
@@ -3321,9 +3232,8 @@ dxf_surface_extruded_read
                         /* Now follows a string containing the
                          * transform matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter40->value);
-                        iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
-                        iter40 = (DxfDouble *) iter40->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (extruded_surface->transform_matrix, value);
                 }
                 else if (strcmp (temp_string, "42") == 0)
                 {
@@ -3358,18 +3268,16 @@ dxf_surface_extruded_read
                         /* Now follows a string containing a sweep
                          * matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter46->value);
-                        iter46->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter46->next);
-                        iter46 = (DxfDouble *) iter46->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (extruded_surface->sweep_matrix, value);
                 }
                 else if (strcmp (temp_string, "47") == 0)
                 {
                         /* Now follows a string containing a path
                          * matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter47->value);
-                        iter47->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter47->next);
-                        iter47 = (DxfDouble *) iter47->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (extruded_surface->path_matrix, value);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
@@ -3534,12 +3442,10 @@ dxf_surface_extruded_write
         fprintf (fp->fp, " 30\n%f\n", extruded_surface->p0->z0);
         if (extruded_surface->transform_matrix != NULL)
         {
-                DxfDouble *iter40;
-                iter40 = (DxfDouble *) extruded_surface->transform_matrix;
-                while (iter40 != NULL)
+                size_t i;
+                for (i = 0; i < extruded_surface->transform_matrix->length; i++)
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter40->value);
-                        iter40 = (DxfDouble *) iter40->next;
+                        fprintf (fp->fp, " 40\n%f\n", extruded_surface->transform_matrix->values[i]);
                 }
         }
         fprintf (fp->fp, " 42\n%f\n", extruded_surface->draft_angle);
@@ -3550,22 +3456,18 @@ dxf_surface_extruded_write
         fprintf (fp->fp, " 49\n%f\n", extruded_surface->align_angle);
         if (extruded_surface->sweep_matrix != NULL)
         {
-                DxfDouble *iter46;
-                iter46 = (DxfDouble *) extruded_surface->sweep_matrix;
-                while (iter46 != NULL)
+                size_t i;
+                for (i = 0; i < extruded_surface->sweep_matrix->length; i++)
                 {
-                        fprintf (fp->fp, " 46\n%f\n", iter46->value);
-                        iter46 = (DxfDouble *) iter46->next;
+                        fprintf (fp->fp, " 46\n%f\n", extruded_surface->sweep_matrix->values[i]);
                 }
         }
         if (extruded_surface->path_matrix != NULL)
         {
-                DxfDouble *iter47;
-                iter47 = (DxfDouble *) extruded_surface->path_matrix;
-                while (iter47 != NULL)
+                size_t i;
+                for (i = 0; i < extruded_surface->path_matrix->length; i++)
                 {
-                        fprintf (fp->fp, " 47\n%f\n", iter47->value);
-                        iter47 = (DxfDouble *) iter47->next;
+                        fprintf (fp->fp, " 47\n%f\n", extruded_surface->path_matrix->values[i]);
                 }
         }
         fprintf (fp->fp, "290\n%d\n", extruded_surface->solid_flag);
@@ -3620,9 +3522,9 @@ dxf_surface_extruded_free
         }
         dxf_point_free (extruded_surface->p0);
         dxf_point_free (extruded_surface->p1);
-        dxf_double_free_list (extruded_surface->transform_matrix);
-        dxf_double_free_list (extruded_surface->sweep_matrix);
-        dxf_double_free_list (extruded_surface->path_matrix);
+        dxf_double_array_free (extruded_surface->transform_matrix);
+        dxf_double_array_free (extruded_surface->sweep_matrix);
+        dxf_double_array_free (extruded_surface->path_matrix);
         dxf_binary_data_free_list (extruded_surface->binary_data);
         free (extruded_surface);
         extruded_surface = NULL;
@@ -3657,6 +3559,7 @@ dxf_surface_extruded_free_list
         while (extruded_surfaces != NULL)
         {
                 DxfSurfaceExtruded *iter = (DxfSurfaceExtruded *) extruded_surfaces->next;
+                extruded_surfaces->next = NULL;
                 dxf_surface_extruded_free (extruded_surfaces);
                 extruded_surfaces = (DxfSurfaceExtruded *) iter;
         }
@@ -4329,7 +4232,7 @@ dxf_surface_extruded_set_z1
  *
  * \return the transform matrix \c transform_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_extruded_get_transform_matrix
 (
         DxfSurfaceExtruded *extruded_surface
@@ -4358,7 +4261,7 @@ dxf_surface_extruded_get_transform_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) extruded_surface->transform_matrix);
+        return ((DxfDoubleArray *) extruded_surface->transform_matrix);
 }
 
 
@@ -4374,7 +4277,7 @@ dxf_surface_extruded_set_transform_matrix
 (
         DxfSurfaceExtruded *extruded_surface,
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
-        DxfDouble *transform_matrix
+        DxfDoubleArray *transform_matrix
                 /*!< the transform matrix \c transform_matrix of a DXF
                  * extruded \c SURFACE entity. */
 )
@@ -4397,7 +4300,7 @@ dxf_surface_extruded_set_transform_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        extruded_surface->transform_matrix = (DxfDouble *) transform_matrix;
+        extruded_surface->transform_matrix = (DxfDoubleArray *) transform_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4686,7 +4589,7 @@ dxf_surface_extruded_set_twist_angle
  *
  * \return the sweep matrix \c sweep_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_extruded_get_sweep_matrix
 (
         DxfSurfaceExtruded *extruded_surface
@@ -4715,7 +4618,7 @@ dxf_surface_extruded_get_sweep_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) extruded_surface->sweep_matrix);
+        return ((DxfDoubleArray *) extruded_surface->sweep_matrix);
 }
 
 
@@ -4734,7 +4637,7 @@ dxf_surface_extruded_set_sweep_matrix
 (
         DxfSurfaceExtruded *extruded_surface,
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
-        DxfDouble *sweep_matrix
+        DxfDoubleArray *sweep_matrix
                 /*!< the sweep matrix \c sweep_matrix of a DXF
                  * extruded \c SURFACE entity. */
 )
@@ -4757,7 +4660,7 @@ dxf_surface_extruded_set_sweep_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        extruded_surface->sweep_matrix = (DxfDouble *) sweep_matrix;
+        extruded_surface->sweep_matrix = (DxfDoubleArray *) sweep_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4774,7 +4677,7 @@ dxf_surface_extruded_set_sweep_matrix
  *
  * \return the path matrix \c path_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_extruded_get_path_matrix
 (
         DxfSurfaceExtruded *extruded_surface
@@ -4803,7 +4706,7 @@ dxf_surface_extruded_get_path_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) extruded_surface->path_matrix);
+        return ((DxfDoubleArray *) extruded_surface->path_matrix);
 }
 
 
@@ -4822,7 +4725,7 @@ dxf_surface_extruded_set_path_matrix
 (
         DxfSurfaceExtruded *extruded_surface,
                 /*!< a pointer to a DXF extruded \c SURFACE entity. */
-        DxfDouble *path_matrix
+        DxfDoubleArray *path_matrix
                 /*!< the path matrix \c path_matrix of a DXF
                  * extruded \c SURFACE entity. */
 )
@@ -4845,7 +4748,7 @@ dxf_surface_extruded_set_path_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        extruded_surface->path_matrix = (DxfDouble *) path_matrix;
+        extruded_surface->path_matrix = (DxfDoubleArray *) path_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5904,7 +5807,7 @@ dxf_surface_lofted_init
                 return (NULL);
         }
         /* Initialize new structs for members. */
-        lofted_surface->transform_matrix = (DxfDouble *) dxf_double_init (lofted_surface->transform_matrix);
+        lofted_surface->transform_matrix = (DxfDoubleArray *) dxf_double_array_init (lofted_surface->transform_matrix);
         if (lofted_surface->transform_matrix == NULL)
         {
                 fprintf (stderr,
@@ -5960,7 +5863,7 @@ dxf_surface_lofted_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfDouble *iter40 = NULL;
+        double value;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -5985,7 +5888,6 @@ dxf_surface_lofted_read
                   __FUNCTION__);
                 lofted_surface = dxf_surface_lofted_init (lofted_surface);
         }
-        iter40 = (DxfDouble *) lofted_surface->transform_matrix;
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
@@ -6005,9 +5907,8 @@ dxf_surface_lofted_read
                         /* Now follows a string containing the
                          * transform matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter40->value);
-                        iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
-                        iter40 = (DxfDouble *) iter40->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (lofted_surface->transform_matrix, value);
                 }
                 else if (strcmp (temp_string, "41") == 0)
                 {
@@ -6146,12 +6047,10 @@ dxf_surface_lofted_write
         }
         if (lofted_surface->transform_matrix != NULL)
         {
-                DxfDouble *iter40;
-                iter40 = (DxfDouble *) lofted_surface->transform_matrix;
-                while (iter40 != NULL)
+                size_t i;
+                for (i = 0; i < lofted_surface->transform_matrix->length; i++)
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter40->value);
-                        iter40 = (DxfDouble *) iter40->next;
+                        fprintf (fp->fp, " 40\n%f\n", lofted_surface->transform_matrix->values[i]);
                 }
         }
         /*! \todo add Entity data for cross sections. */
@@ -6209,7 +6108,7 @@ dxf_surface_lofted_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        dxf_double_free_list (lofted_surface->transform_matrix);
+        dxf_double_array_free (lofted_surface->transform_matrix);
         free (lofted_surface);
         lofted_surface = NULL;
 #if DEBUG
@@ -6243,6 +6142,7 @@ dxf_surface_lofted_free_list
         while (lofted_surfaces != NULL)
         {
                 DxfSurfaceLofted *iter = (DxfSurfaceLofted *) lofted_surfaces->next;
+                lofted_surfaces->next = NULL;
                 dxf_surface_lofted_free (lofted_surfaces);
                 lofted_surfaces = (DxfSurfaceLofted *) iter;
         }
@@ -6258,7 +6158,7 @@ dxf_surface_lofted_free_list
  *
  * \return the transform matrix \c transform_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_lofted_get_transform_matrix
 (
         DxfSurfaceLofted *lofted_surface
@@ -6287,7 +6187,7 @@ dxf_surface_lofted_get_transform_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) lofted_surface->transform_matrix);
+        return ((DxfDoubleArray *) lofted_surface->transform_matrix);
 }
 
 
@@ -6303,7 +6203,7 @@ dxf_surface_lofted_set_transform_matrix
 (
         DxfSurfaceLofted *lofted_surface,
                 /*!< a pointer to a DXF lofted \c SURFACE entity. */
-        DxfDouble *transform_matrix
+        DxfDoubleArray *transform_matrix
                 /*!< the transform matrix \c transform_matrix of a DXF
                  * lofted \c SURFACE entity. */
 )
@@ -6326,7 +6226,7 @@ dxf_surface_lofted_set_transform_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        lofted_surface->transform_matrix = (DxfDouble *) transform_matrix;
+        lofted_surface->transform_matrix = (DxfDoubleArray *) transform_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7414,7 +7314,7 @@ dxf_surface_revolved_init
                   __FUNCTION__);
                 return (NULL);
         }
-        revolved_surface->transform_matrix = (DxfDouble *) dxf_double_init (revolved_surface->transform_matrix);
+        revolved_surface->transform_matrix = (DxfDoubleArray *) dxf_double_array_init (revolved_surface->transform_matrix);
         if (revolved_surface->transform_matrix == NULL)
         {
                 fprintf (stderr,
@@ -7475,7 +7375,7 @@ dxf_surface_revolved_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfDouble *iter42 = NULL;
+        double value;
         int iter90;
         DxfBinaryData *iter310 = NULL;
 
@@ -7502,7 +7402,6 @@ dxf_surface_revolved_read
                   __FUNCTION__);
                 revolved_surface = dxf_surface_revolved_init (revolved_surface);
         }
-        iter42 = (DxfDouble *) revolved_surface->transform_matrix;
         iter90 = 0;
         iter310 = (DxfBinaryData *) revolved_surface->binary_data;
         (fp->line_number)++;
@@ -7580,9 +7479,8 @@ dxf_surface_revolved_read
                         /* Now follows a string containing the
                          * transform matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter42->value);
-                        iter42->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter42->next);
-                        iter42 = (DxfDouble *) iter42->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (revolved_surface->transform_matrix, value);
                 }
                 else if (strcmp (temp_string, "43") == 0)
                 {
@@ -7718,12 +7616,10 @@ dxf_surface_revolved_write
         fprintf (fp->fp, " 41\n%f\n", revolved_surface->start_angle);
         if (revolved_surface->transform_matrix != NULL)
         {
-                DxfDouble *iter42;
-                iter42 = (DxfDouble *) revolved_surface->transform_matrix;
-                while (iter42 != NULL)
+                size_t i;
+                for (i = 0; i < revolved_surface->transform_matrix->length; i++)
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter42->value);
-                        iter42 = (DxfDouble *) iter42->next;
+                        fprintf (fp->fp, " 40\n%f\n", revolved_surface->transform_matrix->values[i]);
                 }
         }
         fprintf (fp->fp, " 43\n%f\n", revolved_surface->draft_angle);
@@ -7774,7 +7670,7 @@ dxf_surface_revolved_free
         }
         dxf_point_free (revolved_surface->p0);
         dxf_point_free (revolved_surface->p1);
-        dxf_double_free_list (revolved_surface->transform_matrix);
+        dxf_double_array_free (revolved_surface->transform_matrix);
         dxf_binary_data_free_list (revolved_surface->binary_data);
         free (revolved_surface);
         revolved_surface = NULL;
@@ -7809,6 +7705,7 @@ dxf_surface_revolved_free_list
         while (revolved_surfaces != NULL)
         {
                 DxfSurfaceRevolved *iter = (DxfSurfaceRevolved *) revolved_surfaces->next;
+                revolved_surfaces->next = NULL;
                 dxf_surface_revolved_free (revolved_surfaces);
                 revolved_surfaces = (DxfSurfaceRevolved *) iter;
         }
@@ -8610,7 +8507,7 @@ dxf_surface_revolved_set_start_angle
  *
  * \return the transform matrix \c transform_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_revolved_get_transform_matrix
 (
         DxfSurfaceRevolved *revolved_surface
@@ -8639,7 +8536,7 @@ dxf_surface_revolved_get_transform_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) revolved_surface->transform_matrix);
+        return ((DxfDoubleArray *) revolved_surface->transform_matrix);
 }
 
 
@@ -8655,7 +8552,7 @@ dxf_surface_revolved_set_transform_matrix
 (
         DxfSurfaceRevolved *revolved_surface,
                 /*!< a pointer to a DXF revolved \c SURFACE entity. */
-        DxfDouble *transform_matrix
+        DxfDoubleArray *transform_matrix
                 /*!< the transform matrix \c transform_matrix of a DXF
                  * revolved \c SURFACE entity. */
 )
@@ -8678,7 +8575,7 @@ dxf_surface_revolved_set_transform_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        revolved_surface->transform_matrix = (DxfDouble *) transform_matrix;
+        revolved_surface->transform_matrix = (DxfDoubleArray *) transform_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9502,7 +9399,7 @@ dxf_surface_swept_init
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_sweep_matrix = (DxfDouble *) dxf_double_init (swept_surface->transform_sweep_matrix);
+        swept_surface->transform_sweep_matrix = (DxfDoubleArray *) dxf_double_array_init (swept_surface->transform_sweep_matrix);
         if (swept_surface->transform_sweep_matrix == NULL)
         {
                 fprintf (stderr,
@@ -9510,7 +9407,7 @@ dxf_surface_swept_init
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_path_matrix = (DxfDouble *) dxf_double_init (swept_surface->transform_path_matrix);
+        swept_surface->transform_path_matrix = (DxfDoubleArray *) dxf_double_array_init (swept_surface->transform_path_matrix);
         if (swept_surface->transform_path_matrix == NULL)
         {
                 fprintf (stderr,
@@ -9518,7 +9415,7 @@ dxf_surface_swept_init
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_sweep_matrix2 = (DxfDouble *) dxf_double_init (swept_surface->transform_sweep_matrix2);
+        swept_surface->transform_sweep_matrix2 = (DxfDoubleArray *) dxf_double_array_init (swept_surface->transform_sweep_matrix2);
         if (swept_surface->transform_sweep_matrix2 == NULL)
         {
                 fprintf (stderr,
@@ -9526,7 +9423,7 @@ dxf_surface_swept_init
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_path_matrix2 = (DxfDouble *) dxf_double_init (swept_surface->transform_path_matrix2);
+        swept_surface->transform_path_matrix2 = (DxfDoubleArray *) dxf_double_array_init (swept_surface->transform_path_matrix2);
         if (swept_surface->transform_path_matrix2 == NULL)
         {
                 fprintf (stderr,
@@ -9602,10 +9499,7 @@ dxf_surface_swept_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfDouble *iter40 = NULL;
-        DxfDouble *iter41 = NULL;
-        DxfDouble *iter46 = NULL;
-        DxfDouble *iter47 = NULL;
+        double value;
         int iter90;
         DxfBinaryData *iter310 = NULL;
 
@@ -9632,10 +9526,6 @@ dxf_surface_swept_read
                   __FUNCTION__);
                 swept_surface = dxf_surface_swept_init (swept_surface);
         }
-        iter40 = (DxfDouble *) swept_surface->transform_sweep_matrix;
-        iter41 = (DxfDouble *) swept_surface->transform_path_matrix;
-        iter46 = (DxfDouble *) swept_surface->transform_sweep_matrix2;
-        iter47 = (DxfDouble *) swept_surface->transform_path_matrix2;
         iter90 = 0;
         iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
         (fp->line_number)++;
@@ -9681,18 +9571,16 @@ dxf_surface_swept_read
                         /* Now follows a string containing the
                          * transform sweep matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter40->value);
-                        iter40->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter40->next);
-                        iter40 = (DxfDouble *) iter40->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (swept_surface->transform_sweep_matrix, value);
                 }
                 else if (strcmp (temp_string, "41") == 0)
                 {
                         /* Now follows a string containing the
                          * transform path matrix value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter41->value);
-                        iter41->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter41->next);
-                        iter41 = (DxfDouble *) iter41->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (swept_surface->transform_path_matrix, value);
                 }
                 else if (strcmp (temp_string, "42") == 0)
                 {
@@ -9727,18 +9615,16 @@ dxf_surface_swept_read
                         /* Now follows a string containing the
                          * transform sweep matrix 2 value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter46->value);
-                        iter46->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter46->next);
-                        iter46 = (DxfDouble *) iter46->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (swept_surface->transform_sweep_matrix2, value);
                 }
                 else if (strcmp (temp_string, "47") == 0)
                 {
                         /* Now follows a string containing the
                          * transform path matrix 2 value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter47->value);
-                        iter47->next = (struct DxfDouble *) dxf_double_init ((DxfDouble *) iter47->next);
-                        iter47 = (DxfDouble *) iter47->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        dxf_double_array_append (swept_surface->transform_path_matrix2, value);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
@@ -9943,10 +9829,10 @@ dxf_surface_swept_free
                 return (EXIT_FAILURE);
         }
         dxf_point_free (swept_surface->p1);
-        dxf_double_free_list (swept_surface->transform_sweep_matrix);
-        dxf_double_free_list (swept_surface->transform_path_matrix);
-        dxf_double_free_list (swept_surface->transform_sweep_matrix2);
-        dxf_double_free_list (swept_surface->transform_path_matrix2);
+        dxf_double_array_free (swept_surface->transform_sweep_matrix);
+        dxf_double_array_free (swept_surface->transform_path_matrix);
+        dxf_double_array_free (swept_surface->transform_sweep_matrix2);
+        dxf_double_array_free (swept_surface->transform_path_matrix2);
         dxf_binary_data_free_list (swept_surface->sweep_binary_data);
         dxf_binary_data_free_list (swept_surface->path_binary_data);
         free (swept_surface);
@@ -9982,6 +9868,7 @@ dxf_surface_swept_free_list
         while (swept_surfaces != NULL)
         {
                 DxfSurfaceSwept *iter = (DxfSurfaceSwept *) swept_surfaces->next;
+                swept_surfaces->next = NULL;
                 dxf_surface_swept_free (swept_surfaces);
                 swept_surfaces = (DxfSurfaceSwept *) iter;
         }
@@ -10324,7 +10211,7 @@ dxf_surface_swept_set_z1
  *
  * \return the transform sweep matrix \c transform_sweep_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_swept_get_transform_sweep_matrix
 (
         DxfSurfaceSwept *swept_surface
@@ -10353,7 +10240,7 @@ dxf_surface_swept_get_transform_sweep_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) swept_surface->transform_sweep_matrix);
+        return ((DxfDoubleArray *) swept_surface->transform_sweep_matrix);
 }
 
 
@@ -10369,7 +10256,7 @@ dxf_surface_swept_set_transform_sweep_matrix
 (
         DxfSurfaceSwept *swept_surface,
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
-        DxfDouble *transform_sweep_matrix
+        DxfDoubleArray *transform_sweep_matrix
                 /*!< the transform sweep matrix
                  * \c transform_sweep_matrix of a DXF swept \c SURFACE
                  * entity. */
@@ -10393,7 +10280,7 @@ dxf_surface_swept_set_transform_sweep_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_sweep_matrix = (DxfDouble *) transform_sweep_matrix;
+        swept_surface->transform_sweep_matrix = (DxfDoubleArray *) transform_sweep_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10407,7 +10294,7 @@ dxf_surface_swept_set_transform_sweep_matrix
  *
  * \return the transform path matrix \c transform_path_matrix.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_swept_get_transform_path_matrix
 (
         DxfSurfaceSwept *swept_surface
@@ -10436,7 +10323,7 @@ dxf_surface_swept_get_transform_path_matrix
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) swept_surface->transform_path_matrix);
+        return ((DxfDoubleArray *) swept_surface->transform_path_matrix);
 }
 
 
@@ -10452,7 +10339,7 @@ dxf_surface_swept_set_transform_path_matrix
 (
         DxfSurfaceSwept *swept_surface,
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
-        DxfDouble *transform_path_matrix
+        DxfDoubleArray *transform_path_matrix
                 /*!< the transform path matrix \c transform_path_matrix
                  * of a DXF swept \c SURFACE entity. */
 )
@@ -10475,7 +10362,7 @@ dxf_surface_swept_set_transform_path_matrix
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_path_matrix = (DxfDouble *) transform_path_matrix;
+        swept_surface->transform_path_matrix = (DxfDoubleArray *) transform_path_matrix;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10761,7 +10648,7 @@ dxf_surface_swept_set_twist_angle
  *
  * \return the second transform sweep matrix \c transform_sweep_matrix2.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_swept_get_transform_sweep_matrix2
 (
         DxfSurfaceSwept *swept_surface
@@ -10790,7 +10677,7 @@ dxf_surface_swept_get_transform_sweep_matrix2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) swept_surface->transform_sweep_matrix2);
+        return ((DxfDoubleArray *) swept_surface->transform_sweep_matrix2);
 }
 
 
@@ -10806,7 +10693,7 @@ dxf_surface_swept_set_transform_sweep_matrix2
 (
         DxfSurfaceSwept *swept_surface,
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
-        DxfDouble *transform_sweep_matrix2
+        DxfDoubleArray *transform_sweep_matrix2
                 /*!< the second transform sweep matrix
                  * \c transform_sweep_matrix2 of a DXF swept \c SURFACE
                  * entity. */
@@ -10830,7 +10717,7 @@ dxf_surface_swept_set_transform_sweep_matrix2
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_sweep_matrix2 = (DxfDouble *) transform_sweep_matrix2;
+        swept_surface->transform_sweep_matrix2 = (DxfDoubleArray *) transform_sweep_matrix2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10844,7 +10731,7 @@ dxf_surface_swept_set_transform_sweep_matrix2
  *
  * \return the transform path matrix2 \c transform_path_matrix2.
  */
-DxfDouble *
+DxfDoubleArray *
 dxf_surface_swept_get_transform_path_matrix2
 (
         DxfSurfaceSwept *swept_surface
@@ -10873,7 +10760,7 @@ dxf_surface_swept_get_transform_path_matrix2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) swept_surface->transform_path_matrix2);
+        return ((DxfDoubleArray *) swept_surface->transform_path_matrix2);
 }
 
 
@@ -10889,7 +10776,7 @@ dxf_surface_swept_set_transform_path_matrix2
 (
         DxfSurfaceSwept *swept_surface,
                 /*!< a pointer to a DXF swept \c SURFACE entity. */
-        DxfDouble *transform_path_matrix2
+        DxfDoubleArray *transform_path_matrix2
                 /*!< the second transform path matrix
                  * \c transform_path_matrix2 of a DXF swept \c SURFACE
                  * entity. */
@@ -10913,7 +10800,7 @@ dxf_surface_swept_set_transform_path_matrix2
                   __FUNCTION__);
                 return (NULL);
         }
-        swept_surface->transform_path_matrix2 = (DxfDouble *) transform_path_matrix2;
+        swept_surface->transform_path_matrix2 = (DxfDoubleArray *) transform_path_matrix2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -45,6 +45,8 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 #include "util.h"
 #include "point.h"
 #include "binary_data.h"
@@ -73,134 +75,9 @@ typedef struct
 dxf_surface_struct
 {
         /* Members common for all DXF drawable entities. */
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0 (default).\n
-                 * Group code = 38.\n
-                 * \deprecated As of version R11. */
-        double thickness;
-                /*!< Thickness of the entity in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48.\n
-                 * \since Introduced in version R13. */
-        int16_t visibility;
-                /*!< Object visibility (optional):\n
-                 * <ol>
-                 * <li value = "0"> Visible</li>
-                 * <li value = "1"> Invisible</li>
-                 * </ol>
-                 * Group code = 60.\n
-                 * \since Introduced in version R13. */
-        int16_t color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native" color of
-                 * the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int16_t paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67.\n
-                 * \since Introduced in version R13. */
-        int32_t graphics_data_size;
-                /*!< Number of bytes in the proxy entity graphics
-                 * represented in the sub-sequent 310 groups, which are
-                 * binary chunk records (optional).\n
-                 * Group code = 92.\n
-                 * \since Introduced in version R2000.\n
-                 * \warning On some 64 bit workstations output is
-                 * generated with group code "160", thus omitting group
-                 * code "92". */
-        int16_t shadow_mode;
-                /*!< Shadow mode:\n
-                 * <ol>
-                 * <li value = "0"> Casts and receives shadows.</li>
-                 * <li value = "1"> Casts shadows.</li>
-                 * <li value = "2"> Receives shadows.</li>
-                 * <li value = "3"> Ignores shadows.</li>
-                 * </ol>\n
-                 * Group code = 284.\n
-                 * \since Introduced in version R2009. */
-        DxfBinaryData *binary_graphics_data;
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310.\n
-                 * \since Introduced in version R2000. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary (optional).\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R14. */
-        char *object_owner_soft;
-                /*!< Soft-pointer ID/handle  to owner BLOCK_RECORD object.\n
-                 * Group code = 330.\n
-                 * \since Introduced in version R2000. */
-        char *material;
-                /*!< Hard-pointer ID/handle to material object (present if
-                 * not BYLAYER).\n
-                 * Group code = 347.\n
-                 * \since Introduced in version R2008. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary (optional).\n
-                 * Group code = 360.\n
-                 * \since Introduced in version R14. */
-        int16_t lineweight;
-                /*!< Lineweight enum value.\n
-                 * Stored and moved around as a 16-bit integer.\n
-                 * Group code = 370.\n
-                 * \since Introduced in version R2002. */
-        char *plot_style_name;
-                /*!< Hard pointer ID / handle of PlotStyleName object.\n
-                 * Group code = 390.\n
-                 * \since Introduced in version R2009. */
-        int32_t color_value;
-                /*!< A 24-bit color value that should be dealt with in
-                 * terms of bytes with values of 0 to 255.\n
-                 * The lowest byte is the blue value, the middle byte is
-                 * the green value, and the third byte is the red value.\n
-                 * The top byte is always 0.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 420.\n
-                 * \since Introduced in version R2004. */
-        char *color_name;
-                /*!< Color name.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 430.\n
-                 * \since Introduced in version R2004. */
-        int32_t transparency;
-                /*!< Transparency value.\n
-                 * The group code cannot be used by custom entities for
-                 * their own data because the group code is reserved for
-                 * AcDbEntity, class-level color data and AcDbEntity,
-                 * class-level transparency data.\n
-                 * Group code = 440.\n
-                 * \since Introduced in version R2004. */
-        /* Specific members for a DXF surface. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         DxfProprietaryData *proprietary_data;
                 /*!< Proprietary data (multiple lines < 255 characters
                  * each).\n
@@ -251,7 +128,7 @@ dxf_surface_extruded_struct
         DxfPoint *p1;
                 /*!< Reference vector for controlling twist.\n
                  * Group code = 11, 21 and 31. */
-        DxfDouble *transform_matrix;
+        DxfDoubleArray *transform_matrix;
                 /*!< Transform matrix of extruded entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
@@ -268,12 +145,12 @@ dxf_surface_extruded_struct
         double twist_angle;
                 /*!< Twist angle.\n
                  * Group code = 45. */
-        DxfDouble *sweep_matrix;
+        DxfDoubleArray *sweep_matrix;
                 /*!< Transform matrix of sweep entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
                  * Group code = 46. */
-        DxfDouble *path_matrix;
+        DxfDoubleArray *path_matrix;
                 /*!< Transform matrix of path entity
                  * (16 reals; row major format; default = identity
                  * matrix)\n
@@ -334,7 +211,7 @@ dxf_surface_extruded_struct
 typedef struct
 dxf_surface_lofted_struct
 {
-        DxfDouble *transform_matrix;
+        DxfDoubleArray *transform_matrix;
                 /*!< Transform matrix of extruded entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
@@ -407,7 +284,7 @@ dxf_surface_revolved_struct
         double start_angle;
                 /*!< Start angle (in radians).\n
                  * Group code = 41. */
-        DxfDouble *transform_matrix;
+        DxfDoubleArray *transform_matrix;
                 /*!< Transform matrix of revolved entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
@@ -456,12 +333,12 @@ dxf_surface_swept_struct
         DxfPoint *p1;
                 /*!< Reference vector for controlling twist.\n
                  * Group code = 11, 21 and 31. */
-        DxfDouble *transform_sweep_matrix;
+        DxfDoubleArray *transform_sweep_matrix;
                 /*!< Transform matrix of sweep entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
                  * Group code = 40. */
-        DxfDouble *transform_path_matrix;
+        DxfDoubleArray *transform_path_matrix;
                 /*!< Transform matrix of path entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
@@ -478,12 +355,12 @@ dxf_surface_swept_struct
         double twist_angle;
                 /*!< Twist angle (in radians).\n
                  * Group code = 45. */
-        DxfDouble *transform_sweep_matrix2;
+        DxfDoubleArray *transform_sweep_matrix2;
                 /*!< Transform matrix of sweep entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
                  * Group code = 46. */
-        DxfDouble *transform_path_matrix2;
+        DxfDoubleArray *transform_path_matrix2;
                 /*!< Transform matrix of path entity
                  * (16 reals; row major format; default = identity
                  * matrix).\n
@@ -555,8 +432,8 @@ DxfSurface *dxf_surface_read (DxfFile *fp, DxfSurface *surface);
 int dxf_surface_write (DxfFile *fp, DxfSurface *surface);
 int dxf_surface_free (DxfSurface *surface);
 void dxf_surface_free_list (DxfSurface *surfaces);
-int dxf_surface_get_id_code (DxfSurface *surface);
-DxfSurface *dxf_surface_set_id_code (DxfSurface *surface, int id_code);
+DxfHandle dxf_surface_get_id_code (DxfSurface *surface);
+DxfSurface *dxf_surface_set_id_code (DxfSurface *surface, DxfHandle id_code);
 char *dxf_surface_get_linetype (DxfSurface *surface);
 DxfSurface *dxf_surface_set_linetype (DxfSurface *surface, char *linetype);
 char *dxf_surface_get_layer (DxfSurface *surface);
@@ -577,8 +454,8 @@ int32_t dxf_surface_get_graphics_data_size (DxfSurface *surface);
 DxfSurface *dxf_surface_set_graphics_data_size (DxfSurface *surface, int32_t graphics_data_size);
 int16_t dxf_surface_get_shadow_mode (DxfSurface *surface);
 DxfSurface *dxf_surface_set_shadow_mode (DxfSurface *surface, int16_t shadow_mode);
-DxfBinaryData *dxf_surface_get_binary_graphics_data (DxfSurface *surface);
-DxfSurface *dxf_surface_set_binary_graphics_data (DxfSurface *surface, DxfBinaryData *data);
+DxfBinaryBuffer *dxf_surface_get_binary_graphics_data (DxfSurface *surface);
+DxfSurface *dxf_surface_set_binary_graphics_data (DxfSurface *surface, DxfBinaryBuffer *data);
 char *dxf_surface_get_dictionary_owner_soft (DxfSurface *surface);
 DxfSurface *dxf_surface_set_dictionary_owner_soft (DxfSurface *surface, char *dictionary_owner_soft);
 char *dxf_surface_get_object_owner_soft (DxfSurface *surface);
@@ -633,8 +510,8 @@ double dxf_surface_extruded_get_y1 (DxfSurfaceExtruded *extruded_surface);
 DxfSurfaceExtruded *dxf_surface_extruded_set_y1 (DxfSurfaceExtruded *extruded_surface, double y1);
 double dxf_surface_extruded_get_z1 (DxfSurfaceExtruded *extruded_surface);
 DxfSurfaceExtruded *dxf_surface_extruded_set_z1 (DxfSurfaceExtruded *extruded_surface, double z1);
-DxfDouble *dxf_surface_extruded_get_transform_matrix (DxfSurfaceExtruded *extruded_surface);
-DxfSurfaceExtruded *dxf_surface_extruded_set_transform_matrix (DxfSurfaceExtruded *extruded_surface, DxfDouble *transform_matrix);
+DxfDoubleArray *dxf_surface_extruded_get_transform_matrix (DxfSurfaceExtruded *extruded_surface);
+DxfSurfaceExtruded *dxf_surface_extruded_set_transform_matrix (DxfSurfaceExtruded *extruded_surface, DxfDoubleArray *transform_matrix);
 double dxf_surface_extruded_get_draft_angle (DxfSurfaceExtruded *extruded_surface);
 DxfSurfaceExtruded *dxf_surface_extruded_set_draft_angle (DxfSurfaceExtruded *extruded_surface, double draft_angle);
 double dxf_surface_extruded_get_draft_start_distance (DxfSurfaceExtruded *extruded_surface);
@@ -643,10 +520,10 @@ double dxf_surface_extruded_get_draft_end_distance (DxfSurfaceExtruded *extruded
 DxfSurfaceExtruded *dxf_surface_extruded_set_draft_end_distance (DxfSurfaceExtruded *extruded_surface, double draft_end_distance);
 double dxf_surface_extruded_get_twist_angle (DxfSurfaceExtruded *extruded_surface);
 DxfSurfaceExtruded *dxf_surface_extruded_set_twist_angle (DxfSurfaceExtruded *extruded_surface, double twist_angle);
-DxfDouble *dxf_surface_extruded_get_sweep_matrix (DxfSurfaceExtruded *extruded_surface);
-DxfSurfaceExtruded *dxf_surface_extruded_set_sweep_matrix (DxfSurfaceExtruded *extruded_surface, DxfDouble *sweep_matrix);
-DxfDouble *dxf_surface_extruded_get_path_matrix (DxfSurfaceExtruded *extruded_surface);
-DxfSurfaceExtruded *dxf_surface_extruded_set_path_matrix (DxfSurfaceExtruded *extruded_surface, DxfDouble *path_matrix);
+DxfDoubleArray *dxf_surface_extruded_get_sweep_matrix (DxfSurfaceExtruded *extruded_surface);
+DxfSurfaceExtruded *dxf_surface_extruded_set_sweep_matrix (DxfSurfaceExtruded *extruded_surface, DxfDoubleArray *sweep_matrix);
+DxfDoubleArray *dxf_surface_extruded_get_path_matrix (DxfSurfaceExtruded *extruded_surface);
+DxfSurfaceExtruded *dxf_surface_extruded_set_path_matrix (DxfSurfaceExtruded *extruded_surface, DxfDoubleArray *path_matrix);
 double dxf_surface_extruded_get_scale_factor (DxfSurfaceExtruded *extruded_surface);
 DxfSurfaceExtruded *dxf_surface_extruded_set_scale_factor (DxfSurfaceExtruded *extruded_surface, double scale_factor);
 double dxf_surface_extruded_get_align_angle (DxfSurfaceExtruded *extruded_surface);
@@ -682,8 +559,8 @@ DxfSurfaceLofted *dxf_surface_lofted_read (DxfFile *fp, DxfSurfaceLofted *lofted
 int dxf_surface_lofted_write (DxfFile *fp, DxfSurfaceLofted *lofted_surface);
 int dxf_surface_lofted_free (DxfSurfaceLofted *lofted_surface);
 void dxf_surface_lofted_free_list (DxfSurfaceLofted *lofted_surfaces);
-DxfDouble *dxf_surface_lofted_get_transform_matrix (DxfSurfaceLofted *lofted_surface);
-DxfSurfaceLofted *dxf_surface_lofted_set_transform_matrix (DxfSurfaceLofted *lofted_surface, DxfDouble *transform_matrix);
+DxfDoubleArray *dxf_surface_lofted_get_transform_matrix (DxfSurfaceLofted *lofted_surface);
+DxfSurfaceLofted *dxf_surface_lofted_set_transform_matrix (DxfSurfaceLofted *lofted_surface, DxfDoubleArray *transform_matrix);
 double dxf_surface_lofted_get_start_draft_angle (DxfSurfaceLofted *lofted_surface);
 DxfSurfaceLofted *dxf_surface_lofted_set_start_draft_angle (DxfSurfaceLofted *lofted_surface, double start_draft_angle);
 double dxf_surface_lofted_get_end_draft_angle (DxfSurfaceLofted *lofted_surface);
@@ -741,8 +618,8 @@ double dxf_surface_revolved_get_revolve_angle (DxfSurfaceRevolved *revolved_surf
 DxfSurfaceRevolved *dxf_surface_revolved_set_revolve_angle (DxfSurfaceRevolved *revolved_surface, double revolve_angle);
 double dxf_surface_revolved_get_start_angle (DxfSurfaceRevolved *revolved_surface);
 DxfSurfaceRevolved *dxf_surface_revolved_set_start_angle (DxfSurfaceRevolved *revolved_surface, double start_angle);
-DxfDouble *dxf_surface_revolved_get_transform_matrix (DxfSurfaceRevolved *revolved_surface);
-DxfSurfaceRevolved *dxf_surface_revolved_set_transform_matrix (DxfSurfaceRevolved *revolved_surface, DxfDouble *transform_matrix);
+DxfDoubleArray *dxf_surface_revolved_get_transform_matrix (DxfSurfaceRevolved *revolved_surface);
+DxfSurfaceRevolved *dxf_surface_revolved_set_transform_matrix (DxfSurfaceRevolved *revolved_surface, DxfDoubleArray *transform_matrix);
 double dxf_surface_revolved_get_draft_angle (DxfSurfaceRevolved *revolved_surface);
 DxfSurfaceRevolved *dxf_surface_revolved_set_draft_angle (DxfSurfaceRevolved *revolved_surface, double draft_angle);
 double dxf_surface_revolved_get_start_draft_distance (DxfSurfaceRevolved *revolved_surface);
@@ -780,10 +657,10 @@ double dxf_surface_swept_get_y1 (DxfSurfaceSwept *swept_surface);
 DxfSurfaceSwept *dxf_surface_swept_set_y1 (DxfSurfaceSwept *swept_surface, double y1);
 double dxf_surface_swept_get_z1 (DxfSurfaceSwept *swept_surface);
 DxfSurfaceSwept *dxf_surface_swept_set_z1 (DxfSurfaceSwept *swept_surface, double z1);
-DxfDouble *dxf_surface_swept_get_transform_sweep_matrix (DxfSurfaceSwept *swept_surface);
-DxfSurfaceSwept *dxf_surface_swept_set_transform_sweep_matrix (DxfSurfaceSwept *swept_surface, DxfDouble *transform_sweep_matrix);
-DxfDouble *dxf_surface_swept_get_transform_path_matrix (DxfSurfaceSwept *swept_surface);
-DxfSurfaceSwept *dxf_surface_swept_set_transform_path_matrix (DxfSurfaceSwept *swept_surface, DxfDouble *transform_path_matrix);
+DxfDoubleArray *dxf_surface_swept_get_transform_sweep_matrix (DxfSurfaceSwept *swept_surface);
+DxfSurfaceSwept *dxf_surface_swept_set_transform_sweep_matrix (DxfSurfaceSwept *swept_surface, DxfDoubleArray *transform_sweep_matrix);
+DxfDoubleArray *dxf_surface_swept_get_transform_path_matrix (DxfSurfaceSwept *swept_surface);
+DxfSurfaceSwept *dxf_surface_swept_set_transform_path_matrix (DxfSurfaceSwept *swept_surface, DxfDoubleArray *transform_path_matrix);
 double dxf_surface_swept_get_draft_angle (DxfSurfaceSwept *swept_surface);
 DxfSurfaceSwept *dxf_surface_swept_set_draft_angle (DxfSurfaceSwept *swept_surface, double draft_angle);
 double dxf_surface_swept_get_start_draft_distance (DxfSurfaceSwept *swept_surface);
@@ -792,10 +669,10 @@ double dxf_surface_swept_get_end_draft_distance (DxfSurfaceSwept *swept_surface)
 DxfSurfaceSwept *dxf_surface_swept_set_end_draft_distance (DxfSurfaceSwept *swept_surface, double end_draft_distance);
 double dxf_surface_swept_get_twist_angle (DxfSurfaceSwept *swept_surface);
 DxfSurfaceSwept *dxf_surface_swept_set_twist_angle (DxfSurfaceSwept *swept_surface, double twist_angle);
-DxfDouble *dxf_surface_swept_get_transform_sweep_matrix2 (DxfSurfaceSwept *swept_surface);
-DxfSurfaceSwept *dxf_surface_swept_set_transform_sweep_matrix2 (DxfSurfaceSwept *swept_surface, DxfDouble *transform_sweep_matrix2);
-DxfDouble *dxf_surface_swept_get_transform_path_matrix2 (DxfSurfaceSwept *swept_surface);
-DxfSurfaceSwept *dxf_surface_swept_set_transform_path_matrix2 (DxfSurfaceSwept *swept_surface, DxfDouble *transform_path_matrix2);
+DxfDoubleArray *dxf_surface_swept_get_transform_sweep_matrix2 (DxfSurfaceSwept *swept_surface);
+DxfSurfaceSwept *dxf_surface_swept_set_transform_sweep_matrix2 (DxfSurfaceSwept *swept_surface, DxfDoubleArray *transform_sweep_matrix2);
+DxfDoubleArray *dxf_surface_swept_get_transform_path_matrix2 (DxfSurfaceSwept *swept_surface);
+DxfSurfaceSwept *dxf_surface_swept_set_transform_path_matrix2 (DxfSurfaceSwept *swept_surface, DxfDoubleArray *transform_path_matrix2);
 double dxf_surface_swept_get_scale_factor (DxfSurfaceSwept *swept_surface);
 DxfSurfaceSwept *dxf_surface_swept_set_scale_factor (DxfSurfaceSwept *swept_surface, double scale_factor);
 double dxf_surface_swept_get_align_angle (DxfSurfaceSwept *swept_surface);
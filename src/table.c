@@ -45,6 +45,7 @@
 
 
 #include "table.h"
+#include "entities.h"
 
 
 /*!
@@ -161,7 +162,7 @@ dxf_table_cell_init
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 cell->optional_text_string[i] = strdup ("");
-                cell->attdef_soft_pointer[i] = strdup ("");
+                cell->attdef_soft_pointer[i] = DXF_HANDLE_NONE;
         }
         cell->text_style_name = strdup (DXF_DEFAULT_TEXTSTYLE);
         cell->color_bg = 0;
@@ -193,8 +194,8 @@ dxf_table_cell_init
         cell->border_visibility_override_left = 0;
         cell->border_visibility_override_top = 0;
         cell->attdef_text_string = strdup ("");
-        cell->block_table_record_hard_pointer = strdup ("");
-        cell->field_object_pointer = strdup ("");
+        cell->block_table_record_hard_pointer = DXF_HANDLE_NONE;
+        cell->field_object_pointer = DXF_HANDLE_NONE;
         cell->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -237,23 +238,18 @@ dxf_table_init
                   __FUNCTION__);
                 return (NULL);
         }
-        table->id_code = 0;
-        table->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        table->layer = strdup (DXF_DEFAULT_LAYER);
-        table->elevation = 0.0;
-        table->thickness = 0.0;
-        table->visibility = 0;
-        table->color = DXF_COLOR_BYLAYER;
-        table->paperspace = DXF_MODELSPACE;
-        table->graphics_data_size = 0;
+        if (dxf_entity_common_init (&table->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                table->binary_graphics_data[i] = strdup ("");
                 table->row_height[i] = 0.0;
                 table->column_height[i] = 0.0;
         }
-        table->dictionary_owner_soft = strdup ("");
-        table->dictionary_owner_hard = strdup ("");
         table->block_name = strdup ("");
         table->table_text_style_name = strdup ("");
         table->x0 = 0.0;
@@ -284,8 +280,8 @@ dxf_table_init
         table->suppress_table_title = 0;
         table->suppress_header_row = 0;
         table->table_cell_color_fill_override = 0;
-        table->tablestyle_object_pointer = strdup ("");
-        table->owning_block_pointer = strdup ("");
+        table->tablestyle_object_pointer = DXF_HANDLE_NONE;
+        table->owning_block_pointer = DXF_HANDLE_NONE;
         table->cells = NULL;
         table->next = NULL;
 #if DEBUG
@@ -318,11 +314,11 @@ dxf_table_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
-        int j;
-        int k;
-        int l;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int k = 0;
+        int l = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -330,8 +326,6 @@ dxf_table_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (table == NULL)
@@ -339,228 +333,143 @@ dxf_table_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                table = dxf_table_new ();
-                table = dxf_table_init (table);
-        }
-        i = 0;
-        j = 0;
-        k = 0;
-        l = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
-        {
-                if (ferror (fp->fp))
+                table = dxf_table_init (dxf_table_new ());
+                if (table == NULL)
                 {
-                        fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "2") == 0)
-                {
-                        /* Now follows a string containing a block name;
-                         * an anonymous block begins with a *T value. */
-                        fscanf (fp->fp, "%s\n", table->block_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &table->id_code);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->x0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the horizontal direction
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->x1);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->y0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the horizontal direction
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->y1);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->z0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the horizontal direction
-                         * vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->z1);
-                }
-                else if (strcmp (temp_string, "90") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * table value (unsigned integer). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->table_value_flag);
-                }
-                else if (strcmp (temp_string, "91") == 0)
-                {
-                        /* Now follows a string containing the number of
-                         * rows. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->number_of_rows);
-                }
-                else if ((strcmp (temp_string, "92") == 0)
-                  && (i == 0))
-                {
-                        /* Now follows a string containing the
-                         * number of bytes in the proxy entity graphics. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->graphics_data_size);
-                        i++;
-                }
-                else if ((strcmp (temp_string, "92") == 0)
-                  && (i == 1))
-                {
-                        /* Now follows a string containing the number of
-                         * columns. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->number_of_columns);
-                }
-                else if (strcmp (temp_string, "93") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->override_flag);
-                }
-                else if (strcmp (temp_string, "94") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override of the border color. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->border_color_override_flag);
-                }
-                else if (strcmp (temp_string, "95") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override of the border lineweight. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->border_lineweight_override_flag);
-                }
-                else if (strcmp (temp_string, "96") == 0)
-                {
-                        /* Now follows a string containing the flag for
-                         * an override of the border visibility. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &table->border_visibility_override_flag);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbBlockReference") != 0))
-                        && ((strcmp (temp_string, "AcDbBlockTable") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "141") == 0)
-                {
-                        /* Now follows a string containing the row
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->row_height[k]);
-                        k++;
-                }
-                else if (strcmp (temp_string, "142") == 0)
-                {
-                        /* Now follows a string containing the column
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &table->column_height[l]);
-                        l++;
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->binary_graphics_data[j]);
-                        j++;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing a soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "342") == 0)
-                {
-                        /* Now follows a string containing a hard pointer
-                         * ID of the TABLESTYLE object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->tablestyle_object_pointer);
-                }
-                else if (strcmp (temp_string, "343") == 0)
-                {
-                        /* Now follows a string containing a hard pointer
-                         * ID of the owning BLOCK record. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->owning_block_pointer);
-                }
-                else if (strcmp (temp_string, "360") == 0)
+        }
+        for (;;)
+        {
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
-                        /* Now follows a string containing a hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_hard);
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 2:
+                                /* An anonymous block name begins with
+                                 * a *T value. */
+                                free (table->block_name);
+                                table->block_name = strdup (value);
+                                break;
+                        case 10:
+                                table->x0 = atof (value);
+                                break;
+                        case 11:
+                                table->x1 = atof (value);
+                                break;
+                        case 20:
+                                table->y0 = atof (value);
+                                break;
+                        case 21:
+                                table->y1 = atof (value);
+                                break;
+                        case 30:
+                                table->z0 = atof (value);
+                                break;
+                        case 31:
+                                table->z1 = atof (value);
+                                break;
+                        case 90:
+                                table->table_value_flag = atoi (value);
+                                break;
+                        case 91:
+                                table->number_of_rows = atoi (value);
+                                break;
+                        case 92:
+                                table->number_of_columns = atoi (value);
+                                break;
+                        case 93:
+                                table->override_flag = atoi (value);
+                                break;
+                        case 94:
+                                table->border_color_override_flag = atoi (value);
+                                break;
+                        case 95:
+                                table->border_lineweight_override_flag = atoi (value);
+                                break;
+                        case 96:
+                                table->border_visibility_override_flag = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbBlockReference") != 0)
+                                  && (strcmp (value, "AcDbBlockTable") != 0)
+                                  && (strcmp (value, "AcDbTable") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 141:
+                                if (k < DXF_MAX_PARAM)
+                                {
+                                        table->row_height[k] = atof (value);
+                                        k++;
+                                }
+                                break;
+                        case 142:
+                                if (l < DXF_MAX_PARAM)
+                                {
+                                        table->column_height[l] = atof (value);
+                                        l++;
+                                }
+                                break;
+                        case 280:
+                                table->table_data_version = atoi (value);
+                                break;
+                        case 342:
+                                table->tablestyle_object_pointer = dxf_handle_parse (value);
+                                break;
+                        case 343:
+                                table->owning_block_pointer = dxf_handle_parse (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &table->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
-        /* Clean up. */
-        free (temp_string);
+        /* Handle omitted members and/or illegal values. */
+        if ((table->common.linetype == NULL)
+          || (strcmp (table->common.linetype, "") == 0))
+        {
+                free (table->common.linetype);
+                table->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
+        }
+        if ((table->common.layer == NULL)
+          || (strcmp (table->common.layer, "") == 0))
+        {
+                free (table->common.layer);
+                table->common.layer = strdup (DXF_DEFAULT_LAYER);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -613,7 +522,7 @@ dxf_table_cell_write
         fprintf (fp->fp, " 91\n%d\n", cell->override_flag);
         fprintf (fp->fp, "178\n%d\n", cell->virtual_edge);
         fprintf (fp->fp, "145\n%lf\n", cell->block_rotation);
-        fprintf (fp->fp, "344\n%s\n", cell->field_object_pointer);
+        dxf_handle_write (fp, 344, cell->field_object_pointer);
         i = 0;
         while ((cell->optional_text_string[i] != NULL)
           && (strcmp (cell->optional_text_string[i], "") != 0))
@@ -622,14 +531,13 @@ dxf_table_cell_write
                 i++;
         }
         fprintf (fp->fp, "  1\n%s\n", cell->text_string);
-        fprintf (fp->fp, "340\n%s\n", cell->block_table_record_hard_pointer);
+        dxf_handle_write (fp, 340, cell->block_table_record_hard_pointer);
         fprintf (fp->fp, "144\n%lf\n", cell->block_scale);
         fprintf (fp->fp, "179\n%d\n", cell->number_of_block_attdefs);
         i = 0;
-        while ((cell->attdef_soft_pointer[i] != NULL)
-          && (strcmp (cell->attdef_soft_pointer[i], "") != 0))
+        while (cell->attdef_soft_pointer[i] != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "331\n%s\n", cell->attdef_soft_pointer[i]);
+                dxf_handle_write (fp, 331, cell->attdef_soft_pointer[i]);
                 i++;
         }
         if (cell->number_of_block_attdefs < (i + 1))
@@ -694,21 +602,20 @@ dxf_table_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (table->id_code != -1)
+        if (table->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", table->id_code);
+                dxf_handle_write (fp, 5, table->common.id_code);
         }
-        fprintf (fp->fp, "330\n%s\n", table->dictionary_owner_soft);
+        dxf_handle_write (fp, 330, table->common.cold->dictionary_owner_soft);
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        fprintf (fp->fp, " 92\n%d\n", table->graphics_data_size);
-        i = 0;
-        while (strlen (table->binary_graphics_data[i]) > 0)
+        fprintf (fp->fp, "  8\n%s\n", table->common.layer);
+        fprintf (fp->fp, " 92\n%" PRIi32 "\n", table->common.cold->graphics_data_size);
+        if (table->common.cold->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", table->binary_graphics_data[i]);
-                i++;
+                dxf_binary_buffer_write (fp, 310, table->common.cold->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -723,8 +630,8 @@ dxf_table_write
                 fprintf (fp->fp, "100\nAcDbTable\n");
         }
         fprintf (fp->fp, "280\n%d\n", table->table_data_version);
-        fprintf (fp->fp, "342\n%s\n", table->tablestyle_object_pointer);
-        fprintf (fp->fp, "343\n%s\n", table->owning_block_pointer);
+        dxf_handle_write (fp, 342, table->tablestyle_object_pointer);
+        dxf_handle_write (fp, 343, table->owning_block_pointer);
         fprintf (fp->fp, " 11\n%f\n", table->x1);
         fprintf (fp->fp, " 21\n%f\n", table->y1);
         fprintf (fp->fp, " 31\n%f\n", table->z1);
@@ -791,12 +698,9 @@ dxf_table_cell_free
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 free (cell->optional_text_string[i]);
-                free (cell->attdef_soft_pointer[i]);
         }
         free (cell->text_style_name);
         free (cell->attdef_text_string);
-        free (cell->block_table_record_hard_pointer);
-        free (cell->field_object_pointer);
         free (cell);
         cell = NULL;
 #if DEBUG
@@ -823,7 +727,6 @@ dxf_table_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
 
         /* Do some basic checks. */
         if (table == NULL)
@@ -840,18 +743,9 @@ dxf_table_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (table->linetype);
-        free (table->layer);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                free (table->binary_graphics_data[i]);
-        }
-        free (table->dictionary_owner_soft);
-        free (table->dictionary_owner_hard);
+        dxf_entity_common_free (&table->common);
         free (table->block_name);
         free (table->table_text_style_name);
-        free (table->tablestyle_object_pointer);
-        free (table->owning_block_pointer);
 //        dxf_table_cells_free_list (table->cells);
         free (table);
         table = NULL;
@@ -887,6 +781,7 @@ dxf_table_cell_free_list
         while (cells != NULL)
         {
                 DxfTableCell *iter = (DxfTableCell *) cells->next;
+                cells->next = NULL;
                 dxf_table_cell_free (cells);
                 cells = (DxfTableCell *) iter;
         }
@@ -921,6 +816,7 @@ dxf_table_free_list
         while (tables != NULL)
         {
                 struct DxfTable *iter = tables->next;
+                tables->next = NULL;
                 dxf_table_free (tables);
                 tables = (DxfTable *) iter;
         }
@@ -930,4 +826,86 @@ dxf_table_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c ACAD_TABLE entity.
+ *
+ * The copy does not share any memory with \c table, its \c next
+ * member is \c NULL.\n
+ * The cells are not owned by the table, the copy refers to the
+ * same cells.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTable *
+dxf_table_copy
+(
+        DxfTable *table
+                /*!< a pointer to the DXF \c ACAD_TABLE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTable *copy;
+
+        /* Do some basic checks. */
+        if (table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_table_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, table, sizeof (DxfTable));
+        copy->block_name = NULL;
+        copy->table_text_style_name = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &table->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_table_free (copy);
+                return (NULL);
+        }
+        if (table->block_name != NULL)
+        {
+                copy->block_name = strdup (table->block_name);
+                if (copy->block_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_table_free (copy);
+                        return (NULL);
+                }
+        }
+        if (table->table_text_style_name != NULL)
+        {
+                copy->table_text_style_name = strdup (table->table_text_style_name);
+                if (copy->table_text_style_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_table_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /* EOF */
@@ -48,6 +48,8 @@
 
 
 #include "global.h"
+#include "entity.h"
+#include "handle.h"
 
 
 #ifdef __cplusplus
@@ -225,18 +227,18 @@ dxf_table_cell_struct
                  * repeated once per attribute definition and applicable
                  * only for a block-type cell.\n
                  * Group code = 300. */
-        char *attdef_soft_pointer[DXF_MAX_PARAM];
+        DxfHandle attdef_soft_pointer[DXF_MAX_PARAM];
                 /*!< Soft pointer ID of the attribute definition in the
                  * block table record, referenced by group code 179
                  * (applicable only for a block-type cell).\n
                  * This value is repeated once per attribute definition.\n
                  * Group code = 331. */
-        char *block_table_record_hard_pointer;
+        DxfHandle block_table_record_hard_pointer;
                 /*!< Hard-pointer ID of the block table record.\n
                  * This value applies only to block-type cells and is
                  * repeated, 1 value per cell.\n
                  * Group code = 340. */
-        char *field_object_pointer;
+        DxfHandle field_object_pointer;
                 /*!< Hard pointer ID of the \c FIELD object.\n
                  * This applies only to a text-type cell.\n
                  * If the text in the cell contains one or more fields,
@@ -255,71 +257,10 @@ dxf_table_cell_struct
 typedef struct
 dxf_table_struct
 {
-        int id_code;
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file.\n
-                 * Group code = 5. */
-        char *linetype;
-                /*!< The linetype of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Group code = 6. */
-        char *layer;
-                /*!< Layer on which the entity is drawn.\n
-                 * Defaults to layer "0" if no valid layername is given.\n
-                 * Group code = 8. */
-        double elevation;
-                /*!< Elevation of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if omitted in the DXF file, or prior
-                 * to DXF version R12, or DXF_FLATLAND equals 0
-                 * (default).\n
-                 * (default).\n
-                 * Group code = 38. */
-        double thickness;
-                /*!< Thickness of the arc in the local Z-direction.\n
-                 * Defaults to 0.0 if ommitted in the DXF file.\n
-                 * Group code = 39. */
-        double linetype_scale;
-                /*!< Linetype scale (optional).\n
-                 * Group code = 48. */
-        int16_t visibility;
-                /*!< Object visibility (optional):
-                 * <ol>
-                 * <li value = "0"> Visible;</li>
-                 * <li value = "1"> Invisible.</li>
-                 * </ol>
-                 * Group code = 60. */
-        int color;
-                /*!< Color of the entity.\n
-                 * Defaults to \c BYLAYER if ommitted in the DXF file.\n
-                 * Note that entities encapsulated in a block with the
-                 * color \c BYBLOCK are represented in the "native"
-                 * color of the \c BLOCK entity.\n
-                 * Group code = 62. */
-        int paperspace;
-                /*!< Entities are to be drawn on either \c PAPERSPACE or
-                 * \c MODELSPACE.\n
-                 * Optional, defaults to \c DXF_MODELSPACE (0).\n
-                 * Group code = 67. */
-        int graphics_data_size;
-                /*!< The number of bytes in the image (and subsequent
-                 * binary chunk records) (optional).\n
-                 * Group code = 92.
-                 *
-                 * \warning Multiple entries with Group code 92. */
-        char *binary_graphics_data[DXF_MAX_PARAM];
-                /*!< Proxy entity graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310. */
-        char *dictionary_owner_soft;
-                /*!< Soft-pointer ID/handle to owner dictionary
-                 * (optional).\n
-                 * Group code = 330. */
-        char *dictionary_owner_hard;
-                /*!< Hard owner ID/handle to owner dictionary
-                 * (optional).\n
-                 * Group code = 360. */
+        /* Members common for all DXF drawable entities. */
+        DxfEntityCommon common;
+                /*!< Data common to all entities, must be the first
+                 * member. */
         /* Specific members for a DXF table. */
         char *block_name;
                 /*!< Block name; an anonymous block begins with a *T
@@ -459,10 +400,10 @@ dxf_table_struct
                  * <li value = "1"> Enabled.</li>
                  * </ol>
                  * Group code = 283. */
-        char *tablestyle_object_pointer;
+        DxfHandle tablestyle_object_pointer;
                 /*!< Hard pointer ID of the \c TABLESTYLE object.\n
                  * Group code = 342. */
-        char *owning_block_pointer;
+        DxfHandle owning_block_pointer;
                 /*!< Hard pointer ID of the owning \c BLOCK record.\n
                  * Group code = 343. */
         struct DxfTableCell *cells;
@@ -485,6 +426,7 @@ int dxf_table_cell_free (DxfTableCell *cell);
 int dxf_table_free (DxfTable *table);
 void dxf_table_cell_free_list (DxfTableCell *cells);
 void dxf_table_free_list (DxfTable *tables);
+DxfTable *dxf_table_copy (DxfTable *table);
 
 
 #ifdef __cplusplus
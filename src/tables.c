@@ -116,6 +116,15 @@ dxf_tables_init
         tables->ucss = (DxfUcs *) dxf_ucs_init ((DxfUcs *) tables->ucss);
         tables->views = (DxfView *) dxf_view_init ((DxfView *) tables->views);
         tables->vports = (DxfVPort *) dxf_vport_init ((DxfVPort *) tables->vports);
+        tables->last_appid = tables->appids;
+        tables->last_block_record = tables->block_records;
+        tables->last_dimstyle = tables->dimstyles;
+        tables->last_layer = tables->layers;
+        tables->last_ltype = tables->ltypes;
+        tables->last_style = tables->styles;
+        tables->last_ucs = tables->ucss;
+        tables->last_view = tables->views;
+        tables->last_vport = tables->vports;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -345,6 +354,7 @@ dxf_tables_set_appids
                 return (NULL);
         }
         tables->appids = appids;
+        tables->last_appid = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -420,6 +430,7 @@ dxf_tables_set_block_records
                 return (NULL);
         }
         tables->block_records = block_records;
+        tables->last_block_record = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -495,6 +506,7 @@ dxf_tables_set_dimstyles
                 return (NULL);
         }
         tables->dimstyles = dimstyles;
+        tables->last_dimstyle = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -570,6 +582,7 @@ dxf_tables_set_layers
                 return (NULL);
         }
         tables->layers = layers;
+        tables->last_layer = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -645,6 +658,7 @@ dxf_tables_set_ltypes
                 return (NULL);
         }
         tables->ltypes = ltypes;
+        tables->last_ltype = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -720,6 +734,7 @@ dxf_tables_set_styles
                 return (NULL);
         }
         tables->styles = styles;
+        tables->last_style = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -795,6 +810,7 @@ dxf_tables_set_ucss
                 return (NULL);
         }
         tables->ucss = ucss;
+        tables->last_ucs = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -870,6 +886,7 @@ dxf_tables_set_views
                 return (NULL);
         }
         tables->views = views;
+        tables->last_view = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -945,6 +962,7 @@ dxf_tables_set_vports
                 return (NULL);
         }
         tables->vports = vports;
+        tables->last_vport = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -952,4 +970,643 @@ dxf_tables_set_vports
 }
 
 
+/*!
+ * \brief Append a \c APPID symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_appid, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_appid
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfAppid *appid
+                /*!< the \c APPID symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAppid *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (appid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->appids == NULL)
+        {
+                tables->appids = appid;
+        }
+        else
+        {
+                iter = tables->last_appid;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->appids;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfAppid *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfAppid *) appid;
+        }
+        iter = appid;
+        while (iter->next != NULL)
+        {
+                iter = (DxfAppid *) iter->next;
+        }
+        tables->last_appid = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c BLOCK_RECORD symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_block_record, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_block_record
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfBlockRecord *block_record
+                /*!< the \c BLOCK_RECORD symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockRecord *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (block_record == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->block_records == NULL)
+        {
+                tables->block_records = block_record;
+        }
+        else
+        {
+                iter = tables->last_block_record;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->block_records;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfBlockRecord *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfBlockRecord *) block_record;
+        }
+        iter = block_record;
+        while (iter->next != NULL)
+        {
+                iter = (DxfBlockRecord *) iter->next;
+        }
+        tables->last_block_record = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c DIMSTYLE symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_dimstyle, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_dimstyle
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfDimStyle *dimstyle
+                /*!< the \c DIMSTYLE symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDimStyle *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dimstyle == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->dimstyles == NULL)
+        {
+                tables->dimstyles = dimstyle;
+        }
+        else
+        {
+                iter = tables->last_dimstyle;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->dimstyles;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfDimStyle *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfDimStyle *) dimstyle;
+        }
+        iter = dimstyle;
+        while (iter->next != NULL)
+        {
+                iter = (DxfDimStyle *) iter->next;
+        }
+        tables->last_dimstyle = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c LAYER symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_layer, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_layer
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfLayer *layer
+                /*!< the \c LAYER symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayer *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (layer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->layers == NULL)
+        {
+                tables->layers = layer;
+        }
+        else
+        {
+                iter = tables->last_layer;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->layers;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfLayer *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfLayer *) layer;
+        }
+        iter = layer;
+        while (iter->next != NULL)
+        {
+                iter = (DxfLayer *) iter->next;
+        }
+        tables->last_layer = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c LTYPE symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_ltype, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_ltype
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfLType *ltype
+                /*!< the \c LTYPE symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLType *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (ltype == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->ltypes == NULL)
+        {
+                tables->ltypes = ltype;
+        }
+        else
+        {
+                iter = tables->last_ltype;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->ltypes;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfLType *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfLType *) ltype;
+        }
+        iter = ltype;
+        while (iter->next != NULL)
+        {
+                iter = (DxfLType *) iter->next;
+        }
+        tables->last_ltype = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c STYLE symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_style, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_style
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfStyle *style
+                /*!< the \c STYLE symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStyle *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (style == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->styles == NULL)
+        {
+                tables->styles = style;
+        }
+        else
+        {
+                iter = tables->last_style;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->styles;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfStyle *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfStyle *) style;
+        }
+        iter = style;
+        while (iter->next != NULL)
+        {
+                iter = (DxfStyle *) iter->next;
+        }
+        tables->last_style = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c UCS symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_ucs, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_ucs
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfUcs *ucs
+                /*!< the \c UCS symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfUcs *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (ucs == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->ucss == NULL)
+        {
+                tables->ucss = ucs;
+        }
+        else
+        {
+                iter = tables->last_ucs;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->ucss;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfUcs *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfUcs *) ucs;
+        }
+        iter = ucs;
+        while (iter->next != NULL)
+        {
+                iter = (DxfUcs *) iter->next;
+        }
+        tables->last_ucs = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c VIEW symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_view, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_view
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfView *view
+                /*!< the \c VIEW symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfView *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (view == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->views == NULL)
+        {
+                tables->views = view;
+        }
+        else
+        {
+                iter = tables->last_view;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->views;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfView *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfView *) view;
+        }
+        iter = view;
+        while (iter->next != NULL)
+        {
+                iter = (DxfView *) iter->next;
+        }
+        tables->last_view = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a \c VPORT symbol table entry (or a chain of entries)
+ * to a DXF \c TABLES section.
+ *
+ * The last entry is remembered in \c last_vport, so appending costs
+ * O(1) instead of walking the whole list.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tables_append_vport
+(
+        DxfTables *tables,
+                /*!< a pointer to a DXF \c TABLES section. */
+        DxfVPort *vport
+                /*!< the \c VPORT symbol table entry to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVPort *iter;
+
+        /* Do some basic checks. */
+        if (tables == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (vport == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tables->vports == NULL)
+        {
+                tables->vports = vport;
+        }
+        else
+        {
+                iter = tables->last_vport;
+                if (iter == NULL)
+                {
+                        /* The list was set by other means, search the
+                         * last entry once. */
+                        iter = tables->vports;
+                        while (iter->next != NULL)
+                        {
+                                iter = (DxfVPort *) iter->next;
+                        }
+                }
+                iter->next = (struct DxfVPort *) vport;
+        }
+        iter = vport;
+        while (iter->next != NULL)
+        {
+                iter = (DxfVPort *) iter->next;
+        }
+        tables->last_vport = iter;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
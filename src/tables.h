@@ -99,6 +99,33 @@ dxf_tables_struct
                 /*!< Pointer to the first \c VIEW symbol table entry. */
         DxfVPort *vports;
                 /*!< Pointer to the first \c VPORT symbol table entry. */
+        DxfAppid *last_appid;
+                /*!< Pointer to the last \c APPID symbol table entry,
+                 * maintained by dxf_tables_append_appid (). */
+        DxfBlockRecord *last_block_record;
+                /*!< Pointer to the last \c BLOCK_RECORD symbol table entry,
+                 * maintained by dxf_tables_append_block_record (). */
+        DxfDimStyle *last_dimstyle;
+                /*!< Pointer to the last \c DIMSTYLE symbol table entry,
+                 * maintained by dxf_tables_append_dimstyle (). */
+        DxfLayer *last_layer;
+                /*!< Pointer to the last \c LAYER symbol table entry,
+                 * maintained by dxf_tables_append_layer (). */
+        DxfLType *last_ltype;
+                /*!< Pointer to the last \c LTYPE symbol table entry,
+                 * maintained by dxf_tables_append_ltype (). */
+        DxfStyle *last_style;
+                /*!< Pointer to the last \c STYLE symbol table entry,
+                 * maintained by dxf_tables_append_style (). */
+        DxfUcs *last_ucs;
+                /*!< Pointer to the last \c UCS symbol table entry,
+                 * maintained by dxf_tables_append_ucs (). */
+        DxfView *last_view;
+                /*!< Pointer to the last \c VIEW symbol table entry,
+                 * maintained by dxf_tables_append_view (). */
+        DxfVPort *last_vport;
+                /*!< Pointer to the last \c VPORT symbol table entry,
+                 * maintained by dxf_tables_append_vport (). */
 } DxfTables;
 
 
@@ -126,6 +153,15 @@ DxfView *dxf_tables_get_views (DxfTables *tables);
 DxfTables *dxf_tables_set_views (DxfTables *tables, DxfView *views);
 DxfVPort *dxf_tables_get_vports (DxfTables *tables);
 DxfTables *dxf_tables_set_vports (DxfTables *tables, DxfVPort *vports);
+int dxf_tables_append_appid (DxfTables *tables, DxfAppid *appid);
+int dxf_tables_append_block_record (DxfTables *tables, DxfBlockRecord *block_record);
+int dxf_tables_append_dimstyle (DxfTables *tables, DxfDimStyle *dimstyle);
+int dxf_tables_append_layer (DxfTables *tables, DxfLayer *layer);
+int dxf_tables_append_ltype (DxfTables *tables, DxfLType *ltype);
+int dxf_tables_append_style (DxfTables *tables, DxfStyle *style);
+int dxf_tables_append_ucs (DxfTables *tables, DxfUcs *ucs);
+int dxf_tables_append_view (DxfTables *tables, DxfView *view);
+int dxf_tables_append_vport (DxfTables *tables, DxfVPort *vport);
 
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 
 
 #include "text.h"
+#include "entities.h"
 
 
 /*!
@@ -110,27 +111,13 @@ dxf_text_init
                 __FUNCTION__);
               return (NULL);
         }
-        text->id_code = 0;
-        text->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        text->layer = strdup (DXF_DEFAULT_LAYER);
-        text->elevation = 0.0;
-        text->thickness = 0.0;
-        text->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        text->visibility = DXF_DEFAULT_VISIBILITY;
-        text->color = DXF_COLOR_BYLAYER;
-        text->paperspace = DXF_MODELSPACE;
-        text->graphics_data_size = 0;
-        text->shadow_mode = 0;
-        text->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        text->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data);
-        text->dictionary_owner_soft = strdup ("");
-        text->material = strdup ("");
-        text->dictionary_owner_hard = strdup ("");
-        text->lineweight = 0;
-        text->plot_style_name = strdup ("");
-        text->color_value = 0;
-        text->color_name = strdup ("");
-        text->transparency = 0;
+        if (dxf_entity_common_init (&text->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         text->text_value = strdup ("");
         text->text_style = strdup ("");
         text->p0 = (DxfPoint *) dxf_point_new ();
@@ -185,8 +172,9 @@ dxf_text_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -194,8 +182,6 @@ dxf_text_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (text == NULL)
@@ -203,344 +189,135 @@ dxf_text_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                text = dxf_text_init (text);
+                text = dxf_text_init (dxf_text_new ());
+                if (text == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "1") == 0)
-                {
-                        /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->text_value);
-                }
-                else if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &text->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->linetype);
-                }
-                else if (strcmp (temp_string, "7") == 0)
-                {
-                        /* Now follows a string containing a text style
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->text_style);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the first alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the first alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the first alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the second alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the second alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the second alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (text->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->height);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * relative X-scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->rel_x_scale);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->rot_angle);
-                }
-                else if (strcmp (temp_string, "51") == 0)
-                {
-                        /* Now follows a string containing the
-                         * oblique angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->obl_angle);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &text->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->paperspace);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the
-                         * text flags value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->text_flags);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the
-                         * horizontal alignment flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->hor_align);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the
-                         * vertical alignment flag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->vert_align);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbText") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &text->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &text->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &text->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) text->binary_graphics_data->next);
-                        text->binary_graphics_data = (DxfBinaryGraphicsData *) text->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->material);
+                        break;
                 }
-                else if (strcmp (temp_string, "360") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->dictionary_owner_hard);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &text->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &text->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, text->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &text->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 1:
+                                free (text->text_value);
+                                text->text_value = strdup (value);
+                                break;
+                        case 7:
+                                free (text->text_style);
+                                text->text_style = strdup (value);
+                                break;
+                        case 10:
+                                text->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                text->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                text->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                text->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                text->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                text->p1->z0 = atof (value);
+                                break;
+                        case 40:
+                                text->height = atof (value);
+                                break;
+                        case 41:
+                                text->rel_x_scale = atof (value);
+                                break;
+                        case 50:
+                                text->rot_angle = atof (value);
+                                break;
+                        case 51:
+                                text->obl_angle = atof (value);
+                                break;
+                        case 71:
+                                text->text_flags = atoi (value);
+                                break;
+                        case 72:
+                                text->hor_align = atoi (value);
+                                break;
+                        case 73:
+                                text->vert_align = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbText") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                text->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                text->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                text->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &text->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (text->text_value, "") == 0)
+        if ((text->common.linetype == NULL)
+          || (strcmp (text->common.linetype, "") == 0))
         {
-                fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, text->id_code);
-                dxf_entity_skip (dxf_entity_name);
-                return (NULL);
+                free (text->common.linetype);
+                text->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (text->linetype, "") == 0)
+        if ((text->common.layer == NULL)
+          || (strcmp (text->common.layer, "") == 0))
         {
-                text->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (text->common.layer);
+                text->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (strcmp (text->layer, "") == 0)
+        if (strcmp (text->text_value, "") == 0)
         {
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                fprintf (stderr,
+                  (_("Warning in %s () text value string is empty for the TEXT entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, text->common.id_code);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -587,8 +364,8 @@ dxf_text_write
         if (strcmp (text->text_value, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, text->id_code);
+                  (_("Error in %s () text value string is empty for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, text->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
@@ -597,36 +374,36 @@ dxf_text_write
         if (strcmp (text->text_style, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, text->id_code);
+                  (_("Warning in %s () text style string is empty for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, text->common.id_code);
                 text->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);        }
-        if (strcmp (text->layer, "") == 0)
+        if (strcmp (text->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, text->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, text->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                text->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (text->height == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, text->id_code);
+                  (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, text->common.id_code);
         }
         if (text->rel_x_scale == 0.0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, text->id_code);
+                  (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, text->common.id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (text->id_code != -1)
+        if (text->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", text->id_code);
+                dxf_handle_write (fp, 5, text->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -638,97 +415,91 @@ dxf_text_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (text->dictionary_owner_soft, "") != 0)
+        if ((text->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", text->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, text->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (text->dictionary_owner_hard, "") != 0)
+        if ((text->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", text->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, text->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (text->paperspace == 1)
+        if (text->common.paperspace == 1)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", text->layer);
-        if (strcmp (text->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", text->common.layer);
+        if (strcmp (text->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", text->linetype);
+                fprintf (fp->fp, "  6\n%s\n", text->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (text->material, "") != 0))
+          && (text->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", text->material);
+                dxf_handle_write (fp, 347, text->common.cold->material);
         }
-        if (text->color != DXF_COLOR_BYLAYER)
+        if (text->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", text->color);
+                fprintf (fp->fp, " 62\n%hd\n", text->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", text->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", text->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (text->elevation != 0.0))
+          && (text->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", text->elevation);
+                fprintf (fp->fp, " 38\n%f\n", text->common.elevation);
         }
-        if (text->linetype_scale != 1.0)
+        if (text->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", text->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", text->common.linetype_scale);
         }
-        if (text->visibility != 0)
+        if (text->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", text->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", text->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (text->graphics_data_size > 0))
+          && (text->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", text->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", text->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", text->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", text->common.cold->graphics_data_size);
 #endif
-                if (text->binary_graphics_data != NULL)
+                if (text->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = text->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, text->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", text->color_value);
-                fprintf (fp->fp, "430\n%s\n", text->color_name);
-                fprintf (fp->fp, "440\n%ld\n", text->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", text->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", text->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", text->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", text->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", text->shadow_mode);
+                dxf_handle_write (fp, 390, text->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", text->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbText\n");
         }
-        if (text->thickness != 0.0)
+        if (text->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", text->thickness);
+                fprintf (fp->fp, " 39\n%f\n", text->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", text->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", text->p0->y0);
@@ -766,8 +537,8 @@ dxf_text_write
                   && (text->p0->z0 == text->p1->z0))
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x\n")),
-                          __FUNCTION__, dxf_entity_name, text->id_code);
+                          (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %" PRIx64 "\n")),
+                          __FUNCTION__, dxf_entity_name, text->common.id_code);
                         fprintf (stderr,
                           (_("\tdefault justification applied to %s entity\n")),
                           dxf_entity_name);
@@ -798,6 +569,7 @@ dxf_text_write
         {
                 fprintf (fp->fp, " 73\n%d\n", text->vert_align);
         }
+        dxf_entity_common_write_xdata (fp, &text->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -839,14 +611,7 @@ dxf_text_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (text->linetype);
-        free (text->layer);
-        dxf_binary_graphics_data_free_list (text->binary_graphics_data);
-        free (text->dictionary_owner_soft);
-        free (text->material);
-        free (text->dictionary_owner_hard);
-        free (text->plot_style_name);
-        free (text->color_name);
+        dxf_entity_common_free (&text->common);
         free (text->text_value);
         free (text->text_style);
         dxf_point_free (text->p0);
@@ -884,6 +649,7 @@ dxf_text_free_list
         while (texts != NULL)
         {
                 DxfText *iter = (DxfText *) texts->next;
+                texts->next = NULL;
                 dxf_text_free (texts);
                 texts = (DxfText *) iter;
         }
@@ -893,12 +659,112 @@ dxf_text_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c TEXT entity.
+ *
+ * The copy does not share any memory with \c text, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfText *
+dxf_text_copy
+(
+        DxfText *text
+                /*!< a pointer to the DXF \c TEXT entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfText *copy;
+
+        /* Do some basic checks. */
+        if (text == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_text_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, text, sizeof (DxfText));
+        copy->text_value = NULL;
+        copy->text_style = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &text->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_text_free (copy);
+                return (NULL);
+        }
+        if (text->text_value != NULL)
+        {
+                copy->text_value = strdup (text->text_value);
+                if (copy->text_value == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_text_free (copy);
+                        return (NULL);
+                }
+        }
+        if (text->text_style != NULL)
+        {
+                copy->text_style = strdup (text->text_style);
+                if (copy->text_style == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_text_free (copy);
+                        return (NULL);
+                }
+        }
+        if (text->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (text->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_text_free (copy);
+                        return (NULL);
+                }
+        }
+        if (text->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (text->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_text_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c TEXT entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_text_get_id_code
 (
         DxfText *text
@@ -916,16 +782,10 @@ dxf_text_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->id_code);
+        return (text->common.id_code);
 }
 
 
@@ -937,7 +797,7 @@ dxf_text_set_id_code
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -954,13 +814,7 @@ dxf_text_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        text->id_code = id_code;
+        text->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -991,7 +845,7 @@ dxf_text_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->linetype ==  NULL)
+        if (text->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1001,7 +855,7 @@ dxf_text_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->linetype));
+        return (strdup (text->common.linetype));
 }
 
 
@@ -1036,7 +890,7 @@ dxf_text_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        text->linetype = strdup (linetype);
+        text->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1067,7 +921,7 @@ dxf_text_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->layer ==  NULL)
+        if (text->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1077,7 +931,7 @@ dxf_text_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->layer));
+        return (strdup (text->common.layer));
 }
 
 
@@ -1112,7 +966,7 @@ dxf_text_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        text->layer = strdup (layer);
+        text->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1146,7 +1000,7 @@ dxf_text_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->elevation);
+        return (text->common.elevation);
 }
 
 
@@ -1173,7 +1027,7 @@ dxf_text_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        text->elevation = elevation;
+        text->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1204,7 +1058,7 @@ dxf_text_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->thickness < 0.0)
+        if (text->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1213,7 +1067,7 @@ dxf_text_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->thickness);
+        return (text->common.thickness);
 }
 
 
@@ -1246,7 +1100,7 @@ dxf_text_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        text->thickness = thickness;
+        text->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1277,7 +1131,7 @@ dxf_text_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->linetype_scale < 0.0)
+        if (text->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1286,7 +1140,7 @@ dxf_text_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->linetype_scale);
+        return (text->common.linetype_scale);
 }
 
 
@@ -1319,7 +1173,7 @@ dxf_text_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        text->linetype_scale = linetype_scale;
+        text->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1350,13 +1204,13 @@ dxf_text_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->visibility < 0)
+        if (text->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (text->visibility > 1)
+        if (text->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1365,7 +1219,7 @@ dxf_text_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->visibility);
+        return (text->common.visibility);
 }
 
 
@@ -1404,7 +1258,7 @@ dxf_text_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        text->visibility = visibility;
+        text->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1435,7 +1289,7 @@ dxf_text_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->color < 0)
+        if (text->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1444,7 +1298,7 @@ dxf_text_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->color);
+        return (text->common.color);
 }
 
 
@@ -1477,7 +1331,7 @@ dxf_text_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        text->color = color;
+        text->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1508,13 +1362,13 @@ dxf_text_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->paperspace < 0)
+        if (text->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (text->paperspace > 1)
+        if (text->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1523,7 +1377,7 @@ dxf_text_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->paperspace);
+        return (text->common.paperspace);
 }
 
 
@@ -1563,7 +1417,7 @@ dxf_text_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        text->paperspace = paperspace;
+        text->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1595,13 +1449,13 @@ dxf_text_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->graphics_data_size < 0)
+        if (text->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (text->graphics_data_size == 0)
+        if (text->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1610,7 +1464,7 @@ dxf_text_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->graphics_data_size);
+        return (text->common.cold->graphics_data_size);
 }
 
 
@@ -1653,7 +1507,7 @@ dxf_text_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        text->graphics_data_size = graphics_data_size;
+        text->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1685,13 +1539,13 @@ dxf_text_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (text->shadow_mode < 0)
+        if (text->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (text->shadow_mode > 3)
+        if (text->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1700,7 +1554,7 @@ dxf_text_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->shadow_mode);
+        return (text->common.cold->shadow_mode);
 }
 
 
@@ -1742,7 +1596,7 @@ dxf_text_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        text->shadow_mode = shadow_mode;
+        text->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1754,11 +1608,12 @@ dxf_text_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c TEXT entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_text_get_binary_graphics_data
 (
         DxfText *text
@@ -1776,32 +1631,31 @@ dxf_text_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) text->binary_graphics_data);
+        return (text->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c TEXT entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c text when successful, or \c NULL when an
+ * error occurred.
  */
 DxfText *
 dxf_text_set_binary_graphics_data
 (
         DxfText *text,
                 /*!< a pointer to a DXF \c TEXT entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1822,7 +1676,12 @@ dxf_text_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        text->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((text->common.cold->binary_graphics_data != NULL)
+          && (text->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (text->common.cold->binary_graphics_data);
+        }
+        text->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1856,17 +1715,10 @@ dxf_text_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->dictionary_owner_soft));
+        return (dxf_handle_to_string (text->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1902,7 +1754,7 @@ dxf_text_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        text->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        text->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1936,17 +1788,10 @@ dxf_text_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->material));
+        return (dxf_handle_to_string (text->common.cold->material));
 }
 
 
@@ -1984,7 +1829,7 @@ dxf_text_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        text->material = strdup (material);
+        text->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2018,17 +1863,10 @@ dxf_text_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->dictionary_owner_hard));
+        return (dxf_handle_to_string (text->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2064,7 +1902,7 @@ dxf_text_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        text->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        text->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2099,7 +1937,7 @@ dxf_text_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->lineweight);
+        return (text->common.lineweight);
 }
 
 
@@ -2129,7 +1967,7 @@ dxf_text_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        text->lineweight = lineweight;
+        text->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2161,17 +1999,10 @@ dxf_text_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->plot_style_name));
+        return (dxf_handle_to_string (text->common.cold->plot_style_name));
 }
 
 
@@ -2209,7 +2040,7 @@ dxf_text_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        text->plot_style_name = strdup (plot_style_name);
+        text->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2244,7 +2075,7 @@ dxf_text_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->color_value);
+        return (text->common.color_value);
 }
 
 
@@ -2274,7 +2105,7 @@ dxf_text_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        text->color_value = color_value;
+        text->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2306,7 +2137,7 @@ dxf_text_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (text->color_name ==  NULL)
+        if (text->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2316,7 +2147,7 @@ dxf_text_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (text->color_name));
+        return (strdup (text->common.cold->color_name));
 }
 
 
@@ -2354,7 +2185,7 @@ dxf_text_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        text->color_name = strdup (color_name);
+        text->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2389,7 +2220,7 @@ dxf_text_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (text->transparency);
+        return (text->common.cold->transparency);
 }
 
 
@@ -2419,7 +2250,7 @@ dxf_text_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        text->transparency = transparency;
+        text->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
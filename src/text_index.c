@@ -0,0 +1,1560 @@
+/*!
+ * \file text_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a full-text index over the text strings of a
+ * DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "text_index.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "mtext.h"
+#include "text.h"
+#include "util.h"
+
+
+#define DXF_TEXT_INDEX_CHUNK_LENGTH 250
+        /*!< \brief Maximum number of characters written in one group
+         * 3 or group 1 line. */
+
+
+/*!
+ * \brief Fold a character for case insensitive matching.
+ */
+static int
+dxf_text_index_fold
+(
+        int c
+                /*!< the character. */
+)
+{
+        return (toupper ((unsigned char) c));
+}
+
+
+/*!
+ * \brief Compute the slot of a trigram in the hash of posting lists.
+ */
+static int
+dxf_text_index_hash
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        uint32_t trigram
+                /*!< the trigram. */
+)
+{
+        return ((int) ((trigram * 2654435761u) >> 8) & (2 * index->postings_size - 1));
+}
+
+
+/*!
+ * \brief Find the posting list of a trigram.
+ *
+ * \return the id of the posting list, or -1 when the trigram is not
+ * in the index.
+ */
+static int
+dxf_text_index_find_posting
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        uint32_t trigram
+                /*!< the trigram. */
+)
+{
+        int i;
+
+        if (index->postings_size == 0)
+        {
+                return (-1);
+        }
+        i = dxf_text_index_hash (index, trigram);
+        while (index->slots[i] != 0)
+        {
+                if (index->postings[index->slots[i] - 1].trigram == trigram)
+                {
+                        return (index->slots[i] - 1);
+                }
+                i = (i + 1) & (2 * index->postings_size - 1);
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Double the number of posting lists a text index can hold and
+ * rehash.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_text_index_grow
+(
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+        DxfTextIndexPosting *postings;
+        int *slots;
+        int size;
+        int i;
+        int j;
+
+        size = (index->postings_size == 0) ? 64 : 2 * index->postings_size;
+        postings = realloc (index->postings, size * sizeof (DxfTextIndexPosting));
+        if (postings == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        index->postings = postings;
+        slots = calloc (2 * size, sizeof (int));
+        if (slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (index->slots);
+        index->slots = slots;
+        index->postings_size = size;
+        for (i = 0; i < index->number_of_postings; i++)
+        {
+                j = dxf_text_index_hash (index, index->postings[i].trigram);
+                while (index->slots[j] != 0)
+                {
+                        j = (j + 1) & (2 * size - 1);
+                }
+                index->slots[j] = i + 1;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an entry to the posting list of a trigram, create the
+ * posting list when the trigram is not in the index yet.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_text_index_post
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        uint32_t trigram,
+                /*!< the trigram. */
+        int id
+                /*!< id of the entry. */
+)
+{
+        DxfTextIndexPosting *posting;
+        int *entries;
+        int size;
+        int i;
+
+        i = dxf_text_index_find_posting (index, trigram);
+        if (i < 0)
+        {
+                if ((index->number_of_postings == index->postings_size)
+                  && (dxf_text_index_grow (index) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                i = index->number_of_postings;
+                index->postings[i].trigram = trigram;
+                index->postings[i].entries = NULL;
+                index->postings[i].number_of_entries = 0;
+                index->postings[i].entries_size = 0;
+                index->number_of_postings++;
+                size = dxf_text_index_hash (index, trigram);
+                while (index->slots[size] != 0)
+                {
+                        size = (size + 1) & (2 * index->postings_size - 1);
+                }
+                index->slots[size] = i + 1;
+        }
+        posting = &index->postings[i];
+        /* Entries are added in ascending order, a trigram occurring
+         * twice in a string is posted once. */
+        if ((posting->number_of_entries > 0)
+          && (posting->entries[posting->number_of_entries - 1] == id))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (posting->number_of_entries == posting->entries_size)
+        {
+                size = (posting->entries_size == 0) ? 4 : 2 * posting->entries_size;
+                entries = realloc (posting->entries, size * sizeof (int));
+                if (entries == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                posting->entries = entries;
+                posting->entries_size = size;
+        }
+        posting->entries[posting->number_of_entries] = id;
+        posting->number_of_entries++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Fold a pattern into a key, with the start and end of string
+ * markers as requested.
+ *
+ * \return a pointer to the key, to be freed by the caller, or \c NULL
+ * when an error occurred.
+ */
+static char *
+dxf_text_index_key
+(
+        const char *string,
+                /*!< the string. */
+        int mark_start,
+                /*!< prepend a start of string marker. */
+        int mark_end
+                /*!< append an end of string marker. */
+)
+{
+        char *key;
+        size_t i = 0;
+
+        key = malloc (strlen (string) + 3);
+        if (key == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (mark_start)
+        {
+                key[i++] = '\x02';
+        }
+        for (; *string != '\0'; string++)
+        {
+                key[i++] = (char) dxf_text_index_fold (*string);
+        }
+        if (mark_end)
+        {
+                key[i++] = '\x03';
+        }
+        key[i] = '\0';
+        return (key);
+}
+
+
+/*!
+ * \brief Compose the trigram starting at \c key.
+ */
+static uint32_t
+dxf_text_index_trigram
+(
+        const char *key
+                /*!< the folded key, at least three characters long. */
+)
+{
+        return (((uint32_t) (unsigned char) key[0] << 16)
+          | ((uint32_t) (unsigned char) key[1] << 8)
+          | (uint32_t) (unsigned char) key[2]);
+}
+
+
+/*!
+ * \brief Test if a string starts with a pattern, ignoring case.
+ */
+static int
+dxf_text_index_starts_with
+(
+        const char *string,
+                /*!< the string. */
+        const char *pattern
+                /*!< the pattern. */
+)
+{
+        for (; *pattern != '\0'; string++, pattern++)
+        {
+                if (dxf_text_index_fold (*string) != dxf_text_index_fold (*pattern))
+                {
+                        return (FALSE);
+                }
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Test if a string matches a pattern, ignoring case.
+ */
+static int
+dxf_text_index_matches
+(
+        const char *string,
+                /*!< the string. */
+        const char *pattern,
+                /*!< the pattern. */
+        DxfTextIndexMatch match
+                /*!< how to match. */
+)
+{
+        switch (match)
+        {
+                case DXF_TEXT_INDEX_MATCH_PREFIX:
+                        return (dxf_text_index_starts_with (string, pattern));
+                case DXF_TEXT_INDEX_MATCH_EXACT:
+                        return ((strlen (string) == strlen (pattern))
+                          && (dxf_text_index_starts_with (string, pattern)));
+                default:
+                        for (; *string != '\0'; string++)
+                        {
+                                if (dxf_text_index_starts_with (string, pattern))
+                                {
+                                        return (TRUE);
+                                }
+                        }
+                        return (*pattern == '\0');
+        }
+}
+
+
+/*!
+ * \brief Search a text index.
+ *
+ * When \c handles is not \c NULL an entity matching with more than one
+ * string is counted once.
+ *
+ * \return the number of matches, or -1 when an error occurred.
+ */
+static int
+dxf_text_index_search
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        const char *pattern,
+                /*!< the pattern. */
+        DxfTextIndexMatch match,
+                /*!< how to match. */
+        int *ids,
+                /*!< receives the ids of the matching entries, or
+                 * \c NULL. */
+        DxfHandle *handles,
+                /*!< receives the handles of the matching entities, or
+                 * \c NULL. */
+        int max
+                /*!< number of items \c ids or \c handles can hold. */
+)
+{
+        DxfTextIndexPosting *posting = NULL;
+        DxfHandle last = DXF_HANDLE_NONE;
+        char *key;
+        size_t length;
+        size_t i;
+        int count = 0;
+        int number_of_candidates;
+        int candidate;
+        int id;
+        int j;
+
+        key = dxf_text_index_key (pattern,
+          (match != DXF_TEXT_INDEX_MATCH_SUBSTRING),
+          (match == DXF_TEXT_INDEX_MATCH_EXACT));
+        if (key == NULL)
+        {
+                return (-1);
+        }
+        /* Verify the entries of the rarest trigram of the key only. */
+        length = strlen (key);
+        for (i = 0; i + 3 <= length; i++)
+        {
+                j = dxf_text_index_find_posting (index, dxf_text_index_trigram (key + i));
+                if (j < 0)
+                {
+                        free (key);
+                        return (0);
+                }
+                if ((posting == NULL)
+                  || (index->postings[j].number_of_entries < posting->number_of_entries))
+                {
+                        posting = &index->postings[j];
+                }
+        }
+        free (key);
+        number_of_candidates = (posting == NULL) ? index->number_of_entries : posting->number_of_entries;
+        for (candidate = 0; candidate < number_of_candidates; candidate++)
+        {
+                id = (posting == NULL) ? candidate : posting->entries[candidate];
+                if (!dxf_text_index_matches (index->entries[id].string, pattern, match))
+                {
+                        continue;
+                }
+                if (handles != NULL)
+                {
+                        /* The strings of an entity are adjacent. */
+                        if ((count > 0)
+                          && (index->entries[id].handle == last))
+                        {
+                                continue;
+                        }
+                        last = index->entries[id].handle;
+                        if (count < max)
+                        {
+                                handles[count] = last;
+                        }
+                }
+                else if ((ids != NULL)
+                  && (count < max))
+                {
+                        ids[count] = id;
+                }
+                count++;
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Append a string to a growable buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_text_index_append
+(
+        char **buffer,
+                /*!< the buffer. */
+        size_t *length,
+                /*!< number of characters in \c buffer. */
+        size_t *size,
+                /*!< number of bytes allocated for \c buffer. */
+        const char *string
+                /*!< the string to append. */
+)
+{
+        char *grown;
+        size_t n;
+
+        n = strlen (string);
+        if (*length + n + 1 > *size)
+        {
+                *size = (*size == 0) ? DXF_MAX_STRING_LENGTH : *size;
+                while (*length + n + 1 > *size)
+                {
+                        *size *= 2;
+                }
+                grown = realloc (*buffer, *size);
+                if (grown == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *buffer = grown;
+        }
+        memcpy (*buffer + *length, string, n + 1);
+        *length += n;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfTextIndex.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfTextIndex *
+dxf_text_index_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTextIndex *index = NULL;
+        size_t size;
+
+        size = sizeof (DxfTextIndex);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((index = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfTextIndex struct.\n")),
+                  __FUNCTION__);
+                index = NULL;
+        }
+        else
+        {
+                memset (index, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfTextIndex.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfTextIndex *
+dxf_text_index_init
+(
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                index = dxf_text_index_new ();
+        }
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        index->entries = NULL;
+        index->number_of_entries = 0;
+        index->entries_size = 0;
+        index->postings = NULL;
+        index->number_of_postings = 0;
+        index->postings_size = 0;
+        index->slots = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfTextIndex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_free
+(
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < index->number_of_entries; i++)
+        {
+                free (index->entries[i].string);
+        }
+        for (i = 0; i < index->number_of_postings; i++)
+        {
+                free (index->postings[i].entries);
+        }
+        free (index->entries);
+        free (index->postings);
+        free (index->slots);
+        free (index);
+        index = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Strip the formatting codes from an \c MTEXT string.
+ *
+ * Paragraph breaks (\\P) and non breaking spaces (\\~) become spaces,
+ * font, height, color, alignment and other property codes, the
+ * underline, overline and strike-through toggles and the grouping
+ * braces are removed, escaped backslashes and braces become the
+ * literal character and stacked fractions (\\S1^2;) become "1/2".
+ *
+ * \return a pointer to the stripped string, to be freed by the
+ * caller, or \c NULL when an error occurred.
+ */
+char *
+dxf_text_index_strip_mtext
+(
+        const char *text
+                /*!< the \c MTEXT string. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *stripped;
+        char *s;
+
+        /* Do some basic checks. */
+        if (text == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        stripped = malloc (strlen (text) + 1);
+        if (stripped == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        s = stripped;
+        while (*text != '\0')
+        {
+                if ((*text == '{')
+                  || (*text == '}'))
+                {
+                        text++;
+                        continue;
+                }
+                if ((*text != '\\')
+                  || (text[1] == '\0'))
+                {
+                        *s++ = *text++;
+                        continue;
+                }
+                text++;
+                switch (*text)
+                {
+                        case 'P':
+                        case 'X':
+                        case '~':
+                                *s++ = ' ';
+                                text++;
+                                break;
+                        case '\\':
+                        case '{':
+                        case '}':
+                                *s++ = *text++;
+                                break;
+                        case 'L':
+                        case 'l':
+                        case 'O':
+                        case 'o':
+                        case 'K':
+                        case 'k':
+                                text++;
+                                break;
+                        case 'A':
+                        case 'C':
+                        case 'c':
+                        case 'F':
+                        case 'f':
+                        case 'H':
+                        case 'p':
+                        case 'Q':
+                        case 'T':
+                        case 'W':
+                                /* Property code, terminated by a ';'. */
+                                while ((*text != '\0')
+                                  && (*text != ';'))
+                                {
+                                        text++;
+                                }
+                                if (*text == ';')
+                                {
+                                        text++;
+                                }
+                                break;
+                        case 'S':
+                                text++;
+                                while ((*text != '\0')
+                                  && (*text != ';'))
+                                {
+                                        *s++ = ((*text == '^') || (*text == '#')) ? '/' : *text;
+                                        text++;
+                                }
+                                if (*text == ';')
+                                {
+                                        text++;
+                                }
+                                break;
+                        default:
+                                /* Keep unknown codes, e.g. \U+nnnn. */
+                                *s++ = '\\';
+                                break;
+                }
+        }
+        *s = '\0';
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (stripped);
+}
+
+
+/*!
+ * \brief Add a string of an entity to a \c DxfTextIndex.
+ *
+ * The string is copied as is, empty strings are not added.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_add
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        DxfHandle handle,
+                /*!< handle of the entity. */
+        DxfEntityType type,
+                /*!< type of the entity. */
+        DxfTextIndexField field,
+                /*!< field of the entity the string was taken from. */
+        const char *string
+                /*!< the string. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTextIndexEntry *entries;
+        char *key;
+        size_t i;
+        int size;
+        int id;
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (string == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (string[0] == '\0')
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (index->number_of_entries == index->entries_size)
+        {
+                size = (index->entries_size == 0) ? 64 : 2 * index->entries_size;
+                entries = realloc (index->entries, size * sizeof (DxfTextIndexEntry));
+                if (entries == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                index->entries = entries;
+                index->entries_size = size;
+        }
+        key = dxf_text_index_key (string, TRUE, TRUE);
+        if (key == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        id = index->number_of_entries;
+        index->entries[id].handle = handle;
+        index->entries[id].type = type;
+        index->entries[id].field = field;
+        index->entries[id].string = strdup (string);
+        if (index->entries[id].string == NULL)
+        {
+                free (key);
+                return (EXIT_FAILURE);
+        }
+        index->number_of_entries++;
+        for (i = 0; key[i + 1] != '\0' && key[i + 2] != '\0'; i++)
+        {
+                if (dxf_text_index_post (index, dxf_text_index_trigram (key + i), id) == EXIT_FAILURE)
+                {
+                        status = EXIT_FAILURE;
+                        break;
+                }
+        }
+        free (key);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/*!
+ * \brief Add the strings of the \c TEXT, \c MTEXT, \c ATTRIB and
+ * \c ATTDEF entities in a \c DxfEntities container to a
+ * \c DxfTextIndex.
+ *
+ * Entities without a handle are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_add_entities
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfText *text;
+        DxfMtext *mtext;
+        DxfAttrib *attrib;
+        DxfAttdef *attdef;
+        char *stripped;
+        int status;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (text = (DxfText *) entities->text_list; text != NULL; text = (DxfText *) text->next)
+        {
+                if ((text->common.id_code != 0)
+                  && (text->text_value != NULL)
+                  && (dxf_text_index_add (index, text->common.id_code,
+                  TEXT, DXF_TEXT_INDEX_FIELD_VALUE, text->text_value) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (mtext = (DxfMtext *) entities->mtext_list; mtext != NULL; mtext = (DxfMtext *) mtext->next)
+        {
+                if ((mtext->common.id_code == 0)
+                  || (mtext->text_value == NULL))
+                {
+                        continue;
+                }
+                stripped = dxf_text_index_strip_mtext (mtext->text_value);
+                if (stripped == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                status = dxf_text_index_add (index, mtext->common.id_code,
+                  MTEXT, DXF_TEXT_INDEX_FIELD_VALUE, stripped);
+                free (stripped);
+                if (status == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (attrib = (DxfAttrib *) entities->attrib_list; attrib != NULL; attrib = (DxfAttrib *) attrib->next)
+        {
+                if (attrib->common.id_code == 0)
+                {
+                        continue;
+                }
+                if (((attrib->tag_value != NULL)
+                  && (dxf_text_index_add (index, attrib->common.id_code,
+                  ATTRIB, DXF_TEXT_INDEX_FIELD_TAG, attrib->tag_value) == EXIT_FAILURE))
+                  || ((attrib->default_value != NULL)
+                  && (dxf_text_index_add (index, attrib->common.id_code,
+                  ATTRIB, DXF_TEXT_INDEX_FIELD_VALUE, attrib->default_value) == EXIT_FAILURE)))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (attdef = (DxfAttdef *) entities->attdef_list; attdef != NULL; attdef = (DxfAttdef *) attdef->next)
+        {
+                if (attdef->common.id_code == 0)
+                {
+                        continue;
+                }
+                if (((attdef->tag_value != NULL)
+                  && (dxf_text_index_add (index, attdef->common.id_code,
+                  ATTDEF, DXF_TEXT_INDEX_FIELD_TAG, attdef->tag_value) == EXIT_FAILURE))
+                  || ((attdef->default_value != NULL)
+                  && (dxf_text_index_add (index, attdef->common.id_code,
+                  ATTDEF, DXF_TEXT_INDEX_FIELD_VALUE, attdef->default_value) == EXIT_FAILURE)))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Scan a DXF section for text strings.
+ *
+ * The file is expected to be positioned just after the
+ * "  2\n<section name>" lines, both the \c ENTITIES and the \c BLOCKS
+ * section can be scanned.\n
+ * The strings of every \c TEXT (group code 1), \c MTEXT (group codes 3
+ * and 1, formatting codes stripped), \c ATTRIB and \c ATTDEF (group
+ * codes 2 and 1) and \c TOLERANCE (group code 1, formatting codes
+ * stripped) entity with a handle are added, up to and including the
+ * \c ENDSEC marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_scan
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char tag[DXF_MAX_STRING_LENGTH];
+        char *text = NULL;
+        char *stripped;
+        size_t text_length = 0;
+        size_t text_size = 0;
+        DxfHandle handle = DXF_HANDLE_NONE;
+        DxfEntityType type = UNKNOWN_ENTITY;
+        int embedded = FALSE;
+        int group_code;
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((fp == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tag[0] = '\0';
+        for (;;)
+        {
+                if ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                  || (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        status = EXIT_FAILURE;
+                        break;
+                }
+                fp->line_number += 2;
+                group_code = atoi (code);
+                if (group_code == 0)
+                {
+                        /* The handle of the entity is known now. */
+                        if ((handle != DXF_HANDLE_NONE)
+                          && ((type == ATTRIB) || (type == ATTDEF))
+                          && (dxf_text_index_add (index, handle, type,
+                          DXF_TEXT_INDEX_FIELD_TAG, tag) == EXIT_FAILURE))
+                        {
+                                status = EXIT_FAILURE;
+                                break;
+                        }
+                        if ((handle != DXF_HANDLE_NONE)
+                          && (text_length > 0))
+                        {
+                                if ((type == MTEXT) || (type == TOLERANCE))
+                                {
+                                        stripped = dxf_text_index_strip_mtext (text);
+                                        status = (stripped == NULL) ? EXIT_FAILURE
+                                          : dxf_text_index_add (index, handle, type, DXF_TEXT_INDEX_FIELD_VALUE, stripped);
+                                        free (stripped);
+                                }
+                                else
+                                {
+                                        status = dxf_text_index_add (index, handle, type, DXF_TEXT_INDEX_FIELD_VALUE, text);
+                                }
+                                if (status == EXIT_FAILURE)
+                                {
+                                        break;
+                                }
+                        }
+                        if (strcmp (value, "ENDSEC") == 0)
+                        {
+                                break;
+                        }
+                        type = dxf_entity_get_type (value);
+                        if ((type != TEXT)
+                          && (type != MTEXT)
+                          && (type != ATTRIB)
+                          && (type != ATTDEF)
+                          && (type != TOLERANCE))
+                        {
+                                type = UNKNOWN_ENTITY;
+                        }
+                        handle = DXF_HANDLE_NONE;
+                        tag[0] = '\0';
+                        text_length = 0;
+                        embedded = FALSE;
+                        continue;
+                }
+                if ((type == UNKNOWN_ENTITY)
+                  || (embedded))
+                {
+                        continue;
+                }
+                switch (group_code)
+                {
+                        case 5:
+                                handle = dxf_handle_parse (value);
+                                break;
+                        case 101:
+                                /* Skip the embedded MTEXT of a multiline
+                                 * attribute. */
+                                embedded = TRUE;
+                                break;
+                        case 2:
+                                strcpy (tag, value);
+                                break;
+                        case 3:
+                                if (type != MTEXT)
+                                {
+                                        break;
+                                }
+                                status = dxf_text_index_append (&text, &text_length, &text_size, value);
+                                break;
+                        case 1:
+                                if (type != MTEXT)
+                                {
+                                        text_length = 0;
+                                }
+                                status = dxf_text_index_append (&text, &text_length, &text_size, value);
+                                break;
+                }
+                if (status == EXIT_FAILURE)
+                {
+                        break;
+                }
+        }
+        free (text);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/*!
+ * \brief Get the number of strings in a \c DxfTextIndex.
+ *
+ * \return the number of strings, or -1 when an error occurred.
+ */
+int
+dxf_text_index_get_number_of_entries
+(
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (index->number_of_entries);
+}
+
+
+/*!
+ * \brief Get an entry of a \c DxfTextIndex.
+ *
+ * \return a pointer to the entry, or \c NULL when an error occurred.
+ */
+DxfTextIndexEntry *
+dxf_text_index_get_entry
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        int id
+                /*!< id of the entry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((id < 0)
+          || (id >= index->number_of_entries))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&index->entries[id]);
+}
+
+
+/*!
+ * \brief Find the strings matching a pattern in a \c DxfTextIndex.
+ *
+ * At most \c max_ids entry ids are stored in \c ids, in ascending
+ * order.
+ *
+ * \return the number of matching strings, which may be more than
+ * \c max_ids, or -1 when an error occurred.
+ */
+int
+dxf_text_index_find
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        const char *pattern,
+                /*!< the pattern. */
+        DxfTextIndexMatch match,
+                /*!< how to match. */
+        int *ids,
+                /*!< receives the ids of the matching entries, may be
+                 * \c NULL when \c max_ids is 0. */
+        int max_ids
+                /*!< number of ids \c ids can hold. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (pattern == NULL)
+          || ((ids == NULL) && (max_ids > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_text_index_search (index, pattern, match, ids, NULL, max_ids));
+}
+
+
+/*!
+ * \brief Find the entities with a string matching a pattern in a
+ * \c DxfTextIndex.
+ *
+ * At most \c max_handles handles are stored in \c handles, an entity
+ * with more than one matching string (an attribute matching with both
+ * its tag and its value) is stored once.
+ *
+ * \return the number of matching entities, which may be more than
+ * \c max_handles, or -1 when an error occurred.
+ */
+int
+dxf_text_index_find_handles
+(
+        DxfTextIndex *index,
+                /*!< a pointer to a text index. */
+        const char *pattern,
+                /*!< the pattern. */
+        DxfTextIndexMatch match,
+                /*!< how to match. */
+        DxfHandle *handles,
+                /*!< receives the handles of the matching entities,
+                 * may be \c NULL when \c max_handles is 0. */
+        int max_handles
+                /*!< number of handles \c handles can hold. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandle dummy;
+
+        /* Do some basic checks. */
+        if ((index == NULL)
+          || (pattern == NULL)
+          || ((handles == NULL) && (max_handles > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_text_index_search (index, pattern, match, NULL,
+          (handles == NULL) ? &dummy : handles, max_handles));
+}
+
+
+/*!
+ * \brief Write a \c DxfTextIndex to a file.
+ *
+ * The index is written as a \c TEXTINDEX section of group code and
+ * value pairs, one item per string with the entity name, the handle
+ * (group code 5), the field (group code 70) and the string, divided
+ * into 250-character chunks like an \c MTEXT string (group codes 3
+ * and 1).\n
+ * The file is meant to be stored next to the drawing, the posting
+ * lists are rebuilt by dxf_text_index_read () without rescanning the
+ * drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTextIndexEntry *entry;
+        const char *string;
+        char *handle;
+        size_t length;
+        int i;
+
+        /* Do some basic checks. */
+        if ((fp == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp->fp, "  0\nSECTION\n  2\nTEXTINDEX\n");
+        for (i = 0; i < index->number_of_entries; i++)
+        {
+                entry = &index->entries[i];
+                handle = dxf_handle_to_string (entry->handle);
+                if (handle == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                fprintf (fp->fp, "  0\n%s\n", dxf_entity_get_name (entry->type));
+                fprintf (fp->fp, "  5\n%s\n", handle);
+                fprintf (fp->fp, " 70\n%d\n", entry->field);
+                free (handle);
+                string = entry->string;
+                length = strlen (string);
+                while (length > DXF_TEXT_INDEX_CHUNK_LENGTH)
+                {
+                        fprintf (fp->fp, "  3\n%.*s\n", DXF_TEXT_INDEX_CHUNK_LENGTH, string);
+                        string += DXF_TEXT_INDEX_CHUNK_LENGTH;
+                        length -= DXF_TEXT_INDEX_CHUNK_LENGTH;
+                }
+                fprintf (fp->fp, "  1\n%s\n", string);
+        }
+        fprintf (fp->fp, "  0\nENDSEC\n");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (ferror (fp->fp) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a \c DxfTextIndex written by dxf_text_index_write ().
+ *
+ * The file is expected to be positioned just after the
+ * "  2\nTEXTINDEX" lines, the strings are added to \c index up to and
+ * including the \c ENDSEC marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char *text = NULL;
+        size_t text_length = 0;
+        size_t text_size = 0;
+        DxfHandle handle = DXF_HANDLE_NONE;
+        DxfEntityType type = UNKNOWN_ENTITY;
+        int field = DXF_TEXT_INDEX_FIELD_VALUE;
+        int group_code;
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((fp == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (;;)
+        {
+                if ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
+                  || (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        status = EXIT_FAILURE;
+                        break;
+                }
+                fp->line_number += 2;
+                group_code = atoi (code);
+                if (group_code == 0)
+                {
+                        if ((text_length > 0)
+                          && (dxf_text_index_add (index, handle, type, field, text) == EXIT_FAILURE))
+                        {
+                                status = EXIT_FAILURE;
+                                break;
+                        }
+                        if (strcmp (value, "ENDSEC") == 0)
+                        {
+                                break;
+                        }
+                        type = dxf_entity_get_type (value);
+                        handle = DXF_HANDLE_NONE;
+                        field = DXF_TEXT_INDEX_FIELD_VALUE;
+                        text_length = 0;
+                }
+                else if (group_code == 5)
+                {
+                        handle = dxf_handle_parse (value);
+                }
+                else if (group_code == 70)
+                {
+                        field = atoi (value);
+                }
+                else if (((group_code == 1) || (group_code == 3))
+                  && (dxf_text_index_append (&text, &text_length, &text_size, value) == EXIT_FAILURE))
+                {
+                        status = EXIT_FAILURE;
+                        break;
+                }
+        }
+        free (text);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/*!
+ * \brief Write a \c DxfTextIndex to a file with the name
+ * \c filename, e.g. the name of the drawing with a ".dxi" suffix.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_write_file
+(
+        const char *filename,
+                /*!< filename of the index file. */
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile file;
+        int status;
+
+        /* Do some basic checks. */
+        if ((filename == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&file, 0, sizeof (DxfFile));
+        file.fp = fopen (filename, "w");
+        if (file.fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                return (EXIT_FAILURE);
+        }
+        file.filename = (char *) filename;
+        status = dxf_text_index_write (&file, index);
+        fprintf (file.fp, "  0\nEOF\n");
+        if (fclose (file.fp) != 0)
+        {
+                status = EXIT_FAILURE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/*!
+ * \brief Read a \c DxfTextIndex from a file written by
+ * dxf_text_index_write_file ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_text_index_read_file
+(
+        const char *filename,
+                /*!< filename of the index file. */
+        DxfTextIndex *index
+                /*!< a pointer to a text index. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *fp = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int status = EXIT_FAILURE;
+
+        /* Do some basic checks. */
+        if ((filename == NULL)
+          || (index == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        while ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS)
+          && (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS))
+        {
+                fp->line_number += 2;
+                if ((atoi (code) == 2)
+                  && (strcmp (value, "TEXTINDEX") == 0))
+                {
+                        status = dxf_text_index_read (fp, index);
+                        break;
+                }
+        }
+        if (status == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () no TEXTINDEX section read from: %s.\n")),
+                  __FUNCTION__, filename);
+        }
+        dxf_read_close (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,181 @@
+/*!
+ * \file text_index.h
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a full-text index over the text strings of a
+ * DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TEXT_INDEX_H
+#define LIBDXF_SRC_TEXT_INDEX_H
+
+
+#include "global.h"
+#include "entity.h"
+#include "entities.h"
+#include "handle.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Fields of an entity stored in a \c DxfTextIndex.
+ */
+typedef enum
+dxf_text_index_field
+{
+        DXF_TEXT_INDEX_FIELD_VALUE,
+                /*!< Text string or attribute value (group codes 1
+                 * and 3). */
+        DXF_TEXT_INDEX_FIELD_TAG
+                /*!< Attribute tag (group code 2). */
+} DxfTextIndexField;
+
+
+/*!
+ * \brief How a pattern is matched against the strings of a
+ * \c DxfTextIndex.
+ *
+ * Matching is case insensitive.
+ */
+typedef enum
+dxf_text_index_match
+{
+        DXF_TEXT_INDEX_MATCH_SUBSTRING,
+                /*!< The pattern occurs anywhere in the string. */
+        DXF_TEXT_INDEX_MATCH_PREFIX,
+                /*!< The string starts with the pattern. */
+        DXF_TEXT_INDEX_MATCH_EXACT
+                /*!< The string equals the pattern. */
+} DxfTextIndexMatch;
+
+
+/*!
+ * \brief String of an entity in a \c DxfTextIndex.
+ */
+typedef struct
+dxf_text_index_entry_struct
+{
+        DxfHandle handle;
+                /*!< Handle of the entity. */
+        DxfEntityType type;
+                /*!< Type of the entity. */
+        DxfTextIndexField field;
+                /*!< Field of the entity the string was taken from. */
+        char *string;
+                /*!< The string, with \c MTEXT formatting codes
+                 * stripped. */
+} DxfTextIndexEntry;
+
+
+/*!
+ * \brief Posting list of a trigram in a \c DxfTextIndex.
+ */
+typedef struct
+dxf_text_index_posting_struct
+{
+        uint32_t trigram;
+                /*!< Three upper case bytes, the start of a string is
+                 * marked with a \c 0x02 byte and the end of a string
+                 * with a \c 0x03 byte. */
+        int *entries;
+                /*!< Ids of the entries containing \c trigram, in
+                 * ascending order without duplicates. */
+        int number_of_entries;
+                /*!< Number of items in use in \c entries. */
+        int entries_size;
+                /*!< Number of items allocated for \c entries. */
+} DxfTextIndexPosting;
+
+
+/*!
+ * \brief Full-text index over the \c TEXT, \c MTEXT, \c ATTRIB,
+ * \c ATTDEF and \c TOLERANCE strings of a DXF drawing.
+ *
+ * Every string is split into trigrams, each trigram has a posting list
+ * with the entries containing it, so a substring, prefix or exact
+ * query only verifies the entries of its rarest trigram instead of
+ * rescanning all strings.\n
+ * Patterns too short to contain a trigram are matched against all
+ * entries.
+ */
+typedef struct
+dxf_text_index_struct
+{
+        DxfTextIndexEntry *entries;
+                /*!< Contiguous array with the entries in the order
+                 * they were added. */
+        int number_of_entries;
+                /*!< Number of items in use in \c entries. */
+        int entries_size;
+                /*!< Number of items allocated for \c entries. */
+        DxfTextIndexPosting *postings;
+                /*!< Contiguous array with the posting lists. */
+        int number_of_postings;
+                /*!< Number of items in use in \c postings. */
+        int postings_size;
+                /*!< Number of items allocated for \c postings. */
+        int *slots;
+                /*!< Open addressing hash of \c 2 * \c postings_size
+                 * slots holding a posting id + 1, 0 for an empty
+                 * slot. */
+} DxfTextIndex;
+
+
+DxfTextIndex *dxf_text_index_new ();
+DxfTextIndex *dxf_text_index_init (DxfTextIndex *index);
+int dxf_text_index_free (DxfTextIndex *index);
+char *dxf_text_index_strip_mtext (const char *text);
+int dxf_text_index_add (DxfTextIndex *index, DxfHandle handle, DxfEntityType type, DxfTextIndexField field, const char *string);
+int dxf_text_index_add_entities (DxfTextIndex *index, DxfEntities *entities);
+int dxf_text_index_scan (DxfFile *fp, DxfTextIndex *index);
+int dxf_text_index_get_number_of_entries (DxfTextIndex *index);
+DxfTextIndexEntry *dxf_text_index_get_entry (DxfTextIndex *index, int id);
+int dxf_text_index_find (DxfTextIndex *index, const char *pattern, DxfTextIndexMatch match, int *ids, int max_ids);
+int dxf_text_index_find_handles (DxfTextIndex *index, const char *pattern, DxfTextIndexMatch match, DxfHandle *handles, int max_handles);
+int dxf_text_index_write (DxfFile *fp, DxfTextIndex *index);
+int dxf_text_index_read (DxfFile *fp, DxfTextIndex *index);
+int dxf_text_index_write_file (const char *filename, DxfTextIndex *index);
+int dxf_text_index_read_file (const char *filename, DxfTextIndex *index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TEXT_INDEX_H */
+
+
+/* EOF */
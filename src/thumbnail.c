@@ -55,6 +55,293 @@
 
 
 #include "thumbnail.h"
+#include "entities.h"
+#include "util.h"
+
+
+#define DXF_THUMBNAIL_BLOCK_SIZE 65536
+        /*!< \brief Number of bytes read at once when a file is searched
+         * backwards for its last section. */
+#define DXF_THUMBNAIL_BLOCK_OVERLAP 256
+        /*!< \brief Number of bytes a block overlaps the block after it,
+         * enough for a section header split over two blocks. */
+
+
+/*!
+ * \brief Get the next line from an in-memory image of a DXF file.
+ *
+ * Leading and trailing white space (including a carriage return) is
+ * not part of the returned line.
+ *
+ * \return \c 1 when a line was found, \c 0 at the end of the data.
+ */
+static int
+dxf_thumbnail_next_line
+(
+        const char **pos,
+                /*!< current position, advanced past the line. */
+        const char *end,
+                /*!< end of the data. */
+        const char **line,
+                /*!< start of the line. */
+        size_t *length
+                /*!< length of the line. */
+)
+{
+        const char *p = *pos;
+        const char *e;
+
+        if (p >= end)
+        {
+                return (0);
+        }
+        e = memchr (p, '\n', end - p);
+        if (e == NULL)
+        {
+                e = end;
+        }
+        *pos = (e < end) ? e + 1 : end;
+        while ((p < e) && isspace ((unsigned char) *p))
+        {
+                p++;
+        }
+        while ((e > p) && isspace ((unsigned char) e[-1]))
+        {
+                e--;
+        }
+        *line = p;
+        *length = e - p;
+        return (1);
+}
+
+
+/*!
+ * \brief Test if a line equals a string.
+ */
+static int
+dxf_thumbnail_line_is
+(
+        const char *line,
+                /*!< start of the line. */
+        size_t length,
+                /*!< length of the line. */
+        const char *string
+                /*!< string to compare with. */
+)
+{
+        return ((strlen (string) == length)
+          && (memcmp (line, string, length) == 0));
+}
+
+
+/*!
+ * \brief Find the header of the last section in a part of a DXF file.
+ *
+ * The data is searched backwards for a \c SECTION line preceded by a
+ * \c 0 group code line.\n
+ * When the header is found and names a \c THUMBNAILIMAGE section,
+ * \c offset is set to the first byte after the section name.
+ *
+ * \return \c 1 when the last section is a \c THUMBNAILIMAGE section,
+ * \c 0 when the last section is another section, or \c -1 when no
+ * complete section header was found.
+ */
+static int
+dxf_thumbnail_find_last_section
+(
+        const char *data,
+                /*!< part of the DXF file. */
+        size_t size,
+                /*!< size of \c data in bytes. */
+        int at_start,
+                /*!< \c data starts at the start of the file. */
+        size_t *offset
+                /*!< offset in \c data of the first byte after the
+                 * section name. */
+)
+{
+        const char *pos;
+        const char *code;
+        const char *value;
+        size_t code_length;
+        size_t value_length;
+        size_t i;
+        size_t p;
+        size_t q;
+        size_t r;
+        size_t e;
+
+        for (i = size; i >= 7; i--)
+        {
+                p = i - 7;
+                if (memcmp (data + p, "SECTION", 7) != 0)
+                {
+                        continue;
+                }
+                /* The value has to be a line of its own. */
+                r = p + 7;
+                while ((r < size) && ((data[r] == ' ') || (data[r] == '\t') || (data[r] == '\r')))
+                {
+                        r++;
+                }
+                if ((r >= size) || (data[r] != '\n'))
+                {
+                        continue;
+                }
+                q = p;
+                while ((q > 0) && ((data[q - 1] == ' ') || (data[q - 1] == '\t')))
+                {
+                        q--;
+                }
+                if ((q > 0) && (data[q - 1] != '\n'))
+                {
+                        continue;
+                }
+                if ((q == 0) && (!at_start))
+                {
+                        return (-1);
+                }
+                if (q == 0)
+                {
+                        continue;
+                }
+                /* The line before has to be a 0 group code. */
+                e = q - 1;
+                while ((e > 0) && isspace ((unsigned char) data[e - 1]))
+                {
+                        e--;
+                }
+                q = e;
+                while ((q > 0) && (data[q - 1] != '\n'))
+                {
+                        q--;
+                }
+                if ((q == 0) && (!at_start))
+                {
+                        return (-1);
+                }
+                while ((q < e) && isspace ((unsigned char) data[q]))
+                {
+                        q++;
+                }
+                if (!dxf_thumbnail_line_is (data + q, e - q, "0"))
+                {
+                        continue;
+                }
+                /* The last section header, check its name. */
+                pos = data + r + 1;
+                if (dxf_thumbnail_next_line (&pos, data + size, &code, &code_length)
+                  && dxf_thumbnail_next_line (&pos, data + size, &value, &value_length)
+                  && dxf_thumbnail_line_is (code, code_length, "2")
+                  && dxf_thumbnail_line_is (value, value_length, "THUMBNAILIMAGE"))
+                {
+                        *offset = pos - data;
+                        return (1);
+                }
+                return (0);
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Find the \c THUMBNAILIMAGE section of a DXF file searching
+ * backwards from the end of the file.
+ *
+ * The file is read in blocks from its end, until the header of the
+ * last section is found.
+ *
+ * \return the byte offset of the first group code inside the
+ * \c THUMBNAILIMAGE section, or \c -1 when the last section is another
+ * section, the file can not be positioned or an error occurred.
+ */
+static long
+dxf_thumbnail_find_backwards
+(
+        FILE *stream
+                /*!< the DXF file. */
+)
+{
+        char *block;
+        long size;
+        long start = 0;
+        long end;
+        size_t length;
+        size_t offset = 0;
+        int found = -1;
+
+        if (fseek (stream, 0, SEEK_END) != 0)
+        {
+                return (-1);
+        }
+        size = ftell (stream);
+        if (size < 0)
+        {
+                return (-1);
+        }
+        block = malloc (DXF_THUMBNAIL_BLOCK_SIZE + DXF_THUMBNAIL_BLOCK_OVERLAP);
+        if (block == NULL)
+        {
+                return (-1);
+        }
+        end = size;
+        while ((found < 0) && (end > 0))
+        {
+                start = (end > DXF_THUMBNAIL_BLOCK_SIZE) ? end - DXF_THUMBNAIL_BLOCK_SIZE : 0;
+                length = (size_t) (((end + DXF_THUMBNAIL_BLOCK_OVERLAP < size) ? end + DXF_THUMBNAIL_BLOCK_OVERLAP : size) - start);
+                if ((fseek (stream, start, SEEK_SET) != 0)
+                  || (fread (block, 1, length, stream) != length))
+                {
+                        break;
+                }
+                found = dxf_thumbnail_find_last_section (block, length, (start == 0), &offset);
+                end = start;
+        }
+        free (block);
+        return ((found == 1) ? start + (long) offset : -1);
+}
+
+
+/*!
+ * \brief Cap the number of bytes of a preview image to what the rest
+ * of a DXF file can hold.
+ *
+ * Every byte of the image takes two hexadecimal digits in the file.
+ *
+ * \return the smaller of \c number_of_bytes and half the number of
+ * bytes after the current position, or \c 0 when the file can not be
+ * positioned.
+ */
+static size_t
+dxf_thumbnail_cap_number_of_bytes
+(
+        FILE *stream,
+                /*!< the DXF file. */
+        int number_of_bytes
+                /*!< the number of bytes of the image (group code 90). */
+)
+{
+        long position;
+        long size;
+
+        position = ftell (stream);
+        if ((position < 0)
+          || (fseek (stream, 0, SEEK_END) != 0))
+        {
+                return (0);
+        }
+        size = ftell (stream);
+        if ((fseek (stream, position, SEEK_SET) != 0)
+          || (size < position))
+        {
+                return (0);
+        }
+        if ((size_t) number_of_bytes > (size_t) (size - position) / 2)
+        {
+                return ((size_t) (size - position) / 2);
+        }
+        return ((size_t) number_of_bytes);
+}
 
 
 /*!
@@ -129,8 +416,15 @@ dxf_thumbnail_init
         }
         thumbnail->number_of_bytes = 0;
         thumbnail->preview_image_data = NULL;
-        thumbnail->preview_image_data->length = 0;
-        thumbnail->preview_image_data->value = strdup ("");
+        thumbnail->image = dxf_binary_buffer_new ();
+        thumbnail->image = dxf_binary_buffer_init (thumbnail->image);
+        if (thumbnail->image == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -161,7 +455,7 @@ dxf_thumbnail_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -169,8 +463,6 @@ dxf_thumbnail_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (thumbnail == NULL)
@@ -180,6 +472,13 @@ dxf_thumbnail_read
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_init (thumbnail);
         }
+        if ((thumbnail == NULL) || (thumbnail->image == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (fp->acad_version_number < AutoCAD_2000)
         {
                 fprintf (stderr,
@@ -187,8 +486,11 @@ dxf_thumbnail_read
                   __FUNCTION__);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string) != 1)
+        {
+                temp_string[0] = '\0';
+        }
+        while ((strcmp (temp_string, "0") != 0) && !feof (fp->fp))
         {
                 if (ferror (fp->fp))
                 {
@@ -196,8 +498,6 @@ dxf_thumbnail_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "90") == 0)
@@ -206,14 +506,20 @@ dxf_thumbnail_read
                          * number of bytes value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &thumbnail->number_of_bytes);
+                        /* Make room for the whole image at once, but
+                         * never for more bytes than the rest of the
+                         * file can hold as hexadecimal digits. */
+                        if (thumbnail->number_of_bytes > 0)
+                        {
+                                dxf_binary_buffer_reserve (thumbnail->image,
+                                  dxf_thumbnail_cap_number_of_bytes (fp->fp, thumbnail->number_of_bytes));
+                        }
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, thumbnail->preview_image_data->value);
-                        /*! \todo preview_image_data needs a proper implementation. */
+                        /* Now follows a string containing image data,
+                         * decode it straight into the image buffer. */
+                        dxf_binary_buffer_read_line (fp, thumbnail->image);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -228,11 +534,20 @@ dxf_thumbnail_read
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                 }
+                (fp->line_number)++;
+                if (fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string) != 1)
+                {
+                        temp_string[0] = '\0';
+                }
         }
         /* Handle omitted members and/or illegal values. */
-        /*! \todo preview_image_data needs a proper checking for data length. */
-        /* Clean up. */
-        free (temp_string);
+        if ((size_t) thumbnail->number_of_bytes != thumbnail->image->length)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () expected %d bytes of image data, found %lu bytes.\n")),
+                  __FUNCTION__, thumbnail->number_of_bytes,
+                  (unsigned long) thumbnail->image->length);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -294,8 +609,15 @@ dxf_thumbnail_write
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         fprintf (fp->fp, " 90\n%d\n", thumbnail->number_of_bytes);
-        fprintf (fp->fp, "310\n%s\n", thumbnail->preview_image_data->value);
-        /*! \todo preview_image_data needs a proper implementation. */
+        if ((thumbnail->image != NULL)
+          && (thumbnail->image->length > 0))
+        {
+                dxf_binary_buffer_write (fp, 310, thumbnail->image);
+        }
+        else if (thumbnail->preview_image_data != NULL)
+        {
+                fprintf (fp->fp, "310\n%s\n", thumbnail->preview_image_data->value);
+        }
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -331,9 +653,15 @@ dxf_thumbnail_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (thumbnail->preview_image_data->value);
-        free (thumbnail->preview_image_data);
-        /*! \todo preview_image_data needs a proper implementation. */
+        if (thumbnail->preview_image_data != NULL)
+        {
+                free (thumbnail->preview_image_data->value);
+                free (thumbnail->preview_image_data);
+        }
+        if (thumbnail->image != NULL)
+        {
+                dxf_binary_buffer_free (thumbnail->image);
+        }
         free (thumbnail);
         thumbnail = NULL;
 #if DEBUG
@@ -770,4 +1098,303 @@ dxf_thumbnail_get_preview_image_data_last
 }
 
 
+/*!
+ * \brief Get the decoded preview image from a DXF \c THUMBNAILIMAGE
+ * object.
+ *
+ * \warning No copy is made of the image.
+ *
+ * \return \c image when sucessful, \c NULL when an error occurred.
+ */
+DxfBinaryBuffer *
+dxf_thumbnail_get_image
+(
+        DxfThumbnail *thumbnail
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (thumbnail == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (thumbnail->image == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (thumbnail->image);
+}
+
+
+/*!
+ * \brief Find the \c THUMBNAILIMAGE section in a DXF file.
+ *
+ * The \c THUMBNAILIMAGE section is the last section of a DXF file, so
+ * the file is searched backwards from its end first, up to the header
+ * of the last section.\n
+ * When the last section is another section or the file can not be
+ * positioned, the file is scanned from the current position as pairs
+ * of group code and value lines, without parsing any of the other
+ * sections.\n
+ * On success the file is positioned at the first group code inside the
+ * section, ready for dxf_thumbnail_read ().\n
+ * \c fp->line_number is not updated when the section was found
+ * backwards.
+ *
+ * \return the byte offset of the first group code inside the
+ * \c THUMBNAILIMAGE section, or \c -1 when the section was not found
+ * or an error occurred.
+ */
+long
+dxf_thumbnail_find
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int in_section_header = 0;
+        long position;
+        long offset;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        position = ftell (fp->fp);
+        if (position >= 0)
+        {
+                offset = dxf_thumbnail_find_backwards (fp->fp);
+                if ((offset >= position)
+                  && (fseek (fp->fp, offset, SEEK_SET) == 0))
+                {
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (offset);
+                }
+                /* Fall back to a forward scan. */
+                if (fseek (fp->fp, position, SEEK_SET) != 0)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not position file: %s.\n")),
+                          __FUNCTION__, fp->filename);
+                        return (-1);
+                }
+        }
+        while ((dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS)
+          && (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS))
+        {
+                fp->line_number += 2;
+                if ((atoi (code) == 0)
+                  && (strncmp (value, "SECTION", 7) == 0))
+                {
+                        in_section_header = 1;
+                        continue;
+                }
+                if ((in_section_header)
+                  && (atoi (code) == 2)
+                  && (strncmp (value, "THUMBNAILIMAGE", 14) == 0))
+                {
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (ftell (fp->fp));
+                }
+                in_section_header = 0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (-1);
+}
+
+
+/*!
+ * \brief Extract the preview image from a DXF file.
+ *
+ * Only the \c THUMBNAILIMAGE section is decoded, all other sections are
+ * skipped without being parsed.
+ *
+ * \return the decoded BMP or PNG image, to be freed with
+ * dxf_binary_buffer_free (), or \c NULL when the file contains no
+ * preview image or an error occurred.
+ */
+DxfBinaryBuffer *
+dxf_thumbnail_extract
+(
+        const char *filename
+                /*!< filename of the DXF file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *fp = NULL;
+        DxfThumbnail *thumbnail = NULL;
+        DxfBinaryBuffer *image = NULL;
+
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                return (NULL);
+        }
+        fp->acad_version_number = AutoCAD_2000;
+        if (dxf_thumbnail_find (fp) >= 0)
+        {
+                thumbnail = dxf_thumbnail_read (fp, dxf_thumbnail_init (dxf_thumbnail_new ()));
+        }
+        if (thumbnail != NULL)
+        {
+                /* Hand over the image buffer, no copy is made. */
+                image = thumbnail->image;
+                thumbnail->image = NULL;
+                dxf_thumbnail_free (thumbnail);
+        }
+        dxf_read_close (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (image);
+}
+
+
+/*!
+ * \brief Extract the preview image from an in-memory image of a DXF
+ * file.
+ *
+ * Works on any contiguous image of the file, e.g. a memory-mapped
+ * file, so the file is never copied: only the hexadecimal 310 values
+ * of the \c THUMBNAILIMAGE section are decoded into the returned
+ * buffer.
+ *
+ * \return the decoded BMP or PNG image, to be freed with
+ * dxf_binary_buffer_free (), or \c NULL when the data contains no
+ * preview image or an error occurred.
+ */
+DxfBinaryBuffer *
+dxf_thumbnail_extract_from_memory
+(
+        const char *data,
+                /*!< in-memory image of a DXF file. */
+        size_t size
+                /*!< size of \c data in bytes. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryBuffer *image = NULL;
+        const char *pos;
+        const char *end;
+        const char *code;
+        const char *value;
+        size_t code_length;
+        size_t value_length;
+        int in_section_header = 0;
+        int found = 0;
+        long number_of_bytes;
+        size_t offset = 0;
+
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        pos = data;
+        end = data + size;
+        /* Locate the THUMBNAILIMAGE section, backwards from the end
+         * first so that only the pages of the last section are
+         * touched. */
+        if (dxf_thumbnail_find_last_section (data, size, 1, &offset) == 1)
+        {
+                pos = data + offset;
+                found = 1;
+        }
+        while (!found
+          && dxf_thumbnail_next_line (&pos, end, &code, &code_length)
+          && dxf_thumbnail_next_line (&pos, end, &value, &value_length))
+        {
+                if (dxf_thumbnail_line_is (code, code_length, "0")
+                  && dxf_thumbnail_line_is (value, value_length, "SECTION"))
+                {
+                        in_section_header = 1;
+                        continue;
+                }
+                found = in_section_header
+                  && dxf_thumbnail_line_is (code, code_length, "2")
+                  && dxf_thumbnail_line_is (value, value_length, "THUMBNAILIMAGE");
+                in_section_header = 0;
+        }
+        if (!found)
+        {
+#if DEBUG
+                DXF_DEBUG_END
+#endif
+                return (NULL);
+        }
+        image = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+        if (image == NULL)
+        {
+                return (NULL);
+        }
+        /* Decode the section up to the next "  0" group code. */
+        while (dxf_thumbnail_next_line (&pos, end, &code, &code_length)
+          && dxf_thumbnail_next_line (&pos, end, &value, &value_length)
+          && !dxf_thumbnail_line_is (code, code_length, "0"))
+        {
+                if (dxf_thumbnail_line_is (code, code_length, "90"))
+                {
+                        number_of_bytes = strtol (value, NULL, 10);
+                        /* Never reserve more bytes than the rest of
+                         * the data can hold as hexadecimal digits. */
+                        if ((number_of_bytes > 0)
+                          && ((size_t) number_of_bytes > (size_t) (end - pos) / 2))
+                        {
+                                number_of_bytes = (long) ((end - pos) / 2);
+                        }
+                        if (number_of_bytes > 0)
+                        {
+                                dxf_binary_buffer_reserve (image, (size_t) number_of_bytes);
+                        }
+                }
+                else if (dxf_thumbnail_line_is (code, code_length, "310"))
+                {
+                        if (dxf_binary_buffer_append_hex (image, value, value_length) == EXIT_FAILURE)
+                        {
+                                dxf_binary_buffer_free (image);
+                                return (NULL);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (image);
+}
+
+
 /* EOF */
@@ -59,6 +59,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 
 
 #ifdef __cplusplus
@@ -78,6 +79,11 @@ dxf_thumbnail_struct
                  * Group code = 90. */
         DxfChar *preview_image_data;
                 /*!< Multiple lines (256 characters maximum per line).\n
+                 * Group code = 310.\n
+                 * Not used by the reader, see \c image. */
+        DxfBinaryBuffer *image;
+                /*!< The decoded preview image (BMP or PNG), in one
+                 * contiguous buffer of \c number_of_bytes bytes.\n
                  * Group code = 310. */
 } DxfThumbnail;
 
@@ -98,6 +104,10 @@ DxfChar *dxf_thumbnail_set_preview_image_data_length (DxfChar *preview_image_dat
 DxfChar *dxf_thumbnail_get_preview_image_data_next (DxfChar *preview_image_data);
 DxfChar *dxf_thumbnail_set_preview_image_data_next (DxfChar *preview_image_data, DxfChar *next);
 DxfChar *dxf_thumbnail_get_preview_image_data_last (DxfChar *preview_image_data);
+DxfBinaryBuffer *dxf_thumbnail_get_image (DxfThumbnail *thumbnail);
+long dxf_thumbnail_find (DxfFile *fp);
+DxfBinaryBuffer *dxf_thumbnail_extract (const char *filename);
+DxfBinaryBuffer *dxf_thumbnail_extract_from_memory (const char *data, size_t size);
 
 
 #ifdef __cplusplus
@@ -40,6 +40,7 @@
 
 
 #include "tolerance.h"
+#include "entities.h"
 
 
 /*!
@@ -112,27 +113,13 @@ dxf_tolerance_init
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->id_code = 0;
-        tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        tolerance->layer = strdup (DXF_DEFAULT_LAYER);
-        tolerance->elevation = 0.0;
-        tolerance->thickness = 0.0;
-        tolerance->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        tolerance->visibility = DXF_DEFAULT_VISIBILITY;
-        tolerance->color = DXF_COLOR_BYLAYER;
-        tolerance->paperspace = DXF_MODELSPACE;
-        tolerance->graphics_data_size = 0;
-        tolerance->shadow_mode = 0;
-        tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data);
-        tolerance->dictionary_owner_soft = strdup ("");
-        tolerance->material = strdup ("");
-        tolerance->dictionary_owner_hard = strdup ("");
-        tolerance->lineweight = 0;
-        tolerance->plot_style_name = strdup ("");
-        tolerance->color_value = 0;
-        tolerance->color_name = strdup ("");
-        tolerance->transparency = 0;
+        if (dxf_entity_common_init (&tolerance->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         tolerance->dimstyle_name = strdup ("");
         tolerance->p0 = (DxfPoint *) dxf_point_new ();
         tolerance->p0 = dxf_point_init ((DxfPoint *) tolerance->p0);
@@ -178,7 +165,9 @@ dxf_tolerance_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -186,8 +175,6 @@ dxf_tolerance_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (tolerance == NULL)
@@ -195,284 +182,111 @@ dxf_tolerance_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                tolerance = dxf_tolerance_init (tolerance);
+                tolerance = dxf_tolerance_init (dxf_tolerance_new ());
+                if (tolerance == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "3") == 0)
-                {
-                        /* Now follows a string containing the dimension
-                         * style name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->dimstyle_name);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &tolerance->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the insertion point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the direction vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->p1->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &tolerance->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbFcf") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &tolerance->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &tolerance->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &tolerance->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next);
-                        tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) tolerance->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &tolerance->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->plot_style_name);
+                        break;
                 }
-                else if (strcmp (temp_string, "420") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &tolerance->color_value);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, tolerance->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &tolerance->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 3:
+                                free (tolerance->dimstyle_name);
+                                tolerance->dimstyle_name = strdup (value);
+                                break;
+                        case 10:
+                                tolerance->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                tolerance->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                tolerance->p0->z0 = atof (value);
+                                break;
+                        case 11:
+                                tolerance->p1->x0 = atof (value);
+                                break;
+                        case 21:
+                                tolerance->p1->y0 = atof (value);
+                                break;
+                        case 31:
+                                tolerance->p1->z0 = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbFcf") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                tolerance->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                tolerance->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                tolerance->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &tolerance->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (tolerance->dimstyle_name, "") == 0)
+        if ((tolerance->common.linetype == NULL)
+          || (strcmp (tolerance->common.linetype, "") == 0))
         {
-                return (NULL);
+                free (tolerance->common.linetype);
+                tolerance->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (tolerance->linetype, "") == 0)
+        if ((tolerance->common.layer == NULL)
+          || (strcmp (tolerance->common.layer, "") == 0))
         {
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (tolerance->common.layer);
+                tolerance->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        if (strcmp (tolerance->layer, "") == 0)
+        if ((tolerance->dimstyle_name == NULL)
+          || (strcmp (tolerance->dimstyle_name, "") == 0))
         {
-                tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+                fprintf (stderr,
+                  (_("Warning in %s () empty dimension style name for the TOLERANCE entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, tolerance->common.id_code);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -521,39 +335,39 @@ dxf_tolerance_write
         }
         if (strcmp (tolerance->dimstyle_name, "") == 0)
         {
-                fprintf (stderr, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %x.\n",
-                        dxf_entity_name, tolerance->id_code);
+                fprintf (stderr, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %" PRIx64 ".\n",
+                        dxf_entity_name, tolerance->common.id_code);
                 fprintf (stderr, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (tolerance->linetype, "") == 0)
+        if (strcmp (tolerance->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, tolerance->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, tolerance->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (tolerance->layer, "") == 0)
+        if (strcmp (tolerance->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, tolerance->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, tolerance->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                tolerance->layer = DXF_DEFAULT_LAYER;
+                tolerance->common.layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (tolerance->id_code != -1)
+        if (tolerance->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", tolerance->id_code);
+                dxf_handle_write (fp, 5, tolerance->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -565,97 +379,91 @@ dxf_tolerance_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (tolerance->dictionary_owner_soft, "") != 0)
+        if ((tolerance->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", tolerance->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, tolerance->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (tolerance->dictionary_owner_hard, "") != 0)
+        if ((tolerance->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", tolerance->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, tolerance->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (tolerance->paperspace == DXF_PAPERSPACE)
+        if (tolerance->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", tolerance->layer);
-        if (strcmp (tolerance->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", tolerance->common.layer);
+        if (strcmp (tolerance->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", tolerance->linetype);
+                fprintf (fp->fp, "  6\n%s\n", tolerance->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (tolerance->material, "") != 0))
+          && (tolerance->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", tolerance->material);
+                dxf_handle_write (fp, 347, tolerance->common.cold->material);
         }
-        if (tolerance->color != DXF_COLOR_BYLAYER)
+        if (tolerance->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", tolerance->color);
+                fprintf (fp->fp, " 62\n%hd\n", tolerance->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", tolerance->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", tolerance->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (tolerance->elevation != 0.0))
+          && (tolerance->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", tolerance->elevation);
+                fprintf (fp->fp, " 38\n%f\n", tolerance->common.elevation);
         }
-        if (tolerance->linetype_scale != 1.0)
+        if (tolerance->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", tolerance->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", tolerance->common.linetype_scale);
         }
-        if (tolerance->visibility != 0)
+        if (tolerance->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", tolerance->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", tolerance->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (tolerance->graphics_data_size > 0))
+          && (tolerance->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", tolerance->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", tolerance->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", tolerance->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", tolerance->common.cold->graphics_data_size);
 #endif
-                if (tolerance->binary_graphics_data != NULL)
+                if (tolerance->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = tolerance->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, tolerance->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", tolerance->color_value);
-                fprintf (fp->fp, "430\n%s\n", tolerance->color_name);
-                fprintf (fp->fp, "440\n%ld\n", tolerance->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", tolerance->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", tolerance->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", tolerance->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", tolerance->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", tolerance->shadow_mode);
+                dxf_handle_write (fp, 390, tolerance->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", tolerance->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbFcf\n");
         }
-        if (tolerance->thickness != 0.0)
+        if (tolerance->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", tolerance->thickness);
+                fprintf (fp->fp, " 39\n%f\n", tolerance->common.thickness);
         }
         fprintf (fp->fp, "  3\n%s\n", tolerance->dimstyle_name);
         fprintf (fp->fp, " 10\n%f\n", tolerance->p0->x0);
@@ -673,6 +481,7 @@ dxf_tolerance_write
         fprintf (fp->fp, " 11\n%f\n", tolerance->p1->x0);
         fprintf (fp->fp, " 21\n%f\n", tolerance->p1->y0);
         fprintf (fp->fp, " 31\n%f\n", tolerance->p1->z0);
+        dxf_entity_common_write_xdata (fp, &tolerance->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -716,10 +525,9 @@ dxf_tolerance_free
                 return (EXIT_FAILURE);
         }
         free (tolerance->dimstyle_name);
-        free (tolerance->linetype);
-        free (tolerance->layer);
-        free (tolerance->dictionary_owner_soft);
-        free (tolerance->dictionary_owner_hard);
+        dxf_entity_common_free (&tolerance->common);
+        dxf_point_free (tolerance->p0);
+        dxf_point_free (tolerance->p1);
         free (tolerance);
         tolerance = NULL;
 #if DEBUG
@@ -753,6 +561,7 @@ dxf_tolerance_free_list
         while (tolerances != NULL)
         {
                 DxfTolerance *iter = (DxfTolerance *) tolerances->next;
+                tolerances->next = NULL;
                 dxf_tolerance_free (tolerances);
                 tolerances = (DxfTolerance *) iter;
         }
@@ -762,12 +571,99 @@ dxf_tolerance_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c TOLERANCE entity.
+ *
+ * The copy does not share any memory with \c tolerance, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTolerance *
+dxf_tolerance_copy
+(
+        DxfTolerance *tolerance
+                /*!< a pointer to the DXF \c TOLERANCE entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTolerance *copy;
+
+        /* Do some basic checks. */
+        if (tolerance == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_tolerance_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, tolerance, sizeof (DxfTolerance));
+        copy->dimstyle_name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &tolerance->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_tolerance_free (copy);
+                return (NULL);
+        }
+        if (tolerance->dimstyle_name != NULL)
+        {
+                copy->dimstyle_name = strdup (tolerance->dimstyle_name);
+                if (copy->dimstyle_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_tolerance_free (copy);
+                        return (NULL);
+                }
+        }
+        if (tolerance->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (tolerance->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_tolerance_free (copy);
+                        return (NULL);
+                }
+        }
+        if (tolerance->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (tolerance->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_tolerance_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c TOLERANCE entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_tolerance_get_id_code
 (
         DxfTolerance *tolerance
@@ -785,16 +681,10 @@ dxf_tolerance_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->id_code);
+        return (tolerance->common.id_code);
 }
 
 
@@ -806,7 +696,7 @@ dxf_tolerance_set_id_code
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -823,13 +713,7 @@ dxf_tolerance_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        tolerance->id_code = id_code;
+        tolerance->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -860,7 +744,7 @@ dxf_tolerance_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->linetype ==  NULL)
+        if (tolerance->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -870,7 +754,7 @@ dxf_tolerance_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->linetype));
+        return (strdup (tolerance->common.linetype));
 }
 
 
@@ -905,7 +789,7 @@ dxf_tolerance_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->linetype = strdup (linetype);
+        tolerance->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -936,7 +820,7 @@ dxf_tolerance_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->layer ==  NULL)
+        if (tolerance->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -946,7 +830,7 @@ dxf_tolerance_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->layer));
+        return (strdup (tolerance->common.layer));
 }
 
 
@@ -981,7 +865,7 @@ dxf_tolerance_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->layer = strdup (layer);
+        tolerance->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1015,7 +899,7 @@ dxf_tolerance_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->elevation);
+        return (tolerance->common.elevation);
 }
 
 
@@ -1042,7 +926,7 @@ dxf_tolerance_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->elevation = elevation;
+        tolerance->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1073,7 +957,7 @@ dxf_tolerance_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->thickness < 0.0)
+        if (tolerance->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1082,7 +966,7 @@ dxf_tolerance_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->thickness);
+        return (tolerance->common.thickness);
 }
 
 
@@ -1115,7 +999,7 @@ dxf_tolerance_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->thickness = thickness;
+        tolerance->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1146,7 +1030,7 @@ dxf_tolerance_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->linetype_scale < 0.0)
+        if (tolerance->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1155,7 +1039,7 @@ dxf_tolerance_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->linetype_scale);
+        return (tolerance->common.linetype_scale);
 }
 
 
@@ -1188,7 +1072,7 @@ dxf_tolerance_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->linetype_scale = linetype_scale;
+        tolerance->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1219,13 +1103,13 @@ dxf_tolerance_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->visibility < 0)
+        if (tolerance->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (tolerance->visibility > 1)
+        if (tolerance->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1234,7 +1118,7 @@ dxf_tolerance_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->visibility);
+        return (tolerance->common.visibility);
 }
 
 
@@ -1273,7 +1157,7 @@ dxf_tolerance_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->visibility = visibility;
+        tolerance->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1304,7 +1188,7 @@ dxf_tolerance_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->color < 0)
+        if (tolerance->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1313,7 +1197,7 @@ dxf_tolerance_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->color);
+        return (tolerance->common.color);
 }
 
 
@@ -1346,7 +1230,7 @@ dxf_tolerance_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->color = color;
+        tolerance->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1378,13 +1262,13 @@ dxf_tolerance_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->paperspace < 0)
+        if (tolerance->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (tolerance->paperspace > 1)
+        if (tolerance->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1393,7 +1277,7 @@ dxf_tolerance_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->paperspace);
+        return (tolerance->common.paperspace);
 }
 
 
@@ -1433,7 +1317,7 @@ dxf_tolerance_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->paperspace = paperspace;
+        tolerance->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1466,13 +1350,13 @@ dxf_tolerance_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->graphics_data_size < 0)
+        if (tolerance->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (tolerance->graphics_data_size == 0)
+        if (tolerance->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1481,7 +1365,7 @@ dxf_tolerance_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->graphics_data_size);
+        return (tolerance->common.cold->graphics_data_size);
 }
 
 
@@ -1525,7 +1409,7 @@ dxf_tolerance_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->graphics_data_size = graphics_data_size;
+        tolerance->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1557,13 +1441,13 @@ dxf_tolerance_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (tolerance->shadow_mode < 0)
+        if (tolerance->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (tolerance->shadow_mode > 3)
+        if (tolerance->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1572,7 +1456,7 @@ dxf_tolerance_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->shadow_mode);
+        return (tolerance->common.cold->shadow_mode);
 }
 
 
@@ -1614,7 +1498,7 @@ dxf_tolerance_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        tolerance->shadow_mode = shadow_mode;
+        tolerance->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1626,11 +1510,12 @@ dxf_tolerance_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c TOLERANCE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_tolerance_get_binary_graphics_data
 (
         DxfTolerance *tolerance
@@ -1648,32 +1533,31 @@ dxf_tolerance_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) tolerance->binary_graphics_data);
+        return (tolerance->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c TOLERANCE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c tolerance when successful, or \c NULL when an
+ * error occurred.
  */
 DxfTolerance *
 dxf_tolerance_set_binary_graphics_data
 (
         DxfTolerance *tolerance,
                 /*!< a pointer to a DXF \c TOLERANCE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1694,7 +1578,12 @@ dxf_tolerance_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((tolerance->common.cold->binary_graphics_data != NULL)
+          && (tolerance->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (tolerance->common.cold->binary_graphics_data);
+        }
+        tolerance->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1728,17 +1617,10 @@ dxf_tolerance_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dictionary_owner_soft));
+        return (dxf_handle_to_string (tolerance->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1774,7 +1656,7 @@ dxf_tolerance_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        tolerance->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1809,17 +1691,10 @@ dxf_tolerance_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->material));
+        return (dxf_handle_to_string (tolerance->common.cold->material));
 }
 
 
@@ -1858,7 +1733,7 @@ dxf_tolerance_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->material = strdup (material);
+        tolerance->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1892,17 +1767,10 @@ dxf_tolerance_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->dictionary_owner_hard));
+        return (dxf_handle_to_string (tolerance->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1938,7 +1806,7 @@ dxf_tolerance_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        tolerance->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1973,7 +1841,7 @@ dxf_tolerance_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->lineweight);
+        return (tolerance->common.lineweight);
 }
 
 
@@ -2003,7 +1871,7 @@ dxf_tolerance_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->lineweight = lineweight;
+        tolerance->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2035,17 +1903,10 @@ dxf_tolerance_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->plot_style_name));
+        return (dxf_handle_to_string (tolerance->common.cold->plot_style_name));
 }
 
 
@@ -2083,7 +1944,7 @@ dxf_tolerance_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->plot_style_name = strdup (plot_style_name);
+        tolerance->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2118,7 +1979,7 @@ dxf_tolerance_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->color_value);
+        return (tolerance->common.color_value);
 }
 
 
@@ -2148,7 +2009,7 @@ dxf_tolerance_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->color_value = color_value;
+        tolerance->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2180,7 +2041,7 @@ dxf_tolerance_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (tolerance->color_name ==  NULL)
+        if (tolerance->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2190,7 +2051,7 @@ dxf_tolerance_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (tolerance->color_name));
+        return (strdup (tolerance->common.cold->color_name));
 }
 
 
@@ -2228,7 +2089,7 @@ dxf_tolerance_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->color_name = strdup (color_name);
+        tolerance->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2263,7 +2124,7 @@ dxf_tolerance_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (tolerance->transparency);
+        return (tolerance->common.cold->transparency);
 }
 
 
@@ -2293,7 +2154,7 @@ dxf_tolerance_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->transparency = transparency;
+        tolerance->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
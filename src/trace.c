@@ -42,6 +42,7 @@
 
 
 #include "trace.h"
+#include "entities.h"
 
 
 /*!
@@ -114,39 +115,27 @@ dxf_trace_init
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->id_code = 0;
-        trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        trace->layer = strdup (DXF_DEFAULT_LAYER);
-        trace->elevation = 0.0;
-        trace->thickness = 0.0;
-        trace->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        trace->visibility = DXF_DEFAULT_VISIBILITY;
-        trace->color = DXF_COLOR_BYLAYER;
-        trace->paperspace = DXF_MODELSPACE;
-        trace->graphics_data_size = 0;
-        trace->shadow_mode = 0;
-        trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data);
-        trace->dictionary_owner_soft = strdup ("");
-        trace->material = strdup ("");
-        trace->dictionary_owner_hard = strdup ("");
-        trace->lineweight = 0;
-        trace->plot_style_name = strdup ("");
-        trace->color_value = 0;
-        trace->color_name = strdup ("");
-        trace->transparency = 0;
-        trace->p0->x0 = 0.0;
-        trace->p0->y0 = 0.0;
-        trace->p0->z0 = 0.0;
-        trace->p1->x0 = 0.0;
-        trace->p1->y0 = 0.0;
-        trace->p1->z0 = 0.0;
-        trace->p2->x0 = 0.0;
-        trace->p2->y0 = 0.0;
-        trace->p2->z0 = 0.0;
-        trace->p3->x0 = 0.0;
-        trace->p3->y0 = 0.0;
-        trace->p3->z0 = 0.0;
+        if (dxf_entity_common_init (&trace->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        trace->p0 = dxf_point_init (dxf_point_new ());
+        trace->p1 = dxf_point_init (dxf_point_new ());
+        trace->p2 = dxf_point_init (dxf_point_new ());
+        trace->p3 = dxf_point_init (dxf_point_new ());
+        if ((trace->p0 == NULL)
+          || (trace->p1 == NULL)
+          || (trace->p2 == NULL)
+          || (trace->p3 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         trace->extr_x0 = 0.0;
         trace->extr_y0 = 0.0;
         trace->extr_z0 = 0.0;
@@ -179,7 +168,9 @@ dxf_trace_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -187,8 +178,6 @@ dxf_trace_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (trace == NULL)
@@ -196,316 +185,118 @@ dxf_trace_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                trace = dxf_trace_init (trace);
+                trace = dxf_trace_init (dxf_trace_new ());
+                if (trace == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &trace->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p0->x0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p1->x0);
-                }
-                else if (strcmp (temp_string, "12") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p2->x0);
-                }
-                else if (strcmp (temp_string, "13") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p3->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p0->y0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p1->y0);
-                }
-                else if (strcmp (temp_string, "22") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p2->y0);
-                }
-                else if (strcmp (temp_string, "23") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p3->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the base point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p0->z0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p1->z0);
-                }
-                else if (strcmp (temp_string, "32") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p2->z0);
-                }
-                else if (strcmp (temp_string, "33") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the alignment point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->p3->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (trace->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->thickness);
+                        break;
                 }
-                else if (strcmp (temp_string, "48") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->linetype_scale);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &trace->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->graphics_data_size);
-                }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbTrace") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &trace->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &trace->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &trace->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data->next);
-                        trace->binary_graphics_data = (DxfBinaryGraphicsData *) trace->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &trace->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &trace->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &trace->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                trace->p0->x0 = atof (value);
+                                break;
+                        case 11:
+                                trace->p1->x0 = atof (value);
+                                break;
+                        case 12:
+                                trace->p2->x0 = atof (value);
+                                break;
+                        case 13:
+                                trace->p3->x0 = atof (value);
+                                break;
+                        case 20:
+                                trace->p0->y0 = atof (value);
+                                break;
+                        case 21:
+                                trace->p1->y0 = atof (value);
+                                break;
+                        case 22:
+                                trace->p2->y0 = atof (value);
+                                break;
+                        case 23:
+                                trace->p3->y0 = atof (value);
+                                break;
+                        case 30:
+                                trace->p0->z0 = atof (value);
+                                break;
+                        case 31:
+                                trace->p1->z0 = atof (value);
+                                break;
+                        case 32:
+                                trace->p2->z0 = atof (value);
+                                break;
+                        case 33:
+                                trace->p3->z0 = atof (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbTrace") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        case 210:
+                                trace->extr_x0 = atof (value);
+                                break;
+                        case 220:
+                                trace->extr_y0 = atof (value);
+                                break;
+                        case 230:
+                                trace->extr_z0 = atof (value);
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &trace->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (trace->linetype, "") == 0)
+        if ((trace->common.linetype == NULL)
+          || (strcmp (trace->common.linetype, "") == 0))
         {
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (trace->common.linetype);
+                trace->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (trace->layer, "") == 0)
+        if ((trace->common.layer == NULL)
+          || (strcmp (trace->common.layer, "") == 0))
         {
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                free (trace->common.layer);
+                trace->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -552,31 +343,31 @@ dxf_trace_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (trace->linetype, "") == 0)
+        if (strcmp (trace->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, trace->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, trace->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (trace->layer, "") == 0)
+        if (strcmp (trace->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, trace->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, trace->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (trace->id_code != -1)
+        if (trace->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", trace->id_code);
+                dxf_handle_write (fp, 5, trace->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -588,97 +379,91 @@ dxf_trace_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (trace->dictionary_owner_soft, "") != 0)
+        if ((trace->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", trace->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, trace->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (trace->dictionary_owner_hard, "") != 0)
+        if ((trace->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", trace->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, trace->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (trace->paperspace == DXF_PAPERSPACE)
+        if (trace->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", trace->layer);
-        if (strcmp (trace->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", trace->common.layer);
+        if (strcmp (trace->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", trace->linetype);
+                fprintf (fp->fp, "  6\n%s\n", trace->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (trace->material, "") != 0))
+          && (trace->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", trace->material);
+                dxf_handle_write (fp, 347, trace->common.cold->material);
         }
-        if (trace->color != DXF_COLOR_BYLAYER)
+        if (trace->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", trace->color);
+                fprintf (fp->fp, " 62\n%hd\n", trace->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", trace->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", trace->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (trace->elevation != 0.0))
+          && (trace->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", trace->elevation);
+                fprintf (fp->fp, " 38\n%f\n", trace->common.elevation);
         }
-        if (trace->linetype_scale != 1.0)
+        if (trace->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", trace->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", trace->common.linetype_scale);
         }
-        if (trace->visibility != 0)
+        if (trace->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", trace->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", trace->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (trace->graphics_data_size > 0))
+          && (trace->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", trace->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", trace->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", trace->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", trace->common.cold->graphics_data_size);
 #endif
-                if (trace->binary_graphics_data != NULL)
+                if (trace->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = trace->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, trace->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", trace->color_value);
-                fprintf (fp->fp, "430\n%s\n", trace->color_name);
-                fprintf (fp->fp, "440\n%ld\n", trace->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", trace->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", trace->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", trace->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", trace->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", trace->shadow_mode);
+                dxf_handle_write (fp, 390, trace->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", trace->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbTrace\n");
         }
-        if (trace->thickness != 0.0)
+        if (trace->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", trace->thickness);
+                fprintf (fp->fp, " 39\n%f\n", trace->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", trace->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", trace->p0->y0);
@@ -701,6 +486,7 @@ dxf_trace_write
                 fprintf (fp->fp, "220\n%f\n", trace->extr_y0);
                 fprintf (fp->fp, "230\n%f\n", trace->extr_z0);
         }
+        dxf_entity_common_write_xdata (fp, &trace->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -743,14 +529,7 @@ dxf_trace_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (trace->linetype);
-        free (trace->layer);
-        dxf_binary_graphics_data_free_list (trace->binary_graphics_data);
-        free (trace->dictionary_owner_soft);
-        free (trace->material);
-        free (trace->dictionary_owner_hard);
-        free (trace->plot_style_name);
-        free (trace->color_name);
+        dxf_entity_common_free (&trace->common);
         dxf_point_free (trace->p0);
         dxf_point_free (trace->p1);
         dxf_point_free (trace->p2);
@@ -788,6 +567,7 @@ dxf_trace_free_list
         while (traces != NULL)
         {
                 DxfTrace *iter = (DxfTrace *) traces->next;
+                traces->next = NULL;
                 dxf_trace_free (traces);
                 traces = (DxfTrace *) iter;
         }
@@ -797,12 +577,106 @@ dxf_trace_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c TRACE entity.
+ *
+ * The copy does not share any memory with \c trace, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfTrace *
+dxf_trace_copy
+(
+        DxfTrace *trace
+                /*!< a pointer to the DXF \c TRACE entity to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTrace *copy;
+
+        /* Do some basic checks. */
+        if (trace == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_trace_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, trace, sizeof (DxfTrace));
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->p3 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &trace->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_trace_free (copy);
+                return (NULL);
+        }
+        if (trace->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (trace->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_trace_free (copy);
+                        return (NULL);
+                }
+        }
+        if (trace->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (trace->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_trace_free (copy);
+                        return (NULL);
+                }
+        }
+        if (trace->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (trace->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_trace_free (copy);
+                        return (NULL);
+                }
+        }
+        if (trace->p3 != NULL)
+        {
+                copy->p3 = dxf_point_copy (trace->p3);
+                if (copy->p3 == NULL)
+                {
+                        dxf_trace_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c TRACE entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_trace_get_id_code
 (
         DxfTrace *trace
@@ -820,16 +694,10 @@ dxf_trace_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->id_code);
+        return (trace->common.id_code);
 }
 
 
@@ -841,7 +709,7 @@ dxf_trace_set_id_code
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -858,13 +726,7 @@ dxf_trace_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        trace->id_code = id_code;
+        trace->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -895,7 +757,7 @@ dxf_trace_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->linetype ==  NULL)
+        if (trace->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -905,7 +767,7 @@ dxf_trace_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->linetype));
+        return (strdup (trace->common.linetype));
 }
 
 
@@ -940,7 +802,7 @@ dxf_trace_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->linetype = strdup (linetype);
+        trace->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -971,7 +833,7 @@ dxf_trace_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->layer ==  NULL)
+        if (trace->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -981,7 +843,7 @@ dxf_trace_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->layer));
+        return (strdup (trace->common.layer));
 }
 
 
@@ -1016,7 +878,7 @@ dxf_trace_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->layer = strdup (layer);
+        trace->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1050,7 +912,7 @@ dxf_trace_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->elevation);
+        return (trace->common.elevation);
 }
 
 
@@ -1077,7 +939,7 @@ dxf_trace_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->elevation = elevation;
+        trace->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1108,7 +970,7 @@ dxf_trace_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->thickness < 0.0)
+        if (trace->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1117,7 +979,7 @@ dxf_trace_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->thickness);
+        return (trace->common.thickness);
 }
 
 
@@ -1150,7 +1012,7 @@ dxf_trace_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->thickness = thickness;
+        trace->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1181,7 +1043,7 @@ dxf_trace_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->linetype_scale < 0.0)
+        if (trace->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1190,7 +1052,7 @@ dxf_trace_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->linetype_scale);
+        return (trace->common.linetype_scale);
 }
 
 
@@ -1223,7 +1085,7 @@ dxf_trace_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->linetype_scale = linetype_scale;
+        trace->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1254,13 +1116,13 @@ dxf_trace_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->visibility < 0)
+        if (trace->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (trace->visibility > 1)
+        if (trace->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1269,7 +1131,7 @@ dxf_trace_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->visibility);
+        return (trace->common.visibility);
 }
 
 
@@ -1308,7 +1170,7 @@ dxf_trace_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->visibility = visibility;
+        trace->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1339,7 +1201,7 @@ dxf_trace_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->color < 0)
+        if (trace->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1348,7 +1210,7 @@ dxf_trace_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->color);
+        return (trace->common.color);
 }
 
 
@@ -1381,7 +1243,7 @@ dxf_trace_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->color = color;
+        trace->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1412,13 +1274,13 @@ dxf_trace_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->paperspace < 0)
+        if (trace->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (trace->paperspace > 1)
+        if (trace->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1427,7 +1289,7 @@ dxf_trace_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->paperspace);
+        return (trace->common.paperspace);
 }
 
 
@@ -1467,7 +1329,7 @@ dxf_trace_set_paperspace
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->paperspace = paperspace;
+        trace->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1499,13 +1361,13 @@ dxf_trace_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->graphics_data_size < 0)
+        if (trace->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (trace->graphics_data_size == 0)
+        if (trace->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1514,7 +1376,7 @@ dxf_trace_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->graphics_data_size);
+        return (trace->common.cold->graphics_data_size);
 }
 
 
@@ -1557,7 +1419,7 @@ dxf_trace_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->graphics_data_size = graphics_data_size;
+        trace->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1589,13 +1451,13 @@ dxf_trace_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (trace->shadow_mode < 0)
+        if (trace->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (trace->shadow_mode > 3)
+        if (trace->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1604,7 +1466,7 @@ dxf_trace_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->shadow_mode);
+        return (trace->common.cold->shadow_mode);
 }
 
 
@@ -1646,7 +1508,7 @@ dxf_trace_set_shadow_mode
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        trace->shadow_mode = shadow_mode;
+        trace->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1658,11 +1520,12 @@ dxf_trace_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c TRACE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_trace_get_binary_graphics_data
 (
         DxfTrace *trace
@@ -1680,32 +1543,31 @@ dxf_trace_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) trace->binary_graphics_data);
+        return (trace->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c TRACE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c trace when successful, or \c NULL when an
+ * error occurred.
  */
 DxfTrace *
 dxf_trace_set_binary_graphics_data
 (
         DxfTrace *trace,
                 /*!< a pointer to a DXF \c TRACE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1726,7 +1588,12 @@ dxf_trace_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((trace->common.cold->binary_graphics_data != NULL)
+          && (trace->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (trace->common.cold->binary_graphics_data);
+        }
+        trace->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1760,17 +1627,10 @@ dxf_trace_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->dictionary_owner_soft));
+        return (dxf_handle_to_string (trace->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1806,7 +1666,7 @@ dxf_trace_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        trace->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1840,17 +1700,10 @@ dxf_trace_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->material));
+        return (dxf_handle_to_string (trace->common.cold->material));
 }
 
 
@@ -1888,7 +1741,7 @@ dxf_trace_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->material = strdup (material);
+        trace->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1922,17 +1775,10 @@ dxf_trace_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->dictionary_owner_hard));
+        return (dxf_handle_to_string (trace->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1968,7 +1814,7 @@ dxf_trace_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        trace->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2003,7 +1849,7 @@ dxf_trace_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->lineweight);
+        return (trace->common.lineweight);
 }
 
 
@@ -2033,7 +1879,7 @@ dxf_trace_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->lineweight = lineweight;
+        trace->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2065,17 +1911,10 @@ dxf_trace_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->plot_style_name));
+        return (dxf_handle_to_string (trace->common.cold->plot_style_name));
 }
 
 
@@ -2113,7 +1952,7 @@ dxf_trace_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->plot_style_name = strdup (plot_style_name);
+        trace->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2148,7 +1987,7 @@ dxf_trace_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->color_value);
+        return (trace->common.color_value);
 }
 
 
@@ -2178,7 +2017,7 @@ dxf_trace_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->color_value = color_value;
+        trace->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2210,7 +2049,7 @@ dxf_trace_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (trace->color_name ==  NULL)
+        if (trace->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2220,7 +2059,7 @@ dxf_trace_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (trace->color_name));
+        return (strdup (trace->common.cold->color_name));
 }
 
 
@@ -2258,7 +2097,7 @@ dxf_trace_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->color_name = strdup (color_name);
+        trace->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2293,7 +2132,7 @@ dxf_trace_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (trace->transparency);
+        return (trace->common.cold->transparency);
 }
 
 
@@ -2323,7 +2162,7 @@ dxf_trace_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        trace->transparency = transparency;
+        trace->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -138,10 +138,10 @@ dxf_ucs_init
         ucs->orthographic_type = 0;
         ucs->other_base_UCS = 0;
         ucs->elevation = 0.0;
-        ucs->dictionary_owner_soft = strdup ("");
-        ucs->object_owner_soft = strdup ("");
-        ucs->base_UCS = strdup ("");
-        ucs->dictionary_owner_hard = strdup ("");
+        ucs->dictionary_owner_soft = DXF_HANDLE_NONE;
+        ucs->object_owner_soft = DXF_HANDLE_NONE;
+        ucs->base_UCS = DXF_HANDLE_NONE;
+        ucs->dictionary_owner_hard = DXF_HANDLE_NONE;
         ucs->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -212,8 +212,7 @@ dxf_ucs_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &ucs->id_code);
+                        ucs->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -375,29 +374,25 @@ dxf_ucs_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->dictionary_owner_soft);
+                        ucs->dictionary_owner_soft = dxf_handle_read (fp);
                         i++;
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to object owner. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->object_owner_soft);
+                        ucs->object_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "346") == 0)
                 {
                         /* Now follows a string containing a base UCS. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->base_UCS);
+                        ucs->base_UCS = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ucs->dictionary_owner_hard);
+                        ucs->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -465,7 +460,7 @@ dxf_ucs_write
           || (strcmp (ucs->UCS_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, ucs->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -476,9 +471,9 @@ dxf_ucs_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (ucs->id_code != -1)
+        if (ucs->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", ucs->id_code);
+                dxf_handle_write (fp, 5, ucs->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -490,18 +485,18 @@ dxf_ucs_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (ucs->dictionary_owner_soft, "") != 0)
+        if ((ucs->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", ucs->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, ucs->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (ucs->dictionary_owner_hard, "") != 0)
+        if ((ucs->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", ucs->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, ucs->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -524,13 +519,13 @@ dxf_ucs_write
         fprintf (fp->fp, "146\n%f\n", ucs->elevation);
         if (ucs->other_base_UCS != 0)
         {
-                if (strcmp (ucs->base_UCS, "") == 0)
+                if (ucs->base_UCS == DXF_HANDLE_NONE)
                 {
                         fprintf (fp->fp, "346\nWORLD\n");
                 }
                 else
                 {
-                        fprintf (fp->fp, "346\n%s\n", ucs->base_UCS);
+                        dxf_handle_write (fp, 346, ucs->base_UCS);
                 }
         }
         else
@@ -587,8 +582,10 @@ dxf_ucs_free
                 return (EXIT_FAILURE);
         }
         free (ucs->UCS_name);
-        free (ucs->dictionary_owner_soft);
-        free (ucs->dictionary_owner_hard);
+        dxf_point_free (ucs->origin);
+        dxf_point_free (ucs->X_dir);
+        dxf_point_free (ucs->Y_dir);
+        dxf_point_free (ucs->orthographic_type_origin);
         free (ucs);
         ucs = NULL;
 #if DEBUG
@@ -622,6 +619,7 @@ dxf_ucs_free_list
         while (ucss != NULL)
         {
                 DxfUcs *iter = (DxfUcs *) ucss->next;
+                ucss->next = NULL;
                 dxf_ucs_free (ucss);
                 ucss = (DxfUcs *) iter;
         }
@@ -631,12 +629,111 @@ dxf_ucs_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c UCS symbol table entry.
+ *
+ * The copy does not share any memory with \c ucs, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfUcs *
+dxf_ucs_copy
+(
+        DxfUcs *ucs
+                /*!< a pointer to the DXF \c UCS symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfUcs *copy;
+
+        /* Do some basic checks. */
+        if (ucs == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_ucs_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, ucs, sizeof (DxfUcs));
+        copy->UCS_name = NULL;
+        copy->origin = NULL;
+        copy->X_dir = NULL;
+        copy->Y_dir = NULL;
+        copy->orthographic_type_origin = NULL;
+        copy->next = NULL;
+        if (ucs->UCS_name != NULL)
+        {
+                copy->UCS_name = strdup (ucs->UCS_name);
+                if (copy->UCS_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_ucs_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ucs->origin != NULL)
+        {
+                copy->origin = dxf_point_copy (ucs->origin);
+                if (copy->origin == NULL)
+                {
+                        dxf_ucs_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ucs->X_dir != NULL)
+        {
+                copy->X_dir = dxf_point_copy (ucs->X_dir);
+                if (copy->X_dir == NULL)
+                {
+                        dxf_ucs_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ucs->Y_dir != NULL)
+        {
+                copy->Y_dir = dxf_point_copy (ucs->Y_dir);
+                if (copy->Y_dir == NULL)
+                {
+                        dxf_ucs_free (copy);
+                        return (NULL);
+                }
+        }
+        if (ucs->orthographic_type_origin != NULL)
+        {
+                copy->orthographic_type_origin = dxf_point_copy (ucs->orthographic_type_origin);
+                if (copy->orthographic_type_origin == NULL)
+                {
+                        dxf_ucs_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c UCS symbol table entry.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_ucs_get_id_code
 (
         DxfUcs *ucs
@@ -654,12 +751,6 @@ dxf_ucs_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (ucs->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -675,7 +766,7 @@ dxf_ucs_set_id_code
 (
         DxfUcs *ucs,
                 /*!< a pointer to a DXF \c UCS symbol table entry. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entry.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -692,12 +783,6 @@ dxf_ucs_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         ucs->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -2258,17 +2343,10 @@ dxf_ucs_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ucs->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->dictionary_owner_soft));
+        return (dxf_handle_to_string (ucs->dictionary_owner_soft));
 }
 
 
@@ -2304,7 +2382,7 @@ dxf_ucs_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ucs->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2338,17 +2416,10 @@ dxf_ucs_get_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ucs->object_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->object_owner_soft));
+        return (dxf_handle_to_string (ucs->object_owner_soft));
 }
 
 
@@ -2384,7 +2455,7 @@ dxf_ucs_set_object_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->object_owner_soft = strdup (object_owner_soft);
+        ucs->object_owner_soft = dxf_handle_parse (object_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2418,17 +2489,10 @@ dxf_ucs_get_base_UCS
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ucs->base_UCS ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->base_UCS));
+        return (dxf_handle_to_string (ucs->base_UCS));
 }
 
 
@@ -2464,7 +2528,7 @@ dxf_ucs_set_object_base_UCS
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->base_UCS = strdup (base_UCS);
+        ucs->base_UCS = dxf_handle_parse (base_UCS);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2498,17 +2562,10 @@ dxf_ucs_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (ucs->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ucs->dictionary_owner_hard));
+        return (dxf_handle_to_string (ucs->dictionary_owner_hard));
 }
 
 
@@ -2544,7 +2601,7 @@ dxf_ucs_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        ucs->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ucs->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "point.h"
 
 
@@ -59,7 +60,7 @@ extern "C" {
 typedef struct
 dxf_ucs_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -132,22 +133,22 @@ dxf_ucs_struct
                 /*!< Elevation.\n
                  * Group code = 146.\n
                  * \since Introduced in version R2000.\n */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *object_owner_soft;
+        DxfHandle object_owner_soft;
                 /*!< Soft-pointer ID/handle to owner object.\n
                  * Group code = 330.\n
                  * \since Introduced in version R2000.\n */
-        char *base_UCS;
+        DxfHandle base_UCS;
                 /*!< ID/handle of base UCS if this is an orthographic.\n
                  * This code is not present if the 79 code is 0.\n
                  * If this code is not present and 79 code is non-zero,
                  * then base UCS is assumed to be WORLD.\n
                  * Group code = 346.\n
                  * \since Introduced in version R2000.\n */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -163,8 +164,9 @@ DxfUcs *dxf_ucs_read (DxfFile *fp, DxfUcs *ucs);
 int dxf_ucs_write (DxfFile *fp, DxfUcs *ucs);
 int dxf_ucs_free (DxfUcs *ucs);
 void dxf_ucs_free_list (DxfUcs *ucss);
-int dxf_ucs_get_id_code (DxfUcs *ucs);
-DxfUcs *dxf_ucs_set_id_code (DxfUcs *ucs, int id_code);
+DxfUcs *dxf_ucs_copy (DxfUcs *ucs);
+DxfHandle dxf_ucs_get_id_code (DxfUcs *ucs);
+DxfUcs *dxf_ucs_set_id_code (DxfUcs *ucs, DxfHandle id_code);
 char *dxf_ucs_get_UCS_name (DxfUcs *ucs);
 DxfUcs *dxf_ucs_set_UCS_name (DxfUcs *ucs, char *UCS_name);
 DxfPoint *dxf_ucs_get_origin (DxfUcs *ucs);
@@ -400,6 +400,52 @@ dxf_char_get_last
 }
 
 
+/*!
+ * \brief Append a \c DxfChar object (or a chain of \c DxfChar objects) to
+ * a single linked list of \c DxfChar objects in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_char_get_last ().
+ *
+ * \return a pointer to the new last \c DxfChar object of the list, or
+ * \c NULL when an error occurred.
+ */
+DxfChar *
+dxf_char_append
+(
+        DxfChar *last,
+                /*!< a pointer to the last \c DxfChar object of the list,
+                 * or \c NULL for an empty list. */
+        DxfChar *c
+                /*!< a pointer to the \c DxfChar object to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (c == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (last != NULL)
+        {
+                last->next = (struct DxfChar *) c;
+        }
+        while (c->next != NULL)
+        {
+                c = (DxfChar *) c->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (c);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DxfChar object and all it's
  * data fields.
@@ -468,6 +514,7 @@ dxf_char_free_list
         while (chars != NULL)
         {
                 DxfChar *iter = (DxfChar *) chars->next;
+                chars->next = NULL;
                 dxf_char_free (chars);
                 chars = (DxfChar *) iter;
         }
@@ -478,6 +525,77 @@ dxf_char_free_list
 }
 
 
+/*!
+ * \brief Copy a single linked list of DxfChar objects.
+ *
+ * The copy does not share any memory with \c chars.
+ *
+ * \return a pointer to the first item of the copy, or \c NULL when an
+ * error occurred.
+ */
+DxfChar *
+dxf_char_copy_list
+(
+        DxfChar *chars
+                /*!< a pointer to the single linked list of DxfChar
+                 * objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChar *first = NULL;
+        DxfChar *last = NULL;
+        DxfChar *copy;
+
+        /* Do some basic checks. */
+        if (chars == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (; chars != NULL; chars = (DxfChar *) chars->next)
+        {
+                copy = dxf_char_new ();
+                if (copy != NULL)
+                {
+                        memcpy (copy, chars, sizeof (DxfChar));
+                        copy->value = NULL;
+                        copy->next = NULL;
+                }
+                if ((copy == NULL)
+                  || ((chars->value != NULL)
+                  && ((copy->value = strdup (chars->value)) == NULL)))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (copy);
+                        if (first != NULL)
+                        {
+                                dxf_char_free_list (first);
+                        }
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        first = copy;
+                }
+                else
+                {
+                        last->next = (struct DxfChar *) copy;
+                }
+                last = copy;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
 /*!
  * \brief Allocate memory for a \c DxfDouble.
  *
@@ -743,6 +861,52 @@ dxf_double_get_last
 }
 
 
+/*!
+ * \brief Append a \c DxfDouble object (or a chain of \c DxfDouble objects) to
+ * a single linked list of \c DxfDouble objects in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_double_get_last ().
+ *
+ * \return a pointer to the new last \c DxfDouble object of the list, or
+ * \c NULL when an error occurred.
+ */
+DxfDouble *
+dxf_double_append
+(
+        DxfDouble *last,
+                /*!< a pointer to the last \c DxfDouble object of the list,
+                 * or \c NULL for an empty list. */
+        DxfDouble *d
+                /*!< a pointer to the \c DxfDouble object to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (d == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (last != NULL)
+        {
+                last->next = (struct DxfDouble *) d;
+        }
+        while (d->next != NULL)
+        {
+                d = (DxfDouble *) d->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (d);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DxfDouble object and all it's
  * data fields.
@@ -810,6 +974,7 @@ dxf_double_free_list
         while (doubles != NULL)
         {
                 DxfDouble *iter = (DxfDouble *) doubles->next;
+                doubles->next = NULL;
                 dxf_double_free (doubles);
                 doubles = (DxfDouble *) iter;
         }
@@ -1085,6 +1250,52 @@ dxf_int_get_last
 }
 
 
+/*!
+ * \brief Append a \c DxfInt object (or a chain of \c DxfInt objects) to
+ * a single linked list of \c DxfInt objects in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_int_get_last ().
+ *
+ * \return a pointer to the new last \c DxfInt object of the list, or
+ * \c NULL when an error occurred.
+ */
+DxfInt *
+dxf_int_append
+(
+        DxfInt *last,
+                /*!< a pointer to the last \c DxfInt object of the list,
+                 * or \c NULL for an empty list. */
+        DxfInt *i
+                /*!< a pointer to the \c DxfInt object to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (i == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (last != NULL)
+        {
+                last->next = (struct DxfInt *) i;
+        }
+        while (i->next != NULL)
+        {
+                i = (DxfInt *) i->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (i);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DxfInt object and all it's
  * data fields.
@@ -1152,6 +1363,7 @@ dxf_int_free_list
         while (ints != NULL)
         {
                 DxfInt *iter = (DxfInt *) ints->next;
+                ints->next = NULL;
                 dxf_int_free (ints);
                 ints = (DxfInt *) iter;
         }
@@ -1427,6 +1639,52 @@ dxf_int16_get_last
 }
 
 
+/*!
+ * \brief Append a \c DxfInt16 object (or a chain of \c DxfInt16 objects) to
+ * a single linked list of \c DxfInt16 objects in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_int16_get_last ().
+ *
+ * \return a pointer to the new last \c DxfInt16 object of the list, or
+ * \c NULL when an error occurred.
+ */
+DxfInt16 *
+dxf_int16_append
+(
+        DxfInt16 *last,
+                /*!< a pointer to the last \c DxfInt16 object of the list,
+                 * or \c NULL for an empty list. */
+        DxfInt16 *i
+                /*!< a pointer to the \c DxfInt16 object to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (i == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (last != NULL)
+        {
+                last->next = (struct DxfInt16 *) i;
+        }
+        while (i->next != NULL)
+        {
+                i = (DxfInt16 *) i->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (i);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DxfInt16 object and all it's
  * data fields.
@@ -1494,6 +1752,7 @@ dxf_int16_free_list
         while (ints != NULL)
         {
                 DxfInt16 *iter = (DxfInt16 *) ints->next;
+                ints->next = NULL;
                 dxf_int16_free (ints);
                 ints = (DxfInt16 *) iter;
         }
@@ -1769,6 +2028,52 @@ dxf_int32_get_last
 }
 
 
+/*!
+ * \brief Append a \c DxfInt32 object (or a chain of \c DxfInt32 objects) to
+ * a single linked list of \c DxfInt32 objects in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_int32_get_last ().
+ *
+ * \return a pointer to the new last \c DxfInt32 object of the list, or
+ * \c NULL when an error occurred.
+ */
+DxfInt32 *
+dxf_int32_append
+(
+        DxfInt32 *last,
+                /*!< a pointer to the last \c DxfInt32 object of the list,
+                 * or \c NULL for an empty list. */
+        DxfInt32 *i
+                /*!< a pointer to the \c DxfInt32 object to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (i == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (last != NULL)
+        {
+                last->next = (struct DxfInt32 *) i;
+        }
+        while (i->next != NULL)
+        {
+                i = (DxfInt32 *) i->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (i);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DxfInt32 object and all it's
  * data fields.
@@ -1836,6 +2141,7 @@ dxf_int32_free_list
         while (ints != NULL)
         {
                 DxfInt32 *iter = (DxfInt32 *) ints->next;
+                ints->next = NULL;
                 dxf_int32_free (ints);
                 ints = (DxfInt32 *) iter;
         }
@@ -2112,76 +2418,2078 @@ dxf_int64_get_last
 
 
 /*!
- * \brief Test for double type group codes.
+ * \brief Append a \c DxfInt64 object (or a chain of \c DxfInt64 objects) to
+ * a single linked list of \c DxfInt64 objects in O(1).
+ *
+ * The caller keeps track of the \c last object of the list, so no
+ * walk through the list is needed as with dxf_int64_get_last ().
+ *
+ * \return a pointer to the new last \c DxfInt64 object of the list, or
+ * \c NULL when an error occurred.
  */
-int
-dxf_read_is_double
+DxfInt64 *
+dxf_int64_append
 (
-        int type
-                /*!< Group code. */
+        DxfInt64 *last,
+                /*!< a pointer to the last \c DxfInt64 object of the list,
+                 * or \c NULL for an empty list. */
+        DxfInt64 *i
+                /*!< a pointer to the \c DxfInt64 object to append. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        if ((type >= 10 && type < 60)
-          || (type >= 110 && type < 150)
-          || (type >= 210 && type < 240)
-          || (type >= 460 && type < 470)
-          || (type >= 1010 && type < 1060))
+        /* Do some basic checks. */
+        if (i == NULL)
         {
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-                return TRUE;
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
-        else
+        if (last != NULL)
+        {
+                last->next = (struct DxfInt64 *) i;
+        }
+        while (i->next != NULL)
         {
+                i = (DxfInt64 *) i->next;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-                return FALSE;
-        }
+        return (i);
 }
 
 
 /*!
- * \brief Test for int type group codes (Boolean).
+ * \brief Allocate memory for a \c DxfDoubleArray.
+ *
+ * Fill the memory contents with zeros.
  */
-int
-dxf_read_is_int
-(
-        int type
-                /*!< Group code. */
-)
+DxfDoubleArray *
+dxf_double_array_new ()
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        if (type >= 290 && type < 300)
+        DxfDoubleArray *array = NULL;
+        size_t size;
+
+        size = sizeof (DxfDoubleArray);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((array = malloc (size)) == NULL)
         {
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-                return TRUE;
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                array = NULL;
         }
         else
         {
+                memset (array, 0, size);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-                return FALSE;
-        }
+        return (array);
 }
 
 
 /*!
- * \brief Test for int16_t type group codes.
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfDoubleArray.
+ *
+ * The array is empty, no memory is allocated for values until they
+ * are appended.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
  */
-int
-dxf_read_is_int16_t
+DxfDoubleArray *
+dxf_double_array_init
 (
-        int type
+        DxfDoubleArray *array
+                /*!< a pointer to the \c DxfDoubleArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                array = dxf_double_array_new ();
+        }
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        array->values = NULL;
+        array->length = 0;
+        array->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Make sure a \c DxfDoubleArray can hold at least \c capacity
+ * values without reallocating.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_double_array_reserve
+(
+        DxfDoubleArray *array,
+                /*!< a pointer to the \c DxfDoubleArray. */
+        size_t capacity
+                /*!< the number of values to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *values = NULL;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (capacity > array->capacity)
+        {
+                values = realloc (array->values, capacity * sizeof (double));
+                if (values == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                array->values = values;
+                array->capacity = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a value to a \c DxfDoubleArray.
+ *
+ * The capacity is doubled when the array is full, so appending costs
+ * amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_double_array_append
+(
+        DxfDoubleArray *array,
+                /*!< a pointer to the \c DxfDoubleArray. */
+        double value
+                /*!< the value to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((array->length == array->capacity)
+          && (dxf_double_array_reserve (array, (array->capacity > 0) ? 2 * array->capacity : 16) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        array->values[array->length] = value;
+        array->length++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append \c length values at once to a \c DxfDoubleArray.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_double_array_append_values
+(
+        DxfDoubleArray *array,
+                /*!< a pointer to the \c DxfDoubleArray. */
+        const double *values,
+                /*!< the values to append. */
+        size_t length
+                /*!< the number of values to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t capacity;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((values == NULL) && (length > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (array->length + length > array->capacity)
+        {
+                capacity = (array->capacity > 0) ? array->capacity : 16;
+                while (capacity < array->length + length)
+                {
+                        capacity *= 2;
+                }
+                if (dxf_double_array_reserve (array, capacity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (length > 0)
+        {
+                memcpy (array->values + array->length, values, length * sizeof (double));
+                array->length += length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append all values of a single linked list of \c DxfDouble to a
+ * \c DxfDoubleArray.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_double_array_append_list
+(
+        DxfDoubleArray *array,
+                /*!< a pointer to the \c DxfDoubleArray. */
+        DxfDouble *list
+                /*!< a pointer to the first \c DxfDouble in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDouble *iter = NULL;
+        size_t length = 0;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfDouble *) iter->next)
+        {
+                length++;
+        }
+        if (dxf_double_array_reserve (array, array->length + length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfDouble *) iter->next)
+        {
+                array->values[array->length] = iter->value;
+                array->length++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the contiguous values of a \c DxfDoubleArray.
+ *
+ * \warning No copy is made, the returned pointer is invalidated by the
+ * next append to the array.
+ *
+ * \return a pointer to the values, or \c NULL when the array is empty
+ * or an error occurred.
+ */
+double *
+dxf_double_array_get_values
+(
+        DxfDoubleArray *array
+                /*!< a pointer to the \c DxfDoubleArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->values);
+}
+
+
+/*!
+ * \brief Get the number of values in a \c DxfDoubleArray.
+ *
+ * \return the number of values, or 0 when an error occurred.
+ */
+size_t
+dxf_double_array_get_length
+(
+        DxfDoubleArray *array
+                /*!< a pointer to the \c DxfDoubleArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->length);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfDoubleArray and its
+ * values.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_double_array_free
+(
+        DxfDoubleArray *array
+                /*!< a pointer to the \c DxfDoubleArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (array->values);
+        free (array);
+        array = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy a \c DxfDoubleArray.
+ *
+ * The copy does not share any memory with \c array, its capacity
+ * equals the length of \c array.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfDoubleArray *
+dxf_double_array_copy
+(
+        DxfDoubleArray *array
+                /*!< a pointer to the \c DxfDoubleArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDoubleArray *copy;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_double_array_init (dxf_double_array_new ());
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        if ((array->length > 0)
+          && (dxf_double_array_append_values (copy, array->values, array->length) == EXIT_FAILURE))
+        {
+                dxf_double_array_free (copy);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfIntArray.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfIntArray *
+dxf_int_array_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfIntArray *array = NULL;
+        size_t size;
+
+        size = sizeof (DxfIntArray);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((array = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                array = NULL;
+        }
+        else
+        {
+                memset (array, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfIntArray.
+ *
+ * The array is empty, no memory is allocated for values until they
+ * are appended.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfIntArray *
+dxf_int_array_init
+(
+        DxfIntArray *array
+                /*!< a pointer to the \c DxfIntArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                array = dxf_int_array_new ();
+        }
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        array->values = NULL;
+        array->length = 0;
+        array->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Make sure a \c DxfIntArray can hold at least \c capacity
+ * values without reallocating.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int_array_reserve
+(
+        DxfIntArray *array,
+                /*!< a pointer to the \c DxfIntArray. */
+        size_t capacity
+                /*!< the number of values to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int *values = NULL;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (capacity > array->capacity)
+        {
+                values = realloc (array->values, capacity * sizeof (int));
+                if (values == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                array->values = values;
+                array->capacity = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a value to a \c DxfIntArray.
+ *
+ * The capacity is doubled when the array is full, so appending costs
+ * amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int_array_append
+(
+        DxfIntArray *array,
+                /*!< a pointer to the \c DxfIntArray. */
+        int value
+                /*!< the value to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((array->length == array->capacity)
+          && (dxf_int_array_reserve (array, (array->capacity > 0) ? 2 * array->capacity : 16) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        array->values[array->length] = value;
+        array->length++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append \c length values at once to a \c DxfIntArray.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int_array_append_values
+(
+        DxfIntArray *array,
+                /*!< a pointer to the \c DxfIntArray. */
+        const int *values,
+                /*!< the values to append. */
+        size_t length
+                /*!< the number of values to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t capacity;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((values == NULL) && (length > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (array->length + length > array->capacity)
+        {
+                capacity = (array->capacity > 0) ? array->capacity : 16;
+                while (capacity < array->length + length)
+                {
+                        capacity *= 2;
+                }
+                if (dxf_int_array_reserve (array, capacity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (length > 0)
+        {
+                memcpy (array->values + array->length, values, length * sizeof (int));
+                array->length += length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append all values of a single linked list of \c DxfInt to a
+ * \c DxfIntArray.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int_array_append_list
+(
+        DxfIntArray *array,
+                /*!< a pointer to the \c DxfIntArray. */
+        DxfInt *list
+                /*!< a pointer to the first \c DxfInt in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt *iter = NULL;
+        size_t length = 0;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt *) iter->next)
+        {
+                length++;
+        }
+        if (dxf_int_array_reserve (array, array->length + length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt *) iter->next)
+        {
+                array->values[array->length] = iter->value;
+                array->length++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the contiguous values of a \c DxfIntArray.
+ *
+ * \warning No copy is made, the returned pointer is invalidated by the
+ * next append to the array.
+ *
+ * \return a pointer to the values, or \c NULL when the array is empty
+ * or an error occurred.
+ */
+int *
+dxf_int_array_get_values
+(
+        DxfIntArray *array
+                /*!< a pointer to the \c DxfIntArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->values);
+}
+
+
+/*!
+ * \brief Get the number of values in a \c DxfIntArray.
+ *
+ * \return the number of values, or 0 when an error occurred.
+ */
+size_t
+dxf_int_array_get_length
+(
+        DxfIntArray *array
+                /*!< a pointer to the \c DxfIntArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->length);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfIntArray and its
+ * values.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int_array_free
+(
+        DxfIntArray *array
+                /*!< a pointer to the \c DxfIntArray. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (array->values);
+        free (array);
+        array = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfInt16Array.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfInt16Array *
+dxf_int16_array_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt16Array *array = NULL;
+        size_t size;
+
+        size = sizeof (DxfInt16Array);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((array = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                array = NULL;
+        }
+        else
+        {
+                memset (array, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfInt16Array.
+ *
+ * The array is empty, no memory is allocated for values until they
+ * are appended.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfInt16Array *
+dxf_int16_array_init
+(
+        DxfInt16Array *array
+                /*!< a pointer to the \c DxfInt16Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                array = dxf_int16_array_new ();
+        }
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        array->values = NULL;
+        array->length = 0;
+        array->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Make sure a \c DxfInt16Array can hold at least \c capacity
+ * values without reallocating.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int16_array_reserve
+(
+        DxfInt16Array *array,
+                /*!< a pointer to the \c DxfInt16Array. */
+        size_t capacity
+                /*!< the number of values to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int16_t *values = NULL;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (capacity > array->capacity)
+        {
+                values = realloc (array->values, capacity * sizeof (int16_t));
+                if (values == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                array->values = values;
+                array->capacity = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a value to a \c DxfInt16Array.
+ *
+ * The capacity is doubled when the array is full, so appending costs
+ * amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int16_array_append
+(
+        DxfInt16Array *array,
+                /*!< a pointer to the \c DxfInt16Array. */
+        int16_t value
+                /*!< the value to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((array->length == array->capacity)
+          && (dxf_int16_array_reserve (array, (array->capacity > 0) ? 2 * array->capacity : 16) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        array->values[array->length] = value;
+        array->length++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append \c length values at once to a \c DxfInt16Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int16_array_append_values
+(
+        DxfInt16Array *array,
+                /*!< a pointer to the \c DxfInt16Array. */
+        const int16_t *values,
+                /*!< the values to append. */
+        size_t length
+                /*!< the number of values to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t capacity;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((values == NULL) && (length > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (array->length + length > array->capacity)
+        {
+                capacity = (array->capacity > 0) ? array->capacity : 16;
+                while (capacity < array->length + length)
+                {
+                        capacity *= 2;
+                }
+                if (dxf_int16_array_reserve (array, capacity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (length > 0)
+        {
+                memcpy (array->values + array->length, values, length * sizeof (int16_t));
+                array->length += length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append all values of a single linked list of \c DxfInt16 to a
+ * \c DxfInt16Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int16_array_append_list
+(
+        DxfInt16Array *array,
+                /*!< a pointer to the \c DxfInt16Array. */
+        DxfInt16 *list
+                /*!< a pointer to the first \c DxfInt16 in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt16 *iter = NULL;
+        size_t length = 0;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt16 *) iter->next)
+        {
+                length++;
+        }
+        if (dxf_int16_array_reserve (array, array->length + length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt16 *) iter->next)
+        {
+                array->values[array->length] = iter->value;
+                array->length++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the contiguous values of a \c DxfInt16Array.
+ *
+ * \warning No copy is made, the returned pointer is invalidated by the
+ * next append to the array.
+ *
+ * \return a pointer to the values, or \c NULL when the array is empty
+ * or an error occurred.
+ */
+int16_t *
+dxf_int16_array_get_values
+(
+        DxfInt16Array *array
+                /*!< a pointer to the \c DxfInt16Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->values);
+}
+
+
+/*!
+ * \brief Get the number of values in a \c DxfInt16Array.
+ *
+ * \return the number of values, or 0 when an error occurred.
+ */
+size_t
+dxf_int16_array_get_length
+(
+        DxfInt16Array *array
+                /*!< a pointer to the \c DxfInt16Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->length);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfInt16Array and its
+ * values.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int16_array_free
+(
+        DxfInt16Array *array
+                /*!< a pointer to the \c DxfInt16Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (array->values);
+        free (array);
+        array = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfInt32Array.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfInt32Array *
+dxf_int32_array_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt32Array *array = NULL;
+        size_t size;
+
+        size = sizeof (DxfInt32Array);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((array = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                array = NULL;
+        }
+        else
+        {
+                memset (array, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfInt32Array.
+ *
+ * The array is empty, no memory is allocated for values until they
+ * are appended.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfInt32Array *
+dxf_int32_array_init
+(
+        DxfInt32Array *array
+                /*!< a pointer to the \c DxfInt32Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                array = dxf_int32_array_new ();
+        }
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        array->values = NULL;
+        array->length = 0;
+        array->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Make sure a \c DxfInt32Array can hold at least \c capacity
+ * values without reallocating.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int32_array_reserve
+(
+        DxfInt32Array *array,
+                /*!< a pointer to the \c DxfInt32Array. */
+        size_t capacity
+                /*!< the number of values to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int32_t *values = NULL;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (capacity > array->capacity)
+        {
+                values = realloc (array->values, capacity * sizeof (int32_t));
+                if (values == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                array->values = values;
+                array->capacity = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a value to a \c DxfInt32Array.
+ *
+ * The capacity is doubled when the array is full, so appending costs
+ * amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int32_array_append
+(
+        DxfInt32Array *array,
+                /*!< a pointer to the \c DxfInt32Array. */
+        int32_t value
+                /*!< the value to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((array->length == array->capacity)
+          && (dxf_int32_array_reserve (array, (array->capacity > 0) ? 2 * array->capacity : 16) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        array->values[array->length] = value;
+        array->length++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append \c length values at once to a \c DxfInt32Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int32_array_append_values
+(
+        DxfInt32Array *array,
+                /*!< a pointer to the \c DxfInt32Array. */
+        const int32_t *values,
+                /*!< the values to append. */
+        size_t length
+                /*!< the number of values to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t capacity;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((values == NULL) && (length > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (array->length + length > array->capacity)
+        {
+                capacity = (array->capacity > 0) ? array->capacity : 16;
+                while (capacity < array->length + length)
+                {
+                        capacity *= 2;
+                }
+                if (dxf_int32_array_reserve (array, capacity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (length > 0)
+        {
+                memcpy (array->values + array->length, values, length * sizeof (int32_t));
+                array->length += length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append all values of a single linked list of \c DxfInt32 to a
+ * \c DxfInt32Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int32_array_append_list
+(
+        DxfInt32Array *array,
+                /*!< a pointer to the \c DxfInt32Array. */
+        DxfInt32 *list
+                /*!< a pointer to the first \c DxfInt32 in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt32 *iter = NULL;
+        size_t length = 0;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt32 *) iter->next)
+        {
+                length++;
+        }
+        if (dxf_int32_array_reserve (array, array->length + length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt32 *) iter->next)
+        {
+                array->values[array->length] = iter->value;
+                array->length++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the contiguous values of a \c DxfInt32Array.
+ *
+ * \warning No copy is made, the returned pointer is invalidated by the
+ * next append to the array.
+ *
+ * \return a pointer to the values, or \c NULL when the array is empty
+ * or an error occurred.
+ */
+int32_t *
+dxf_int32_array_get_values
+(
+        DxfInt32Array *array
+                /*!< a pointer to the \c DxfInt32Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->values);
+}
+
+
+/*!
+ * \brief Get the number of values in a \c DxfInt32Array.
+ *
+ * \return the number of values, or 0 when an error occurred.
+ */
+size_t
+dxf_int32_array_get_length
+(
+        DxfInt32Array *array
+                /*!< a pointer to the \c DxfInt32Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->length);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfInt32Array and its
+ * values.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int32_array_free
+(
+        DxfInt32Array *array
+                /*!< a pointer to the \c DxfInt32Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (array->values);
+        free (array);
+        array = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfInt64Array.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfInt64Array *
+dxf_int64_array_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt64Array *array = NULL;
+        size_t size;
+
+        size = sizeof (DxfInt64Array);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((array = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                array = NULL;
+        }
+        else
+        {
+                memset (array, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfInt64Array.
+ *
+ * The array is empty, no memory is allocated for values until they
+ * are appended.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfInt64Array *
+dxf_int64_array_init
+(
+        DxfInt64Array *array
+                /*!< a pointer to the \c DxfInt64Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                array = dxf_int64_array_new ();
+        }
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        array->values = NULL;
+        array->length = 0;
+        array->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array);
+}
+
+
+/*!
+ * \brief Make sure a \c DxfInt64Array can hold at least \c capacity
+ * values without reallocating.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int64_array_reserve
+(
+        DxfInt64Array *array,
+                /*!< a pointer to the \c DxfInt64Array. */
+        size_t capacity
+                /*!< the number of values to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int64_t *values = NULL;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (capacity > array->capacity)
+        {
+                values = realloc (array->values, capacity * sizeof (int64_t));
+                if (values == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                array->values = values;
+                array->capacity = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a value to a \c DxfInt64Array.
+ *
+ * The capacity is doubled when the array is full, so appending costs
+ * amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int64_array_append
+(
+        DxfInt64Array *array,
+                /*!< a pointer to the \c DxfInt64Array. */
+        int64_t value
+                /*!< the value to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((array->length == array->capacity)
+          && (dxf_int64_array_reserve (array, (array->capacity > 0) ? 2 * array->capacity : 16) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        array->values[array->length] = value;
+        array->length++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append \c length values at once to a \c DxfInt64Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int64_array_append_values
+(
+        DxfInt64Array *array,
+                /*!< a pointer to the \c DxfInt64Array. */
+        const int64_t *values,
+                /*!< the values to append. */
+        size_t length
+                /*!< the number of values to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t capacity;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((values == NULL) && (length > 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (array->length + length > array->capacity)
+        {
+                capacity = (array->capacity > 0) ? array->capacity : 16;
+                while (capacity < array->length + length)
+                {
+                        capacity *= 2;
+                }
+                if (dxf_int64_array_reserve (array, capacity) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (length > 0)
+        {
+                memcpy (array->values + array->length, values, length * sizeof (int64_t));
+                array->length += length;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append all values of a single linked list of \c DxfInt64 to a
+ * \c DxfInt64Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int64_array_append_list
+(
+        DxfInt64Array *array,
+                /*!< a pointer to the \c DxfInt64Array. */
+        DxfInt64 *list
+                /*!< a pointer to the first \c DxfInt64 in the list. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInt64 *iter = NULL;
+        size_t length = 0;
+
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt64 *) iter->next)
+        {
+                length++;
+        }
+        if (dxf_int64_array_reserve (array, array->length + length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (iter = list; iter != NULL; iter = (DxfInt64 *) iter->next)
+        {
+                array->values[array->length] = iter->value;
+                array->length++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the contiguous values of a \c DxfInt64Array.
+ *
+ * \warning No copy is made, the returned pointer is invalidated by the
+ * next append to the array.
+ *
+ * \return a pointer to the values, or \c NULL when the array is empty
+ * or an error occurred.
+ */
+int64_t *
+dxf_int64_array_get_values
+(
+        DxfInt64Array *array
+                /*!< a pointer to the \c DxfInt64Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->values);
+}
+
+
+/*!
+ * \brief Get the number of values in a \c DxfInt64Array.
+ *
+ * \return the number of values, or 0 when an error occurred.
+ */
+size_t
+dxf_int64_array_get_length
+(
+        DxfInt64Array *array
+                /*!< a pointer to the \c DxfInt64Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (array->length);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfInt64Array and its
+ * values.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_int64_array_free
+(
+        DxfInt64Array *array
+                /*!< a pointer to the \c DxfInt64Array. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (array == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (array->values);
+        free (array);
+        array = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test for double type group codes.
+ */
+int
+dxf_read_is_double
+(
+        int type
+                /*!< Group code. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if ((type >= 10 && type < 60)
+          || (type >= 110 && type < 150)
+          || (type >= 210 && type < 240)
+          || (type >= 460 && type < 470)
+          || (type >= 1010 && type < 1060))
+        {
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+                return TRUE;
+        }
+        else
+        {
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+                return FALSE;
+        }
+}
+
+
+/*!
+ * \brief Test for int type group codes (Boolean).
+ */
+int
+dxf_read_is_int
+(
+        int type
+                /*!< Group code. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (type >= 290 && type < 300)
+        {
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+                return TRUE;
+        }
+        else
+        {
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+                return FALSE;
+        }
+}
+
+
+/*!
+ * \brief Test for int16_t type group codes.
+ */
+int
+dxf_read_is_int16_t
+(
+        int type
                 /*!< Group code. */
 )
 {
@@ -2353,6 +4661,10 @@ dxf_read_init
         file->fp = fp;
         file->filename = strdup(filename);
         file->line_number = 0;
+        file->single_precision = FALSE;
+        file->origin_x = 0.0;
+        file->origin_y = 0.0;
+        file->origin_z = 0.0;
         /*! \todo FIXME: dxf header and blocks need initialized ?
         dxf_header_init (file->dxf_header);
         dxf_block_init (file->dxf_block);
@@ -2364,6 +4676,56 @@ dxf_read_init
 }
 
 
+/*!
+ * \brief Read entity geometry from \c fp as single precision offsets
+ * from an origin.
+ *
+ * Entities which support it (currently \c LINE, \c 3DFACE, \c MESH,
+ * the vertices of a \c LWPOLYLINE and the polyline boundary paths of a
+ * \c HATCH) store their coordinates as \c float offsets from
+ * (\c origin_x, \c origin_y, \c origin_z), which halves the memory
+ * used for their geometry.\n
+ * Pick an origin near the middle of the drawing (e.g. with
+ * dxf_header_get_extents_center ()) to keep the precision loss small.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_set_single_precision
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        double origin_x,
+                /*!< X-coordinate of the origin. */
+        double origin_y,
+                /*!< Y-coordinate of the origin. */
+        double origin_z
+                /*!< Z-coordinate of the origin. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->single_precision = TRUE;
+        fp->origin_x = origin_x;
+        fp->origin_y = origin_y;
+        fp->origin_z = origin_z;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 void
 dxf_read_close
 (
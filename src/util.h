@@ -73,8 +73,10 @@ DxfChar *dxf_char_set_length (DxfChar *c, int length);
 DxfChar *dxf_char_get_next (DxfChar *c);
 DxfChar *dxf_char_set_next (DxfChar *c, DxfChar *next);
 DxfChar *dxf_char_get_last (DxfChar *c);
+DxfChar *dxf_char_append (DxfChar *last, DxfChar *c);
 int dxf_char_free (DxfChar *c);
 int dxf_char_free_list (DxfChar *chars);
+DxfChar *dxf_char_copy_list (DxfChar *chars);
 DxfDouble *dxf_double_new ();
 DxfDouble *dxf_double_init (DxfDouble *d);
 double dxf_double_get_value (DxfDouble *d);
@@ -82,6 +84,7 @@ DxfDouble *dxf_double_set_value (DxfDouble *d, double value);
 DxfDouble *dxf_double_get_next (DxfDouble *d);
 DxfDouble *dxf_double_set_next (DxfDouble *d, DxfDouble *next);
 DxfDouble *dxf_double_get_last (DxfDouble *d);
+DxfDouble *dxf_double_append (DxfDouble *last, DxfDouble *d);
 int dxf_double_free (DxfDouble *d);
 int dxf_double_free_list (DxfDouble *doubles);
 DxfInt *dxf_int_new ();
@@ -91,6 +94,7 @@ DxfInt *dxf_int_set_value (DxfInt *i, int value);
 DxfInt *dxf_int_get_next (DxfInt *i);
 DxfInt *dxf_int_set_next (DxfInt *i, DxfInt *next);
 DxfInt *dxf_int_get_last (DxfInt *i);
+DxfInt *dxf_int_append (DxfInt *last, DxfInt *i);
 int dxf_int_free (DxfInt *i);
 int dxf_int_free_list (DxfInt *ints);
 DxfInt16 *dxf_int16_new ();
@@ -100,6 +104,7 @@ DxfInt16 *dxf_int16_set_value (DxfInt16 *i, int16_t value);
 DxfInt16 *dxf_int16_get_next (DxfInt16 *i);
 DxfInt16 *dxf_int16_set_next (DxfInt16 *i, DxfInt16 *next);
 DxfInt16 *dxf_int16_get_last (DxfInt16 *i);
+DxfInt16 *dxf_int16_append (DxfInt16 *last, DxfInt16 *i);
 int dxf_int16_free (DxfInt16 *i);
 int dxf_int16_free_list (DxfInt16 *ints);
 DxfInt32 *dxf_int32_new ();
@@ -109,6 +114,7 @@ DxfInt32 *dxf_int32_set_value (DxfInt32 *i, int32_t value);
 DxfInt32 *dxf_int32_get_next (DxfInt32 *i);
 DxfInt32 *dxf_int32_set_next (DxfInt32 *i, DxfInt32 *next);
 DxfInt32 *dxf_int32_get_last (DxfInt32 *i);
+DxfInt32 *dxf_int32_append (DxfInt32 *last, DxfInt32 *i);
 int dxf_int32_free (DxfInt32 *i);
 int dxf_int32_free_list (DxfInt32 *ints);
 DxfInt64 *dxf_int64_new ();
@@ -118,6 +124,53 @@ DxfInt64 *dxf_int64_set_value (DxfInt64 *i, int64_t value);
 DxfInt64 *dxf_int64_get_next (DxfInt64 *i);
 DxfInt64 *dxf_int64_set_next (DxfInt64 *i, DxfInt64 *next);
 DxfInt64 *dxf_int64_get_last (DxfInt64 *i);
+DxfInt64 *dxf_int64_append (DxfInt64 *last, DxfInt64 *i);
+DxfDoubleArray *dxf_double_array_new ();
+DxfDoubleArray *dxf_double_array_init (DxfDoubleArray *array);
+int dxf_double_array_reserve (DxfDoubleArray *array, size_t capacity);
+int dxf_double_array_append (DxfDoubleArray *array, double value);
+int dxf_double_array_append_values (DxfDoubleArray *array, const double *values, size_t length);
+int dxf_double_array_append_list (DxfDoubleArray *array, DxfDouble *list);
+double *dxf_double_array_get_values (DxfDoubleArray *array);
+size_t dxf_double_array_get_length (DxfDoubleArray *array);
+int dxf_double_array_free (DxfDoubleArray *array);
+DxfDoubleArray *dxf_double_array_copy (DxfDoubleArray *array);
+DxfIntArray *dxf_int_array_new ();
+DxfIntArray *dxf_int_array_init (DxfIntArray *array);
+int dxf_int_array_reserve (DxfIntArray *array, size_t capacity);
+int dxf_int_array_append (DxfIntArray *array, int value);
+int dxf_int_array_append_values (DxfIntArray *array, const int *values, size_t length);
+int dxf_int_array_append_list (DxfIntArray *array, DxfInt *list);
+int *dxf_int_array_get_values (DxfIntArray *array);
+size_t dxf_int_array_get_length (DxfIntArray *array);
+int dxf_int_array_free (DxfIntArray *array);
+DxfInt16Array *dxf_int16_array_new ();
+DxfInt16Array *dxf_int16_array_init (DxfInt16Array *array);
+int dxf_int16_array_reserve (DxfInt16Array *array, size_t capacity);
+int dxf_int16_array_append (DxfInt16Array *array, int16_t value);
+int dxf_int16_array_append_values (DxfInt16Array *array, const int16_t *values, size_t length);
+int dxf_int16_array_append_list (DxfInt16Array *array, DxfInt16 *list);
+int16_t *dxf_int16_array_get_values (DxfInt16Array *array);
+size_t dxf_int16_array_get_length (DxfInt16Array *array);
+int dxf_int16_array_free (DxfInt16Array *array);
+DxfInt32Array *dxf_int32_array_new ();
+DxfInt32Array *dxf_int32_array_init (DxfInt32Array *array);
+int dxf_int32_array_reserve (DxfInt32Array *array, size_t capacity);
+int dxf_int32_array_append (DxfInt32Array *array, int32_t value);
+int dxf_int32_array_append_values (DxfInt32Array *array, const int32_t *values, size_t length);
+int dxf_int32_array_append_list (DxfInt32Array *array, DxfInt32 *list);
+int32_t *dxf_int32_array_get_values (DxfInt32Array *array);
+size_t dxf_int32_array_get_length (DxfInt32Array *array);
+int dxf_int32_array_free (DxfInt32Array *array);
+DxfInt64Array *dxf_int64_array_new ();
+DxfInt64Array *dxf_int64_array_init (DxfInt64Array *array);
+int dxf_int64_array_reserve (DxfInt64Array *array, size_t capacity);
+int dxf_int64_array_append (DxfInt64Array *array, int64_t value);
+int dxf_int64_array_append_values (DxfInt64Array *array, const int64_t *values, size_t length);
+int dxf_int64_array_append_list (DxfInt64Array *array, DxfInt64 *list);
+int64_t *dxf_int64_array_get_values (DxfInt64Array *array);
+size_t dxf_int64_array_get_length (DxfInt64Array *array);
+int dxf_int64_array_free (DxfInt64Array *array);
 int dxf_read_is_double (int type);
 int dxf_read_is_int (int type);
 int dxf_read_is_int16_t (int type);
@@ -128,6 +181,7 @@ int dxf_read_line (char * temp_string, DxfFile *fp);
 int dxf_read_scanf (DxfFile *fp, const char *template, ...);
 DxfFile *dxf_read_init (const char *filename);
 void dxf_read_close (DxfFile *file);
+int dxf_read_set_single_precision (DxfFile *fp, double origin_x, double origin_y, double origin_z);
 
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 
 
 #include "vertex.h"
+#include "entities.h"
 
 
 /*!
@@ -110,27 +111,13 @@ dxf_vertex_init
                 __FUNCTION__);
               return (NULL);
         }
-        vertex->id_code = 0;
-        vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        vertex->layer = strdup (DXF_DEFAULT_LAYER);
-        vertex->elevation = 0.0;
-        vertex->thickness = 0.0;
-        vertex->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        vertex->visibility = DXF_DEFAULT_VISIBILITY;
-        vertex->color = DXF_COLOR_BYLAYER;
-        vertex->paperspace = DXF_MODELSPACE;
-        vertex->graphics_data_size = 0;
-        vertex->shadow_mode = 0;
-        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data);
-        vertex->dictionary_owner_soft = strdup ("");
-        vertex->material = strdup ("");
-        vertex->dictionary_owner_hard = strdup ("");
-        vertex->lineweight = 0;
-        vertex->plot_style_name = strdup ("");
-        vertex->color_value = 0;
-        vertex->color_name = strdup ("");
-        vertex->transparency = 0;
+        if (dxf_entity_common_init (&vertex->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         vertex->p0 = (DxfPoint *) dxf_point_new ();
         vertex->p0 = dxf_point_init ((DxfPoint *) vertex->p0);
         vertex->p0->x0 = 0.0;
@@ -176,7 +163,9 @@ dxf_vertex_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,8 +173,6 @@ dxf_vertex_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vertex == NULL)
@@ -193,297 +180,114 @@ dxf_vertex_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                vertex = dxf_vertex_init (vertex);
+                vertex = dxf_vertex_init (dxf_vertex_new ());
+                if (vertex == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &vertex->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->p0->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0)
-                        && (vertex->elevation != 0.0))
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * end width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->end_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the
-                         * bulge. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->bulge);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->linetype_scale);
-                }
-                else if (strcmp (temp_string, "50") == 0)
-                {
-                        /* Now follows a string containing the
-                         * curve fitting tangent. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &vertex->curve_fit_tangent_direction);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &vertex->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->paperspace);
-                }
-                else if (strcmp (temp_string, "70") == 0)
-                {
-                        /* Now follows a string containing the flag
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->flag);
-                }
-                else if (strcmp (temp_string, "71") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_1);
-                }
-                else if (strcmp (temp_string, "72") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_2);
-                }
-                else if (strcmp (temp_string, "73") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_3);
-                }
-                else if (strcmp (temp_string, "74") == 0)
-                {
-                        /* Now follows a string containing the Polyface
-                         * mesh vertex index value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->polyface_mesh_vertex_index_4);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->graphics_data_size);
+                        break;
                 }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && (strcmp (temp_string, "AcDbVertex") != 0)
-                        && (strcmp (temp_string, "AcDb2dVertex") != 0)
-                        && (strcmp (temp_string, "AcDb3dPolylineVertex") != 0))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &vertex->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &vertex->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data->next);
-                        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) vertex->binary_graphics_data->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        /* Now follows a string containing Soft-pointer
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_soft);
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &vertex->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &vertex->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &vertex->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 10:
+                                vertex->p0->x0 = atof (value);
+                                break;
+                        case 20:
+                                vertex->p0->y0 = atof (value);
+                                break;
+                        case 30:
+                                vertex->p0->z0 = atof (value);
+                                break;
+                        case 40:
+                                vertex->start_width = atof (value);
+                                break;
+                        case 41:
+                                vertex->end_width = atof (value);
+                                break;
+                        case 42:
+                                vertex->bulge = atof (value);
+                                break;
+                        case 50:
+                                vertex->curve_fit_tangent_direction = atof (value);
+                                break;
+                        case 70:
+                                vertex->flag = atoi (value);
+                                break;
+                        case 71:
+                                vertex->polyface_mesh_vertex_index_1 = atoi (value);
+                                break;
+                        case 72:
+                                vertex->polyface_mesh_vertex_index_2 = atoi (value);
+                                break;
+                        case 73:
+                                vertex->polyface_mesh_vertex_index_3 = atoi (value);
+                                break;
+                        case 74:
+                                vertex->polyface_mesh_vertex_index_4 = atoi (value);
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((fp->acad_version_number >= AutoCAD_13)
+                                  && (strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbVertex") != 0)
+                                  && (strcmp (value, "AcDb2dVertex") != 0)
+                                  && (strcmp (value, "AcDb3dPolylineVertex") != 0)
+                                  && (strcmp (value, "AcDbPolyFaceMeshVertex") != 0)
+                                  && (strcmp (value, "AcDbFaceRecord") != 0)
+                                  && (strcmp (value, "AcDbPolygonMeshVertex") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &vertex->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (vertex->linetype, "") == 0)
+        if ((vertex->common.linetype == NULL)
+          || (strcmp (vertex->common.linetype, "") == 0))
         {
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (vertex->common.linetype);
+                vertex->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (vertex->layer, "") == 0)
+        if ((vertex->common.layer == NULL)
+          || (strcmp (vertex->common.layer, "") == 0))
         {
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                free (vertex->common.layer);
+                vertex->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -530,31 +334,31 @@ dxf_vertex_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (vertex->linetype, "") == 0)
+        if (strcmp (vertex->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, vertex->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, vertex->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is reset to default linetype")),
                   dxf_entity_name);
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                vertex->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (vertex->layer, "") == 0)
+        if (strcmp (vertex->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, vertex->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, vertex->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0")),
                   dxf_entity_name);
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                vertex->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (vertex->id_code != -1)
+        if (vertex->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", vertex->id_code);
+                dxf_handle_write (fp, 5, vertex->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -566,55 +370,55 @@ dxf_vertex_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (vertex->dictionary_owner_soft, "") != 0)
+        if ((vertex->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", vertex->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, vertex->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (vertex->dictionary_owner_hard, "") != 0)
+        if ((vertex->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", vertex->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, vertex->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (vertex->paperspace == DXF_PAPERSPACE)
+        if (vertex->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", vertex->layer);
-        if (strcmp (vertex->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", vertex->common.layer);
+        if (strcmp (vertex->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", vertex->linetype);
+                fprintf (fp->fp, "  6\n%s\n", vertex->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (vertex->elevation != 0.0))
+          && (vertex->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", vertex->elevation);
+                fprintf (fp->fp, " 38\n%f\n", vertex->common.elevation);
         }
-        if (vertex->color != DXF_COLOR_BYLAYER)
+        if (vertex->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", vertex->color);
+                fprintf (fp->fp, " 62\n%hd\n", vertex->common.color);
         }
-        if (vertex->linetype_scale != 1.0)
+        if (vertex->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", vertex->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", vertex->common.linetype_scale);
         }
-        if (vertex->visibility != 0)
+        if (vertex->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", vertex->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", vertex->common.visibility);
         }
         /*! \todo Put \c thickness in the correct order. */ 
-        if (vertex->thickness != 0.0)
+        if (vertex->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", vertex->thickness);
+                fprintf (fp->fp, " 39\n%f\n", vertex->common.thickness);
         }
         fprintf (fp->fp, "100\nAcDbVertex\n");
         if ((DXF_CHECK_BIT (vertex->flag, 0))
@@ -669,6 +473,7 @@ dxf_vertex_write
                 fprintf (fp->fp, " 74\n%d\n", vertex->polyface_mesh_vertex_index_4);
         }
         fprintf (fp->fp, " 91\n%d\n", vertex->vertex_identifier);
+        dxf_entity_common_write_xdata (fp, &vertex->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -710,14 +515,7 @@ dxf_vertex_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex->linetype);
-        free (vertex->layer);
-        dxf_binary_graphics_data_free_list (vertex->binary_graphics_data);
-        free (vertex->dictionary_owner_soft);
-        free (vertex->material);
-        free (vertex->dictionary_owner_hard);
-        free (vertex->plot_style_name);
-        free (vertex->color_name);
+        dxf_entity_common_free (&vertex->common);
         dxf_point_free (vertex->p0);
         free (vertex);
         vertex = NULL;
@@ -752,6 +550,7 @@ dxf_vertex_free_list
         while (vertices != NULL)
         {
                 DxfVertex *iter = (DxfVertex *) vertices->next;
+                vertices->next = NULL;
                 dxf_vertex_free (vertices);
                 vertices = (DxfVertex *) iter;
         }
@@ -761,12 +560,76 @@ dxf_vertex_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c VERTEX entity.
+ *
+ * The copy does not share any memory with \c vertex, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfVertex *
+dxf_vertex_copy
+(
+        DxfVertex *vertex
+                /*!< a pointer to the DXF \c VERTEX entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *copy;
+
+        /* Do some basic checks. */
+        if (vertex == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_vertex_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, vertex, sizeof (DxfVertex));
+        copy->p0 = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &vertex->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_vertex_free (copy);
+                return (NULL);
+        }
+        if (vertex->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (vertex->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_vertex_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c VERTEX entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_vertex_get_id_code
 (
         DxfVertex *vertex
@@ -784,16 +647,10 @@ dxf_vertex_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->id_code);
+        return (vertex->common.id_code);
 }
 
 
@@ -805,7 +662,7 @@ dxf_vertex_set_id_code
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -822,13 +679,7 @@ dxf_vertex_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        vertex->id_code = id_code;
+        vertex->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -859,7 +710,7 @@ dxf_vertex_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->linetype ==  NULL)
+        if (vertex->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -869,7 +720,7 @@ dxf_vertex_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->linetype));
+        return (strdup (vertex->common.linetype));
 }
 
 
@@ -904,7 +755,7 @@ dxf_vertex_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->linetype = strdup (linetype);
+        vertex->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -935,7 +786,7 @@ dxf_vertex_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->layer ==  NULL)
+        if (vertex->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -945,7 +796,7 @@ dxf_vertex_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->layer));
+        return (strdup (vertex->common.layer));
 }
 
 
@@ -980,7 +831,7 @@ dxf_vertex_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->layer = strdup (layer);
+        vertex->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1014,7 +865,7 @@ dxf_vertex_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->elevation);
+        return (vertex->common.elevation);
 }
 
 
@@ -1041,7 +892,7 @@ dxf_vertex_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->elevation = elevation;
+        vertex->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1072,7 +923,7 @@ dxf_vertex_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->thickness < 0.0)
+        if (vertex->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1081,7 +932,7 @@ dxf_vertex_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->thickness);
+        return (vertex->common.thickness);
 }
 
 
@@ -1114,7 +965,7 @@ dxf_vertex_set_thickness
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        vertex->thickness = thickness;
+        vertex->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1145,7 +996,7 @@ dxf_vertex_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->linetype_scale < 0.0)
+        if (vertex->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1154,7 +1005,7 @@ dxf_vertex_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->linetype_scale);
+        return (vertex->common.linetype_scale);
 }
 
 
@@ -1187,7 +1038,7 @@ dxf_vertex_set_linetype_scale
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        vertex->linetype_scale = linetype_scale;
+        vertex->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1218,13 +1069,13 @@ dxf_vertex_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->visibility < 0)
+        if (vertex->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (vertex->visibility > 1)
+        if (vertex->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1233,7 +1084,7 @@ dxf_vertex_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->visibility);
+        return (vertex->common.visibility);
 }
 
 
@@ -1272,7 +1123,7 @@ dxf_vertex_set_visibility
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
-        vertex->visibility = visibility;
+        vertex->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1303,7 +1154,7 @@ dxf_vertex_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->color < 0)
+        if (vertex->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1312,7 +1163,7 @@ dxf_vertex_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->color);
+        return (vertex->common.color);
 }
 
 
@@ -1345,7 +1196,7 @@ dxf_vertex_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        vertex->color = color;
+        vertex->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1376,13 +1227,13 @@ dxf_vertex_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->paperspace < 0)
+        if (vertex->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (vertex->paperspace > 1)
+        if (vertex->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1391,7 +1242,7 @@ dxf_vertex_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->paperspace);
+        return (vertex->common.paperspace);
 }
 
 
@@ -1433,7 +1284,7 @@ dxf_vertex_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->paperspace = paperspace;
+        vertex->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1466,13 +1317,13 @@ dxf_vertex_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->graphics_data_size < 0)
+        if (vertex->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (vertex->graphics_data_size == 0)
+        if (vertex->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1481,7 +1332,7 @@ dxf_vertex_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->graphics_data_size);
+        return (vertex->common.cold->graphics_data_size);
 }
 
 
@@ -1525,7 +1376,7 @@ dxf_vertex_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        vertex->graphics_data_size = graphics_data_size;
+        vertex->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1557,14 +1408,14 @@ dxf_vertex_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->shadow_mode < 0)
+        if (vertex->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vertex->shadow_mode > 3)
+        if (vertex->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1574,7 +1425,7 @@ dxf_vertex_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->shadow_mode);
+        return (vertex->common.cold->shadow_mode);
 }
 
 
@@ -1618,7 +1469,7 @@ dxf_vertex_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->shadow_mode = shadow_mode;
+        vertex->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1630,11 +1481,12 @@ dxf_vertex_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c VERTEX entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_vertex_get_binary_graphics_data
 (
         DxfVertex *vertex
@@ -1652,32 +1504,31 @@ dxf_vertex_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) vertex->binary_graphics_data);
+        return (vertex->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c VERTEX entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c vertex when successful, or \c NULL when an
+ * error occurred.
  */
 DxfVertex *
 dxf_vertex_set_binary_graphics_data
 (
         DxfVertex *vertex,
                 /*!< a pointer to a DXF \c VERTEX entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1698,7 +1549,12 @@ dxf_vertex_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((vertex->common.cold->binary_graphics_data != NULL)
+          && (vertex->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (vertex->common.cold->binary_graphics_data);
+        }
+        vertex->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1732,17 +1588,10 @@ dxf_vertex_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->dictionary_owner_soft));
+        return (dxf_handle_to_string (vertex->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1778,7 +1627,7 @@ dxf_vertex_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        vertex->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1812,17 +1661,10 @@ dxf_vertex_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->material));
+        return (dxf_handle_to_string (vertex->common.cold->material));
 }
 
 
@@ -1860,7 +1702,7 @@ dxf_vertex_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->material = strdup (material);
+        vertex->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1894,17 +1736,10 @@ dxf_vertex_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->dictionary_owner_hard));
+        return (dxf_handle_to_string (vertex->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1940,7 +1775,7 @@ dxf_vertex_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        vertex->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1975,7 +1810,7 @@ dxf_vertex_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->lineweight);
+        return (vertex->common.lineweight);
 }
 
 
@@ -2005,7 +1840,7 @@ dxf_vertex_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->lineweight = lineweight;
+        vertex->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2037,17 +1872,10 @@ dxf_vertex_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->plot_style_name));
+        return (dxf_handle_to_string (vertex->common.cold->plot_style_name));
 }
 
 
@@ -2085,7 +1913,7 @@ dxf_vertex_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->plot_style_name = strdup (plot_style_name);
+        vertex->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2120,7 +1948,7 @@ dxf_vertex_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->color_value);
+        return (vertex->common.color_value);
 }
 
 
@@ -2150,7 +1978,7 @@ dxf_vertex_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->color_value = color_value;
+        vertex->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2182,7 +2010,7 @@ dxf_vertex_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vertex->color_name ==  NULL)
+        if (vertex->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2192,7 +2020,7 @@ dxf_vertex_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vertex->color_name));
+        return (strdup (vertex->common.cold->color_name));
 }
 
 
@@ -2230,7 +2058,7 @@ dxf_vertex_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->color_name = strdup (color_name);
+        vertex->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2265,7 +2093,7 @@ dxf_vertex_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (vertex->transparency);
+        return (vertex->common.cold->transparency);
 }
 
 
@@ -2295,7 +2123,7 @@ dxf_vertex_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        vertex->transparency = transparency;
+        vertex->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -136,8 +136,8 @@ dxf_view_init
         view->twist_angle = 0.0;
         view->flag = 0;
         view->mode = 0;
-        view->dictionary_owner_soft = strdup ("");
-        view->dictionary_owner_hard = strdup ("");
+        view->dictionary_owner_soft = DXF_HANDLE_NONE;
+        view->dictionary_owner_hard = DXF_HANDLE_NONE;
         view->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -206,8 +206,7 @@ dxf_view_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &view->id_code);
+                        view->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -350,15 +349,13 @@ dxf_view_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, view->dictionary_owner_soft);
+                        view->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, view->dictionary_owner_hard);
+                        view->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -426,7 +423,7 @@ dxf_view_write
           || (strcmp (view->name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
+                  (_("Error in %s () empty UCS name string for the %s entity with id-code: %" PRIx64 "\n")),
                   __FUNCTION__, dxf_entity_name, view->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -437,9 +434,9 @@ dxf_view_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (view->id_code != -1)
+        if (view->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", view->id_code);
+                dxf_handle_write (fp, 5, view->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -451,18 +448,18 @@ dxf_view_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (view->dictionary_owner_soft, "") != 0)
+        if ((view->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", view->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, view->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (view->dictionary_owner_hard, "") != 0)
+        if ((view->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", view->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, view->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -529,8 +526,9 @@ dxf_view_free
                 return (EXIT_FAILURE);
         }
         free (view->name);
-        free (view->dictionary_owner_soft);
-        free (view->dictionary_owner_hard);
+        dxf_point_free (view->p0);
+        dxf_point_free (view->p1);
+        dxf_point_free (view->p2);
         free (view);
         view = NULL;
 #if DEBUG
@@ -564,6 +562,7 @@ dxf_view_free_list
         while (views != NULL)
         {
                 DxfView *iter = (DxfView *) views->next;
+                views->next = NULL;
                 dxf_view_free (views);
                 views = (DxfView *) iter;
         }
@@ -573,12 +572,101 @@ dxf_view_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c VIEW symbol table entry.
+ *
+ * The copy does not share any memory with \c view, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfView *
+dxf_view_copy
+(
+        DxfView *view
+                /*!< a pointer to the DXF \c VIEW symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfView *copy;
+
+        /* Do some basic checks. */
+        if (view == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_view_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, view, sizeof (DxfView));
+        copy->name = NULL;
+        copy->p0 = NULL;
+        copy->p1 = NULL;
+        copy->p2 = NULL;
+        copy->next = NULL;
+        if (view->name != NULL)
+        {
+                copy->name = strdup (view->name);
+                if (copy->name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_view_free (copy);
+                        return (NULL);
+                }
+        }
+        if (view->p0 != NULL)
+        {
+                copy->p0 = dxf_point_copy (view->p0);
+                if (copy->p0 == NULL)
+                {
+                        dxf_view_free (copy);
+                        return (NULL);
+                }
+        }
+        if (view->p1 != NULL)
+        {
+                copy->p1 = dxf_point_copy (view->p1);
+                if (copy->p1 == NULL)
+                {
+                        dxf_view_free (copy);
+                        return (NULL);
+                }
+        }
+        if (view->p2 != NULL)
+        {
+                copy->p2 = dxf_point_copy (view->p2);
+                if (copy->p2 == NULL)
+                {
+                        dxf_view_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c VIEW symbol table entry.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_view_get_id_code
 (
         DxfView *view
@@ -596,12 +684,6 @@ dxf_view_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (view->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -617,7 +699,7 @@ dxf_view_set_id_code
 (
         DxfView *view,
                 /*!< a pointer to a DXF \c VIEW symbol table entry. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entry.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -634,12 +716,6 @@ dxf_view_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         view->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -2191,17 +2267,10 @@ dxf_view_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (view->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->dictionary_owner_soft));
+        return (dxf_handle_to_string (view->dictionary_owner_soft));
 }
 
 
@@ -2237,7 +2306,7 @@ dxf_view_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        view->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        view->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2271,17 +2340,10 @@ dxf_view_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (view->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (view->dictionary_owner_hard));
+        return (dxf_handle_to_string (view->dictionary_owner_hard));
 }
 
 
@@ -2317,7 +2379,7 @@ dxf_view_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        view->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        view->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -43,6 +43,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "point.h"
 
 
@@ -60,7 +61,7 @@ extern "C" {
 typedef struct
 dxf_view_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -116,11 +117,11 @@ dxf_view_struct
         int mode;
                 /*!< View mode (see \c VIEWMODE system variable).\n
                  * Group code = 71. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -136,8 +137,9 @@ DxfView *dxf_view_read (DxfFile *fp, DxfView *view);
 int dxf_view_write (DxfFile *fp, DxfView *view);
 int dxf_view_free (DxfView *view);
 void dxf_view_free_list (DxfView *views);
-int dxf_view_get_id_code (DxfView *view);
-DxfView *dxf_view_set_id_code (DxfView *view, int id_code);
+DxfView *dxf_view_copy (DxfView *view);
+DxfHandle dxf_view_get_id_code (DxfView *view);
+DxfView *dxf_view_set_id_code (DxfView *view, DxfHandle id_code);
 char *dxf_view_get_name (DxfView *view);
 DxfView *dxf_view_set_name (DxfView *view, char *view_name);
 DxfPoint *dxf_view_get_p0 (DxfView *view);
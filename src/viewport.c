@@ -40,6 +40,7 @@
 
 
 #include "viewport.h"
+#include "entities.h"
 
 
 /*!
@@ -109,24 +110,23 @@ dxf_viewport_init
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->id_code = 0;
-        viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        viewport->layer = strdup (DXF_DEFAULT_LAYER);
+        if (dxf_entity_common_init (&viewport->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         viewport->center = dxf_point_new ();
         viewport->center = dxf_point_init (viewport->center);
         viewport->center->x0 = 0.0;
         viewport->center->y0 = 0.0;
         viewport->center->z0 = 0.0;
-        viewport->elevation = 0.0;
-        viewport->thickness = 0.0;
-        viewport->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        viewport->visibility = DXF_DEFAULT_VISIBILITY;
         viewport->width = 0.0;
         viewport->height = 0.0;
         viewport->status = 0;
         viewport->id = 1; /* Always 1. */
-        viewport->color = DXF_COLOR_BYLAYER;
-        viewport->paperspace = DXF_PAPERSPACE; /* Always on PAPERSPACE. */
+        viewport->common.paperspace = DXF_PAPERSPACE; /* Always on PAPERSPACE. */
         viewport->app_name = strdup ("ACAD"); /* Always "ACAD". */
         viewport->viewport_data = strdup ("MVIEW"); /* Always "MVIEW". */
         viewport->window_descriptor_begin = strdup ("{"); /* Always "{". */
@@ -173,15 +173,9 @@ dxf_viewport_init
         viewport->grid_spacing->y0 = 0.0;
         viewport->plot_flag = 0;
         viewport->frozen_layer_list_begin = strdup ("{"); /* Always "{". */
-        viewport->frozen_layers = dxf_char_new ();
-        viewport->frozen_layers = dxf_char_init (viewport->frozen_layers);
-        viewport->frozen_layers->value = strdup ("");
-        viewport->frozen_layers->length = 0;
-        viewport->frozen_layers->next = NULL;
+        viewport->frozen_layers = dxf_char_init (dxf_char_new ());
         viewport->frozen_layer_list_end = strdup ("}"); /* Always "}". */
         viewport->window_descriptor_end = strdup ("}"); /* Always "}". */
-        viewport->dictionary_owner_soft = strdup ("");
-        viewport->dictionary_owner_hard = strdup ("");
         viewport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -214,8 +208,16 @@ dxf_viewport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
         DxfChar *iter = NULL;
+        int n1002 = 0;
+        int n1010 = 0;
+        int n1020 = 0;
+        int n1030 = 0;
+        int n1040 = 0;
+        int n1070 = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -223,8 +225,6 @@ dxf_viewport_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (viewport == NULL)
@@ -232,783 +232,287 @@ dxf_viewport_read
                 fprintf (stderr,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                viewport = dxf_viewport_init (viewport);
+                viewport = dxf_viewport_init (dxf_viewport_new ());
+                if (viewport == NULL)
+                {
+                        return (NULL);
+                }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        for (;;)
         {
-                if (ferror (fp->fp))
+                if (dxf_entities_get_line (fp->fp, code, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
                         fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &viewport->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->center->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->center->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->center->z0);
-                }
-                else if ((fp->acad_version_number <= AutoCAD_11)
-                        && (strcmp (temp_string, "38") == 0))
-                {
-                        /* Elevation is a pre AutoCAD R11 variable
-                         * so additional testing for the version should
-                         * probably be added.
-                         * Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->thickness);
-                }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * width. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->height);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &viewport->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->paperspace);
-                }
-                else if (strcmp (temp_string, "68") == 0)
-                {
-                        /* Now follows a string containing the
-                         * status value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->status);
+                        break;
                 }
-                else if (strcmp (temp_string, "69") == 0)
+                (fp->line_number)++;
+                group_code = atoi (code);
+                if (group_code == 0)
                 {
-                        /* Now follows a string containing the
-                         * id. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->id);
+                        /* The next line contains the name of the
+                         * following entity. */
+                        break;
                 }
-                else if (strcmp (temp_string, "999") == 0)
+                if (dxf_entities_get_line (fp->fp, value, DXF_MAX_STRING_LENGTH) == EXIT_FAILURE)
                 {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
                 }
-                else if (strcmp (temp_string, "1001") == 0)
+                (fp->line_number)++;
+                switch (group_code)
                 {
-                        /* Now follows a sequence of ordered data fields. */
-                        /* Now follows a string containing the appname,
-                         * always "ACAD". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->app_name);
-                        if (strcmp (viewport->app_name, "ACAD") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string followed after group code 1001.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1000") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the viewport
-                         * data, always "MVIEW". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->viewport_data);
-                        if (strcmp (viewport->viewport_data, "MVIEW") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the window
-                         * begin descriptor, always "{". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_begin);
-                        if (strcmp (viewport->window_descriptor_begin, "{") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr, "    unexpected content in string.\n");
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the extended
-                         * entity data version number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->extended_entity_data_version);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1010") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X-target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->target->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1020") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y-target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->target->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1030") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Z-target. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->target->z0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1010") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X-direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->direction->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1020") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y-direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->direction->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1030") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Z-direction. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->direction->z0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the view
-                         * twist angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_twist_angle);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the view
-                         * height. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_height);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the
-                         * X-coordinate of the view center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_center->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the
-                         * Y-coordinate of the view center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->view_center->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the
-                         * perspective lens length. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->perspective_lens_length);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the front
-                         * clipping plane offset. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->front_plane_offset);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the back
-                         * clipping plane offset. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->back_plane_offset);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the view mode. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->view_mode);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the circle
-                         * zoom percent. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->circle_zoom_percent);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the fast zoom
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->fast_zoom_setting);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the ICS ICON
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->UCSICON_setting);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap on
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->snap_on);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the grid on
-                         * setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->grid_on);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap
-                         * style setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->snap_style);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap
-                         * isopair setting. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->snap_isopair);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the snap
-                         * rotation angle. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_rotation_angle);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X snap
-                         * base. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_base->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y snap
-                         * base. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_base->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the X snap
-                         * spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_spacing->x0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the Y snap
-                         * spacing. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &viewport->snap_spacing->y0);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the plot flag. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &viewport->plot_flag);
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the frozen
-                         * layer list begin descriptor, always "{". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_begin);
-                        if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code
-                         * value of "1003". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1003") == 0)
-                        {
-                                /* Start a loop reading all frozen layer
-                                 * names and bail out when a group code
-                                 * with a value of "1002" is encountered.*/
-                                /*! \todo Do a proper implementation of reading frozen layers.*/
-                                iter = (DxfChar *) viewport->frozen_layers;
-                                do
+                        case 10:
+                                viewport->center->x0 = atof (value);
+                                break;
+                        case 20:
+                                viewport->center->y0 = atof (value);
+                                break;
+                        case 30:
+                                viewport->center->z0 = atof (value);
+                                break;
+                        case 40:
+                                viewport->width = atof (value);
+                                break;
+                        case 41:
+                                viewport->height = atof (value);
+                                break;
+                        case 68:
+                                viewport->status = atoi (value);
+                                break;
+                        case 69:
+                                viewport->id = atoi (value);
+                                break;
+                        case 1000:
+                                free (viewport->viewport_data);
+                                viewport->viewport_data = strdup (value);
+                                break;
+                        case 1001:
+                                free (viewport->app_name);
+                                viewport->app_name = strdup (value);
+                                break;
+                        case 1002:
+                                /* The descriptors follow in the order window begin,
+                                 * frozen layer list begin, frozen layer list end and
+                                 * window end. */
+                                switch (n1002)
+                                {
+                                        case 0:
+                                                free (viewport->window_descriptor_begin);
+                                                viewport->window_descriptor_begin = strdup (value);
+                                                break;
+                                        case 1:
+                                                free (viewport->frozen_layer_list_begin);
+                                                viewport->frozen_layer_list_begin = strdup (value);
+                                                break;
+                                        case 2:
+                                                free (viewport->frozen_layer_list_end);
+                                                viewport->frozen_layer_list_end = strdup (value);
+                                                break;
+                                        default:
+                                                free (viewport->window_descriptor_end);
+                                                viewport->window_descriptor_end = strdup (value);
+                                                break;
+                                }
+                                n1002++;
+                                break;
+                        case 1003:
+                                /* Frozen layer names, the first one is stored in the
+                                 * node allocated by dxf_viewport_init (). */
+                                if (iter == NULL)
                                 {
-                                        (fp->line_number)++;
-                                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                                        /* Now follows a string containing a group code. */
-                                        (fp->line_number)++;
-                                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                                        iter->next = (DxfChar *) dxf_char_init ((DxfChar *) iter->next);
+                                        iter = viewport->frozen_layers;
+                                }
+                                else
+                                {
+                                        iter->next = (struct DxfChar *) dxf_char_init (dxf_char_new ());
                                         iter = (DxfChar *) iter->next;
                                 }
-                                while ((strcmp (temp_string, "1003") == 0));
-                                /* We have initialised the next DxfChar
-                                 * and then left the loop.
-                                 * The next DxfChar contains no valid
-                                 * value, so we have to clean up. */
-                                dxf_char_free ((DxfChar *) iter->next);
-                                iter->next = NULL;
-                        }
-                        else
-                        {
-                                /* Either we found an empty list or we
-                                 * have found an exception. */
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected end of frozen layer list found.\n")));
-                                return (NULL);
-                        }
-                        /* Now we are expecting temp_string to contain a
-                         * group code value of "1002". */
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the frozen
-                         * layer list end descriptor, always "}". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_end);
-                        if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string sequence found.\n")));
-                                return (NULL);
-                        }
-                        /* Now follows a string containing the window
-                         * end descriptor, always "}". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_end);
-                        if (strcmp (viewport->window_descriptor_end, "}") == 1)
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
-                                  (_("\tunexpected content in string.\n")));
-                                return (NULL);
-                        }
-                }
-                /* End of sequential ordered data fields. */
-                else 
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
+                                free (iter->value);
+                                iter->value = strdup (value);
+                                iter->length = strlen (value);
+                                break;
+                        case 1010:
+                                switch (n1010)
+                                {
+                                        case 0:
+                                                viewport->target->x0 = atof (value);
+                                                break;
+                                        case 1:
+                                                viewport->direction->x0 = atof (value);
+                                                break;
+                                        default:
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () unexpected extended data found while reading from: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                                break;
+                                }
+                                n1010++;
+                                break;
+                        case 1020:
+                                switch (n1020)
+                                {
+                                        case 0:
+                                                viewport->target->y0 = atof (value);
+                                                break;
+                                        case 1:
+                                                viewport->direction->y0 = atof (value);
+                                                break;
+                                        default:
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () unexpected extended data found while reading from: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                                break;
+                                }
+                                n1020++;
+                                break;
+                        case 1030:
+                                switch (n1030)
+                                {
+                                        case 0:
+                                                viewport->target->z0 = atof (value);
+                                                break;
+                                        case 1:
+                                                viewport->direction->z0 = atof (value);
+                                                break;
+                                        default:
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () unexpected extended data found while reading from: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                                break;
+                                }
+                                n1030++;
+                                break;
+                        case 1040:
+                                switch (n1040)
+                                {
+                                        case 0:
+                                                viewport->view_twist_angle = atof (value);
+                                                break;
+                                        case 1:
+                                                viewport->view_height = atof (value);
+                                                break;
+                                        case 2:
+                                                viewport->view_center->x0 = atof (value);
+                                                break;
+                                        case 3:
+                                                viewport->view_center->y0 = atof (value);
+                                                break;
+                                        case 4:
+                                                viewport->perspective_lens_length = atof (value);
+                                                break;
+                                        case 5:
+                                                viewport->front_plane_offset = atof (value);
+                                                break;
+                                        case 6:
+                                                viewport->back_plane_offset = atof (value);
+                                                break;
+                                        case 7:
+                                                viewport->snap_rotation_angle = atof (value);
+                                                break;
+                                        case 8:
+                                                viewport->snap_base->x0 = atof (value);
+                                                break;
+                                        case 9:
+                                                viewport->snap_base->y0 = atof (value);
+                                                break;
+                                        case 10:
+                                                viewport->snap_spacing->x0 = atof (value);
+                                                break;
+                                        case 11:
+                                                viewport->snap_spacing->y0 = atof (value);
+                                                break;
+                                        case 12:
+                                                viewport->grid_spacing->x0 = atof (value);
+                                                break;
+                                        case 13:
+                                                viewport->grid_spacing->y0 = atof (value);
+                                                break;
+                                        default:
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () unexpected extended data found while reading from: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                                break;
+                                }
+                                n1040++;
+                                break;
+                        case 1070:
+                                switch (n1070)
+                                {
+                                        case 0:
+                                                viewport->extended_entity_data_version = atoi (value);
+                                                break;
+                                        case 1:
+                                                viewport->view_mode = atoi (value);
+                                                break;
+                                        case 2:
+                                                viewport->circle_zoom_percent = atoi (value);
+                                                break;
+                                        case 3:
+                                                viewport->fast_zoom_setting = atoi (value);
+                                                break;
+                                        case 4:
+                                                viewport->UCSICON_setting = atoi (value);
+                                                break;
+                                        case 5:
+                                                viewport->snap_on = atoi (value);
+                                                break;
+                                        case 6:
+                                                viewport->grid_on = atoi (value);
+                                                break;
+                                        case 7:
+                                                viewport->snap_style = atoi (value);
+                                                break;
+                                        case 8:
+                                                viewport->snap_isopair = atoi (value);
+                                                break;
+                                        case 9:
+                                                viewport->plot_flag = atoi (value);
+                                                break;
+                                        default:
+                                                fprintf (stderr,
+                                                  (_("Warning in %s () unexpected extended data found while reading from: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                                break;
+                                }
+                                n1070++;
+                                break;
+                        case 100:
+                                /* Subclass marker value. */
+                                if ((strcmp (value, "AcDbEntity") != 0)
+                                  && (strcmp (value, "AcDbViewport") != 0))
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
+                        default:
+                                if (dxf_entity_common_read_pair (fp, &viewport->common, group_code, value) == FALSE)
+                                {
+                                        fprintf (stderr,
+                                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                          __FUNCTION__, fp->filename, fp->line_number);
+                                }
+                                break;
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (viewport->linetype, "") == 0)
+        if ((viewport->common.linetype == NULL)
+          || (strcmp (viewport->common.linetype, "") == 0))
         {
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                free (viewport->common.linetype);
+                viewport->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (viewport->layer, "") == 0)
+        if ((viewport->common.layer == NULL)
+          || (strcmp (viewport->common.layer, "") == 0))
         {
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                free (viewport->common.layer);
+                viewport->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1056,31 +560,31 @@ dxf_viewport_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (viewport->linetype, "") == 0)
+        if (strcmp (viewport->common.linetype, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, viewport->id_code);
+                  (_("Warning in %s () empty linetype string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, viewport->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (viewport->layer, "") == 0)
+        if (strcmp (viewport->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
-                  __FUNCTION__, dxf_entity_name, viewport->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 ".\n")),
+                  __FUNCTION__, dxf_entity_name, viewport->common.id_code);
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (viewport->id_code != -1)
+        if (viewport->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", viewport->id_code);
+                dxf_handle_write (fp, 5, viewport->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -1092,58 +596,58 @@ dxf_viewport_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (viewport->dictionary_owner_soft, "") != 0)
+        if ((viewport->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", viewport->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, viewport->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (viewport->dictionary_owner_hard, "") != 0)
+        if ((viewport->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", viewport->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, viewport->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (viewport->paperspace == DXF_PAPERSPACE)
+        if (viewport->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", viewport->layer);
-        if (strcmp (viewport->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", viewport->common.layer);
+        if (strcmp (viewport->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", viewport->linetype);
+                fprintf (fp->fp, "  6\n%s\n", viewport->common.linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (viewport->elevation != 0.0))
+          && (viewport->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", viewport->elevation);
+                fprintf (fp->fp, " 38\n%f\n", viewport->common.elevation);
         }
-        if (viewport->color != DXF_COLOR_BYLAYER)
+        if (viewport->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", viewport->color);
+                fprintf (fp->fp, " 62\n%hd\n", viewport->common.color);
         }
-        if (viewport->linetype_scale != 1.0)
+        if (viewport->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", viewport->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", viewport->common.linetype_scale);
         }
-        if (viewport->visibility != 0)
+        if (viewport->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", viewport->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", viewport->common.visibility);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbViewport\n");
         }
-        if (viewport->thickness != 0.0)
+        if (viewport->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", viewport->thickness);
+                fprintf (fp->fp, " 39\n%f\n", viewport->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", viewport->center->x0);
         fprintf (fp->fp, " 20\n%f\n", viewport->center->y0);
@@ -1200,6 +704,7 @@ dxf_viewport_write
         }
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_FROZEN_LAYER_LIST_END);
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_WINDOW_END);
+        dxf_entity_common_write_xdata (fp, &viewport->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -1242,8 +747,14 @@ dxf_viewport_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (viewport->linetype);
-        free (viewport->layer);
+        dxf_entity_common_free (&viewport->common);
+        dxf_point_free (viewport->center);
+        dxf_point_free (viewport->direction);
+        dxf_point_free (viewport->grid_spacing);
+        dxf_point_free (viewport->snap_base);
+        dxf_point_free (viewport->snap_spacing);
+        dxf_point_free (viewport->target);
+        dxf_point_free (viewport->view_center);
         free (viewport->app_name);
         free (viewport->viewport_data);
         free (viewport->window_descriptor_begin);
@@ -1284,6 +795,7 @@ dxf_viewport_free_list
         while (viewports != NULL)
         {
                 DxfViewport *iter = (DxfViewport *) viewports->next;
+                viewports->next = NULL;
                 dxf_viewport_free (viewports);
                 viewports = (DxfViewport *) iter;
         }
@@ -1293,12 +805,224 @@ dxf_viewport_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c VIEWPORT entity.
+ *
+ * The copy does not share any memory with \c viewport, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfViewport *
+dxf_viewport_copy
+(
+        DxfViewport *viewport
+                /*!< a pointer to the DXF \c VIEWPORT entity to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfViewport *copy;
+
+        /* Do some basic checks. */
+        if (viewport == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_viewport_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, viewport, sizeof (DxfViewport));
+        copy->center = NULL;
+        copy->target = NULL;
+        copy->direction = NULL;
+        copy->view_center = NULL;
+        copy->snap_base = NULL;
+        copy->snap_spacing = NULL;
+        copy->grid_spacing = NULL;
+        copy->app_name = NULL;
+        copy->viewport_data = NULL;
+        copy->window_descriptor_begin = NULL;
+        copy->frozen_layer_list_begin = NULL;
+        copy->frozen_layers = NULL;
+        copy->frozen_layer_list_end = NULL;
+        copy->window_descriptor_end = NULL;
+        copy->next = NULL;
+        if (dxf_entity_common_copy (&copy->common, &viewport->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_viewport_free (copy);
+                return (NULL);
+        }
+        if (viewport->center != NULL)
+        {
+                copy->center = dxf_point_copy (viewport->center);
+                if (copy->center == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->target != NULL)
+        {
+                copy->target = dxf_point_copy (viewport->target);
+                if (copy->target == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->direction != NULL)
+        {
+                copy->direction = dxf_point_copy (viewport->direction);
+                if (copy->direction == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->view_center != NULL)
+        {
+                copy->view_center = dxf_point_copy (viewport->view_center);
+                if (copy->view_center == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->snap_base != NULL)
+        {
+                copy->snap_base = dxf_point_copy (viewport->snap_base);
+                if (copy->snap_base == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->snap_spacing != NULL)
+        {
+                copy->snap_spacing = dxf_point_copy (viewport->snap_spacing);
+                if (copy->snap_spacing == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->grid_spacing != NULL)
+        {
+                copy->grid_spacing = dxf_point_copy (viewport->grid_spacing);
+                if (copy->grid_spacing == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->app_name != NULL)
+        {
+                copy->app_name = strdup (viewport->app_name);
+                if (copy->app_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->viewport_data != NULL)
+        {
+                copy->viewport_data = strdup (viewport->viewport_data);
+                if (copy->viewport_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->window_descriptor_begin != NULL)
+        {
+                copy->window_descriptor_begin = strdup (viewport->window_descriptor_begin);
+                if (copy->window_descriptor_begin == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->frozen_layer_list_begin != NULL)
+        {
+                copy->frozen_layer_list_begin = strdup (viewport->frozen_layer_list_begin);
+                if (copy->frozen_layer_list_begin == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->frozen_layers != NULL)
+        {
+                copy->frozen_layers = dxf_char_copy_list (viewport->frozen_layers);
+                if (copy->frozen_layers == NULL)
+                {
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->frozen_layer_list_end != NULL)
+        {
+                copy->frozen_layer_list_end = strdup (viewport->frozen_layer_list_end);
+                if (copy->frozen_layer_list_end == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (viewport->window_descriptor_end != NULL)
+        {
+                copy->window_descriptor_end = strdup (viewport->window_descriptor_end);
+                if (copy->window_descriptor_end == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_viewport_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c VIEWPORT entity.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_viewport_get_id_code
 (
         DxfViewport *viewport
@@ -1316,16 +1040,10 @@ dxf_viewport_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->id_code);
+        return (viewport->common.id_code);
 }
 
 
@@ -1337,7 +1055,7 @@ dxf_viewport_set_id_code
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entity.\n
                  * This is to be an unique (sequential) number in the
                  * DXF file. */
@@ -1354,13 +1072,7 @@ dxf_viewport_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        viewport->id_code = id_code;
+        viewport->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1391,7 +1103,7 @@ dxf_viewport_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->linetype ==  NULL)
+        if (viewport->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1401,7 +1113,7 @@ dxf_viewport_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->linetype));
+        return (strdup (viewport->common.linetype));
 }
 
 
@@ -1436,7 +1148,7 @@ dxf_viewport_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->linetype = strdup (linetype);
+        viewport->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1467,7 +1179,7 @@ dxf_viewport_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->layer ==  NULL)
+        if (viewport->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -1477,7 +1189,7 @@ dxf_viewport_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->layer));
+        return (strdup (viewport->common.layer));
 }
 
 
@@ -1512,7 +1224,7 @@ dxf_viewport_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->layer = strdup (layer);
+        viewport->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1546,7 +1258,7 @@ dxf_viewport_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->elevation);
+        return (viewport->common.elevation);
 }
 
 
@@ -1573,7 +1285,7 @@ dxf_viewport_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->elevation = elevation;
+        viewport->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1604,7 +1316,7 @@ dxf_viewport_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->thickness < 0.0)
+        if (viewport->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1614,7 +1326,7 @@ dxf_viewport_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->thickness);
+        return (viewport->common.thickness);
 }
 
 
@@ -1648,7 +1360,7 @@ dxf_viewport_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->thickness = thickness;
+        viewport->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1679,7 +1391,7 @@ dxf_viewport_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->linetype_scale < 0.0)
+        if (viewport->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1689,7 +1401,7 @@ dxf_viewport_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->linetype_scale);
+        return (viewport->common.linetype_scale);
 }
 
 
@@ -1723,7 +1435,7 @@ dxf_viewport_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->linetype_scale = linetype_scale;
+        viewport->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1754,14 +1466,14 @@ dxf_viewport_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->visibility < 0)
+        if (viewport->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->visibility > 1)
+        if (viewport->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1771,7 +1483,7 @@ dxf_viewport_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->visibility);
+        return (viewport->common.visibility);
 }
 
 
@@ -1812,7 +1524,7 @@ dxf_viewport_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->visibility = visibility;
+        viewport->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1843,7 +1555,7 @@ dxf_viewport_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->color < 0)
+        if (viewport->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1852,7 +1564,7 @@ dxf_viewport_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->color);
+        return (viewport->common.color);
 }
 
 
@@ -1885,7 +1597,7 @@ dxf_viewport_set_color
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        viewport->color = color;
+        viewport->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1916,13 +1628,13 @@ dxf_viewport_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->paperspace < 0)
+        if (viewport->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (viewport->paperspace > 1)
+        if (viewport->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1931,7 +1643,7 @@ dxf_viewport_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->paperspace);
+        return (viewport->common.paperspace);
 }
 
 
@@ -1973,7 +1685,7 @@ dxf_viewport_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->paperspace = paperspace;
+        viewport->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2006,13 +1718,13 @@ dxf_viewport_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->graphics_data_size < 0)
+        if (viewport->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (viewport->graphics_data_size == 0)
+        if (viewport->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -2021,7 +1733,7 @@ dxf_viewport_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->graphics_data_size);
+        return (viewport->common.cold->graphics_data_size);
 }
 
 
@@ -2065,7 +1777,7 @@ dxf_viewport_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        viewport->graphics_data_size = graphics_data_size;
+        viewport->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2097,14 +1809,14 @@ dxf_viewport_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->shadow_mode < 0)
+        if (viewport->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (viewport->shadow_mode > 3)
+        if (viewport->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -2114,7 +1826,7 @@ dxf_viewport_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->shadow_mode);
+        return (viewport->common.cold->shadow_mode);
 }
 
 
@@ -2158,7 +1870,7 @@ dxf_viewport_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->shadow_mode = shadow_mode;
+        viewport->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2170,11 +1882,12 @@ dxf_viewport_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c VIEWPORT entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_viewport_get_binary_graphics_data
 (
         DxfViewport *viewport
@@ -2192,32 +1905,31 @@ dxf_viewport_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) viewport->binary_graphics_data);
+        return (viewport->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c VIEWPORT entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c viewport when successful, or \c NULL when an
+ * error occurred.
  */
 DxfViewport *
 dxf_viewport_set_binary_graphics_data
 (
         DxfViewport *viewport,
                 /*!< a pointer to a DXF \c VIEWPORT entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -2238,7 +1950,12 @@ dxf_viewport_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((viewport->common.cold->binary_graphics_data != NULL)
+          && (viewport->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (viewport->common.cold->binary_graphics_data);
+        }
+        viewport->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2272,17 +1989,10 @@ dxf_viewport_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->dictionary_owner_soft));
+        return (dxf_handle_to_string (viewport->common.cold->dictionary_owner_soft));
 }
 
 
@@ -2318,7 +2028,7 @@ dxf_viewport_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        viewport->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2353,17 +2063,10 @@ dxf_viewport_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->material));
+        return (dxf_handle_to_string (viewport->common.cold->material));
 }
 
 
@@ -2402,7 +2105,7 @@ dxf_viewport_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->material = strdup (material);
+        viewport->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2436,17 +2139,10 @@ dxf_viewport_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->dictionary_owner_hard));
+        return (dxf_handle_to_string (viewport->common.cold->dictionary_owner_hard));
 }
 
 
@@ -2482,7 +2178,7 @@ dxf_viewport_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        viewport->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2517,7 +2213,7 @@ dxf_viewport_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->lineweight);
+        return (viewport->common.lineweight);
 }
 
 
@@ -2547,7 +2243,7 @@ dxf_viewport_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->lineweight = lineweight;
+        viewport->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2579,17 +2275,10 @@ dxf_viewport_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->plot_style_name));
+        return (dxf_handle_to_string (viewport->common.cold->plot_style_name));
 }
 
 
@@ -2627,7 +2316,7 @@ dxf_viewport_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->plot_style_name = strdup (plot_style_name);
+        viewport->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2662,7 +2351,7 @@ dxf_viewport_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->color_value);
+        return (viewport->common.color_value);
 }
 
 
@@ -2692,7 +2381,7 @@ dxf_viewport_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->color_value = color_value;
+        viewport->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2724,7 +2413,7 @@ dxf_viewport_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (viewport->color_name ==  NULL)
+        if (viewport->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2734,7 +2423,7 @@ dxf_viewport_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (viewport->color_name));
+        return (strdup (viewport->common.cold->color_name));
 }
 
 
@@ -2772,7 +2461,7 @@ dxf_viewport_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->color_name = strdup (color_name);
+        viewport->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2807,7 +2496,7 @@ dxf_viewport_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (viewport->transparency);
+        return (viewport->common.cold->transparency);
 }
 
 
@@ -2837,7 +2526,7 @@ dxf_viewport_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        viewport->transparency = transparency;
+        viewport->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
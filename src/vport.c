@@ -169,8 +169,8 @@ dxf_vport_init
         vport->grid_on = 0;
         vport->snap_style = 0;
         vport->snap_isopair = 0;
-        vport->dictionary_owner_soft = strdup ("");
-        vport->dictionary_owner_hard = strdup ("");
+        vport->dictionary_owner_soft = DXF_HANDLE_NONE;
+        vport->dictionary_owner_hard = DXF_HANDLE_NONE;
         vport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -297,8 +297,7 @@ dxf_vport_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &vport->id_code);
+                        vport->id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
@@ -563,15 +562,13 @@ dxf_vport_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->dictionary_owner_soft);
+                        vport->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->dictionary_owner_hard);
+                        vport->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -641,7 +638,7 @@ dxf_vport_write
           || (strcmp (vport->viewport_name, "") == 0))
         {
                 fprintf (stderr,
-                  (_("Error: empty viewport name string for the %s entity with id-code: %x\n")),
+                  (_("Error: empty viewport name string for the %s entity with id-code: %" PRIx64 "\n")),
                   dxf_entity_name, vport->id_code);
                 fprintf (stderr,
                   (_("\t%s entity is discarded from output.\n")),
@@ -724,9 +721,9 @@ dxf_vport_write
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (vport->id_code != -1)
+        if (vport->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", vport->id_code);
+                dxf_handle_write (fp, 5, vport->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -738,18 +735,18 @@ dxf_vport_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (vport->dictionary_owner_soft, "") != 0)
+        if ((vport->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", vport->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, vport->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (vport->dictionary_owner_hard, "") != 0)
+        if ((vport->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", vport->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, vport->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -845,8 +842,6 @@ dxf_vport_free
         dxf_point_free (vport->grid_spacing);
         dxf_point_free (vport->direction);
         dxf_point_free (vport->target);
-        free (vport->dictionary_owner_soft);
-        free (vport->dictionary_owner_hard);
         free (vport);
         vport = NULL;
 #if DEBUG
@@ -880,6 +875,7 @@ dxf_vport_free_list
         while (vports != NULL)
         {
                 DxfVPort *iter = (DxfVPort *) vports->next;
+                vports->next = NULL;
                 dxf_vport_free (vports);
                 vports = (DxfVPort *) iter;
         }
@@ -889,12 +885,151 @@ dxf_vport_free_list
 }
 
 
+/*!
+ * \brief Copy a DXF \c VPORT symbol table entry.
+ *
+ * The copy does not share any memory with \c vport, its \c next
+ * member is \c NULL.
+ *
+ * \return a pointer to the copy when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfVPort *
+dxf_vport_copy
+(
+        DxfVPort *vport
+                /*!< a pointer to the DXF \c VPORT symbol table entry to copy. */
+)
+{
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVPort *copy;
+
+        /* Do some basic checks. */
+        if (vport == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_vport_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, vport, sizeof (DxfVPort));
+        copy->viewport_name = NULL;
+        copy->min = NULL;
+        copy->max = NULL;
+        copy->center = NULL;
+        copy->snap_base = NULL;
+        copy->snap_spacing = NULL;
+        copy->grid_spacing = NULL;
+        copy->direction = NULL;
+        copy->target = NULL;
+        copy->next = NULL;
+        if (vport->viewport_name != NULL)
+        {
+                copy->viewport_name = strdup (vport->viewport_name);
+                if (copy->viewport_name == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->min != NULL)
+        {
+                copy->min = dxf_point_copy (vport->min);
+                if (copy->min == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->max != NULL)
+        {
+                copy->max = dxf_point_copy (vport->max);
+                if (copy->max == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->center != NULL)
+        {
+                copy->center = dxf_point_copy (vport->center);
+                if (copy->center == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->snap_base != NULL)
+        {
+                copy->snap_base = dxf_point_copy (vport->snap_base);
+                if (copy->snap_base == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->snap_spacing != NULL)
+        {
+                copy->snap_spacing = dxf_point_copy (vport->snap_spacing);
+                if (copy->snap_spacing == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->grid_spacing != NULL)
+        {
+                copy->grid_spacing = dxf_point_copy (vport->grid_spacing);
+                if (copy->grid_spacing == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->direction != NULL)
+        {
+                copy->direction = dxf_point_copy (vport->direction);
+                if (copy->direction == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+        if (vport->target != NULL)
+        {
+                copy->target = dxf_point_copy (vport->target);
+                if (copy->target == NULL)
+                {
+                        dxf_vport_free (copy);
+                        return (NULL);
+                }
+        }
+#ifdef DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Get the \c id_code from a DXF \c VPORT symbol table entry.
  *
  * \return \c id_code.
  */
-int
+DxfHandle
 dxf_vport_get_id_code
 (
         DxfVPort *vport
@@ -912,12 +1047,6 @@ dxf_vport_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (vport->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -933,7 +1062,7 @@ dxf_vport_set_id_code
 (
         DxfVPort *vport,
                 /*!< a pointer to a DXF \c VPORT symbol table entry. */
-        int id_code
+        DxfHandle id_code
                 /*!< the \c id_code to be set for the entry. */
 )
 {
@@ -948,12 +1077,6 @@ dxf_vport_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
         vport->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -4454,17 +4577,10 @@ dxf_vport_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vport->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->dictionary_owner_soft));
+        return (dxf_handle_to_string (vport->dictionary_owner_soft));
 }
 
 
@@ -4500,7 +4616,7 @@ dxf_vport_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        vport->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4534,17 +4650,10 @@ dxf_vport_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (vport->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (vport->dictionary_owner_hard));
+        return (dxf_handle_to_string (vport->dictionary_owner_hard));
 }
 
 
@@ -4580,7 +4689,7 @@ dxf_vport_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        vport->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        vport->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
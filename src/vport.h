@@ -44,6 +44,7 @@
 
 
 #include "global.h"
+#include "handle.h"
 #include "point.h"
 
 
@@ -64,7 +65,7 @@ extern "C" {
 typedef struct
 dxf_vport_struct
 {
-        int id_code;
+        DxfHandle id_code;
                 /*!< Identification number for the symbol table entry.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file.\n
@@ -164,11 +165,11 @@ dxf_vport_struct
         int snap_isopair;
                 /*!< Snap isopair.\n
                  * Group code = 78. */
-        char *dictionary_owner_soft;
+        DxfHandle dictionary_owner_soft;
                 /*!< Soft-pointer ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 330. */
-        char *dictionary_owner_hard;
+        DxfHandle dictionary_owner_hard;
                 /*!< Hard owner ID/handle to owner dictionary
                  * (optional).\n
                  * Group code = 360. */
@@ -184,8 +185,9 @@ DxfVPort *dxf_vport_read (DxfFile *fp, DxfVPort *vport);
 int dxf_vport_write (DxfFile *fp, DxfVPort *vport);
 int dxf_vport_free (DxfVPort *vport);
 void dxf_vport_free_list (DxfVPort *vports);
-int dxf_vport_get_id_code (DxfVPort *vport);
-DxfVPort *dxf_vport_set_id_code (DxfVPort *vport, int id_code);
+DxfVPort *dxf_vport_copy (DxfVPort *vport);
+DxfHandle dxf_vport_get_id_code (DxfVPort *vport);
+DxfVPort *dxf_vport_set_id_code (DxfVPort *vport, DxfHandle id_code);
 char *dxf_vport_get_viewport_name (DxfVPort *vport);
 DxfVPort *dxf_vport_set_viewport_name (DxfVPort *vport, char *viewport_name);
 DxfPoint *dxf_vport_get_min (DxfVPort *vport);
@@ -111,27 +111,13 @@ dxf_xline_init
                 __FUNCTION__);
               return (NULL);
         }
-        xline->id_code = 0;
-        xline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        xline->layer = strdup (DXF_DEFAULT_LAYER);
-        xline->elevation = 0.0;
-        xline->thickness = 0.0;
-        xline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        xline->visibility = DXF_DEFAULT_VISIBILITY;
-        xline->color = DXF_COLOR_BYLAYER;
-        xline->paperspace = DXF_MODELSPACE;
-        xline->graphics_data_size = 0;
-        xline->shadow_mode = 0;
-        xline->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        xline->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) xline->binary_graphics_data);
-        xline->dictionary_owner_soft = strdup ("");
-        xline->material = strdup ("");
-        xline->dictionary_owner_hard = strdup ("");
-        xline->lineweight = 0;
-        xline->plot_style_name = strdup ("");
-        xline->color_value = 0;
-        xline->color_name = strdup ("");
-        xline->transparency = 0;
+        if (dxf_entity_common_init (&xline->common) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         xline->p0 = (DxfPoint *) dxf_point_new ();
         xline->p0 = dxf_point_init ((DxfPoint *) xline->p0);
         xline->p0->x0 = 0.0;
@@ -206,13 +192,6 @@ dxf_xline_read
                   __FUNCTION__);
                 xline->p1 = dxf_point_init (xline->p1);
         }
-        if (xline->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                xline->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) xline->binary_graphics_data);
-        }
         (fp->line_number)++;
         fscanf (fp->fp, "%[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
@@ -231,21 +210,20 @@ dxf_xline_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &xline->id_code);
+                        xline->common.id_code = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->linetype);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->common.linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->layer);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->common.layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -295,49 +273,49 @@ dxf_xline_read
                         /* Now follows a string containing the
                          * elevation. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &xline->elevation);
+                        fscanf (fp->fp, "%lf\n", &xline->common.elevation);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &xline->thickness);
+                        fscanf (fp->fp, "%lf\n", &xline->common.thickness);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * scale. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &xline->linetype_scale);
+                        fscanf (fp->fp, "%lf\n", &xline->common.linetype_scale);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &xline->visibility);
+                        fscanf (fp->fp, "%hd\n", &xline->common.visibility);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &xline->color);
+                        fscanf (fp->fp, "%hd\n", &xline->common.color);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &xline->paperspace);
+                        fscanf (fp->fp, "%hd\n", &xline->common.paperspace);
                 }
                 else if (strcmp (temp_string, "92") == 0)
                 {
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &xline->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &xline->common.cold->graphics_data_size);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
@@ -359,78 +337,75 @@ dxf_xline_read
                         /* Now follows a string containing the
                          * graphics data size value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &xline->graphics_data_size);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &xline->common.cold->graphics_data_size);
                 }
                 else if (strcmp (temp_string, "284") == 0)
                 {
                         /* Now follows a string containing the shadow
                          * mode value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &xline->shadow_mode);
+                        fscanf (fp->fp, "%hd\n", &xline->common.cold->shadow_mode);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) xline->binary_graphics_data->next);
-                        xline->binary_graphics_data = (DxfBinaryGraphicsData *) xline->binary_graphics_data->next;
+                        if (xline->common.cold->binary_graphics_data == NULL)
+                        {
+                                xline->common.cold->binary_graphics_data = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+                        }
+                        dxf_binary_buffer_read_line (fp, xline->common.cold->binary_graphics_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->dictionary_owner_soft);
+                        xline->common.cold->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->material);
+                        xline->common.cold->material = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->dictionary_owner_hard);
+                        xline->common.cold->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &xline->lineweight);
+                        fscanf (fp->fp, "%hd\n", &xline->common.lineweight);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->plot_style_name);
+                        xline->common.cold->plot_style_name = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &xline->color_value);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &xline->common.color_value);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->color_name);
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xline->common.cold->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &xline->transparency);
+                        fscanf (fp->fp, "%" PRIi32 "\n", &xline->common.cold->transparency);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -447,13 +422,13 @@ dxf_xline_read
                 }
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (xline->linetype, "") == 0)
+        if (strcmp (xline->common.linetype, "") == 0)
         {
-                xline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                xline->common.linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (xline->layer, "") == 0)
+        if (strcmp (xline->common.layer, "") == 0)
         {
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                xline->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
         free (temp_string);
@@ -521,7 +496,7 @@ dxf_xline_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (xline->binary_graphics_data == NULL)
+        if (xline->common.cold->binary_graphics_data == NULL)
         {
                 fprintf (stderr,
                   (_("Warning in %s () entity contains no binary graphics data.\n")),
@@ -532,28 +507,28 @@ dxf_xline_write
                 && (xline->p0->z0 == xline->p1->z0))
         {
                 fprintf (stderr,
-                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, xline->id_code);
+                  (_("Error in %s () start point and end point are identical for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, xline->common.id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (xline->layer, "") == 0)
+        if (strcmp (xline->common.layer, "") == 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
-                  __FUNCTION__, dxf_entity_name, xline->id_code);
+                  (_("Warning in %s () empty layer string for the %s entity with id-code: %" PRIx64 "\n")),
+                  __FUNCTION__, dxf_entity_name, xline->common.id_code);
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                xline->common.layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (xline->id_code != -1)
+        if (xline->common.id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", xline->id_code);
+                dxf_handle_write (fp, 5, xline->common.id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -565,98 +540,92 @@ dxf_xline_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (xline->dictionary_owner_soft, "") != 0)
+        if ((xline->common.cold->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", xline->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, xline->common.cold->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (xline->dictionary_owner_hard, "") != 0)
+        if ((xline->common.cold->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", xline->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, xline->common.cold->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        if (xline->paperspace == DXF_PAPERSPACE)
+        if (xline->common.paperspace == DXF_PAPERSPACE)
         {
                 fprintf (fp->fp, " 67\n%d\n", (int16_t) DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", xline->layer);
-        if (strcmp (xline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", xline->common.layer);
+        if (strcmp (xline->common.linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", xline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", xline->common.linetype);
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (xline->material, "") != 0))
+          && (xline->common.cold->material != DXF_HANDLE_NONE))
         {
-                fprintf (fp->fp, "347\n%s\n", xline->material);
+                dxf_handle_write (fp, 347, xline->common.cold->material);
         }
-        if (xline->color != DXF_COLOR_BYLAYER)
+        if (xline->common.color != DXF_COLOR_BYLAYER)
         {
-                fprintf (fp->fp, " 62\n%d\n", xline->color);
+                fprintf (fp->fp, " 62\n%hd\n", xline->common.color);
         }
         if (fp->acad_version_number >= AutoCAD_2002)
         {
-                fprintf (fp->fp, "370\n%d\n", xline->lineweight);
+                fprintf (fp->fp, "370\n%hd\n", xline->common.lineweight);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
-          && (xline->elevation != 0.0))
+          && (xline->common.elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", xline->elevation);
+                fprintf (fp->fp, " 38\n%f\n", xline->common.elevation);
         }
-        if (xline->linetype_scale != 1.0)
+        if (xline->common.linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", xline->linetype_scale);
+                fprintf (fp->fp, " 48\n%f\n", xline->common.linetype_scale);
         }
-        if (xline->visibility != 0)
+        if (xline->common.visibility != 0)
         {
-                fprintf (fp->fp, " 60\n%d\n", xline->visibility);
+                fprintf (fp->fp, " 60\n%hd\n", xline->common.visibility);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-          && (xline->binary_graphics_data)
-          && (xline->graphics_data_size > 0))
+          && (xline->common.cold->binary_graphics_data)
+          && (xline->common.cold->graphics_data_size > 0))
         {
 #ifdef BUILD_64
-                fprintf (fp->fp, "160\n%d\n", xline->graphics_data_size);
+                fprintf (fp->fp, "160\n%" PRIi32 "\n", xline->common.cold->graphics_data_size);
 #else
-                fprintf (fp->fp, " 92\n%d\n", xline->graphics_data_size);
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n", xline->common.cold->graphics_data_size);
 #endif
-                if (xline->binary_graphics_data != NULL)
+                if (xline->common.cold->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = xline->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_buffer_write (fp, 310, xline->common.cold->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
         {
-                fprintf (fp->fp, "420\n%ld\n", xline->color_value);
-                fprintf (fp->fp, "430\n%s\n", xline->color_name);
-                fprintf (fp->fp, "440\n%ld\n", xline->transparency);
+                fprintf (fp->fp, "420\n%" PRIi32 "\n", xline->common.color_value);
+                fprintf (fp->fp, "430\n%s\n", xline->common.cold->color_name);
+                fprintf (fp->fp, "440\n%" PRIi32 "\n", xline->common.cold->transparency);
         }
         if (fp->acad_version_number >= AutoCAD_2009)
         {
-                fprintf (fp->fp, "390\n%s\n", xline->plot_style_name);
-                fprintf (fp->fp, "284\n%d\n", xline->shadow_mode);
+                dxf_handle_write (fp, 390, xline->common.cold->plot_style_name);
+                fprintf (fp->fp, "284\n%hd\n", xline->common.cold->shadow_mode);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbXline\n");
         }
-        if (xline->thickness != 0.0)
+        if (xline->common.thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", xline->thickness);
+                fprintf (fp->fp, " 39\n%f\n", xline->common.thickness);
         }
         fprintf (fp->fp, " 10\n%f\n", xline->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", xline->p0->y0);
@@ -664,6 +633,7 @@ dxf_xline_write
         fprintf (fp->fp, " 11\n%f\n", xline->p1->x0);
         fprintf (fp->fp, " 21\n%f\n", xline->p1->y0);
         fprintf (fp->fp, " 31\n%f\n", xline->p1->z0);
+        dxf_entity_common_write_xdata (fp, &xline->common);
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -706,14 +676,7 @@ dxf_xline_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xline->linetype);
-        free (xline->layer);
-        dxf_binary_graphics_data_free_list (xline->binary_graphics_data);
-        free (xline->dictionary_owner_soft);
-        free (xline->material);
-        free (xline->dictionary_owner_hard);
-        free (xline->plot_style_name);
-        free (xline->color_name);
+        dxf_entity_common_free (&xline->common);
         dxf_point_free (xline->p0);
         dxf_point_free (xline->p1);
         free (xline);
@@ -749,6 +712,7 @@ dxf_xline_free_list
         while (xlines != NULL)
         {
                 DxfXLine *iter = (DxfXLine *) xlines->next;
+                xlines->next = NULL;
                 dxf_xline_free (xlines);
                 xlines = (DxfXLine *) iter;
         }
@@ -763,7 +727,7 @@ dxf_xline_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_xline_get_id_code
 (
         DxfXLine *xline
@@ -781,17 +745,10 @@ dxf_xline_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative value was found in the id-code member.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->id_code);
+        return (xline->common.id_code);
 }
 
 
@@ -803,7 +760,7 @@ dxf_xline_set_id_code
 (
         DxfXLine *xline,
                 /*!< a pointer to a DXF \c XLINE entity. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -820,14 +777,7 @@ dxf_xline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a negative id-code value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        xline->id_code = id_code;
+        xline->common.id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -858,7 +808,7 @@ dxf_xline_get_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->linetype ==  NULL)
+        if (xline->common.linetype ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -868,7 +818,7 @@ dxf_xline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->linetype));
+        return (strdup (xline->common.linetype));
 }
 
 
@@ -902,7 +852,7 @@ dxf_xline_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->linetype = strdup (linetype);
+        xline->common.linetype = strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -933,7 +883,7 @@ dxf_xline_get_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->layer ==  NULL)
+        if (xline->common.layer ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -943,7 +893,7 @@ dxf_xline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->layer));
+        return (strdup (xline->common.layer));
 }
 
 
@@ -977,7 +927,7 @@ dxf_xline_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->layer = strdup (layer);
+        xline->common.layer = strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1011,7 +961,7 @@ dxf_xline_get_elevation
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->elevation);
+        return (xline->common.elevation);
 }
 
 
@@ -1038,7 +988,7 @@ dxf_xline_set_elevation
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->elevation = elevation;
+        xline->common.elevation = elevation;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1069,7 +1019,7 @@ dxf_xline_get_thickness
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->thickness < 0.0)
+        if (xline->common.thickness < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1079,7 +1029,7 @@ dxf_xline_get_thickness
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->thickness);
+        return (xline->common.thickness);
 }
 
 
@@ -1113,7 +1063,7 @@ dxf_xline_set_thickness
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->thickness = thickness;
+        xline->common.thickness = thickness;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1144,7 +1094,7 @@ dxf_xline_get_linetype_scale
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->linetype_scale < 0.0)
+        if (xline->common.linetype_scale < 0.0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
@@ -1154,7 +1104,7 @@ dxf_xline_get_linetype_scale
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->linetype_scale);
+        return (xline->common.linetype_scale);
 }
 
 
@@ -1188,7 +1138,7 @@ dxf_xline_set_linetype_scale
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->linetype_scale = linetype_scale;
+        xline->common.linetype_scale = linetype_scale;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1219,14 +1169,14 @@ dxf_xline_get_visibility
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->visibility < 0)
+        if (xline->common.visibility < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->visibility > 1)
+        if (xline->common.visibility > 1)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1236,7 +1186,7 @@ dxf_xline_get_visibility
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->visibility);
+        return (xline->common.visibility);
 }
 
 
@@ -1277,7 +1227,7 @@ dxf_xline_set_visibility
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->visibility = visibility;
+        xline->common.visibility = visibility;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1308,7 +1258,7 @@ dxf_xline_get_color
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->color < 0)
+        if (xline->common.color < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -1317,7 +1267,7 @@ dxf_xline_get_color
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->color);
+        return (xline->common.color);
 }
 
 
@@ -1352,7 +1302,7 @@ dxf_xline_set_color
                 fprintf (stderr,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
-        xline->color = color;
+        xline->common.color = color;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1383,13 +1333,13 @@ dxf_xline_get_paperspace
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->paperspace < 0)
+        if (xline->common.paperspace < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (xline->paperspace > 1)
+        if (xline->common.paperspace > 1)
         {
                 fprintf (stderr,
                   (_("Warning in %s () an out of range value was found.\n")),
@@ -1398,7 +1348,7 @@ dxf_xline_get_paperspace
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->paperspace);
+        return (xline->common.paperspace);
 }
 
 
@@ -1440,7 +1390,7 @@ dxf_xline_set_paperspace
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->paperspace = paperspace;
+        xline->common.paperspace = paperspace;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1473,13 +1423,13 @@ dxf_xline_get_graphics_data_size
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->graphics_data_size < 0)
+        if (xline->common.cold->graphics_data_size < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
-        if (xline->graphics_data_size == 0)
+        if (xline->common.cold->graphics_data_size == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a zero value was found.\n")),
@@ -1488,7 +1438,7 @@ dxf_xline_get_graphics_data_size
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->graphics_data_size);
+        return (xline->common.cold->graphics_data_size);
 }
 
 
@@ -1533,7 +1483,7 @@ dxf_xline_set_graphics_data_size
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
-        xline->graphics_data_size = graphics_data_size;
+        xline->common.cold->graphics_data_size = graphics_data_size;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1565,14 +1515,14 @@ dxf_xline_get_shadow_mode
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->shadow_mode < 0)
+        if (xline->common.cold->shadow_mode < 0)
         {
                 fprintf (stderr,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xline->shadow_mode > 3)
+        if (xline->common.cold->shadow_mode > 3)
         {
                 fprintf (stderr,
                   (_("Error in %s () an out of range value was found.\n")),
@@ -1582,7 +1532,7 @@ dxf_xline_get_shadow_mode
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->shadow_mode);
+        return (xline->common.cold->shadow_mode);
 }
 
 
@@ -1626,7 +1576,7 @@ dxf_xline_set_shadow_mode
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->shadow_mode = shadow_mode;
+        xline->common.cold->shadow_mode = shadow_mode;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1638,11 +1588,12 @@ dxf_xline_set_shadow_mode
  * \brief Get the pointer to the \c binary_graphics_data from a DXF
  * \c XLINE entity.
  *
- * \return pointer to the \c binary_graphics_data.
+ * \return pointer to the decoded \c binary_graphics_data, or \c NULL
+ * when the entity has no proxy entity graphics data.
  *
  * \warning No checks are performed on the returned pointer.
  */
-DxfBinaryGraphicsData *
+DxfBinaryBuffer *
 dxf_xline_get_binary_graphics_data
 (
         DxfXLine *xline
@@ -1660,32 +1611,31 @@ dxf_xline_get_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->binary_graphics_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryGraphicsData *) xline->binary_graphics_data);
+        return (xline->common.cold->binary_graphics_data);
 }
 
 
 /*!
  * \brief Set the pointer to the \c binary_graphics_data for a DXF
  * \c XLINE entity.
+ *
+ * The entity takes ownership of \c data, a previously set buffer is
+ * freed.
+ *
+ * \return a pointer to \c xline when successful, or \c NULL when an
+ * error occurred.
  */
 DxfXLine *
 dxf_xline_set_binary_graphics_data
 (
         DxfXLine *xline,
                 /*!< a pointer to a DXF \c XLINE entity. */
-        DxfBinaryGraphicsData *data
-                /*!< a string containing the pointer to the
-                 * \c binary_graphics_data for the entity. */
+        DxfBinaryBuffer *data
+                /*!< a pointer to the decoded \c binary_graphics_data
+                 * for the entity. */
 )
 {
 #if DEBUG
@@ -1706,7 +1656,12 @@ dxf_xline_set_binary_graphics_data
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        if ((xline->common.cold->binary_graphics_data != NULL)
+          && (xline->common.cold->binary_graphics_data != data))
+        {
+                dxf_binary_buffer_free (xline->common.cold->binary_graphics_data);
+        }
+        xline->common.cold->binary_graphics_data = data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1740,17 +1695,10 @@ dxf_xline_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->dictionary_owner_soft));
+        return (dxf_handle_to_string (xline->common.cold->dictionary_owner_soft));
 }
 
 
@@ -1786,7 +1734,7 @@ dxf_xline_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        xline->common.cold->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1821,17 +1769,10 @@ dxf_xline_get_material
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->material ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->material));
+        return (dxf_handle_to_string (xline->common.cold->material));
 }
 
 
@@ -1870,7 +1811,7 @@ dxf_xline_set_material
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->material = strdup (material);
+        xline->common.cold->material = dxf_handle_parse (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1904,17 +1845,10 @@ dxf_xline_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->dictionary_owner_hard));
+        return (dxf_handle_to_string (xline->common.cold->dictionary_owner_hard));
 }
 
 
@@ -1950,7 +1884,7 @@ dxf_xline_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        xline->common.cold->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1985,7 +1919,7 @@ dxf_xline_get_lineweight
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->lineweight);
+        return (xline->common.lineweight);
 }
 
 
@@ -2015,7 +1949,7 @@ dxf_xline_set_lineweight
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->lineweight = lineweight;
+        xline->common.lineweight = lineweight;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2047,17 +1981,10 @@ dxf_xline_get_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->plot_style_name ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->plot_style_name));
+        return (dxf_handle_to_string (xline->common.cold->plot_style_name));
 }
 
 
@@ -2095,7 +2022,7 @@ dxf_xline_set_plot_style_name
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->plot_style_name = strdup (plot_style_name);
+        xline->common.cold->plot_style_name = dxf_handle_parse (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2130,7 +2057,7 @@ dxf_xline_get_color_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->color_value);
+        return (xline->common.color_value);
 }
 
 
@@ -2160,7 +2087,7 @@ dxf_xline_set_color_value
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->color_value = color_value;
+        xline->common.color_value = color_value;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2192,7 +2119,7 @@ dxf_xline_get_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xline->color_name ==  NULL)
+        if (xline->common.cold->color_name ==  NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -2202,7 +2129,7 @@ dxf_xline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xline->color_name));
+        return (strdup (xline->common.cold->color_name));
 }
 
 
@@ -2240,7 +2167,7 @@ dxf_xline_set_color_name
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->color_name = strdup (color_name);
+        xline->common.cold->color_name = strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2275,7 +2202,7 @@ dxf_xline_get_transparency
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (xline->transparency);
+        return (xline->common.cold->transparency);
 }
 
 
@@ -2305,7 +2232,7 @@ dxf_xline_set_transparency
                   __FUNCTION__);
                 return (NULL);
         }
-        xline->transparency = transparency;
+        xline->common.cold->transparency = transparency;
 #if DEBUG
         DXF_DEBUG_END
 #endif
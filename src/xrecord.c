@@ -112,8 +112,8 @@ dxf_xrecord_init
                 return (NULL);
         }
         xrecord->id_code = 0;
-        xrecord->dictionary_owner_soft = strdup ("");
-        xrecord->dictionary_owner_hard = strdup ("");
+        xrecord->dictionary_owner_soft = DXF_HANDLE_NONE;
+        xrecord->dictionary_owner_hard = DXF_HANDLE_NONE;
         xrecord->group_code = 0;
         xrecord->I8 = 0;
         xrecord->I16 = 0;
@@ -195,8 +195,7 @@ dxf_xrecord_read
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", &xrecord->id_code);
+                        xrecord->id_code = dxf_handle_read (fp);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
@@ -216,15 +215,13 @@ dxf_xrecord_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xrecord->dictionary_owner_soft);
+                        xrecord->dictionary_owner_soft = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, xrecord->dictionary_owner_hard);
+                        xrecord->dictionary_owner_hard = dxf_handle_read (fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -355,14 +352,14 @@ dxf_xrecord_write
         if (fp->acad_version_number < AutoCAD_14)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () illegal DXF version for this %s object with id-code: %x.\n")),
+                  (_("Warning in %s () illegal DXF version for this %s object with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, dxf_entity_name, xrecord->id_code);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (xrecord->id_code != -1)
+        if (xrecord->id_code != DXF_HANDLE_NONE)
         {
-                fprintf (fp->fp, "  5\n%x\n", xrecord->id_code);
+                dxf_handle_write (fp, 5, xrecord->id_code);
         }
         /*!
          * \todo for version R14.\n
@@ -374,18 +371,18 @@ dxf_xrecord_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (xrecord->dictionary_owner_soft, "") != 0)
+        if ((xrecord->dictionary_owner_soft != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", xrecord->dictionary_owner_soft);
+                dxf_handle_write (fp, 330, xrecord->dictionary_owner_soft);
                 fprintf (fp->fp, "102\n}\n");
         }
-        if ((strcmp (xrecord->dictionary_owner_hard, "") != 0)
+        if ((xrecord->dictionary_owner_hard != DXF_HANDLE_NONE)
           && (fp->acad_version_number >= AutoCAD_14))
         {
                 fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", xrecord->dictionary_owner_hard);
+                dxf_handle_write (fp, 360, xrecord->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
         if (fp->acad_version_number >= AutoCAD_13)
@@ -442,7 +439,7 @@ dxf_xrecord_write
         else
         {
                 fprintf (stderr,
-                  (_("Warning in %s () unknown group code %d found in DxfXrecord struct with id-code: %x.\n")),
+                  (_("Warning in %s () unknown group code %d found in DxfXrecord struct with id-code: %" PRIx64 ".\n")),
                   __FUNCTION__, xrecord->group_code, xrecord->id_code);
         }
         /* Clean up. */
@@ -487,8 +484,6 @@ dxf_xrecord_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xrecord->dictionary_owner_soft);
-        free (xrecord->dictionary_owner_hard);
         free (xrecord->S);
         free (xrecord);
         xrecord = NULL;
@@ -523,6 +518,7 @@ dxf_xrecord_free_list
         while (xrecords != NULL)
         {
                 DxfXrecord *iter = (DxfXrecord *) xrecords->next;
+                xrecords->next = NULL;
                 dxf_xrecord_free (xrecords);
                 xrecords = (DxfXrecord *) iter;
         }
@@ -537,7 +533,7 @@ dxf_xrecord_free_list
  *
  * \return ID code.
  */
-int
+DxfHandle
 dxf_xrecord_get_id_code
 (
         DxfXrecord *xrecord
@@ -555,13 +551,6 @@ dxf_xrecord_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (xrecord->id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -577,7 +566,7 @@ dxf_xrecord_set_id_code
 (
         DxfXrecord *xrecord,
                 /*!< a pointer to a DXF \c XRECORD object. */
-        int id_code
+        DxfHandle id_code
                 /*!< Identification number for the object.\n
                  * This is to be an unique (sequential) number in the DXF
                  * file. */
@@ -594,13 +583,6 @@ dxf_xrecord_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
         xrecord->id_code = id_code;
 #if DEBUG
         DXF_DEBUG_END
@@ -635,17 +617,10 @@ dxf_xrecord_get_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xrecord->dictionary_owner_soft ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->dictionary_owner_soft));
+        return (dxf_handle_to_string (xrecord->dictionary_owner_soft));
 }
 
 
@@ -681,7 +656,7 @@ dxf_xrecord_set_dictionary_owner_soft
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        xrecord->dictionary_owner_soft = dxf_handle_parse (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -715,17 +690,10 @@ dxf_xrecord_get_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        if (xrecord->dictionary_owner_hard ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (xrecord->dictionary_owner_hard));
+        return (dxf_handle_to_string (xrecord->dictionary_owner_hard));
 }
 
 
@@ -761,7 +729,7 @@ dxf_xrecord_set_dictionary_owner_hard
                   __FUNCTION__);
                 return (NULL);
         }
-        xrecord->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        xrecord->dictionary_owner_hard = dxf_handle_parse (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
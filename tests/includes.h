@@ -39,6 +39,42 @@
 #include "src/dxf.h"
 
 
+#ifndef TEST_SRCDIR
+/*! Source directory of the tests, set by the build system. */
+#define TEST_SRCDIR "."
+#endif
+
+
+/*! Example drawing, found from the source directory of the tests. */
+#define TEST_EXAMPLE_R2000 TEST_SRCDIR "/../examples/qcad-example_R2000.dxf"
+
+
+int test_write_file (const char *filename, const char *contents);
+int test_mtext (void);
+int test_point (void);
+int test_lwpolyline (void);
+int test_binary_data (void);
+int test_thumbnail (void);
+int test_3dsolid (void);
+int test_entities (void);
+int test_handle_index (void);
+int test_rtree (void);
+int test_nearest (void);
+int test_block_index (void);
+int test_text_index (void);
+int test_table (void);
+int test_handle (void);
+int test_hatch (void);
+int test_snapshot (void);
+int test_array (void);
+int test_memory_usage (void);
+int test_layer_partition (void);
+int test_bounds (void);
+int test_dictionary_tree (void);
+int test_draw_order (void);
+int test_reference_index (void);
+
+
 #endif /* LIBDXF_TESTS_INCLUDES_H */
 
 
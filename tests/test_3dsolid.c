@@ -0,0 +1,194 @@
+/*!
+ * \file test_3dsolid.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for decoding the proprietary data of a DXF \c 3DSOLID entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Write a line of SAT text as an encoded DXF value line.
+ *
+ * Every character \c c other than a space is stored as
+ * <tt>159 - c</tt>, a resulting caret is escaped as <tt>"^ "</tt>.
+ */
+static void
+test_3dsolid_write_encoded
+(
+        FILE *fp,
+                /*!< the file to write to. */
+        const char *text,
+                /*!< the SAT text to encode. */
+        size_t length
+                /*!< the number of characters of \c text to encode. */
+)
+{
+        size_t i;
+        int c;
+
+        for (i = 0; i < length; i++)
+        {
+                c = (text[i] == ' ') ? ' ' : 159 - text[i];
+                if (c == '^')
+                {
+                        fputs ("^ ", fp);
+                }
+                else
+                {
+                        fputc (c, fp);
+                }
+        }
+        fputc ('\n', fp);
+}
+
+
+/*!
+ * \brief Perform test functions for decoding the proprietary data of a
+ * DXF \c 3DSOLID entity.
+ *
+ * The entity is read lazily, only the byte range of its group 1 and
+ * group 3 lines is recorded and decoded on request.\n
+ * The SAT text contains characters which encode to an escaped caret,
+ * and a line continued in a group 3 line.\n
+ * Once the file is changed the range is no longer decoded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_3dsolid (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_3dsolid.dxf";
+        const char *lines[3] =
+        {
+                "400 0 1 0",
+                "16 Autodesk AutoCAD 19 ASM 221.0.0.0 NT 0",
+                "body $-1 -1 $-1 $1 $-1 $2 #"
+        };
+        char expected[256];
+        FILE *fp;
+        DxfEntities *entities;
+        Dxf3dsolid *solid;
+        DxfEntityType type;
+        DxfProprietaryDataRange *range;
+        char *text = NULL;
+        size_t length = 0;
+        int status = EXIT_FAILURE;
+        int i;
+
+        fp = fopen (filename, "w");
+        if (fp == NULL)
+        {
+                fprintf (stderr, "Error: could not open file: %s for writing.\n",
+                  filename);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp, "  0\nSECTION\n  2\nENTITIES\n");
+        fprintf (fp, "  0\n3DSOLID\n  5\n2C\n  8\n0\n 70\n1\n");
+        for (i = 0; i < 3; i++)
+        {
+                fprintf (fp, "  1\n");
+                if (i == 1)
+                {
+                        /* Continue the second line in a group 3 line. */
+                        test_3dsolid_write_encoded (fp, lines[i], 12);
+                        fprintf (fp, "  3\n");
+                        test_3dsolid_write_encoded (fp, lines[i] + 12, strlen (lines[i]) - 12);
+                }
+                else
+                {
+                        test_3dsolid_write_encoded (fp, lines[i], strlen (lines[i]));
+                }
+        }
+        fprintf (fp, "  0\nENDSEC\n  0\nEOF\n");
+        fclose (fp);
+        sprintf (expected, "%s\n%s\n%s", lines[0], lines[1], lines[2]);
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+        {
+                solid = dxf_entities_materialize (entities, 0, &type);
+                range = NULL;
+                if ((solid != NULL) && (type == DSOLID))
+                {
+                        range = dxf_3dsolid_get_proprietary_data_range (solid);
+                }
+                if ((range != NULL) && (range->number_of_lines == 4))
+                {
+                        text = dxf_proprietary_data_range_decode (range, &length);
+                }
+                if ((text != NULL)
+                  && (length == strlen (expected))
+                  && (strcmp (text, expected) == 0))
+                {
+                        status = EXIT_SUCCESS;
+                }
+                else
+                {
+                        fprintf (stderr, "Error: the proprietary data was not decoded as expected.\n");
+                }
+                free (text);
+                text = NULL;
+                /* A changed file is not decoded. */
+                if ((status == EXIT_SUCCESS)
+                  && ((fp = fopen (filename, "a")) != NULL))
+                {
+                        fprintf (fp, "999\nchanged\n");
+                        fclose (fp);
+                        text = dxf_proprietary_data_range_decode (range, &length);
+                        if (text != NULL)
+                        {
+                                fprintf (stderr, "Error: the proprietary data of a changed file was decoded.\n");
+                                status = EXIT_FAILURE;
+                                free (text);
+                        }
+                }
+        }
+        dxf_entities_free (entities);
+        remove (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
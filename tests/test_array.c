@@ -0,0 +1,249 @@
+/*!
+ * \file test_array.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the growable numeric arrays.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Test appending to a \c DxfDoubleArray.
+ *
+ * Single values, a block of values and a \c DxfDouble list are
+ * appended, the values have to end up in one contiguous block in
+ * order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_array_double (void)
+{
+        DxfDoubleArray *array;
+        DxfDoubleArray *copy = NULL;
+        DxfDouble *list;
+        double values[1000];
+        double *data;
+        int status = EXIT_FAILURE;
+        int i;
+
+        for (i = 0; i < 1000; i++)
+        {
+                values[i] = 0.5 * i;
+        }
+        array = dxf_double_array_init (dxf_double_array_new ());
+        list = dxf_double_init (dxf_double_new ());
+        if ((array == NULL) || (list == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_double_set_value (list, -1.0);
+        dxf_double_append (list, dxf_double_set_value (dxf_double_init (dxf_double_new ()), -2.0));
+        if ((dxf_double_array_append (array, 1.0) == EXIT_FAILURE)
+          || (dxf_double_array_append (array, 2.0) == EXIT_FAILURE)
+          || (dxf_double_array_append_values (array, values, 1000) == EXIT_FAILURE)
+          || (dxf_double_array_append_list (array, list) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not append to a double array.\n");
+        }
+        else if ((dxf_double_array_get_length (array) != 1004)
+          || (array->capacity < array->length)
+          || ((data = dxf_double_array_get_values (array)) == NULL)
+          || (data[0] != 1.0)
+          || (data[1] != 2.0)
+          || (data[2] != 0.0)
+          || (data[1001] != 499.5)
+          || (data[1002] != -1.0)
+          || (data[1003] != -2.0))
+        {
+                fprintf (stderr, "Error: wrong values in a double array.\n");
+        }
+        else if (((copy = dxf_double_array_copy (array)) == NULL)
+          || (copy->values == array->values)
+          || (copy->length != array->length)
+          || (memcmp (copy->values, array->values, array->length * sizeof (double)) != 0))
+        {
+                fprintf (stderr, "Error: wrong copy of a double array.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        if (copy != NULL)
+        {
+                dxf_double_array_free (copy);
+        }
+        dxf_double_free_list (list);
+        dxf_double_array_free (array);
+        return (status);
+}
+
+
+/*!
+ * \brief Test reserving and appending to a \c DxfInt32Array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_array_int32 (void)
+{
+        DxfInt32Array *array;
+        int32_t *data;
+        int status = EXIT_FAILURE;
+        int32_t i;
+
+        array = dxf_int32_array_init (dxf_int32_array_new ());
+        if (array == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_int32_array_reserve (array, 100) == EXIT_FAILURE)
+          || (array->capacity < 100)
+          || (dxf_int32_array_get_length (array) != 0))
+        {
+                fprintf (stderr, "Error: could not reserve an int32 array.\n");
+                dxf_int32_array_free (array);
+                return (EXIT_FAILURE);
+        }
+        /* Appending within the reserved capacity keeps the block. */
+        data = dxf_int32_array_get_values (array);
+        for (i = 0; i < 100; i++)
+        {
+                dxf_int32_array_append (array, i * i);
+        }
+        if ((dxf_int32_array_get_values (array) != data)
+          || (dxf_int32_array_get_length (array) != 100)
+          || (data[99] != 99 * 99))
+        {
+                fprintf (stderr, "Error: wrong values in an int32 array.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        dxf_int32_array_free (array);
+        return (status);
+}
+
+
+/*!
+ * \brief Test reading the knot and weight values of a \c SPLINE into
+ * arrays.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_array_spline (void)
+{
+        const char *filename = "test_array.dxf";
+        DxfEntities *entities;
+        DxfSpline *spline;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
+
+        if (test_write_file (filename,
+          "  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nSPLINE\n  5\n40\n  8\n0\n 70\n8\n 71\n1\n 72\n4\n 73\n2\n 74\n0\n"
+          " 40\n0.0\n 40\n0.0\n 40\n1.0\n 40\n1.0\n"
+          " 41\n1.0\n 41\n0.5\n"
+          " 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+          " 10\n1.0\n 20\n1.0\n 30\n0.0\n"
+          "  0\nENDSEC\n  0\nEOF\n") == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                remove (filename);
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_FAILURE)
+          || ((spline = dxf_entities_materialize (entities, 0, &type)) == NULL)
+          || (type != SPLINE))
+        {
+                fprintf (stderr, "Error: could not read the spline.\n");
+        }
+        else if ((dxf_double_array_get_length (spline->knot_value) != 4)
+          || (spline->knot_value->values[1] != 0.0)
+          || (spline->knot_value->values[2] != 1.0)
+          || (dxf_double_array_get_length (spline->weight_value) != 2)
+          || (spline->weight_value->values[1] != 0.5))
+        {
+                fprintf (stderr, "Error: wrong knot or weight values of the spline.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        dxf_entities_free (entities);
+        remove (filename);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for the growable numeric arrays.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_array (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int status;
+
+        status = test_array_double ();
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_array_int32 ();
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_array_spline ();
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,159 @@
+/*!
+ * \file test_binary_data.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for decoding hexadecimal binary data.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Check the contents of a decoded binary data buffer.
+ *
+ * \return \c EXIT_SUCCESS when the contents are equal, or
+ * \c EXIT_FAILURE when they differ.
+ */
+static int
+test_binary_data_compare
+(
+        DxfBinaryBuffer *buffer,
+                /*!< a pointer to the decoded binary data buffer. */
+        const unsigned char *expected,
+                /*!< the expected bytes. */
+        size_t length
+                /*!< the expected number of bytes. */
+)
+{
+        if (dxf_binary_buffer_get_length (buffer) != length)
+        {
+                fprintf (stderr, "Error: expected %lu bytes, got %lu.\n",
+                  (unsigned long) length,
+                  (unsigned long) dxf_binary_buffer_get_length (buffer));
+                return (EXIT_FAILURE);
+        }
+        if ((length > 0)
+          && (memcmp (dxf_binary_buffer_get_data (buffer), expected, length) != 0))
+        {
+                fprintf (stderr, "Error: the decoded bytes differ.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for decoding hexadecimal binary data.
+ *
+ * All byte values are decoded from upper and lower case digits, in
+ * lines which grow the buffer past its initial capacity.\n
+ * An odd number of digits or an invalid digit has to fail and leave the
+ * buffer unchanged.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_binary_data (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *digits[2] = {"0123456789ABCDEF", "0123456789abcdef"};
+        unsigned char expected[1024];
+        char line[2 * 128 + 3];
+        DxfBinaryBuffer *buffer;
+        size_t length = 0;
+        int status = EXIT_SUCCESS;
+        int i;
+        int j;
+
+        buffer = dxf_binary_buffer_init (dxf_binary_buffer_new ());
+        if (buffer == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Eight lines of 128 bytes each, alternating the case of the
+         * digits, the trailing carriage return has to be ignored. */
+        for (i = 0; (i < 8) && (status == EXIT_SUCCESS); i++)
+        {
+                for (j = 0; j < 128; j++)
+                {
+                        expected[length + j] = (unsigned char) ((i * 128 + j) % 256);
+                        line[2 * j] = digits[i % 2][expected[length + j] >> 4];
+                        line[2 * j + 1] = digits[i % 2][expected[length + j] & 0x0f];
+                }
+                strcpy (line + 2 * 128, "\r\n");
+                if (dxf_binary_buffer_append_hex (buffer, line, strlen (line)) == EXIT_FAILURE)
+                {
+                        fprintf (stderr, "Error: could not decode line %d.\n", i);
+                        status = EXIT_FAILURE;
+                }
+                length += 128;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_binary_data_compare (buffer, expected, length);
+        }
+        /* Corrupt data is rejected without changing the buffer. */
+        if ((status == EXIT_SUCCESS)
+          && ((dxf_binary_buffer_append_hex (buffer, "0A1", 3) == EXIT_SUCCESS)
+          || (dxf_binary_buffer_append_hex (buffer, "0A1G", 4) == EXIT_SUCCESS)
+          || (dxf_binary_buffer_append_hex (buffer, "0A 1", 4) == EXIT_SUCCESS)))
+        {
+                fprintf (stderr, "Error: corrupt hexadecimal data was accepted.\n");
+                status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_binary_data_compare (buffer, expected, length);
+        }
+        /* An empty line decodes to nothing. */
+        if ((status == EXIT_SUCCESS)
+          && (dxf_binary_buffer_append_hex (buffer, "", 0) == EXIT_FAILURE))
+        {
+                status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_binary_data_compare (buffer, expected, length);
+        }
+        dxf_binary_buffer_free (buffer);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
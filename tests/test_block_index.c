@@ -0,0 +1,205 @@
+/*!
+ * \file test_block_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the block reference counts of the block index.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Check the reference and instance counts of a block.
+ *
+ * \return \c EXIT_SUCCESS when the counts are the expected ones, or
+ * \c EXIT_FAILURE when they differ.
+ */
+static int
+test_block_index_check
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to the block index. */
+        const char *block_name,
+                /*!< the name of the block. */
+        int references,
+                /*!< the expected number of references. */
+        int instances,
+                /*!< the expected number of instances. */
+        int purgeable
+                /*!< the expected result of dxf_block_index_is_purgeable (). */
+)
+{
+        if ((dxf_block_index_get_references (index, block_name) != references)
+          || (dxf_block_index_get_instances (index, block_name) != instances)
+          || (dxf_block_index_is_purgeable (index, block_name) != purgeable))
+        {
+                fprintf (stderr, "Error: block %s has %d references and %d instances, expected %d and %d.\n",
+                  block_name,
+                  dxf_block_index_get_references (index, block_name),
+                  dxf_block_index_get_instances (index, block_name),
+                  references, instances);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Check the counts of all blocks of the test drawing.
+ *
+ * \return \c EXIT_SUCCESS when the counts are the expected ones, or
+ * \c EXIT_FAILURE when they differ.
+ */
+static int
+test_block_index_check_all
+(
+        DxfBlockIndex *index,
+                /*!< a pointer to the block index. */
+        int doors
+                /*!< the number of \c DOOR blocks in model space. */
+)
+{
+        if ((test_block_index_check (index, "*Model_Space", 0, 1, FALSE) == EXIT_FAILURE)
+          || (test_block_index_check (index, "DOOR", doors, doors, (doors == 0)) == EXIT_FAILURE)
+          || (test_block_index_check (index, "HINGE", 2, 2 * doors, (doors == 0)) == EXIT_FAILURE)
+          || (test_block_index_check (index, "SCREW", 4, 8 * doors, (doors == 0)) == EXIT_FAILURE)
+          || (test_block_index_check (index, "UNUSED", 0, 0, TRUE) == EXIT_FAILURE)
+          || (test_block_index_check (index, "NESTED_IN_UNUSED", 1, 0, TRUE) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the block reference counts of the
+ * block index.
+ *
+ * Model space holds 3 \c DOOR blocks, a \c DOOR holds 2 \c HINGE
+ * blocks and a \c HINGE holds 4 \c SCREW blocks.\n
+ * The \c UNUSED block is not drawn, neither is the block nested in it.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_block_index (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockIndex *index;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        index = dxf_block_index_init (dxf_block_index_new ());
+        if (index == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_block_index_intern (index, "*Model_Space") < 0)
+          || (dxf_block_index_intern (index, "UNUSED") < 0))
+        {
+                status = EXIT_FAILURE;
+        }
+        for (i = 0; (i < 3) && (status == EXIT_SUCCESS); i++)
+        {
+                status = dxf_block_index_add_reference (index, "DOOR", "*Model_Space");
+        }
+        for (i = 0; (i < 2) && (status == EXIT_SUCCESS); i++)
+        {
+                status = dxf_block_index_add_reference (index, "HINGE", "DOOR");
+        }
+        for (i = 0; (i < 4) && (status == EXIT_SUCCESS); i++)
+        {
+                status = dxf_block_index_add_reference (index, "SCREW", "HINGE");
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = dxf_block_index_add_reference (index, "NESTED_IN_UNUSED", "UNUSED");
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_block_index_check_all (index, 3);
+        }
+        /* Block names are not case sensitive. */
+        if ((status == EXIT_SUCCESS)
+          && (dxf_block_index_find (index, "door") != dxf_block_index_find (index, "DOOR")))
+        {
+                fprintf (stderr, "Error: block names are case sensitive.\n");
+                status = EXIT_FAILURE;
+        }
+        /* A block can not contain itself, directly or nested. */
+        if ((status == EXIT_SUCCESS)
+          && ((dxf_block_index_add_reference (index, "DOOR", "DOOR") == EXIT_SUCCESS)
+          || (dxf_block_index_add_reference (index, "DOOR", "SCREW") == EXIT_SUCCESS)))
+        {
+                fprintf (stderr, "Error: a block containing itself was accepted.\n");
+                status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_block_index_check_all (index, 3);
+        }
+        /* Removing a reference which is not there fails. */
+        if ((status == EXIT_SUCCESS)
+          && (dxf_block_index_remove_reference (index, "SCREW", "DOOR") == EXIT_SUCCESS))
+        {
+                fprintf (stderr, "Error: a missing reference was removed.\n");
+                status = EXIT_FAILURE;
+        }
+        /* Removing the doors one by one updates the nested blocks. */
+        for (i = 2; (i >= 0) && (status == EXIT_SUCCESS); i--)
+        {
+                status = dxf_block_index_remove_reference (index, "DOOR", "*Model_Space");
+                if (status == EXIT_SUCCESS)
+                {
+                        status = test_block_index_check_all (index, i);
+                }
+        }
+        if ((status == EXIT_SUCCESS)
+          && (dxf_block_index_is_purgeable (index, "NO_SUCH_BLOCK") != -1))
+        {
+                fprintf (stderr, "Error: an unknown block can be purged.\n");
+                status = EXIT_FAILURE;
+        }
+        dxf_block_index_free (index);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
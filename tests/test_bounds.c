@@ -0,0 +1,215 @@
+/*!
+ * \file test_bounds.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the bounding boxes and the drawing extents.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Tolerance for comparing computed coordinates.
+ */
+#define TEST_BOUNDS_EPSILON 1e-9
+
+
+/*!
+ * \brief Compare a bounding box with the expected X and Y ranges.
+ *
+ * \return \c EXIT_SUCCESS when the box matches, or \c EXIT_FAILURE when
+ * it differs.
+ */
+static int
+test_bounds_check_box
+(
+        const char *what,
+                /*!< the description of the box. */
+        const DxfBoundingBox *box,
+                /*!< the box to check. */
+        double min_x,
+                /*!< the expected minimum X-value. */
+        double min_y,
+                /*!< the expected minimum Y-value. */
+        double max_x,
+                /*!< the expected maximum X-value. */
+        double max_y
+                /*!< the expected maximum Y-value. */
+)
+{
+        if ((fabs (box->min_x - min_x) > TEST_BOUNDS_EPSILON)
+          || (fabs (box->min_y - min_y) > TEST_BOUNDS_EPSILON)
+          || (fabs (box->max_x - max_x) > TEST_BOUNDS_EPSILON)
+          || (fabs (box->max_y - max_y) > TEST_BOUNDS_EPSILON))
+        {
+                fprintf (stderr, "Error: wrong bounding box of %s: (%f, %f) - (%f, %f).\n",
+                  what, box->min_x, box->min_y, box->max_x, box->max_y);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make an \c ARC from 45 to 135 degrees on the unit circle.
+ *
+ * The top of the circle lies between the end points.
+ *
+ * \return a pointer to the arc, or \c NULL when an error occurred.
+ */
+static DxfArc *
+test_bounds_new_arc (void)
+{
+        DxfArc *arc;
+
+        arc = dxf_arc_init (dxf_arc_new ());
+        if (arc == NULL)
+        {
+                return (NULL);
+        }
+        arc->radius = 1.0;
+        arc->start_angle = 45.0;
+        arc->end_angle = 135.0;
+        return (arc);
+}
+
+
+/*!
+ * \brief Make an \c LWPOLYLINE with one half circle segment from
+ * (0, 0) to (2, 0).
+ *
+ * The positive bulge runs counterclockwise, below the chord.
+ *
+ * \return a pointer to the lwpolyline, or \c NULL when an error
+ * occurred.
+ */
+static DxfLWPolyline *
+test_bounds_new_lwpolyline (void)
+{
+        DxfLWPolyline *lwpolyline;
+
+        lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        if (lwpolyline == NULL)
+        {
+                return (NULL);
+        }
+        if ((dxf_lwpolyline_append_vertex (lwpolyline, 0.0, 0.0, 0.0, 0.0, 1.0) == NULL)
+          || (dxf_lwpolyline_append_vertex (lwpolyline, 2.0, 0.0, 0.0, 0.0, 0.0) == NULL))
+        {
+                dxf_lwpolyline_free (lwpolyline);
+                return (NULL);
+        }
+        return (lwpolyline);
+}
+
+
+/*!
+ * \brief Perform test functions for the bounding boxes and the drawing
+ * extents.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_bounds (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double half_sqrt_2 = sqrt (2.0) / 2.0;
+        DxfEntities *entities;
+        DxfArc *arc;
+        DxfLWPolyline *lwpolyline;
+        DxfBoundingBox box;
+        DxfBoundingBox boxes[2];
+        DxfHeader header;
+        int status = EXIT_FAILURE;
+
+        /* Only $EXTMIN and $EXTMAX of the header are used. */
+        memset (&header, 0, sizeof (DxfHeader));
+        entities = dxf_entities_init (dxf_entities_new ());
+        arc = test_bounds_new_arc ();
+        lwpolyline = test_bounds_new_lwpolyline ();
+        if ((entities == NULL) || (arc == NULL) || (lwpolyline == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_append (entities, ARC, arc);
+        dxf_entities_append (entities, LWPOLYLINE, lwpolyline);
+        dxf_bounds_init (&box);
+        if (!dxf_bounds_is_empty (&box))
+        {
+                fprintf (stderr, "Error: a new bounding box is not empty.\n");
+        }
+        else if ((dxf_bounds_get_entity (ARC, arc, &box) == EXIT_FAILURE)
+          || (test_bounds_check_box ("the ARC", &box,
+          -half_sqrt_2, half_sqrt_2, half_sqrt_2, 1.0) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: the ARC does not reach the top of its circle.\n");
+        }
+        else if ((dxf_bounds_get_entity (LWPOLYLINE, lwpolyline, &box) == EXIT_FAILURE)
+          || (test_bounds_check_box ("the LWPOLYLINE", &box,
+          0.0, -1.0, 2.0, 0.0) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: the bulged LWPOLYLINE segment is not in its bounding box.\n");
+        }
+        else if ((dxf_bounds_get_entities (entities, 0, 2, boxes) != 2)
+          || (test_bounds_check_box ("entity 0", &boxes[0],
+          -half_sqrt_2, half_sqrt_2, half_sqrt_2, 1.0) == EXIT_FAILURE)
+          || (test_bounds_check_box ("entity 1", &boxes[1],
+          0.0, -1.0, 2.0, 0.0) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: wrong bounding boxes of a range of entities.\n");
+        }
+        else if ((dxf_bounds_update_header (&header, entities) == EXIT_FAILURE)
+          || (fabs (header.ExtMin.x0 + half_sqrt_2) > TEST_BOUNDS_EPSILON)
+          || (fabs (header.ExtMin.y0 + 1.0) > TEST_BOUNDS_EPSILON)
+          || (fabs (header.ExtMax.x0 - 2.0) > TEST_BOUNDS_EPSILON)
+          || (fabs (header.ExtMax.y0 - 1.0) > TEST_BOUNDS_EPSILON))
+        {
+                fprintf (stderr, "Error: $EXTMIN and $EXTMAX were not set to the extents.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        dxf_entities_free (entities);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,181 @@
+/*!
+ * \file test_dictionary_tree.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the dictionary tree of the OBJECTS section.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief \c OBJECTS section of the test file.
+ *
+ * The named object dictionary C owns dictionary D (ACAD_GROUP) with
+ * group 1F (MyGroup) and the empty dictionary 17 (ACAD_MLINESTYLE).
+ */
+static const char *test_dictionary_tree_objects =
+        "  0\nSECTION\n  2\nOBJECTS\n"
+        "  0\nDICTIONARY\n  5\nC\n"
+        "  3\nACAD_GROUP\n350\nD\n"
+        "  3\nACAD_MLINESTYLE\n350\n17\n"
+        "  0\nDICTIONARY\n  5\nD\n"
+        "102\n{ACAD_REACTORS\n330\nC\n102\n}\n330\nC\n"
+        "  3\nMyGroup\n350\n1F\n"
+        "  0\nGROUP\n  5\n1F\n330\nD\n300\nA group\n"
+        "  0\nDICTIONARY\n  5\n17\n330\nC\n"
+        "  0\nENDSEC\n  0\nEOF\n";
+
+
+/*!
+ * \brief Check the path lookups in a scanned dictionary tree.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_dictionary_tree_check_paths
+(
+        DxfDictionaryTree *tree
+                /*!< a pointer to the dictionary tree. */
+)
+{
+        const DxfDictionaryTreeNode *node;
+        int group;
+        int node_id;
+
+        if (dxf_dictionary_tree_get_number_of_nodes (tree) != 4)
+        {
+                fprintf (stderr, "Error: wrong number of dictionary tree nodes.\n");
+                return (EXIT_FAILURE);
+        }
+        group = dxf_dictionary_tree_find (tree, "ACAD_GROUP/MyGroup");
+        node = dxf_dictionary_tree_get_node (tree, group);
+        if ((node == NULL)
+          || (strcmp (node->name, "MyGroup") != 0)
+          || (node->handle != 0x1F)
+          || (node->parent != dxf_dictionary_tree_find_child (tree, 0, "ACAD_GROUP"))
+          || (dxf_dictionary_tree_get_handle (tree, "ACAD_GROUP/MyGroup") != 0x1F))
+        {
+                fprintf (stderr, "Error: could not find ACAD_GROUP/MyGroup.\n");
+                return (EXIT_FAILURE);
+        }
+        if (dxf_dictionary_tree_find (tree, "acad_group/MYGROUP") != group)
+        {
+                fprintf (stderr, "Error: the path lookup is case sensitive.\n");
+                return (EXIT_FAILURE);
+        }
+        node_id = dxf_dictionary_tree_find (tree, "ACAD_MLINESTYLE");
+        node = dxf_dictionary_tree_get_node (tree, node_id);
+        if ((node == NULL)
+          || (node->handle != 0x17)
+          || (node->first_child != -1))
+        {
+                fprintf (stderr, "Error: wrong empty dictionary ACAD_MLINESTYLE.\n");
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_dictionary_tree_find (tree, "ACAD_GROUP/Missing") != -1)
+          || (dxf_dictionary_tree_find (tree, "ACAD_MLINESTYLE/MyGroup") != -1)
+          || (dxf_dictionary_tree_get_handle (tree, "Missing") != DXF_HANDLE_NONE))
+        {
+                fprintf (stderr, "Error: a missing path was found.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the dictionary tree of the
+ * \c OBJECTS section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_dictionary_tree (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_dictionary_tree.dxf";
+        char line[DXF_MAX_STRING_LENGTH];
+        DxfFile fp;
+        DxfDictionaryTree *tree;
+        int status = EXIT_FAILURE;
+
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.filename = (char *) filename;
+        fp.fp = fopen (filename, "w");
+        if (fp.fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fputs (test_dictionary_tree_objects, fp.fp);
+        fclose (fp.fp);
+        fp.fp = fopen (filename, "r");
+        if (fp.fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Position the file just after the OBJECTS section name. */
+        while ((dxf_entities_get_line (fp.fp, line, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS)
+          && (strcmp (line, "OBJECTS") != 0))
+        {
+                fp.line_number++;
+        }
+        tree = dxf_dictionary_tree_init (dxf_dictionary_tree_new ());
+        if (tree == NULL)
+        {
+                fclose (fp.fp);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_dictionary_tree_scan (&fp, tree) == EXIT_FAILURE)
+        {
+                fprintf (stderr, "Error: could not scan the OBJECTS section.\n");
+        }
+        else
+        {
+                status = test_dictionary_tree_check_paths (tree);
+        }
+        dxf_dictionary_tree_free (tree);
+        fclose (fp.fp);
+        remove (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,194 @@
+/*!
+ * \file test_draw_order.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the draw order of the entities of a block.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Free the entity handle / sort handle pairs of a
+ * \c SORTENTSTABLE.
+ */
+static void
+test_draw_order_free_pairs
+(
+        DxfSortentsTable *sortentstable
+                /*!< the \c SORTENTSTABLE. */
+)
+{
+        DxfInt *sort_handle;
+
+        if (sortentstable->entity_owner != NULL)
+        {
+                dxf_char_free_list (sortentstable->entity_owner);
+                sortentstable->entity_owner = NULL;
+        }
+        while (sortentstable->sort_handle != NULL)
+        {
+                sort_handle = sortentstable->sort_handle;
+                sortentstable->sort_handle = (DxfInt *) sort_handle->next;
+                free (sort_handle);
+        }
+}
+
+
+/*!
+ * \brief Check the positions of the entities in draw order.
+ *
+ * \return \c EXIT_SUCCESS when the draw order is the expected one, or
+ * \c EXIT_FAILURE when it differs.
+ */
+static int
+test_draw_order_check
+(
+        const char *what,
+                /*!< the description of the draw order. */
+        DxfDrawOrder *order,
+                /*!< a pointer to the draw order. */
+        int p0,
+                /*!< the expected position at rank 0. */
+        int p1,
+                /*!< the expected position at rank 1. */
+        int p2,
+                /*!< the expected position at rank 2. */
+        int p3
+                /*!< the expected position at rank 3. */
+)
+{
+        const int expected[4] = {p0, p1, p2, p3};
+        const int *positions;
+        int i;
+
+        positions = dxf_draw_order_get_order (order);
+        if ((positions == NULL)
+          || (dxf_draw_order_get_number_of_entities (order) != 4))
+        {
+                fprintf (stderr, "Error: no draw order %s.\n", what);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                if ((positions[i] != expected[i])
+                  || (dxf_draw_order_get_position (order, i) != expected[i])
+                  || (dxf_draw_order_get_rank (order, expected[i]) != i))
+                {
+                        fprintf (stderr, "Error: wrong draw order %s at rank %d.\n", what, i);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the draw order of the entities of
+ * a block.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_draw_order (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfHandle handles[4] = {0x10, 0x11, 0x12, 0x13};
+        DxfSortentsTable sortentstable;
+        DxfSortentsTable stored;
+        DxfDrawOrder *order;
+        DxfDrawOrder *rebuilt;
+        int status = EXIT_FAILURE;
+
+        /* Entity 10 is sorted as 20, it is drawn last. */
+        memset (&sortentstable, 0, sizeof (DxfSortentsTable));
+        memset (&stored, 0, sizeof (DxfSortentsTable));
+        sortentstable.block_owner = 0x1F;
+        sortentstable.entity_owner = dxf_char_new ();
+        sortentstable.sort_handle = dxf_int_new ();
+        order = dxf_draw_order_init (dxf_draw_order_new ());
+        rebuilt = dxf_draw_order_init (dxf_draw_order_new ());
+        if ((sortentstable.entity_owner == NULL)
+          || (sortentstable.sort_handle == NULL)
+          || (order == NULL)
+          || (rebuilt == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        sortentstable.entity_owner->value = dxf_handle_to_string (0x10);
+        sortentstable.entity_owner->length = strlen (sortentstable.entity_owner->value);
+        sortentstable.sort_handle->value = 0x20;
+        if ((dxf_draw_order_build (order, handles, 4, &sortentstable) == EXIT_FAILURE)
+          || (test_draw_order_check ("from the SORTENTSTABLE", order, 1, 2, 3, 0) == EXIT_FAILURE)
+          || (order->block_record != 0x1F)
+          || (dxf_draw_order_get_sort_handle (order, 0) != 0x20))
+        {
+                fprintf (stderr, "Error: could not build the draw order from a SORTENTSTABLE.\n");
+        }
+        else if ((dxf_draw_order_move_to_bottom (order, 0) == EXIT_FAILURE)
+          || (test_draw_order_check ("after moving to the bottom", order, 0, 1, 2, 3) == EXIT_FAILURE)
+          || (dxf_draw_order_move_to_top (order, 1) == EXIT_FAILURE)
+          || (test_draw_order_check ("after moving to the top", order, 0, 2, 3, 1) == EXIT_FAILURE)
+          || (dxf_draw_order_move_above (order, 0, 3) == EXIT_FAILURE)
+          || (test_draw_order_check ("after moving above", order, 2, 3, 0, 1) == EXIT_FAILURE)
+          || (dxf_draw_order_move_below (order, 1, 2) == EXIT_FAILURE)
+          || (test_draw_order_check ("after moving below", order, 1, 2, 3, 0) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not move entities in the draw order.\n");
+        }
+        else if ((dxf_draw_order_fill_sortentstable (order, &stored) == EXIT_FAILURE)
+          || (stored.block_owner != 0x1F)
+          || (dxf_draw_order_build (rebuilt, handles, 4, &stored) == EXIT_FAILURE)
+          || (test_draw_order_check ("from the stored SORTENTSTABLE", rebuilt, 1, 2, 3, 0) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: the draw order was not stored in a SORTENTSTABLE.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        test_draw_order_free_pairs (&sortentstable);
+        test_draw_order_free_pairs (&stored);
+        dxf_draw_order_free (order);
+        dxf_draw_order_free (rebuilt);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
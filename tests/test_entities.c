@@ -0,0 +1,384 @@
+/*!
+ * \file test_entities.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for lazily loading a DXF \c ENTITIES section.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Scan a DXF \c ENTITIES section with a \c POLYLINE and an
+ * \c INSERT sequence and materialize the sequences.
+ *
+ * The \c VERTEX, \c ATTRIB and \c SEQEND entities are part of the lazy
+ * item of their \c POLYLINE or \c INSERT, the handles of the children
+ * do not replace the handle of the item.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_entities_sequences (void)
+{
+        const char *filename = "test_entities.dxf";
+        DxfEntities *entities;
+        DxfEntitiesLazyItem *item;
+        DxfPolyline *polyline;
+        DxfInsert *insert;
+        DxfVertex *vertex;
+        int status = EXIT_FAILURE;
+
+        if (test_write_file (filename,
+          "  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nPOLYLINE\n  5\n1A2B3C4D5E\n  8\nWALLS\n 66\n1\n"
+          "  0\nVERTEX\n  5\n11\n  8\nWALLS\n 10\n1.0\n 20\n2.0\n"
+          "  0\nVERTEX\n  5\n12\n  8\nWALLS\n 10\n3.0\n 20\n4.0\n"
+          "  0\nSEQEND\n  5\n13\n  8\nWALLS\n"
+          "  0\nINSERT\n  5\n20\n  8\n0\n 66\n1\n  2\nDOOR\n"
+          "  0\nATTRIB\n  5\n21\n  8\n0\n  1\nD1\n  2\nTAG\n"
+          "  0\nSEQEND\n  5\n22\n  8\n0\n"
+          "  0\nLINE\n  5\n30\n  8\n0\n"
+          "  0\nENDSEC\n  0\nEOF\n") == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_FAILURE)
+          || (dxf_entities_get_number_of_lazy_items (entities) != 3))
+        {
+                fprintf (stderr, "Error: could not scan the sequences.\n");
+        }
+        else if (((item = dxf_entities_get_lazy_item (entities, 0)) == NULL)
+          || (item->type != POLYLINE)
+          || (item->id_code != 0x1A2B3C4D5EULL)
+          || (strcmp (item->layer, "WALLS") != 0)
+          || (item->number_of_children != 2)
+          || ((item = dxf_entities_get_lazy_item (entities, 1)) == NULL)
+          || (item->type != INSERT)
+          || (item->id_code != 0x20)
+          || (strcmp (item->block_name, "DOOR") != 0)
+          || (item->number_of_children != 1)
+          || ((item = dxf_entities_get_lazy_item (entities, 2)) == NULL)
+          || (item->type != LINE)
+          || (item->id_code != 0x30))
+        {
+                fprintf (stderr, "Error: wrong lazy item of a sequence.\n");
+        }
+        else
+        {
+                polyline = dxf_entities_materialize (entities, 0, NULL);
+                insert = dxf_entities_materialize (entities, 1, NULL);
+                vertex = (polyline != NULL) ? polyline->vertices : NULL;
+                if ((vertex == NULL)
+                  || (vertex->common.id_code != 0x11)
+                  || (vertex->p0->x0 != 1.0)
+                  || (vertex->next == NULL)
+                  || (((DxfVertex *) vertex->next)->p0->y0 != 4.0)
+                  || (((DxfVertex *) vertex->next)->next != NULL)
+                  || (insert == NULL)
+                  || (insert->attributes == NULL)
+                  || (insert->attributes->common.id_code != 0x21)
+                  || (insert->attributes->next != NULL))
+                {
+                        fprintf (stderr, "Error: wrong entities of a sequence.\n");
+                }
+                else
+                {
+                        status = EXIT_SUCCESS;
+                }
+        }
+        dxf_entities_free (entities);
+        remove (filename);
+        return (status);
+}
+
+
+/*!
+ * \brief Append entities to an initialized DXF \c ENTITIES section.
+ *
+ * The lists of a new section are empty, the appended entities keep
+ * their order in the sequence and in the lists of their type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_entities_append (void)
+{
+        DxfEntities *entities;
+        DxfLine *line_1;
+        DxfLine *line_2;
+        DxfMesh *mesh;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
+
+        entities = dxf_entities_init (dxf_entities_new ());
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_get_first (entities, LINE) != NULL)
+          || (dxf_entities_get_first (entities, MESH) != NULL)
+          || (dxf_entities_get_number_of_entities (entities) != 0))
+        {
+                fprintf (stderr, "Error: a new section is not empty.\n");
+                dxf_entities_free (entities);
+                return (EXIT_FAILURE);
+        }
+        line_1 = dxf_line_init (dxf_line_new ());
+        mesh = dxf_mesh_init (dxf_mesh_new ());
+        line_2 = dxf_line_init (dxf_line_new ());
+        if ((dxf_entities_append (entities, LINE, line_1) == EXIT_FAILURE)
+          || (dxf_entities_append (entities, MESH, mesh) == EXIT_FAILURE)
+          || (dxf_entities_append (entities, LINE, line_2) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not append the entities.\n");
+        }
+        else if ((dxf_entities_get_number_of_entities (entities) != 3)
+          || (dxf_entities_get_entity (entities, 0, &type) != line_1)
+          || (type != LINE)
+          || (dxf_entities_get_entity (entities, 1, &type) != mesh)
+          || (type != MESH)
+          || (dxf_entities_get_entity (entities, 2, &type) != line_2)
+          || (type != LINE))
+        {
+                fprintf (stderr, "Error: wrong sequence of appended entities.\n");
+        }
+        else if ((dxf_entities_get_first (entities, LINE) != line_1)
+          || (dxf_entities_get_next (LINE, line_1) != line_2)
+          || (dxf_entities_get_next (LINE, line_2) != NULL)
+          || (dxf_entities_get_first (entities, MESH) != mesh)
+          || (dxf_entities_get_next (MESH, mesh) != NULL)
+          || (dxf_entities_get_number_of_entities_of_type (entities, LINE) != 2)
+          || (dxf_entities_get_entity_of_type (entities, LINE, 1) != line_2)
+          || (dxf_entities_get_entity_of_type (entities, MESH, 0) != mesh))
+        {
+                fprintf (stderr, "Error: wrong lists of appended entities.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        /* The appended entities are freed with the section. */
+        dxf_entities_free (entities);
+        return (status);
+}
+
+
+/*!
+ * \brief Create \c LINE and \c POINT entities in batches from their
+ * prototypes.
+ *
+ * The entities of a batch are adjacent in memory and keep the values
+ * passed in the arrays, a replaced start point is freed with the
+ * section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_entities_create (void)
+{
+        char *layer[3] = {"A", "B", "C"};
+        const int16_t color[3] = {1, 2, 3};
+        const double x[3] = {1.0, 2.0, 3.0};
+        DxfEntities *entities;
+        DxfLine *line;
+        DxfPoint *point;
+        DxfPoint *p0;
+        int status = EXIT_FAILURE;
+
+        entities = dxf_entities_init (dxf_entities_new ());
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_create_lines (entities, 3, layer, color, x, NULL, NULL, NULL, x, NULL) == EXIT_FAILURE)
+          || (dxf_entities_create_points (entities, 2, NULL, NULL, NULL, x, NULL) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not create the entities.\n");
+                dxf_entities_free (entities);
+                return (EXIT_FAILURE);
+        }
+        line = dxf_entities_get_entity_of_type (entities, LINE, 0);
+        point = dxf_entities_get_entity_of_type (entities, POINT, 0);
+        if ((dxf_entities_get_number_of_entities (entities) != 5)
+          || (line == NULL)
+          || (dxf_entities_get_entity_of_type (entities, LINE, 2) != line + 2)
+          || ((DxfLine *) line->next != line + 1)
+          || (strcmp (line[2].common.layer, "C") != 0)
+          || (strcmp (line[2].common.linetype, DXF_DEFAULT_LINETYPE) != 0)
+          || (line[2].common.color != 3)
+          || (line[2].p0->x0 != 3.0)
+          || (line[2].p1->y0 != 3.0)
+          || (line[2].next != NULL)
+          || (point == NULL)
+          || (dxf_entities_get_entity_of_type (entities, POINT, 1) != point + 1)
+          || (strcmp (point[1].common.layer, DXF_DEFAULT_LAYER) != 0)
+          || (point[1].y0 != 2.0))
+        {
+                fprintf (stderr, "Error: wrong entities created in a batch.\n");
+        }
+        else
+        {
+                /* A replaced start point is owned by the line. */
+                p0 = dxf_point_new ();
+                if (p0 != NULL)
+                {
+                        line[1].p0 = p0;
+                        status = EXIT_SUCCESS;
+                }
+        }
+        dxf_entities_free (entities);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for lazily loading the \c ENTITIES
+ * section of the example drawing.
+ *
+ * Every entity is materialized, checked against its lazy item,
+ * released and materialized again.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_entities (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityType expected[14] =
+        {
+                LINE, LINE, LINE, LINE, LINE, LINE, LINE, LINE, LINE,
+                ARC, CIRCLE, MTEXT, DIMENSION, DIMENSION
+        };
+        DxfEntities *entities;
+        DxfEntitiesLazyItem *item;
+        DxfEntityCommon *common;
+        DxfEntityType type;
+        void *entity;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (TEST_EXAMPLE_R2000, entities) == EXIT_FAILURE)
+          || (dxf_entities_get_number_of_lazy_items (entities) != 14))
+        {
+                fprintf (stderr, "Error: could not scan file: %s.\n",
+                  TEST_EXAMPLE_R2000);
+                dxf_entities_free (entities);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; (i < 14) && (status == EXIT_SUCCESS); i++)
+        {
+                status = EXIT_FAILURE;
+                item = dxf_entities_get_lazy_item (entities, i);
+                if ((item == NULL)
+                  || (item->type != expected[i])
+                  || (item->id_code != 0x43 + i)
+                  || (item->entity != NULL))
+                {
+                        fprintf (stderr, "Error: wrong lazy item %d.\n", i);
+                        break;
+                }
+                /* The entity is read on first access and kept. */
+                entity = dxf_entities_materialize (entities, i, &type);
+                common = (entity != NULL) ? dxf_entity_get_common (type, entity) : NULL;
+                if ((common == NULL)
+                  || (type != expected[i])
+                  || (common->id_code != item->id_code)
+                  || (strcmp (common->layer, item->layer) != 0)
+                  || (dxf_entities_materialize (entities, i, NULL) != entity))
+                {
+                        fprintf (stderr, "Error: wrong entity %d.\n", i);
+                        break;
+                }
+                if ((i == 0)
+                  && ((dxf_line_get_x0 (entity) != 0.0)
+                  || (dxf_line_get_x1 (entity) != 320.0)))
+                {
+                        fprintf (stderr, "Error: wrong coordinates of entity %d.\n", i);
+                        break;
+                }
+                /* Released entities are read again on the next access. */
+                if ((dxf_entities_release (entities, i) == EXIT_FAILURE)
+                  || (item->entity != NULL))
+                {
+                        fprintf (stderr, "Error: could not release entity %d.\n", i);
+                        break;
+                }
+                entity = dxf_entities_materialize (entities, i, &type);
+                common = (entity != NULL) ? dxf_entity_get_common (type, entity) : NULL;
+                if ((common == NULL)
+                  || (common->id_code != item->id_code))
+                {
+                        fprintf (stderr, "Error: could not read entity %d again.\n", i);
+                        break;
+                }
+                status = EXIT_SUCCESS;
+        }
+        /* Materialized entities are freed with the section. */
+        dxf_entities_free (entities);
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_entities_sequences ();
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_entities_append ();
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_entities_create ();
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,191 @@
+/*!
+ * \file test_handle.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for numeric DXF handles.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Parse and format handles, including handles wider than 32
+ * bits.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_handle_parse (void)
+{
+        char buffer[DXF_HANDLE_STRING_LENGTH];
+
+        if ((dxf_handle_parse ("1A2B3C4D5E6F7080") != 0x1A2B3C4D5E6F7080ULL)
+          || (dxf_handle_parse ("ff") != 0xFF)
+          || (dxf_handle_parse ("12G") != 0x12)
+          || (dxf_handle_parse ("") != DXF_HANDLE_NONE)
+          || (dxf_handle_parse (NULL) != DXF_HANDLE_NONE))
+        {
+                fprintf (stderr, "Error: wrong parsed handle.\n");
+                return (EXIT_FAILURE);
+        }
+        if ((strcmp (dxf_handle_format (0xFEDCBA9876543210ULL, buffer), "FEDCBA9876543210") != 0)
+          || (strcmp (dxf_handle_format (0x2A, buffer), "2A") != 0)
+          || (strcmp (dxf_handle_format (DXF_HANDLE_NONE, buffer), "0") != 0))
+        {
+                fprintf (stderr, "Error: wrong formatted handle.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write a \c LINE entity with a 64 bit handle and read it back
+ * with the lazy reader.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_handle_entity (void)
+{
+        const char *filename = "test_handle.dxf";
+        const DxfHandle handle = 0xFEDCBA9876543210ULL;
+        char line[DXF_MAX_STRING_LENGTH];
+        DxfFile fp;
+        DxfLine *line_entity;
+        DxfEntities *entities;
+        DxfEntitiesLazyItem *item;
+        DxfEntityCommon *common;
+        DxfEntityType type;
+        void *entity;
+        FILE *file;
+        int found = FALSE;
+        int status = EXIT_FAILURE;
+
+        line_entity = dxf_line_init (dxf_line_new ());
+        if (line_entity == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        line_entity->common.id_code = handle;
+        dxf_line_set_x1 (line_entity, 10.0);
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.filename = (char *) filename;
+        fp.acad_version_number = AutoCAD_2000;
+        fp.fp = fopen (filename, "w");
+        if (fp.fp == NULL)
+        {
+                dxf_line_free (line_entity);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp.fp, "  0\nSECTION\n  2\nENTITIES\n");
+        dxf_line_write (&fp, line_entity);
+        fprintf (fp.fp, "  0\nENDSEC\n  0\nEOF\n");
+        fclose (fp.fp);
+        dxf_line_free (line_entity);
+        /* The handle is written in full, after a right aligned group
+         * code. */
+        file = fopen (filename, "r");
+        if (file == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        while (dxf_entities_get_line (file, line, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS)
+        {
+                if ((strcmp (line, "  5") == 0)
+                  && (dxf_entities_get_line (file, line, DXF_MAX_STRING_LENGTH) == EXIT_SUCCESS)
+                  && (strcmp (line, "FEDCBA9876543210") == 0))
+                {
+                        found = TRUE;
+                }
+        }
+        fclose (file);
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                remove (filename);
+                return (EXIT_FAILURE);
+        }
+        if ((found)
+          && (dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+          && ((item = dxf_entities_get_lazy_item (entities, 0)) != NULL)
+          && (item->id_code == handle))
+        {
+                entity = dxf_entities_materialize (entities, 0, &type);
+                common = (entity != NULL) ? dxf_entity_get_common (type, entity) : NULL;
+                if ((common != NULL)
+                  && (common->id_code == handle)
+                  && (dxf_entities_get_id_code (type, entity) == handle))
+                {
+                        status = EXIT_SUCCESS;
+                }
+        }
+        if (status == EXIT_FAILURE)
+        {
+                fprintf (stderr, "Error: wrong handle of a LINE read back.\n");
+        }
+        dxf_entities_free (entities);
+        remove (filename);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for numeric DXF handles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_handle (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int status;
+
+        status = test_handle_parse ();
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_handle_entity ();
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,194 @@
+/*!
+ * \file test_handle_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the handle index.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_HANDLE_INDEX_HANDLES 2048
+#define TEST_HANDLE_INDEX_OPERATIONS 20000
+
+
+/*!
+ * \brief Compare a handle index with a plain array of the expected
+ * items.
+ *
+ * \return \c EXIT_SUCCESS when the index holds the expected items, or
+ * \c EXIT_FAILURE when it differs.
+ */
+static int
+test_handle_index_compare
+(
+        DxfHandleIndex *index,
+                /*!< a pointer to the handle index. */
+        int *items,
+                /*!< the items, indexed by handle - 1. */
+        const int *types,
+                /*!< the expected types, -1 for handles which are not in
+                 * the index. */
+        size_t number_of_handles
+                /*!< the expected number of handles in the index. */
+)
+{
+        void *pointer;
+        int type;
+        int i;
+
+        if (dxf_handle_index_get_number_of_handles (index) != number_of_handles)
+        {
+                fprintf (stderr, "Error: expected %lu handles, got %lu.\n",
+                  (unsigned long) number_of_handles,
+                  (unsigned long) dxf_handle_index_get_number_of_handles (index));
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < TEST_HANDLE_INDEX_HANDLES; i++)
+        {
+                type = -1;
+                pointer = dxf_handle_index_find (index, (DxfHandle) (i + 1), &type);
+                if ((types[i] < 0)
+                  ? (pointer != NULL)
+                  : ((pointer != &items[i]) || (type != types[i])))
+                {
+                        fprintf (stderr, "Error: wrong entry for handle %x.\n", i + 1);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the handle index.
+ *
+ * A pseudo random sequence of additions, replacements and removals is
+ * checked against a plain array, the removals shift entries back in
+ * their probe sequence which is easy to get wrong.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_handle_index (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int items[TEST_HANDLE_INDEX_HANDLES];
+        int types[TEST_HANDLE_INDEX_HANDLES];
+        DxfHandleIndex *index;
+        unsigned long seed = 12345;
+        size_t number_of_handles = 0;
+        int status = EXIT_SUCCESS;
+        int result;
+        int i;
+        int h;
+
+        for (i = 0; i < TEST_HANDLE_INDEX_HANDLES; i++)
+        {
+                items[i] = i;
+                types[i] = -1;
+        }
+        index = dxf_handle_index_init (dxf_handle_index_new ());
+        if (index == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; (i < TEST_HANDLE_INDEX_OPERATIONS) && (status == EXIT_SUCCESS); i++)
+        {
+                seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+                h = (int) ((seed >> 8) % TEST_HANDLE_INDEX_HANDLES);
+                if ((seed & 0x3) != 0)
+                {
+                        /* Add, or replace the type of an existing
+                         * entry. */
+                        if (types[h] < 0)
+                        {
+                                number_of_handles++;
+                        }
+                        types[h] = (int) ((seed >> 4) % DXF_HANDLE_INDEX_OBJECT);
+                        result = dxf_handle_index_add (index, (DxfHandle) (h + 1),
+                          types[h], &items[h]);
+                        status = (result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+                }
+                else
+                {
+                        /* Removing a missing handle fails. */
+                        result = dxf_handle_index_remove (index, (DxfHandle) (h + 1));
+                        if (result != ((types[h] < 0) ? EXIT_FAILURE : EXIT_SUCCESS))
+                        {
+                                fprintf (stderr, "Error: wrong result removing handle %x.\n", h + 1);
+                                status = EXIT_FAILURE;
+                        }
+                        if (types[h] >= 0)
+                        {
+                                number_of_handles--;
+                        }
+                        types[h] = -1;
+                }
+                if ((status == EXIT_SUCCESS) && (i % 1000 == 999))
+                {
+                        status = test_handle_index_compare (index, items, types,
+                          number_of_handles);
+                }
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_handle_index_compare (index, items, types,
+                  number_of_handles);
+        }
+        /* Remove all handles. */
+        for (i = 0; (i < TEST_HANDLE_INDEX_HANDLES) && (status == EXIT_SUCCESS); i++)
+        {
+                if (types[i] >= 0)
+                {
+                        status = dxf_handle_index_remove (index, (DxfHandle) (i + 1));
+                        types[i] = -1;
+                        number_of_handles--;
+                }
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_handle_index_compare (index, items, types, 0);
+        }
+        dxf_handle_index_free (index);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,205 @@
+/*!
+ * \file test_hatch.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the DXF \c HATCH entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Count the vertices of a \c HATCH boundary path polyline and
+ * return the last vertex.
+ *
+ * \return the number of vertices.
+ */
+static int
+test_hatch_count_vertices
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a \c HATCH boundary path polyline. */
+        DxfHatchBoundaryPathPolylineVertex **last
+                /*!< the last vertex found. */
+)
+{
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        int count = 0;
+
+        *last = NULL;
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                *last = iter;
+                count++;
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Check the boundary paths of a DXF \c HATCH entity read from a
+ * file and append a vertex to the polyline path.
+ *
+ * The reader appends the paths, edges and vertices through the cached
+ * last members, these have to point at the tails of the lists.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_hatch_check
+(
+        DxfHatch *hatch
+                /*!< a pointer to a DXF \c HATCH entity. */
+)
+{
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *last;
+        DxfHatchBoundaryPathEdge *edge;
+
+        path = (DxfHatchBoundaryPath *) hatch->paths;
+        polyline = (path != NULL) ? (DxfHatchBoundaryPathPolyline *) path->polylines : NULL;
+        if ((path == NULL)
+          || (polyline == NULL)
+          || (path->next == NULL)
+          || (hatch->last_path != path->next)
+          || (test_hatch_count_vertices (polyline, &last) != 3)
+          || ((DxfHatchBoundaryPathPolylineVertex *) polyline->last_vertex != last)
+          || (last->x0 != 1.0)
+          || (last->y0 != 1.0))
+        {
+                fprintf (stderr, "Error: wrong polyline path of the HATCH entity.\n");
+                return (EXIT_FAILURE);
+        }
+        edge = (DxfHatchBoundaryPathEdge *) ((DxfHatchBoundaryPath *) path->next)->edges;
+        if ((edge == NULL)
+          || ((DxfHatchBoundaryPathEdge *) ((DxfHatchBoundaryPath *) path->next)->last_edge != edge)
+          || (edge->lines == NULL)
+          || (((DxfHatchBoundaryPathEdgeLine *) edge->lines)->next == NULL)
+          || (edge->last_line != ((DxfHatchBoundaryPathEdgeLine *) edge->lines)->next)
+          || (((DxfHatchBoundaryPathEdgeLine *) edge->last_line)->y1 != 1.0)
+          || (edge->arcs == NULL)
+          || (edge->last_arc != edge->arcs)
+          || (((DxfHatchBoundaryPathEdgeArc *) edge->arcs)->radius != 0.5))
+        {
+                fprintf (stderr, "Error: wrong edge path of the HATCH entity.\n");
+                return (EXIT_FAILURE);
+        }
+        vertex = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+        vertex->x0 = 2.0;
+        if ((dxf_hatch_boundary_path_polyline_append_vertex (polyline, vertex) == EXIT_FAILURE)
+          || ((DxfHatchBoundaryPathPolylineVertex *) last->next != vertex)
+          || ((DxfHatchBoundaryPathPolylineVertex *) polyline->last_vertex != vertex)
+          || (test_hatch_count_vertices (polyline, &last) != 4))
+        {
+                fprintf (stderr, "Error: could not append a vertex to the HATCH entity.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the DXF \c HATCH entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_hatch (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_hatch.dxf";
+        DxfEntities *entities;
+        DxfHatch *hatch;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
+
+        if (test_write_file (filename,
+          "  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nHATCH\n  5\n2A\n  8\n0\n100\nAcDbEntity\n100\nAcDbHatch\n"
+          " 10\n0.0\n 20\n0.0\n 30\n0.0\n210\n0.0\n220\n0.0\n230\n1.0\n"
+          "  2\nSOLID\n 70\n1\n 71\n0\n 91\n2\n"
+          " 92\n2\n 72\n0\n 73\n1\n 93\n3\n"
+          " 10\n0.0\n 20\n0.0\n 10\n1.0\n 20\n0.0\n 10\n1.0\n 20\n1.0\n 97\n0\n"
+          " 92\n1\n 93\n3\n"
+          " 72\n1\n 10\n0.0\n 20\n0.0\n 11\n1.0\n 21\n0.0\n"
+          " 72\n1\n 10\n1.0\n 20\n0.0\n 11\n1.0\n 21\n1.0\n"
+          " 72\n2\n 10\n0.5\n 20\n0.5\n 40\n0.5\n 50\n0.0\n 51\n180.0\n 73\n1\n"
+          " 97\n0\n 75\n0\n 76\n1\n 98\n0\n"
+          "  0\nENDSEC\n  0\nEOF\n") == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                remove (filename);
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+          && (dxf_entities_get_number_of_lazy_items (entities) == 1))
+        {
+                hatch = dxf_entities_materialize (entities, 0, &type);
+                if ((hatch != NULL) && (type == HATCH))
+                {
+                        status = test_hatch_check (hatch);
+                }
+        }
+        else
+        {
+                fprintf (stderr, "Error: could not scan file: %s.\n", filename);
+        }
+        dxf_entities_free (entities);
+        remove (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,264 @@
+/*!
+ * \file test_layer_partition.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the layer partitioned entity index.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Layers of the test drawing: name, flag and color.
+ */
+static const struct
+{
+        const char *name;
+        int16_t flag;
+        int16_t color;
+} test_layer_partition_layers[4] =
+{
+        {"0", 0, 7},
+        {"FROZEN", 1, 7},
+        {"OFF", 0, -7},
+        {"LOCKED", 4, 7}
+};
+
+
+/*!
+ * \brief Layers of the entities of the test drawing, in file order.
+ *
+ * Layer \c NEW is not in the \c LAYER table.
+ */
+static const char *test_layer_partition_entity_layers[6] =
+{
+        "0", "FROZEN", "OFF", "LOCKED", "0", "NEW"
+};
+
+
+/*!
+ * \brief Make the \c LAYER table of the test drawing.
+ *
+ * \return a pointer to the first layer, or \c NULL when an error
+ * occurred.
+ */
+static DxfLayer *
+test_layer_partition_new_layers (void)
+{
+        DxfLayer *first = NULL;
+        DxfLayer *last = NULL;
+        DxfLayer *layer;
+        int i;
+
+        for (i = 0; i < 4; i++)
+        {
+                layer = dxf_layer_init (dxf_layer_new ());
+                if (layer == NULL)
+                {
+                        if (first != NULL)
+                        {
+                                dxf_layer_free_list (first);
+                        }
+                        return (NULL);
+                }
+                free (layer->layer_name);
+                layer->layer_name = strdup (test_layer_partition_layers[i].name);
+                layer->flag = test_layer_partition_layers[i].flag;
+                layer->color = test_layer_partition_layers[i].color;
+                if (last == NULL)
+                {
+                        first = layer;
+                }
+                else
+                {
+                        last->next = (struct DxfLayer *) layer;
+                }
+                last = layer;
+        }
+        return (first);
+}
+
+
+/*!
+ * \brief Check the entities selected from a set of layers.
+ *
+ * \return \c EXIT_SUCCESS when the selection is the expected one, or
+ * \c EXIT_FAILURE when it differs.
+ */
+static int
+test_layer_partition_check_selection
+(
+        DxfLayerPartition *partition,
+                /*!< a pointer to the partition. */
+        const uint64_t *set,
+                /*!< the set of layers to select. */
+        int visible_only,
+                /*!< select only the visible entities. */
+        const int *expected,
+                /*!< the expected positions. */
+        int number_of_expected
+                /*!< the number of expected positions. */
+)
+{
+        int positions[6];
+        int number_of_positions;
+
+        number_of_positions = dxf_layer_partition_select (partition, set, visible_only, positions);
+        if ((number_of_positions != number_of_expected)
+          || (memcmp (positions, expected, number_of_expected * sizeof (int)) != 0))
+        {
+                fprintf (stderr, "Error: wrong entities selected from a set of layers (visible only: %d).\n",
+                  visible_only);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the layer partitioned entity
+ * index.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_layer_partition (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *set_names[2] = {"0", "OFF"};
+        const int all_on_set[3] = {0, 2, 4};
+        const int visible_on_set[2] = {0, 4};
+        DxfTables tables;
+        DxfEntities *entities;
+        DxfLayerPartition *partition;
+        DxfLayerIndex *layer_index = NULL;
+        DxfLine *line;
+        uint64_t *set = NULL;
+        const int *positions;
+        int number_of_positions;
+        int layer_0;
+        int frozen;
+        int off;
+        int locked;
+        int status = EXIT_FAILURE;
+        int i;
+
+        memset (&tables, 0, sizeof (DxfTables));
+        tables.layers = test_layer_partition_new_layers ();
+        entities = dxf_entities_init (dxf_entities_new ());
+        partition = dxf_layer_partition_init (dxf_layer_partition_new ());
+        if ((tables.layers == NULL) || (entities == NULL) || (partition == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < 6; i++)
+        {
+                line = dxf_line_init (dxf_line_new ());
+                free (line->common.layer);
+                line->common.layer = strdup (test_layer_partition_entity_layers[i]);
+                dxf_entities_append (entities, LINE, line);
+        }
+        if ((dxf_layer_partition_add_tables (partition, &tables) == EXIT_FAILURE)
+          || (dxf_layer_partition_add_entities (partition, entities) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not build the layer partition.\n");
+        }
+        else if ((dxf_layer_partition_get_number_of_layers (partition) != 5)
+          || ((layer_0 = dxf_layer_partition_find_layer (partition, "0")) < 0)
+          || ((frozen = dxf_layer_partition_find_layer (partition, "FROZEN")) < 0)
+          || ((off = dxf_layer_partition_find_layer (partition, "OFF")) < 0)
+          || ((locked = dxf_layer_partition_find_layer (partition, "LOCKED")) < 0)
+          || (dxf_layer_partition_find_layer (partition, "MISSING") >= 0)
+          || (strcmp (dxf_layer_partition_get_layer_name (partition, off), "OFF") != 0))
+        {
+                fprintf (stderr, "Error: wrong interned layers.\n");
+        }
+        else if ((!dxf_layer_partition_is_frozen (partition, frozen))
+          || (dxf_layer_partition_is_frozen (partition, layer_0))
+          || (!dxf_layer_partition_is_off (partition, off))
+          || (!dxf_layer_partition_is_locked (partition, locked))
+          || (!dxf_layer_partition_is_visible (partition, layer_0))
+          || (!dxf_layer_partition_is_visible (partition, locked))
+          || (dxf_layer_partition_is_visible (partition, frozen))
+          || (dxf_layer_partition_is_visible (partition, off))
+          || (!dxf_layer_partition_is_entity_visible (partition, 5))
+          || (dxf_layer_partition_is_entity_visible (partition, 1)))
+        {
+                fprintf (stderr, "Error: wrong layer states.\n");
+        }
+        else if (((positions = dxf_layer_partition_get_entities_on_layer (partition, layer_0, &number_of_positions)) == NULL)
+          || (number_of_positions != 2)
+          || (positions[0] != 0)
+          || (positions[1] != 4))
+        {
+                fprintf (stderr, "Error: wrong entities on layer 0.\n");
+        }
+        else if (((set = dxf_layer_partition_new_set (partition, set_names, 2)) == NULL)
+          || (test_layer_partition_check_selection (partition, set, 0, all_on_set, 3) == EXIT_FAILURE)
+          || (test_layer_partition_check_selection (partition, set, 1, visible_on_set, 2) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not select the entities on a set of layers.\n");
+        }
+        else if (((layer_index = dxf_layer_index_init (dxf_layer_index_new ())) == NULL)
+          || (dxf_layer_partition_fill_layer_index (partition, layer_index) == EXIT_FAILURE)
+          || (layer_index->layer_name == NULL)
+          || (strcmp (layer_index->layer_name->name, "0") != 0)
+          || (layer_index->number_of_entries[0] != 2)
+          || (layer_index->number_of_entries[4] != 1)
+          || (layer_index->number_of_entries[5] != 0))
+        {
+                fprintf (stderr, "Error: wrong LAYER_INDEX filled from the layer partition.\n");
+        }
+        else
+        {
+                status = EXIT_SUCCESS;
+        }
+        if (layer_index != NULL)
+        {
+                dxf_layer_index_free (layer_index);
+        }
+        free (set);
+        dxf_layer_partition_free (partition);
+        dxf_entities_free (entities);
+        dxf_layer_free_list (tables.layers);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
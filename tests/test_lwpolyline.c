@@ -0,0 +1,270 @@
+/*!
+ * \file test_lwpolyline.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the vertex arrays of a DXF \c LWPOLYLINE entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_LWPOLYLINE_VERTICES 1000
+
+
+/*!
+ * \brief Compare the vertex span of a DXF \c LWPOLYLINE entity with the
+ * expected arrays.
+ *
+ * \return \c EXIT_SUCCESS when the vertices are equal within
+ * \c tolerance, or \c EXIT_FAILURE when they differ.
+ */
+static int
+test_lwpolyline_compare
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        int number_vertices,
+                /*!< the expected number of vertices. */
+        const double *x,
+                /*!< the expected X-coordinates. */
+        const double *y,
+                /*!< the expected Y-coordinates. */
+        const double *bulge,
+                /*!< the expected bulges. */
+        double tolerance
+                /*!< the tolerance for the coordinates. */
+)
+{
+        DxfLWPolylineVertexSpan span;
+        int i;
+
+        span = dxf_lwpolyline_get_vertex_span (lwpolyline);
+        if ((span.number_vertices != number_vertices)
+          || (dxf_lwpolyline_get_number_vertices (lwpolyline) != number_vertices))
+        {
+                fprintf (stderr, "Error: expected %d vertices, got %d.\n",
+                  number_vertices, span.number_vertices);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_vertices; i++)
+        {
+                if ((fabs (dxf_lwpolyline_get_vertex_x (lwpolyline, i) - x[i]) > tolerance)
+                  || (fabs (dxf_lwpolyline_get_vertex_y (lwpolyline, i) - y[i]) > tolerance)
+                  || (span.bulge[i] != bulge[i]))
+                {
+                        fprintf (stderr, "Error: vertex %d differs.\n", i);
+                        return (EXIT_FAILURE);
+                }
+                if ((span.x != NULL)
+                  && ((span.x[i] != x[i]) || (span.y[i] != y[i])))
+                {
+                        fprintf (stderr, "Error: vertex %d differs in the span.\n", i);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the first entity of a DXF \c ENTITIES section with the
+ * lazy reader and compare it with the expected \c LWPOLYLINE vertices.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_lwpolyline_read
+(
+        int single_precision
+                /*!< read the coordinates in single precision. */
+)
+{
+        const char *filename = "test_lwpolyline.dxf";
+        const double x[3] = {1000.0, 1010.5, 1010.5};
+        const double y[3] = {2000.0, 2000.0, 2020.25};
+        const double bulge[3] = {0.0, 0.5, 0.0};
+        DxfEntities *entities;
+        DxfLWPolyline *lwpolyline;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
+
+        if (test_write_file (filename,
+          "  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nLWPOLYLINE\n  5\n2B\n  8\n0\n 90\n3\n 70\n0\n"
+          " 10\n1000.0\n 20\n2000.0\n"
+          " 10\n1010.5\n 20\n2000.0\n 42\n0.5\n"
+          " 10\n1010.5\n 20\n2020.25\n"
+          "  0\nENDSEC\n  0\nEOF\n") == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+          && ((!single_precision)
+          || (dxf_entities_set_single_precision (entities, 1000.0, 2000.0, 0.0) == EXIT_SUCCESS)))
+        {
+                lwpolyline = dxf_entities_materialize (entities, 0, &type);
+                if ((lwpolyline != NULL) && (type == LWPOLYLINE)
+                  && ((dxf_lwpolyline_get_vertex_span (lwpolyline).x_offset != NULL)
+                  == (single_precision != FALSE)))
+                {
+                        status = test_lwpolyline_compare (lwpolyline, 3,
+                          x, y, bulge, 1e-9);
+                }
+        }
+        dxf_entities_free (entities);
+        remove (filename);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for the vertex arrays of a DXF
+ * \c LWPOLYLINE entity.
+ *
+ * Vertices are appended one by one (growing the arrays), set in bulk,
+ * converted to single precision, copied and read from a file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_lwpolyline (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double x[TEST_LWPOLYLINE_VERTICES];
+        double y[TEST_LWPOLYLINE_VERTICES];
+        double width[TEST_LWPOLYLINE_VERTICES];
+        double bulge[TEST_LWPOLYLINE_VERTICES];
+        DxfLWPolyline *lwpolyline;
+        DxfLWPolyline *copy;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        for (i = 0; i < TEST_LWPOLYLINE_VERTICES; i++)
+        {
+                x[i] = 5000.0 + 0.25 * i;
+                y[i] = -3000.0 + 0.5 * (i % 7);
+                width[i] = 0.1 * (i % 3);
+                bulge[i] = (i % 2) ? 0.25 : 0.0;
+        }
+        /* Append the vertices one by one. */
+        lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        if (lwpolyline == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < TEST_LWPOLYLINE_VERTICES; i++)
+        {
+                if (dxf_lwpolyline_append_vertex (lwpolyline, x[i], y[i],
+                  width[i], width[i], bulge[i]) == NULL)
+                {
+                        status = EXIT_FAILURE;
+                        break;
+                }
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_lwpolyline_compare (lwpolyline,
+                  TEST_LWPOLYLINE_VERTICES, x, y, bulge, 0.0);
+        }
+        /* Update a single vertex. */
+        if (status == EXIT_SUCCESS)
+        {
+                x[10] = 42.0;
+                y[10] = -42.0;
+                dxf_lwpolyline_set_vertex_x (lwpolyline, 10, x[10]);
+                dxf_lwpolyline_set_vertex_y (lwpolyline, 10, y[10]);
+                status = test_lwpolyline_compare (lwpolyline,
+                  TEST_LWPOLYLINE_VERTICES, x, y, bulge, 0.0);
+        }
+        /* Single precision offsets relative to an origin close to the
+         * vertices. */
+        if ((status == EXIT_SUCCESS)
+          && (dxf_lwpolyline_set_single_precision (lwpolyline, 5000.0, -3000.0) == NULL))
+        {
+                status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_lwpolyline_compare (lwpolyline,
+                  TEST_LWPOLYLINE_VERTICES, x, y, bulge, 1e-2);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                copy = dxf_lwpolyline_copy (lwpolyline);
+                status = (copy == NULL) ? EXIT_FAILURE
+                  : test_lwpolyline_compare (copy,
+                  TEST_LWPOLYLINE_VERTICES, x, y, bulge, 1e-2);
+                dxf_lwpolyline_free (copy);
+        }
+        dxf_lwpolyline_free (lwpolyline);
+        /* Set all vertices in one call. */
+        lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        if ((status == EXIT_SUCCESS)
+          && (dxf_lwpolyline_set_vertices (lwpolyline, TEST_LWPOLYLINE_VERTICES,
+          x, y, width, width, bulge) == NULL))
+        {
+                status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_lwpolyline_compare (lwpolyline,
+                  TEST_LWPOLYLINE_VERTICES, x, y, bulge, 0.0);
+        }
+        dxf_lwpolyline_free (lwpolyline);
+        /* Read the vertex arrays from a file. */
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_lwpolyline_read (FALSE);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_lwpolyline_read (TRUE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
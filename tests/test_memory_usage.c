@@ -0,0 +1,231 @@
+/*!
+ * \file test_memory_usage.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the memory usage accounting.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Check that every count of a \c DxfMemoryUsage adds up to its
+ * total.
+ *
+ * \return \c EXIT_SUCCESS when the counts add up, or \c EXIT_FAILURE
+ * when they differ.
+ */
+static int
+test_memory_usage_check_totals
+(
+        DxfMemoryUsage *usage
+                /*!< a pointer to the memory usage to check. */
+)
+{
+        size_t section_bytes = 0;
+        size_t section_allocations = 0;
+        size_t kind_bytes = 0;
+        size_t kind_allocations = 0;
+        int i;
+
+        for (i = 0; i < DXF_NUMBER_OF_MEMORY_SECTIONS; i++)
+        {
+                section_bytes += usage->section[i].bytes;
+                section_allocations += usage->section[i].allocations;
+        }
+        for (i = 0; i < DXF_NUMBER_OF_MEMORY_KINDS; i++)
+        {
+                kind_bytes += usage->kind[i].bytes;
+                kind_allocations += usage->kind[i].allocations;
+        }
+        if ((section_bytes != usage->total.bytes)
+          || (section_allocations != usage->total.allocations)
+          || (kind_bytes != usage->total.bytes)
+          || (kind_allocations != usage->total.allocations))
+        {
+                fprintf (stderr, "Error: the memory usage counts do not add up to the total.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test accounting a single string and a single entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_memory_usage_entity (void)
+{
+        DxfMemoryUsage *usage;
+        DxfLine *line;
+        int status = EXIT_FAILURE;
+
+        usage = dxf_memory_usage_init (dxf_memory_usage_new ());
+        line = dxf_line_init (dxf_line_new ());
+        if ((usage == NULL) || (line == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_memory_usage_add_string (usage, DXF_MEMORY_SECTION_TABLES, UNKNOWN_ENTITY, "LAYER");
+        if ((usage->total.bytes != 6)
+          || (usage->total.allocations != 1)
+          || (usage->section[DXF_MEMORY_SECTION_TABLES].bytes != 6)
+          || (usage->kind[DXF_MEMORY_KIND_STRINGS].bytes != 6)
+          || (usage->entity_type[LINE].allocations != 0))
+        {
+                fprintf (stderr, "Error: wrong memory usage of a string.\n");
+        }
+        else if ((dxf_memory_usage_init (usage) == NULL)
+          || (dxf_memory_usage_add_entity (usage, DXF_MEMORY_SECTION_ENTITIES, LINE, line) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not account a LINE entity.\n");
+        }
+        else if ((usage->entity_type[LINE].bytes != usage->total.bytes)
+          || (usage->entity_type[LINE].allocations != usage->total.allocations)
+          || (usage->section[DXF_MEMORY_SECTION_ENTITIES].bytes != usage->total.bytes)
+          || (usage->kind[DXF_MEMORY_KIND_STRUCTS].bytes < sizeof (DxfLine))
+          || (usage->kind[DXF_MEMORY_KIND_VERTICES].bytes < 2 * sizeof (DxfPoint))
+          || (usage->kind[DXF_MEMORY_KIND_STRINGS].allocations == 0))
+        {
+                fprintf (stderr, "Error: wrong memory usage of a LINE entity.\n");
+        }
+        else
+        {
+                status = test_memory_usage_check_totals (usage);
+        }
+        dxf_line_free (line);
+        dxf_memory_usage_free (usage);
+        return (status);
+}
+
+
+/*!
+ * \brief Test accounting an \c ENTITIES section.
+ *
+ * Two lines have to count twice the memory of one line.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_memory_usage_entities (void)
+{
+        DxfMemoryUsage *usage;
+        DxfMemoryUsage *line_usage;
+        DxfEntities *entities;
+        DxfLine *line_1;
+        DxfLine *line_2;
+        FILE *stream;
+        int status = EXIT_FAILURE;
+
+        usage = dxf_memory_usage_init (dxf_memory_usage_new ());
+        line_usage = dxf_memory_usage_init (dxf_memory_usage_new ());
+        entities = dxf_entities_init (dxf_entities_new ());
+        line_1 = dxf_line_init (dxf_line_new ());
+        line_2 = dxf_line_init (dxf_line_new ());
+        if ((usage == NULL)
+          || (line_usage == NULL)
+          || (entities == NULL)
+          || (line_1 == NULL)
+          || (line_2 == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_memory_usage_add_entity (line_usage, DXF_MEMORY_SECTION_ENTITIES, LINE, line_1);
+        dxf_entities_append (entities, LINE, line_1);
+        dxf_entities_append (entities, LINE, line_2);
+        if (dxf_memory_usage_add_entities (usage, entities) == EXIT_FAILURE)
+        {
+                fprintf (stderr, "Error: could not account an ENTITIES section.\n");
+        }
+        else if ((usage->entity_type[LINE].allocations < 2 * line_usage->total.allocations)
+          || (usage->entity_type[LINE].bytes < 2 * line_usage->total.bytes)
+          || (usage->total.bytes <= usage->entity_type[LINE].bytes))
+        {
+                fprintf (stderr, "Error: wrong memory usage of an ENTITIES section.\n");
+        }
+        else
+        {
+                status = test_memory_usage_check_totals (usage);
+        }
+        /* The report goes to any stream. */
+        stream = tmpfile ();
+        if ((status == EXIT_SUCCESS)
+          && ((stream == NULL)
+          || (dxf_memory_usage_print (stream, usage) == EXIT_FAILURE)
+          || (ftell (stream) == 0)))
+        {
+                fprintf (stderr, "Error: could not print the memory usage.\n");
+                status = EXIT_FAILURE;
+        }
+        if (stream != NULL)
+        {
+                fclose (stream);
+        }
+        dxf_entities_free (entities);
+        dxf_memory_usage_free (line_usage);
+        dxf_memory_usage_free (usage);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for the memory usage accounting.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_memory_usage (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int status;
+
+        status = test_memory_usage_entity ();
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_memory_usage_entities ();
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,185 @@
+/*!
+ * \file test_mtext.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the text chunks of a DXF \c MTEXT entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Compare the text chunks of two DXF \c MTEXT entities.
+ *
+ * \return \c EXIT_SUCCESS when the chunks are equal, or \c EXIT_FAILURE
+ * when they differ.
+ */
+static int
+test_mtext_compare_chunks
+(
+        DxfMtext *expected,
+                /*!< a pointer to the DXF \c MTEXT entity written. */
+        DxfMtext *actual
+                /*!< a pointer to the DXF \c MTEXT entity read back. */
+)
+{
+        const char *expected_chunk;
+        const char *actual_chunk;
+        size_t expected_length;
+        size_t actual_length;
+        int i;
+
+        if (dxf_mtext_get_number_of_text_chunks (actual)
+          != dxf_mtext_get_number_of_text_chunks (expected))
+        {
+                fprintf (stderr, "Error: expected %d text chunks, got %d.\n",
+                  dxf_mtext_get_number_of_text_chunks (expected),
+                  dxf_mtext_get_number_of_text_chunks (actual));
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < dxf_mtext_get_number_of_text_chunks (expected); i++)
+        {
+                expected_chunk = dxf_mtext_get_text_chunk (expected, i, &expected_length);
+                actual_chunk = dxf_mtext_get_text_chunk (actual, i, &actual_length);
+                if ((actual_chunk == NULL)
+                  || (actual_length != expected_length)
+                  || (memcmp (actual_chunk, expected_chunk, expected_length) != 0))
+                {
+                        fprintf (stderr, "Error: text chunk %d differs.\n", i);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (strcmp (dxf_mtext_get_text (actual), dxf_mtext_get_text (expected)) != 0)
+        {
+                fprintf (stderr, "Error: the concatenated text differs.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform a write and read round-trip of the text chunks of a
+ * DXF \c MTEXT entity.
+ *
+ * A text longer than \c DXF_MTEXT_CHUNK_LENGTH is split into group 3
+ * chunks and a final group 1 chunk by dxf_mtext_set_text_value (), the
+ * chunks have to survive writing the entity and lazily reading it back.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_mtext (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_mtext.dxf";
+        char text[2 * DXF_MTEXT_CHUNK_LENGTH + 11];
+        DxfFile fp;
+        DxfMtext *mtext;
+        DxfMtext *result;
+        DxfEntities *entities;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
+        int i;
+
+        /* Three chunks: two full group 3 chunks and a short group 1
+         * chunk. */
+        for (i = 0; i < (int) sizeof (text) - 1; i++)
+        {
+                text[i] = 'a' + (i % 26);
+        }
+        text[sizeof (text) - 1] = '\0';
+        mtext = dxf_mtext_init (dxf_mtext_new ());
+        if (mtext == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        mtext->common.id_code = 0x2A;
+        dxf_mtext_set_text_value (mtext, text);
+        if (dxf_mtext_get_number_of_text_chunks (mtext) != 3)
+        {
+                fprintf (stderr, "Error: expected 3 text chunks, got %d.\n",
+                  dxf_mtext_get_number_of_text_chunks (mtext));
+                dxf_mtext_free (mtext);
+                return (EXIT_FAILURE);
+        }
+        /* Write the entity. */
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.filename = (char *) filename;
+        fp.acad_version_number = AutoCAD_2000;
+        fp.fp = fopen (filename, "w");
+        if (fp.fp == NULL)
+        {
+                fprintf (stderr, "Error: could not open file: %s for writing.\n",
+                  filename);
+                dxf_mtext_free (mtext);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp.fp, "  0\nSECTION\n  2\nENTITIES\n");
+        dxf_mtext_write (&fp, mtext);
+        fprintf (fp.fp, "  0\nENDSEC\n  0\nEOF\n");
+        fclose (fp.fp);
+        /* Read the entity back. */
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                dxf_mtext_free (mtext);
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+          && (dxf_entities_get_number_of_lazy_items (entities) == 1))
+        {
+                result = dxf_entities_materialize (entities, 0, &type);
+                if ((result != NULL) && (type == MTEXT))
+                {
+                        status = test_mtext_compare_chunks (mtext, result);
+                }
+        }
+        else
+        {
+                fprintf (stderr, "Error: could not scan file: %s.\n", filename);
+        }
+        dxf_entities_free (entities);
+        dxf_mtext_free (mtext);
+        remove (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,247 @@
+/*!
+ * \file test_nearest.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the nearest entity search.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_NEAREST_LINES 400
+#define TEST_NEAREST_POINTS 400
+#define TEST_NEAREST_LWPOLYLINES 100
+#define TEST_NEAREST_ENTITIES (TEST_NEAREST_LINES + TEST_NEAREST_POINTS + TEST_NEAREST_LWPOLYLINES)
+#define TEST_NEAREST_QUERIES 50
+#define TEST_NEAREST_K 10
+
+
+/*!
+ * \brief Get the next pseudo random number in [0, 1000).
+ */
+static double
+test_nearest_random
+(
+        unsigned long *seed
+                /*!< the state of the generator. */
+)
+{
+        *seed = (*seed * 1103515245 + 12345) & 0x7fffffff;
+        return (1000.0 * (double) (*seed >> 8) / (double) (1 << 23));
+}
+
+
+/*!
+ * \brief Compare two distances for qsort ().
+ */
+static int
+test_nearest_compare_distances
+(
+        const void *a,
+        const void *b
+)
+{
+        double d = *(const double *) a - *(const double *) b;
+
+        return ((d < 0.0) ? -1 : (d > 0.0) ? 1 : 0);
+}
+
+
+/*!
+ * \brief Create pseudo random \c LINE, \c POINT and \c LWPOLYLINE
+ * entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_nearest_create_entities
+(
+        DxfEntities *entities,
+                /*!< the \c ENTITIES section to append to. */
+        unsigned long *seed
+                /*!< the state of the generator. */
+)
+{
+        static double x0[TEST_NEAREST_LINES];
+        static double y0[TEST_NEAREST_LINES];
+        static double x1[TEST_NEAREST_LINES];
+        static double y1[TEST_NEAREST_LINES];
+        static double x[4 * TEST_NEAREST_LWPOLYLINES];
+        static double y[4 * TEST_NEAREST_LWPOLYLINES];
+        int number_vertices[TEST_NEAREST_LWPOLYLINES];
+        int i;
+
+        for (i = 0; i < TEST_NEAREST_LINES; i++)
+        {
+                x0[i] = test_nearest_random (seed);
+                y0[i] = test_nearest_random (seed);
+                x1[i] = x0[i] + 0.05 * (test_nearest_random (seed) - 500.0);
+                y1[i] = y0[i] + 0.05 * (test_nearest_random (seed) - 500.0);
+        }
+        if (dxf_entities_create_lines (entities, TEST_NEAREST_LINES, NULL, NULL,
+          x0, y0, NULL, x1, y1, NULL) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Reuse the arrays of the lines for the points. */
+        for (i = 0; i < TEST_NEAREST_POINTS; i++)
+        {
+                x0[i] = test_nearest_random (seed);
+                y0[i] = test_nearest_random (seed);
+        }
+        if (dxf_entities_create_points (entities, TEST_NEAREST_POINTS, NULL, NULL,
+          x0, y0, NULL) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < 4 * TEST_NEAREST_LWPOLYLINES; i++)
+        {
+                x[i] = ((i % 4) == 0) ? test_nearest_random (seed)
+                  : x[i - 1] + 0.02 * (test_nearest_random (seed) - 500.0);
+                y[i] = ((i % 4) == 0) ? test_nearest_random (seed)
+                  : y[i - 1] + 0.02 * (test_nearest_random (seed) - 500.0);
+        }
+        for (i = 0; i < TEST_NEAREST_LWPOLYLINES; i++)
+        {
+                number_vertices[i] = 4;
+        }
+        return (dxf_entities_create_lwpolylines (entities, TEST_NEAREST_LWPOLYLINES,
+          NULL, NULL, number_vertices, x, y));
+}
+
+
+/*!
+ * \brief Perform test functions for the nearest entity search.
+ *
+ * The \c k nearest entities to pseudo random points are compared with
+ * the sorted distances to all entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_nearest (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static double distances[TEST_NEAREST_ENTITIES];
+        DxfNearest nearest[TEST_NEAREST_K];
+        DxfEntities *entities;
+        DxfRtree *rtree;
+        DxfEntityType type;
+        void *entity;
+        unsigned long seed = 2019;
+        double x;
+        double y;
+        int number_found;
+        int status = EXIT_SUCCESS;
+        int i;
+        int j;
+
+        entities = dxf_entities_new ();
+        rtree = dxf_rtree_init (dxf_rtree_new ());
+        if ((entities == NULL)
+          || (rtree == NULL)
+          || (test_nearest_create_entities (entities, &seed) == EXIT_FAILURE)
+          || (dxf_entities_get_number_of_entities (entities) != TEST_NEAREST_ENTITIES)
+          || (dxf_bounds_build_rtree (rtree, entities, 2) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not create the entities.\n");
+                status = EXIT_FAILURE;
+        }
+        for (i = 0; (i < TEST_NEAREST_QUERIES) && (status == EXIT_SUCCESS); i++)
+        {
+                x = test_nearest_random (&seed);
+                y = test_nearest_random (&seed);
+                /* Brute force. */
+                for (j = 0; (j < TEST_NEAREST_ENTITIES) && (status == EXIT_SUCCESS); j++)
+                {
+                        entity = dxf_entities_get_entity (entities, j, &type);
+                        status = dxf_nearest_get_distance (type, entity, x, y, &distances[j]);
+                }
+                if (status == EXIT_FAILURE)
+                {
+                        fprintf (stderr, "Error: could not get a distance.\n");
+                        break;
+                }
+                qsort (distances, TEST_NEAREST_ENTITIES, sizeof (double),
+                  test_nearest_compare_distances);
+                number_found = dxf_nearest_search (rtree, entities, x, y,
+                  TEST_NEAREST_K, -1.0, nearest);
+                if (number_found != TEST_NEAREST_K)
+                {
+                        fprintf (stderr, "Error: expected %d entities, found %d.\n",
+                          TEST_NEAREST_K, number_found);
+                        status = EXIT_FAILURE;
+                        break;
+                }
+                for (j = 0; j < TEST_NEAREST_K; j++)
+                {
+                        if ((fabs (nearest[j].distance - distances[j]) > 1e-9)
+                          || (nearest[j].entity != dxf_entities_get_entity
+                          (entities, nearest[j].position, NULL)))
+                        {
+                                fprintf (stderr, "Error: wrong entity %d nearest to (%f, %f).\n",
+                                  j, x, y);
+                                status = EXIT_FAILURE;
+                                break;
+                        }
+                }
+                /* Only the entities within the maximum distance. */
+                if (status == EXIT_SUCCESS)
+                {
+                        number_found = dxf_nearest_search (rtree, entities, x, y,
+                          TEST_NEAREST_K, distances[3], nearest);
+                        for (j = 4; (j < TEST_NEAREST_K) && (distances[j] <= distances[3]); j++);
+                        if (number_found != j)
+                        {
+                                fprintf (stderr, "Error: expected %d entities within %f, found %d.\n",
+                                  j, distances[3], number_found);
+                                status = EXIT_FAILURE;
+                        }
+                }
+        }
+        dxf_rtree_free (rtree);
+        dxf_entities_free (entities);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -34,50 +34,96 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include "includes.h"
 
 
 /*!
  * \brief Perform test functions for a DXF \c POINT entity.
  *
+ * A point is written to a file and read back.
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
 int
-test_point (int argc, char** argv)
+test_point (void)
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *filename;
-        char temp_string[255];
-        FILE *fp;
+        const char *filename = "dxf_point_test.dxf";
+        DxfFile fp;
         DxfPoint *dxf_point_test_1;
         DxfPoint *dxf_point_test_2;
+        DxfEntities *entities;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
 
-        dxf_point_test_1 = dxf_point_new ();
-        dxf_point_init (dxf_point_test_1);
-        dxf_point_test_2 = dxf_point_new ();
-        dxf_point_init (dxf_point_test_2);
-        filename = strdup ("dxf_point_test.dxf");
-        fp = fopen (filename, "rw");
-        if (!fp)
+        dxf_point_test_1 = dxf_point_init (dxf_point_new ());
+        if (dxf_point_test_1 == NULL)
         {
-                fprintf (stderr, "Error: could not open file: %s in read+write mode (NULL pointer).\n",
-                        filename);
-                exit (EXIT_FAILURE);
+                return (EXIT_FAILURE);
         }
-        dxf_point_test_1->id_code = 1;
-        dxf_point_test_1->layer = strdup ("0");
+        dxf_point_test_1->common.id_code = 1;
+        free (dxf_point_test_1->common.layer);
+        dxf_point_test_1->common.layer = strdup ("0");
         dxf_point_test_1->x0 = 10.0;
         dxf_point_test_1->y0 = 20.0;
         dxf_point_test_1->z0 = 30.0;
-
-        fclose (fp);
+        /* Write the entity. */
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.filename = (char *) filename;
+        fp.acad_version_number = AutoCAD_2000;
+        fp.fp = fopen (filename, "w");
+        if (fp.fp == NULL)
+        {
+                fprintf (stderr, "Error: could not open file: %s for writing.\n",
+                  filename);
+                dxf_point_free (dxf_point_test_1);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp.fp, "  0\nSECTION\n  2\nENTITIES\n");
+        dxf_point_write (&fp, dxf_point_test_1);
+        fprintf (fp.fp, "  0\nENDSEC\n  0\nEOF\n");
+        fclose (fp.fp);
+        /* Read the entity back. */
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                dxf_point_free (dxf_point_test_1);
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+          && (dxf_entities_get_number_of_lazy_items (entities) == 1))
+        {
+                dxf_point_test_2 = dxf_entities_materialize (entities, 0, &type);
+                if ((dxf_point_test_2 == NULL)
+                  || (type != POINT)
+                  || (dxf_point_test_2->common.id_code != dxf_point_test_1->common.id_code)
+                  || (strcmp (dxf_point_test_2->common.layer, "0") != 0)
+                  || (dxf_point_test_2->x0 != dxf_point_test_1->x0)
+                  || (dxf_point_test_2->y0 != dxf_point_test_1->y0)
+                  || (dxf_point_test_2->z0 != dxf_point_test_1->z0))
+                {
+                        fprintf (stderr, "Error: the point was not read back as written.\n");
+                }
+                else
+                {
+                        status = EXIT_SUCCESS;
+                }
+        }
+        else
+        {
+                fprintf (stderr, "Error: could not scan file: %s.\n", filename);
+        }
+        dxf_entities_free (entities);
+        dxf_point_free (dxf_point_test_1);
+        remove (filename);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (status);
 }
 
 
@@ -0,0 +1,225 @@
+/*!
+ * \file test_reference_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for the index of the references between the items of a drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Make a list of \c GROUP objects.
+ *
+ * Groups 30 and 31 contain entity 10, group 32 contains entity 11.
+ *
+ * \return a pointer to the first group, or \c NULL when an error
+ * occurred.
+ */
+static DxfGroup *
+test_reference_index_new_groups (void)
+{
+        const DxfHandle group_handles[3] = {0x30, 0x31, 0x32};
+        const DxfHandle entity_handles[3] = {0x10, 0x10, 0x11};
+        DxfGroup *first = NULL;
+        DxfGroup *last = NULL;
+        DxfGroup *group;
+        int i;
+
+        for (i = 0; i < 3; i++)
+        {
+                group = dxf_group_init (dxf_group_new ());
+                if (group == NULL)
+                {
+                        if (first != NULL)
+                        {
+                                dxf_group_free_list (first);
+                        }
+                        return (NULL);
+                }
+                group->id_code = group_handles[i];
+                group->handle_entity_in_group = entity_handles[i];
+                if (last == NULL)
+                {
+                        first = group;
+                }
+                else
+                {
+                        last->next = (struct DxfGroup *) group;
+                }
+                last = group;
+        }
+        return (first);
+}
+
+
+/*!
+ * \brief Check the group membership of entity 10 and 11.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_reference_index_check_groups
+(
+        DxfReferenceIndex *index
+                /*!< a pointer to the reference index. */
+)
+{
+        DxfHandle sources[4];
+
+        if ((dxf_reference_index_get_degree (index, 0x10) != 3)
+          || (dxf_reference_index_get_degree (index, 0x11) != 1)
+          || (dxf_reference_index_get_degree (index, 0x12) != 0))
+        {
+                fprintf (stderr, "Error: wrong reference degrees.\n");
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_reference_index_get_referrers (index, 0x10, DXF_REFERENCE_GROUP, sources, 4) != 2)
+          || (!(((sources[0] == 0x30) && (sources[1] == 0x31))
+          || ((sources[0] == 0x31) && (sources[1] == 0x30)))))
+        {
+                fprintf (stderr, "Error: wrong groups of entity 10.\n");
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_reference_index_get_referrers (index, 0x10, -1, sources, 1) != 3)
+          || (!dxf_reference_index_is_referenced (index, 0x11, DXF_REFERENCE_GROUP))
+          || (dxf_reference_index_is_referenced (index, 0x11, DXF_REFERENCE_REACTOR)))
+        {
+                fprintf (stderr, "Error: wrong kinds of references.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Check the reference degrees after removing references and
+ * handles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_reference_index_check_removal
+(
+        DxfReferenceIndex *index
+                /*!< a pointer to the reference index. */
+)
+{
+        int number_of_references;
+
+        if ((dxf_reference_index_remove (index, 0x30, 0x10) == EXIT_FAILURE)
+          || (dxf_reference_index_get_degree (index, 0x10) != 2)
+          || (!dxf_reference_index_is_referenced (index, 0x10, DXF_REFERENCE_GROUP)))
+        {
+                fprintf (stderr, "Error: wrong degree after removing a group member.\n");
+                return (EXIT_FAILURE);
+        }
+        /* Deleting group 31 removes its member, entity 10 is left with
+         * the reference from its dictionary. */
+        if ((dxf_reference_index_remove_handle (index, 0x31) == EXIT_FAILURE)
+          || (dxf_reference_index_get_degree (index, 0x10) != 1)
+          || (dxf_reference_index_is_referenced (index, 0x10, DXF_REFERENCE_GROUP))
+          || (dxf_reference_index_get_degree (index, 0x40) != 1))
+        {
+                fprintf (stderr, "Error: wrong degree after deleting a group.\n");
+                return (EXIT_FAILURE);
+        }
+        /* Deleting entity 10 removes its references to other items. */
+        if ((dxf_reference_index_remove_handle (index, 0x10) == EXIT_FAILURE)
+          || (dxf_reference_index_get_degree (index, 0x10) != 0)
+          || (dxf_reference_index_get_degree (index, 0x40) != 0)
+          || (dxf_reference_index_get_degree (index, 0x11) != 1))
+        {
+                fprintf (stderr, "Error: wrong degree after deleting an entity.\n");
+                return (EXIT_FAILURE);
+        }
+        /* Removed references are reused. */
+        number_of_references = index->number_of_references;
+        if ((dxf_reference_index_add (index, 0x33, 0x11, DXF_REFERENCE_GROUP, 340) == EXIT_FAILURE)
+          || (dxf_reference_index_get_degree (index, 0x11) != 2)
+          || (index->number_of_references != number_of_references))
+        {
+                fprintf (stderr, "Error: a removed reference was not reused.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the index of the references
+ * between the items of a drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_reference_index (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfReferenceIndex *index;
+        DxfGroup *groups;
+        int status = EXIT_FAILURE;
+
+        index = dxf_reference_index_init (dxf_reference_index_new ());
+        groups = test_reference_index_new_groups ();
+        if ((index == NULL) || (groups == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Entity 10 is an entry of dictionary 40, which owns it. */
+        if ((dxf_reference_index_add_groups (index, groups) == EXIT_FAILURE)
+          || (dxf_reference_index_add (index, 0x40, 0x10, DXF_REFERENCE_DICTIONARY, 350) == EXIT_FAILURE)
+          || (dxf_reference_index_add (index, 0x10, 0x40, DXF_REFERENCE_OWNER, 330) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "Error: could not add the references.\n");
+        }
+        else if ((test_reference_index_check_groups (index) == EXIT_SUCCESS)
+          && (test_reference_index_check_removal (index) == EXIT_SUCCESS))
+        {
+                status = EXIT_SUCCESS;
+        }
+        dxf_group_free_list (groups);
+        dxf_reference_index_free (index);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,254 @@
+/*!
+ * \file test_rtree.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the R-tree of bounding boxes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_RTREE_BOXES 3000
+#define TEST_RTREE_QUERIES 100
+
+
+/*!
+ * \brief Get the next pseudo random number in [0, 1).
+ */
+static double
+test_rtree_random
+(
+        unsigned long *seed
+                /*!< the state of the generator. */
+)
+{
+        *seed = (*seed * 1103515245 + 12345) & 0x7fffffff;
+        return ((double) (*seed >> 8) / (double) (1 << 23));
+}
+
+
+/*!
+ * \brief Get a pseudo random box with its lower corner in [0, 1000)
+ * and a size in [0, \c size).
+ */
+static void
+test_rtree_random_box
+(
+        unsigned long *seed,
+                /*!< the state of the generator. */
+        double size,
+                /*!< the maximum size of the box. */
+        DxfBoundingBox *box
+                /*!< receives the box. */
+)
+{
+        box->min_x = 1000.0 * test_rtree_random (seed);
+        box->min_y = 1000.0 * test_rtree_random (seed);
+        box->min_z = 1000.0 * test_rtree_random (seed);
+        box->max_x = box->min_x + size * test_rtree_random (seed);
+        box->max_y = box->min_y + size * test_rtree_random (seed);
+        box->max_z = box->min_z + size * test_rtree_random (seed);
+}
+
+
+/*!
+ * \brief Compare two integers for qsort ().
+ */
+static int
+test_rtree_compare_items
+(
+        const void *a,
+        const void *b
+)
+{
+        return (*(const int *) a - *(const int *) b);
+}
+
+
+/*!
+ * \brief Search the R-tree and compare the found items with a brute
+ * force search.
+ *
+ * \return \c EXIT_SUCCESS when the same items are found, or
+ * \c EXIT_FAILURE when they differ.
+ */
+static int
+test_rtree_query
+(
+        DxfRtree *rtree,
+                /*!< a pointer to the R-tree. */
+        const DxfBoundingBox *boxes,
+                /*!< the boxes the tree was built from. */
+        const DxfBoundingBox *region,
+                /*!< the query region. */
+        DxfRtreeQuery query,
+                /*!< the type of query. */
+        int dimensions
+                /*!< 2 to ignore the Z-values, or 3. */
+)
+{
+        static int items[TEST_RTREE_BOXES];
+        static int expected[TEST_RTREE_BOXES];
+        const DxfBoundingBox *box;
+        int number_of_items;
+        int number_expected = 0;
+        int inside;
+        int i;
+
+        for (i = 0; i < TEST_RTREE_BOXES; i++)
+        {
+                box = &boxes[i];
+                if (query == DXF_RTREE_WINDOW)
+                {
+                        inside = (box->min_x >= region->min_x)
+                          && (box->max_x <= region->max_x)
+                          && (box->min_y >= region->min_y)
+                          && (box->max_y <= region->max_y)
+                          && ((dimensions == 2)
+                          || ((box->min_z >= region->min_z)
+                          && (box->max_z <= region->max_z)));
+                }
+                else
+                {
+                        inside = (box->min_x <= region->max_x)
+                          && (box->max_x >= region->min_x)
+                          && (box->min_y <= region->max_y)
+                          && (box->max_y >= region->min_y)
+                          && ((dimensions == 2)
+                          || ((box->min_z <= region->max_z)
+                          && (box->max_z >= region->min_z)));
+                }
+                if (inside)
+                {
+                        expected[number_expected++] = i;
+                }
+        }
+        number_of_items = dxf_rtree_search (rtree, region, query, items, TEST_RTREE_BOXES);
+        if (number_of_items != number_expected)
+        {
+                fprintf (stderr, "Error: expected %d items, found %d.\n",
+                  number_expected, number_of_items);
+                return (EXIT_FAILURE);
+        }
+        qsort (items, (size_t) number_of_items, sizeof (int), test_rtree_compare_items);
+        if (memcmp (items, expected, (size_t) number_of_items * sizeof (int)) != 0)
+        {
+                fprintf (stderr, "Error: the found items differ.\n");
+                return (EXIT_FAILURE);
+        }
+        /* Only counting the items gives the same number. */
+        if (dxf_rtree_search (rtree, region, query, NULL, 0) != number_expected)
+        {
+                fprintf (stderr, "Error: counting the items gives a different number.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the R-tree of bounding boxes.
+ *
+ * Window and crossing searches of pseudo random regions over pseudo
+ * random boxes are compared with a brute force search, in 2D and 3D.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_rtree (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static DxfBoundingBox boxes[TEST_RTREE_BOXES];
+        DxfBoundingBox region;
+        DxfRtree *rtree;
+        unsigned long seed = 4711;
+        int status = EXIT_SUCCESS;
+        int dimensions;
+        int i;
+
+        for (i = 0; i < TEST_RTREE_BOXES; i++)
+        {
+                test_rtree_random_box (&seed, 20.0, &boxes[i]);
+        }
+        rtree = dxf_rtree_init (dxf_rtree_new ());
+        if (rtree == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (dimensions = 2; (dimensions <= 3) && (status == EXIT_SUCCESS); dimensions++)
+        {
+                if ((dxf_rtree_build (rtree, boxes, TEST_RTREE_BOXES, dimensions) == EXIT_FAILURE)
+                  || (dxf_rtree_get_number_of_items (rtree) != TEST_RTREE_BOXES))
+                {
+                        fprintf (stderr, "Error: could not build a %dD R-tree.\n", dimensions);
+                        status = EXIT_FAILURE;
+                }
+                for (i = 0; (i < TEST_RTREE_QUERIES) && (status == EXIT_SUCCESS); i++)
+                {
+                        test_rtree_random_box (&seed, 400.0, &region);
+                        status = test_rtree_query (rtree, boxes, &region,
+                          DXF_RTREE_WINDOW, dimensions);
+                        if (status == EXIT_SUCCESS)
+                        {
+                                status = test_rtree_query (rtree, boxes, &region,
+                                  DXF_RTREE_CROSSING, dimensions);
+                        }
+                        /* A point with a tolerance is a small crossing
+                         * region. */
+                        if (status == EXIT_SUCCESS)
+                        {
+                                region.max_x = region.min_x + 10.0;
+                                region.max_y = region.min_y + 10.0;
+                                region.max_z = region.min_z + 10.0;
+                                status = (dxf_rtree_search_point (rtree,
+                                  region.min_x + 5.0, region.min_y + 5.0,
+                                  region.min_z + 5.0, 5.0, NULL, 0)
+                                  == dxf_rtree_search (rtree, &region,
+                                  DXF_RTREE_CROSSING, NULL, 0))
+                                  ? EXIT_SUCCESS : EXIT_FAILURE;
+                        }
+                }
+        }
+        dxf_rtree_free (rtree);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
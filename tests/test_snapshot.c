@@ -0,0 +1,263 @@
+/*!
+ * \file test_snapshot.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tests for copy-on-write snapshots of a DXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Write the entities of a snapshot to \c filename.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_snapshot_write_file
+(
+        const char *filename,
+                /*!< the name of the file to write. */
+        DxfSnapshot *snapshot
+                /*!< a pointer to the snapshot to write. */
+)
+{
+        DxfFile fp;
+        int status;
+
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.filename = (char *) filename;
+        fp.acad_version_number = AutoCAD_2000;
+        fp.fp = fopen (filename, "w");
+        if (fp.fp == NULL)
+        {
+                fprintf (stderr, "Error: could not open file: %s for writing.\n",
+                  filename);
+                return (EXIT_FAILURE);
+        }
+        status = dxf_snapshot_write_entities (&fp, snapshot);
+        fprintf (fp.fp, "  0\nEOF\n");
+        fclose (fp.fp);
+        return (status);
+}
+
+
+/*!
+ * \brief Append a polyline with two vertices and an insert with an
+ * attribute to \c entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_snapshot_append_entities
+(
+        DxfEntities *entities
+                /*!< a pointer to the entities to append to. */
+)
+{
+        DxfPolyline *polyline;
+        DxfVertex *vertex_1;
+        DxfVertex *vertex_2;
+        DxfInsert *insert;
+        DxfAttrib *attrib;
+
+        /* A new polyline comes with its first vertex. */
+        polyline = dxf_polyline_init (dxf_polyline_new ());
+        vertex_1 = (polyline != NULL) ? polyline->vertices : NULL;
+        vertex_2 = dxf_vertex_init (dxf_vertex_new ());
+        insert = dxf_insert_init (dxf_insert_new ());
+        attrib = dxf_attrib_init (dxf_attrib_new ());
+        if ((polyline == NULL)
+          || (vertex_1 == NULL)
+          || (vertex_2 == NULL)
+          || (insert == NULL)
+          || (attrib == NULL))
+        {
+                if (polyline != NULL)
+                {
+                        dxf_polyline_free (polyline);
+                }
+                if (vertex_2 != NULL)
+                {
+                        dxf_vertex_free (vertex_2);
+                }
+                if (insert != NULL)
+                {
+                        dxf_insert_free (insert);
+                }
+                if (attrib != NULL)
+                {
+                        dxf_attrib_free (attrib);
+                }
+                return (EXIT_FAILURE);
+        }
+        polyline->common.id_code = 0x10;
+        vertex_1->common.id_code = 0x11;
+        vertex_1->p0->x0 = 1.0;
+        vertex_1->p0->y0 = 2.0;
+        vertex_2->common.id_code = 0x12;
+        vertex_2->p0->x0 = 3.0;
+        vertex_2->p0->y0 = 4.0;
+        vertex_1->next = (struct DxfVertex *) vertex_2;
+        insert->common.id_code = 0x20;
+        /* The setters do not free the previous values. */
+        free (insert->block_name);
+        dxf_insert_set_block_name (insert, "DOOR");
+        attrib->common.id_code = 0x21;
+        free (attrib->default_value);
+        dxf_attrib_set_default_value (attrib, "D1");
+        free (attrib->tag_value);
+        dxf_attrib_set_tag_value (attrib, "TAG");
+        dxf_insert_set_attributes (insert, attrib);
+        dxf_entities_append (entities, POLYLINE, polyline);
+        dxf_entities_append (entities, INSERT, insert);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test copy-on-write snapshots of a drawing.
+ *
+ * A polyline with its vertices and an insert with its attributes are
+ * modified through a snapshot, the drawing must keep the original
+ * entities and the written snapshot must read back with the
+ * modifications.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_snapshot (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_snapshot.dxf";
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        DxfEntities *result = NULL;
+        DxfSnapshot *snapshot = NULL;
+        DxfPolyline *polyline;
+        DxfPolyline *polyline_copy;
+        DxfInsert *insert;
+        DxfInsert *insert_copy;
+        DxfEntityType type;
+        int status = EXIT_FAILURE;
+
+        drawing = dxf_drawing_new ();
+        entities = dxf_entities_init (dxf_entities_new ());
+        if ((drawing == NULL) || (entities == NULL))
+        {
+                free (drawing);
+                free (entities);
+                return (EXIT_FAILURE);
+        }
+        drawing->entities_list = (struct DxfEntities *) entities;
+        if (test_snapshot_append_entities (entities) == EXIT_FAILURE)
+        {
+                fprintf (stderr, "Error: could not append the entities.\n");
+        }
+        else if (((snapshot = dxf_snapshot_init (dxf_snapshot_new (), drawing)) == NULL)
+          || ((polyline_copy = dxf_snapshot_get_entity_for_write (snapshot, 0, &type)) == NULL)
+          || (type != POLYLINE)
+          || ((insert_copy = dxf_snapshot_get_entity_for_write (snapshot, 1, &type)) == NULL)
+          || (type != INSERT))
+        {
+                fprintf (stderr, "Error: could not copy the entities.\n");
+        }
+        else if (((polyline = dxf_entities_get_entity (entities, 0, NULL)) == polyline_copy)
+          || (polyline_copy->vertices == NULL)
+          || (polyline_copy->vertices == polyline->vertices)
+          || (polyline_copy->vertices->p0 == polyline->vertices->p0)
+          || (polyline_copy->vertices->next == NULL)
+          || ((insert = dxf_entities_get_entity (entities, 1, NULL)) == insert_copy)
+          || (insert_copy->attributes == NULL)
+          || (insert_copy->attributes == insert->attributes)
+          || (insert_copy->attributes->default_value == insert->attributes->default_value))
+        {
+                fprintf (stderr, "Error: a copy shares memory with the drawing.\n");
+        }
+        else
+        {
+                polyline_copy->vertices->p0->x0 = 5.0;
+                free (insert_copy->attributes->default_value);
+                dxf_attrib_set_default_value (insert_copy->attributes, "D2");
+                if ((polyline->vertices->p0->x0 != 1.0)
+                  || (strcmp (insert->attributes->default_value, "D1") != 0)
+                  || (dxf_snapshot_get_number_of_copies (snapshot) != 2))
+                {
+                        fprintf (stderr, "Error: the drawing was modified through a snapshot.\n");
+                }
+                else if ((test_snapshot_write_file (filename, snapshot) == EXIT_FAILURE)
+                  || ((result = dxf_entities_new ()) == NULL)
+                  || (dxf_entities_scan_file (filename, result) == EXIT_FAILURE)
+                  || ((polyline = dxf_entities_materialize (result, 0, &type)) == NULL)
+                  || (type != POLYLINE))
+                {
+                        fprintf (stderr, "Error: could not read back file: %s.\n",
+                          filename);
+                }
+                else if ((polyline->vertices == NULL)
+                  || (polyline->vertices->p0->x0 != 5.0)
+                  || (polyline->vertices->next == NULL)
+                  || (((DxfVertex *) polyline->vertices->next)->p0->y0 != 4.0))
+                {
+                        fprintf (stderr, "Error: wrong entities read back from a snapshot.\n");
+                }
+                else
+                {
+                        status = EXIT_SUCCESS;
+                }
+        }
+        if (snapshot != NULL)
+        {
+                dxf_snapshot_free (snapshot);
+        }
+        if (result != NULL)
+        {
+                dxf_entities_free (result);
+        }
+        dxf_entities_free (entities);
+        drawing->entities_list = NULL;
+        dxf_drawing_free (drawing);
+        remove (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
@@ -0,0 +1,190 @@
+/*!
+ * \file test_table.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the common data of a DXF \c TABLE entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Check the data of a DXF \c TABLE entity read from a file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_table_check
+(
+        DxfTable *table
+                /*!< a pointer to a DXF \c TABLE entity. */
+)
+{
+        const unsigned char expected[5] = {0x01, 0x02, 0xA0, 0xFF, 0x10};
+        DxfBinaryBuffer *buffer;
+
+        buffer = table->common.cold->binary_graphics_data;
+        if ((dxf_entity_get_common (TABLE, table) != &table->common)
+          || (dxf_entities_get_id_code (TABLE, table) != 0x2F)
+          || (dxf_entities_get_layer (TABLE, table) == NULL)
+          || (strcmp (dxf_entities_get_layer (TABLE, table), "TABLES") != 0)
+          || (table->common.cold->dictionary_owner_soft != 0x1F)
+          || (table->number_of_columns != 3)
+          || (strcmp (table->block_name, "*T1") != 0))
+        {
+                fprintf (stderr, "Error: wrong common data of the TABLE entity.\n");
+                return (EXIT_FAILURE);
+        }
+        if ((buffer == NULL)
+          || (dxf_binary_buffer_get_length (buffer) != sizeof (expected))
+          || (memcmp (dxf_binary_buffer_get_data (buffer), expected, sizeof (expected)) != 0))
+        {
+                fprintf (stderr, "Error: wrong graphics data of the TABLE entity.\n");
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the first entity of a DXF file with the lazy reader,
+ * check it as a \c TABLE entity and optionally write it to another
+ * file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_table_read
+(
+        const char *filename,
+                /*!< name of the file to read. */
+        const char *output
+                /*!< name of the file to write, or \c NULL. */
+)
+{
+        DxfEntities *entities;
+        DxfTable *table;
+        DxfEntityType type;
+        DxfFile fp;
+        int status = EXIT_FAILURE;
+
+        entities = dxf_entities_new ();
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entities_scan_file (filename, entities) == EXIT_SUCCESS)
+          && (dxf_entities_get_number_of_lazy_items (entities) == 1))
+        {
+                table = dxf_entities_materialize (entities, 0, &type);
+                if ((table != NULL) && (type == TABLE))
+                {
+                        status = test_table_check (table);
+                }
+                if ((status == EXIT_SUCCESS) && (output != NULL))
+                {
+                        memset (&fp, 0, sizeof (DxfFile));
+                        fp.filename = (char *) output;
+                        fp.acad_version_number = AutoCAD_2000;
+                        fp.fp = fopen (output, "w");
+                        if (fp.fp == NULL)
+                        {
+                                status = EXIT_FAILURE;
+                        }
+                        else
+                        {
+                                fprintf (fp.fp, "  0\nSECTION\n  2\nENTITIES\n");
+                                status = dxf_table_write (&fp, table);
+                                fprintf (fp.fp, "  0\nENDSEC\n  0\nEOF\n");
+                                fclose (fp.fp);
+                        }
+                }
+        }
+        else
+        {
+                fprintf (stderr, "Error: could not scan file: %s.\n", filename);
+        }
+        dxf_entities_free (entities);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for the common data of a DXF \c TABLE
+ * entity.
+ *
+ * The handle, layer, owner and graphics data (group code 310) are read
+ * into the common data, the table keeps group code 92 as the number of
+ * columns.\n
+ * The entity is written and read back.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_table (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_table.dxf";
+        const char *output = "test_table_out.dxf";
+        int status;
+
+        if (test_write_file (filename,
+          "  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nACAD_TABLE\n  5\n2F\n330\n1F\n100\nAcDbEntity\n  8\nTABLES\n"
+          "310\n0102A0FF\n310\n10\n"
+          "100\nAcDbBlockReference\n  2\n*T1\n 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+          "100\nAcDbTable\n 91\n2\n 92\n3\n"
+          "  0\nENDSEC\n  0\nEOF\n") == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        status = test_table_read (filename, output);
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_table_read (output, NULL);
+        }
+        remove (filename);
+        remove (output);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
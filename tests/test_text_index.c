@@ -0,0 +1,279 @@
+/*!
+ * \file test_text_index.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the trigram text index.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_TEXT_INDEX_STRINGS 2000
+#define TEST_TEXT_INDEX_QUERIES 300
+
+
+/*!
+ * \brief Get the next pseudo random number in [0, \c range).
+ */
+static int
+test_text_index_random
+(
+        unsigned long *seed,
+                /*!< the state of the generator. */
+        int range
+                /*!< the number of possible values. */
+)
+{
+        *seed = (*seed * 1103515245 + 12345) & 0x7fffffff;
+        return ((int) ((*seed >> 8) % (unsigned long) range));
+}
+
+
+/*!
+ * \brief Get a pseudo random string over a small alphabet, so many
+ * strings share trigrams.
+ */
+static void
+test_text_index_random_string
+(
+        unsigned long *seed,
+                /*!< the state of the generator. */
+        int length,
+                /*!< the number of characters. */
+        char *string
+                /*!< receives the string. */
+)
+{
+        const char alphabet[] = "abcABC -";
+        int i;
+
+        for (i = 0; i < length; i++)
+        {
+                string[i] = alphabet[test_text_index_random (seed, sizeof (alphabet) - 1)];
+        }
+        string[length] = '\0';
+}
+
+
+/*!
+ * \brief Test if a string matches a pattern, ignoring case.
+ *
+ * \return \c TRUE when it matches, \c FALSE otherwise.
+ */
+static int
+test_text_index_match
+(
+        const char *string,
+                /*!< the string. */
+        const char *pattern,
+                /*!< the pattern. */
+        DxfTextIndexMatch match
+                /*!< how the pattern is matched. */
+)
+{
+        size_t length = strlen (pattern);
+        size_t i;
+        size_t j;
+
+        for (i = 0; string[i] != '\0' || i == 0; i++)
+        {
+                for (j = 0; j < length; j++)
+                {
+                        if ((string[i + j] == '\0')
+                          || (toupper ((unsigned char) string[i + j])
+                          != toupper ((unsigned char) pattern[j])))
+                        {
+                                break;
+                        }
+                }
+                if ((j == length)
+                  && ((match != DXF_TEXT_INDEX_MATCH_EXACT)
+                  || (string[i + j] == '\0')))
+                {
+                        return (TRUE);
+                }
+                if ((match != DXF_TEXT_INDEX_MATCH_SUBSTRING)
+                  || (string[i] == '\0'))
+                {
+                        break;
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Compare the results of pseudo random queries with a brute
+ * force search.
+ *
+ * \return \c EXIT_SUCCESS when the same entries are found, or
+ * \c EXIT_FAILURE when they differ.
+ */
+static int
+test_text_index_queries
+(
+        DxfTextIndex *index,
+                /*!< a pointer to the text index. */
+        char strings[][24],
+                /*!< the strings added to the index, entry i holds
+                 * strings[i]. */
+        unsigned long seed
+                /*!< the state of the generator. */
+)
+{
+        static int ids[TEST_TEXT_INDEX_STRINGS];
+        char pattern[8];
+        DxfTextIndexMatch match;
+        int number_found;
+        int number_expected;
+        int i;
+        int j;
+
+        for (i = 0; i < TEST_TEXT_INDEX_QUERIES; i++)
+        {
+                test_text_index_random_string (&seed,
+                  test_text_index_random (&seed, 6), pattern);
+                match = (DxfTextIndexMatch) test_text_index_random (&seed, 3);
+                number_found = dxf_text_index_find (index, pattern, match,
+                  ids, TEST_TEXT_INDEX_STRINGS);
+                number_expected = 0;
+                for (j = 0; j < TEST_TEXT_INDEX_STRINGS; j++)
+                {
+                        if (test_text_index_match (strings[j], pattern, match))
+                        {
+                                if ((number_expected >= number_found)
+                                  || (ids[number_expected] != j))
+                                {
+                                        fprintf (stderr, "Error: string %d does not match \"%s\".\n",
+                                          j, pattern);
+                                        return (EXIT_FAILURE);
+                                }
+                                number_expected++;
+                        }
+                }
+                if (number_found != number_expected)
+                {
+                        fprintf (stderr, "Error: expected %d strings matching \"%s\", found %d.\n",
+                          number_expected, pattern, number_found);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Perform test functions for the trigram text index.
+ *
+ * Substring, prefix and exact queries are compared with a case
+ * insensitive brute force search, before and after writing the index
+ * to a file and reading it back.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_text_index (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        static char strings[TEST_TEXT_INDEX_STRINGS][24];
+        const char *filename = "test_text_index.dxi";
+        DxfTextIndex *index;
+        DxfTextIndex *index_read;
+        DxfTextIndexEntry *entry;
+        unsigned long seed = 1998;
+        int status = EXIT_SUCCESS;
+        int i;
+
+        index = dxf_text_index_init (dxf_text_index_new ());
+        index_read = dxf_text_index_init (dxf_text_index_new ());
+        if ((index == NULL) || (index_read == NULL))
+        {
+                status = EXIT_FAILURE;
+        }
+        for (i = 0; (i < TEST_TEXT_INDEX_STRINGS) && (status == EXIT_SUCCESS); i++)
+        {
+                /* Empty strings are not added. */
+                test_text_index_random_string (&seed,
+                  1 + test_text_index_random (&seed, 20), strings[i]);
+                status = dxf_text_index_add (index, (DxfHandle) (0x100 + i),
+                  TEXT, DXF_TEXT_INDEX_FIELD_VALUE, strings[i]);
+        }
+        if ((status == EXIT_SUCCESS)
+          && (dxf_text_index_get_number_of_entries (index) != TEST_TEXT_INDEX_STRINGS))
+        {
+                status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                entry = dxf_text_index_get_entry (index, 42);
+                if ((entry == NULL)
+                  || (entry->handle != 0x100 + 42)
+                  || (entry->type != TEXT)
+                  || (strcmp (entry->string, strings[42]) != 0))
+                {
+                        fprintf (stderr, "Error: wrong entry 42.\n");
+                        status = EXIT_FAILURE;
+                }
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_text_index_queries (index, strings, seed);
+        }
+        /* The same results after a round trip through a file. */
+        if (status == EXIT_SUCCESS)
+        {
+                status = dxf_text_index_write_file (filename, index);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = dxf_text_index_read_file (filename, index_read);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_text_index_queries (index_read, strings, seed);
+        }
+        remove (filename);
+        dxf_text_index_free (index_read);
+        dxf_text_index_free (index);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
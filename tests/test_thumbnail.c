@@ -0,0 +1,290 @@
+/*!
+ * \file test_thumbnail.c
+ *
+ * \author Copyright (C) 2019
+ * by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for extracting the preview image of a DXF file.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A drawing with a preview image behind an empty header value.
+ *
+ * The empty \c $DIMAPOST value and the \c $DIMBLK value which reads
+ * like a section name have to be skipped as values, not mistaken for
+ * group codes.
+ */
+static const char test_thumbnail_drawing[] =
+  "  0\nSECTION\n  2\nHEADER\n"
+  "  9\n$DIMAPOST\n  1\n\n"
+  "  9\n$DIMBLK\n  1\nTHUMBNAILIMAGE\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n  2\nENTITIES\n  0\nENDSEC\n"
+  "  0\nSECTION\n  2\nTHUMBNAILIMAGE\n"
+  " 90\n6\n"
+  "310\n424D0001\n"
+  "310\nfeFF\n"
+  "  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief The same drawing without a preview image.
+ */
+static const char test_thumbnail_drawing_without_image[] =
+  "  0\nSECTION\n  2\nHEADER\n"
+  "  9\n$DIMAPOST\n  1\n\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n  2\nENTITIES\n  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief A drawing with the preview image before another section and
+ * a number of bytes no file of this size can hold.
+ *
+ * The backward search finds the \c OBJECTS section last, so the
+ * forward scan has to find the preview image.
+ */
+static const char test_thumbnail_drawing_not_last[] =
+  "  0\nSECTION\n  2\nENTITIES\n  0\nENDSEC\n"
+  "  0\nSECTION\n  2\nTHUMBNAILIMAGE\n"
+  " 90\n2000000000\n"
+  "310\n424D0001\n"
+  "310\nfeFF\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n  2\nOBJECTS\n  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Check an extracted preview image.
+ *
+ * The preview image is freed.
+ *
+ * \return \c EXIT_SUCCESS when the image is the expected one, or
+ * \c EXIT_FAILURE when it differs.
+ */
+static int
+test_thumbnail_check
+(
+        DxfBinaryBuffer *image,
+                /*!< the extracted preview image. */
+        const char *source
+                /*!< the source of the image, for the error message. */
+)
+{
+        const unsigned char expected[6] = {0x42, 0x4d, 0x00, 0x01, 0xfe, 0xff};
+        int status = EXIT_SUCCESS;
+
+        if ((image == NULL)
+          || (dxf_binary_buffer_get_length (image) != sizeof (expected))
+          || (memcmp (dxf_binary_buffer_get_data (image), expected, sizeof (expected)) != 0))
+        {
+                fprintf (stderr, "Error: wrong preview image extracted from %s.\n",
+                  source);
+                status = EXIT_FAILURE;
+        }
+        if (image != NULL)
+        {
+                dxf_binary_buffer_free (image);
+        }
+        return (status);
+}
+
+
+/*!
+ * \brief Test extracting a preview image that spans several of the
+ * blocks read by the backward search.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_thumbnail_large
+(
+        const char *filename
+                /*!< the name of the file to write. */
+)
+{
+        const char *header = "  0\nSECTION\n  2\nENTITIES\n  0\nENDSEC\n"
+          "  0\nSECTION\n  2\nTHUMBNAILIMAGE\n 90\n100000\n";
+        const char *footer = "  0\nENDSEC\n  0\nEOF\n";
+        char *drawing;
+        char *p;
+        DxfBinaryBuffer *image;
+        int status = EXIT_FAILURE;
+        int i;
+        int j;
+
+        /* 1000 lines of 100 bytes, each byte is its line number. */
+        drawing = malloc (strlen (header) + 1000 * 205 + strlen (footer) + 1);
+        if (drawing == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        p = drawing + sprintf (drawing, "%s", header);
+        for (i = 0; i < 1000; i++)
+        {
+                p += sprintf (p, "310\n");
+                for (j = 0; j < 100; j++)
+                {
+                        p += sprintf (p, "%02X", i % 256);
+                }
+                p += sprintf (p, "\n");
+        }
+        sprintf (p, "%s", footer);
+        if (test_write_file (filename, drawing) == EXIT_SUCCESS)
+        {
+                image = dxf_thumbnail_extract (filename);
+                if ((image == NULL)
+                  || (dxf_binary_buffer_get_length (image) != 100000)
+                  || (((unsigned char *) dxf_binary_buffer_get_data (image))[0] != 0)
+                  || (((unsigned char *) dxf_binary_buffer_get_data (image))[99999] != 999 % 256))
+                {
+                        fprintf (stderr, "Error: wrong large preview image extracted from %s.\n",
+                          filename);
+                }
+                else
+                {
+                        status = EXIT_SUCCESS;
+                }
+                if (image != NULL)
+                {
+                        dxf_binary_buffer_free (image);
+                }
+        }
+        free (drawing);
+        return (status);
+}
+
+
+/*!
+ * \brief Perform test functions for extracting the preview image of a
+ * DXF file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+test_thumbnail (void)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *filename = "test_thumbnail.dxf";
+        DxfBinaryBuffer *image;
+        int status;
+
+        /* From memory. */
+        status = test_thumbnail_check (dxf_thumbnail_extract_from_memory
+          (test_thumbnail_drawing, strlen (test_thumbnail_drawing)), "memory");
+        if (status == EXIT_SUCCESS)
+        {
+                image = dxf_thumbnail_extract_from_memory
+                  (test_thumbnail_drawing_without_image,
+                  strlen (test_thumbnail_drawing_without_image));
+                if (image != NULL)
+                {
+                        fprintf (stderr, "Error: a preview image was found in a drawing without one.\n");
+                        dxf_binary_buffer_free (image);
+                        status = EXIT_FAILURE;
+                }
+        }
+        /* From a file. */
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_write_file (filename, test_thumbnail_drawing);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_thumbnail_check (dxf_thumbnail_extract (filename), filename);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_write_file (filename, test_thumbnail_drawing_without_image);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                image = dxf_thumbnail_extract (filename);
+                if (image != NULL)
+                {
+                        fprintf (stderr, "Error: a preview image was found in %s.\n",
+                          filename);
+                        dxf_binary_buffer_free (image);
+                        status = EXIT_FAILURE;
+                }
+        }
+        /* Not the last section, with a capped number of bytes. */
+        if (status == EXIT_SUCCESS)
+        {
+                image = dxf_thumbnail_extract_from_memory
+                  (test_thumbnail_drawing_not_last,
+                  strlen (test_thumbnail_drawing_not_last));
+                if ((image != NULL)
+                  && (image->capacity > strlen (test_thumbnail_drawing_not_last)))
+                {
+                        fprintf (stderr, "Error: too much memory reserved for a preview image.\n");
+                        status = EXIT_FAILURE;
+                }
+                if (status == EXIT_SUCCESS)
+                {
+                        status = test_thumbnail_check (image, "memory");
+                }
+                else
+                {
+                        dxf_binary_buffer_free (image);
+                }
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_write_file (filename, test_thumbnail_drawing_not_last);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_thumbnail_check (dxf_thumbnail_extract (filename), filename);
+        }
+        if (status == EXIT_SUCCESS)
+        {
+                status = test_thumbnail_large (filename);
+        }
+        remove (filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (status);
+}
+
+
+/* EOF */
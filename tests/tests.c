@@ -37,16 +37,83 @@
 #include "includes.h"
 
 /*!
- * \brief Reads a dxf file using libdxf form examples dir.
+ * \brief Write \c contents to a (temporary) file for a test.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int test_write_file (const char *filename, const char *contents)
+{
+    FILE *fp;
+    size_t length;
+
+    fp = fopen (filename, "w");
+    if (fp == NULL)
+    {
+        fprintf (stderr, "TESTS: could not open file: %s for writing\n", filename);
+        return (EXIT_FAILURE);
+    }
+    length = strlen (contents);
+    if (fwrite (contents, 1, length, fp) != length)
+    {
+        fclose (fp);
+        return (EXIT_FAILURE);
+    }
+    fclose (fp);
+    return (EXIT_SUCCESS);
+}
+
+/*!
+ * \brief Run a single test and report its result.
+ *
+ * \return \c 1 when the test failed, \c 0 otherwise.
+ */
+static int test_run (const char *name, int (*test) (void))
+{
+    if (test () != EXIT_SUCCESS)
+    {
+        fprintf (stdout, "TESTS: %s failed\n", name);
+        return 1;
+    }
+    fprintf (stdout, "TESTS: %s passed\n", name);
+    return 0;
+}
+
+/*!
+ * \brief Run the tests for libdxf.
+ *
+ * The example drawing from the examples dir is read with the lazy
+ * reader, dxf_file_read () does not get past its \c HEADER section yet.
  *
  * \version According to DXF R2000.
  */
 int main (void)
 {
-    if (dxf_file_read ("../../examples/qcad-example_R2000.dxf"))
-        fprintf (stdout, "TESTS: R2000 exited with error\n");
-    else
-        fprintf (stdout, "TESTS: R2000 exited with no error\n");
-    
-    return 1;
+    int failures = 0;
+
+    failures += test_run ("mtext", test_mtext);
+    failures += test_run ("point", test_point);
+    failures += test_run ("lwpolyline", test_lwpolyline);
+    failures += test_run ("binary data", test_binary_data);
+    failures += test_run ("thumbnail", test_thumbnail);
+    failures += test_run ("3dsolid", test_3dsolid);
+    failures += test_run ("entities", test_entities);
+    failures += test_run ("handle index", test_handle_index);
+    failures += test_run ("rtree", test_rtree);
+    failures += test_run ("nearest", test_nearest);
+    failures += test_run ("block index", test_block_index);
+    failures += test_run ("text index", test_text_index);
+    failures += test_run ("table", test_table);
+    failures += test_run ("handle", test_handle);
+    failures += test_run ("HATCH entity", test_hatch);
+    failures += test_run ("snapshot", test_snapshot);
+    failures += test_run ("numeric arrays", test_array);
+    failures += test_run ("memory usage", test_memory_usage);
+    failures += test_run ("layer partition", test_layer_partition);
+    failures += test_run ("bounds", test_bounds);
+    failures += test_run ("dictionary tree", test_dictionary_tree);
+    failures += test_run ("draw order", test_draw_order);
+    failures += test_run ("reference index", test_reference_index);
+
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }